@@ -25,33 +25,113 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include "filesystem.h"
 #include "watch.h"
+#include "watch_crc32.h"
 #include "lfs.h"
 #include "base64.h"
+#include "lzss.h"
 #include "delay.h"
+#if !__EMSCRIPTEN__
+#include "watch_usb_cdc.h"
+#endif
 
 #ifndef min
 #define min(x, y) ((x) > (y) ? (y) : (x))
 #endif
 
+// On-flash header for files stored via filesystem_write_file_compressed: four
+// magic bytes followed by the original length, little endian. The magic starts
+// with a NUL so no text file can ever be mistaken for a compressed one.
+#define LZ_HEADER_SIZE 6
+static const uint8_t lz_header_magic[4] = {0x00, 'L', 'Z', 0x01};
+
+static void _transfer_wait_to_send(size_t length);
+
 int lfs_storage_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size);
 int lfs_storage_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size);
 int lfs_storage_erase(const struct lfs_config *cfg, lfs_block_t block);
 int lfs_storage_sync(const struct lfs_config *cfg);
 
+// Block-level read cache layered under littlefs's read callback. With read_size at 16,
+// littlefs re-walks the same small regions of flash every time a hot file (settings,
+// TOTP secrets) is opened; a few 64-byte lines keyed by block and offset keep those
+// regions RAM-resident after first access. Hit/miss counters are visible via the
+// shell's fscache command.
+#define LFS_READ_CACHE_LINE_SIZE 64
+#define LFS_READ_CACHE_NUM_LINES 4
+
+typedef struct {
+    lfs_block_t block;
+    lfs_off_t offset;
+    bool valid;
+    uint8_t data[LFS_READ_CACHE_LINE_SIZE];
+} lfs_read_cache_line_t;
+
+static lfs_read_cache_line_t read_cache[LFS_READ_CACHE_NUM_LINES];
+static uint8_t read_cache_next_fill = 0;
+static uint32_t read_cache_hits = 0;
+static uint32_t read_cache_misses = 0;
+
+static void lfs_read_cache_invalidate_block(lfs_block_t block) {
+    for (int i = 0; i < LFS_READ_CACHE_NUM_LINES; i++) {
+        if (read_cache[i].valid && read_cache[i].block == block) read_cache[i].valid = false;
+    }
+}
+
 int lfs_storage_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size) {
     (void) cfg;
-    return !watch_storage_read(block, off, (void *)buffer, size);
+    uint8_t *out = buffer;
+
+    // serve the request line by line; a read may straddle a cache line boundary.
+    while (size) {
+        lfs_off_t line_offset = off & ~(lfs_off_t)(LFS_READ_CACHE_LINE_SIZE - 1);
+        lfs_size_t chunk = min(size, LFS_READ_CACHE_LINE_SIZE - (off - line_offset));
+
+        lfs_read_cache_line_t *line = NULL;
+        for (int i = 0; i < LFS_READ_CACHE_NUM_LINES; i++) {
+            if (read_cache[i].valid && read_cache[i].block == block && read_cache[i].offset == line_offset) {
+                line = &read_cache[i];
+                read_cache_hits++;
+                break;
+            }
+        }
+
+        if (line == NULL) {
+            read_cache_misses++;
+            line = &read_cache[read_cache_next_fill];
+            read_cache_next_fill = (read_cache_next_fill + 1) % LFS_READ_CACHE_NUM_LINES;
+            line->valid = false;
+            if (!watch_storage_read(block, line_offset, line->data, LFS_READ_CACHE_LINE_SIZE)) return 1;
+            line->block = block;
+            line->offset = line_offset;
+            line->valid = true;
+        }
+
+        memcpy(out, line->data + (off - line_offset), chunk);
+        out += chunk;
+        off += chunk;
+        size -= chunk;
+    }
+
+    return 0;
 }
 
+// set on any write or erase; maintenance passes only run when there's been activity.
+static bool dirty_since_maintenance = false;
+
 int lfs_storage_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size) {
     (void) cfg;
+    dirty_since_maintenance = true;
+    lfs_read_cache_invalidate_block(block);
     return !watch_storage_write(block, off, (void *)buffer, size);
 }
 
 int lfs_storage_erase(const struct lfs_config *cfg, lfs_block_t block) {
     (void) cfg;
+    dirty_since_maintenance = true;
+    lfs_read_cache_invalidate_block(block);
     return !watch_storage_erase(block);
 }
 
@@ -171,16 +251,69 @@ int _filesystem_format(void) {
     return 0;
 }
 
+// Write-behind queue: small writes faces make while resigning park here in RAM and hit
+// flash later, so face transitions don't stall on a littlefs commit. Movement flushes the
+// queue at the top of each minute and on entry to low energy mode, which bounds the
+// data-loss window to about a minute of active use.
+#define FILESYSTEM_DEFERRED_SLOTS 4
+#define FILESYSTEM_DEFERRED_MAX_FILENAME 16
+#define FILESYSTEM_DEFERRED_MAX_LENGTH 32
+
+typedef struct {
+    char filename[FILESYSTEM_DEFERRED_MAX_FILENAME];
+    uint8_t data[FILESYSTEM_DEFERRED_MAX_LENGTH];
+    int32_t length;
+    bool used;
+} filesystem_deferred_write_t;
+
+static filesystem_deferred_write_t deferred_writes[FILESYSTEM_DEFERRED_SLOTS];
+
+// commit a single pending write (called from the read paths so a deferred write is never
+// invisible to a reader of the same file).
+static void filesystem_commit_deferred(char *filename) {
+    for (int i = 0; i < FILESYSTEM_DEFERRED_SLOTS; i++) {
+        if (deferred_writes[i].used && !strcmp(deferred_writes[i].filename, filename)) {
+            deferred_writes[i].used = false;
+            filesystem_write_file(deferred_writes[i].filename, (char *)deferred_writes[i].data, deferred_writes[i].length);
+            return;
+        }
+    }
+}
+
+// Stat cache: faces call filesystem_file_exists and filesystem_get_file_size in their
+// activate paths, and each lfs_stat is a full metadata traversal. A few cached results
+// keyed by filename make repeated checks resolve from RAM; every mutating call below
+// invalidates the touched file (or the whole cache, where the filename isn't known).
+#define FILESYSTEM_STAT_CACHE_SLOTS 4
+
+typedef struct {
+    char filename[FILESYSTEM_DEFERRED_MAX_FILENAME];
+    int32_t size; // -1 when the file does not exist
+    bool valid;
+} filesystem_stat_cache_entry_t;
+
+static filesystem_stat_cache_entry_t stat_cache[FILESYSTEM_STAT_CACHE_SLOTS];
+static uint8_t stat_cache_next_fill = 0;
+
+static void filesystem_stat_cache_invalidate(char *filename) {
+    for (int i = 0; i < FILESYSTEM_STAT_CACHE_SLOTS; i++) {
+        if (stat_cache[i].valid && !strcmp(stat_cache[i].filename, filename)) stat_cache[i].valid = false;
+    }
+}
+
+static void filesystem_stat_cache_invalidate_all(void) {
+    for (int i = 0; i < FILESYSTEM_STAT_CACHE_SLOTS; i++) stat_cache[i].valid = false;
+}
+
 bool filesystem_file_exists(char *filename) {
-    info.type = 0;
-    lfs_stat(&eeprom_filesystem, filename, &info);
-    return info.type == LFS_TYPE_REG;
+    return filesystem_get_file_size(filename) >= 0;
 }
 
 bool filesystem_rm(char *filename) {
     info.type = 0;
     lfs_stat(&eeprom_filesystem, filename, &info);
     if (filesystem_file_exists(filename)) {
+        filesystem_stat_cache_invalidate(filename);
         return lfs_remove(&eeprom_filesystem, filename) == LFS_ERR_OK;
     } else {
         printf("rm: %s: No such file\r\n", filename);
@@ -189,11 +322,67 @@ bool filesystem_rm(char *filename) {
 }
 
 int32_t filesystem_get_file_size(char *filename) {
-    if (filesystem_file_exists(filename)) {
-        return info.size; // info struct was just populated by filesystem_file_exists
+    filesystem_commit_deferred(filename);
+
+    for (int i = 0; i < FILESYSTEM_STAT_CACHE_SLOTS; i++) {
+        if (stat_cache[i].valid && !strcmp(stat_cache[i].filename, filename)) return stat_cache[i].size;
     }
 
-    return -1;
+    info.type = 0;
+    info.size = 0;
+    lfs_stat(&eeprom_filesystem, filename, &info);
+    int32_t size = (info.type == LFS_TYPE_REG) ? (int32_t)info.size : -1;
+
+    if (size >= LZ_HEADER_SIZE) {
+        // compressed files report their decompressed size, so callers size
+        // their buffers for the contents they'll actually read back
+        uint8_t header[LZ_HEADER_SIZE];
+        if (lfs_file_open(&eeprom_filesystem, &file, filename, LFS_O_RDONLY) >= 0) {
+            if (lfs_file_read(&eeprom_filesystem, &file, header, LZ_HEADER_SIZE) == LZ_HEADER_SIZE &&
+                memcmp(header, lz_header_magic, sizeof(lz_header_magic)) == 0) {
+                size = header[4] | ((int32_t)header[5] << 8);
+            }
+            lfs_file_close(&eeprom_filesystem, &file);
+        }
+    }
+
+    if (strlen(filename) < sizeof(stat_cache[0].filename)) {
+        filesystem_stat_cache_entry_t *entry = &stat_cache[stat_cache_next_fill];
+        stat_cache_next_fill = (stat_cache_next_fill + 1) % FILESYSTEM_STAT_CACHE_SLOTS;
+        strcpy(entry->filename, filename);
+        entry->size = size;
+        entry->valid = true;
+    }
+
+    return size;
+}
+
+// Reads the compressed payload that follows an lz header from the open static
+// file handle and decompresses it into buf. If the caller's buffer is smaller
+// than the original, decompresses in full and hands back the prefix, matching
+// what a short read of a plain file would return.
+static bool filesystem_read_compressed(const uint8_t *header, int32_t payload_size, char *buf, int32_t length) {
+    int32_t original = header[4] | ((int32_t)header[5] << 8);
+    if (original <= 0 || payload_size <= 0) return false;
+    uint8_t *payload = malloc(payload_size);
+    if (payload == NULL) return false;
+    bool ok = false;
+    if (lfs_file_read(&eeprom_filesystem, &file, payload, payload_size) == payload_size) {
+        if (length >= original) {
+            ok = lzss_decompress(payload, payload_size, (uint8_t *)buf, original) == original;
+        } else {
+            uint8_t *full = malloc(original);
+            if (full != NULL) {
+                if (lzss_decompress(payload, payload_size, full, original) == original) {
+                    memcpy(buf, full, length);
+                    ok = true;
+                }
+                free(full);
+            }
+        }
+    }
+    free(payload);
+    return ok;
 }
 
 bool filesystem_read_file(char *filename, char *buf, int32_t length) {
@@ -202,6 +391,17 @@ bool filesystem_read_file(char *filename, char *buf, int32_t length) {
     if (file_size > 0) {
         int err = lfs_file_open(&eeprom_filesystem, &file, filename, LFS_O_RDONLY);
         if (err < 0) return false;
+        int32_t raw_size = lfs_file_size(&eeprom_filesystem, &file);
+        uint8_t header[LZ_HEADER_SIZE];
+        if (raw_size >= LZ_HEADER_SIZE &&
+            lfs_file_read(&eeprom_filesystem, &file, header, LZ_HEADER_SIZE) == LZ_HEADER_SIZE &&
+            memcmp(header, lz_header_magic, sizeof(lz_header_magic)) == 0) {
+            bool ok = filesystem_read_compressed(header, raw_size - LZ_HEADER_SIZE, buf, length);
+            lfs_file_close(&eeprom_filesystem, &file);
+            return ok;
+        }
+        err = lfs_file_seek(&eeprom_filesystem, &file, 0, LFS_SEEK_SET);
+        if (err < 0) return false;
         err = lfs_file_read(&eeprom_filesystem, &file, buf, min(length, file_size));
         if (err < 0) return false;
         return lfs_file_close(&eeprom_filesystem, &file) == LFS_ERR_OK;
@@ -233,14 +433,156 @@ bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t le
     return false;
 }
 
+// Persistent handle for filesystem_open_read / filesystem_read_at. Separate from the
+// static handle above so an open read doesn't get clobbered by other filesystem calls.
+static lfs_file_t read_file;
+static bool read_file_open = false;
+
+bool filesystem_open_read(char *filename) {
+    if (read_file_open) return false;
+    filesystem_commit_deferred(filename);
+    if (lfs_file_open(&eeprom_filesystem, &read_file, filename, LFS_O_RDONLY) < 0) return false;
+    read_file_open = true;
+    return true;
+}
+
+int32_t filesystem_read_at(int32_t offset, char *buf, int32_t length) {
+    if (!read_file_open) return -1;
+    // littlefs keeps seeks within the cached block cheap; only a seek to another block
+    // pays a traversal, so sequential line reads cost one traversal total.
+    if (lfs_file_seek(&eeprom_filesystem, &read_file, offset, LFS_SEEK_SET) < 0) return -1;
+    int32_t bytes_read = lfs_file_read(&eeprom_filesystem, &read_file, buf, length);
+    if (bytes_read < 0) return -1;
+    buf[bytes_read] = 0;
+    return bytes_read;
+}
+
+void filesystem_read_ahead(int32_t offset) {
+    if (!read_file_open) return;
+    // walk littlefs to this region now — the block traversal plus the first
+    // cache-line fills — so the next read_at of it starts from warm caches.
+    // Reading past the end of the file is a harmless no-op.
+    uint8_t scratch[LFS_READ_CACHE_LINE_SIZE];
+    if (lfs_file_seek(&eeprom_filesystem, &read_file, offset, LFS_SEEK_SET) < 0) return;
+    lfs_file_read(&eeprom_filesystem, &read_file, scratch, sizeof(scratch));
+}
+
+bool filesystem_close(void) {
+    if (!read_file_open) return false;
+    read_file_open = false;
+    return lfs_file_close(&eeprom_filesystem, &read_file) == LFS_ERR_OK;
+}
+
+// Persistent append handle for logging. Appends accumulate in the file cache and are
+// committed every FILESYSTEM_APPEND_SYNC_INTERVAL records rather than per write, so a
+// minute-interval logger costs one metadata commit per batch instead of one per record.
+#define FILESYSTEM_APPEND_SYNC_INTERVAL 8
+static lfs_file_t append_file;
+static bool append_file_open = false;
+static uint8_t appends_since_sync = 0;
+
+bool filesystem_write_file_deferred(char *filename, char *text, int32_t length) {
+    // anything too big for a slot just writes through; the queue is for the little
+    // settings and tally records faces persist on resign.
+    if (length > FILESYSTEM_DEFERRED_MAX_LENGTH || strlen(filename) >= FILESYSTEM_DEFERRED_MAX_FILENAME) {
+        return filesystem_write_file(filename, text, length);
+    }
+
+    int slot = -1;
+    for (int i = 0; i < FILESYSTEM_DEFERRED_SLOTS; i++) {
+        if (deferred_writes[i].used && !strcmp(deferred_writes[i].filename, filename)) {
+            // a newer write to the same file replaces the pending one; repeated updates
+            // between flushes collapse into a single commit.
+            slot = i;
+            break;
+        }
+        if (slot < 0 && !deferred_writes[i].used) slot = i;
+    }
+
+    if (slot < 0) {
+        // queue full of other files; make room the honest way.
+        filesystem_flush();
+        slot = 0;
+    }
+
+    strcpy(deferred_writes[slot].filename, filename);
+    memcpy(deferred_writes[slot].data, text, length);
+    deferred_writes[slot].length = length;
+    deferred_writes[slot].used = true;
+    return true;
+}
+
+void filesystem_flush(void) {
+    for (int i = 0; i < FILESYSTEM_DEFERRED_SLOTS; i++) {
+        if (deferred_writes[i].used) {
+            deferred_writes[i].used = false;
+            filesystem_write_file(deferred_writes[i].filename, (char *)deferred_writes[i].data, deferred_writes[i].length);
+        }
+    }
+}
+
+bool filesystem_open_append(char *filename) {
+    if (append_file_open) return false;
+    filesystem_stat_cache_invalidate(filename);
+    if (lfs_file_open(&eeprom_filesystem, &append_file, filename, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) < 0) return false;
+    append_file_open = true;
+    appends_since_sync = 0;
+    return true;
+}
+
+bool filesystem_append(char *text, int32_t length) {
+    if (!append_file_open) return false;
+    if (lfs_file_write(&eeprom_filesystem, &append_file, text, length) < 0) return false;
+    if (++appends_since_sync >= FILESYSTEM_APPEND_SYNC_INTERVAL) return filesystem_sync();
+    return true;
+}
+
+bool filesystem_sync(void) {
+    if (!append_file_open) return true; // nothing buffered, nothing to lose
+    appends_since_sync = 0;
+    // we don't track the open file's name, so committed appends clear the whole cache.
+    filesystem_stat_cache_invalidate_all();
+    return lfs_file_sync(&eeprom_filesystem, &append_file) == LFS_ERR_OK;
+}
+
+bool filesystem_close_append(void) {
+    if (!append_file_open) return false;
+    append_file_open = false;
+    filesystem_stat_cache_invalidate_all();
+    return lfs_file_close(&eeprom_filesystem, &append_file) == LFS_ERR_OK;
+}
+
+void filesystem_perform_maintenance(void) {
+    // only worth the traversal if something was written since the last pass
+    if (!dirty_since_maintenance) return;
+
+#if defined(LFS_VERSION) && (LFS_VERSION >= 0x00020008)
+    // littlefs 2.8+: one proactive gc pass finds free blocks (and, on versions
+    // with compact_thresh, compacts metadata logs) so the next append doesn't
+    // have to. A pass is bounded by the filesystem's size, and we only get here
+    // on the way into low energy mode, when nobody is waiting on the display.
+    lfs_fs_gc(&eeprom_filesystem);
+#else
+    // older littlefs has no gc entry point; a free-space traversal at least
+    // walks the metadata path with our read cache warm for the next allocation.
+    filesystem_get_free_space();
+#endif
+
+    // gc's own block writes set the flag again; clearing it here keeps one
+    // quiet maintenance pass from scheduling another forever.
+    dirty_since_maintenance = false;
+}
+
 static void filesystem_cat(char *filename) {
     info.type = 0;
     lfs_stat(&eeprom_filesystem, filename, &info);
     if (filesystem_file_exists(filename)) {
-        if (info.size > 0) {
-            char *buf = malloc(info.size + 1);
-            filesystem_read_file(filename, buf, info.size);
-            buf[info.size] = '\0';
+        // logical size: compressed files cat as their decompressed contents
+        int32_t size = filesystem_get_file_size(filename);
+        if (size > 0) {
+            char *buf = malloc(size + 1);
+            filesystem_read_file(filename, buf, size);
+            buf[size] = '\0';
             printf("%s\r\n", buf);
             free(buf);
         } else {
@@ -252,6 +594,7 @@ static void filesystem_cat(char *filename) {
 }
 
 bool filesystem_write_file(char *filename, char *text, int32_t length) {
+    filesystem_stat_cache_invalidate(filename);
     if (filesystem_get_free_space() <= 256) {
         printf("No free space!\n");
         return false;    
@@ -264,7 +607,30 @@ bool filesystem_write_file(char *filename, char *text, int32_t length) {
     return lfs_file_close(&eeprom_filesystem, &file) == LFS_ERR_OK;
 }
 
+bool filesystem_write_file_compressed(char *filename, char *text, int32_t length) {
+    // too short to ever beat the header, or too long for its 16-bit length
+    // field: store it plain. The read side doesn't care either way.
+    if (length <= LZ_HEADER_SIZE + 1 || length > UINT16_MAX)
+        return filesystem_write_file(filename, text, length);
+
+    uint8_t *out = malloc(length);
+    if (out == NULL) return filesystem_write_file(filename, text, length);
+    memcpy(out, lz_header_magic, sizeof(lz_header_magic));
+    out[4] = (uint8_t)length;
+    out[5] = (uint8_t)(length >> 8);
+    // give the compressor only enough room to come out ahead: if the content
+    // doesn't shrink past the header it reports -1 and we store it plain
+    int32_t compressed = lzss_compress((uint8_t *)text, length, out + LZ_HEADER_SIZE, length - LZ_HEADER_SIZE - 1);
+
+    bool ok;
+    if (compressed < 0) ok = filesystem_write_file(filename, text, length);
+    else ok = filesystem_write_file(filename, (char *)out, LZ_HEADER_SIZE + compressed);
+    free(out);
+    return ok;
+}
+
 bool filesystem_append_file(char *filename, char *text, int32_t length) {
+    filesystem_stat_cache_invalidate(filename);
     if (filesystem_get_free_space() <= 256) {
         printf("No free space!\n");
         return false;    
@@ -277,6 +643,16 @@ bool filesystem_append_file(char *filename, char *text, int32_t length) {
     return lfs_file_close(&eeprom_filesystem, &file) == LFS_ERR_OK;
 }
 
+int filesystem_cmd_cachestats(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+    uint32_t total = read_cache_hits + read_cache_misses;
+    printf("read cache: %lu hits / %lu misses", (unsigned long)read_cache_hits, (unsigned long)read_cache_misses);
+    if (total) printf(" (%lu%% hit rate)", (unsigned long)((read_cache_hits * 100) / total));
+    printf("\r\n");
+    return 0;
+}
+
 int filesystem_cmd_ls(int argc, char *argv[]) {
     if (argc >= 2) {
         filesystem_ls(&eeprom_filesystem, argv[1]);
@@ -294,30 +670,224 @@ int filesystem_cmd_cat(int argc, char *argv[]) {
 
 int filesystem_cmd_b64encode(int argc, char *argv[]) {
     (void) argc;
-    info.type = 0;
-    lfs_stat(&eeprom_filesystem, argv[1], &info);
-    if (filesystem_file_exists(argv[1])) {
-        if (info.size > 0) {
-            char *buf = malloc(info.size + 1);
-            filesystem_read_file(argv[1], buf, info.size);
-            // print a base 64 encoding of the file, 12 bytes at a time
-            for (lfs_size_t i = 0; i < info.size; i += 12) {
-                lfs_size_t len = min(12, info.size - i);
-                char base64_line[17];
-                b64_encode((unsigned char *)buf + i, len, (unsigned char *)base64_line);
-                printf("%s\n", base64_line);
-                delay_ms(10);
-            }
-            free(buf);
-        } else {
-            printf("\r\n");
-        }
-    } else {
+    int32_t size = filesystem_get_file_size(argv[1]);
+    if (size < 0) {
         printf("b64encode: %s: No such file\r\n", argv[1]);
+        return 0;
+    }
+    if (size == 0) {
+        printf("\r\n");
+        return 0;
+    }
+    if (!filesystem_open_read(argv[1])) {
+        printf("b64encode: %s: open failed\r\n", argv[1]);
+        return 0;
+    }
+
+    // stream the file through the incremental encoder 12 bytes (one 16-character
+    // line) at a time: no whole-file staging buffer, and output paced by the CDC
+    // write buffer's free space rather than a fixed delay per line.
+    b64_encode_state state;
+    b64_stream_encode_init(&state);
+    char chunk[13];
+    char base64_line[21];
+    for (int32_t offset = 0; offset < size; offset += 12) {
+        int32_t length = filesystem_read_at(offset, chunk, min(12, size - offset));
+        if (length <= 0) break;
+        if (b64_stream_encode_update(&state, (unsigned char *)chunk, length, (unsigned char *)base64_line)) {
+            _transfer_wait_to_send(24);
+            printf("%s\n", base64_line);
+        }
+    }
+    filesystem_close();
+
+    if (b64_stream_encode_final(&state, (unsigned char *)base64_line)) {
+        _transfer_wait_to_send(24);
+        printf("%s\n", base64_line);
     }
     return 0;
 }
 
+// get/put: CRC-checked bulk file transfer over the CDC shell. The echo-based paths
+// (cat, b64encode) pace themselves with fixed delays and still corrupt when the host
+// hiccups; these frame every chunk in base64 with a CRC-32 so the host tool can verify
+// each line and the whole file.
+//
+// get FILE
+//   -> "GET <size> <crc32>"      whole-file size in bytes and CRC-32 (poly 0xEDB88320;
+//                                computed by the DSU on hardware, see watch_crc32.h)
+//   -> "<seq> <base64> <crc32>"  one line per 48-byte chunk; the CRC covers the raw bytes
+//   -> "END"
+// Output is paced by the CDC write buffer's free space instead of fixed delays, so the
+// link runs as fast as the host drains it and nothing falls off the ring.
+//
+// put FILE SIZE
+//   -> "PUT <window> <chunk>"    receive window in lines, max raw chunk size in bytes
+//   <- "<base64> <crc32>"        host keeps at most <window> unacknowledged lines in flight
+//   -> "ACK <n>"                 after every <window> lines ("NAK <n>" aborts the transfer)
+//   <- "END <crc32>"             whole-file CRC; the file is only written if it matches
+//   -> "OK" / "FAIL <reason>"
+// The window exists because the CDC read ring is 256 bytes: two 75-byte lines in flight
+// fit comfortably, an unpaced firehose would overwrite it.
+
+#define TRANSFER_CHUNK_SIZE (48)
+#define TRANSFER_WINDOW_LINES (2)
+#define TRANSFER_LINE_MAX (80)
+#define TRANSFER_TIMEOUT_MS (10000)
+
+#if __EMSCRIPTEN__
+static void _transfer_wait_to_send(size_t length) {
+    (void) length;
+}
+#else
+void yield(void); // movement.c; pumps the USB stack while a command monopolizes the foreground
+static void _transfer_wait_to_send(size_t length) {
+    while (cdc_write_free() < length) yield();
+}
+#endif
+
+int filesystem_cmd_get(int argc, char *argv[]) {
+    (void) argc;
+    int32_t size = filesystem_get_file_size(argv[1]);
+    if (size < 0) {
+        printf("get: %s: No such file\r\n", argv[1]);
+        return -1;
+    }
+    if (!filesystem_open_read(argv[1])) {
+        printf("get: %s: open failed\r\n", argv[1]);
+        return -1;
+    }
+
+    uint8_t chunk[TRANSFER_CHUNK_SIZE + 1]; // read_at null-terminates one byte past the data
+
+    // first pass: whole-file CRC for the header, so the host can verify up front.
+    uint32_t file_crc = 0;
+    for (int32_t offset = 0; offset < size; offset += TRANSFER_CHUNK_SIZE) {
+        int32_t length = filesystem_read_at(offset, (char *)chunk, min(TRANSFER_CHUNK_SIZE, size - offset));
+        if (length < 0) {
+            filesystem_close();
+            printf("get: read failed\r\n");
+            return -1;
+        }
+        file_crc = watch_crc32_update(file_crc, chunk, length);
+    }
+
+    _transfer_wait_to_send(TRANSFER_LINE_MAX);
+    printf("GET %ld %08lx\r\n", (long)size, (unsigned long)file_crc);
+
+    uint16_t seq = 0;
+    for (int32_t offset = 0; offset < size; offset += TRANSFER_CHUNK_SIZE, seq++) {
+        int32_t length = filesystem_read_at(offset, (char *)chunk, min(TRANSFER_CHUNK_SIZE, size - offset));
+        if (length <= 0) break;
+        char encoded[68]; // b64e_size(48) is 64, plus the terminator
+        b64_encode(chunk, length, (unsigned char *)encoded);
+        _transfer_wait_to_send(TRANSFER_LINE_MAX);
+        printf("%04x %s %08lx\r\n", seq, encoded, (unsigned long)watch_crc32_update(0, chunk, length));
+    }
+    filesystem_close();
+
+    _transfer_wait_to_send(TRANSFER_LINE_MAX);
+    printf("END\r\n");
+    return 0;
+}
+
+int filesystem_cmd_put(int argc, char *argv[]) {
+#if __EMSCRIPTEN__
+    (void) argc;
+    (void) argv;
+    // the simulator shell delivers one line per task and can't block for more input.
+    printf("put: not supported in the simulator\r\n");
+    return -1;
+#else
+    (void) argc;
+    int32_t size = atoi(argv[2]);
+    if (size <= 0 || size > filesystem_get_free_space()) {
+        printf("put: bad size\r\n");
+        return -1;
+    }
+    char *data = malloc(size);
+    if (data == NULL) {
+        printf("put: out of memory\r\n");
+        return -1;
+    }
+
+    printf("PUT %d %d\r\n", TRANSFER_WINDOW_LINES, TRANSFER_CHUNK_SIZE);
+
+    char line[TRANSFER_LINE_MAX];
+    uint8_t chunk[TRANSFER_CHUNK_SIZE + 3]; // b64d_size(64) is 49
+    int32_t received = 0;
+    uint32_t file_crc = 0;
+    uint16_t seq = 0;
+
+    while (true) {
+        // read one line, pumping the USB stack while we wait for the host.
+        size_t line_length = 0;
+        uint32_t waited_ms = 0;
+        while (true) {
+            // raw read, bypassing stdio's input buffer: the shell reads the same
+            // stream unbuffered, and bytes stranded in stdio would vanish on it.
+            char ch;
+            int c = (read(0, &ch, 1) == 1) ? (unsigned char)ch : -1;
+            if (c < 0) {
+                yield();
+                delay_ms(1);
+                if (++waited_ms > TRANSFER_TIMEOUT_MS) {
+                    free(data);
+                    printf("FAIL timeout\r\n");
+                    return -1;
+                }
+                continue;
+            }
+            waited_ms = 0;
+            if (c == '\n' || c == '\r') {
+                if (line_length == 0) continue; // swallow the other half of CRLF
+                break;
+            }
+            if (line_length < sizeof(line) - 1) line[line_length++] = c;
+        }
+        line[line_length] = '\0';
+
+        char *crc_str = strrchr(line, ' ');
+        if (crc_str == NULL) {
+            free(data);
+            printf("NAK %u\r\n", seq);
+            return -1;
+        }
+        *crc_str++ = '\0';
+        uint32_t sent_crc = strtoul(crc_str, NULL, 16);
+
+        if (!strcmp(line, "END")) {
+            if (received != size) {
+                free(data);
+                printf("FAIL short\r\n");
+                return -1;
+            }
+            if (sent_crc != file_crc) {
+                free(data);
+                printf("FAIL crc\r\n");
+                return -1;
+            }
+            bool ok = filesystem_write_file(argv[1], data, size);
+            free(data);
+            printf(ok ? "OK\r\n" : "FAIL write\r\n");
+            return ok ? 0 : -1;
+        }
+
+        uint32_t length = b64_decode((unsigned char *)line, strlen(line), chunk);
+        if (length == 0 || received + (int32_t)length > size || watch_crc32_update(0, chunk, length) != sent_crc) {
+            free(data);
+            printf("NAK %u\r\n", seq);
+            return -1;
+        }
+        memcpy(data + received, chunk, length);
+        received += length;
+        file_crc = watch_crc32_update(file_crc, chunk, length);
+        seq++;
+        if (seq % TRANSFER_WINDOW_LINES == 0) printf("ACK %u\r\n", seq);
+    }
+#endif
+}
+
 int filesystem_cmd_df(int argc, char *argv[]) {
     (void) argc;
     (void) argv;
@@ -332,6 +902,7 @@ int filesystem_cmd_rm(int argc, char *argv[]) {
 }
 
 int filesystem_cmd_format(int argc, char *argv[]) {
+    filesystem_stat_cache_invalidate_all();
     (void) argc;
     if(strcmp(argv[1], "YES") == 0) {
         return _filesystem_format();
@@ -80,6 +80,42 @@ bool filesystem_read_file(char *filename, char *buf, int32_t length);
   */
 bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t length);
 
+/** @brief Opens a file for a series of random-access reads via filesystem_read_at
+  * @param filename the file you wish to read
+  * @return true if the file was opened; false otherwise
+  * @note Unlike filesystem_read_line, which reopens the file and seeks from scratch on every
+  *       call, this keeps one file handle open across reads, so walking a multi-line file
+  *       costs a single littlefs traversal. Only one file can be open this way at a time;
+  *       call filesystem_close when you're done with it.
+  */
+bool filesystem_open_read(char *filename);
+
+/** @brief Reads bytes from the file opened with filesystem_open_read
+  * @param offset The offset into the file to read from
+  * @param buf A buffer of at least length + 1 bytes; the last byte read will be followed by
+  *            a 0 as a null terminator.
+  * @param length The maximum number of bytes to read
+  * @return the number of bytes read, or -1 on error
+  */
+int32_t filesystem_read_at(int32_t offset, char *buf, int32_t length);
+
+/** @brief Hints that the file opened with filesystem_open_read is about to be read at offset
+  * @param offset The offset of the upcoming read
+  * @note A sequential consumer that parses one line and then reads the next pays a littlefs
+  *       block traversal in the middle of its loop whenever a read crosses a block boundary.
+  *       Calling this with the next read's offset right after the current read pulls that
+  *       traversal — and the first cache-line fills for the region — forward to before the
+  *       parsing work, so the read_at that follows is served from warm caches. Purely an
+  *       optimization: skipping it (or hinting past the end of the file) changes nothing
+  *       but timing.
+  */
+void filesystem_read_ahead(int32_t offset);
+
+/** @brief Closes the file opened with filesystem_open_read
+  * @return true if the file was closed cleanly; false otherwise
+  */
+bool filesystem_close(void);
+
 /** @brief Writes file to the filesystem
   * @param filename the file you wish to write
   * @param text The contents of the file
@@ -88,6 +124,80 @@ bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t le
   */
 bool filesystem_write_file(char *filename, char *text, int32_t length);
 
+/** @brief Writes a file to the filesystem, LZSS-compressed if that makes it smaller
+  * @param filename the file you wish to write
+  * @param text The contents of the file
+  * @param length The number of bytes to write
+  * @return true if the write was successful; false otherwise
+  * @note Text on this filesystem (TOTP config, notes, settings) typically shrinks to
+  *       half its size or better, which both stretches the 8 KB region and cuts the
+  *       bytes programmed per rewrite. The compressed form is an implementation detail:
+  *       filesystem_read_file decompresses transparently and filesystem_get_file_size
+  *       reports the original length, so a face can switch its writes to this function
+  *       and change nothing else. Content that doesn't shrink (or is larger than 64 KB)
+  *       is stored plain automatically. Two caveats: filesystem_read_line and
+  *       filesystem_read_at see the raw bytes, so files read through those should stay
+  *       on filesystem_write_file; and appending to a compressed file will corrupt it.
+  */
+bool filesystem_write_file_compressed(char *filename, char *text, int32_t length);
+
+/** @brief Queues a small write to be committed later, making it cheap to persist state on resign
+  * @param filename the file you wish to write (15 characters or less)
+  * @param text The contents of the file (32 bytes or less; larger writes fall back to
+  *             filesystem_write_file and commit immediately)
+  * @param length The number of bytes to write
+  * @return true if the write was queued (or written through); false otherwise
+  * @note The write lands in a small RAM queue and hits flash when movement flushes it — at
+  *       the top of the next minute or on entry to low energy mode — so switching away from
+  *       a face that persists state doesn't stall on a littlefs commit. A queued write to
+  *       the same file replaces the pending one, and the read functions commit a pending
+  *       write before reading, so readers never see stale data.
+  */
+bool filesystem_write_file_deferred(char *filename, char *text, int32_t length);
+
+/** @brief Commits all queued deferred writes to flash.
+  */
+void filesystem_flush(void);
+
+/** @brief Opens a file for a series of appends via filesystem_append
+  * @param filename the file you wish to append to; it will be created if it does not exist
+  * @return true if the file was opened; false otherwise
+  * @note filesystem_append_file opens, appends and closes on every record, which makes
+  *       littlefs commit metadata for each write — ruinous for minute-interval logging on
+  *       an 8 KB flash region. This keeps one handle open so appends accumulate in the
+  *       file cache, committing only every FILESYSTEM_APPEND_SYNC_INTERVAL records, on
+  *       filesystem_sync, or on close. Movement syncs the handle automatically when the
+  *       watch enters low energy mode, so at most a few minutes of records are ever
+  *       at risk from a dead battery. Only one append handle can be open at a time.
+  */
+bool filesystem_open_append(char *filename);
+
+/** @brief Appends text to the file opened with filesystem_open_append
+  * @param text The contents to append
+  * @param length The number of bytes to append
+  * @return true if the append was accepted; false otherwise
+  */
+bool filesystem_append(char *text, int32_t length);
+
+/** @brief Commits any buffered appends to flash without closing the handle
+  * @return true if the data is safely on flash (or nothing was open); false otherwise
+  */
+bool filesystem_sync(void);
+
+/** @brief Runs littlefs housekeeping while nobody is watching
+  * @note littlefs normally reclaims blocks lazily inside writes, so once in a while a
+  *       one-record append pays for a multi-block compaction. Movement calls this on the
+  *       way into low energy mode, after flushing; it runs one garbage collection pass
+  *       (on littlefs builds that have one) so that cost is paid during idle time instead
+  *       of a future append. Does nothing if nothing was written since the last pass.
+  */
+void filesystem_perform_maintenance(void);
+
+/** @brief Closes the file opened with filesystem_open_append, committing buffered appends
+  * @return true if the file was closed cleanly; false otherwise
+  */
+bool filesystem_close_append(void);
+
 /** @brief Appends text to file on the filesystem
   * @param filename the file you wish to write
   * @param text The contents to write
@@ -96,9 +206,12 @@ bool filesystem_write_file(char *filename, char *text, int32_t length);
   */
 bool filesystem_append_file(char *filename, char *text, int32_t length);
 
+int filesystem_cmd_cachestats(int argc, char *argv[]);
 int filesystem_cmd_ls(int argc, char *argv[]);
 int filesystem_cmd_cat(int argc, char *argv[]);
 int filesystem_cmd_b64encode(int argc, char *argv[]);
+int filesystem_cmd_get(int argc, char *argv[]);
+int filesystem_cmd_put(int argc, char *argv[]);
 int filesystem_cmd_df(int argc, char *argv[]);
 int filesystem_cmd_rm(int argc, char *argv[]);
 int filesystem_cmd_format(int argc, char *argv[]);
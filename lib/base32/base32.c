@@ -70,6 +70,31 @@ static unsigned char encode_char(unsigned char c)
 	return base32[c & 0x1F];  // 0001 1111
 }
 
+/**
+ * Decode table: the 5 bits value for every valid base32 character, 0xFF for
+ * everything else (including the padding character). One load replaces the
+ * range checks of the old decode_char, and the 0xFF marker doubles as the
+ * validity accumulator bit in decode_sequence's whole-block fast path.
+ */
+static const unsigned char decode_table[256] = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+	0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
 /**
  * Decode given character into a 5 bits value. 
  * Returns -1 iff the argument given was an invalid base32 character
@@ -77,16 +102,8 @@ static unsigned char encode_char(unsigned char c)
  */
 static int decode_char(unsigned char c)
 {
-	int retval = -1;
-
-	if (c >= 'A' && c <= 'Z')
-		retval = c - 'A';
-	if (c >= '2' && c <= '7')
-		retval = c - '2' + 26;
-
-	assert(retval == -1 || ((retval & 0x1F) == retval));
-
-	return  retval;
+	int retval = decode_table[c];
+	return retval == 0xFF ? -1 : retval;
 }
 
 /**
@@ -191,6 +208,34 @@ static int decode_sequence(const unsigned char *coded, unsigned char *plain)
 	assert(CHAR_BIT == 8);
 	assert(coded && plain);
 
+	/* Whole-block fast path: gather the eight 5 bits values, stopping at the
+	 * first invalid character (terminator, padding, junk) so we never read
+	 * past the end of the string, and emit the 5 output bytes from two 20-bit
+	 * halves. An incomplete block falls through to the character-at-a-time
+	 * loop below, which handles the partial tail exactly as before -- that
+	 * happens at most once per decoded string. */
+	{
+		unsigned char t[8];
+		int n = 0;
+		while (n < 8) {
+			unsigned char v = decode_table[coded[n]];
+			if (v & 0xE0)
+				break;
+			t[n++] = v;
+		}
+
+		if (n == 8) {
+			unsigned long first  = ((unsigned long) t[0] << 15) | ((unsigned long) t[1] << 10) | ((unsigned long) t[2] << 5) | t[3];
+			unsigned long second = ((unsigned long) t[4] << 15) | ((unsigned long) t[5] << 10) | ((unsigned long) t[6] << 5) | t[7];
+			plain[0] = first >> 12;
+			plain[1] = first >> 4;
+			plain[2] = (first << 4) | (second >> 16);
+			plain[3] = second >> 8;
+			plain[4] = second;
+			return 5;
+		}
+	}
+
 	plain[0] = 0;
 	for (int block = 0; block < 8; block++) {
 		int offset = get_offset(block);
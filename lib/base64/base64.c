@@ -86,6 +86,64 @@ unsigned int b64_encode(const unsigned char* in, unsigned int in_len, unsigned c
 	return k;
 }
 
+void b64_stream_encode_init(b64_encode_state *state) {
+
+	state->rem_len = 0;
+}
+
+unsigned int b64_stream_encode_update(b64_encode_state *state, const unsigned char* in, unsigned int in_len, unsigned char* out) {
+
+	unsigned int i=0, j=0, k=0, s[3];
+
+	for (j=0;j<state->rem_len;j++)
+		s[j]=state->rem[j];
+
+	for (i=0;i<in_len;i++) {
+		s[j++]=*(in+i);
+		if (j==3) {
+			out[k+0] = b64_chr[ (s[0]&255)>>2 ];
+			out[k+1] = b64_chr[ ((s[0]&0x03)<<4)+((s[1]&0xF0)>>4) ];
+			out[k+2] = b64_chr[ ((s[1]&0x0F)<<2)+((s[2]&0xC0)>>6) ];
+			out[k+3] = b64_chr[ s[2]&0x3F ];
+			j=0; k+=4;
+		}
+	}
+
+	state->rem_len = j;
+	for (i=0;i<j;i++)
+		state->rem[i]=s[i];
+
+	out[k] = '\0';
+
+	return k;
+}
+
+unsigned int b64_stream_encode_final(b64_encode_state *state, unsigned char* out) {
+
+	unsigned int j=0, k=0, s[3];
+
+	for (j=0;j<state->rem_len;j++)
+		s[j]=state->rem[j];
+
+	if (j) {
+		if (j==1)
+			s[1] = 0;
+		out[k+0] = b64_chr[ (s[0]&255)>>2 ];
+		out[k+1] = b64_chr[ ((s[0]&0x03)<<4)+((s[1]&0xF0)>>4) ];
+		if (j==2)
+			out[k+2] = b64_chr[ ((s[1]&0x0F)<<2) ];
+		else
+			out[k+2] = '=';
+		out[k+3] = '=';
+		k+=4;
+	}
+
+	state->rem_len = 0;
+	out[k] = '\0';
+
+	return k;
+}
+
 unsigned int b64_decode(const unsigned char* in, unsigned int in_len, unsigned char* out) {
 
 	unsigned int i=0, j=0, k=0, s[4];
@@ -27,6 +27,25 @@ unsigned int b64d_size(unsigned int in_size);
 // returns size of output including null byte
 unsigned int b64_encode(const unsigned char* in, unsigned int in_len, unsigned char* out);
 
+// Incremental encoder: feed arbitrary spans with b64_stream_encode_update and
+// finish with b64_stream_encode_final, which emits the padded tail group. The
+// state carries the 0-2 residual bytes between calls, so arbitrarily large
+// inputs encode with a constant working set instead of a whole-file buffer.
+typedef struct {
+	unsigned char rem[3];
+	unsigned int rem_len;
+} b64_encode_state;
+
+void b64_stream_encode_init(b64_encode_state *state);
+
+// out must hold 4 characters for every complete 3-byte group available
+// (at most b64e_size(in_len + 2) bytes) plus the null terminator.
+// returns the number of characters written, excluding the null byte
+unsigned int b64_stream_encode_update(b64_encode_state *state, const unsigned char* in, unsigned int in_len, unsigned char* out);
+
+// out must hold 5 bytes. returns the number of characters written (0 or 4).
+unsigned int b64_stream_encode_final(b64_encode_state *state, unsigned char* out);
+
 // in : buffer of base64 string to be decoded.
 // in_len : number of bytes to be decoded.
 // out : pointer to buffer with enough memory, user is responsible for memory allocation, receives "raw" binary
@@ -22,15 +22,11 @@
  * SOFTWARE.
  */
 
-#include <stdlib.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 #include "chirpy_tx.h"
 
-static const uint32_t chirpy_min_freq = 2500;
-static const uint32_t chirpy_freq_step = 250;
-
 // This many bytes are followed by a CRC and block separator
 // It's a multiple of 3 so no bits are wasted (a tone encodes 3 bits)
 // Last block can be shorter
@@ -39,8 +35,19 @@ static const uint8_t chirpy_default_block_size = 15;
 // The dedicated control tone. This is the highest tone index.
 static const uint8_t chirpy_control_tone = 8;
 
-// Pre-computed tone periods. This is allocated and populated on-demand.
-static uint32_t *chirpy_tone_periods = NULL;
+// Pre-computed tone periods, 1000000 / freq for tones at 2500 Hz + 250 Hz * index.
+// Computed at compile time so transmission doesn't touch the heap or do divisions.
+static const uint16_t chirpy_tone_periods[] = {
+    1000000 / 2500,
+    1000000 / 2750,
+    1000000 / 3000,
+    1000000 / 3250,
+    1000000 / 3500,
+    1000000 / 3750,
+    1000000 / 4000,
+    1000000 / 4250,
+    1000000 / 4500,
+};
 
 uint8_t chirpy_crc8(const uint8_t *addr, uint16_t len) {
     uint8_t crc = 0;
@@ -162,18 +169,80 @@ uint8_t chirpy_get_next_tone(chirpy_encoder_state_t *ces) {
     return _chirpy_retrieve_next_tone(ces);
 }
 
-uint16_t chirpy_get_tone_period(uint8_t tone) {
-    // Create pre-computed tone periods array on first use
-    if (chirpy_tone_periods == NULL) {
-      chirpy_tone_periods = malloc((chirpy_control_tone + 1) * sizeof(uint32_t));
-      for (uint8_t i = 0; i < chirpy_control_tone + 1; ++i) {
-        uint32_t freq = chirpy_min_freq + i * chirpy_freq_step;
-        uint16_t period = 1000000 / freq;
-        chirpy_tone_periods[i] = period;
-      }
+uint16_t chirpy_get_chunk_count(uint16_t data_len, uint16_t chunk_size) {
+    if (chunk_size == 0) return 0;
+    return (data_len + chunk_size - 1) / chunk_size;
+}
+
+static void _chirpy_begin_chunk(chirpy_chunk_state_t *ccs) {
+    uint32_t offset = (uint32_t)ccs->chunk_index * ccs->chunk_size;
+    uint16_t len = (uint16_t)(ccs->data_len - offset);
+    if (len > ccs->chunk_size) len = ccs->chunk_size;
+    ccs->pos = (uint16_t)offset;
+    ccs->chunk_end = (uint16_t)offset + len;
+    ccs->header[0] = CHIRPY_CHUNK_MARKER;
+    ccs->header[1] = (uint8_t)ccs->chunk_index;
+    ccs->header[2] = (uint8_t)(offset >> 8);
+    ccs->header[3] = (uint8_t)offset;
+    ccs->header[4] = (uint8_t)(len >> 8);
+    ccs->header[5] = (uint8_t)len;
+    ccs->header[6] = chirpy_crc8(ccs->data + offset, len);
+    ccs->header_pos = 0;
+}
+
+void chirpy_init_chunks(chirpy_chunk_state_t *ccs, const uint8_t *data, uint16_t data_len, uint16_t chunk_size, uint16_t first_chunk) {
+    memset(ccs, 0, sizeof(chirpy_chunk_state_t));
+    ccs->data = data;
+    ccs->data_len = data_len;
+    ccs->chunk_size = chunk_size;
+    ccs->chunk_index = first_chunk;
+    if (first_chunk >= chirpy_get_chunk_count(data_len, chunk_size)) {
+        // Nothing to send: mark the state as drained.
+        ccs->pos = ccs->chunk_end = data_len;
+        ccs->header_pos = CHIRPY_CHUNK_HEADER_SIZE;
+        return;
+    }
+    _chirpy_begin_chunk(ccs);
+}
+
+uint8_t chirpy_get_next_chunk_byte(chirpy_chunk_state_t *ccs, uint8_t *next_byte) {
+    if (ccs->header_pos == CHIRPY_CHUNK_HEADER_SIZE && ccs->pos == ccs->chunk_end) {
+        // Chunk finished. Advance lazily, so an abort between two chunks still
+        // reports the not-yet-begun chunk as the place to resume from.
+        if (ccs->chunk_end >= ccs->data_len)
+            return 0;
+        ++ccs->chunk_index;
+        _chirpy_begin_chunk(ccs);
+    }
+    if (ccs->header_pos < CHIRPY_CHUNK_HEADER_SIZE) {
+        *next_byte = ccs->header[ccs->header_pos];
+        ++ccs->header_pos;
+        return 1;
     }
-    // Return pre-computed value, but be paranoid about indexing into array
+    *next_byte = ccs->data[ccs->pos];
+    ++ccs->pos;
+    return 1;
+}
+
+uint16_t chirpy_get_resume_chunk(const chirpy_chunk_state_t *ccs) {
+    // Fully drained: every chunk went out, nothing to resume.
+    if (ccs->header_pos == CHIRPY_CHUNK_HEADER_SIZE && ccs->pos == ccs->chunk_end && ccs->chunk_end >= ccs->data_len)
+        return chirpy_get_chunk_count(ccs->data_len, ccs->chunk_size);
+    return ccs->chunk_index;
+}
+
+uint16_t chirpy_get_tone_period(uint8_t tone) {
+    // Be paranoid about indexing into the array
     if (tone > chirpy_control_tone)
       tone = chirpy_control_tone;
     return chirpy_tone_periods[tone];
 }
+
+uint16_t chirpy_get_tone_duration(chirpy_rate_t rate) {
+    // Durations are in 64 Hz buzzer ticks. The receiver clocks itself from the
+    // tone lengths in the 8-0-8-0 intro, so no extra signaling is needed for it
+    // to follow the faster profile.
+    if (rate == CHIRPY_RATE_FAST)
+        return 1;
+    return 3;
+}
@@ -76,6 +76,79 @@ uint8_t chirpy_get_next_tone(chirpy_encoder_state_t *ces);
  */
 uint16_t chirpy_get_tone_period(uint8_t tone);
 
+/** @brief Modulation rate profiles.
+ * @details Standard chirps at 3 buzzer ticks (~47 ms) per tone, which every receiver
+ *          handles. Fast shortens that to 1 tick (~16 ms), tripling throughput; it wants
+ *          a quiet room and the phone close to the watch. The receiver clocks itself
+ *          from the tone lengths of the intro sequence, so no extra signaling is needed.
+ */
+typedef enum {
+    CHIRPY_RATE_STANDARD = 0,
+    CHIRPY_RATE_FAST,
+} chirpy_rate_t;
+
+/** @brief Returns the per-tone duration, in 64 Hz buzzer ticks, for a rate profile.
+ * @param rate The modulation rate profile.
+ * @return The duration to pass to the buzzer for each tone.
+ */
+uint16_t chirpy_get_tone_duration(chirpy_rate_t rate);
+
+/** @brief Size, in bytes, of the header that precedes every chunk of a chunked transmission.
+ */
+#define CHIRPY_CHUNK_HEADER_SIZE 7
+
+/** @brief Marker byte that opens every chunk header.
+ */
+#define CHIRPY_CHUNK_MARKER 0xC4
+
+// Holds state used by chunked transmissions. Do not manipulate directly.
+typedef struct {
+    const uint8_t *data;
+    uint16_t data_len;
+    uint16_t chunk_size;
+    uint16_t chunk_index;
+    uint16_t pos;
+    uint16_t chunk_end;
+    uint8_t header[CHIRPY_CHUNK_HEADER_SIZE];
+    uint8_t header_pos;
+} chirpy_chunk_state_t;
+
+/** @brief Returns the number of chunks a buffer of data_len bytes splits into.
+ */
+uint16_t chirpy_get_chunk_count(uint16_t data_len, uint16_t chunk_size);
+
+/** @brief Initializes state for a chunked transmission over a caller-owned buffer.
+ * @details A chunked transmission divides the data into chunks of chunk_size bytes (the last
+ *          one may be shorter) and emits each as a seven-byte header followed by the payload.
+ *          The header is: marker 0xC4, chunk index (low byte), big-endian byte offset,
+ *          big-endian payload length, and the CRC of the payload. The offsets and CRCs let a
+ *          receiver verify and place every chunk independently, so when a transfer glitches,
+ *          it can be restarted from the first bad chunk (pass it as first_chunk) instead of
+ *          from the top. Chunk payloads ride inside the normal block framing; the headers
+ *          are just data bytes as far as a receiver's demodulator is concerned.
+ * @param ccs Pointer to chunk state object to be initialized.
+ * @param data The buffer to transmit; caller-owned, must outlive the transmission.
+ * @param data_len Length of the buffer in bytes.
+ * @param chunk_size Payload bytes per chunk. A multiple of the 15-byte block size keeps
+ *        the block CRCs aligned with chunk boundaries.
+ * @param first_chunk Index of the chunk to start from; 0 transmits everything.
+ */
+void chirpy_init_chunks(chirpy_chunk_state_t *ccs, const uint8_t *data, uint16_t data_len, uint16_t chunk_size, uint16_t first_chunk);
+
+/** @brief Returns the next byte of a chunked transmission.
+ * @details Call this from your chirpy_get_next_byte_t implementation.
+ * @param ccs Pointer to the chunk state object.
+ * @param next_byte Pointer where the next byte is written (if available).
+ * @return 1 if there is a next byte, or 0 if no more data to encode.
+ */
+uint8_t chirpy_get_next_chunk_byte(chirpy_chunk_state_t *ccs, uint8_t *next_byte);
+
+/** @brief Returns the chunk to restart from after an interrupted transmission.
+ * @details This is the chunk that was in flight when the transmission stopped; if
+ *          everything was sent it equals the chunk count.
+ */
+uint16_t chirpy_get_resume_chunk(const chirpy_chunk_state_t *ccs);
+
 /** @brief Typedef for a tick handler function.
  */
 typedef void (*chirpy_tick_fun_t)(void *context);
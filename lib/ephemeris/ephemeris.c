@@ -0,0 +1,84 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ephemeris.h"
+#include "sunriset.h"
+
+#define EPHEMERIS_SUN_SLOTS (2)
+
+typedef struct {
+    uint32_t date_key;      // year << 9 | month << 5 | day; 0 means empty
+    int32_t lon_centi;
+    int32_t lat_centi;
+    int16_t rise_minutes;
+    int16_t set_minutes;
+    int8_t result;
+} ephemeris_sun_record_t;
+
+static ephemeris_sun_record_t sun_cache[EPHEMERIS_SUN_SLOTS];
+static uint8_t sun_cache_next_slot;
+
+int ephemeris_sun_rise_set(uint16_t year, uint8_t month, uint8_t day, int32_t lon_centi, int32_t lat_centi,
+                           int16_t *rise_minutes, int16_t *set_minutes) {
+    uint32_t date_key = ((uint32_t)year << 9) | ((uint32_t)month << 5) | day;
+
+    for (int i = 0; i < EPHEMERIS_SUN_SLOTS; i++) {
+        if (sun_cache[i].date_key == date_key &&
+            sun_cache[i].lon_centi == lon_centi &&
+            sun_cache[i].lat_centi == lat_centi) {
+            *rise_minutes = sun_cache[i].rise_minutes;
+            *set_minutes = sun_cache[i].set_minutes;
+            return sun_cache[i].result;
+        }
+    }
+
+    ephemeris_sun_record_t *record = &sun_cache[sun_cache_next_slot];
+    sun_cache_next_slot = (sun_cache_next_slot + 1) % EPHEMERIS_SUN_SLOTS;
+
+    record->result = (int8_t)sun_rise_set_fixed(year, month, day, lon_centi, lat_centi,
+                                                &record->rise_minutes, &record->set_minutes);
+    record->lon_centi = lon_centi;
+    record->lat_centi = lat_centi;
+    record->date_key = date_key;
+
+    *rise_minutes = record->rise_minutes;
+    *set_minutes = record->set_minutes;
+    return record->result;
+}
+
+void ephemeris_prime(uint16_t year, uint8_t month, uint8_t day, int32_t lon_centi, int32_t lat_centi) {
+    int16_t rise_minutes, set_minutes;
+    ephemeris_sun_rise_set(year, month, day, lon_centi, lat_centi, &rise_minutes, &set_minutes);
+}
+
+// Saturday, 6 January 2000 18:14:00 UTC, a new moon, in unix epoch time.
+#define EPHEMERIS_FIRST_MOON (947182440)
+// One synodic month (29.53058770576 days) in hundredths of a second.
+#define EPHEMERIS_LUNAR_CYCLE_CENTISECONDS (255144278ull)
+
+uint16_t ephemeris_moon_age_centidays(uint32_t unix_time) {
+    uint64_t centiseconds = (uint64_t)(unix_time - EPHEMERIS_FIRST_MOON) * 100;
+    // 86400 centiseconds per hundredth of a day.
+    return (uint16_t)((centiseconds % EPHEMERIS_LUNAR_CYCLE_CENTISECONDS) / 86400);
+}
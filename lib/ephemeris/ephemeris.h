@@ -0,0 +1,65 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/** @file ephemeris.h
+ *  @brief Shared daily ephemeris cache for the astronomy faces.
+ *
+ * Sunrise/sunset only changes on a daily scale, but sunrise_sunset_face used
+ * to recompute it on every activation. This module fronts sun_rise_set_fixed
+ * with a small date-and-location-keyed cache, and movement re-primes the cache
+ * at midnight, so on a typical day a face activation is a table lookup and no
+ * astronomy at all. It is also home to the integer moon age computation shared
+ * with moon_phase_face.
+ */
+
+/** @brief Cached sunrise/sunset lookup.
+ *
+ * Same arguments and return convention as sun_rise_set_fixed (longitude and
+ * latitude in hundredths of a degree, rise/set in minutes UT, 0 = rises and
+ * sets, +1 = up all day, -1 = down all day), but answers from the cache when
+ * the date and location match a previous query. Two slots are kept, because
+ * the sunrise/sunset face asks about today and then possibly tomorrow.
+ */
+int ephemeris_sun_rise_set(uint16_t year, uint8_t month, uint8_t day, int32_t lon_centi, int32_t lat_centi,
+                           int16_t *rise_minutes, int16_t *set_minutes);
+
+/** @brief Recompute the sun record for the given date and location.
+ *
+ * Called by movement at midnight (and after a location change) so the cache
+ * is warm before any face activates. Harmless to call redundantly: if the
+ * record is already cached this is a lookup and nothing more.
+ */
+void ephemeris_prime(uint16_t year, uint8_t month, uint8_t day, int32_t lon_centi, int32_t lat_centi);
+
+/** @brief Age of the moon at the given unix time, in hundredths of a day.
+ *
+ * Returns 0..2953 across one synodic month (29.53 days). Pure integer math;
+ * this replaces the fmod-based phase fraction the moon phase face computed
+ * with doubles.
+ */
+uint16_t ephemeris_moon_age_centidays(uint32_t unix_time);
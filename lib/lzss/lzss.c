@@ -0,0 +1,143 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "lzss.h"
+
+// MSB-first bit writer. The accumulator never holds more than 7 + 13 bits
+// (a back-reference token is the largest thing pushed at once), so 32 bits
+// is plenty.
+typedef struct {
+    uint8_t *buf;
+    int32_t cap;
+    int32_t pos;
+    uint32_t acc;
+    uint8_t bits;
+} lzss_writer_t;
+
+static int _lzss_put(lzss_writer_t *w, uint32_t value, uint8_t nbits) {
+    w->acc = (w->acc << nbits) | value;
+    w->bits += nbits;
+    while (w->bits >= 8) {
+        if (w->pos == w->cap) return -1;
+        w->buf[w->pos++] = (uint8_t)(w->acc >> (w->bits - 8));
+        w->bits -= 8;
+    }
+    return 0;
+}
+
+static int _lzss_flush(lzss_writer_t *w) {
+    if (w->bits == 0) return 0;
+    // pad the final partial byte with zeros; the decoder stops at the
+    // recorded output length and never looks at the padding.
+    return _lzss_put(w, 0, (uint8_t)(8 - w->bits));
+}
+
+int32_t lzss_compress(const uint8_t *in, int32_t in_len, uint8_t *out, int32_t out_cap) {
+    lzss_writer_t w = { out, out_cap, 0, 0, 0 };
+    int32_t i = 0;
+
+    while (i < in_len) {
+        // brute-force scan of the window for the longest match at i
+        int32_t best_len = 0;
+        int32_t best_dist = 0;
+        int32_t max_dist = (i < LZSS_WINDOW_SIZE) ? i : LZSS_WINDOW_SIZE;
+        int32_t max_len = in_len - i;
+        if (max_len > LZSS_MAX_MATCH) max_len = LZSS_MAX_MATCH;
+
+        for (int32_t dist = 1; dist <= max_dist; dist++) {
+            int32_t len = 0;
+            // the reference may overlap its own output (dist < len), which
+            // this byte-wise compare models exactly as the decoder copies it
+            while (len < max_len && in[i - dist + len] == in[i + len]) len++;
+            if (len > best_len) {
+                best_len = len;
+                best_dist = dist;
+                if (len == max_len) break;
+            }
+        }
+
+        if (best_len >= LZSS_MIN_MATCH) {
+            if (_lzss_put(&w, 0, 1) < 0) return -1;
+            if (_lzss_put(&w, (uint32_t)(best_dist - 1), 8) < 0) return -1;
+            if (_lzss_put(&w, (uint32_t)(best_len - LZSS_MIN_MATCH), 4) < 0) return -1;
+            i += best_len;
+        } else {
+            if (_lzss_put(&w, 1, 1) < 0) return -1;
+            if (_lzss_put(&w, in[i], 8) < 0) return -1;
+            i++;
+        }
+    }
+
+    if (_lzss_flush(&w) < 0) return -1;
+    return w.pos;
+}
+
+// MSB-first bit reader; returns the requested bits, or -1 past end of input.
+typedef struct {
+    const uint8_t *buf;
+    int32_t len;
+    int32_t pos;
+    uint32_t acc;
+    uint8_t bits;
+} lzss_reader_t;
+
+static int32_t _lzss_get(lzss_reader_t *r, uint8_t nbits) {
+    while (r->bits < nbits) {
+        if (r->pos == r->len) return -1;
+        r->acc = (r->acc << 8) | r->buf[r->pos++];
+        r->bits += 8;
+    }
+    int32_t value = (int32_t)((r->acc >> (r->bits - nbits)) & ((1u << nbits) - 1));
+    r->bits -= nbits;
+    return value;
+}
+
+int32_t lzss_decompress(const uint8_t *in, int32_t in_len, uint8_t *out, int32_t out_len) {
+    lzss_reader_t r = { in, in_len, 0, 0, 0 };
+    int32_t o = 0;
+
+    while (o < out_len) {
+        int32_t flag = _lzss_get(&r, 1);
+        if (flag < 0) return -1;
+        if (flag) {
+            int32_t literal = _lzss_get(&r, 8);
+            if (literal < 0) return -1;
+            out[o++] = (uint8_t)literal;
+        } else {
+            int32_t dist = _lzss_get(&r, 8);
+            int32_t len = _lzss_get(&r, 4);
+            if (dist < 0 || len < 0) return -1;
+            dist += 1;
+            len += LZSS_MIN_MATCH;
+            if (dist > o || o + len > out_len) return -1;
+            // byte-wise so overlapping references replicate runs correctly
+            for (int32_t j = 0; j < len; j++) {
+                out[o] = out[o - dist];
+                o++;
+            }
+        }
+    }
+
+    return out_len;
+}
@@ -0,0 +1,74 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LZSS_H_
+#define LZSS_H_
+
+#include <stdint.h>
+
+/*
+ * Tiny LZSS codec for the watch's 8 KB filesystem.
+ *
+ * The encoding is a plain bit stream, most significant bit first. Each token
+ * starts with one flag bit: 1 is followed by an 8-bit literal, 0 by an 8-bit
+ * back-reference distance (stored as distance - 1, so 1..256) and a 4-bit
+ * copy length (stored as length - 3, so 3..18). References may overlap their
+ * own output, which is what makes runs compress well. There is no terminator;
+ * the caller stores the original length out of band and the decoder stops
+ * when it has produced that many bytes.
+ *
+ * The 256-byte window means the decoder needs no state beyond the output
+ * buffer itself, and both directions run in a few dozen bytes of stack. The
+ * compressor does a brute-force window scan, so its cost is paid once at
+ * write time; decompression is a single pass.
+ */
+
+#define LZSS_WINDOW_SIZE 256
+#define LZSS_MIN_MATCH 3
+#define LZSS_MAX_MATCH 18
+
+/** @brief Compresses a buffer.
+  * @param in the bytes to compress
+  * @param in_len the number of bytes to compress
+  * @param out destination for the compressed bit stream
+  * @param out_cap the size of the destination buffer
+  * @return the compressed size in bytes, or -1 if the output did not fit in
+  *         out_cap. Incompressible input grows by one flag bit per byte, so
+  *         callers that only want a win can pass an out_cap just under in_len
+  *         and treat -1 as "store it uncompressed."
+  */
+int32_t lzss_compress(const uint8_t *in, int32_t in_len, uint8_t *out, int32_t out_cap);
+
+/** @brief Decompresses a buffer produced by lzss_compress.
+  * @param in the compressed bit stream
+  * @param in_len the number of compressed bytes
+  * @param out destination for the decompressed data
+  * @param out_len the original length, as recorded by the caller at compress time
+  * @return out_len on success, or -1 if the stream was truncated or malformed
+  *         (a reference reaching before the start of the output, or a copy
+  *         running past out_len). On -1 the output buffer is partially written.
+  */
+int32_t lzss_decompress(const uint8_t *in, int32_t in_len, uint8_t *out, int32_t out_len);
+
+#endif // LZSS_H_
@@ -18,6 +18,17 @@ Released to the public domain by Paul Schlyter, December 1992
 
 /* Function prototypes */
 
+#include <stdint.h>
+
+/* Fixed-point port (sunriset_fixed.c): Q16.16/Q15 math with table-assisted
+ * trig, accurate to within a minute of the double version. Longitude and
+ * latitude are in hundredths of a degree (the movement_location_t encoding);
+ * rise and set come back as minutes UT, which may fall below 0 or above
+ * 24*60 at longitudes far from the prime meridian. The return code matches
+ * __sunriset__: 0 = rises and sets, +1 = up all day, -1 = down all day. */
+int sun_rise_set_fixed(int year, int month, int day, int32_t lon_centi, int32_t lat_centi,
+                       int16_t *rise_minutes, int16_t *set_minutes);
+
 double __daylen__( int year, int month, int day, double lon, double lat,
                    double altit, int upper_limb );
 
@@ -0,0 +1,228 @@
+/*
+
+SUNRISET_FIXED.C - fixed-point port of Paul Schlyter's SUNRISET.C
+
+The original computes with doubles throughout; on the FPU-less SAM L22 that
+drags several kilobytes of soft-float library into flash and burns tens of
+milliseconds per update. This port runs the same algorithm in Q16.16 degrees
+with Q15 table-assisted trig (129-entry quarter-wave sine, 65-entry arctangent,
+both linearly interpolated), which lands within a minute of the double version
+everywhere the original is itself trustworthy.
+
+Based on SUNRISET.C, (c) Paul Schlyter, 1989, 1992, released to the public
+domain by Paul Schlyter, December 1992.
+
+*/
+
+#include <stdint.h>
+#include "sunriset.h"
+
+/* Angles are Q16.16 degrees; trig values are Q15. */
+#define Q16_DEG(x) ((int32_t)((x) * 65536))
+#define FULL_TURN  Q16_DEG(360)
+#define HALF_TURN  Q16_DEG(180)
+#define QUARTER    Q16_DEG(90)
+
+/* Quarter-wave sine, sin(90 * i / 128) in Q15. */
+static const int16_t sine_table[129] = {
+    0, 402, 804, 1206, 1608, 2009, 2410, 2811,
+    3212, 3612, 4011, 4410, 4808, 5205, 5602, 5998,
+    6393, 6786, 7179, 7571, 7962, 8351, 8739, 9126,
+    9512, 9896, 10278, 10659, 11039, 11417, 11793, 12167,
+    12539, 12910, 13279, 13645, 14010, 14372, 14732, 15090,
+    15446, 15800, 16151, 16499, 16846, 17189, 17530, 17869,
+    18204, 18537, 18868, 19195, 19519, 19841, 20159, 20475,
+    20787, 21096, 21403, 21705, 22005, 22301, 22594, 22884,
+    23170, 23452, 23731, 24007, 24279, 24547, 24811, 25072,
+    25329, 25582, 25832, 26077, 26319, 26556, 26790, 27019,
+    27245, 27466, 27683, 27896, 28105, 28310, 28510, 28706,
+    28898, 29085, 29268, 29447, 29621, 29791, 29956, 30117,
+    30273, 30424, 30571, 30714, 30852, 30985, 31113, 31237,
+    31356, 31470, 31580, 31685, 31785, 31880, 31971, 32057,
+    32137, 32213, 32285, 32351, 32412, 32469, 32521, 32567,
+    32609, 32646, 32678, 32705, 32728, 32745, 32757, 32765,
+    32767,
+};
+
+/* atan(i / 64) in Q16.16 degrees. */
+static const int32_t atan_table[65] = {
+    0, 58666, 117304, 175884, 234379, 292760,
+    350999, 409070, 466945, 524598, 582003, 639135,
+    695970, 752484, 808654, 864460, 919879, 974893,
+    1029481, 1083627, 1137313, 1190524, 1243245, 1295461,
+    1347161, 1398332, 1448965, 1499049, 1548575, 1597536,
+    1645926, 1693738, 1740967, 1787610, 1833663, 1879123,
+    1923990, 1968261, 2011937, 2055018, 2097505, 2139399,
+    2180703, 2221419, 2261551, 2301101, 2340074, 2378474,
+    2416306, 2453574, 2490285, 2526443, 2562055, 2597126,
+    2631664, 2665673, 2699161, 2732134, 2764600, 2796564,
+    2828035, 2859019, 2889523, 2919554, 2949120,
+};
+
+/* Reduce a Q16.16 angle to 0 <= x < 360 degrees. */
+static int32_t rev360_q16(int32_t x) {
+    x %= FULL_TURN;
+    if (x < 0) x += FULL_TURN;
+    return x;
+}
+
+/* Reduce a Q16.16 angle to -180 < x <= 180 degrees. */
+static int32_t rev180_q16(int32_t x) {
+    return rev360_q16(x + HALF_TURN) - HALF_TURN;
+}
+
+/* Q15 sine of a Q16.16 angle in degrees, by quadrant fold and interpolation. */
+static int32_t sin_q15(int32_t angle) {
+    int32_t x = rev360_q16(angle);
+    int quadrant = x / QUARTER;
+    int32_t q = x % QUARTER;
+
+    /* map the in-quadrant position onto the table: 90 degrees = 32768 steps */
+    int32_t u = q / 180;  /* QUARTER / 32768 == 180 exactly */
+    if (quadrant & 1) u = 32768 - u;
+    int32_t idx = u >> 8;
+    int32_t frac = u & 0xFF;
+    int32_t value = sine_table[idx] + (((sine_table[idx + 1] - sine_table[idx]) * frac) >> 8);
+
+    return (quadrant & 2) ? -value : value;
+}
+
+static int32_t cos_q15(int32_t angle) {
+    return sin_q15(angle + QUARTER);
+}
+
+/* Integer square root of a 64-bit value. */
+static uint32_t isqrt64(uint64_t x) {
+    uint64_t result = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    while (bit > x) bit >>= 2;
+    while (bit) {
+        if (x >= result + bit) {
+            x -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)result;
+}
+
+/* Q16.16 degrees arctangent of y/x over all four quadrants, -180 < result <= 180. */
+static int32_t atan2_q16(int32_t y, int32_t x) {
+    if (x == 0 && y == 0) return 0;
+
+    uint32_t ay = (y < 0) ? (uint32_t)-y : (uint32_t)y;
+    uint32_t ax = (x < 0) ? (uint32_t)-x : (uint32_t)x;
+
+    /* atan of the smaller-over-larger ratio, folded into the first octant */
+    uint32_t num = (ay < ax) ? ay : ax;
+    uint32_t den = (ay < ax) ? ax : ay;
+    uint32_t z = (uint32_t)(((uint64_t)num << 15) / den);  /* 0..32768, Q15 */
+    int32_t idx = z >> 9;
+    int32_t frac = z & 0x1FF;
+    int32_t a = atan_table[idx] + (int32_t)(((int64_t)(atan_table[idx + 1] - atan_table[idx]) * frac) >> 9);
+    if (ay >= ax) a = QUARTER - a;
+
+    if (x < 0) a = HALF_TURN - a;
+    return (y < 0) ? -a : a;
+}
+
+/* acos of a Q15 value, in Q16.16 degrees (0..180). */
+static int32_t acos_q16(int32_t c_q15) {
+    if (c_q15 >= 32767) return 0;
+    if (c_q15 <= -32767) return HALF_TURN;
+    int32_t s_q15 = (int32_t)isqrt64(((int64_t)32768 * 32768) - (int64_t)c_q15 * c_q15);
+    return atan2_q16(s_q15, c_q15);
+}
+
+/* days_since_2000_Jan_0, same expression as the double version */
+static int32_t days_since_2000(int year, int month, int day) {
+    return 367L * year - ((7 * (year + ((month + 9) / 12))) / 4) + ((275 * month) / 9) + day - 730530L;
+}
+
+/* Sun's ecliptic longitude (Q16.16 degrees) and distance (Q15 AU) at d days
+ * (Q16.16) since 2000 Jan 0.0. Mirrors sunpos() in the double version; the
+ * tiny secular drift of the eccentricity (1.151e-9 per day) is dropped, as it
+ * would take three centuries to move the result by a hundredth of a degree. */
+static void sunpos_fixed(int32_t d_q16, int32_t *slon, int32_t *r_q15) {
+    /* mean anomaly: 356.0470 + 0.9856002585 * d */
+    int32_t M = rev360_q16(23333896 + (int32_t)(((int64_t)d_q16 * 4233120877u) >> 32));
+    /* longitude of perihelion: 282.9404 + 4.70935e-5 * d */
+    int32_t w = 18542782 + (int32_t)(((int64_t)d_q16 * 13255641816ll) >> 48);
+
+    int32_t sinM = sin_q15(M);
+    int32_t cosM = cos_q15(M);
+
+    /* eccentric anomaly: E = M + e * RADEG * sin(M) * (1 + e * cos(M)) */
+    int32_t factor_q15 = 32768 + ((548 * cosM) >> 15);
+    int32_t E = M + (int32_t)((((int64_t)62741 * sinM >> 15) * factor_q15) >> 15);
+
+    /* rectangular coordinates in the orbital plane */
+    int32_t x = cos_q15(E) - 548;
+    int32_t y = (int32_t)(((int64_t)32763 * sin_q15(E)) >> 15);
+
+    *r_q15 = (int32_t)isqrt64((int64_t)x * x + (int64_t)y * y);
+    *slon = rev360_q16(atan2_q16(y, x) + w);  /* true anomaly + perihelion */
+}
+
+int sun_rise_set_fixed(int year, int month, int day, int32_t lon_centi, int32_t lat_centi,
+                       int16_t *rise_minutes, int16_t *set_minutes) {
+    /* centidegrees to Q16.16 degrees */
+    int32_t lon = (int32_t)(((int64_t)lon_centi << 16) / 100);
+    int32_t lat = (int32_t)(((int64_t)lat_centi << 16) / 100);
+
+    /* d of 12h local mean solar time, Q16.16 days since 2000 Jan 0.0 */
+    int32_t d = ((int32_t)days_since_2000(year, month, day) << 16) + 32768 - lon / 360;
+
+    /* local sidereal time: GMST0 + 180 + lon, with
+     * GMST0 = 818.9874 + 0.9856473585 * d */
+    int32_t sidtime = rev360_q16(rev360_q16(53673158 + (int32_t)(((int64_t)d * 4233323142u) >> 32)) + HALF_TURN + lon);
+
+    /* Sun's position */
+    int32_t slon, r_q15;
+    sunpos_fixed(d, &slon, &r_q15);
+
+    /* equatorial coordinates: rotate the ecliptic position by the obliquity
+     * 23.4393 - 3.563e-7 * d */
+    int32_t obl = 1536118 - (int32_t)(((int64_t)d * 100289534ll) >> 48);
+    int32_t xe = (int32_t)(((int64_t)r_q15 * cos_q15(slon)) >> 15);
+    int32_t ye = (int32_t)(((int64_t)r_q15 * sin_q15(slon)) >> 15);
+    int32_t ze = (int32_t)(((int64_t)ye * sin_q15(obl)) >> 15);
+    ye = (int32_t)(((int64_t)ye * cos_q15(obl)) >> 15);
+
+    int32_t RA = atan2_q16(ye, xe);
+    int32_t dec = atan2_q16(ze, (int32_t)isqrt64((int64_t)xe * xe + (int64_t)ye * ye));
+
+    /* time the Sun crosses the local meridian, Q16.16 hours UT */
+    int32_t tsouth = Q16_DEG(12) - rev180_q16(sidtime - RA) / 15;
+
+    /* reference altitude: -35 arcminutes, corrected to the upper limb by the
+     * Sun's apparent radius 0.2666 / r degrees */
+    int32_t altit = -38229 - (int32_t)(((int64_t)17472 << 15) / r_q15);
+
+    /* diurnal arc: cos(t) = (sin(altit) - sin(lat) sin(dec)) / (cos(lat) cos(dec)) */
+    int32_t numerator = sin_q15(altit) - (int32_t)(((int64_t)sin_q15(lat) * sin_q15(dec)) >> 15);
+    int32_t denominator = (int32_t)(((int64_t)cos_q15(lat) * cos_q15(dec)) >> 15);
+
+    int rc = 0;
+    int32_t t;  /* Q16.16 hours */
+    int32_t cost = (denominator == 0) ? ((numerator >= 0) ? 32768 : -32768)
+                                      : (int32_t)(((int64_t)numerator << 15) / denominator);
+    if (cost >= 32768) {
+        rc = -1;  /* sun always below the altitude */
+        t = 0;
+    } else if (cost <= -32768) {
+        rc = +1;  /* sun always above the altitude */
+        t = Q16_DEG(12);
+    } else {
+        t = acos_q16(cost) / 15;
+    }
+
+    /* rise and set in minutes UT, rounded to the nearest minute. These can go
+     * below 0 or above 24*60: the day boundary is local to the longitude. */
+    *rise_minutes = (int16_t)(((int64_t)(tsouth - t) * 60 + 32768) >> 16);
+    *set_minutes = (int16_t)(((int64_t)(tsouth + t) * 60 + 32768) >> 16);
+
+    return rc;
+}
@@ -0,0 +1,251 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Term tables derived from VSOP87-Multilang by Greg Miller
+ * (gmiller@gregmiller.net), released as public domain.
+ */
+
+#include "vsop87_fixed.h"
+#include "vsop87_fixed_data.h"
+
+// J2000.0 epoch (2000-01-01 12:00 UT) in unix time.
+#define VSOP87_J2000_UNIX (946728000)
+
+/* sin and cos at 256 points around the turn, Q30. The fine remainder of the
+ * angle (under 1.5 degrees) is folded in with the angle-addition formula and a
+ * cubic small-angle approximation, which keeps the trig error near 1e-8; the
+ * Q15 quarter-wave table sunriset_fixed uses was the accuracy floor here at
+ * Mars oppositions, where geocentric geometry amplifies coordinate error. */
+static const int32_t sin_coarse_q30[256] = {
+    0, 26350943, 52686014, 78989349, 105245103, 131437462, 157550647, 183568930,
+    209476638, 235258165, 260897982, 286380643, 311690799, 336813204, 361732726, 386434353,
+    410903207, 435124548, 459083786, 482766489, 506158392, 529245404, 552013618, 574449320,
+    596538995, 618269338, 639627258, 660599890, 681174602, 701339000, 721080937, 740388522,
+    759250125, 777654384, 795590213, 813046808, 830013654, 846480531, 862437520, 877875009,
+    892783698, 907154608, 920979082, 934248793, 946955747, 959092290, 970651112, 981625251,
+    992008094, 1001793390, 1010975242, 1019548121, 1027506862, 1034846671, 1041563127, 1047652185,
+    1053110176, 1057933813, 1062120190, 1065666786, 1068571464, 1070832474, 1072448455, 1073418433,
+    1073741824, 1073418433, 1072448455, 1070832474, 1068571464, 1065666786, 1062120190, 1057933813,
+    1053110176, 1047652185, 1041563127, 1034846671, 1027506862, 1019548121, 1010975242, 1001793390,
+    992008094, 981625251, 970651112, 959092290, 946955747, 934248793, 920979082, 907154608,
+    892783698, 877875009, 862437520, 846480531, 830013654, 813046808, 795590213, 777654384,
+    759250125, 740388522, 721080937, 701339000, 681174602, 660599890, 639627258, 618269338,
+    596538995, 574449320, 552013618, 529245404, 506158392, 482766489, 459083786, 435124548,
+    410903207, 386434353, 361732726, 336813204, 311690799, 286380643, 260897982, 235258165,
+    209476638, 183568930, 157550647, 131437462, 105245103, 78989349, 52686014, 26350943,
+    0, -26350943, -52686014, -78989349, -105245103, -131437462, -157550647, -183568930,
+    -209476638, -235258165, -260897982, -286380643, -311690799, -336813204, -361732726, -386434353,
+    -410903207, -435124548, -459083786, -482766489, -506158392, -529245404, -552013618, -574449320,
+    -596538995, -618269338, -639627258, -660599890, -681174602, -701339000, -721080937, -740388522,
+    -759250125, -777654384, -795590213, -813046808, -830013654, -846480531, -862437520, -877875009,
+    -892783698, -907154608, -920979082, -934248793, -946955747, -959092290, -970651112, -981625251,
+    -992008094, -1001793390, -1010975242, -1019548121, -1027506862, -1034846671, -1041563127, -1047652185,
+    -1053110176, -1057933813, -1062120190, -1065666786, -1068571464, -1070832474, -1072448455, -1073418433,
+    -1073741824, -1073418433, -1072448455, -1070832474, -1068571464, -1065666786, -1062120190, -1057933813,
+    -1053110176, -1047652185, -1041563127, -1034846671, -1027506862, -1019548121, -1010975242, -1001793390,
+    -992008094, -981625251, -970651112, -959092290, -946955747, -934248793, -920979082, -907154608,
+    -892783698, -877875009, -862437520, -846480531, -830013654, -813046808, -795590213, -777654384,
+    -759250125, -740388522, -721080937, -701339000, -681174602, -660599890, -639627258, -618269338,
+    -596538995, -574449320, -552013618, -529245404, -506158392, -482766489, -459083786, -435124548,
+    -410903207, -386434353, -361732726, -336813204, -311690799, -286380643, -260897982, -235258165,
+    -209476638, -183568930, -157550647, -131437462, -105245103, -78989349, -52686014, -26350943,
+};
+
+static const int32_t cos_coarse_q30[256] = {
+    1073741824, 1073418433, 1072448455, 1070832474, 1068571464, 1065666786, 1062120190, 1057933813,
+    1053110176, 1047652185, 1041563127, 1034846671, 1027506862, 1019548121, 1010975242, 1001793390,
+    992008094, 981625251, 970651112, 959092290, 946955747, 934248793, 920979082, 907154608,
+    892783698, 877875009, 862437520, 846480531, 830013654, 813046808, 795590213, 777654384,
+    759250125, 740388522, 721080937, 701339000, 681174602, 660599890, 639627258, 618269338,
+    596538995, 574449320, 552013618, 529245404, 506158392, 482766489, 459083786, 435124548,
+    410903207, 386434353, 361732726, 336813204, 311690799, 286380643, 260897982, 235258165,
+    209476638, 183568930, 157550647, 131437462, 105245103, 78989349, 52686014, 26350943,
+    0, -26350943, -52686014, -78989349, -105245103, -131437462, -157550647, -183568930,
+    -209476638, -235258165, -260897982, -286380643, -311690799, -336813204, -361732726, -386434353,
+    -410903207, -435124548, -459083786, -482766489, -506158392, -529245404, -552013618, -574449320,
+    -596538995, -618269338, -639627258, -660599890, -681174602, -701339000, -721080937, -740388522,
+    -759250125, -777654384, -795590213, -813046808, -830013654, -846480531, -862437520, -877875009,
+    -892783698, -907154608, -920979082, -934248793, -946955747, -959092290, -970651112, -981625251,
+    -992008094, -1001793390, -1010975242, -1019548121, -1027506862, -1034846671, -1041563127, -1047652185,
+    -1053110176, -1057933813, -1062120190, -1065666786, -1068571464, -1070832474, -1072448455, -1073418433,
+    -1073741824, -1073418433, -1072448455, -1070832474, -1068571464, -1065666786, -1062120190, -1057933813,
+    -1053110176, -1047652185, -1041563127, -1034846671, -1027506862, -1019548121, -1010975242, -1001793390,
+    -992008094, -981625251, -970651112, -959092290, -946955747, -934248793, -920979082, -907154608,
+    -892783698, -877875009, -862437520, -846480531, -830013654, -813046808, -795590213, -777654384,
+    -759250125, -740388522, -721080937, -701339000, -681174602, -660599890, -639627258, -618269338,
+    -596538995, -574449320, -552013618, -529245404, -506158392, -482766489, -459083786, -435124548,
+    -410903207, -386434353, -361732726, -336813204, -311690799, -286380643, -260897982, -235258165,
+    -209476638, -183568930, -157550647, -131437462, -105245103, -78989349, -52686014, -26350943,
+    0, 26350943, 52686014, 78989349, 105245103, 131437462, 157550647, 183568930,
+    209476638, 235258165, 260897982, 286380643, 311690799, 336813204, 361732726, 386434353,
+    410903207, 435124548, 459083786, 482766489, 506158392, 529245404, 552013618, 574449320,
+    596538995, 618269338, 639627258, 660599890, 681174602, 701339000, 721080937, 740388522,
+    759250125, 777654384, 795590213, 813046808, 830013654, 846480531, 862437520, 877875009,
+    892783698, 907154608, 920979082, 934248793, 946955747, 959092290, 970651112, 981625251,
+    992008094, 1001793390, 1010975242, 1019548121, 1027506862, 1034846671, 1041563127, 1047652185,
+    1053110176, 1057933813, 1062120190, 1065666786, 1068571464, 1070832474, 1072448455, 1073418433,
+};
+
+/* Q30 cosine of an angle expressed as a binary fraction of a turn. */
+static int32_t cos_q30_turn(uint32_t angle) {
+    uint32_t idx = angle >> 24;
+    uint32_t fine = angle & 0xFFFFFF;
+    /* fine remainder in radians, Q30: fine * 2*pi / 2^32 */
+    int32_t b = (int32_t)(((uint64_t)fine * 26353589) >> 24);
+    int64_t b2_q30 = ((int64_t)b * b) >> 30;
+    int32_t sin_b = b - (int32_t)(((b2_q30 * b) / 6) >> 30);
+    int32_t cos_b = (1 << 30) - (int32_t)(b2_q30 >> 1);
+    /* cos(A + b) = cosA cosb - sinA sinb */
+    return (int32_t)((((int64_t)cos_coarse_q30[idx] * cos_b) - ((int64_t)sin_coarse_q30[idx] * sin_b)) >> 30);
+}
+
+/* Integer square root of a 64-bit value. */
+static uint32_t isqrt64(uint64_t x) {
+    uint64_t result = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    while (bit > x) bit >>= 2;
+    while (bit) {
+        if (x >= result + bit) {
+            x -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)result;
+}
+
+/* atan(i / 64) in Q16.16 degrees; same table as sunriset_fixed. */
+static const int32_t atan_table[65] = {
+    0, 58666, 117304, 175884, 234379, 292760,
+    350999, 409070, 466945, 524598, 582003, 639135,
+    695970, 752484, 808654, 864460, 919879, 974893,
+    1029481, 1083627, 1137313, 1190524, 1243245, 1295461,
+    1347161, 1398332, 1448965, 1499049, 1548575, 1597536,
+    1645926, 1693738, 1740967, 1787610, 1833663, 1879123,
+    1923990, 1968261, 2011937, 2055018, 2097505, 2139399,
+    2180703, 2221419, 2261551, 2301101, 2340074, 2378474,
+    2416306, 2453574, 2490285, 2526443, 2562055, 2597126,
+    2631664, 2665673, 2699161, 2732134, 2764600, 2796564,
+    2828035, 2859019, 2889523, 2919554, 2949120,
+};
+
+/* Q16.16 degrees arctangent of y/x over all four quadrants, -180 < result <= 180. */
+static int32_t atan2_q16(int32_t y, int32_t x) {
+    if (x == 0 && y == 0) return 0;
+
+    uint32_t ay = (y < 0) ? (uint32_t)-y : (uint32_t)y;
+    uint32_t ax = (x < 0) ? (uint32_t)-x : (uint32_t)x;
+
+    /* atan of the smaller-over-larger ratio, folded into the first octant */
+    uint32_t num = (ay < ax) ? ay : ax;
+    uint32_t den = (ay < ax) ? ax : ay;
+    // Q16 ratio: sunriset_fixed uses Q12 here, but that quantizes the angle by
+    // nearly an arcminute, which is this module's entire error budget.
+    uint32_t ratio = (uint32_t)(((uint64_t)num << 16) / den);    // 0..65536 as Q16
+    uint32_t idx = ratio >> 10;
+    uint32_t frac = ratio & 0x3FF;
+    int32_t angle = atan_table[idx] + (int32_t)((((int64_t)(atan_table[idx + 1] - atan_table[idx])) * frac) >> 10);
+
+    if (ay > ax) angle = (90 << 16) - angle;
+    if (x < 0) angle = (180 << 16) - angle;
+    if (y < 0) angle = -angle;
+    return angle;
+}
+
+int32_t vsop87_fixed_days_since_j2000(uint32_t unix_time) {
+    int32_t seconds = (int32_t)(unix_time - VSOP87_J2000_UNIX);
+    // round to the nearest noon rather than truncating toward the epoch
+    if (seconds >= 0) return (seconds + 43200) / 86400;
+    return -(((-seconds) + 43200) / 86400);
+}
+
+/* Sum one cosine series: Q6.25 amplitudes against Q30 cosines. */
+static int64_t _sum_terms(const vsop87_fixed_term_t *terms, uint8_t count, int32_t days) {
+    int64_t sum = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        // uint32 wraparound is exactly the angle wrapping at one turn
+        uint32_t angle = terms[i].phase + (uint32_t)((int64_t)terms[i].freq * days);
+        sum += (int64_t)terms[i].amp * cos_q30_turn(angle);
+    }
+    return sum;    // Q55
+}
+
+void vsop87_fixed_heliocentric(vsop87_fixed_body_t body, int32_t days, int32_t xyz_q25[3]) {
+    const vsop87_fixed_body_series_t *series = &_vsop87_bodies[body];
+    const vsop87_fixed_term_t *terms = series->terms;
+
+    // time in Julian millennia from J2000 as Q30; |days| < 2^21 keeps this exact enough
+    int32_t t_q30 = (int32_t)(((int64_t)days << 30) / 365250);
+
+    for (int coord = 0; coord < 3; coord++) {
+        // Horner's scheme over the powers of t, highest first
+        int64_t result_q55 = 0;
+        const vsop87_fixed_term_t *power_terms[VSOP87_FIXED_MAX_POWER + 1];
+        for (int power = 0; power <= VSOP87_FIXED_MAX_POWER; power++) {
+            power_terms[power] = terms;
+            terms += series->counts[coord][power];
+        }
+        for (int power = VSOP87_FIXED_MAX_POWER; power >= 0; power--) {
+            result_q55 = ((result_q55 >> 25) * t_q30) >> 5;    // * t, keeping Q55
+            result_q55 += _sum_terms(power_terms[power], series->counts[coord][power], days);
+        }
+        xyz_q25[coord] = (int32_t)(result_q55 >> 30);
+    }
+}
+
+void vsop87_fixed_geocentric(vsop87_fixed_body_t body, int32_t days,
+                             int32_t *lon_centideg, int32_t *lat_centideg, uint32_t *dist_milli_au) {
+    int32_t earth[3];
+    int32_t geo[3];
+    vsop87_fixed_heliocentric(VSOP87_FIXED_EARTH, days, earth);
+
+    if (body == VSOP87_FIXED_SUN) {
+        for (int i = 0; i < 3; i++) geo[i] = -earth[i];
+    } else {
+        vsop87_fixed_heliocentric(body, days, geo);
+        for (int i = 0; i < 3; i++) geo[i] -= earth[i];
+    }
+
+    // drop to Q20 before squaring so x^2 + y^2 + z^2 stays well inside 64 bits
+    int32_t x = geo[0] >> 5, y = geo[1] >> 5, z = geo[2] >> 5;
+
+    if (lon_centideg) {
+        int32_t lon_q16 = atan2_q16(y, x);
+        int32_t centi = (int32_t)(((int64_t)lon_q16 * 100 + 32768) >> 16);
+        if (centi < 0) centi += 36000;
+        if (centi >= 36000) centi -= 36000;
+        *lon_centideg = centi;
+    }
+    if (lat_centideg || dist_milli_au) {
+        uint32_t rho = isqrt64((int64_t)x * x + (int64_t)y * y);    // Q20
+        if (lat_centideg) {
+            *lat_centideg = (int32_t)(((int64_t)atan2_q16(z, (int32_t)rho) * 100 + 32768) >> 16);
+        }
+        if (dist_milli_au) {
+            uint32_t r = isqrt64((int64_t)rho * rho + (int64_t)z * z); // Q20
+            *dist_milli_au = (uint32_t)(((uint64_t)r * 1000) >> 20);
+        }
+    }
+}
@@ -0,0 +1,74 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/** @file vsop87_fixed.h
+ *  @brief Fixed-point VSOP87A planetary positions.
+ *
+ * The legacy tree carried Greg Miller's VSOP87-Multilang tables in double
+ * precision, which is a non-starter on the FPU-less SAM L22. This is the same
+ * theory evaluated entirely in integers: term tables generated by
+ * utils/vsop87_fixed_gen.py (truncated at build time to stay within an
+ * arcminute of the double original over 1900-2100), angles as binary turn
+ * fractions so reduction is free uint32 wraparound, and the Q15 table trig
+ * this tree already uses for sunrise/sunset. A full geocentric position costs
+ * a few hundred 32x32 multiplies — microseconds, not the tens of milliseconds
+ * the soft-float version took, so it is compatible with low energy mode.
+ */
+
+typedef enum {
+    VSOP87_FIXED_MERCURY = 0,
+    VSOP87_FIXED_VENUS,
+    VSOP87_FIXED_EARTH,
+    VSOP87_FIXED_MARS,
+    VSOP87_FIXED_JUPITER,
+    VSOP87_FIXED_SATURN,
+    VSOP87_FIXED_URANUS,
+    VSOP87_FIXED_NEPTUNE,
+    VSOP87_FIXED_BODY_COUNT,
+    /** Geocentric only: the apparent position of the sun (minus Earth's heliocentric position). */
+    VSOP87_FIXED_SUN = VSOP87_FIXED_BODY_COUNT,
+} vsop87_fixed_body_t;
+
+/** @brief Whole days from J2000.0 (2000-01-01 12:00 UT) for a unix timestamp; negative before. */
+int32_t vsop87_fixed_days_since_j2000(uint32_t unix_time);
+
+/** @brief Heliocentric rectangular ecliptic coordinates of a body, in AU as Q6.25.
+ * @param body One of the planets (not VSOP87_FIXED_SUN, whose heliocentric position is the origin).
+ * @param days Whole days from J2000.0; accurate over roughly 1900-2100.
+ */
+void vsop87_fixed_heliocentric(vsop87_fixed_body_t body, int32_t days, int32_t xyz_q25[3]);
+
+/** @brief Geocentric ecliptic longitude, latitude and distance of a body or the sun.
+ * @param lon_centideg Ecliptic longitude of date-less J2000 frame, 0..35999 hundredths of a degree.
+ * @param lat_centideg Ecliptic latitude, -9000..9000 hundredths of a degree.
+ * @param dist_milli_au Distance in thousandths of an AU.
+ *
+ * Any output pointer may be NULL if the caller doesn't need that component.
+ */
+void vsop87_fixed_geocentric(vsop87_fixed_body_t body, int32_t days,
+                             int32_t *lon_centideg, int32_t *lat_centideg, uint32_t *dist_milli_au);
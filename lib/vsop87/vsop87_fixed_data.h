@@ -0,0 +1,939 @@
+// Generated by utils/vsop87_fixed_gen.py from legacy/lib/vsop87/vsop87a_milli.c.
+// Do not edit by hand; see that script for the encoding and truncation rules.
+
+#pragma once
+
+#include <stdint.h>
+
+typedef struct {
+    int32_t amp;     // AU, Q6.25
+    uint32_t phase;  // turns, 2^-32
+    uint32_t freq;   // turns per day, 2^-32
+} vsop87_fixed_term_t;
+
+#define VSOP87_FIXED_MAX_POWER (4)
+
+typedef struct {
+    const vsop87_fixed_term_t *terms;   // x powers 0..n, then y, then z
+    uint8_t counts[3][VSOP87_FIXED_MAX_POWER + 1];
+} vsop87_fixed_body_series_t;
+
+static const vsop87_fixed_term_t _vsop87_mercury_terms[32] = {
+    { 12598445, 3005305035u, 48823504u },
+    { 1283708, 796255142u, 97647007u },
+    { 881011, 2147483648u, 0u },
+    { 196046, 2881907065u, 146470511u },
+    { 35473, 672484909u, 195294015u },
+    { 7050, 2757976401u, 244117518u },
+    { 1488, 548470045u, 292941022u },
+    { 106988, 0u, 0u },
+    { 35329, 4043975417u, 97647007u },
+    { 10843, 1833645213u, 146470511u },
+    { 4024, 3975445524u, 48823504u },
+    { 2947, 3918782299u, 195294015u },
+    { 12735129, 1939825762u, 48823504u },
+    { 3901082, 2147483648u, 0u },
+    { 1293412, 4024699792u, 97647007u },
+    { 197203, 1814858261u, 146470511u },
+    { 35647, 3900085896u, 195294015u },
+    { 7080, 1690397565u, 244117518u },
+    { 1493, 3775706343u, 292941022u },
+    { 36173, 2973268292u, 97647007u },
+    { 27062, 2147483648u, 0u },
+    { 10977, 763978079u, 146470511u },
+    { 3998, 834906534u, 48823504u },
+    { 2972, 2849458270u, 195294015u },
+    { 1546076, 1362311976u, 48823504u },
+    { 237812, 2147483648u, 0u },
+    { 157428, 3446643732u, 97647007u },
+    { 24034, 1236530320u, 146470511u },
+    { 4348, 3321594277u, 195294015u },
+    { 864, 1111796579u, 244117518u },
+    { 36481, 2673661337u, 48823504u },
+    { 19403, 2147483648u, 0u },
+};
+
+static const vsop87_fixed_term_t _vsop87_venus_terms[22] = {
+    { 24230085, 2170838141u, 19114161u },
+    { 163225, 0u, 0u },
+    { 82041, 2772312542u, 38228322u },
+    { 940, 226584748u, 4403388u },
+    { 654, 2892821018u, 2951998u },
+    { 417, 3373899018u, 57342483u },
+    { 390, 1968382579u, 33824934u },
+    { 11362, 2147483648u, 0u },
+    { 5783, 633809411u, 38228322u },
+    { 24268183, 1097626796u, 19114161u },
+    { 184384, 2147483648u, 0u },
+    { 82170, 1699103713u, 38228322u },
+    { 936, 3446635398u, 4403388u },
+    { 649, 3968766252u, 2951998u },
+    { 417, 2300700922u, 57342483u },
+    { 391, 895269681u, 33824934u },
+    { 13164, 0u, 0u },
+    { 5799, 3854110110u, 38228322u },
+    { 1437133, 182538290u, 19114161u },
+    { 11941, 2147483648u, 0u },
+    { 4866, 784028258u, 38228322u },
+    { 69826, 1291714700u, 19114161u },
+};
+
+static const vsop87_fixed_term_t _vsop87_earth_terms[23] = {
+    { 33548704, 1198621925u, 11758775u },
+    { 280266, 1169132721u, 23517549u },
+    { 188289, 0u, 0u },
+    { 3512, 1139658109u, 35276324u },
+    { 1044, 457135544u, 157200077u },
+    { 856, 398588329u, 991316u },
+    { 717, 746693825u, 2951998u },
+    { 573, 338639765u, 11752181u },
+    { 573, 4206083418u, 11765368u },
+    { 41407, 0u, 0u },
+    { 17281, 4103211764u, 23517549u },
+    { 33550812, 124859284u, 11758775u },
+    { 819634, 2147483648u, 0u },
+    { 280278, 95377036u, 23517549u },
+    { 3512, 65907249u, 35276324u },
+    { 1044, 3678361072u, 157200077u },
+    { 862, 3623606686u, 991316u },
+    { 721, 1820016737u, 2951998u },
+    { 574, 3559873984u, 11752181u },
+    { 573, 3132320704u, 11765368u },
+    { 31221, 0u, 0u },
+    { 17283, 3029428001u, 23517549u },
+    { 76445, 2333503900u, 11758775u },
+};
+
+static const vsop87_fixed_term_t _vsop87_mars_terms[83] = {
+    { 50925540, 4240861846u, 6251955u },
+    { 6544103, 2147483648u, 0u },
+    { 2372607, 176840651u, 12503910u },
+    { 165825, 407877438u, 18755866u },
+    { 13737, 638951071u, 25007821u },
+    { 7069, 1233395490u, 6245362u },
+    { 7060, 805893516u, 6258549u },
+    { 4539, 430719711u, 991316u },
+    { 3815, 3303433172u, 1982633u },
+    { 2760, 1277197419u, 4269322u },
+    { 2273, 2473036962u, 6251923u },
+    { 2273, 3861201932u, 6251988u },
+    { 1835, 774646445u, 5506819u },
+    { 1770, 1593719337u, 11512594u },
+    { 1657, 3029844575u, 10521278u },
+    { 1616, 1265218115u, 6997091u },
+    { 1251, 829836786u, 745136u },
+    { 1250, 870043133u, 31259776u },
+    { 1220, 4179301635u, 1490272u },
+    { 805, 434430847u, 5893660u },
+    { 795, 2029108120u, 4761684u },
+    { 763, 1611220288u, 6610251u },
+    { 752, 3296279280u, 16773233u },
+    { 748, 1159251259u, 6251829u },
+    { 748, 880017314u, 6252081u },
+    { 732, 1159703440u, 11758775u },
+    { 664, 1463430039u, 12497317u },
+    { 657, 1038435075u, 12510504u },
+    { 563, 2149420508u, 11013639u },
+    { 547, 164862101u, 7742227u },
+    { 528, 3313992278u, 2973949u },
+    { 493, 1284212241u, 7243272u },
+    { 463, 1490253645u, 3278006u },
+    { 433, 298009341u, 5260639u },
+    { 289052, 2147483648u, 0u },
+    { 185367, 3483215363u, 12503910u },
+    { 25899, 3713917026u, 18755866u },
+    { 6868, 3807812756u, 6251955u },
+    { 50854754, 3166357796u, 6251955u },
+    { 2904298, 0u, 0u },
+    { 2370470, 3397674141u, 12503910u },
+    { 165716, 3628896342u, 18755866u },
+    { 13730, 3860081242u, 25007821u },
+    { 7059, 158862422u, 6245362u },
+    { 7051, 4026355146u, 6258549u },
+    { 4471, 3652011670u, 991316u },
+    { 3815, 2229321063u, 1982633u },
+    { 2801, 2340969798u, 4269322u },
+    { 2270, 1398533997u, 6251923u },
+    { 2270, 2786698967u, 6251988u },
+    { 1812, 3974985349u, 5506819u },
+    { 1766, 518218286u, 11512594u },
+    { 1627, 1949466560u, 10521278u },
+    { 1614, 190545943u, 6997091u },
+    { 1277, 4061979306u, 745136u },
+    { 1250, 4091247636u, 31259776u },
+    { 1211, 3098221935u, 1490272u },
+    { 803, 3654878723u, 5893660u },
+    { 755, 525922777u, 6610251u },
+    { 750, 2220965879u, 16773233u },
+    { 747, 84751323u, 6251829u },
+    { 747, 4100484674u, 6252081u },
+    { 731, 84313925u, 11758775u },
+    { 663, 389289171u, 12497317u },
+    { 656, 4259266820u, 12510504u },
+    { 569, 559632405u, 4761684u },
+    { 567, 1082296857u, 11013639u },
+    { 546, 3385363226u, 7742227u },
+    { 529, 1902135459u, 9529961u },
+    { 527, 2239903268u, 2973949u },
+    { 493, 207906793u, 7243272u },
+    { 483, 3551162336u, 5260639u },
+    { 465, 2552686965u, 3278006u },
+    { 478931, 2147483648u, 0u },
+    { 184906, 2407026924u, 12503910u },
+    { 25868, 2639127175u, 18755866u },
+    { 12519, 793051642u, 6251955u },
+    { 1644572, 2575074638u, 6251955u },
+    { 221684, 0u, 0u },
+    { 76616, 2806336377u, 12503910u },
+    { 5355, 3037538906u, 18755866u },
+    { 111348, 4135759767u, 6251955u },
+    { 16083, 2147483648u, 0u },
+};
+
+static const vsop87_fixed_term_t _vsop87_jupiter_terms[149] = {
+    { 174370126, 409763767u, 991316u },
+    { 12301941, 2147483648u, 0u },
+    { 4225824, 648782629u, 1982633u },
+    { 503542, 500199811u, 978003u },
+    { 495339, 2472707982u, 1004629u },
+    { 153596, 887839877u, 2973949u },
+    { 129512, 1375537794u, 192938u },
+    { 101230, 3536579105u, 13313u },
+    { 65104, 3435464850u, 798378u },
+    { 50559, 4183440183u, 206251u },
+    { 48610, 3800490164u, 1184255u },
+    { 45039, 599135169u, 399189u },
+    { 38320, 10712044u, 2175571u },
+    { 34727, 4233489065u, 1969320u },
+    { 24191, 2707721206u, 1995946u },
+    { 22912, 2351814005u, 1583444u },
+    { 19960, 3047124652u, 1776382u },
+    { 15802, 988521767u, 785065u },
+    { 10276, 2044764677u, 385876u },
+    { 8930, 3316453008u, 605440u },
+    { 6619, 1127141899u, 3965266u },
+    { 5530, 1333978022u, 592127u },
+    { 5403, 601353946u, 964690u },
+    { 5098, 4277889082u, 1377193u },
+    { 4768, 1420240985u, 1390506u },
+    { 4079, 2564941471u, 983957u },
+    { 4025, 400354432u, 998676u },
+    { 3833, 2379805909u, 1017942u },
+    { 2917, 261545810u, 3166888u },
+    { 2842, 2373671887u, 1197568u },
+    { 2759, 3805274233u, 2767698u },
+    { 2569, 96921279u, 2960636u },
+    { 2522, 635007864u, 2368509u },
+    { 2492, 4090323031u, 1789695u },
+    { 1939, 3443297152u, 26626u },
+    { 1785, 755298727u, 985363u },
+    { 1751, 2209523102u, 997270u },
+    { 1551, 2568955100u, 2574760u },
+    { 1533, 1470261970u, 179625u },
+    { 1322, 2945432787u, 2987262u },
+    { 991, 2638483244u, 578814u },
+    { 959, 4109037152u, 219564u },
+    { 898, 2178682823u, 2188884u },
+    { 819, 2898287824u, 811691u },
+    { 818, 2657759647u, 412502u },
+    { 801, 4076475660u, 1956007u },
+    { 651, 4045909482u, 1170942u },
+    { 628, 355585962u, 2162258u },
+    { 558, 1326189292u, 1570131u },
+    { 547, 3020745931u, 1763069u },
+    { 541, 3754994778u, 139954u },
+    { 487, 3938106407u, 1596757u },
+    { 457, 921396425u, 2561447u },
+    { 296081, 2147483648u, 0u },
+    { 213170, 72882802u, 1982633u },
+    { 201233, 1661040913u, 978003u },
+    { 197688, 1309412450u, 1004629u },
+    { 27413, 2369702813u, 13313u },
+    { 15503, 312486493u, 2973949u },
+    { 11372, 2803393359u, 991316u },
+    { 10908, 1193838892u, 1969320u },
+    { 10480, 1604314383u, 1995946u },
+    { 7128, 2984283161u, 206251u },
+    { 6092, 2738172728u, 798378u },
+    { 4556, 205124338u, 1184255u },
+    { 4325, 1760107403u, 964690u },
+    { 41562, 2826974958u, 978003u },
+    { 174322001, 3631120363u, 991316u },
+    { 4225464, 3870074721u, 1982633u },
+    { 3141926, 2147483648u, 0u },
+    { 506093, 3718150564u, 978003u },
+    { 495199, 1399118443u, 1004629u },
+    { 153596, 4109109745u, 2973949u },
+    { 126932, 2413031785u, 192938u },
+    { 100894, 2467315538u, 13313u },
+    { 64536, 2363020662u, 798378u },
+    { 49025, 3159898227u, 206251u },
+    { 46802, 2734775880u, 1184255u },
+    { 44526, 3842898586u, 399189u },
+    { 38267, 3233142509u, 2175571u },
+    { 34225, 3127957781u, 1969320u },
+    { 24190, 1634053626u, 1995946u },
+    { 22943, 1275102666u, 1583444u },
+    { 19814, 1979120192u, 1776382u },
+    { 10002, 3090438071u, 385876u },
+    { 9037, 2640161211u, 785065u },
+    { 8932, 2243482937u, 605440u },
+    { 7004, 2593240778u, 1377193u },
+    { 6619, 53444787u, 3965266u },
+    { 6254, 264895025u, 592127u },
+    { 5488, 3807444104u, 964690u },
+    { 4901, 326466668u, 1390506u },
+    { 4078, 1491211132u, 983957u },
+    { 4023, 3620760517u, 998676u },
+    { 3832, 1306220384u, 1017942u },
+    { 2930, 3483496946u, 3166888u },
+    { 2833, 1308588665u, 1197568u },
+    { 2739, 2736337380u, 2767698u },
+    { 2610, 3303987472u, 2960636u },
+    { 2557, 3824917881u, 2368509u },
+    { 2488, 3015493463u, 1789695u },
+    { 1937, 2371395376u, 26626u },
+    { 1786, 3976575865u, 985363u },
+    { 1751, 1135939503u, 997270u },
+    { 1532, 2538083179u, 179625u },
+    { 1519, 1492753156u, 2574760u },
+    { 1322, 1871810424u, 2987262u },
+    { 1086, 3257874476u, 1170942u },
+    { 1054, 3825004317u, 578814u },
+    { 958, 3038299221u, 219564u },
+    { 897, 1106404380u, 2188884u },
+    { 821, 1825371878u, 811691u },
+    { 813, 1592312947u, 412502u },
+    { 809, 2961179493u, 1956007u },
+    { 793, 3147254701u, 2162258u },
+    { 756, 2928823095u, 1570131u },
+    { 552, 2679342624u, 139954u },
+    { 489, 2862510808u, 1596757u },
+    { 481, 2220387861u, 1763069u },
+    { 568680, 2147483648u, 0u },
+    { 213024, 3294122935u, 1982633u },
+    { 201716, 586575907u, 978003u },
+    { 197612, 235772443u, 1004629u },
+    { 27242, 1305023974u, 13313u },
+    { 15733, 1307623020u, 991316u },
+    { 15500, 3533731669u, 2973949u },
+    { 10906, 120585998u, 1969320u },
+    { 10480, 530608287u, 1995946u },
+    { 6530, 2057238363u, 206251u },
+    { 5952, 1685205690u, 798378u },
+    { 4598, 3431977531u, 1184255u },
+    { 4374, 676591778u, 964690u },
+    { 41618, 1753314697u, 978003u },
+    { 40754, 3365866984u, 1004629u },
+    { 3967174, 2432430437u, 991316u },
+    { 288243, 0u, 0u },
+    { 96154, 2671456754u, 1982633u },
+    { 14223, 2461820632u, 978003u },
+    { 11172, 207100117u, 1004629u },
+    { 3495, 2910378914u, 2973949u },
+    { 2500, 3583338750u, 192938u },
+    { 2319, 1196464438u, 13313u },
+    { 1776, 1149971756u, 798378u },
+    { 1447, 2533796629u, 399189u },
+    { 1274, 1481393567u, 1184255u },
+    { 1270, 1856033830u, 206251u },
+    { 826, 2049940216u, 2175571u },
+    { 824, 2029533573u, 1969320u },
+    { 136591, 1043799756u, 991316u },
+};
+
+static const vsop87_fixed_term_t _vsop87_saturn_terms[246] = {
+    { 319316838, 597718916u, 399189u },
+    { 8862522, 84699839u, 798378u },
+    { 2268424, 2848875489u, 385876u },
+    { 2222733, 513321551u, 412502u },
+    { 1424318, 0u, 0u },
+    { 783946, 1382358914u, 13313u },
+    { 421233, 1485653372u, 206251u },
+    { 374362, 2157925880u, 785065u },
+    { 368321, 3867293359u, 1197568u },
+    { 240360, 1853487202u, 592127u },
+    { 170897, 3389565225u, 192938u },
+    { 145624, 492254638u, 991316u },
+    { 125123, 937821u, 811691u },
+    { 32831, 693721350u, 605440u },
+    { 28113, 424076335u, 425815u },
+    { 27045, 3842347619u, 20672u },
+    { 24881, 1628293956u, 1184255u },
+    { 23562, 606935916u, 391830u },
+    { 23104, 2746483917u, 406548u },
+    { 22019, 1843771002u, 378517u },
+    { 19562, 1477562240u, 419861u },
+    { 18127, 3355814596u, 1596757u },
+    { 15284, 1286709355u, 26626u },
+    { 14949, 3833184930u, 119282u },
+    { 12867, 3006426045u, 372563u },
+    { 10487, 3164747284u, 1377193u },
+    { 8553, 1120516764u, 219564u },
+    { 8444, 258391654u, 405143u },
+    { 8323, 3761848900u, 139954u },
+    { 8280, 3830627226u, 777706u },
+    { 8279, 4039129615u, 978003u },
+    { 8239, 3097580135u, 393235u },
+    { 7842, 3783479028u, 1210881u },
+    { 7837, 128452101u, 279907u },
+    { 4943, 3198961832u, 518471u },
+    { 4170, 704041786u, 1982633u },
+    { 4159, 2869248995u, 917660u },
+    { 4035, 3871524256u, 658425u },
+    { 3336, 578490271u, 7359u },
+    { 3049, 2963291882u, 1969320u },
+    { 2759, 1694389485u, 1390506u },
+    { 2403, 1491216459u, 179625u },
+    { 2254, 3772579400u, 1570131u },
+    { 2121, 573616595u, 578814u },
+    { 2091, 1680461548u, 1583444u },
+    { 2038, 4210118844u, 825004u },
+    { 1938, 3627801876u, 71366u },
+    { 1793, 2461151302u, 771752u },
+    { 1743, 3107381569u, 394608u },
+    { 1729, 236988780u, 403770u },
+    { 1631, 180878516u, 1004629u },
+    { 1380, 4075095943u, 256457u },
+    { 1273, 4099796000u, 791019u },
+    { 1263, 2543634709u, 397387u },
+    { 1257, 799533066u, 400992u },
+    { 1129, 971275075u, 819050u },
+    { 1063, 3941713601u, 142732u },
+    { 1050, 2771747662u, 2561447u },
+    { 1045, 578514262u, 399099u },
+    { 1045, 2764408841u, 399279u },
+    { 1003, 28359803u, 1170942u },
+    { 1003, 2841402007u, 1995946u },
+    { 995, 3688305092u, 259235u },
+    { 977, 1209183068u, 5954u },
+    { 969, 779660353u, 160626u },
+    { 949, 500729034u, 618753u },
+    { 910, 661777587u, 381295u },
+    { 884, 3695662862u, 539143u },
+    { 879, 3755062193u, 238563u },
+    { 848, 3484488131u, 1176896u },
+    { 841, 1021568741u, 17894u },
+    { 829, 3605368459u, 2162258u },
+    { 815, 2715881496u, 417083u },
+    { 784, 4011100012u, 727012u },
+    { 775, 2514299628u, 805737u },
+    { 726, 2234924324u, 637753u },
+    { 703, 2431845602u, 792424u },
+    { 659, 1401900011u, 2778u },
+    { 549, 1503630811u, 398214u },
+    { 548, 3105831926u, 23450u },
+    { 548, 1839917258u, 400165u },
+    { 516, 3271161139u, 1610070u },
+    { 503, 2461983772u, 98610u },
+    { 2541783, 0u, 0u },
+    { 1035168, 2922690991u, 798378u },
+    { 910975, 4000425046u, 385876u },
+    { 886877, 3645398592u, 412502u },
+    { 210421, 224881410u, 13313u },
+    { 104809, 3301632072u, 785065u },
+    { 86088, 2409423599u, 1197568u },
+    { 68332, 758748445u, 399189u },
+    { 63484, 3066764024u, 811691u },
+    { 40108, 784289276u, 206251u },
+    { 22448, 3556299616u, 425815u },
+    { 22402, 2545232041u, 592127u },
+    { 10402, 4142869844u, 372563u },
+    { 10207, 128147322u, 26626u },
+    { 7474, 4234897954u, 192938u },
+    { 6355, 1897702343u, 1596757u },
+    { 6071, 3480459577u, 391830u },
+    { 5965, 4172356621u, 406548u },
+    { 5745, 3141745739u, 1184255u },
+    { 5468, 3328591589u, 405143u },
+    { 5433, 3833420493u, 605440u },
+    { 5333, 24974073u, 393235u },
+    { 188155, 864037666u, 385876u },
+    { 183152, 2476855777u, 412502u },
+    { 148761, 2147483648u, 0u },
+    { 112780, 1657970025u, 399189u },
+    { 75263, 1703111111u, 798378u },
+    { 319769336, 3818399435u, 399189u },
+    { 26638189, 2147483648u, 0u },
+    { 8872390, 3305229928u, 798378u },
+    { 2320844, 1745001394u, 385876u },
+    { 2225857, 3734035802u, 412502u },
+    { 787056, 305226473u, 13313u },
+    { 418018, 412649066u, 206251u },
+    { 397242, 920340655u, 785065u },
+    { 368680, 2793107752u, 1197568u },
+    { 235166, 776607382u, 592127u },
+    { 145783, 3708168652u, 991316u },
+    { 125268, 3221702798u, 811691u },
+    { 112462, 454039463u, 192938u },
+    { 32829, 3915764651u, 605440u },
+    { 28152, 3644797872u, 425815u },
+    { 27035, 2770458959u, 20672u },
+    { 23809, 607608921u, 1184255u },
+    { 23541, 3826447780u, 391830u },
+    { 23148, 1671045810u, 406548u },
+    { 22125, 861084499u, 378517u },
+    { 19590, 403158371u, 419861u },
+    { 18136, 2281453142u, 1596757u },
+    { 15365, 207335790u, 26626u },
+    { 14998, 619728743u, 119282u },
+    { 14085, 1794983326u, 372563u },
+    { 9955, 4169137336u, 1377193u },
+    { 8572, 45294602u, 219564u },
+    { 8456, 3479097792u, 405143u },
+    { 8333, 2752240172u, 777706u },
+    { 8331, 2684233892u, 139954u },
+    { 8268, 2019561119u, 393235u },
+    { 7851, 2709224797u, 1210881u },
+    { 7845, 3349818963u, 279907u },
+    { 6802, 1601727065u, 578814u },
+    { 6744, 672390257u, 978003u },
+    { 5162, 2120609671u, 518471u },
+    { 4168, 1794754399u, 917660u },
+    { 4043, 2797600125u, 658425u },
+    { 3902, 3924404872u, 1982633u },
+    { 3205, 2384193941u, 179625u },
+    { 3032, 4011271393u, 1969320u },
+    { 2574, 796997985u, 1390506u },
+    { 2322, 800387018u, 771752u },
+    { 2193, 575879542u, 1570131u },
+    { 2041, 3135912306u, 825004u },
+    { 1936, 2555007664u, 71366u },
+    { 1745, 2033489138u, 394608u },
+    { 1730, 3457452647u, 403770u },
+    { 1687, 637176421u, 1583444u },
+    { 1623, 3408009099u, 1004629u },
+    { 1356, 850841977u, 256457u },
+    { 1302, 2310632781u, 7359u },
+    { 1280, 1669039809u, 1170942u },
+    { 1273, 3020032723u, 791019u },
+    { 1265, 1469352593u, 397387u },
+    { 1259, 4020221244u, 400992u },
+    { 1130, 4192297954u, 819050u },
+    { 1064, 2867919136u, 142732u },
+    { 1053, 3848872086u, 2561447u },
+    { 1047, 3799251681u, 399099u },
+    { 1046, 1690181997u, 399279u },
+    { 1001, 1767256218u, 1995946u },
+    { 970, 4000999819u, 160626u },
+    { 950, 3721563317u, 618753u },
+    { 931, 3838863975u, 381295u },
+    { 896, 124171763u, 5954u },
+    { 885, 2622690650u, 539143u },
+    { 879, 476795524u, 238563u },
+    { 850, 2664459456u, 259235u },
+    { 850, 2410451941u, 1176896u },
+    { 839, 4237621253u, 17894u },
+    { 822, 370351785u, 2162258u },
+    { 816, 1641393697u, 417083u },
+    { 785, 2936726669u, 727012u },
+    { 761, 1451905668u, 805737u },
+    { 697, 1337616588u, 792424u },
+    { 667, 290491169u, 2778u },
+    { 563, 1416427359u, 1776382u },
+    { 550, 429437771u, 398214u },
+    { 549, 2033197511u, 23450u },
+    { 548, 765887542u, 400165u },
+    { 517, 2197319009u, 1610070u },
+    { 503, 3533116433u, 98610u },
+    { 1803178, 0u, 0u },
+    { 1037025, 1847997470u, 798378u },
+    { 919926, 2916551802u, 385876u },
+    { 888350, 2571109785u, 412502u },
+    { 211903, 3440011525u, 13313u },
+    { 104781, 2227398852u, 785065u },
+    { 86168, 1335357205u, 1197568u },
+    { 63563, 1992605362u, 811691u },
+    { 55074, 3617696012u, 399189u },
+    { 39189, 4027202098u, 206251u },
+    { 22552, 1483628095u, 592127u },
+    { 22483, 2482032867u, 425815u },
+    { 11074, 2977114112u, 372563u },
+    { 10277, 3341689242u, 26626u },
+    { 7461, 3159526058u, 192938u },
+    { 6357, 823097995u, 1596757u },
+    { 6067, 2403184144u, 391830u },
+    { 5970, 3098014489u, 406548u },
+    { 5609, 2052546872u, 1184255u },
+    { 5476, 2254289120u, 405143u },
+    { 5419, 2762878101u, 605440u },
+    { 5350, 3243539552u, 393235u },
+    { 189149, 4081676799u, 385876u },
+    { 183547, 1402368159u, 412502u },
+    { 153853, 0u, 0u },
+    { 121566, 612065035u, 399189u },
+    { 75673, 626828137u, 798378u },
+    { 13877090, 2462435512u, 399189u },
+    { 407435, 0u, 0u },
+    { 385300, 1949038511u, 798378u },
+    { 110488, 390462104u, 385876u },
+    { 96279, 2379309762u, 412502u },
+    { 33245, 3235789604u, 13313u },
+    { 19247, 3367319278u, 206251u },
+    { 16018, 1435758999u, 1197568u },
+    { 14582, 3998207325u, 785065u },
+    { 11598, 3709122454u, 592127u },
+    { 5431, 1866045526u, 811691u },
+    { 3836, 2540552519u, 991316u },
+    { 3020, 944277774u, 192938u },
+    { 1812, 3508090437u, 378517u },
+    { 1309, 2539443213u, 605440u },
+    { 1245, 3455759799u, 1184255u },
+    { 1213, 2291382245u, 425815u },
+    { 1134, 1461933667u, 20672u },
+    { 1037, 2478422150u, 391830u },
+    { 994, 317790761u, 406548u },
+    { 900, 3333676455u, 419861u },
+    { 639716, 3380536157u, 399189u },
+    { 177268, 2147483648u, 0u },
+    { 43709, 1545821219u, 385876u },
+    { 34046, 1224236901u, 412502u },
+    { 28839, 352807100u, 798378u },
+};
+
+static const vsop87_fixed_term_t _vsop87_uranus_terms[256] = {
+    { 643362858, 3746849699u, 139954u },
+    { 44383294, 0u, 0u },
+    { 14899006, 1134496333u, 279907u },
+    { 4921834, 2340499223u, 137176u },
+    { 4741332, 3004767896u, 142732u },
+    { 2080746, 3513823374u, 2778u },
+    { 517729, 2817121778u, 419861u },
+    { 484599, 1812248539u, 277129u },
+    { 317088, 1133825203u, 20672u },
+    { 220629, 393700587u, 282686u },
+    { 212735, 2799586631u, 119282u },
+    { 208583, 2090904822u, 145510u },
+    { 196355, 3280667499u, 134397u },
+    { 183777, 2482215034u, 160626u },
+    { 166459, 409779616u, 991316u },
+    { 153753, 2671293011u, 5556u },
+    { 128723, 4229642243u, 259235u },
+    { 89905, 662276730u, 399189u },
+    { 72266, 3628895213u, 71366u },
+    { 48824, 1584229222u, 132595u },
+    { 45413, 3766871629u, 147313u },
+    { 41979, 1718860930u, 208542u },
+    { 40129, 2803564670u, 74144u },
+    { 37333, 3501582157u, 417083u },
+    { 36952, 3045102354u, 65810u },
+    { 35105, 2669588420u, 274351u },
+    { 21833, 2549756259u, 205763u },
+    { 21335, 204838764u, 559815u },
+    { 18087, 2683611803u, 7359u },
+    { 13147, 1837705642u, 8335u },
+    { 12061, 2794104118u, 378517u },
+    { 11595, 1262540479u, 148288u },
+    { 11523, 2076545955u, 422639u },
+    { 11364, 4090580632u, 131619u },
+    { 11118, 1737633808u, 122060u },
+    { 10678, 3786600160u, 285464u },
+    { 9524, 4113596235u, 345717u },
+    { 9520, 1763780630u, 238563u },
+    { 8945, 4176774820u, 300580u },
+    { 8459, 3624756247u, 17894u },
+    { 7874, 2800771049u, 272548u },
+    { 7705, 3769692107u, 157848u },
+    { 6739, 3057570310u, 41344u },
+    { 6696, 392714800u, 23450u },
+    { 6686, 956158767u, 211320u },
+    { 6602, 3783064863u, 139744u },
+    { 6595, 1563046603u, 140163u },
+    { 6233, 3897808660u, 63031u },
+    { 6229, 425348623u, 98610u },
+    { 5566, 3328418153u, 202985u },
+    { 5091, 1971507889u, 76922u },
+    { 4680, 4289684454u, 414305u },
+    { 4561, 1745879173u, 163404u },
+    { 4323, 3477556308u, 271573u },
+    { 4159, 4251043771u, 135373u },
+    { 4112, 132972972u, 68588u },
+    { 4026, 648534006u, 1982633u },
+    { 3872, 1211563361u, 144535u },
+    { 3773, 4180664829u, 134000u },
+    { 3623, 1162278732u, 145908u },
+    { 2932, 3397024177u, 348495u },
+    { 2617, 3981155068u, 637753u },
+    { 2512, 77984344u, 798378u },
+    { 2381, 891264876u, 557037u },
+    { 2238, 3476794749u, 116504u },
+    { 2101, 1171535072u, 287267u },
+    { 1847, 2264529455u, 262014u },
+    { 1803, 2819695024u, 140929u },
+    { 1797, 2524160298u, 138978u },
+    { 1691, 3203626940u, 33985u },
+    { 1594, 3388859584u, 138151u },
+    { 1534, 666726778u, 342939u },
+    { 1515, 1972607402u, 141756u },
+    { 1503, 764487042u, 124838u },
+    { 1493, 201215252u, 214098u },
+    { 1420, 2699492294u, 497799u },
+    { 1201, 762372855u, 256457u },
+    { 1194, 1009131062u, 11113u },
+    { 1111, 358317561u, 155069u },
+    { 1097, 354272957u, 412502u },
+    { 1008, 3500689063u, 13313u },
+    { 967, 1887573801u, 699769u },
+    { 914, 4166030782u, 200207u },
+    { 883, 33026815u, 571455u },
+    { 872, 153183833u, 181298u },
+    { 866, 2630252068u, 518471u },
+    { 859, 3036644565u, 150091u },
+    { 853, 440865811u, 60253u },
+    { 848, 611848317u, 128841u },
+    { 752, 3570792547u, 5954u },
+    { 749, 434553825u, 151067u },
+    { 743, 1494363327u, 485671u },
+    { 732, 845949477u, 896988u },
+    { 718, 2877108677u, 139466u },
+    { 714, 2468842723u, 140442u },
+    { 696, 2157242691u, 245922u },
+    { 693, 2462260953u, 1562772u },
+    { 659, 62939455u, 38566u },
+    { 649, 1411955928u, 140044u },
+    { 649, 3933850036u, 139864u },
+    { 647, 883357884u, 297801u },
+    { 642, 3985813881u, 28031u },
+    { 635, 2953881205u, 288242u },
+    { 635, 3759208612u, 562593u },
+    { 629, 2894159784u, 385876u },
+    { 624, 1145222785u, 79701u },
+    { 603, 1185421577u, 425418u },
+    { 603, 3918685205u, 139654u },
+    { 248212, 4108690935u, 279907u },
+    { 176791, 2147483648u, 0u },
+    { 80477, 3647899156u, 137176u },
+    { 77067, 1696639472u, 142732u },
+    { 37261, 3808533395u, 20672u },
+    { 32331, 239729002u, 119282u },
+    { 27351, 827514676u, 160626u },
+    { 17241, 1496564492u, 419861u },
+    { 15330, 1566844973u, 259235u },
+    { 13034, 210022532u, 132595u },
+    { 12133, 845124553u, 147313u },
+    { 10849, 3463396645u, 139954u },
+    { 7276, 3374836742u, 282686u },
+    { 6524, 892855808u, 145510u },
+    { 643076807, 2673052460u, 139954u },
+    { 14894968, 60728700u, 279907u },
+    { 5454651, 2147483648u, 0u },
+    { 4951272, 1267489160u, 137176u },
+    { 4739214, 1930976728u, 142732u },
+    { 2097178, 2440056275u, 2778u },
+    { 517634, 1743368565u, 419861u },
+    { 483975, 738281550u, 277129u },
+    { 315068, 63405565u, 20672u },
+    { 220568, 3614903062u, 282686u },
+    { 218215, 1887615473u, 119282u },
+    { 208483, 1017116498u, 145510u },
+    { 183701, 1408403707u, 160626u },
+    { 181852, 2218008590u, 134397u },
+    { 166409, 3631138074u, 991316u },
+    { 154213, 1597803318u, 5556u },
+    { 130165, 3158255615u, 259235u },
+    { 90048, 3883233840u, 399189u },
+    { 72558, 2555172247u, 71366u },
+    { 48329, 512781283u, 132595u },
+    { 45396, 2693043898u, 147313u },
+    { 41899, 644710860u, 208542u },
+    { 40155, 1729821973u, 74144u },
+    { 37314, 2427772440u, 417083u },
+    { 36435, 4116668301u, 65810u },
+    { 35067, 1595070010u, 274351u },
+    { 21399, 1473818705u, 205763u },
+    { 21332, 3426063120u, 559815u },
+    { 17881, 1629876555u, 7359u },
+    { 13172, 3937041054u, 378517u },
+    { 13160, 764506987u, 8335u },
+    { 11589, 188758216u, 148288u },
+    { 11521, 1002764078u, 422639u },
+    { 11477, 631654799u, 122060u },
+    { 10676, 2712798318u, 285464u },
+    { 9520, 3039914766u, 345717u },
+    { 8943, 3103006257u, 300580u },
+    { 8777, 2557201364u, 17894u },
+    { 8468, 3042832131u, 131619u },
+    { 7861, 1727643736u, 272548u },
+    { 7695, 2696361101u, 157848u },
+    { 7222, 3373839855u, 68588u },
+    { 6750, 2361538802u, 238563u },
+    { 6728, 1984980274u, 41344u },
+    { 6678, 4177099259u, 211320u },
+    { 6657, 3616835453u, 23450u },
+    { 6599, 2709311416u, 139744u },
+    { 6591, 489280961u, 140163u },
+    { 6082, 673167248u, 63031u },
+    { 5214, 1284168117u, 98610u },
+    { 5092, 897617145u, 76922u },
+    { 4680, 3216003359u, 414305u },
+    { 4560, 672038451u, 163404u },
+    { 4163, 3178207925u, 135373u },
+    { 4025, 3869863141u, 1982633u },
+    { 3869, 138012339u, 144535u },
+    { 3771, 3106861146u, 134000u },
+    { 3630, 87544409u, 145908u },
+    { 2931, 2323266307u, 348495u },
+    { 2636, 768014672u, 637753u },
+    { 2515, 3298652045u, 798378u },
+    { 2380, 4112420892u, 557037u },
+    { 2150, 2688095618u, 116504u },
+    { 2101, 97466447u, 287267u },
+    { 1864, 2516171071u, 271573u },
+    { 1851, 1187751581u, 262014u },
+    { 1801, 1745982646u, 140929u },
+    { 1795, 1450330657u, 138978u },
+    { 1682, 2132093066u, 33985u },
+    { 1594, 2315087255u, 138151u },
+    { 1513, 897209110u, 141756u },
+    { 1513, 3979881533u, 124838u },
+    { 1492, 3422190876u, 214098u },
+    { 1452, 3897245273u, 342939u },
+    { 1440, 3790306336u, 497799u },
+    { 1200, 3991986000u, 256457u },
+    { 1192, 4230630037u, 11113u },
+    { 1112, 3575419442u, 155069u },
+    { 1096, 3575480867u, 412502u },
+    { 968, 2394392400u, 13313u },
+    { 967, 813705333u, 699769u },
+    { 898, 1106045269u, 571455u },
+    { 870, 3374703071u, 181298u },
+    { 859, 1963091726u, 150091u },
+    { 830, 1511866961u, 60253u },
+    { 763, 1064081466u, 245922u },
+    { 754, 3965238430u, 202985u },
+    { 752, 326328101u, 340161u },
+    { 747, 3655469654u, 151067u },
+    { 743, 420333047u, 485671u },
+    { 731, 1916972837u, 896988u },
+    { 726, 325249876u, 5954u },
+    { 718, 1803366901u, 139466u },
+    { 715, 1395456898u, 140442u },
+    { 692, 4266668142u, 105969u },
+    { 686, 3536772123u, 1562772u },
+    { 657, 3286630008u, 38566u },
+    { 650, 338568783u, 140044u },
+    { 650, 2860462897u, 139864u },
+    { 646, 4104997279u, 297801u },
+    { 646, 1806559672u, 385876u },
+    { 636, 2918658974u, 28031u },
+    { 634, 2685401498u, 562593u },
+    { 633, 1879806133u, 288242u },
+    { 724070, 0u, 0u },
+    { 248044, 3034782995u, 279907u },
+    { 80043, 2576237853u, 137176u },
+    { 76973, 622660867u, 142732u },
+    { 36956, 2740033412u, 20672u },
+    { 31870, 3466643445u, 119282u },
+    { 27338, 4048588745u, 160626u },
+    { 17236, 422744895u, 419861u },
+    { 15253, 501000311u, 259235u },
+    { 12850, 3430633511u, 132595u },
+    { 12129, 4066252658u, 147313u },
+    { 10879, 2957221446u, 139954u },
+    { 7272, 2300930369u, 282686u },
+    { 6518, 4113984209u, 145510u },
+    { 8683259, 1789992730u, 139954u },
+    { 595363, 2147483648u, 0u },
+    { 201097, 3473328464u, 279907u },
+    { 64049, 395576326u, 137176u },
+    { 63848, 1104941169u, 142732u },
+    { 28396, 1545063619u, 2778u },
+    { 10313, 161128103u, 119282u },
+    { 6993, 861662795u, 419861u },
+    { 6622, 4130885292u, 277129u },
+    { 4893, 4202915023u, 134397u },
+    { 4207, 3535188052u, 20672u },
+    { 3779, 2433313080u, 991316u },
+    { 3492, 2497203515u, 399189u },
+    { 2971, 2760062313u, 282686u },
+    { 2765, 233954677u, 145510u },
+    { 220089, 8694593u, 139954u },
+};
+
+static const vsop87_fixed_term_t _vsop87_neptune_terms[73] = {
+    { 1008609318, 3631176260u, 71366u },
+    { 9086595, 2147483648u, 0u },
+    { 5276802, 77373250u, 68588u },
+    { 5011395, 741664243u, 74144u },
+    { 4531748, 2393018315u, 142732u },
+    { 871514, 1364329994u, 2778u },
+    { 360388, 3681019097u, 139954u },
+    { 276419, 979013001u, 65810u },
+    { 274337, 534412522u, 5556u },
+    { 189762, 4094316121u, 76922u },
+    { 166336, 409784693u, 991316u },
+    { 103189, 273585456u, 137176u },
+    { 91353, 597733363u, 399189u },
+    { 45596, 3791576478u, 145510u },
+    { 30523, 1154611789u, 214098u },
+    { 23166, 3988392322u, 8335u },
+    { 20406, 1794973773u, 63031u },
+    { 18351, 1064994677u, 134397u },
+    { 9694, 3274050904u, 79701u },
+    { 4278, 1871049880u, 208542u },
+    { 4233, 2440345235u, 211320u },
+    { 4031, 648791855u, 1982633u },
+    { 2686, 1120812085u, 202985u },
+    { 2541, 68433974u, 798378u },
+    { 2530, 1898831396u, 131619u },
+    { 2169, 3162036703u, 11113u },
+    { 1868, 2614652121u, 60253u },
+    { 1588, 2800730834u, 148288u },
+    { 1562, 70994324u, 70390u },
+    { 1529, 749957710u, 72342u },
+    { 85846, 1380362234u, 68588u },
+    { 81579, 3733735406u, 74144u },
+    { 39728, 1970389519u, 142732u },
+    { 1008665134, 2557124011u, 71366u },
+    { 10135404, 2147483648u, 0u },
+    { 5270257, 3298475677u, 68588u },
+    { 5011746, 3962593045u, 74144u },
+    { 4531993, 1318959945u, 142732u },
+    { 867131, 290854979u, 2778u },
+    { 360287, 2606924707u, 139954u },
+    { 273532, 3755711161u, 5556u },
+    { 195354, 4235600938u, 65810u },
+    { 189776, 3020285382u, 76922u },
+    { 166289, 3631138567u, 991316u },
+    { 102182, 3493347446u, 137176u },
+    { 91483, 3818420858u, 399189u },
+    { 45600, 2717539393u, 145510u },
+    { 30525, 80548734u, 214098u },
+    { 23082, 2914667630u, 8335u },
+    { 9695, 2200047833u, 79701u },
+    { 6738, 818828599u, 63031u },
+    { 4305, 797994468u, 208542u },
+    { 4232, 1365608476u, 211320u },
+    { 4031, 3870056511u, 1982633u },
+    { 2942, 2211245876u, 202985u },
+    { 2544, 3289105352u, 798378u },
+    { 2161, 2087972418u, 11113u },
+    { 1778, 540032385u, 134397u },
+    { 1588, 1726823930u, 148288u },
+    { 1561, 3291646949u, 70390u },
+    { 118430, 2147483648u, 0u },
+    { 85941, 305946706u, 68588u },
+    { 81587, 2659751111u, 74144u },
+    { 39738, 896345659u, 142732u },
+    { 31160677, 985044428u, 71366u },
+    { 418081, 0u, 0u },
+    { 159160, 1724079959u, 68588u },
+    { 151662, 2398970424u, 74144u },
+    { 140109, 4041994585u, 142732u },
+    { 28221, 3000365546u, 2778u },
+    { 10974, 1039352060u, 139954u },
+    { 10359, 2249050142u, 65810u },
+    { 8661, 2182645312u, 5556u },
+};
+
+static const vsop87_fixed_body_series_t _vsop87_bodies[] = {
+    { _vsop87_mercury_terms, { { 7, 5, 0, 0, 0 }, { 7, 5, 0, 0, 0 }, { 6, 2, 0, 0, 0 } } },
+    { _vsop87_venus_terms, { { 7, 2, 0, 0, 0 }, { 7, 2, 0, 0, 0 }, { 3, 1, 0, 0, 0 } } },
+    { _vsop87_earth_terms, { { 9, 2, 0, 0, 0 }, { 9, 2, 0, 0, 0 }, { 0, 1, 0, 0, 0 } } },
+    { _vsop87_mars_terms, { { 34, 4, 0, 0, 0 }, { 35, 4, 0, 0, 0 }, { 4, 2, 0, 0, 0 } } },
+    { _vsop87_jupiter_terms, { { 53, 13, 1, 0, 0 }, { 52, 13, 2, 0, 0 }, { 14, 1, 0, 0, 0 } } },
+    { _vsop87_saturn_terms, { { 83, 22, 5, 0, 0 }, { 83, 22, 5, 0, 0 }, { 21, 5, 0, 0, 0 } } },
+    { _vsop87_uranus_terms, { { 108, 14, 0, 0, 0 }, { 104, 14, 0, 0, 0 }, { 15, 1, 0, 0, 0 } } },
+    { _vsop87_neptune_terms, { { 30, 3, 0, 0, 0 }, { 27, 4, 0, 0, 0 }, { 9, 0, 0, 0, 0 } } },
+};
+
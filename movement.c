@@ -36,8 +36,15 @@
 #include "watch_utility.h"
 #include "usb.h"
 #include "watch_private.h"
+#include "watch_bus.h"
 #include "movement.h"
 #include "filesystem.h"
+#include "watch_boot_trace.h"
+#include "watch_fault.h"
+#include "watch_stack.h"
+#ifndef MOVEMENT_NO_EPHEMERIS
+#include "ephemeris.h"
+#endif
 #include "shell.h"
 #include "utz.h"
 #include "zones.h"
@@ -52,14 +59,41 @@
 
 #if __EMSCRIPTEN__
 #include <emscripten.h>
+#include "watch_wake_stats.h"
 void _wake_up_simulator(void);
+// display traffic tallied by the simulator's SLCD stubs, for the stats bridge below
+extern uint32_t _sim_display_commit_count;
+extern uint32_t _sim_display_pixel_writes;
 #else
 #include "watch_usb_cdc.h"
 #endif
 
 volatile movement_state_t movement_state;
 void * watch_face_contexts[MOVEMENT_NUM_FACES];
+// Faces are set up lazily: app_setup only marks every face as needing setup, and the
+// setup callback runs the first time a face is actually activated or asked to do work.
+// This keeps cold boot (and every wake from sleep mode) from paying for faces the
+// wearer may not visit for hours.
+static bool _face_needs_setup[MOVEMENT_NUM_FACES];
+
+// Deepest stack usage observed after each face's loop, in bytes. The stack is
+// painted once in app_setup; see _movement_face_loop and the stackstat command.
+static uint16_t _face_stack_high_water[MOVEMENT_NUM_FACES];
+// Deadline ledger: loops that ran longer than the tick period they were serving,
+// and the longest loop seen, per face. Cleared with the wake stats.
+static uint16_t _face_loop_overruns[MOVEMENT_NUM_FACES];
+static uint16_t _face_loop_max_ticks[MOVEMENT_NUM_FACES];
+// Which faces provide an advise callback, cached once at first launch so the
+// top-of-minute handler only visits faces that can actually want background work.
+static uint64_t _advisory_face_mask;
+
+// Faces that declared themselves compute-heavy (TOTP's SHA-1, the solar ephemeris
+// math) have their loop run at 16 MHz, race-to-idle style; see _movement_face_loop.
+static uint64_t _compute_heavy_face_mask;
 watch_date_time_t scheduled_tasks[MOVEMENT_NUM_FACES];
+// The earliest deadline in scheduled_tasks, kept up to date on every schedule/cancel.
+// Lets the minute handler skip the whole array walk unless something is actually due.
+static watch_date_time_t _next_scheduled_task;
 const int32_t movement_le_inactivity_deadlines[8] = {INT_MAX, 600, 3600, 7200, 21600, 43200, 86400, 604800};
 const int16_t movement_timeout_inactivity_deadlines[4] = {60, 120, 300, 1800};
 
@@ -89,13 +123,16 @@ typedef struct {
     volatile bool enter_sleep_mode;
     volatile bool exit_sleep_mode;
     volatile bool is_sleeping;
+    volatile bool le_seconds_ticking;
     volatile uint8_t subsecond;
     volatile rtc_counter_t minute_counter;
     volatile bool minute_alarm_fired;
+    volatile bool background_task_due;
     volatile bool is_buzzing;
     volatile uint8_t pending_sequence_priority;
     volatile bool schedule_next_comp;
     volatile bool has_pending_accelerometer;
+    volatile bool wearer_is_stationary;
 
     // button tracking for long press
     movement_button_t mode_button;
@@ -104,15 +141,177 @@ typedef struct {
 
     // button events that will not be passed to the current face loop, but will instead passed directly to the default loop handler.
     volatile uint32_t passthrough_events;
+
+    // passthrough button events route here straight from the ISR, so the main loop can
+    // run just the default handler for them without touching the face dispatch path.
+    volatile uint32_t pending_passthrough_actions;
 } movement_volatile_state_t;
 
 movement_volatile_state_t movement_volatile_state;
 
-// The last sequence that we have been asked to play while the watch was in deep sleep
-static int8_t *_pending_sequence;
+// Events flow from the interrupt callbacks to app_loop through a small single-producer/
+// single-consumer ring buffer, so that two rapid presses of the same button within one
+// loop iteration are delivered as two events instead of collapsing into one mask bit.
+// The head is normally only written in interrupt context, the tail only in app_loop;
+// interrupts all run at the same priority on this part so pushes never preempt each
+// other. The few main-thread pushes (delivering ACTIVATE at boot and after a benchmark
+// run) mask interrupts around the push so an ISR push cannot land mid-write.
+// pending_events remains as a fast-path summary mask for the button and tick handling.
+#define MOVEMENT_EVENT_QUEUE_SIZE 16 // must be a power of two
+
+static volatile uint8_t _movement_event_queue[MOVEMENT_EVENT_QUEUE_SIZE];
+static volatile uint8_t _movement_event_queue_head;
+static volatile uint8_t _movement_event_queue_tail;
+
+// Interrupts all run at the same priority on this part, so the core's single enable
+// bit is the whole critical section. The simulator is single threaded and its
+// callbacks only ever run between loop passes, so there is nothing to mask there.
+static inline void _movement_critical_enter(void) {
+#if !defined(__EMSCRIPTEN__)
+    __disable_irq();
+#endif
+}
+
+static inline void _movement_critical_exit(void) {
+#if !defined(__EMSCRIPTEN__)
+    __enable_irq();
+#endif
+}
+
+// True while the current loop delivery has further events queued behind it in the same
+// pass; lets a face batch its work and render only once. @see movement_more_events_this_pass
+static bool _more_events_this_pass;
+
+bool movement_more_events_this_pass(void) {
+    return _more_events_this_pass;
+}
+
+WATCH_RAMFUNC static void _movement_push_event(movement_event_type_t event_type) {
+    if (event_type == EVENT_NONE) return;
+
+    movement_volatile_state.pending_events |= 1 << event_type;
+
+    uint8_t head = _movement_event_queue_head;
+    uint8_t next_head = (head + 1) & (MOVEMENT_EVENT_QUEUE_SIZE - 1);
+    // If the queue is full something has gone very wrong (16 events in one loop
+    // iteration); drop the event rather than corrupt the buffer.
+    if (next_head != _movement_event_queue_tail) {
+        _movement_event_queue[head] = event_type;
+        _movement_event_queue_head = next_head;
+    }
+}
+
+#ifdef MOVEMENT_FACE_LIST
+// The face list is fixed at build time, so dispatch face loops through a generated
+// switch instead of a function pointer loaded from the watch_faces array. This lets the
+// compiler see the callee at each call site and inline small face loops on the tick path.
+enum { _MOVEMENT_FACE_LOOP_BASE = __COUNTER__ + 1 };
+#define _MOVEMENT_FACE_LOOP_CASE(face) \
+    case (__COUNTER__ - _MOVEMENT_FACE_LOOP_BASE): return face##_loop(event, context);
+
+static bool _movement_face_dispatch(uint8_t face_idx, movement_event_t event, void *context) {
+    switch (face_idx) {
+        MOVEMENT_FACE_LIST(_MOVEMENT_FACE_LOOP_CASE)
+    }
+    return watch_faces[face_idx].loop(event, context);
+}
+#else
+// Configs that predate MOVEMENT_FACE_LIST fall back to the function pointer call.
+static bool _movement_face_dispatch(uint8_t face_idx, movement_event_t event, void *context) {
+    return watch_faces[face_idx].loop(event, context);
+}
+#endif
+
+static bool _movement_face_loop(uint8_t face_idx, movement_event_t event, void *context) {
+    // compute-heavy faces race to idle: raise the clock for the duration of their
+    // loop so the work finishes in fewer microseconds, then drop straight back to
+    // the baseline for tick housekeeping and sleep.
+    bool boost = (_compute_heavy_face_mask >> face_idx) & 1;
+    if (boost) watch_request_cpu_speed(WATCH_CPU_SPEED_16MHZ);
+    rtc_counter_t loop_start = watch_rtc_get_counter();
+    bool can_sleep = _movement_face_dispatch(face_idx, event, context);
+    uint32_t loop_ticks = watch_rtc_get_counter() - loop_start;
+    if (boost) watch_release_cpu_speed(WATCH_CPU_SPEED_16MHZ);
+
+    // a loop that outlasts the tick period it was serving means events queue
+    // and timing skews; count it against the face. tick_frequency 0 is the
+    // once-a-minute update used in low energy mode.
+    uint32_t period_ticks = movement_state.tick_frequency
+        ? watch_rtc_get_frequency() / movement_state.tick_frequency
+        : 60 * watch_rtc_get_frequency();
+    if (loop_ticks > _face_loop_max_ticks[face_idx]) _face_loop_max_ticks[face_idx] = (uint16_t)loop_ticks;
+    if (loop_ticks > period_ticks && _face_loop_overruns[face_idx] < UINT16_MAX) _face_loop_overruns[face_idx]++;
+
+    // attribute the deepest stack excursion seen so far to the face that was
+    // just on the stack; the check only scans words used since the last call.
+    uint32_t depth = watch_stack_high_water();
+    if (depth > _face_stack_high_water[face_idx]) _face_stack_high_water[face_idx] = (uint16_t)depth;
+
+    return can_sleep;
+}
+
+// Push a button event, deciding already in interrupt context whether it belongs to the
+// current face or to the default loop handler (passthrough). Precomputing that decision
+// keeps the wake window for the most common interactions (MODE advancing faces, LIGHT
+// lighting the LED) as short as possible.
+WATCH_RAMFUNC static void _movement_push_button_event(movement_event_type_t event_type) {
+    if (event_type == EVENT_NONE) return;
+
+    if (movement_volatile_state.passthrough_events & (1 << event_type)) {
+        // still record it in the summary mask; the longpress scheduling needs it.
+        movement_volatile_state.pending_events |= 1 << event_type;
+        movement_volatile_state.pending_passthrough_actions |= 1 << event_type;
+    } else {
+        _movement_push_event(event_type);
+    }
+}
+
+// Sounds waiting for the buzzer. A single pending slot used to silently drop
+// whichever of two colliding sounds lost the priority check; instead, park the
+// loser here and let the sequencer's end-of-tune callback drain the queue,
+// highest priority first. Four entries cover the worst realistic pileup (alarm,
+// chime, timer, button) without a face ever needing to retry.
+#define MOVEMENT_SEQUENCE_QUEUE_SIZE 4
+
+typedef struct {
+    const int8_t *sequence;
+    movement_buzzer_priority_t priority;
+} movement_sequence_slot_t;
+
+static movement_sequence_slot_t _sequence_queue[MOVEMENT_SEQUENCE_QUEUE_SIZE];
+static volatile uint8_t _sequence_queue_depth;
+// guards against the queue draining from inside a preempting play call
+static volatile bool _sequence_preempting;
+// play the queue out before going back to sleep after a wake-to-buzz
+static volatile bool _resleep_when_quiet;
+
+// Idle work queue. Deferred maintenance (settings commit, write-behind flush,
+// littlefs garbage collection) used to be hard-coded on the way into low energy
+// mode; now each job registers once and every idle window drains the table in
+// priority order under a shared time budget. A task does one bounded slice of
+// work per call and returns true if more remains; anything still unfinished when
+// the budget runs out continues at the next minute wake.
+#define MOVEMENT_MAX_IDLE_TASKS 8
+// per-window budget in 128 Hz RTC ticks (~375 ms): enough for a settings commit
+// plus a littlefs gc pass, short enough that a button press never feels ignored.
+#define MOVEMENT_IDLE_WINDOW_TICKS 48
+
+typedef struct {
+    movement_idle_task_fn fn;
+    movement_idle_priority_t priority;
+} movement_idle_task_slot_t;
+
+static movement_idle_task_slot_t _idle_tasks[MOVEMENT_MAX_IDLE_TASKS];
+static uint8_t _idle_task_count;
+// set when a window's budget ran out before its tasks did; the sleep
+// mini-runloop picks the remainder up at the next minute wake.
+static bool _idle_work_pending;
+
+// Which entry of the signal tune registry movement_play_signal plays
+static uint8_t _signal_tune_index = SIGNAL_TUNE_DEFAULT_INDEX;
 
 // The note sequence of the default alarm
-int8_t alarm_tune[] = {
+static const int8_t alarm_tune[] = {
     BUZZER_NOTE_C8, 3,
     BUZZER_NOTE_REST, 4,
     BUZZER_NOTE_C8, 3,
@@ -133,6 +332,7 @@ void cb_light_btn_interrupt(void);
 void cb_alarm_btn_interrupt(void);
 void cb_alarm_btn_extwake(void);
 void cb_minute_alarm_fired(void);
+void cb_background_task_fired(void);
 void cb_tick(void);
 void cb_mode_btn_timeout_interrupt(void);
 void cb_light_btn_timeout_interrupt(void);
@@ -145,12 +345,16 @@ void cb_buzzer_stop(void);
 
 void cb_accelerometer_event(void);
 void cb_accelerometer_wake(void);
+void cb_accelerometer_motion_change(void);
 
 #if __EMSCRIPTEN__
 void yield(void) {
 }
 #else
 void yield(void) {
+    // USB is only ever brought up when a cable was attached at boot; when it
+    // wasn't, skip the stack entirely so yield costs nothing on battery.
+    if (!usb_is_enabled()) return;
     tud_task();
     cdc_task();
 }
@@ -168,7 +372,41 @@ static udatetime_t _movement_convert_date_time_to_udate(watch_date_time_t date_t
     };
 }
 
+// DEGRADED POWER POLICY
+// A sagging cell used to mean the watch died mid-alarm: the buzzer's drive current
+// browned out the MCU long before the RTC's own minimum. Instead, VCC is measured
+// at boot and every ten minutes and mapped onto three tiers. Below the degraded
+// threshold the buzzer is capped at soft volume and the low energy countdown is
+// clamped to ten minutes, overriding even a user who disabled low energy mode.
+// Below the critical threshold the LED additionally stays dark, the countdown
+// drops to two minutes, and advisory background tasks (sensor logging) are parked;
+// scheduled tasks like alarms still fire, just quietly. Tiers step down the moment
+// a threshold is crossed but need 100 mV of headroom to step back up, so a load
+// transient doesn't flap the policy.
+#ifndef MOVEMENT_VCC_DEGRADED_MILLIVOLTS
+#define MOVEMENT_VCC_DEGRADED_MILLIVOLTS 2600
+#endif
+#ifndef MOVEMENT_VCC_CRITICAL_MILLIVOLTS
+#define MOVEMENT_VCC_CRITICAL_MILLIVOLTS 2400
+#endif
+#define MOVEMENT_VCC_RECOVERY_MARGIN_MILLIVOLTS 100
+
+static movement_power_tier_t _power_tier = MOVEMENT_POWER_TIER_NORMAL;
+
+// background motion-capture session: bursts counted from the accelerometer's
+// stationary/active edge, incremented in the interrupt callback below.
+static bool _motion_capture_active;
+static volatile uint32_t _motion_capture_count;
+
+movement_power_tier_t movement_get_power_tier(void) {
+    return _power_tier;
+}
+
 static watch_buzzer_volume_t _movement_get_buzzer_volume(movement_buzzer_priority_t priority) {
+    // below the degraded power threshold everything plays soft: full drive
+    // current into a sagging cell is how a watch dies mid-alarm.
+    if (_power_tier != MOVEMENT_POWER_TIER_NORMAL) return WATCH_BUZZER_VOLUME_SOFT;
+
     switch (priority) {
         case BUZZER_PRIORITY_BUTTON:
             return movement_button_volume();
@@ -216,6 +454,8 @@ static void _movement_set_top_of_minute_alarm() {
     movement_volatile_state.schedule_next_comp = true;
 }
 
+static void _movement_invalidate_local_date_time_cache(void);
+
 static bool _movement_update_dst_offset_cache(void) {
     uzone_t local_zone;
     udatetime_t udate_time;
@@ -242,9 +482,76 @@ static bool _movement_update_dst_offset_cache(void) {
         }
     }
 
+    if (dst_changed) _movement_invalidate_local_date_time_cache();
+
     return dst_changed;
 }
 
+// ADAPTIVE LOW ENERGY TIMEOUT
+// A 24-bucket hour-of-day histogram of button interactions, decayed by half at local
+// midnight so stale habits age out. Hours with enough decayed activity are "active":
+// the low energy countdown runs twice as long there and four times shorter during
+// historically idle hours, so the watch drops into low energy mode quickly overnight
+// without sleeping on the wearer during the hours they actually press buttons.
+// The active-hours bitmap is persisted to a tagged backup register so the learned
+// pattern survives a reset; the histogram itself reseeds from the bitmap at boot.
+#define LE_ADAPT_ACTIVE_THRESHOLD 4
+
+static uint8_t _le_hour_histogram[24];
+static uint8_t _le_adapt_backup_register;
+
+static uint32_t _movement_le_active_hours(void) {
+    uint32_t bitmap = 0;
+    for (uint8_t i = 0; i < 24; i++) {
+        if (_le_hour_histogram[i] >= LE_ADAPT_ACTIVE_THRESHOLD) bitmap |= 1ul << i;
+    }
+    return bitmap;
+}
+
+static void _movement_le_adapt_record(void) {
+    uint8_t hour = movement_get_local_date_time().unit.hour;
+    if (_le_hour_histogram[hour] < UINT8_MAX) _le_hour_histogram[hour]++;
+}
+
+static void _movement_le_adapt_store(void) {
+    movement_set_tagged_backup_data(_movement_le_active_hours(), _le_adapt_backup_register);
+}
+
+static void _movement_le_adapt_restore(void) {
+    bool restored;
+    _le_adapt_backup_register = movement_claim_tagged_backup_register(MOVEMENT_BACKUP_TAG('L', 'E', 'h', 'r'), &restored);
+    if (!_le_adapt_backup_register || !restored) return;
+    uint32_t value = movement_get_tagged_backup_data(_le_adapt_backup_register);
+    for (uint8_t i = 0; i < 24; i++) {
+        if (value & (1ul << i)) _le_hour_histogram[i] = LE_ADAPT_ACTIVE_THRESHOLD;
+    }
+}
+
+static int32_t _movement_le_deadline(void) {
+    int32_t base = movement_le_inactivity_deadlines[movement_state.settings.bit.le_interval];
+
+    // degraded power policy: clamp the countdown regardless of settings or learned
+    // habits. This deliberately overrides le_interval 0, because "never sleep" is
+    // exactly the setting that kills a low cell.
+    if (_power_tier == MOVEMENT_POWER_TIER_CRITICAL) return 120;
+    if (_power_tier == MOVEMENT_POWER_TIER_DEGRADED) return (base < 600) ? base : 600;
+
+    // le_interval 0 disables low energy mode entirely; never adapt that.
+    if (movement_state.settings.bit.le_interval == 0) return base;
+    // until a pattern has been learned, every hour looks idle; don't shorten anything.
+    uint32_t active_hours = _movement_le_active_hours();
+    if (active_hours == 0) return base;
+
+    uint8_t hour = movement_get_local_date_time().unit.hour;
+    if (active_hours & (1ul << hour)) {
+        return base * 2;
+    } else {
+        int32_t shortened = base / 4;
+        // but never sleep in under two minutes, even in a dead hour
+        return (shortened >= 120) ? shortened : base;
+    }
+}
+
 static inline void _movement_reset_inactivity_countdown(void) {
     rtc_counter_t counter = watch_rtc_get_counter();
     uint32_t freq = watch_rtc_get_frequency();
@@ -259,7 +566,7 @@ static inline void _movement_reset_inactivity_countdown(void) {
 
     watch_rtc_register_comp_callback_no_schedule(
         cb_sleep_timeout_interrupt,
-        counter + movement_le_inactivity_deadlines[movement_state.settings.bit.le_interval] * freq,
+        counter + _movement_le_deadline() * freq,
         SLEEP_TIMEOUT
     );
 
@@ -272,6 +579,29 @@ static inline void _movement_disable_inactivity_countdown(void) {
     movement_volatile_state.schedule_next_comp = true;
 }
 
+static void _movement_power_policy_update(void) {
+    uint16_t vcc = watch_get_vcc_voltage();
+
+    // each boundary gains the recovery margin while we are at or below its tier,
+    // so stepping down is immediate but stepping back up needs 100 mV of headroom.
+    uint16_t critical_boundary = MOVEMENT_VCC_CRITICAL_MILLIVOLTS;
+    uint16_t degraded_boundary = MOVEMENT_VCC_DEGRADED_MILLIVOLTS;
+    if (_power_tier >= MOVEMENT_POWER_TIER_CRITICAL) critical_boundary += MOVEMENT_VCC_RECOVERY_MARGIN_MILLIVOLTS;
+    if (_power_tier >= MOVEMENT_POWER_TIER_DEGRADED) degraded_boundary += MOVEMENT_VCC_RECOVERY_MARGIN_MILLIVOLTS;
+
+    movement_power_tier_t tier;
+    if (vcc < critical_boundary) tier = MOVEMENT_POWER_TIER_CRITICAL;
+    else if (vcc < degraded_boundary) tier = MOVEMENT_POWER_TIER_DEGRADED;
+    else tier = MOVEMENT_POWER_TIER_NORMAL;
+
+    if (tier == _power_tier) return;
+    _power_tier = tier;
+
+    // the low energy deadline just changed; re-arm the countdown with the new value.
+    // the low energy mini-loop manages its own comps, so leave it alone if sleeping.
+    if (!movement_volatile_state.is_sleeping) _movement_reset_inactivity_countdown();
+}
+
 static void _movement_renew_top_of_minute_alarm(void) {
     // Renew the alarm for a minute from the previous one (ensures no drift)
     movement_volatile_state.minute_counter += watch_rtc_get_ticks_per_minute();
@@ -279,22 +609,18 @@ static void _movement_renew_top_of_minute_alarm(void) {
     movement_volatile_state.schedule_next_comp = true;
 }
 
-static uint32_t _movement_get_accelerometer_events() {
-    uint32_t accelerometer_events = 0;
-
+static void _movement_push_accelerometer_events(void) {
     uint8_t int_src = lis2dw_get_interrupt_source();
 
     if (int_src & LIS2DW_REG_ALL_INT_SRC_DOUBLE_TAP) {
-        accelerometer_events |= 1 << EVENT_DOUBLE_TAP;
+        _movement_push_event(EVENT_DOUBLE_TAP);
         printf("Double tap!\r\n");
     }
 
     if (int_src & LIS2DW_REG_ALL_INT_SRC_SINGLE_TAP) {
-        accelerometer_events |= 1 << EVENT_SINGLE_TAP;
+        _movement_push_event(EVENT_SINGLE_TAP);
         printf("Single tap!\r\n");
     }
-
-    return accelerometer_events;
 }
 
 static void _movement_handle_button_presses(uint32_t pending_events) {
@@ -353,6 +679,9 @@ static void _movement_handle_button_presses(uint32_t pending_events) {
         // force alarm off if the user pressed a button.
         watch_buzzer_abort_sequence();
 
+        // feed the adaptive low energy timeout's hour-of-day histogram
+        _movement_le_adapt_record();
+
         // Delay auto light off if the user is still interacting with the watch.
         if (movement_state.light_on) {
             movement_illuminate_led();
@@ -365,6 +694,37 @@ static void _movement_handle_button_presses(uint32_t pending_events) {
     }
 }
 
+static void _movement_ensure_face_setup(uint8_t face_idx) {
+    if (_face_needs_setup[face_idx]) {
+        _face_needs_setup[face_idx] = false;
+        watch_faces[face_idx].setup(face_idx, &watch_face_contexts[face_idx]);
+    }
+}
+
+// Sensor wake window: while a background-task pass is in flight, sensor reads taken by
+// the faces are batched. The first face to ask for a reading pays the peripheral
+// bring-up and conversion; any other face asking during the same pass gets the same
+// sample for free. The window closes when the pass ends, so foreground reads taken at
+// other times still hit the hardware.
+static bool _sensor_window_open = false;
+static bool _sensor_window_has_temperature = false;
+static float _sensor_window_temperature;
+
+static void _movement_sensor_window_begin(void) {
+    _sensor_window_open = true;
+    _sensor_window_has_temperature = false;
+}
+
+static void _movement_sensor_window_end(void) {
+    _sensor_window_open = false;
+}
+
+// The last reading taken by anyone, kept past the window so foreground faces can show
+// it instantly instead of paying a conversion of their own.
+static bool _sensor_has_last_temperature = false;
+static float _sensor_last_temperature;
+static uint32_t _sensor_last_temperature_time;  // local unix time
+
 static void _movement_handle_top_of_minute(void) {
     watch_date_time_t date_time = watch_rtc_get_date_time();
 
@@ -373,59 +733,189 @@ static void _movement_handle_top_of_minute(void) {
         _movement_update_dst_offset_cache();
     }
 
-    for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-        // For each face that offers an advisory...
-        if (watch_faces[i].advise != NULL) {
-            // ...we ask for one.
-            movement_watch_face_advisory_t advisory = watch_faces[i].advise(watch_face_contexts[i]);
-
-            // If it wants a background task...
-            if (advisory.wants_background_task) {
-                // we give it one. pretty straightforward!
-                movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
-                watch_faces[i].loop(background_event, watch_face_contexts[i]);
-            }
+    // sample VCC every ten minutes and move between power tiers as needed. This runs
+    // before the critical-tier early out below, or we could never recover from it.
+    if (date_time.unit.minute % 10 == 0) {
+        _movement_power_policy_update();
+    }
+
+    watch_date_time_t local_date_time = movement_get_local_date_time();
+#ifndef MOVEMENT_NO_EPHEMERIS
+    // at local midnight, re-prime the shared daily ephemeris cache so the astronomy
+    // faces pick up today's record without computing anything on activation. Builds
+    // with no astronomy faces drop the ephemeris library and this block with it.
+    if (local_date_time.unit.hour == 0 && local_date_time.unit.minute == 0) {
+        movement_location_t location = {0};
+        filesystem_read_file("location.u32", (char *) &location.reg, sizeof(movement_location_t));
+        if (location.reg) {
+            ephemeris_prime(local_date_time.unit.year + WATCH_RTC_REFERENCE_YEAR,
+                            local_date_time.unit.month, local_date_time.unit.day,
+                            (int16_t)location.bit.longitude, (int16_t)location.bit.latitude);
+        }
+    }
+#endif
+
+    // adaptive low energy timeout bookkeeping: once a day decay the interaction
+    // histogram, and once an hour persist the active-hours bitmap if it changed.
+    if (local_date_time.unit.minute == 0) {
+        if (local_date_time.unit.hour == 0) {
+            for (uint8_t i = 0; i < 24; i++) _le_hour_histogram[i] >>= 1;
+        }
+        _movement_le_adapt_store();
+    }
 
-            // TODO: handle other advisory types
+    // the quiet-timeout half of the write-behind policy: anything faces deferred while
+    // the user was flipping through them gets committed within a minute.
+    filesystem_flush();
+
+    // at the critical power tier, advisory polling is parked entirely: sensor
+    // logging is the first thing to go when the goal is keeping the RTC alive.
+    // scheduled tasks (alarms, timers) are untouched and still fire.
+    if (_power_tier == MOVEMENT_POWER_TIER_CRITICAL) return;
+
+    // Only the faces in the advisory mask are polled; everything else is skipped
+    // without so much as a pointer load.
+    _movement_sensor_window_begin();
+    uint64_t advisory_faces = _advisory_face_mask;
+    while (advisory_faces) {
+        uint8_t i = __builtin_ctzll(advisory_faces);
+        advisory_faces &= advisory_faces - 1;
+
+        _movement_ensure_face_setup(i);
+        movement_watch_face_advisory_t advisory = watch_faces[i].advise(watch_face_contexts[i]);
+
+        // If it wants a background task...
+        if (advisory.wants_background_task) {
+            // we give it one. pretty straightforward!
+            movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
+            _movement_face_loop(i, background_event, watch_face_contexts[i]);
         }
+
+        // TODO: handle other advisory types
     }
+    _movement_sensor_window_end();
+}
+
+// Recompute the earliest deadline across all faces. Only called when a task fires or is
+// canceled; scheduling a task updates the cached minimum in O(1).
+static void _movement_recompute_next_scheduled_task(void) {
+    _next_scheduled_task.reg = 0;
+
+    for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+        if (scheduled_tasks[i].reg && (_next_scheduled_task.reg == 0 || scheduled_tasks[i].reg < _next_scheduled_task.reg)) {
+            _next_scheduled_task.reg = scheduled_tasks[i].reg;
+        }
+    }
+
+    movement_state.has_scheduled_background_task = (_next_scheduled_task.reg != 0);
+}
+
+// Arm (or disarm) the RTC comparison for the earliest scheduled task, so background
+// tasks fire from an interrupt at their deadline instead of being polled on every
+// 1 Hz tick. This also lets them fire in low energy sleep mode and under a tickless
+// foreground face, where no per-second tick exists to piggyback the check on.
+static void _movement_arm_background_task_comp(void) {
+    if (_next_scheduled_task.reg == 0) {
+        watch_rtc_disable_comp_callback_no_schedule(BACKGROUND_TASK_TIMEOUT);
+        movement_volatile_state.schedule_next_comp = true;
+        return;
+    }
+
+    watch_date_time_t now = watch_rtc_get_date_time();
+    if (_next_scheduled_task.reg <= now.reg) {
+        // already due; let the main loop dispatch it on this pass.
+        movement_volatile_state.background_task_due = true;
+        return;
+    }
+
+    uint32_t delta = watch_utility_date_time_to_unix_time(_next_scheduled_task, 0)
+                   - watch_utility_date_time_to_unix_time(now, 0);
+    uint32_t freq = watch_rtc_get_frequency();
+    rtc_counter_t target = watch_rtc_get_counter() + delta * freq;
+
+    if (_next_scheduled_task.unit.second == 0) {
+        // Most scheduled work is minute-aligned: hourly logging, alarms, the top-of-hour
+        // chime. Snap those deadlines onto the top-of-minute alarm's counter grid, so the
+        // comparison lands in the same RTC interrupt as the minute alarm and the dispatch
+        // shares its wake — one wake transition instead of two back to back. The delta
+        // above is whole seconds from a mid-second "now", so the raw target sits within
+        // a second of a grid point; rounding to the nearest one lands exactly on it.
+        uint32_t ticks_per_minute = watch_rtc_get_ticks_per_minute();
+        // the one-minute bias keeps the unsigned difference in range when the anchor
+        // has already been renewed past the target; it vanishes in the modulo.
+        rtc_counter_t off_grid = (target + ticks_per_minute - movement_volatile_state.minute_counter) % ticks_per_minute;
+        if (off_grid < ticks_per_minute / 2) target -= off_grid;
+        else target += ticks_per_minute - off_grid;
+    }
+    // second-level precision is all the deadline comparison has; if the comparison
+    // fires a hair before the second rolls over, the handler's fast path re-arms us.
+    watch_rtc_register_comp_callback_no_schedule(cb_background_task_fired, target, BACKGROUND_TASK_TIMEOUT);
+    movement_volatile_state.schedule_next_comp = true;
 }
 
 static void _movement_handle_scheduled_tasks(void) {
     watch_date_time_t date_time = watch_rtc_get_date_time();
-    uint8_t num_active_tasks = 0;
 
+    // Fast path: nothing is due yet. If the comparison interrupt beat the second
+    // rollover, re-arm it rather than dropping the task.
+    if (_next_scheduled_task.reg == 0) return;
+    if (_next_scheduled_task.reg > date_time.reg) {
+        _movement_arm_background_task_comp();
+        return;
+    }
+
+    _movement_sensor_window_begin();
     for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-        if (scheduled_tasks[i].reg) {
-            if (scheduled_tasks[i].reg <= date_time.reg) {
-                scheduled_tasks[i].reg = 0;
-                movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
-                watch_faces[i].loop(background_event, watch_face_contexts[i]);
-                // check if loop scheduled a new task
-                if (scheduled_tasks[i].reg) {
-                    num_active_tasks++;
-                }
-            } else {
-                num_active_tasks++;
-            }
+        if (scheduled_tasks[i].reg && scheduled_tasks[i].reg <= date_time.reg) {
+            scheduled_tasks[i].reg = 0;
+            _movement_ensure_face_setup(i);
+            movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
+            _movement_face_loop(i, background_event, watch_face_contexts[i]);
+            // the loop may have scheduled a new task; the recompute below picks it up.
         }
     }
+    _movement_sensor_window_end();
 
-    if (num_active_tasks == 0) {
-        movement_state.has_scheduled_background_task = false;
-    } else {
+    _movement_recompute_next_scheduled_task();
+    _movement_arm_background_task_comp();
+
+    if (movement_state.has_scheduled_background_task && !movement_volatile_state.is_sleeping) {
         _movement_reset_inactivity_countdown();
     }
 }
 
-void movement_request_tick_frequency(uint8_t freq) {
-    // Movement requires at least a 1 Hz tick.
-    // If we are asked for an invalid frequency, default back to 1 Hz.
-    if (freq == 0 || __builtin_popcount(freq) != 1) freq = 1;
+// Tick-frequency arbitration. The foreground face's movement_request_tick_frequency
+// sets the baseline rate; claims stack a minimum on top of it, and the effective rate
+// is always the maximum of current needs. Claims are owned by the face that was in the
+// foreground when they were made and are force-released when that face resigns, so an
+// interrupted face can never leave the system ticking fast indefinitely.
+#define MOVEMENT_MAX_TICK_CLAIMS 4
+
+typedef struct {
+    uint8_t freq;       // claimed minimum rate; 0 marks the slot free
+    uint8_t owner_face; // face index the claim dies with
+} movement_tick_claim_slot_t;
+
+static movement_tick_claim_slot_t _tick_claims[MOVEMENT_MAX_TICK_CLAIMS];
+// the foreground face's baseline rate; 0 requests tickless operation
+static uint8_t _face_tick_request = 1;
+
+static void _movement_apply_tick_frequency(void) {
+    uint8_t freq = _face_tick_request;
+    for (uint8_t i = 0; i < MOVEMENT_MAX_TICK_CLAIMS; i++) {
+        if (_tick_claims[i].freq > freq) freq = _tick_claims[i].freq;
+    }
 
     // disable all periodic callbacks
     watch_rtc_disable_matching_periodic_callbacks(0xFF);
 
+    if (freq == 0) {
+        movement_state.tick_frequency = 0;
+        movement_state.tick_pern = 7;
+        movement_volatile_state.subsecond = 0;
+        return;
+    }
+
     // this left-justifies the period in a 32-bit integer.
     uint32_t tmp = (freq & 0xFF) << 24;
     // now we can count the leading zeroes to get the value we need.
@@ -438,12 +928,98 @@ void movement_request_tick_frequency(uint8_t freq) {
     watch_rtc_register_periodic_callback(cb_tick, freq);
 }
 
+void movement_request_tick_frequency(uint8_t freq) {
+    // A frequency of 0 requests tickless operation: the periodic tick is suppressed
+    // entirely, and the face receives a minute-resolution EVENT_TICK from the existing
+    // top-of-minute alarm instead. Faces that don't display seconds can use this to
+    // avoid waking the CPU every second. Other invalid frequencies fall back to 1 Hz.
+    if (freq != 0 && __builtin_popcount(freq) != 1) freq = 1;
+    _face_tick_request = freq;
+    _movement_apply_tick_frequency();
+}
+
+movement_tick_claim_t movement_claim_tick_frequency(uint8_t freq) {
+    if (freq == 0 || __builtin_popcount(freq) != 1) return 0;
+    for (uint8_t i = 0; i < MOVEMENT_MAX_TICK_CLAIMS; i++) {
+        if (_tick_claims[i].freq == 0) {
+            _tick_claims[i].freq = freq;
+            _tick_claims[i].owner_face = movement_state.current_face_idx;
+            _movement_apply_tick_frequency();
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+void movement_release_tick_claim(movement_tick_claim_t claim) {
+    if (claim == 0 || claim > MOVEMENT_MAX_TICK_CLAIMS) return;
+    if (_tick_claims[claim - 1].freq == 0) return;
+    _tick_claims[claim - 1].freq = 0;
+    _movement_apply_tick_frequency();
+}
+
+// releases every claim owned by a resigning face; the effective rate is reapplied
+// afterward by the movement_request_tick_frequency(1) on the face-switch path.
+static void _movement_release_face_tick_claims(uint8_t face_idx) {
+    for (uint8_t i = 0; i < MOVEMENT_MAX_TICK_CLAIMS; i++) {
+        if (_tick_claims[i].freq != 0 && _tick_claims[i].owner_face == face_idx) {
+            _tick_claims[i].freq = 0;
+        }
+    }
+}
+
+// Ambient-light-adaptive LED brightness. The backlight is the single largest
+// current spike in the system, and it is used most in the dark — exactly where a
+// fraction of the configured brightness reads just as well. Whoever samples the
+// light sensor (a face, an idle task) publishes readings here; the LED path
+// scales its PWM duty from the cached value, never starting a conversion of its
+// own. No published reading, or a reading older than five minutes, means full
+// configured brightness, so boards without the sensor are unaffected.
+static uint32_t _ambient_lux;
+static rtc_counter_t _ambient_lux_counter;
+static bool _ambient_lux_valid;
+
+#define MOVEMENT_AMBIENT_LUX_MAX_AGE_SECONDS 300
+
+// duty scale in sixteenths by ambient brightness band: moonlight, dim interior,
+// lit interior, daylight. The bottom band still cuts through fully dark-adapted
+// eyes while drawing roughly a fifth of the configured current.
+static const struct {
+    uint16_t max_lux;
+    uint8_t scale;
+} _led_dim_table[] = {
+    { 3, 3 },
+    { 50, 6 },
+    { 400, 10 },
+    { 0xFFFF, 16 },
+};
+
+void movement_set_ambient_light(uint32_t lux) {
+    _ambient_lux = lux;
+    _ambient_lux_counter = watch_rtc_get_counter();
+    _ambient_lux_valid = true;
+}
+
+static uint8_t _movement_led_scale(void) {
+    if (!_ambient_lux_valid) return 16;
+    uint32_t age = (rtc_counter_t)(watch_rtc_get_counter() - _ambient_lux_counter) / watch_rtc_get_frequency();
+    if (age > MOVEMENT_AMBIENT_LUX_MAX_AGE_SECONDS) return 16;
+    uint8_t i = 0;
+    while (_ambient_lux > _led_dim_table[i].max_lux) i++;
+    return _led_dim_table[i].scale;
+}
+
 void movement_illuminate_led(void) {
+    // at the critical power tier the LED stays dark; it is the most current we
+    // can shed without touching timekeeping.
+    if (_power_tier == MOVEMENT_POWER_TIER_CRITICAL) return;
     if (movement_state.settings.bit.led_duration != 0b111) {
         movement_state.light_on = true;
-        watch_set_led_color_rgb(movement_state.settings.bit.led_red_color | movement_state.settings.bit.led_red_color << 4,
-                                movement_state.settings.bit.led_green_color | movement_state.settings.bit.led_green_color << 4,
-                                movement_state.settings.bit.led_blue_color | movement_state.settings.bit.led_blue_color << 4);
+        uint8_t scale = _movement_led_scale();
+        uint8_t red = movement_state.settings.bit.led_red_color | movement_state.settings.bit.led_red_color << 4;
+        uint8_t green = movement_state.settings.bit.led_green_color | movement_state.settings.bit.led_green_color << 4;
+        uint8_t blue = movement_state.settings.bit.led_blue_color | movement_state.settings.bit.led_blue_color << 4;
+        watch_set_led_color_rgb((red * scale) >> 4, (green * scale) >> 4, (blue * scale) >> 4);
         if (movement_state.settings.bit.led_duration == 0) {
             // Do nothing it'll be turned off on button release
         } else {
@@ -533,19 +1109,96 @@ void movement_schedule_background_task_for_face(uint8_t watch_face_index, watch_
     if (date_time.reg > now.reg) {
         movement_state.has_scheduled_background_task = true;
         scheduled_tasks[watch_face_index].reg = date_time.reg;
+        // keep the cached earliest deadline current without a full scan
+        if (_next_scheduled_task.reg == 0 || date_time.reg < _next_scheduled_task.reg) {
+            _next_scheduled_task.reg = date_time.reg;
+            _movement_arm_background_task_comp();
+        }
     }
 }
 
 void movement_cancel_background_task_for_face(uint8_t watch_face_index) {
     scheduled_tasks[watch_face_index].reg = 0;
-    bool other_tasks_scheduled = false;
-    for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-        if (scheduled_tasks[i].reg != 0) {
-            other_tasks_scheduled = true;
-            break;
+    _movement_recompute_next_scheduled_task();
+    _movement_arm_background_task_comp();
+}
+
+void movement_set_face_compute_heavy(uint8_t watch_face_index, bool compute_heavy) {
+    if (watch_face_index >= MOVEMENT_NUM_FACES) return;
+    if (compute_heavy) _compute_heavy_face_mask |= (uint64_t)1 << watch_face_index;
+    else _compute_heavy_face_mask &= ~((uint64_t)1 << watch_face_index);
+}
+
+static uint32_t _movement_benchmark_now(void) {
+#if __EMSCRIPTEN__
+    // sub-millisecond browser clock; the RTC counter is frozen here because the
+    // interval that drives it can't fire while we run synchronously.
+    return (uint32_t)(emscripten_get_now() * 1000.0);
+#else
+    return watch_rtc_get_counter();
+#endif
+}
+
+bool movement_benchmark_face(uint8_t watch_face_index, uint32_t tick_count, bool with_buttons, movement_benchmark_t *results) {
+    if (watch_face_index >= MOVEMENT_NUM_FACES) return false;
+
+    memset(results, 0, sizeof(movement_benchmark_t));
+#if __EMSCRIPTEN__
+    results->units_per_second = 1000000;
+#else
+    results->units_per_second = watch_rtc_get_frequency();
+#endif
+
+    _movement_ensure_face_setup(watch_face_index);
+    const watch_face_t *wf = &watch_faces[watch_face_index];
+    void *context = watch_face_contexts[watch_face_index];
+
+    movement_event_t event;
+    event.subsecond = 0;
+
+    uint32_t start = _movement_benchmark_now();
+    wf->activate(context);
+    event.event_type = EVENT_ACTIVATE;
+    _movement_face_loop(watch_face_index, event, context);
+    results->activate_units = _movement_benchmark_now() - start;
+
+    event.event_type = EVENT_TICK;
+    for (uint32_t i = 0; i < tick_count; i++) {
+        start = _movement_benchmark_now();
+        _movement_face_loop(watch_face_index, event, context);
+        uint32_t elapsed = _movement_benchmark_now() - start;
+        results->tick_total_units += elapsed;
+        if (elapsed > results->tick_max_units) results->tick_max_units = elapsed;
+        results->ticks++;
+    }
+
+    if (with_buttons) {
+        static const movement_event_type_t script[] = {
+            EVENT_LIGHT_BUTTON_DOWN, EVENT_LIGHT_BUTTON_UP,
+            EVENT_ALARM_BUTTON_DOWN, EVENT_ALARM_BUTTON_UP,
+        };
+        for (uint8_t i = 0; i < sizeof(script) / sizeof(script[0]); i++) {
+            event.event_type = script[i];
+            start = _movement_benchmark_now();
+            _movement_face_loop(watch_face_index, event, context);
+            results->button_total_units += _movement_benchmark_now() - start;
+            results->button_events++;
         }
     }
-    movement_state.has_scheduled_background_task = other_tasks_scheduled;
+
+    wf->resign(context);
+    _movement_release_face_tick_claims(watch_face_index);
+
+    // put the screen back: re-activate whatever face was showing.
+    watch_clear_display();
+    movement_request_tick_frequency(1);
+    watch_faces[movement_state.current_face_idx].activate(watch_face_contexts[movement_state.current_face_idx]);
+    // main-thread push: keep a button or tick ISR from landing mid-write.
+    _movement_critical_enter();
+    _movement_push_event(EVENT_ACTIVATE);
+    _movement_critical_exit();
+
+    return true;
 }
 
 void movement_request_sleep(void) {
@@ -557,6 +1210,77 @@ void movement_request_wake() {
     _movement_reset_inactivity_countdown();
 }
 
+void movement_request_low_energy_seconds(void) {
+    movement_volatile_state.le_seconds_ticking = true;
+}
+
+// Snapshot-based fast resume from BACKUP mode. BACKUP powers down the RAM and wakes
+// through a full reset, so the snapshot file is the only thing connecting the two
+// boots: it holds the active face index plus a compact blob from every face that
+// opted in via the serialize member, laid out as {magic, active_face, count}
+// followed by {face_idx, length, data} per entry. The file is consumed (validated,
+// applied, removed) the first time app_setup runs after the reset.
+#define MOVEMENT_SNAPSHOT_FILENAME "snapshot.bin"
+#define MOVEMENT_SNAPSHOT_MAGIC (0xB4)
+
+void movement_enter_backup_mode(void) {
+    watch_faces[movement_state.current_face_idx].resign(watch_face_contexts[movement_state.current_face_idx]);
+
+    uint8_t buffer[3 + MOVEMENT_NUM_FACES * (2 + MOVEMENT_FACE_SNAPSHOT_SIZE)];
+    size_t pos = 3;
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+        if (watch_faces[i].serialize == NULL) continue;
+        if (watch_face_contexts[i] == NULL) continue; // face never ran; nothing to save
+        uint8_t length = watch_faces[i].serialize(watch_face_contexts[i], &buffer[pos + 2], MOVEMENT_FACE_SNAPSHOT_SIZE);
+        if (length == 0 || length > MOVEMENT_FACE_SNAPSHOT_SIZE) continue;
+        buffer[pos] = i;
+        buffer[pos + 1] = length;
+        pos += 2 + (size_t)length;
+        count++;
+    }
+    buffer[0] = MOVEMENT_SNAPSHOT_MAGIC;
+    buffer[1] = movement_state.current_face_idx;
+    buffer[2] = count;
+
+    movement_store_settings();
+    filesystem_write_file(MOVEMENT_SNAPSHOT_FILENAME, (char *)buffer, (int32_t)pos);
+    filesystem_flush();
+    filesystem_sync();
+
+    watch_enter_backup_mode();
+}
+
+WATCH_COLDFUNC static void _movement_restore_snapshot(void) {
+    if (!filesystem_file_exists(MOVEMENT_SNAPSHOT_FILENAME)) return;
+
+    uint8_t buffer[3 + MOVEMENT_NUM_FACES * (2 + MOVEMENT_FACE_SNAPSHOT_SIZE)];
+    int32_t size = filesystem_get_file_size(MOVEMENT_SNAPSHOT_FILENAME);
+    bool valid = size >= 3 && size <= (int32_t)sizeof(buffer)
+        && filesystem_read_file(MOVEMENT_SNAPSHOT_FILENAME, (char *)buffer, size)
+        && buffer[0] == MOVEMENT_SNAPSHOT_MAGIC
+        && buffer[1] < MOVEMENT_NUM_FACES;
+    // consume the snapshot either way; a stale or truncated one must not outlive this boot.
+    filesystem_rm(MOVEMENT_SNAPSHOT_FILENAME);
+    if (!valid) return;
+
+    movement_state.current_face_idx = buffer[1];
+    watch_fault_set_context(movement_state.current_face_idx);
+    size_t pos = 3;
+    for (uint8_t entry = 0; entry < buffer[2]; entry++) {
+        if ((int32_t)(pos + 2) > size) break;
+        uint8_t face_idx = buffer[pos];
+        uint8_t length = buffer[pos + 1];
+        pos += 2;
+        if (length > MOVEMENT_FACE_SNAPSHOT_SIZE || (int32_t)(pos + length) > size) break;
+        if (face_idx < MOVEMENT_NUM_FACES && watch_faces[face_idx].deserialize != NULL) {
+            _movement_ensure_face_setup(face_idx);
+            watch_faces[face_idx].deserialize(watch_face_contexts[face_idx], &buffer[pos], length);
+        }
+        pos += length;
+    }
+}
+
 void cb_buzzer_start(void) {
     movement_volatile_state.is_buzzing = true;
 }
@@ -581,7 +1305,19 @@ void movement_play_note(watch_buzzer_note_t note, uint16_t duration_ms) {
 }
 
 void movement_play_signal(void) {
-    movement_play_sequence(signal_tune, BUZZER_PRIORITY_SIGNAL);
+    movement_play_sequence(signal_tunes[_signal_tune_index], BUZZER_PRIORITY_SIGNAL);
+}
+
+void movement_set_signal_tune(uint8_t index) {
+    if (index < SIGNAL_TUNE_COUNT) _signal_tune_index = index;
+}
+
+uint8_t movement_get_signal_tune(void) {
+    return _signal_tune_index;
+}
+
+uint8_t movement_get_signal_tune_count(void) {
+    return SIGNAL_TUNE_COUNT;
 }
 
 void movement_play_alarm(void) {
@@ -618,30 +1354,286 @@ void movement_play_alarm_beeps(uint8_t rounds, watch_buzzer_note_t alarm_note) {
     movement_play_sequence(custom_alarm_tune, BUZZER_PRIORITY_ALARM);
 }
 
-void movement_play_sequence(int8_t *note_sequence, movement_buzzer_priority_t priority) {
-    // Priority is used to ensure that lower priority sequences don't cancel higher priority ones
-    // Priotity order: alarm(2) > signal(1) > note(0)
-    if (priority < movement_volatile_state.pending_sequence_priority) {
-        return;
+static void _movement_sequence_enqueue(const int8_t *note_sequence, movement_buzzer_priority_t priority) {
+    // Same-priority sounds keep their arrival order; a full queue evicts its
+    // lowest-priority entry, or the incoming sound if nothing queued is lower.
+    if (_sequence_queue_depth >= MOVEMENT_SEQUENCE_QUEUE_SIZE) {
+        uint8_t lowest = 0;
+        for (uint8_t i = 1; i < MOVEMENT_SEQUENCE_QUEUE_SIZE; i++) {
+            if (_sequence_queue[i].priority < _sequence_queue[lowest].priority) lowest = i;
+        }
+        if (_sequence_queue[lowest].priority >= priority) return;
+        for (uint8_t i = lowest; i + 1 < MOVEMENT_SEQUENCE_QUEUE_SIZE; i++) {
+            _sequence_queue[i] = _sequence_queue[i + 1];
+        }
+        _sequence_queue_depth--;
+    }
+
+    _sequence_queue[_sequence_queue_depth].sequence = note_sequence;
+    _sequence_queue[_sequence_queue_depth].priority = priority;
+    _sequence_queue_depth++;
+}
+
+static bool _movement_sequence_dequeue(movement_sequence_slot_t *slot) {
+    if (_sequence_queue_depth == 0) return false;
+
+    uint8_t best = 0;
+    for (uint8_t i = 1; i < _sequence_queue_depth; i++) {
+        if (_sequence_queue[i].priority > _sequence_queue[best].priority) best = i;
     }
 
+    *slot = _sequence_queue[best];
+    for (uint8_t i = best; i + 1 < _sequence_queue_depth; i++) {
+        _sequence_queue[i] = _sequence_queue[i + 1];
+    }
+    _sequence_queue_depth--;
+
+    return true;
+}
+
+static void cb_sequence_done(void);
+
+static void _movement_start_sequence(const int8_t *note_sequence, movement_buzzer_priority_t priority) {
+    _sequence_preempting = true;
+    watch_buzzer_play_sequence_with_volume(note_sequence, cb_sequence_done, _movement_get_buzzer_volume(priority));
+    _sequence_preempting = false;
+    // set after the call: starting a sequence aborts the previous one, and the
+    // abort path runs cb_buzzer_stop, which zeroes the priority.
     movement_volatile_state.pending_sequence_priority = priority;
+}
+
+static void cb_sequence_done(void) {
+    // Fires from the sequencer when a tune ends or is aborted. Starting a new
+    // sequence aborts the previous one too, which would drain the queue out
+    // from under the preempting play call; the guard skips that invocation.
+    if (_sequence_preempting) return;
+
+    movement_sequence_slot_t next;
+    if (_movement_sequence_dequeue(&next)) {
+        _movement_start_sequence(next.sequence, next.priority);
+    } else if (_resleep_when_quiet) {
+        _resleep_when_quiet = false;
+        movement_request_sleep();
+    }
+}
 
-    // The tcc is off during sleep, we can't play immediately.
-    // Ask to wake up the watch.
+void movement_play_sequence(const int8_t *note_sequence, movement_buzzer_priority_t priority) {
+    // Priority arbitration: a higher-priority sound preempts the one playing;
+    // anything else waits its turn in the queue and plays when the sequencer
+    // runs dry. An hourly chime colliding with a timer expiry is deferred
+    // rather than dropped.
+    // Priotity order: alarm(2) > signal(1) > note(0)
+    // The sequencer's done callback dequeues from TC0 interrupt context; mask
+    // interrupts across the arbitration so a tune ending mid-call can neither
+    // shift the queue underneath the enqueue nor stale the is_buzzing check.
+    _movement_critical_enter();
     if (movement_volatile_state.is_sleeping) {
-        _pending_sequence = note_sequence;
+        // The tcc is off during sleep, so we can't play immediately. Park the
+        // sequence for the sleep mode loop, which starts it on the hardware and
+        // sleeps through it without waking the full app stack.
+        _movement_sequence_enqueue(note_sequence, priority);
         movement_volatile_state.has_pending_sequence = true;
-        movement_volatile_state.exit_sleep_mode = true;
+    } else if (movement_volatile_state.is_buzzing && priority <= movement_volatile_state.pending_sequence_priority) {
+        _movement_sequence_enqueue(note_sequence, priority);
     } else {
-        watch_buzzer_play_sequence_with_volume(note_sequence, NULL, _movement_get_buzzer_volume(priority));
+        _movement_start_sequence(note_sequence, priority);
+    }
+    _movement_critical_exit();
+}
+
+// Per-wake CPU time accounting. Each app_loop pass is one wake from standby; we time
+// it against the RTC counter, which is the only clock that keeps running regardless of
+// CPU state. Resolution is one RTC tick, so short passes may register as zero ticks;
+// the totals are still representative over thousands of wakes.
+static movement_wake_stats_t _wake_stats;
+
+void movement_get_wake_stats(movement_wake_stats_t *stats) {
+    *stats = _wake_stats;
+}
+
+uint8_t movement_get_face_count(void) {
+    return MOVEMENT_NUM_FACES;
+}
+
+uint16_t movement_get_face_stack_high_water(uint8_t watch_face_index) {
+    if (watch_face_index >= MOVEMENT_NUM_FACES) return 0;
+    return _face_stack_high_water[watch_face_index];
+}
+
+void movement_get_face_loop_stats(uint8_t watch_face_index, uint16_t *overruns, uint16_t *max_ticks) {
+    if (overruns) *overruns = 0;
+    if (max_ticks) *max_ticks = 0;
+    if (watch_face_index >= MOVEMENT_NUM_FACES) return;
+    if (overruns) *overruns = _face_loop_overruns[watch_face_index];
+    if (max_ticks) *max_ticks = _face_loop_max_ticks[watch_face_index];
+}
+
+void movement_reset_wake_stats(void) {
+    memset(&_wake_stats, 0, sizeof(_wake_stats));
+    memset(_face_loop_overruns, 0, sizeof(_face_loop_overruns));
+    memset(_face_loop_max_ticks, 0, sizeof(_face_loop_max_ticks));
+    _wake_stats.start_counter = watch_rtc_get_counter();
+}
+
+#if __EMSCRIPTEN__
+// Mirrors the instrumentation ledger into a live JS object (Module.movementStats) a
+// few times a second, so a scheduling or display-diffing change shows its effect in
+// the browser console as it happens. Setting window.showMovementStats = true in the
+// console adds an on-page overlay with the headline numbers; setting it back to
+// false removes it. Counters are snapshotted into a flat word array and read out of
+// the heap on the JS side, which keeps the bridge to one EM_ASM call per update.
+static void _movement_update_simulator_stats(void) {
+    static rtc_counter_t _last_stats_update;
+    rtc_counter_t now = watch_rtc_get_counter();
+    if ((rtc_counter_t)(now - _last_stats_update) < watch_rtc_get_frequency() / 4) return;
+    _last_stats_update = now;
+
+    static uint32_t snapshot[8 + WATCH_WAKE_SOURCE_COUNT];
+    snapshot[0] = _wake_stats.wake_count;
+    snapshot[1] = _wake_stats.busy_ticks;
+    snapshot[2] = _wake_stats.last_wake_ticks;
+    snapshot[3] = _wake_stats.max_wake_ticks;
+    snapshot[4] = now - _wake_stats.start_counter;
+    snapshot[5] = movement_state.tick_frequency;
+    snapshot[6] = _sim_display_commit_count;
+    snapshot[7] = _sim_display_pixel_writes;
+    for (uint8_t i = 0; i < WATCH_WAKE_SOURCE_COUNT; i++) {
+        snapshot[8 + i] = *watch_wake_stats_count_ptr((watch_wake_source_t)i);
     }
+
+    EM_ASM({
+        var base = $0 >> 2;
+        var s = HEAPU32.subarray(base, base + $1);
+        var names = ['rtcPeriodic', 'rtcComp', 'rtcExtwake', 'btnMode', 'btnLight',
+                     'btnAlarm', 'accelerometer', 'eicOther', 'usb'];
+        var wakes = {};
+        for (var i = 0; i < names.length && 8 + i < $1; i++) wakes[names[i]] = s[8 + i];
+        Module.movementStats = {
+            wakeCount: s[0],
+            busyTicks: s[1],
+            lastWakeTicks: s[2],
+            maxWakeTicks: s[3],
+            uptimeTicks: s[4],
+            tickFrequency: s[5],
+            displayCommits: s[6],
+            pixelWrites: s[7],
+            wakeSources: wakes
+        };
+        var el = document.getElementById('movement-stats-overlay');
+        if (window.showMovementStats) {
+            if (!el) {
+                el = document.createElement('pre');
+                el.id = 'movement-stats-overlay';
+                el.style.cssText = 'position:fixed;top:0;right:0;margin:0;padding:4px 8px;' +
+                    'background:rgba(0,0,0,0.75);color:#9f9;font:11px monospace;z-index:1000;';
+                document.body.appendChild(el);
+            }
+            el.textContent =
+                'wakes   ' + s[0] + ' (busy ' + s[1] + ' ticks)\n' +
+                'last    ' + s[2] + ' ticks, max ' + s[3] + '\n' +
+                'tick    ' + s[5] + ' Hz\n' +
+                'commits ' + s[6] + ', px writes ' + s[7];
+        } else if (el) {
+            el.remove();
+        }
+    }, snapshot, 8 + WATCH_WAKE_SOURCE_COUNT);
 }
+#endif
+
+// Watch face contexts are allocated once at boot and never freed, so they come out of
+// a fixed bump-allocated arena rather than the heap. This keeps boot-time allocations
+// from fragmenting the (tiny) heap and drops the malloc bookkeeping overhead.
+#ifndef MOVEMENT_FACE_CONTEXT_ARENA_SIZE
+#define MOVEMENT_FACE_CONTEXT_ARENA_SIZE 2048
+#endif
+
+static uint8_t _face_context_arena[MOVEMENT_FACE_CONTEXT_ARENA_SIZE] __attribute__((aligned(4)));
+static size_t _face_context_arena_used;
+
+void *movement_face_context_alloc(size_t size) {
+    // keep every allocation word aligned
+    size = (size + 3) & ~(size_t)3;
+
+    if (_face_context_arena_used + size > MOVEMENT_FACE_CONTEXT_ARENA_SIZE) {
+        // arena exhausted; fall back to the heap rather than hand out a bad pointer.
+        return malloc(size);
+    }
+
+    void *retval = &_face_context_arena[_face_context_arena_used];
+    _face_context_arena_used += size;
+
+    return retval;
+}
+
+// Full tags for registers claimed this boot, so two tags that happen to hash to
+// the same byte are caught at claim time instead of corrupting each other later.
+static uint32_t _backup_register_tags[8];
 
 uint8_t movement_claim_backup_register(void) {
-    // We use backup register 7 in watch_rtc to keep track of the reference time
-    if (movement_state.next_available_backup_register >= 7) return 0;
-    return movement_state.next_available_backup_register++;
+    // Registers 0 (settings) and 1 (location) are reserved, and we use backup
+    // register 7 in watch_rtc to keep track of the reference time.
+    for (uint8_t reg = 2; reg < 7; reg++) {
+        if (!(movement_state.backup_register_claims & (1 << reg))) {
+            movement_state.backup_register_claims |= (1 << reg);
+            return reg;
+        }
+    }
+    return 0;
+}
+
+static uint8_t _movement_backup_tag_hash(uint32_t tag) {
+    uint8_t hash = (uint8_t)(tag ^ (tag >> 8) ^ (tag >> 16) ^ (tag >> 24));
+    return hash ? hash : 0xA5; // zero would look like a register nobody tagged
+}
+
+uint8_t movement_claim_tagged_backup_register(uint32_t tag, bool *was_restored) {
+    uint8_t hash = _movement_backup_tag_hash(tag);
+    uint8_t fallback = 0;
+    if (was_restored) *was_restored = false;
+
+    for (uint8_t reg = 2; reg < 7; reg++) {
+        if (!(movement_state.backup_register_claims & (1 << reg))) continue;
+        if (_backup_register_tags[reg] == tag) {
+            // same tag claimed again: share the register (and its payload is live).
+            if (was_restored) *was_restored = true;
+            return reg;
+        }
+        // two different tags with the same hash would be indistinguishable after
+        // a reset, so the claim fails closed rather than risk a mixup.
+        if (_backup_register_tags[reg] && _movement_backup_tag_hash(_backup_register_tags[reg]) == hash) return 0;
+    }
+
+    for (uint8_t reg = 2; reg < 7; reg++) {
+        if (movement_state.backup_register_claims & (1 << reg)) continue;
+        if ((watch_get_backup_data(reg) >> 24) == hash) {
+            // a previous boot left our data here; pick it back up wherever it landed.
+            movement_state.backup_register_claims |= (1 << reg);
+            _backup_register_tags[reg] = tag;
+            if (was_restored) *was_restored = true;
+            return reg;
+        }
+        // for a fresh assignment, prefer a register still at its power-on value of
+        // zero over one holding some other build's data.
+        if (!fallback || (watch_get_backup_data(reg) == 0 && watch_get_backup_data(fallback) != 0)) fallback = reg;
+    }
+
+    if (fallback) {
+        movement_state.backup_register_claims |= (1 << fallback);
+        _backup_register_tags[fallback] = tag;
+        watch_store_backup_data((uint32_t)hash << 24, fallback);
+    }
+    return fallback;
+}
+
+uint32_t movement_get_tagged_backup_data(uint8_t reg) {
+    if (!reg) return 0;
+    return watch_get_backup_data(reg) & 0xFFFFFF;
+}
+
+void movement_set_tagged_backup_data(uint32_t value, uint8_t reg) {
+    if (!reg) return;
+    uint32_t merged = (watch_get_backup_data(reg) & 0xFF000000) | (value & 0xFFFFFF);
+    if (watch_get_backup_data(reg) != merged) watch_store_backup_data(merged, reg);
 }
 
 int32_t movement_get_current_timezone_offset_for_zone(uint8_t zone_index) {
@@ -656,6 +1648,12 @@ int32_t movement_get_current_timezone_offset_for_zone(uint8_t zone_index) {
     }
 }
 
+// Cached local date/time, invalidated when the zone or a DST offset changes.
+static struct {
+    unix_timestamp_t timestamp;
+    rtc_date_time_t datetime;
+} _local_date_time_cache = {.datetime.reg=0, .timestamp=0};
+
 int32_t movement_get_current_timezone_offset(void) {
     return movement_get_current_timezone_offset_for_zone(movement_state.settings.bit.time_zone);
 }
@@ -664,8 +1662,13 @@ int32_t movement_get_timezone_index(void) {
     return movement_state.settings.bit.time_zone;
 }
 
+static void _movement_invalidate_local_date_time_cache(void) {
+    _local_date_time_cache.timestamp = 0;
+}
+
 void movement_set_timezone_index(uint8_t value) {
     movement_state.settings.bit.time_zone = value;
+    _movement_invalidate_local_date_time_cache();
 }
 
 watch_date_time_t movement_get_utc_date_time(void) {
@@ -679,25 +1682,50 @@ watch_date_time_t movement_get_date_time_in_zone(uint8_t zone_index) {
 }
 
 watch_date_time_t movement_get_local_date_time(void) {
-    static struct {
-        unix_timestamp_t timestamp;
-        rtc_date_time_t datetime;
-    } cached_date_time = {.datetime.reg=0, .timestamp=0};
-
     unix_timestamp_t timestamp = watch_rtc_get_unix_time();
 
-    if (timestamp != cached_date_time.timestamp) {
-        cached_date_time.timestamp = timestamp;
-        cached_date_time.datetime = watch_utility_date_time_from_unix_time(timestamp, movement_get_current_timezone_offset());
+    if (timestamp != _local_date_time_cache.timestamp) {
+        if (timestamp == _local_date_time_cache.timestamp + 1 &&
+            _local_date_time_cache.timestamp != 0 &&
+            _local_date_time_cache.datetime.unit.second < 59) {
+            // the common case: clock faces ask once a second. ticking the seconds
+            // field forward is all it takes; the full unix-to-civil conversion only
+            // runs at the top of the minute (which also picks up any offset change
+            // the DST cache refresh made, since that lands on a minute boundary).
+            _local_date_time_cache.datetime.unit.second++;
+        } else {
+            _local_date_time_cache.datetime = watch_utility_date_time_from_unix_time(timestamp, movement_get_current_timezone_offset());
+        }
+        _local_date_time_cache.timestamp = timestamp;
     }
 
-    return cached_date_time.datetime;
+    return _local_date_time_cache.datetime;
 }
 
 uint32_t movement_get_utc_timestamp(void) {
     return watch_rtc_get_unix_time();
 }
 
+uint32_t movement_get_local_epoch_day(void) {
+    // Day-count faces only care about the calendar date, which changes once at
+    // local midnight; cache on the date bits of the packed register so repeated
+    // calls within a day cost a shift and a compare.
+    static struct {
+        uint32_t date_bits;
+        uint32_t epoch_day;
+    } cache;
+
+    watch_date_time_t date_time = movement_get_local_date_time();
+    uint32_t date_bits = date_time.reg >> 17;   // year, month and day fields only
+
+    if (date_bits != cache.date_bits) {
+        cache.date_bits = date_bits;
+        cache.epoch_day = watch_utility_convert_to_epoch_day(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day);
+    }
+
+    return cache.epoch_day;
+}
+
 void movement_set_utc_date_time(watch_date_time_t date_time) {
     movement_set_utc_timestamp(watch_utility_date_time_to_unix_time(date_time, 0));
 }
@@ -713,6 +1741,10 @@ void movement_set_utc_timestamp(uint32_t timestamp) {
     // If the time was changed, the top of the minute alarm needs to be reset accordingly
     _movement_set_top_of_minute_alarm();
 
+    // scheduled background task deadlines are expressed as date/times, so their
+    // comparison counter needs to move along with the clock
+    _movement_arm_background_task_comp();
+
     // this may seem wasteful, but if the user's local time is in a zone that observes DST,
     // they may have just crossed a DST boundary, which means the next call to this function
     // could require a different offset to force local time back to UTC. Quelle horreur!
@@ -805,12 +1837,15 @@ void movement_set_backlight_dwell(uint8_t value) {
     movement_state.settings.bit.led_duration = value;
 }
 
+// Shadow of the settings word as last loaded from or stored to the filesystem. Storing
+// compares against this in RAM instead of re-reading the file, so unchanged settings
+// cost nothing and set-then-revert churn collapses to no write at all.
+static movement_settings_t _stored_settings;
+
 void movement_store_settings(void) {
-    movement_settings_t old_settings;
-    filesystem_read_file("settings.u32", (char *)&old_settings, sizeof(movement_settings_t));
-    if (movement_state.settings.reg != old_settings.reg) {
-        filesystem_write_file("settings.u32", (char *)&movement_state.settings, sizeof(movement_settings_t));
-    }
+    if (movement_state.settings.reg == _stored_settings.reg) return;
+    _stored_settings.reg = movement_state.settings.reg;
+    filesystem_write_file_deferred("settings.u32", (char *)&movement_state.settings, sizeof(movement_settings_t));
 }
 
 bool movement_alarm_enabled(void) {
@@ -821,6 +1856,21 @@ void movement_set_alarm_enabled(bool value) {
     movement_state.alarm_enabled = value;
 }
 
+bool movement_start_motion_capture_session(void) {
+    if (!movement_state.has_lis2dw) return false;
+    _motion_capture_count = 0;
+    _motion_capture_active = true;
+    return true;
+}
+
+void movement_stop_motion_capture_session(void) {
+    _motion_capture_active = false;
+}
+
+uint32_t movement_get_motion_capture_count(void) {
+    return _motion_capture_count;
+}
+
 bool movement_enable_tap_detection_if_available(void) {
     if (movement_state.has_lis2dw) {
         // configure tap duration threshold and enable Z axis
@@ -861,6 +1911,11 @@ bool movement_disable_tap_detection_if_available(void) {
     return false;
 }
 
+bool movement_wearer_is_active(void) {
+    if (!movement_state.has_lis2dw) return false;
+    return !movement_volatile_state.wearer_is_stationary;
+}
+
 lis2dw_data_rate_t movement_get_accelerometer_background_rate(void) {
     if (movement_state.has_lis2dw) return movement_state.accelerometer_background_rate;
     else return LIS2DW_DATA_RATE_POWERDOWN;
@@ -899,6 +1954,9 @@ bool movement_set_accelerometer_motion_threshold(uint8_t new_threshold) {
 
 float movement_get_temperature(void) {
     float temperature_c = (float)0xFFFFFFFF;
+    // if we're in a background-task pass and another face already took a reading,
+    // hand back the shared sample instead of bringing the sensor up again.
+    if (_sensor_window_open && _sensor_window_has_temperature) return _sensor_window_temperature;
 #if __EMSCRIPTEN__
     temperature_c = EM_ASM_DOUBLE({
         return temp_c || 25.0;
@@ -916,18 +1974,107 @@ float movement_get_temperature(void) {
     }
 #endif
 
+    if (_sensor_window_open) {
+        _sensor_window_temperature = temperature_c;
+        _sensor_window_has_temperature = true;
+    }
+
+    if (temperature_c != (float)0xFFFFFFFF) {
+        _sensor_last_temperature = temperature_c;
+        _sensor_last_temperature_time = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+        _sensor_has_last_temperature = true;
+    }
+
     return temperature_c;
 }
 
+float movement_get_cached_temperature(uint32_t *age_seconds) {
+    if (!_sensor_has_last_temperature) return (float)0xFFFFFFFF;
+    if (age_seconds) {
+        *age_seconds = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0)
+                     - _sensor_last_temperature_time;
+    }
+    return _sensor_last_temperature;
+}
+
+bool movement_register_idle_task(movement_idle_task_fn task, movement_idle_priority_t priority) {
+    if (task == NULL) return false;
+    // idempotent: registering the same task again is a no-op
+    for (uint8_t i = 0; i < _idle_task_count; i++) {
+        if (_idle_tasks[i].fn == task) return true;
+    }
+    if (_idle_task_count >= MOVEMENT_MAX_IDLE_TASKS) return false;
+    // insert sorted by priority, so a window just walks the table front to back
+    uint8_t pos = _idle_task_count;
+    while (pos > 0 && _idle_tasks[pos - 1].priority > priority) {
+        _idle_tasks[pos] = _idle_tasks[pos - 1];
+        pos--;
+    }
+    _idle_tasks[pos].fn = task;
+    _idle_tasks[pos].priority = priority;
+    _idle_task_count++;
+    return true;
+}
+
+static void _movement_run_idle_window(void) {
+    rtc_counter_t start = watch_rtc_get_counter();
+    bool runnable[MOVEMENT_MAX_IDLE_TASKS];
+    bool more;
+
+    for (uint8_t i = 0; i < _idle_task_count; i++) runnable[i] = true;
+    _idle_work_pending = false;
+
+    do {
+        more = false;
+        for (uint8_t i = 0; i < _idle_task_count; i++) {
+            if (!runnable[i]) continue;
+            if ((rtc_counter_t)(watch_rtc_get_counter() - start) >= MOVEMENT_IDLE_WINDOW_TICKS) {
+                // out of budget; the remainder runs at the next minute wake
+                _idle_work_pending = true;
+                return;
+            }
+            runnable[i] = _idle_tasks[i].fn();
+            if (runnable[i]) more = true;
+        }
+    } while (more);
+}
+
+// Built-in idle jobs, registered at app_init: commit anything buffered before a
+// long quiet stretch, then let littlefs do its housekeeping while nobody waits.
+static bool _idle_task_commit_storage(void) {
+    // buffered log appends and deferred writes first; settings changes a face
+    // forgot to store ride along too.
+    movement_store_settings();
+    filesystem_flush();
+    filesystem_sync();
+    return false;
+}
+
+static bool _idle_task_filesystem_maintenance(void) {
+    // with everything committed, littlefs reclaims blocks now instead of inside
+    // some future logging append. No-op if nothing was written since last time.
+    filesystem_perform_maintenance();
+    return false;
+}
+
 void app_init(void) {
+    watch_boot_trace_mark(WATCH_BOOT_PHASE_RESET);
     _watch_init();
 
+    watch_fault_init();
     filesystem_init();
+    watch_boot_trace_mark(WATCH_BOOT_PHASE_FILESYSTEM);
+    // if a boot.cmd script is on the filesystem, the shell runs it a line at a
+    // time once the app loop starts turning.
+    shell_schedule_boot_script();
 
     // check if we are plugged into USB power.
     HAL_GPIO_VBUS_DET_in();
     HAL_GPIO_VBUS_DET_pulldown();
-    delay_ms(100);
+    // the pulldown settles in microseconds; 25 ms is margin for a slow VBUS
+    // ramp, and trimming the old 100 ms wait here shaves boot (and every
+    // enumeration cycle on the provisioning rig) by 75 ms.
+    delay_ms(25);
     if (HAL_GPIO_VBUS_DET_read()){
         /// if so, enable USB functionality.
         _watch_enable_usb();
@@ -937,6 +2084,9 @@ void app_init(void) {
     memset((void *)&movement_state, 0, sizeof(movement_state));
 
     movement_volatile_state.pending_events = 0;
+    movement_volatile_state.pending_passthrough_actions = 0;
+    _movement_event_queue_head = 0;
+    _movement_event_queue_tail = 0;
     movement_volatile_state.turn_led_off = false;
 
     movement_volatile_state.minute_alarm_fired = false;
@@ -947,9 +2097,21 @@ void app_init(void) {
     movement_volatile_state.has_pending_sequence = false;
     movement_volatile_state.has_pending_accelerometer = false;
     movement_volatile_state.is_sleeping = false;
+    movement_volatile_state.le_seconds_ticking = false;
 
     movement_volatile_state.is_buzzing = false;
     movement_volatile_state.pending_sequence_priority = 0;
+    _sequence_queue_depth = 0;
+    _sequence_preempting = false;
+    _resleep_when_quiet = false;
+
+    _idle_task_count = 0;
+    _idle_work_pending = false;
+
+    memset(_tick_claims, 0, sizeof(_tick_claims));
+    _face_tick_request = 1;
+    movement_register_idle_task(_idle_task_commit_storage, MOVEMENT_IDLE_PRIORITY_COMMIT);
+    movement_register_idle_task(_idle_task_filesystem_maintenance, MOVEMENT_IDLE_PRIORITY_MAINTENANCE);
 
     movement_volatile_state.mode_button.down_event = EVENT_MODE_BUTTON_DOWN;
     movement_volatile_state.mode_button.is_down = false;
@@ -971,16 +2133,21 @@ void app_init(void) {
 
     movement_state.has_thermistor = thermistor_driver_init();
 
-    bool settings_file_exists = filesystem_file_exists("settings.u32");
+    // load the settings blob once here; everything after this runs against the RAM copy,
+    // and movement_store_settings writes it back as a single update only if it changed.
+    bool settings_loaded = false;
     movement_settings_t maybe_settings;
-    if (settings_file_exists && maybe_settings.bit.version == 0) {
+    if (filesystem_file_exists("settings.u32")) {
         filesystem_read_file("settings.u32", (char *) &maybe_settings, sizeof(movement_settings_t));
+        if (maybe_settings.bit.version == 0) {
+            // the stored blob has a version we understand: restore it!
+            movement_state.settings.reg = maybe_settings.reg;
+            _stored_settings.reg = maybe_settings.reg;
+            settings_loaded = true;
+        }
     }
 
-    if (settings_file_exists && maybe_settings.bit.version == 0) {
-        // If settings file exists and has a valid version, restore it!
-        movement_state.settings.reg = maybe_settings.reg;
-    } else {
+    if (!settings_loaded) {
         // Otherwise set default values.
         movement_state.settings.bit.version = 0;
         movement_state.settings.bit.clock_mode_24h = MOVEMENT_DEFAULT_24H_MODE;
@@ -1015,6 +2182,7 @@ void app_init(void) {
 
         movement_store_settings();
     }
+    watch_boot_trace_mark(WATCH_BOOT_PHASE_SETTINGS);
 
     watch_date_time_t date_time = watch_rtc_get_date_time();
     if (date_time.reg == 0) {
@@ -1033,10 +2201,22 @@ void app_init(void) {
 
     if (movement_state.accelerometer_motion_threshold == 0) movement_state.accelerometer_motion_threshold = 32;
 
+    // no backup registers are claimed yet; this must be cleared before anything
+    // calls movement_claim_backup_register or its tagged sibling.
+    movement_state.backup_register_claims = 0;
+
+#if !defined(FORCE_CUSTOM_LCD_TYPE) && !defined(FORCE_CLASSIC_LCD_TYPE)
+    // On autodetect builds, claim a backup register so the LCD probe result survives
+    // resets and warm boots skip the blocking detection entirely.
+    watch_enable_lcd_type_cache(movement_claim_backup_register());
+#endif
+
     movement_state.signal_volume = MOVEMENT_DEFAULT_SIGNAL_VOLUME;
     movement_state.alarm_volume = MOVEMENT_DEFAULT_ALARM_VOLUME;
     movement_state.light_on = false;
-    movement_state.next_available_backup_register = 2;
+    _movement_le_adapt_restore();
+    // take a first VCC reading so a watch booting on a low cell starts degraded.
+    _movement_power_policy_update();
     _movement_reset_inactivity_countdown();
 
     // set up the 1 minute alarm (for background tasks and low power updates)
@@ -1052,6 +2232,10 @@ void app_setup(void) {
     static bool is_first_launch = true;
 
     if (is_first_launch) {
+        // paint the unused stack so high-water checks have a baseline; nothing
+        // deep has run yet, so nearly the whole stack gets painted.
+        watch_stack_paint();
+
         #ifdef MOVEMENT_CUSTOM_BOOT_COMMANDS
         MOVEMENT_CUSTOM_BOOT_COMMANDS()
         #endif
@@ -1059,6 +2243,7 @@ void app_setup(void) {
         for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
             watch_face_contexts[i] = NULL;
             scheduled_tasks[i].reg = 0;
+            if (watch_faces[i].advise != NULL) _advisory_face_mask |= (uint64_t)1 << i;
             is_first_launch = false;
         }
 
@@ -1077,6 +2262,7 @@ void app_setup(void) {
 
     // LCD autodetect uses the buttons as a a failsafe, so we should run it before we enable the button interrupts
     watch_enable_display();
+    watch_boot_trace_mark(WATCH_BOOT_PHASE_DISPLAY);
 
     if (!movement_volatile_state.is_sleeping) {
         watch_disable_extwake_interrupt(HAL_GPIO_BTN_ALARM_pin());
@@ -1106,10 +2292,11 @@ void app_setup(void) {
             lis2dw_set_mode(LIS2DW_MODE_LOW_POWER);         // select low power (not high performance) mode
             lis2dw_set_low_power_mode(LIS2DW_LP_MODE_1);    // lowest power mode, 12-bit
             lis2dw_set_low_noise_mode(false);               // low noise mode raises power consumption slightly; we don't need it
-            lis2dw_enable_stationary_motion_detection();    // stationary/motion detection mode keeps the data rate at 1.6 Hz even in sleep
             lis2dw_set_range(LIS2DW_RANGE_2_G);             // Application note AN5038 recommends 2g range
-            lis2dw_enable_sleep();                          // allow acceleromter to sleep and wake on activity
-            lis2dw_configure_wakeup_threshold(movement_state.accelerometer_motion_threshold); // g threshold to wake up: (THS * FS / 64) where FS is "full scale" of ±2g.
+            // hardware activity engine: stationary/motion detection, sleep state machine and
+            // wakeup threshold (THS * FS / 64 where FS is "full scale" of ±2g), classified
+            // state routed to INT2.
+            lis2dw_configure_activity_detection(movement_state.accelerometer_motion_threshold);
             lis2dw_configure_6d_threshold(3);               // 0-3 is 80, 70, 60, or 50 degrees. 50 is least precise, hopefully most sensitive?
 
             // set up interrupts:
@@ -1120,10 +2307,15 @@ void app_setup(void) {
             // lis2dw_configure_int1(LIS2DW_CTRL4_INT1_6D);
             // HAL_GPIO_A3_in();
 
-            // next: INT2 is wired to pin A4. We'll configure the accelerometer to output the sleep state on INT2.
-            // a falling edge on INT2 indicates the accelerometer has woken up.
-            lis2dw_configure_int2(LIS2DW_CTRL5_INT2_SLEEP_STATE | LIS2DW_CTRL5_INT2_SLEEP_CHG);
+            // next: INT2 is wired to pin A4 and carries the sleep state (configured above):
+            // high when the wearer is stationary, low when active. Watch both edges so
+            // activity classification happens entirely in the accelerometer and reaches
+            // us as transitions, with no polling.
             HAL_GPIO_A4_in();
+            // the accelerometer drives its interrupt lines push-pull, so skip the input
+            // filter and take the edges asynchronously.
+            watch_register_interrupt_callback_with_filter(HAL_GPIO_A4_pin(), cb_accelerometer_motion_change, INTERRUPT_TRIGGER_BOTH, WATCH_INTERRUPT_FILTER_ASYNC);
+            movement_volatile_state.wearer_is_stationary = HAL_GPIO_A4_read();
 
             // Wake on motion seemed like a good idea when the threshold was lower, but the UX makes less sense now.
             // Still if you want to wake on motion, you can do it by uncommenting this line:
@@ -1131,7 +2323,7 @@ void app_setup(void) {
 
             // later on, we are going to use INT1 for tap detection. We'll set up that interrupt here,
             // but it will only fire once tap recognition is enabled.
-            watch_register_interrupt_callback(HAL_GPIO_A3_pin(), cb_accelerometer_event, INTERRUPT_TRIGGER_RISING);
+            watch_register_interrupt_callback_with_filter(HAL_GPIO_A3_pin(), cb_accelerometer_event, INTERRUPT_TRIGGER_RISING, WATCH_INTERRUPT_FILTER_ASYNC);
 
             // Enable the interrupts...
             lis2dw_enable_interrupts();
@@ -1148,16 +2340,44 @@ void app_setup(void) {
         movement_request_tick_frequency(1);
 
         for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-            watch_faces[i].setup(i, &watch_face_contexts[i]);
+            _face_needs_setup[i] = true;
         }
 
+        // If the last shutdown was movement_enter_backup_mode, pick up where we left
+        // off: restore the active face index and hand opted-in faces their snapshots.
+        _movement_restore_snapshot();
+
+        // Only the active face needs its setup to run right now; the rest are set up
+        // on demand when they are first activated or asked for background work.
+        _movement_ensure_face_setup(movement_state.current_face_idx);
+
         watch_faces[movement_state.current_face_idx].activate(watch_face_contexts[movement_state.current_face_idx]);
-        movement_volatile_state.pending_events |=  1 << EVENT_ACTIVATE;
+        // main-thread push: keep a button or tick ISR from landing mid-write.
+        _movement_critical_enter();
+        _movement_push_event(EVENT_ACTIVATE);
+        _movement_critical_exit();
+        watch_boot_trace_mark(WATCH_BOOT_PHASE_FACE_SETUP);
     }
 }
 
 #ifndef MOVEMENT_LOW_ENERGY_MODE_FORBIDDEN
 
+static void cb_le_seconds_tick(void) {
+    // called from the RTC interrupt once a second while asleep: repaint just
+    // the seconds digits through the low-power seconds path. seconds are the
+    // same in every time zone, so we can skip the local time conversion.
+    watch_display_seconds(watch_rtc_get_date_time().unit.second);
+}
+
+static bool _le_seconds_wake_needed(void) {
+    // anything the mini-runloop below needs a pass for: a wake request, a
+    // scheduled task, the top-of-minute alarm, or a chime waiting to start.
+    return movement_volatile_state.exit_sleep_mode
+        || movement_volatile_state.background_task_due
+        || movement_volatile_state.minute_alarm_fired
+        || movement_volatile_state.has_pending_sequence;
+}
+
 static void _sleep_mode_app_loop(void) {
     // as long as we are in low energy mode, we wake up here, update the screen, and go right back to sleep.
     while (movement_volatile_state.is_sleeping) {
@@ -1165,10 +2385,18 @@ static void _sleep_mode_app_loop(void) {
         if (movement_volatile_state.exit_sleep_mode) {
             movement_volatile_state.exit_sleep_mode = false;
             movement_volatile_state.is_sleeping = false;
+            movement_volatile_state.le_seconds_ticking = false;
 
             return;
         }
 
+        // scheduled background tasks fire here too, from their own comparison; a
+        // running timer no longer has to keep the watch out of low energy mode.
+        if (movement_volatile_state.background_task_due) {
+            movement_volatile_state.background_task_due = false;
+            _movement_handle_scheduled_tasks();
+        }
+
         // we also have to handle top-of-the-minute tasks here in the mini-runloop
         if (movement_volatile_state.minute_alarm_fired) {
             movement_volatile_state.minute_alarm_fired = false;
@@ -1176,15 +2404,37 @@ static void _sleep_mode_app_loop(void) {
             _movement_handle_top_of_minute();
         }
 
+        // finish idle work whose window ran out of budget at low energy entry;
+        // a wake source has the CPU up anyway.
+        if (_idle_work_pending) _movement_run_idle_window();
+
+        // A sequence scheduled while sleeping (the hourly chime, a scheduled alarm)
+        // used to force a wake through the entire app stack just to reach the buzzer.
+        // TC0 and the buzzer TCC both run in standby, so start the tune right here;
+        // the full wake only happens if a button press follows.
+        if (movement_volatile_state.has_pending_sequence) {
+            movement_volatile_state.has_pending_sequence = false;
+            movement_sequence_slot_t next;
+            // masked: the done callback of a tune already playing dequeues from
+            // TC0 interrupt context and must not shift the queue underneath us.
+            _movement_critical_enter();
+            if (_movement_sequence_dequeue(&next)) {
+                // once started, the sequencer drains any remaining entries itself
+                _movement_start_sequence(next.sequence, next.priority);
+            }
+            _movement_critical_exit();
+        }
+
         movement_event_t event;
         event.event_type = EVENT_LOW_ENERGY_UPDATE;
         event.subsecond = 0;
-        watch_faces[movement_state.current_face_idx].loop(event, watch_face_contexts[movement_state.current_face_idx]);
+        _movement_face_loop(movement_state.current_face_idx, event, watch_face_contexts[movement_state.current_face_idx]);
 
         // If any of the previous loops requested to wake up, do it!
         if (movement_volatile_state.exit_sleep_mode) {
             movement_volatile_state.exit_sleep_mode = false;
             movement_volatile_state.is_sleeping = false;
+            movement_volatile_state.le_seconds_ticking = false;
 
             return;
         }
@@ -1196,7 +2446,19 @@ static void _sleep_mode_app_loop(void) {
         }
 
         // otherwise enter sleep mode, until either the top of the minute interrupt or extwake wakes us up.
-        watch_enter_sleep_mode();
+        if (movement_volatile_state.is_buzzing) {
+            // a chime is sounding off TC0 and the TCC in standby; skip the usual
+            // peripheral teardown so it keeps playing. Each note boundary wakes us
+            // briefly, and the next pass re-enters full sleep once the tune ends.
+            watch_enter_standby_mode();
+        } else if (movement_volatile_state.le_seconds_ticking) {
+            // the active face asked to keep the seconds digits live: each 1 Hz
+            // interrupt repaints two digits, and the full wake path runs only
+            // once a real wake source leaves a flag for the loop above.
+            watch_enter_sleep_mode_keep_seconds(cb_le_seconds_tick, _le_seconds_wake_needed);
+        } else {
+            watch_enter_sleep_mode();
+        }
     }
 }
 
@@ -1206,9 +2468,12 @@ static bool _switch_face(void) {
     const watch_face_t *wf = &watch_faces[movement_state.current_face_idx];
 
     wf->resign(watch_face_contexts[movement_state.current_face_idx]);
+    _movement_release_face_tick_claims(movement_state.current_face_idx);
     movement_state.current_face_idx = movement_state.next_face_idx;
+    watch_fault_set_context(movement_state.current_face_idx);
     // we have just updated the face idx, so we must recache the watch face pointer.
     wf = &watch_faces[movement_state.current_face_idx];
+    _movement_ensure_face_setup(movement_state.current_face_idx);
     watch_clear_display();
     movement_request_tick_frequency(1);
 
@@ -1223,7 +2488,7 @@ static bool _switch_face(void) {
     event.subsecond = 0;
     event.event_type = EVENT_ACTIVATE;
     movement_state.watch_face_changed = false;
-    bool can_sleep = wf->loop(event, watch_face_contexts[movement_state.current_face_idx]);
+    bool can_sleep = _movement_face_loop(movement_state.current_face_idx, event, watch_face_contexts[movement_state.current_face_idx]);
 
     // Button events that follow a down event that happened on the previous face should not be forwarded to the new face
     movement_volatile_state.passthrough_events = _movement_button_events_mask;
@@ -1232,7 +2497,7 @@ static bool _switch_face(void) {
 }
 
 bool app_loop(void) {
-    const watch_face_t *wf = &watch_faces[movement_state.current_face_idx];
+    rtc_counter_t wake_start = watch_rtc_get_counter();
 
     // default to being allowed to sleep by the face.
     bool can_sleep = true;
@@ -1259,60 +2524,72 @@ bool app_loop(void) {
 
     if (movement_volatile_state.has_pending_accelerometer) {
         movement_volatile_state.has_pending_accelerometer = false;
-        pending_events |= _movement_get_accelerometer_events();
+        _movement_push_accelerometer_events();
     }
 
     // handle any button up/down events that occurred, e.g. schedule longpress timeouts, reset inactivity, etc.
     _movement_handle_button_presses(pending_events);
 
-    // if we have a scheduled background task, handle that here:
-    if (
-        (pending_events & (1 << EVENT_TICK))
-        && event.subsecond == 0
-        && movement_state.has_scheduled_background_task
-    ) {
+    // if a scheduled background task's comparison fired, dispatch it here:
+    if (movement_volatile_state.background_task_due) {
+        movement_volatile_state.background_task_due = false;
         _movement_handle_scheduled_tasks();
     }
 
     // Pop the EVENT_TIMEOUT out of the pending_events so it can be handled separately
     bool resign_timeout = (pending_events & (1 << EVENT_TIMEOUT)) != 0;
-    if (resign_timeout) {
-        pending_events &= ~(1 << EVENT_TIMEOUT);
-    }
 
-    // Consume all the pending events
-    uint32_t passthrough_pending_events = pending_events & movement_volatile_state.passthrough_events;
-    pending_events = pending_events & ~movement_volatile_state.passthrough_events;
-
-    movement_event_type_t event_type = 0;
-    while (passthrough_pending_events) {
-        uint8_t next_event = __builtin_ctz(passthrough_pending_events);
-        event.event_type = event_type + next_event;
+    // Handle passthrough button actions that were routed around the face dispatch path
+    // in the ISR; only the minimal default handler runs for these.
+    uint32_t passthrough_actions = movement_volatile_state.pending_passthrough_actions;
+    movement_volatile_state.pending_passthrough_actions = 0;
+    while (passthrough_actions) {
+        uint8_t event_type = __builtin_ctz(passthrough_actions);
+        passthrough_actions &= passthrough_actions - 1;
+        event.event_type = event_type;
         can_sleep = movement_default_loop_handler(event) && can_sleep;
-        passthrough_pending_events = passthrough_pending_events >> (next_event + 1);
-        event_type = event_type + next_event + 1;
     }
 
-    event_type = 0;
-    while (pending_events) {
-        uint8_t next_event = __builtin_ctz(pending_events);
-        event.event_type = event_type + next_event;
-        can_sleep = wf->loop(event, watch_face_contexts[movement_state.current_face_idx]) && can_sleep;
-        pending_events = pending_events >> (next_event + 1);
-        event_type = event_type + next_event + 1;
+    // Drain the event queue in arrival order. Button events following a down event that
+    // happened on a previous face are routed to the default loop handler instead.
+    while (_movement_event_queue_tail != _movement_event_queue_head) {
+        uint8_t event_type = _movement_event_queue[_movement_event_queue_tail];
+        _movement_event_queue_tail = (_movement_event_queue_tail + 1) & (MOVEMENT_EVENT_QUEUE_SIZE - 1);
+
+        // EVENT_TIMEOUT is delivered separately, after the top-of-minute tasks below.
+        if (event_type == EVENT_TIMEOUT) continue;
+
+        event.event_type = event_type;
+        // let the face know whether more events are coming in this same pass, so it can
+        // batch state updates and redraw only on the last one.
+        _more_events_this_pass = (_movement_event_queue_tail != _movement_event_queue_head);
+        if (movement_volatile_state.passthrough_events & (1 << event_type)) {
+            can_sleep = movement_default_loop_handler(event) && can_sleep;
+        } else {
+            can_sleep = _movement_face_loop(movement_state.current_face_idx, event, watch_face_contexts[movement_state.current_face_idx]) && can_sleep;
+        }
     }
+    _more_events_this_pass = false;
 
     // handle top-of-minute tasks, if the alarm handler told us we need to
     if (movement_volatile_state.minute_alarm_fired) {
         movement_volatile_state.minute_alarm_fired = false;
         _movement_renew_top_of_minute_alarm();
         _movement_handle_top_of_minute();
+
+        // A tickless face still gets a minute-resolution tick, piggybacked on the
+        // minute alarm that fires anyway.
+        if (movement_state.tick_frequency == 0) {
+            event.event_type = EVENT_TICK;
+            event.subsecond = 0;
+            can_sleep = _movement_face_loop(movement_state.current_face_idx, event, watch_face_contexts[movement_state.current_face_idx]) && can_sleep;
+        }
     }
 
     // Now handle the EVENT_TIMEOUT
     if (resign_timeout && movement_state.current_face_idx != 0) {
         event.event_type = EVENT_TIMEOUT;
-        can_sleep = wf->loop(event, watch_face_contexts[movement_state.current_face_idx]) && can_sleep;
+        can_sleep = _movement_face_loop(movement_state.current_face_idx, event, watch_face_contexts[movement_state.current_face_idx]) && can_sleep;
     }
 
     // The watch_face_changed flag might be set again by the face loop, so check it again
@@ -1329,6 +2606,18 @@ bool app_loop(void) {
         // No need to fire resign and sleep interrupts while in sleep mode
         _movement_disable_inactivity_countdown();
 
+        // capture the last normal-mode frame before the face paints its sleep
+        // frame; the wake path puts it back while the face reactivates.
+        watch_display_snapshot();
+
+        // one idle window for all deferred background work: storage commit and
+        // littlefs maintenance first, then whatever else has registered.
+        _movement_run_idle_window();
+
+        // idle sweep: force-gate any serial bus whose clock was left running with
+        // no outstanding claims, so a leaky face can't add standing drain to sleep.
+        watch_gate_unclaimed_buses();
+
         watch_register_extwake_callback(HAL_GPIO_BTN_ALARM_pin(), cb_alarm_btn_extwake, true);
 
         // _sleep_mode_app_loop takes over at this point and loops until exit_sleep_mode is set by the extwake handler,
@@ -1336,6 +2625,12 @@ bool app_loop(void) {
         _sleep_mode_app_loop();
         // as soon as _sleep_mode_app_loop returns, we prepare to reactivate
 
+        // put the pre-sleep frame back immediately: the wearer sees the familiar
+        // face at SLCD refresh latency, and the active face's activate and first
+        // loop — which can take a while if they touch the filesystem or a sensor —
+        // repaint underneath it.
+        watch_display_restore_snapshot();
+
         // // this is a hack tho: waking from sleep mode, app_setup does get called, but it happens before we have reset our ticks.
         // // need to figure out if there's a better heuristic for determining how we woke up.
         app_setup();
@@ -1343,10 +2638,16 @@ bool app_loop(void) {
         // If we woke up to play a note sequence, actually play the note sequence we were asked to play while in deep sleep.
         if (movement_volatile_state.has_pending_sequence) {
             movement_volatile_state.has_pending_sequence = false;
-            watch_buzzer_play_sequence_with_volume(_pending_sequence, movement_request_sleep, _movement_get_buzzer_volume(movement_volatile_state.pending_sequence_priority));
-            // When this sequence is done playing, movement_request_sleep is invoked and the watch will go,
-            // back to sleep (unless the user interacts with it in the meantime)
-            _pending_sequence = NULL;
+            movement_sequence_slot_t next;
+            // masked: see the identical dequeue in the low energy loop above.
+            _movement_critical_enter();
+            if (_movement_sequence_dequeue(&next)) {
+                // When the queue runs dry, movement_request_sleep is invoked and the watch will go
+                // back to sleep (unless the user interacts with it in the meantime)
+                _resleep_when_quiet = true;
+                _movement_start_sequence(next.sequence, next.priority);
+            }
+            _movement_critical_exit();
         }
 
         // don't let the watch sleep when exiting deep sleep mode,
@@ -1364,8 +2665,10 @@ bool app_loop(void) {
 #if __EMSCRIPTEN__
     shell_task();
 #else
-    // if we are plugged into USB, handle the serial shell
-    if (usb_is_enabled()) {
+    // if we are plugged into USB, handle the serial shell. A pending boot
+    // script also gets shell passes, so provisioning commands run even before
+    // (or without) a USB connection.
+    if (usb_is_enabled() || shell_boot_script_pending()) {
         shell_task();
     }
 #endif
@@ -1376,10 +2679,22 @@ bool app_loop(void) {
         can_sleep = false;
     }
 
+    watch_boot_trace_mark(WATCH_BOOT_PHASE_FIRST_FRAME); // first pass wins; later marks are ignored
+
+    uint32_t wake_ticks = watch_rtc_get_counter() - wake_start;
+    _wake_stats.wake_count++;
+    _wake_stats.busy_ticks += wake_ticks;
+    _wake_stats.last_wake_ticks = wake_ticks;
+    if (wake_ticks > _wake_stats.max_wake_ticks) _wake_stats.max_wake_ticks = wake_ticks;
+
+#if __EMSCRIPTEN__
+    _movement_update_simulator_stats();
+#endif
+
     return can_sleep;
 }
 
-static movement_event_type_t _process_button_event(bool pin_level, movement_button_t* button) {
+WATCH_RAMFUNC static movement_event_type_t _process_button_event(bool pin_level, movement_button_t* button) {
     movement_event_type_t event_type = EVENT_NONE;
 
     // This shouldn't happen normally
@@ -1423,19 +2738,19 @@ static movement_event_type_t _process_button_event(bool pin_level, movement_butt
 void cb_light_btn_interrupt(void) {
     bool pin_level = HAL_GPIO_BTN_LIGHT_read();
 
-    movement_volatile_state.pending_events |= 1 << _process_button_event(pin_level, &movement_volatile_state.light_button);
+    _movement_push_button_event(_process_button_event(pin_level, &movement_volatile_state.light_button));
 }
 
 void cb_mode_btn_interrupt(void) {
     bool pin_level = HAL_GPIO_BTN_MODE_read();
 
-    movement_volatile_state.pending_events |= 1 << _process_button_event(pin_level, &movement_volatile_state.mode_button);
+    _movement_push_button_event(_process_button_event(pin_level, &movement_volatile_state.mode_button));
 }
 
 void cb_alarm_btn_interrupt(void) {
     bool pin_level = HAL_GPIO_BTN_ALARM_read();
 
-    movement_volatile_state.pending_events |= 1 << _process_button_event(pin_level, &movement_volatile_state.alarm_button);
+    _movement_push_button_event(_process_button_event(pin_level, &movement_volatile_state.alarm_button));
 }
 
 static movement_event_type_t _process_button_longpress_timeout(bool pin_level, movement_button_t* button) {
@@ -1477,21 +2792,21 @@ void cb_light_btn_timeout_interrupt(void) {
     bool pin_level = HAL_GPIO_BTN_LIGHT_read();
     movement_button_t* button = &movement_volatile_state.light_button;
 
-    movement_volatile_state.pending_events |= 1 << _process_button_longpress_timeout(pin_level, button);
+    _movement_push_button_event(_process_button_longpress_timeout(pin_level, button));
 }
 
 void cb_mode_btn_timeout_interrupt(void) {
     bool pin_level = HAL_GPIO_BTN_MODE_read();
     movement_button_t* button = &movement_volatile_state.mode_button;
 
-    movement_volatile_state.pending_events |= 1 << _process_button_longpress_timeout(pin_level, button);
+    _movement_push_button_event(_process_button_longpress_timeout(pin_level, button));
 }
 
 void cb_alarm_btn_timeout_interrupt(void) {
     bool pin_level = HAL_GPIO_BTN_ALARM_read();
     movement_button_t* button = &movement_volatile_state.alarm_button;
 
-    movement_volatile_state.pending_events |= 1 << _process_button_longpress_timeout(pin_level, button);
+    _movement_push_button_event(_process_button_longpress_timeout(pin_level, button));
 }
 
 void cb_led_timeout_interrupt(void) {
@@ -1499,7 +2814,7 @@ void cb_led_timeout_interrupt(void) {
 }
 
 void cb_resign_timeout_interrupt(void) {
-    movement_volatile_state.pending_events |= 1 << EVENT_TIMEOUT;
+    _movement_push_event(EVENT_TIMEOUT);
 }
 
 void cb_sleep_timeout_interrupt(void) {
@@ -1511,6 +2826,14 @@ void cb_alarm_btn_extwake(void) {
     movement_request_wake();
 }
 
+void cb_background_task_fired(void) {
+    movement_volatile_state.background_task_due = true;
+
+#if __EMSCRIPTEN__
+    _wake_up_simulator();
+#endif
+}
+
 void cb_minute_alarm_fired(void) {
     movement_volatile_state.minute_alarm_fired = true;
 
@@ -1524,7 +2847,7 @@ void cb_tick(void) {
     uint32_t freq = watch_rtc_get_frequency();
     uint32_t half_freq = freq >> 1;
     uint32_t subsecond_mask = freq - 1;
-    movement_volatile_state.pending_events |= 1 << EVENT_TICK;
+    _movement_push_event(EVENT_TICK);
     movement_volatile_state.subsecond = ((counter + half_freq) & subsecond_mask) >> movement_state.tick_pern;
 }
 
@@ -1532,8 +2855,17 @@ void cb_accelerometer_event(void) {
     movement_volatile_state.has_pending_accelerometer = true;
 }
 
+void cb_accelerometer_motion_change(void) {
+    // INT2 level is the accelerometer's sleep state: high = stationary, low = active.
+    bool stationary = HAL_GPIO_A4_read();
+    movement_volatile_state.wearer_is_stationary = stationary;
+    // each burst of motion out of the stationary state counts once per session
+    if (!stationary && _motion_capture_active) _motion_capture_count++;
+    _movement_push_event(stationary ? EVENT_ACCELEROMETER_SLEEP : EVENT_ACCELEROMETER_WAKE);
+}
+
 void cb_accelerometer_wake(void) {
-    movement_volatile_state.pending_events |= 1 << EVENT_ACCELEROMETER_WAKE;
+    _movement_push_event(EVENT_ACCELEROMETER_WAKE);
     // also: wake up!
     _movement_reset_inactivity_countdown();
 }
@@ -137,6 +137,7 @@ typedef enum {
     // EVENT_ALARM_REALLY_LONG_UP, // The alarm button was held for more than 1.5 second, and released.
 
     EVENT_ACCELEROMETER_WAKE,   // The accelerometer has detected motion and woken up.
+    EVENT_ACCELEROMETER_SLEEP,  // The accelerometer's activity engine classified the wearer as stationary.
     EVENT_SINGLE_TAP,           // Accelerometer detected a single tap. This event is not yet implemented.
     EVENT_DOUBLE_TAP,           // Accelerometer detected a double tap. This event is not yet implemented.
 } movement_event_type_t;
@@ -150,6 +151,7 @@ typedef enum {
     RESIGN_TIMEOUT,             // Resign active face timeout
     SLEEP_TIMEOUT,              // Low-energy begin timeout
     MINUTE_TIMEOUT,             // Top of the Minute timeout
+    BACKGROUND_TASK_TIMEOUT,    // Earliest scheduled background task deadline
 } movement_timeout_index_t;
 
 typedef enum {
@@ -258,12 +260,44 @@ typedef void (*watch_face_resign)(void *context);
   */
 typedef movement_watch_face_advisory_t (*watch_face_advise)(void *context);
 
+/// The most bytes a face's serialize function may write. Snapshots are meant to be
+/// compact distillations (an index, a count, a target), not raw context dumps.
+#define MOVEMENT_FACE_SNAPSHOT_SIZE 32
+
+/** @brief OPTIONAL. Write a compact snapshot of your state before BACKUP sleep.
+  * @details BACKUP mode powers down the RAM, so face contexts do not survive it. If your
+  *          face has state worth keeping across shelf or night storage (a counter value,
+  *          an interval selection), serialize the essentials here and Movement will hand
+  *          them back to your deserialize function on the wake after BACKUP. Only store
+  *          what you can't recompute: the snapshot lives in the filesystem and is written
+  *          on every entry into BACKUP mode.
+  * @param context A pointer to your application's context. @see watch_face_setup.
+  * @param buffer The buffer to write your snapshot into.
+  * @param size The size of the buffer, at most MOVEMENT_FACE_SNAPSHOT_SIZE.
+  * @return The number of bytes written, or 0 if there is nothing worth saving.
+  */
+typedef uint8_t (*watch_face_serialize)(void *context, uint8_t *buffer, uint8_t size);
+
+/** @brief OPTIONAL. Restore state from a snapshot written by your serialize function.
+  * @details Called at boot after your setup function, with the bytes your serialize
+  *          function wrote before the watch entered BACKUP mode. Validate the contents
+  *          as you would any stored data; a firmware update may have changed your layout.
+  * @param context A pointer to your application's context. @see watch_face_setup.
+  * @param buffer The snapshot bytes.
+  * @param length The number of bytes your serialize function wrote.
+  */
+typedef void (*watch_face_deserialize)(void *context, const uint8_t *buffer, uint8_t length);
+
 typedef struct {
     watch_face_setup setup;
     watch_face_activate activate;
     watch_face_loop loop;
     watch_face_resign resign;
     watch_face_advise advise;
+    // optional: snapshot support for fast resume from BACKUP mode. Faces that omit
+    // these fields (every face macro with five initializers) simply start fresh.
+    watch_face_serialize serialize;
+    watch_face_deserialize deserialize;
 } watch_face_t;
 
 typedef struct {
@@ -285,7 +319,7 @@ typedef struct {
     uint8_t tick_pern;
 
     // backup register stuff
-    uint8_t next_available_backup_register;
+    uint8_t backup_register_claims;
 
     // temporary alarm enabled boolean, until we implement this in advisories
     bool alarm_enabled;
@@ -305,19 +339,108 @@ typedef struct {
     watch_buzzer_volume_t alarm_volume;
 } movement_state_t;
 
+/** @brief Allocate persistent storage for a watch face context.
+  * @details Call this from your setup function instead of malloc. Contexts live for the
+  *          lifetime of the firmware and are never freed, so they are carved out of a
+  *          fixed arena with a simple bump allocator; this avoids dragging in the heap
+  *          and its per-allocation overhead for a few dozen small one-shot allocations.
+  *          If the arena is exhausted (a build with many heavyweight faces), this falls
+  *          back to malloc; raise MOVEMENT_FACE_CONTEXT_ARENA_SIZE in movement_config.h
+  *          to size the arena for your face list.
+  * @param size The size of your context struct, e.g. sizeof(clock_state_t).
+  */
+void *movement_face_context_alloc(size_t size);
+
+/// Per-wake CPU time accounting, timed against the RTC counter. One "wake" is one pass
+/// through app_loop. Resolution is one RTC tick (1/1024 s at the default prescaler), so
+/// individual short passes may count as zero; totals are meaningful in aggregate.
+/// Surface these from the shell with the `cpustat` command.
+typedef struct {
+    uint32_t wake_count;      // app_loop passes since boot or last reset
+    uint32_t busy_ticks;      // total RTC ticks spent inside app_loop
+    uint32_t max_wake_ticks;  // RTC ticks of the longest single pass
+    uint32_t last_wake_ticks; // RTC ticks of the most recent pass
+    uint32_t start_counter;   // RTC counter when the stats were last reset (0 at boot)
+} movement_wake_stats_t;
+
+void movement_get_wake_stats(movement_wake_stats_t *stats);
+void movement_reset_wake_stats(void);
+
+/// The number of faces in this build, for shell commands that iterate over them.
+uint8_t movement_get_face_count(void);
+
+/// The deepest stack usage in bytes observed after any of this face's loop invocations,
+/// or 0 if the face has never run (or on the simulator, which doesn't track the stack).
+uint16_t movement_get_face_stack_high_water(uint8_t watch_face_index);
+
+/// Per-face deadline accounting: how many loop invocations ran longer than the tick
+/// period they were serving (so events queued behind them), and the longest single
+/// loop seen, in RTC ticks. Resolution is one RTC tick, so short loops read as zero;
+/// the overrun count is the number to watch. Cleared by movement_reset_wake_stats;
+/// surfaced from the shell with `cpustat`.
+void movement_get_face_loop_stats(uint8_t watch_face_index, uint16_t *overruns, uint16_t *max_ticks);
+
 void movement_move_to_face(uint8_t watch_face_index);
 void movement_move_to_next_face(void);
 
 bool movement_default_loop_handler(movement_event_t event);
 
+/** @brief During a loop callback, returns true if Movement will deliver more queued
+  *        events to your face within this same loop pass (e.g. a button-down, a tick
+  *        and a button-up that all landed between wakes). Faces with expensive redraws
+  *        can apply each event's state change and defer drawing until this returns
+  *        false, so a burst of events costs one LCD update instead of several.
+  *        Outside of a loop callback the return value is meaningless.
+  */
+bool movement_more_events_this_pass(void);
+
 void movement_illuminate_led(void);
+
+/** @brief Publishes an ambient light reading for the LED brightness scaler.
+  * @details movement_illuminate_led scales its PWM duty from the most recent published
+  *          reading — full configured brightness in daylight, down to roughly a fifth in
+  *          the dark, where a dimmer light reads just as well and the LED's current spike
+  *          hurts most. The LED path never starts a conversion itself; whatever samples
+  *          the light sensor (a face, an idle task) should publish each result here.
+  *          Readings expire after five minutes, and boards that never publish get full
+  *          brightness, so this is always safe to leave unused.
+  * @param lux The measured ambient illuminance in lux.
+  */
+void movement_set_ambient_light(uint32_t lux);
 void movement_force_led_on(uint8_t red, uint8_t green, uint8_t blue);
 void movement_force_led_off(void);
 
 void movement_request_tick_frequency(uint8_t freq);
 
+/// A tick-frequency claim token returned by movement_claim_tick_frequency; 0 is invalid.
+typedef uint8_t movement_tick_claim_t;
+
+/** @brief Claims a minimum tick frequency, stacked on top of the face's requested rate.
+  * @details movement_request_tick_frequency is last-writer-wins, which is right for a
+  *          face picking its display rate but wrong for anything transient: a fast rate
+  *          requested around some interaction could leak and leave the watch ticking at
+  *          8 Hz indefinitely. A claim instead registers a need: the effective rate is
+  *          always the maximum of the face's requested rate and every outstanding claim,
+  *          and drops back automatically when claims are released. Claims are owned by
+  *          the face in the foreground when they were made and are force-released when
+  *          that face resigns, so they can never outlive their owner.
+  * @param freq The minimum rate needed, in Hz; must be a power of 2 from 1 to 128.
+  * @return A token to pass to movement_release_tick_claim, or 0 if the frequency is
+  *         invalid or all claim slots are in use (in which case fall back to
+  *         movement_request_tick_frequency and restore the old rate yourself).
+  */
+movement_tick_claim_t movement_claim_tick_frequency(uint8_t freq);
+
+/** @brief Releases a tick-frequency claim, recomputing the effective rate.
+  * @param claim The token movement_claim_tick_frequency returned. Releasing an already
+  *              released or invalid token is harmless.
+  */
+void movement_release_tick_claim(movement_tick_claim_t claim);
+
 // note: watch faces can only schedule a background task when in the foreground, since
 // movement will associate the scheduled task with the currently active face.
+// Deadlines that fall exactly on a minute boundary fire from the same RTC interrupt as
+// the top-of-minute alarm, so hourly jobs across faces consolidate into a single wake.
 void movement_schedule_background_task(watch_date_time_t date_time);
 
 // note: watch faces can only cancel their background task when in the foreground, since
@@ -331,14 +454,150 @@ void movement_cancel_background_task_for_face(uint8_t watch_face_index);
 void movement_request_sleep(void);
 void movement_request_wake(void);
 
+// Asks low energy mode to keep the seconds digits ticking. Call this from your
+// EVENT_LOW_ENERGY_UPDATE handler: while the watch sleeps, the 1 Hz RTC interrupt
+// repaints just positions 8 and 9 through the low-power seconds display path — no
+// run loop, no face dispatch — so the display stays live at a small fraction of
+// normal-mode power. The request lasts until the watch fully wakes; re-request it
+// on each low energy update to keep it across sleep sessions.
+void movement_request_low_energy_seconds(void);
+
+/// Priorities for the idle work scheduler; lower values run earlier in a window.
+typedef enum {
+    MOVEMENT_IDLE_PRIORITY_COMMIT = 0,    ///< Data integrity: settings commit, write-behind flush.
+    MOVEMENT_IDLE_PRIORITY_MAINTENANCE,   ///< Housekeeping: filesystem garbage collection.
+    MOVEMENT_IDLE_PRIORITY_OPPORTUNISTIC, ///< Precomputing caches; may wait for a later window.
+} movement_idle_priority_t;
+
+/// An idle task: do one bounded slice of work (tens of milliseconds, not seconds) and
+/// return true if more remains; return false quickly when there is nothing to do.
+typedef bool (*movement_idle_task_fn)(void);
+
+/** @brief Registers a job with the idle work scheduler.
+  * @details Deferred background work — committing settings, flushing the append cache,
+  *          filesystem garbage collection — shares one wake window instead of each
+  *          subsystem inventing its own timer. On the way into low energy mode, Movement
+  *          runs every registered task in priority order, re-invoking tasks that report
+  *          leftover work until all are done or the window's time budget (a few hundred
+  *          milliseconds) runs out; leftovers continue at the next minute wake while the
+  *          watch sleeps. Registration is permanent and idempotent: a recurring job stays
+  *          registered and simply returns false when it has nothing to do.
+  * @param task The task to run during idle windows.
+  * @param priority Where the task sorts within a window.
+  * @return true if the task is registered; false if the table is full.
+  */
+bool movement_register_idle_task(movement_idle_task_fn task, movement_idle_priority_t priority);
+
+/** @brief Declares a face's loop compute-heavy (cryptographic hashing, astronomical
+  *        math). Movement will run that face's loop at 16 MHz and drop the clock back
+  *        to the baseline as soon as it returns — the work costs fewer joules done
+  *        fast than dragged out at 4 MHz. Call from your setup function; pass false
+  *        to revert. Faces with ordinary display-update loops should not opt in.
+  */
+void movement_set_face_compute_heavy(uint8_t watch_face_index, bool compute_heavy);
+
+/// Degraded power tiers, entered as measured VCC sags below configurable thresholds
+/// (MOVEMENT_VCC_DEGRADED_MILLIVOLTS / MOVEMENT_VCC_CRITICAL_MILLIVOLTS). At the
+/// degraded tier the buzzer is capped at soft volume and low energy mode is forced
+/// within ten minutes of inactivity; at the critical tier the LED stays dark and
+/// sensor background tasks are suspended. Alarms still fire at every tier.
+typedef enum {
+    MOVEMENT_POWER_TIER_NORMAL = 0,
+    MOVEMENT_POWER_TIER_DEGRADED,
+    MOVEMENT_POWER_TIER_CRITICAL,
+} movement_power_tier_t;
+
+/** @brief The current power tier, for faces that want to show a low battery hint
+  *        or skip optional work when the cell is sagging.
+  */
+movement_power_tier_t movement_get_power_tier(void);
+
+/// Results from movement_benchmark_face. Times are in abstract units so the same
+/// struct works in both builds: units_per_second is 1000000 in the simulator
+/// (microseconds from the browser clock) and the RTC frequency on hardware, where
+/// single loops often measure zero units and only batch averages are meaningful.
+typedef struct {
+    uint32_t units_per_second;
+    uint32_t activate_units;   // face activate plus the first EVENT_ACTIVATE loop
+    uint32_t ticks;            // EVENT_TICK loops driven
+    uint32_t tick_total_units;
+    uint32_t tick_max_units;
+    uint32_t button_events;    // scripted button loops driven, if requested
+    uint32_t button_total_units;
+} movement_benchmark_t;
+
+/** @brief Drives a face's loop with a scripted event sequence and times it.
+  * @details Runs setup if needed, then activate, then tick_count EVENT_TICK events,
+  *          then (optionally) light and alarm button press/release pairs, measuring
+  *          each phase. The same script always produces the same event sequence, so
+  *          two runs of the same build are directly comparable — a regression gate
+  *          for face loop cost that doesn't require flashing hardware first.
+  * @note The events are delivered to the real face with its real context: a face that
+  *       mutates state on buttons will have mutated state afterward, and the display
+  *       is redrawn by the benchmark traffic. The active face is re-activated when the
+  *       run completes so the screen recovers. Run it from the shell with `bench`.
+  * @return false if watch_face_index is out of range.
+  */
+bool movement_benchmark_face(uint8_t watch_face_index, uint32_t tick_count, bool with_buttons, movement_benchmark_t *results);
+
+/** @brief Enters BACKUP mode, the SAM L22's lowest power mode, after snapshotting state.
+  * @details Resigns the active face, serializes the active face index and a compact
+  *          snapshot from every face that opted in (see watch_face_serialize) to the
+  *          filesystem, and powers everything but the RTC down. Waking (pin A2 or A4;
+  *          the alarm button cannot wake from BACKUP on current silicon) is a reset,
+  *          but Movement restores the snapshots during boot, so the watch comes back
+  *          on the same face with its state intact. Intended for shelf and overnight
+  *          storage; timekeeping continues throughout.
+  */
+void movement_enter_backup_mode(void);
+
 void movement_play_note(watch_buzzer_note_t note, uint16_t duration_ms);
 void movement_play_signal(void);
 void movement_play_alarm(void);
+
+/** @brief Selects which entry of the signal tune registry movement_play_signal plays.
+  *        Indexes follow the order of the tunes in movement_custom_signal_tunes.h; the
+  *        SIGNAL_TUNE_* option in movement_config.h picks the boot-time default, and
+  *        out-of-range indexes are ignored. The selection is not persisted.
+  */
+void movement_set_signal_tune(uint8_t index);
+uint8_t movement_get_signal_tune(void);
+uint8_t movement_get_signal_tune_count(void);
 void movement_play_alarm_beeps(uint8_t rounds, watch_buzzer_note_t alarm_note);
-void movement_play_sequence(int8_t *note_sequence, movement_buzzer_priority_t priority);
+void movement_play_sequence(const int8_t *note_sequence, movement_buzzer_priority_t priority);
 
 uint8_t movement_claim_backup_register(void);
 
+/** @brief Builds a tag for movement_claim_tagged_backup_register from four characters,
+  *        e.g. MOVEMENT_BACKUP_TAG('T', 'L', 'Y', 0). Pick something unique to your face.
+  */
+#define MOVEMENT_BACKUP_TAG(a, b, c, d) (((uint32_t)(a) << 24) | ((uint32_t)(b) << 16) | ((uint32_t)(c) << 8) | (uint32_t)(d))
+
+/** @brief Claims a backup register by tag, finding the same data after any reset or rebuild.
+  * @details movement_claim_backup_register hands out registers in call order, so rearranging
+  *          watch faces in movement_config.h silently hands a face some other face's persisted
+  *          data. A tagged claim stamps a hash of the tag into the register's high byte instead:
+  *          on the next boot the claim finds the register carrying its hash wherever it landed,
+  *          and the payload comes back warm. The cost is that only the low 24 bits are yours;
+  *          access them with movement_get_tagged_backup_data / movement_set_tagged_backup_data.
+  *          Claiming the same tag twice returns the same register, so two instances of a face
+  *          share their persisted state.
+  * @param tag A tag built with MOVEMENT_BACKUP_TAG.
+  * @param was_restored If non-NULL, set true when the register held this tag's data from a
+  *        previous boot (i.e. the payload is valid), false when it was freshly assigned.
+  * @return A register number for the data access functions below, or 0 if no register was
+  *         available or another tag in this build hashes to the same byte.
+  */
+uint8_t movement_claim_tagged_backup_register(uint32_t tag, bool *was_restored);
+
+/** @brief Reads the 24-bit payload of a tagged backup register. Returns 0 if reg is 0. */
+uint32_t movement_get_tagged_backup_data(uint8_t reg);
+
+/** @brief Stores a 24-bit payload in a tagged backup register, preserving the tag byte.
+  *        Skips the write if the value is unchanged. Does nothing if reg is 0.
+  */
+void movement_set_tagged_backup_data(uint32_t value, uint8_t reg);
+
 int32_t movement_get_current_timezone_offset_for_zone(uint8_t zone_index);
 int32_t movement_get_current_timezone_offset(void);
 
@@ -350,6 +609,14 @@ watch_date_time_t movement_get_local_date_time(void);
 watch_date_time_t movement_get_date_time_in_zone(uint8_t zone_index);
 uint32_t movement_get_utc_timestamp(void);
 
+/** @brief Returns the number of days between the local calendar date and the UNIX epoch.
+  * @details The value changes once at local midnight, so faces that display day counts
+  *          can subtract a precomputed epoch day for their target date from this instead
+  *          of redoing full date conversions on every tick. The conversion behind it only
+  *          runs the first time it is called on a given day.
+  */
+uint32_t movement_get_local_epoch_day(void);
+
 void movement_set_utc_date_time(watch_date_time_t date_time);
 void movement_set_local_date_time(watch_date_time_t date_time);
 void movement_set_utc_timestamp(uint32_t timestamp);
@@ -390,6 +657,13 @@ void movement_store_settings(void);
 /// Or should there be a watch face function where watch faces can tell us if they have an alarm enabled?
 /// Worth considering a better way to handle this.
 bool movement_alarm_enabled(void);
+
+/** @brief Returns true if the accelerometer's hardware activity engine currently classifies
+  *        the wearer as active. Tracked from the sleep-state interrupt, so this is a cached
+  *        flag: no bus traffic, safe to call every minute from an advisory. Always false if
+  *        no accelerometer is present.
+  */
+bool movement_wearer_is_active(void);
 void movement_set_alarm_enabled(bool value);
 
 // if the board has an accelerometer, these functions will enable or disable tap detection.
@@ -404,7 +678,30 @@ bool movement_set_accelerometer_background_rate(lis2dw_data_rate_t new_rate);
 uint8_t movement_get_accelerometer_motion_threshold(void);
 bool movement_set_accelerometer_motion_threshold(uint8_t new_threshold);
 
+/** @brief Begins a background motion-capture session.
+  * @details Counts bursts of motion — transitions out of the accelerometer's hardware
+  *          stationary state — in the movement layer, using the activity engine the
+  *          accelerometer already runs in the background. The MCU wakes only for the
+  *          interrupt edge that opens each burst and sleeps between them, and the face
+  *          that started the session is free to resign: the tally keeps accumulating
+  *          until the session is stopped, and can be read at any time with
+  *          movement_get_motion_capture_count().
+  * @return false if no accelerometer is available.
+  */
+bool movement_start_motion_capture_session(void);
+
+/** @brief Ends the motion-capture session. The count remains readable until the next start. */
+void movement_stop_motion_capture_session(void);
+
+/** @brief Motion bursts counted since the session started. */
+uint32_t movement_get_motion_capture_count(void);
+
 // If the board has a temperature sensor, this function will give you the temperature in degrees celsius.
 // If the board has multiple temperature sensors, it will use the most accurate one available.
 // If the board has no temperature sensors, it will return 0xFFFFFFFF.
 float movement_get_temperature(void);
+
+// Returns the most recent reading movement_get_temperature took for anyone (typically
+// the hourly logging pass), without bringing the sensor up. If age_seconds is non-NULL
+// it receives the reading's age. Returns 0xFFFFFFFF if no reading has been taken yet.
+float movement_get_cached_temperature(uint32_t *age_seconds);
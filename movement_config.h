@@ -28,20 +28,27 @@
 #include "movement_faces.h"
 
 
+/* The list of faces in this build, in rotation order. Wrapping each face in F() lets
+ * movement.c generate a direct-call dispatcher for the face loops in addition to the
+ * watch_faces array below, so the compiler can inline small face loops. Comment a face
+ * out with a block comment, since the list is a macro. */
+#define MOVEMENT_FACE_LIST(F) \
+    F(clock_face) \
+    F(voltage_face) \
+    F(activity_logging_face) \
+    F(fast_stopwatch_face) \
+    F(ping_face) \
+    F(simple_coin_flip_face) \
+    /* F(countdown_face) */ \
+    F(alarm_face) \
+    F(set_time_face) \
+    F(temperature_display_face) \
+    /* F(accelerometer_status_face) */
+
+#define _MOVEMENT_FACE_ENTRY(face) face,
+
 const watch_face_t watch_faces[] = {
-    clock_face,
-    voltage_face,
-    activity_logging_face,
-    fast_stopwatch_face,
-    ping_face,
-    simple_coin_flip_face,
-    //countdown_face,
-    alarm_face,
-    set_time_face,
-    temperature_display_face,
-    //accelerometer_status_face,
-    
-    
+    MOVEMENT_FACE_LIST(_MOVEMENT_FACE_ENTRY)
 };
 
 #define MOVEMENT_NUM_FACES (sizeof(watch_faces) / sizeof(watch_face_t))
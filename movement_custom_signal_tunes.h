@@ -24,17 +24,30 @@
 
 #pragma once
 
-#ifdef SIGNAL_TUNE_DEFAULT
-int8_t signal_tune[] = {
+/*
+ * The signal tune registry. Every tune lives in flash as a const record, and
+ * signal_tunes[] indexes them, so choosing the hourly chime is an indexed
+ * load: movement_play_signal() plays whichever entry is selected, and a face
+ * can change the selection at runtime with movement_set_signal_tune().
+ *
+ * Repeated phrases inside a tune are stored once and replayed with the buzzer
+ * sequencer's rewind markers — the tuple (-n, count) repeats the previous n
+ * notes count more times, the same trick the default alarm tune uses — so the
+ * records stay small even with every tune compiled in.
+ *
+ * The SIGNAL_TUNE_* option in movement_config.h still chooses the tune that
+ * plays out of the box; it now selects the boot-time index instead of
+ * compiling in a different array.
+ */
+
+static const int8_t _signal_tune_default[] = {
     BUZZER_NOTE_C8, 5,
     BUZZER_NOTE_REST, 6,
     BUZZER_NOTE_C8, 5,
     0
 };
-#endif // SIGNAL_TUNE_DEFAULT
 
-#ifdef SIGNAL_TUNE_ZELDA_SECRET
-int8_t signal_tune[] = {
+static const int8_t _signal_tune_zelda_secret[] = {
     BUZZER_NOTE_G5, 8,
     BUZZER_NOTE_F5SHARP_G5FLAT, 8,
     BUZZER_NOTE_D5SHARP_E5FLAT, 8,
@@ -45,10 +58,8 @@ int8_t signal_tune[] = {
     BUZZER_NOTE_C6, 20,
     0
 };
-#endif // SIGNAL_TUNE_ZELDA_SECRET
 
-#ifdef SIGNAL_TUNE_MARIO_THEME
-int8_t signal_tune[] = {
+static const int8_t _signal_tune_mario_theme[] = {
     BUZZER_NOTE_E6, 7,
     BUZZER_NOTE_REST, 2,
     BUZZER_NOTE_E6, 7,
@@ -64,57 +75,34 @@ int8_t signal_tune[] = {
     BUZZER_NOTE_G5, 8,
     0
 };
-#endif // SIGNAL_TUNE_MARIO_THEME
 
-#ifdef SIGNAL_TUNE_MGS_CODEC
-int8_t signal_tune[] = {
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
+static const int8_t _signal_tune_mgs_codec[] = {
     BUZZER_NOTE_G5SHARP_A5FLAT, 1,
     BUZZER_NOTE_C6, 1,
+    -2, 4,      // the two-note warble plays five times in all
     BUZZER_NOTE_REST, 6,
     BUZZER_NOTE_G5SHARP_A5FLAT, 1,
     BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
+    -2, 4,
     0
 };
-#endif // SIGNAL_TUNE_MGS_CODEC
 
-#ifdef SIGNAL_TUNE_KIM_POSSIBLE
-int8_t signal_tune[] = {
-    BUZZER_NOTE_G7, 6,
-    BUZZER_NOTE_G4, 2,
-    BUZZER_NOTE_REST, 5,
+static const int8_t _signal_tune_kim_possible[] = {
     BUZZER_NOTE_G7, 6,
     BUZZER_NOTE_G4, 2,
     BUZZER_NOTE_REST, 5,
+    -3, 1,      // the hook plays twice
     BUZZER_NOTE_A7SHARP_B7FLAT, 6,
     BUZZER_NOTE_REST, 2,
     BUZZER_NOTE_G7, 6,
     BUZZER_NOTE_G4, 2,
     0
 };
-#endif // SIGNAL_TUNE_KIM_POSSIBLE
 
-#ifdef SIGNAL_TUNE_POWER_RANGERS
-int8_t signal_tune[] = {
-    BUZZER_NOTE_D8, 6,
-    BUZZER_NOTE_REST, 8,
+static const int8_t _signal_tune_power_rangers[] = {
     BUZZER_NOTE_D8, 6,
     BUZZER_NOTE_REST, 8,
+    -2, 1,
     BUZZER_NOTE_C8, 6,
     BUZZER_NOTE_REST, 2,
     BUZZER_NOTE_D8, 6,
@@ -124,10 +112,8 @@ int8_t signal_tune[] = {
     BUZZER_NOTE_D8, 6,
     0
 };
-#endif // SIGNAL_TUNE_POWER_RANGERS
 
-#ifdef SIGNAL_TUNE_LAYLA
-int8_t signal_tune[] = {
+static const int8_t _signal_tune_layla[] = {
     BUZZER_NOTE_A6, 5,
     BUZZER_NOTE_REST, 1,
     BUZZER_NOTE_C7, 5,
@@ -143,10 +129,11 @@ int8_t signal_tune[] = {
     BUZZER_NOTE_D7, 20,
     0
 };
-#endif // SIGNAL_TUNE_LAYLA
 
-#ifdef SIGNAL_TUNE_HARRY_POTTER_SHORT
-int8_t signal_tune[] = {
+// The short Harry Potter tune is the first phrase of the long one. Sharing the
+// bytes outright would take length-prefixed records, and the sequencer streams
+// zero-terminated data straight out of flash, so both phrasings are spelled out.
+static const int8_t _signal_tune_harry_potter_short[] = {
     BUZZER_NOTE_B5, 12,
     BUZZER_NOTE_REST, 1,
     BUZZER_NOTE_E6, 12,
@@ -164,10 +151,8 @@ int8_t signal_tune[] = {
     BUZZER_NOTE_F6SHARP_G6FLAT, 24,
     0
 };
-#endif // SIGNAL_TUNE_HARRY_POTTER_SHORT
 
-#ifdef SIGNAL_TUNE_HARRY_POTTER_LONG
-int8_t signal_tune[] = {
+static const int8_t _signal_tune_harry_potter_long[] = {
     BUZZER_NOTE_B5, 12,
     BUZZER_NOTE_REST, 1,
     BUZZER_NOTE_E6, 12,
@@ -199,10 +184,8 @@ int8_t signal_tune[] = {
 
     0
 };
-#endif // SIGNAL_TUNE_HARRY_POTTER_LONG
 
-#ifdef SIGNAL_TUNE_JURASSIC_PARK
-int8_t signal_tune[] = {
+static const int8_t _signal_tune_jurassic_park[] = {
     BUZZER_NOTE_B5, 7,
     BUZZER_NOTE_REST, 7,
     BUZZER_NOTE_A5SHARP_B5FLAT, 7,
@@ -213,21 +196,12 @@ int8_t signal_tune[] = {
     BUZZER_NOTE_REST, 13,
     BUZZER_NOTE_E5, 13,
     BUZZER_NOTE_REST, 13,
-    BUZZER_NOTE_B5, 7,
-    BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_A5SHARP_B5FLAT, 7,
-    BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_B5, 13,
-    BUZZER_NOTE_REST, 13,
-    BUZZER_NOTE_F5SHARP_G5FLAT, 13,
-    BUZZER_NOTE_REST, 13,
-    BUZZER_NOTE_E5, 13,
+    -10, 1,     // the phrase plays twice (the repeat ends on a rest the
+                // original left implicit, which is silence either way)
     0,
 };
-#endif // SIGNAL_TUNE_JURASSIC_PARK
 
-#ifdef SIGNAL_TUNE_EVANGELION
-int8_t signal_tune[] = {
+static const int8_t _signal_tune_evangelion[] = {
     BUZZER_NOTE_C5, 13,
     BUZZER_NOTE_REST, 13,
     BUZZER_NOTE_D5SHARP_E5FLAT, 13,
@@ -238,10 +212,7 @@ int8_t signal_tune[] = {
     BUZZER_NOTE_REST, 7,
     BUZZER_NOTE_F5, 7,
     BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_F5, 7,
-    BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_F5, 7,
-    BUZZER_NOTE_REST, 7,
+    -2, 2,      // three short F5s in a row
     BUZZER_NOTE_A5SHARP_B5FLAT, 7,
     BUZZER_NOTE_REST, 7,
     BUZZER_NOTE_G5SHARP_A5FLAT, 7,
@@ -253,4 +224,43 @@ int8_t signal_tune[] = {
     BUZZER_NOTE_G5, 13,
     0,
 };
-#endif // SIGNAL_TUNE_EVANGELION
+
+static const int8_t * const signal_tunes[] = {
+    _signal_tune_default,
+    _signal_tune_zelda_secret,
+    _signal_tune_mario_theme,
+    _signal_tune_mgs_codec,
+    _signal_tune_kim_possible,
+    _signal_tune_power_rangers,
+    _signal_tune_layla,
+    _signal_tune_harry_potter_short,
+    _signal_tune_harry_potter_long,
+    _signal_tune_jurassic_park,
+    _signal_tune_evangelion,
+};
+
+#define SIGNAL_TUNE_COUNT (sizeof(signal_tunes) / sizeof(signal_tunes[0]))
+
+#if defined(SIGNAL_TUNE_ZELDA_SECRET)
+#define SIGNAL_TUNE_DEFAULT_INDEX (1)
+#elif defined(SIGNAL_TUNE_MARIO_THEME)
+#define SIGNAL_TUNE_DEFAULT_INDEX (2)
+#elif defined(SIGNAL_TUNE_MGS_CODEC)
+#define SIGNAL_TUNE_DEFAULT_INDEX (3)
+#elif defined(SIGNAL_TUNE_KIM_POSSIBLE)
+#define SIGNAL_TUNE_DEFAULT_INDEX (4)
+#elif defined(SIGNAL_TUNE_POWER_RANGERS)
+#define SIGNAL_TUNE_DEFAULT_INDEX (5)
+#elif defined(SIGNAL_TUNE_LAYLA)
+#define SIGNAL_TUNE_DEFAULT_INDEX (6)
+#elif defined(SIGNAL_TUNE_HARRY_POTTER_SHORT)
+#define SIGNAL_TUNE_DEFAULT_INDEX (7)
+#elif defined(SIGNAL_TUNE_HARRY_POTTER_LONG)
+#define SIGNAL_TUNE_DEFAULT_INDEX (8)
+#elif defined(SIGNAL_TUNE_JURASSIC_PARK)
+#define SIGNAL_TUNE_DEFAULT_INDEX (9)
+#elif defined(SIGNAL_TUNE_EVANGELION)
+#define SIGNAL_TUNE_DEFAULT_INDEX (10)
+#else
+#define SIGNAL_TUNE_DEFAULT_INDEX (0)
+#endif
@@ -34,6 +34,9 @@
 #include "fast_stopwatch_face.h"
 #include "sunrise_sunset_face.h"
 #include "moon_phase_face.h"
+#include "planetary_face.h"
+#include "smallchess_face.h"
+#include "morse_trainer_face.h"
 #include "days_since_face.h"
 #include "character_set_face.h"
 #include "accelerometer_status_face.h"
@@ -42,15 +45,18 @@
 #include "temperature_logging_face.h"
 #include "activity_logging_face.h"
 #include "voltage_face.h"
+#include "battery_runtime_face.h"
 #include "set_time_face.h"
 #include "settings_face.h"
 #include "light_sensor_face.h"
 #include "irda_upload_face.h"
+#include "irda_bench_face.h"
 #include "chirpy_demo_face.h"
 #include "finetune_face.h"
 #include "nanosec_face.h"
 #include "mars_time_face.h"
 #include "peek_memory_face.h"
+#include "profiler_face.h"
 #include "ish_face.h"
 #include "breathing_face.h"
 #include "close_enough_face.h"
@@ -32,6 +32,7 @@
 #include <string.h>
 #include <strings.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 #if __EMSCRIPTEN__
 #include <emscripten.h>
@@ -44,9 +45,10 @@
 #endif
 
 #include "watch.h"
+#include "filesystem.h"
 #include "shell_cmd_list.h"
 
-extern shell_command_t g_shell_commands[];
+extern const shell_command_t g_shell_commands[];
 extern const size_t g_num_shell_commands;
 
 #define NEWLINE  "\r\n"
@@ -57,6 +59,7 @@ extern const size_t g_num_shell_commands;
 
 static char s_buf[SHELL_BUF_SZ] = {0};
 static size_t s_buf_len = 0;
+static shell_continuation_t s_continuation = NULL;
 // Pointer to the first invalid byte after the end of input.
 static char *const s_buf_end = s_buf + SHELL_BUF_SZ;
 
@@ -132,33 +135,106 @@ static int prv_handle_command() {
         return -1;
     }
 
-    // Match against the command list
-    for (size_t i = 0; i < g_num_shell_commands; i++) {
-        if (!strcasecmp(g_shell_commands[i].name, argv[0])) {
+    // Binary search the command list, which lives in flash sorted by name.
+    size_t lo = 0;
+    size_t hi = g_num_shell_commands;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        const int cmp = strcasecmp(argv[0], g_shell_commands[mid].name);
+        if (cmp < 0) {
+            hi = mid;
+        } else if (cmp > 0) {
+            lo = mid + 1;
+        } else {
             // If argc isn't valid for this command, display its help instead.
-            if (((argc - 1) < g_shell_commands[i].min_args) ||
-                ((argc - 1) > g_shell_commands[i].max_args)) {
-                if (g_shell_commands[i].help != NULL) {
-                    printf(NEWLINE "%s" NEWLINE, g_shell_commands[i].help);
+            if (((argc - 1) < g_shell_commands[mid].min_args) ||
+                ((argc - 1) > g_shell_commands[mid].max_args)) {
+                if (g_shell_commands[mid].help != NULL) {
+                    printf(NEWLINE "%s" NEWLINE, g_shell_commands[mid].help);
                 }
                 return -2;
             }
             // Call the command's callback
-            if (g_shell_commands[i].cb != NULL) {
+            if (g_shell_commands[mid].cb != NULL) {
                 printf(NEWLINE);
-                int ret = g_shell_commands[i].cb(argc, argv);
+                int ret = g_shell_commands[mid].cb(argc, argv);
                 if (ret == -2) {
-                    printf(NEWLINE "%s" NEWLINE, g_shell_commands[i].help);
+                    printf(NEWLINE "%s" NEWLINE, g_shell_commands[mid].help);
                 }
                 return ret;
             }
+            break;
         }
     }
 
     return -1;
 }
 
+void shell_request_continuation(shell_continuation_t continuation) {
+    s_continuation = continuation;
+}
+
+// Boot script state: byte offset into boot.cmd, or -1 when idle or finished.
+#define SHELL_BOOT_SCRIPT  "boot.cmd"
+static int32_t s_boot_script_offset = -1;
+static int32_t s_boot_script_size = 0;
+static uint16_t s_boot_script_line = 0;
+
+void shell_schedule_boot_script(void) {
+    s_boot_script_size = filesystem_get_file_size(SHELL_BOOT_SCRIPT);
+    if (s_boot_script_size <= 0) return;
+    s_boot_script_offset = 0;
+    s_boot_script_line = 0;
+}
+
+bool shell_boot_script_pending(void) {
+    return s_boot_script_offset >= 0;
+}
+
+static void prv_boot_script_step(void) {
+    if (s_boot_script_offset >= s_boot_script_size) {
+        s_boot_script_offset = -1;
+        printf(NEWLINE "boot.cmd: done (%u lines)" NEWLINE SHELL_PROMPT, (unsigned int) s_boot_script_line);
+        return;
+    }
+    if (!filesystem_read_line(SHELL_BOOT_SCRIPT, s_buf, &s_boot_script_offset, SHELL_BUF_SZ - 2)) {
+        s_boot_script_offset = -1;
+        printf(NEWLINE "boot.cmd: read failed at line %u" NEWLINE SHELL_PROMPT, (unsigned int) (s_boot_script_line + 1));
+        return;
+    }
+    s_boot_script_line++;
+
+    // blank lines and # comments are welcome in a provisioning script
+    char *c = s_buf;
+    while (*c == ' ' || *c == '\t') c++;
+    if (*c == '\0' || *c == '#') return;
+
+    printf(NEWLINE "boot.cmd> %s", c);
+    int ret = prv_handle_command();
+    // parsing NUL-terminated the arguments in place, so s_buf now reads as just
+    // the command name — exactly what we want to log against the line number.
+    if (ret < 0) printf(NEWLINE "boot.cmd:%u: %s failed (%d)", (unsigned int) s_boot_script_line, c, ret);
+}
+
 void shell_task(void) {
+    // A long-running command in progress gets the whole pass; new input just
+    // accumulates in the CDC ring until the continuation finishes.
+    if (s_continuation != NULL) {
+        if (s_continuation() != SHELL_RET_YIELD) {
+            s_continuation = NULL;
+            printf(NEWLINE SHELL_PROMPT);
+        }
+        return;
+    }
+
+    // One boot script command per pass: a dozen provisioning commands spread
+    // across a dozen frames instead of stalling one, and a command that
+    // schedules a continuation pauses the script until it completes.
+    if (s_boot_script_offset >= 0) {
+        prv_boot_script_step();
+        return;
+    }
+
 #if __EMSCRIPTEN__
     // This is a terrible hack; ideally this should be handled deeper in the watch library.
     // Alas, emscripten treats read() as something that should pop up an input box, so I
@@ -181,48 +257,57 @@ void shell_task(void) {
         tx = "";
     });
 #else
-    // Read one character at a time until we run out.
-    while (true) {
-        if (s_buf_len >= (SHELL_BUF_SZ - 1)) {
-            printf(NEWLINE "Command too long, clearing.");
-            printf(NEWLINE SHELL_PROMPT);
-            s_buf_len = 0;
-            break;
-        }
-
-        int c = getchar();
+    // Pull whatever has accumulated in the CDC ring in one read, then walk it.
+    // Echo is batched: printable characters are flushed back in spans rather
+    // than a putchar each, which matters when a whole file is pasted at once.
+    char chunk[64];
+    int chunk_len;
+    while ((chunk_len = read(0, chunk, sizeof(chunk))) > 0) {
+        int echo_start = 0;
+        for (int i = 0; i < chunk_len; i++) {
+            char c = chunk[i];
 
-        if (c < 0) {
-            // Nothing left to read, we're done.
-            break;
-        }
+            if (s_buf_len >= (SHELL_BUF_SZ - 1)) {
+                printf(NEWLINE "Command too long, clearing.");
+                printf(NEWLINE SHELL_PROMPT);
+                s_buf_len = 0;
+                return;
+            }
 
-        if (c == '\b') {
-            // Handle backspace character.
-            // We need to emit a backspace, overwrite the character on the
-            // screen with a space, and then backspace again to move the cursor.
-            if (s_buf_len > 0) {
-                printf("\b \b");
-                s_buf_len--;
+            if (c == '\b') {
+                // Handle backspace character.
+                // We need to emit any pending echo, then a backspace, overwrite
+                // the character on the screen with a space, and backspace again
+                // to move the cursor.
+                if (i > echo_start) fwrite(&chunk[echo_start], 1, i - echo_start, stdout);
+                echo_start = i + 1;
+                if (s_buf_len > 0) {
+                    printf("\b \b");
+                    s_buf_len--;
+                }
+                continue;
             }
-            continue;
-        } else if (c != '\n' && c != '\r') {
-            // Print regular characters to the screen.
-            putchar(c);
-        }
 
-        s_buf[s_buf_len] = c;
+            s_buf[s_buf_len] = c;
 
-        if (c == '\n' || c == '\r') {
-            // Newline! Handle the command.
-            s_buf[s_buf_len+1] = '\0';
-            (void) prv_handle_command();
-            s_buf_len = 0;
-            printf(NEWLINE SHELL_PROMPT);
-            break;
-        } else {
-            s_buf_len++;
+            if (c == '\n' || c == '\r') {
+                // Newline! Echo what's pending and handle the command.
+                if (i > echo_start) fwrite(&chunk[echo_start], 1, i - echo_start, stdout);
+                echo_start = i + 1;
+                s_buf[s_buf_len+1] = '\0';
+                (void) prv_handle_command();
+                s_buf_len = 0;
+                if (s_continuation != NULL) {
+                    // The command scheduled a continuation: hold the prompt and
+                    // leave any further pasted input for after it completes.
+                    return;
+                }
+                printf(NEWLINE SHELL_PROMPT);
+            } else {
+                s_buf_len++;
+            }
         }
+        if (chunk_len > echo_start) fwrite(&chunk[echo_start], 1, chunk_len - echo_start, stdout);
     }
 #endif
 }
@@ -25,10 +25,44 @@
 #ifndef SHELL_H_
 #define SHELL_H_
 
+#include <stdbool.h>
+
 /** @brief Called periodically from the app loop to handle shell commands.
  *         When a full command is complete, parses and executes its matching
  *         callback.
  */
 void shell_task(void);
 
+/** @brief Return value for long-running commands that want to keep running.
+ *         A command (or continuation) returning this is re-invoked on every
+ *         shell_task pass, so multi-second work can interleave with display
+ *         and button handling instead of stalling the app loop.
+ */
+#define SHELL_RET_YIELD (1)
+
+typedef int (*shell_continuation_t)(void);
+
+/** @brief Schedules a continuation to run on subsequent shell_task passes.
+ *         Call from a command callback, stash any state in statics, and have
+ *         the continuation return SHELL_RET_YIELD until the work is done.
+ *         No prompt is printed and no new commands are parsed until then.
+ */
+void shell_request_continuation(shell_continuation_t continuation);
+
+/** @brief Arms execution of an optional boot.cmd script from the filesystem.
+ *         Call once at startup, after the filesystem is mounted. If the file
+ *         exists, subsequent shell_task passes execute it one line per pass —
+ *         blank lines and lines starting with # are skipped, and a line whose
+ *         command fails is logged with its line number but does not stop the
+ *         script. This turns fleet provisioning into pushing one file instead
+ *         of typing the same dozen commands into every unit.
+ */
+void shell_schedule_boot_script(void);
+
+/** @brief Returns true while a scheduled boot script still has lines to run,
+ *         so the app loop can keep calling shell_task until it finishes even
+ *         if USB isn't connected.
+ */
+bool shell_boot_script_pending(void);
+
 #endif
@@ -27,16 +27,47 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "filesystem.h"
 #include "watch.h"
-#include "delay.h"
+#include "movement.h"
+#include "shell.h"
+#include "game_frame.h"
+#include "irda_bench_face.h"
+#include "watch_power.h"
+#include "watch_stack.h"
+#include "watch_wake_stats.h"
+#include "watch_boot_trace.h"
+#include "watch_fault.h"
+#if !__EMSCRIPTEN__
+#include "watch_usb_msc.h"
+#endif
 
 static int help_cmd(int argc, char *argv[]);
+#ifdef HAS_IR_SENSOR
+static int irstat_cmd(int argc, char *argv[]);
+#endif
 static int flash_cmd(int argc, char *argv[]);
 static int stress_cmd(int argc, char *argv[]);
+static int bench_cmd(int argc, char *argv[]);
+static int bootstat_cmd(int argc, char *argv[]);
+static int cpustat_cmd(int argc, char *argv[]);
+static int faultstat_cmd(int argc, char *argv[]);
+static int framestat_cmd(int argc, char *argv[]);
+static int powerstat_cmd(int argc, char *argv[]);
+static int stackstat_cmd(int argc, char *argv[]);
+#if !__EMSCRIPTEN__
+static int msc_cmd(int argc, char *argv[]);
+#endif
+static int wakestat_cmd(int argc, char *argv[]);
+#if __EMSCRIPTEN__
+static int warp_cmd(int argc, char *argv[]);
+#endif
 
-shell_command_t g_shell_commands[] = {
+// Sorted case-insensitively by name: the shell dispatches with a binary search.
+// Keep new entries in order or they become unreachable.
+const shell_command_t g_shell_commands[] = {
     {
         .name = "?",
         .help = "print command list",
@@ -45,25 +76,25 @@ shell_command_t g_shell_commands[] = {
         .cb = help_cmd,
     },
     {
-        .name = "help",
-        .help = "print command list",
-        .min_args = 0,
-        .max_args = 0,
-        .cb = help_cmd,
+        .name = "b64encode",
+        .help = "usage: b64encode <PATH>",
+        .min_args = 1,
+        .max_args = 1,
+        .cb = filesystem_cmd_b64encode,
     },
     {
-        .name = "flash",
-        .help = "reboot to UF2 bootloader",
-        .min_args = 0,
-        .max_args = 0,
-        .cb = flash_cmd,
+        .name = "bench",
+        .help = "time a face's loop with scripted events; usage: bench FACE_IDX [TICKS] [buttons]",
+        .min_args = 1,
+        .max_args = 3,
+        .cb = bench_cmd,
     },
     {
-        .name = "ls",
-        .help = "usage: ls [PATH]",
+        .name = "bootstat",
+        .help = "print boot phase timings against budget",
         .min_args = 0,
-        .max_args = 1,
-        .cb = filesystem_cmd_ls,
+        .max_args = 0,
+        .cb = bootstat_cmd,
     },
     {
         .name = "cat",
@@ -73,11 +104,11 @@ shell_command_t g_shell_commands[] = {
         .cb = filesystem_cmd_cat,
     },
     {
-        .name = "b64encode",
-        .help = "usage: b64encode <PATH>",
-        .min_args = 1,
+        .name = "cpustat",
+        .help = "print per-wake CPU time stats; usage: cpustat [reset]",
+        .min_args = 0,
         .max_args = 1,
-        .cb = filesystem_cmd_b64encode,
+        .cb = cpustat_cmd,
     },
     {
         .name = "df",
@@ -87,11 +118,25 @@ shell_command_t g_shell_commands[] = {
         .cb = filesystem_cmd_df,
     },
     {
-        .name = "rm",
-        .help = "usage: rm [PATH]",
-        .min_args = 1,
+        .name = "echo",
+        .help = "usage: echo TEXT {>,>>} FILE",
+        .min_args = 3,
+        .max_args = 3,
+        .cb = filesystem_cmd_echo,
+    },
+    {
+        .name = "faultstat",
+        .help = "print hard fault records; usage: faultstat [reset]",
+        .min_args = 0,
         .max_args = 1,
-        .cb = filesystem_cmd_rm,
+        .cb = faultstat_cmd,
+    },
+    {
+        .name = "flash",
+        .help = "reboot to UF2 bootloader",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = flash_cmd,
     },
     {
         .name = "format",
@@ -101,11 +146,85 @@ shell_command_t g_shell_commands[] = {
         .cb = filesystem_cmd_format,
     },
     {
-        .name = "echo",
-        .help = "usage: echo TEXT {>,>>} FILE",
-        .min_args = 3,
-        .max_args = 3,
-        .cb = filesystem_cmd_echo,
+        .name = "framestat",
+        .help = "print game frame timing stats; usage: framestat [reset]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = framestat_cmd,
+    },
+    {
+        .name = "fscache",
+        .help = "print filesystem read cache hit/miss counters",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = filesystem_cmd_cachestats,
+    },
+    {
+        .name = "get",
+        .help = "CRC-checked download; usage: get <PATH>",
+        .min_args = 1,
+        .max_args = 1,
+        .cb = filesystem_cmd_get,
+    },
+    {
+        .name = "help",
+        .help = "print command list",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = help_cmd,
+    },
+#ifdef HAS_IR_SENSOR
+    {
+        .name = "irstat",
+        .help = "print IR link benchmark stats; usage: irstat [reset]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = irstat_cmd,
+    },
+#endif
+    {
+        .name = "ls",
+        .help = "usage: ls [PATH]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = filesystem_cmd_ls,
+    },
+#if !__EMSCRIPTEN__
+    {
+        .name = "msc",
+        .help = "export files as a read-only USB drive; usage: msc [off]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = msc_cmd,
+    },
+#endif
+    {
+        .name = "powerstat",
+        .help = "print per-peripheral on-time ledger; usage: powerstat [reset]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = powerstat_cmd,
+    },
+    {
+        .name = "put",
+        .help = "CRC-checked upload; usage: put <PATH> <SIZE>",
+        .min_args = 2,
+        .max_args = 2,
+        .cb = filesystem_cmd_put,
+    },
+    {
+        .name = "rm",
+        .help = "usage: rm [PATH]",
+        .min_args = 1,
+        .max_args = 1,
+        .cb = filesystem_cmd_rm,
+    },
+    {
+        .name = "stackstat",
+        .help = "print stack high-water marks, overall and per face",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = stackstat_cmd,
     },
     {
         .name = "stress",
@@ -114,6 +233,22 @@ shell_command_t g_shell_commands[] = {
         .max_args = 2,
         .cb = stress_cmd,
     },
+    {
+        .name = "wakestat",
+        .help = "print wake source counts and interval histograms; usage: wakestat [reset]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = wakestat_cmd,
+    },
+#if __EMSCRIPTEN__
+    {
+        .name = "warp",
+        .help = "run the simulated RTC at N ticks per real tick; usage: warp [N]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = warp_cmd,
+    },
+#endif
 };
 
 const size_t g_num_shell_commands = sizeof(g_shell_commands) / sizeof(shell_command_t);
@@ -142,31 +277,357 @@ static int flash_cmd(int argc, char *argv[]) {
 }
 
 #define STRESS_CMD_MAX_LEN  (512)
-static int stress_cmd(int argc, char *argv[]) {
-    char test_str[STRESS_CMD_MAX_LEN+1] = {0};
 
-    int max_len = 512;
-    int delay = 0;
+// stress runs as a continuation: one line per shell_task pass, so even a long
+// run with a delay between lines never freezes the display or the buttons.
+static struct {
+    char test_str[STRESS_CMD_MAX_LEN+1];
+    int max_len;
+    int delay;
+    int i;
+    uint32_t last_emit;
+} s_stress;
+
+static int stress_continue(void) {
+    if (s_stress.delay > 0 && s_stress.i > 0) {
+        uint32_t delay_ticks = ((uint32_t)s_stress.delay * watch_rtc_get_frequency() + 999) / 1000;
+        if ((uint32_t)(watch_rtc_get_counter() - s_stress.last_emit) < delay_ticks) {
+            return SHELL_RET_YIELD;
+        }
+    }
+
+    int i = s_stress.i;
+    snprintf(&s_stress.test_str[i], 2, "%u", (i+1)%10);
+    printf("%u:\t%s\r\n", (i+1), s_stress.test_str);
+    s_stress.last_emit = watch_rtc_get_counter();
+
+    if (++s_stress.i >= s_stress.max_len) {
+        return 0;
+    }
+    return SHELL_RET_YIELD;
+}
+
+static int stress_cmd(int argc, char *argv[]) {
+    memset(&s_stress, 0, sizeof(s_stress));
+    s_stress.max_len = 512;
 
     if (argc >= 2) {
-        if ((max_len = atoi(argv[1])) == 0) {
+        if ((s_stress.max_len = atoi(argv[1])) == 0) {
             return -1;
         }
-        if (max_len > 512) {
+        if (s_stress.max_len > 512) {
             return -1;
         }
     }
 
     if (argc >= 3) {
-        delay = atoi(argv[2]);
+        s_stress.delay = atoi(argv[2]);
+    }
+
+    shell_request_continuation(stress_continue);
+    return 0;
+}
+
+static int cpustat_cmd(int argc, char *argv[]) {
+    if (argc >= 2) {
+        movement_reset_wake_stats();
+        printf("wake stats reset\r\n");
+        return 0;
+    }
+
+    (void) argv;
+    movement_wake_stats_t stats;
+    movement_get_wake_stats(&stats);
+
+    uint32_t freq = watch_rtc_get_frequency();
+    printf("wakes:     %lu\r\n", (unsigned long)stats.wake_count);
+    printf("busy:      %lu ticks (%lu ms)\r\n",
+            (unsigned long)stats.busy_ticks,
+            (unsigned long)((uint64_t)stats.busy_ticks * 1000 / freq));
+    printf("max wake:  %lu ticks (%lu ms)\r\n",
+            (unsigned long)stats.max_wake_ticks,
+            (unsigned long)((uint64_t)stats.max_wake_ticks * 1000 / freq));
+
+    // per-face deadline ledger: loops that outlasted their tick period
+    for (uint8_t i = 0; i < movement_get_face_count(); i++) {
+        uint16_t overruns, max_ticks;
+        movement_get_face_loop_stats(i, &overruns, &max_ticks);
+        if (overruns == 0 && max_ticks == 0) continue;
+        printf("face %2u:   max loop %u ticks (%lu ms), %u overruns%s\r\n",
+                i, max_ticks,
+                (unsigned long)((uint64_t)max_ticks * 1000 / freq),
+                overruns, overruns ? "  OVER" : "");
+    }
+
+    return 0;
+}
+
+static int powerstat_cmd(int argc, char *argv[]) {
+    if (argc >= 2) {
+        watch_power_reset();
+        movement_reset_wake_stats();
+        printf("power ledger and wake stats reset\r\n");
+        return 0;
+    }
+
+    (void) argv;
+    uint32_t freq = watch_rtc_get_frequency();
+    movement_wake_stats_t wake;
+    movement_get_wake_stats(&wake);
+
+    printf("CPU     %lu ticks (%lu s), %lu wakes\r\n",
+            (unsigned long)wake.busy_ticks,
+            (unsigned long)(wake.busy_ticks / freq),
+            (unsigned long)wake.wake_count);
+    for (int i = 0; i < WATCH_POWER_PERIPHERAL_COUNT; i++) {
+        watch_power_entry_t entry;
+        watch_power_get_entry((watch_power_peripheral_t)i, &entry);
+        printf("%-7s %lu ticks (%lu s), %lu enables%s\r\n",
+                watch_power_peripheral_name((watch_power_peripheral_t)i),
+                (unsigned long)entry.on_ticks,
+                (unsigned long)(entry.on_ticks / freq),
+                (unsigned long)entry.enable_count,
+                entry.enabled ? ", on" : "");
+    }
+
+    return 0;
+}
+
+static int stackstat_cmd(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+    uint32_t size = watch_stack_size();
+    if (size == 0) {
+        printf("no stack instrumentation on this platform\r\n");
+        return -1;
+    }
+
+    uint32_t used = watch_stack_high_water();
+    printf("stack:    %lu bytes\r\n", (unsigned long)size);
+    printf("used max: %lu bytes (%lu%%)\r\n",
+            (unsigned long)used, (unsigned long)(used * 100 / size));
+    printf("free min: %lu bytes\r\n", (unsigned long)(size - used));
+    if (watch_stack_overflowed()) printf("WARNING: bottom of stack overwritten, likely overflow\r\n");
+
+    // per-face maxima include everything below the face's loop (Movement's own
+    // frames and the RTC tick path), so compare faces against each other.
+    for (uint8_t i = 0; i < movement_get_face_count(); i++) {
+        uint16_t depth = movement_get_face_stack_high_water(i);
+        if (depth) printf("face %2u:  %u bytes\r\n", i, depth);
     }
 
-    for (int i = 0; i < max_len; i++) {
-        snprintf(&test_str[i], 2, "%u", (i+1)%10);
-        printf("%u:\t%s\r\n", (i+1), test_str);
-        if (delay > 0) {
-            delay_ms(delay);
+    return 0;
+}
+
+#if !__EMSCRIPTEN__
+static int msc_cmd(int argc, char *argv[]) {
+    if (argc >= 2) {
+        if (strcmp(argv[1], "off") != 0) {
+            printf("usage: msc [off]\r\n");
+            return -1;
         }
+        watch_usb_msc_disable();
+        printf("mass storage off\r\n");
+        return 0;
+    }
+
+    if (!watch_usb_msc_enable()) {
+        printf("mass storage already on\r\n");
+        return -1;
+    }
+    // the disconnect/reconnect interrupts the CDC session too; this line lands
+    // once the host re-attaches the serial port.
+    printf("mass storage on (read-only); 'msc off' to stop\r\n");
+    return 0;
+}
+#endif
+
+static int faultstat_cmd(int argc, char *argv[]) {
+    if (argc >= 2) {
+        watch_fault_clear();
+        printf("fault ring cleared\r\n");
+        return 0;
+    }
+
+    (void) argv;
+    uint32_t count = watch_fault_count();
+    if (count == 0) {
+        printf("no hard faults recorded\r\n");
+        return 0;
+    }
+
+    watch_fault_record_t records[WATCH_FAULT_RING_DEPTH];
+    uint8_t n = watch_fault_get_records(records, WATCH_FAULT_RING_DEPTH);
+    printf("%lu hard faults since power-on, newest first:\r\n", (unsigned long)count);
+    printf("%5s %10s %10s %10s %s\r\n", "seq", "pc", "lr", "sp", "face");
+    for (uint8_t i = 0; i < n; i++) {
+        printf("%5u 0x%08lx 0x%08lx 0x%08lx %4u\r\n",
+                records[i].seq,
+                (unsigned long)records[i].pc,
+                (unsigned long)records[i].lr,
+                (unsigned long)records[i].sp,
+                records[i].face_idx);
+    }
+    printf("map addresses with arm-none-eabi-addr2line -e build/watch.elf\r\n");
+
+    return 0;
+}
+
+static int framestat_cmd(int argc, char *argv[]) {
+    if (argc >= 2) {
+        game_frame_reset_stats();
+        printf("frame stats reset\r\n");
+        return 0;
+    }
+
+    (void) argv;
+    game_frame_stats_t stats;
+    game_frame_get_stats(&stats);
+
+    uint32_t freq = watch_rtc_get_frequency();
+    uint32_t avg_ticks = stats.frames ? stats.total_ticks / stats.frames : 0;
+    printf("frames:    %lu\r\n", (unsigned long)stats.frames);
+    printf("budget:    %u ticks\r\n", stats.budget_ticks);
+    printf("avg frame: %lu ticks (%lu ms)\r\n",
+            (unsigned long)avg_ticks,
+            (unsigned long)((uint64_t)avg_ticks * 1000 / freq));
+    printf("max frame: %u ticks (%lu ms)\r\n",
+            stats.max_frame_ticks,
+            (unsigned long)((uint64_t)stats.max_frame_ticks * 1000 / freq));
+    printf("overruns:  %u\r\n", stats.overruns);
+    printf("skipped:   %u renders\r\n", stats.skipped_renders);
+
+    return 0;
+}
+
+#ifdef HAS_IR_SENSOR
+static int irstat_cmd(int argc, char *argv[]) {
+    if (argc >= 2) {
+        irda_bench_reset_stats();
+        printf("IR link stats reset\r\n");
+        return 0;
+    }
+
+    (void) argv;
+    irda_bench_stats_t stats;
+    irda_bench_get_stats(&stats);
+
+    uint32_t freq = watch_rtc_get_frequency();
+    printf("received:  %lu\r\n", (unsigned long)stats.received);
+    printf("lost:      %lu\r\n", (unsigned long)stats.lost);
+    printf("replays:   %lu\r\n", (unsigned long)stats.replays);
+    printf("crc error: %lu\r\n", (unsigned long)stats.crc_errors);
+    printf("interval:  %u ms (host nominal)\r\n", stats.interval_ms);
+    if (stats.received > 1) {
+        printf("gap:       %lu-%lu ms\r\n",
+                (unsigned long)((uint64_t)stats.min_gap_ticks * 1000 / freq),
+                (unsigned long)((uint64_t)stats.max_gap_ticks * 1000 / freq));
+        printf("histogram buckets are log2(ticks between frames) at %lu Hz\r\n", (unsigned long)freq);
+        for (int b = 0; b < IRDA_BENCH_BUCKETS; b++) {
+            if (stats.buckets[b] == 0) continue;
+            printf("  2^%-2d ticks: %u\r\n", b, stats.buckets[b]);
+        }
+    }
+
+    return 0;
+}
+#endif
+
+static int wakestat_cmd(int argc, char *argv[]) {
+    if (argc >= 2) {
+        watch_wake_stats_reset();
+        printf("wake stats reset\r\n");
+        return 0;
+    }
+
+    (void) argv;
+    uint32_t freq = watch_rtc_get_frequency();
+    printf("histogram buckets are log2(ticks between wakes) at %lu Hz\r\n", (unsigned long)freq);
+    for (int i = 0; i < WATCH_WAKE_SOURCE_COUNT; i++) {
+        watch_wake_stats_t stats;
+        watch_wake_stats_get((watch_wake_source_t)i, &stats);
+        if (stats.count == 0) continue;
+        printf("%-7s %lu wakes\r\n", watch_wake_source_name((watch_wake_source_t)i), (unsigned long)stats.count);
+        for (int b = 0; b < WATCH_WAKE_STATS_BUCKETS; b++) {
+            if (stats.buckets[b] == 0) continue;
+            printf("  2^%-2d ticks: %u\r\n", b, stats.buckets[b]);
+        }
+    }
+
+    return 0;
+}
+
+#if __EMSCRIPTEN__
+static int warp_cmd(int argc, char *argv[]) {
+    if (argc >= 2) {
+        watch_rtc_set_time_warp((uint32_t)atoi(argv[1]));
+    }
+    printf("time warp: %lux\r\n", (unsigned long)watch_rtc_get_time_warp());
+    return 0;
+}
+#endif
+
+static uint32_t bench_to_us(uint32_t units, uint32_t units_per_second) {
+    return (uint32_t)((uint64_t)units * 1000000 / units_per_second);
+}
+
+static int bench_cmd(int argc, char *argv[]) {
+    uint8_t face_idx = (uint8_t)atoi(argv[1]);
+    uint32_t ticks = (argc >= 3) ? (uint32_t)atoi(argv[2]) : 100;
+    bool with_buttons = (argc >= 4);
+
+    movement_benchmark_t results;
+    if (!movement_benchmark_face(face_idx, ticks, with_buttons, &results)) {
+        printf("no face at index %u\r\n", face_idx);
+        return -1;
+    }
+
+    // everything reports in microseconds; on hardware the underlying clock is the
+    // 128 Hz RTC counter, so single events quantize and batch averages are the
+    // numbers to trust there.
+    printf("face %u, %lu ticks, clock %lu units/s\r\n",
+            face_idx, (unsigned long)results.ticks, (unsigned long)results.units_per_second);
+    printf("activate: %lu us\r\n",
+            (unsigned long)bench_to_us(results.activate_units, results.units_per_second));
+    if (results.ticks) {
+        printf("tick avg: %lu us\r\n",
+                (unsigned long)(bench_to_us(results.tick_total_units, results.units_per_second) / results.ticks));
+        printf("tick max: %lu us\r\n",
+                (unsigned long)bench_to_us(results.tick_max_units, results.units_per_second));
+    }
+    if (results.button_events) {
+        printf("button avg: %lu us (%lu events)\r\n",
+                (unsigned long)(bench_to_us(results.button_total_units, results.units_per_second) / results.button_events),
+                (unsigned long)results.button_events);
+    }
+
+    return 0;
+}
+
+static int bootstat_cmd(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+    uint32_t freq = watch_rtc_get_frequency();
+    bool marked;
+    uint32_t reset_stamp = watch_boot_trace_get(WATCH_BOOT_PHASE_RESET, &marked);
+    if (!marked) {
+        printf("no boot trace recorded\r\n");
+        return -1;
+    }
+
+    uint32_t previous = reset_stamp;
+    printf("%-12s %8s %8s %8s\r\n", "phase", "at ms", "took ms", "budget");
+    for (int i = 0; i < WATCH_BOOT_PHASE_COUNT; i++) {
+        uint32_t stamp = watch_boot_trace_get((watch_boot_phase_t)i, &marked);
+        if (!marked) continue;
+        uint32_t at_ms = (uint32_t)((uint64_t)(stamp - reset_stamp) * 1000 / freq);
+        uint32_t took_ms = (uint32_t)((uint64_t)(stamp - previous) * 1000 / freq);
+        uint16_t budget = watch_boot_phase_budget_ms((watch_boot_phase_t)i);
+        printf("%-12s %8lu %8lu %8u%s\r\n",
+                watch_boot_phase_name((watch_boot_phase_t)i),
+                (unsigned long)at_ms, (unsigned long)took_ms, budget,
+                (budget && took_ms > budget) ? "  OVER" : "");
+        previous = stamp;
     }
 
     return 0;
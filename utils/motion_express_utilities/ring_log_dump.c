@@ -0,0 +1,128 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * ring_log_dump: decodes a raw ring log region dump (the file USB mass storage
+ * mode exports) into CSV on stdout, oldest record first:
+ *
+ *     type,timestamp,payload_hex
+ *
+ * Build:  cc -O2 -I ../../watch-library/shared/driver -o ring_log_dump ring_log_dump.c
+ * Usage:  ./ring_log_dump RINGLOG.BIN > records.csv
+ *
+ * The wire format — header and record layout, CRCs, endianness — comes from
+ * packed_record.h, the same header the firmware's ring log writer compiles
+ * against, so this tool never drifts from what the watch actually writes.
+ * Decoding is a straight pass over the file: one CRC check per record and no
+ * per-field parsing beyond the codec's fixed-offset loads.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "packed_record.h"
+
+#define RECORDS_PER_SECTOR ((PACKED_RECORD_SECTOR_SIZE - PACKED_RECORD_HEADER_SIZE) / PACKED_RECORD_RECORD_SIZE)
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s RINGLOG.BIN\n", argv[0]);
+        return 1;
+    }
+
+    FILE *fp = fopen(argv[1], "rb");
+    if (!fp) {
+        perror(argv[1]);
+        return 1;
+    }
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    if (size <= 0 || size % PACKED_RECORD_SECTOR_SIZE != 0) {
+        fprintf(stderr, "%s: size %ld is not a whole number of %d-byte sectors\n", argv[1], size, PACKED_RECORD_SECTOR_SIZE);
+        fclose(fp);
+        return 1;
+    }
+
+    uint8_t *region = malloc(size);
+    if (!region || fread(region, 1, size, fp) != (size_t)size) {
+        fprintf(stderr, "%s: short read\n", argv[1]);
+        fclose(fp);
+        return 1;
+    }
+    fclose(fp);
+
+    uint32_t num_sectors = (uint32_t)(size / PACKED_RECORD_SECTOR_SIZE);
+
+    // find the head: the valid sector with the highest sequence number, compared
+    // with wraparound arithmetic the same way the firmware's mount does.
+    uint32_t head_sector = 0;
+    uint32_t head_sequence = 0;
+    int found = 0;
+    for (uint32_t i = 0; i < num_sectors; i++) {
+        uint32_t sequence;
+        if (!packed_record_header_decode(region + (size_t)i * PACKED_RECORD_SECTOR_SIZE, &sequence)) continue;
+        if (!found || (int32_t)(sequence - head_sequence) > 0) {
+            head_sector = i;
+            head_sequence = sequence;
+            found = 1;
+        }
+    }
+    if (!found) {
+        fprintf(stderr, "%s: no valid ring log sectors\n", argv[1]);
+        free(region);
+        return 1;
+    }
+
+    // walking from just past the head back around to the head visits sectors oldest
+    // first, since the log rotates through the region strictly in order.
+    unsigned long records = 0, skipped = 0;
+    for (uint32_t n = 1; n <= num_sectors; n++) {
+        uint32_t sector = (head_sector + n) % num_sectors;
+        const uint8_t *base = region + (size_t)sector * PACKED_RECORD_SECTOR_SIZE;
+        if (!packed_record_header_decode(base, NULL)) continue;
+
+        for (uint32_t i = 0; i < RECORDS_PER_SECTOR; i++) {
+            const uint8_t *record = base + PACKED_RECORD_HEADER_SIZE + (size_t)i * PACKED_RECORD_RECORD_SIZE;
+            if (record[0] == 0xFF) break;  // first empty slot ends the sector
+
+            uint8_t type;
+            uint32_t timestamp;
+            const uint8_t *payload;
+            if (!packed_record_decode(record, &type, &timestamp, &payload)) {
+                skipped++;
+                continue;
+            }
+
+            printf("%u,%lu,", type, (unsigned long)timestamp);
+            for (uint32_t b = 0; b < PACKED_RECORD_PAYLOAD_SIZE; b++) printf("%02x", payload[b]);
+            printf("\n");
+            records++;
+        }
+    }
+
+    fprintf(stderr, "%lu records (%lu corrupt slots skipped)\n", records, skipped);
+    free(region);
+    return 0;
+}
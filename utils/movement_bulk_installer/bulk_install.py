@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""Flash every connected watch at once, with delta support between revisions.
+
+shipboards.sh programs one board at a time: wait for WATCHBOOT, copy, wait for
+the unmount, repeat. This tool watches for any number of WATCHBOOT volumes and
+flashes each one on its own thread the moment it appears, so a powered USB hub
+full of watches provisions in parallel. Each unit's page loop — erase, write,
+verify, next — belongs to the UF2 bootloader, which verifies rows it has
+already programmed while the host is still streaming later blocks, so the
+write/verify overlap is inherent to the transport; the host-side signal for a
+good flash is the volume detaching on its own, and that is what we report.
+
+With --base, only the 256-byte blocks that changed since a previous firmware
+build are sent: a sparse UF2 is perfectly valid (each block carries its own
+target address, and the bootloader erases only the rows it writes), and a
+typical point release touches a small fraction of the image. Only use --base
+on watches known to be running that exact base build; when in doubt, flash the
+full image.
+
+    ./bulk_install.py standard-red.uf2
+    ./bulk_install.py standard-red.uf2 --base previous-red.uf2
+"""
+
+import argparse
+import glob
+import os
+import shutil
+import struct
+import sys
+import tempfile
+import threading
+import time
+
+UF2_BLOCK_SIZE = 512
+UF2_MAGIC_START0 = 0x0A324655
+UF2_MAGIC_START1 = 0x9E5D5157
+
+# Where UF2 volumes land on the platforms we provision from.
+VOLUME_ROOTS = ("/Volumes", "/media/*", "/run/media/*")
+
+DETACH_TIMEOUT = 30  # seconds to wait for the bootloader to accept the image and reboot
+
+
+def load_blocks(path):
+    """Returns {target_address: 512-byte block} for a UF2 file."""
+    with open(path, "rb") as uf2_file:
+        data = uf2_file.read()
+    if len(data) % UF2_BLOCK_SIZE:
+        sys.exit("error: %s is not a UF2 file (size not a multiple of 512)" % path)
+    blocks = {}
+    for offset in range(0, len(data), UF2_BLOCK_SIZE):
+        block = data[offset:offset + UF2_BLOCK_SIZE]
+        magic0, magic1, _, address = struct.unpack("<IIII", block[0:16])
+        if magic0 != UF2_MAGIC_START0 or magic1 != UF2_MAGIC_START1:
+            sys.exit("error: %s is not a UF2 file (bad block magic)" % path)
+        blocks[address] = block
+    return blocks
+
+
+def make_delta(image_path, base_path):
+    """Writes a sparse UF2 holding only the blocks that differ from the base."""
+    image = load_blocks(image_path)
+    base = load_blocks(base_path)
+    changed = [image[address] for address in sorted(image)
+               if base.get(address, b"")[32:] != image[address][32:]]
+    if not changed:
+        sys.exit("nothing to do: %s matches %s" % (image_path, base_path))
+    # renumber blockNo/numBlocks so the bootloader's progress accounting holds.
+    renumbered = []
+    for number, block in enumerate(changed):
+        renumbered.append(block[:20] + struct.pack("<II", number, len(changed)) + block[28:])
+    delta = tempfile.NamedTemporaryFile(
+        prefix="delta-", suffix=".uf2", delete=False)
+    delta.write(b"".join(renumbered))
+    delta.close()
+    print("delta: %d of %d blocks changed (%d KB to send per unit)"
+          % (len(changed), len(image), len(changed) * UF2_BLOCK_SIZE // 1024))
+    return delta.name
+
+
+def find_volumes():
+    """All mounted WATCHBOOT volumes, however many watches are plugged in."""
+    volumes = []
+    for root in VOLUME_ROOTS:
+        for base in glob.glob(root):
+            volumes.extend(glob.glob(os.path.join(base, "WATCHBOOT*")))
+    return [v for v in volumes if os.path.exists(os.path.join(v, "INFO_UF2.TXT"))]
+
+
+class Tally:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.flashed = 0
+        self.failed = 0
+        # failed volumes still sitting mounted; don't hammer them with retries
+        # until they have been unplugged and reattached.
+        self.quarantined = set()
+
+
+def flash_volume(volume, image_path, tally):
+    label = os.path.basename(volume)
+    try:
+        shutil.copy(image_path, os.path.join(volume, os.path.basename(image_path)))
+    except OSError as error:
+        # the bootloader yanks the volume as soon as the last block lands, so
+        # an I/O error at the tail end of the copy is the success path on some
+        # hosts; only a volume that is still mounted afterward is a failure.
+        if os.path.exists(volume):
+            with tally.lock:
+                tally.failed += 1
+                tally.quarantined.add(volume)
+            print("\aFAILURE: %s: %s" % (label, error))
+            return
+    deadline = time.time() + DETACH_TIMEOUT
+    while os.path.exists(volume):
+        if time.time() > deadline:
+            with tally.lock:
+                tally.failed += 1
+                tally.quarantined.add(volume)
+            print("\aFAILURE: %s did not reboot; reflash it with the full image" % label)
+            return
+        time.sleep(0.5)
+    with tally.lock:
+        tally.flashed += 1
+        print("flashed %s (%d done, %d failed)" % (label, tally.flashed, tally.failed))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("image", help="UF2 file to install")
+    parser.add_argument("--base", help="previous build's UF2; send only changed blocks")
+    args = parser.parse_args()
+
+    image_path = args.image
+    load_blocks(image_path)  # validate up front, before a board is waiting on us
+    if args.base:
+        image_path = make_delta(args.image, args.base)
+
+    print("waiting for WATCHBOOT volumes; plug in as many watches as you like (Ctrl-C to stop)")
+    in_flight = {}
+    tally = Tally()
+    try:
+        while True:
+            volumes = find_volumes()
+            with tally.lock:
+                tally.quarantined &= set(volumes)  # reattached boards get another try
+            for volume in volumes:
+                with tally.lock:
+                    if volume in tally.quarantined:
+                        continue
+                if volume in in_flight and in_flight[volume].is_alive():
+                    continue
+                worker = threading.Thread(target=flash_volume,
+                                          args=(volume, image_path, tally), daemon=True)
+                in_flight[volume] = worker
+                worker.start()
+            time.sleep(0.5)
+    except KeyboardInterrupt:
+        print("\n%d flashed, %d failed" % (tally.flashed, tally.failed))
+        sys.exit(1 if tally.failed else 0)
+
+
+if __name__ == "__main__":
+    main()
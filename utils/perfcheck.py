@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""One quantified verdict per change: flash, static RAM, and benchmark numbers
+diffed against a committed baseline with pass/fail thresholds.
+
+Collects the flash and static RAM totals from the last build's object files
+(the same accounting as size_report.py), optionally parses a log of `bench`
+shell command output captured from the simulator or from hardware, and
+compares everything against the baseline in perf_baseline.json. Any metric
+that regresses past its threshold fails the run, so a change to movement.c,
+the display path, or a driver gets a verdict before it ships.
+
+The simulator cannot run truly headless (its display layer writes straight to
+the DOM), so benchmark numbers come in as a captured log: run `bench` from the
+on-page shell or the USB serial shell, save the output, and pass it with
+BENCH_LOG=path. Size and RAM checks need only the build directory.
+
+Normally invoked as `make perfcheck` after a build. When a regression is
+intentional, refresh the baseline with `make perfcheck-update` and commit the
+updated perf_baseline.json alongside the change that moved the numbers.
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import size_report
+
+DEFAULT_THRESHOLDS = {
+    "flash_pct": 2.0,   # flash may grow this much over baseline before failing
+    "ram_pct": 2.0,     # same for static RAM
+    "bench_pct": 15.0,  # benchmark times are noisier; allow more headroom
+    "ram_budget": 24576,  # absolute cap on statics; see ram-report in the Makefile
+}
+
+
+def collect_build_totals(build):
+    """Returns (flash_total, ram_total) from the build's object files."""
+    size_tool = size_report.find_size_tool()
+    totals = {"text": 0, "rodata": 0, "data": 0, "bss": 0}
+    seen = False
+    for dirpath, _, filenames in os.walk(build):
+        for filename in filenames:
+            if not filename.endswith(".o"):
+                continue
+            sections = size_report.object_sections(size_tool, os.path.join(dirpath, filename))
+            if sections is None:
+                continue
+            seen = True
+            for key, value in sections.items():
+                totals[key] += value
+    if not seen:
+        sys.exit("error: no object files under %s; build first" % build)
+
+    flash = sum(totals[key] for key in size_report.SECTION_GROUPS["flash"])
+    ram = sum(totals[key] for key in size_report.SECTION_GROUPS["ram"])
+    return flash, ram
+
+
+def parse_bench_log(path):
+    """Parses captured `bench` output into {metric: microseconds}.
+
+    Metrics are keyed face<idx>.activate_us, face<idx>.tick_avg_us and
+    face<idx>.tick_max_us, so one log can carry runs against several faces.
+    """
+    metrics = {}
+    face = None
+    patterns = (
+        (re.compile(r"^activate:\s+(\d+) us"), "activate_us"),
+        (re.compile(r"^tick avg:\s+(\d+) us"), "tick_avg_us"),
+        (re.compile(r"^tick max:\s+(\d+) us"), "tick_max_us"),
+        (re.compile(r"^button avg:\s+(\d+) us"), "button_avg_us"),
+    )
+    with open(path) as log:
+        for line in log:
+            line = line.strip()
+            header = re.match(r"^face (\d+), \d+ ticks", line)
+            if header:
+                face = int(header.group(1))
+                continue
+            if face is None:
+                continue
+            for pattern, name in patterns:
+                match = pattern.match(line)
+                if match:
+                    metrics["face%d.%s" % (face, name)] = int(match.group(1))
+    return metrics
+
+
+def check(name, current, baseline, limit_pct, failures):
+    """Prints one metric row and records a failure if it regressed past the limit."""
+    if baseline:
+        delta_pct = 100.0 * (current - baseline) / baseline
+        verdict = "PASS" if delta_pct <= limit_pct else "FAIL"
+        note = "%+.1f%% (limit %+.1f%%)" % (delta_pct, limit_pct)
+    elif current > 0:
+        # a zero baseline can't express a percentage; any growth from zero fails
+        verdict = "FAIL"
+        note = "baseline 0"
+    else:
+        verdict = "PASS"
+        note = ""
+    if verdict == "FAIL":
+        failures.append(name)
+    print("%-24s %10d %10d  %-4s %s" % (name, baseline, current, verdict, note))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--build", default="./build", help="build directory to scan")
+    parser.add_argument("--baseline", default="perf_baseline.json", help="committed baseline file")
+    parser.add_argument("--bench", default="", help="captured `bench` shell output to check, if present")
+    parser.add_argument("--update", action="store_true", help="rewrite the baseline from this build")
+    args = parser.parse_args()
+
+    flash, ram = collect_build_totals(args.build)
+    bench = {}
+    if args.bench and os.path.exists(args.bench):
+        bench = parse_bench_log(args.bench)
+        if not bench:
+            sys.exit("error: %s contains no bench output" % args.bench)
+
+    if args.update:
+        thresholds = dict(DEFAULT_THRESHOLDS)
+        if os.path.exists(args.baseline):
+            with open(args.baseline) as baseline_file:
+                thresholds.update(json.load(baseline_file).get("thresholds", {}))
+        baseline = {"thresholds": thresholds, "flash_total": flash, "ram_total": ram}
+        if bench:
+            baseline["bench"] = bench
+        with open(args.baseline, "w") as baseline_file:
+            json.dump(baseline, baseline_file, indent=2)
+            baseline_file.write("\n")
+        print("baseline updated: flash %d, ram %d, %d bench metrics -> %s" % (
+            flash, ram, len(bench), args.baseline))
+        return
+
+    if not os.path.exists(args.baseline):
+        sys.exit("error: no baseline at %s; run `make perfcheck-update` once and commit it" % args.baseline)
+    with open(args.baseline) as baseline_file:
+        baseline = json.load(baseline_file)
+    thresholds = dict(DEFAULT_THRESHOLDS)
+    thresholds.update(baseline.get("thresholds", {}))
+
+    failures = []
+    print("%-24s %10s %10s  %s" % ("metric", "baseline", "current", "verdict"))
+    check("flash_total", flash, baseline.get("flash_total", 0), thresholds["flash_pct"], failures)
+    check("ram_total", ram, baseline.get("ram_total", 0), thresholds["ram_pct"], failures)
+    if ram > thresholds["ram_budget"]:
+        failures.append("ram_budget")
+        print("%-24s %10d %10d  FAIL over absolute budget" % ("ram_budget", thresholds["ram_budget"], ram))
+
+    baseline_bench = baseline.get("bench", {})
+    for name in sorted(bench):
+        if name in baseline_bench:
+            check(name, bench[name], baseline_bench[name], thresholds["bench_pct"], failures)
+        else:
+            print("%-24s %10s %10d  --   new metric (not in baseline)" % (name, "-", bench[name]))
+    for name in sorted(baseline_bench):
+        if name not in bench:
+            print("%-24s %10d %10s  --   not measured this run" % (name, baseline_bench[name], "-"))
+
+    if failures:
+        sys.exit("perfcheck FAILED: %s" % ", ".join(failures))
+    print("perfcheck passed.")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""Per-face flash and RAM budget report for Movement builds.
+
+Walks the object files of the last build, attributes .text/.rodata/.data/.bss
+to each watch face and to the bundled libraries (utz, littlefs, tinyusb, the
+lib/ helpers, the watch library and gossamer), and prints a table sorted by
+flash cost. The totals from each run are stashed in the build directory so the
+next run can print deltas; that is the number to watch when deciding whether a
+face earns its keep.
+
+With --ram the table reports static RAM (.data + .bss) instead, sorted by RAM
+cost; rows with .data are the ones to audit, since an initialized table that
+nobody writes could be const flash data. --budget BYTES makes the run fail
+when the static RAM total exceeds the budget, so the build catches creep.
+
+Normally invoked as `make size-report` or `make ram-report` after a build; see
+the Makefile.
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+SECTION_GROUPS = {
+    "flash": ("text", "rodata", "data"),  # .data costs flash for its initializers
+    "ram": ("data", "bss"),
+}
+
+
+def find_size_tool():
+    for tool in ("arm-none-eabi-size", "size"):
+        if shutil.which(tool):
+            return tool
+    sys.exit("error: need arm-none-eabi-size (or size) on PATH")
+
+
+def object_sections(size_tool, path):
+    """Returns {text, rodata, data, bss} for one object file, in bytes."""
+    out = subprocess.run([size_tool, "-A", path], capture_output=True, text=True)
+    if out.returncode != 0:
+        return None
+    sections = {"text": 0, "rodata": 0, "data": 0, "bss": 0}
+    for line in out.stdout.splitlines():
+        match = re.match(r"^(\.\S+)\s+(\d+)", line)
+        if not match:
+            continue
+        name, size = match.group(1), int(match.group(2))
+        if name.startswith(".text"):
+            sections["text"] += size
+        elif name.startswith(".rodata"):
+            sections["rodata"] += size
+        elif name.startswith(".data"):
+            sections["data"] += size
+        elif name.startswith(".bss"):
+            sections["bss"] += size
+    return sections
+
+
+def classify(rel_path, face_stems):
+    """Maps an object file to a report row: a face name or a library bucket."""
+    stem = os.path.splitext(os.path.basename(rel_path))[0]
+    if stem in face_stems:
+        return stem
+    # Some builds keep the source tree layout under the build directory; use it
+    # when present, and fall back to filename conventions when objects are flat.
+    if "littlefs" in rel_path or stem.startswith("lfs"):
+        return "(littlefs)"
+    if "utz" in rel_path or stem in ("utz", "zones"):
+        return "(utz)"
+    if "tinyusb" in rel_path or stem.startswith(("tusb", "usbd", "cdc_device", "dcd_")):
+        return "(tinyusb)"
+    if "gossamer" in rel_path:
+        return "(gossamer)"
+    if "watch-library" in rel_path or stem.startswith("watch"):
+        return "(watch library)"
+    if "watch-faces" in rel_path:
+        return stem  # a face added without updating watch-faces.mk
+    return "(other)"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--build", default="./build", help="build directory to scan")
+    parser.add_argument("--faces", default="", help="face source list, as passed by make")
+    parser.add_argument("--ram", action="store_true", help="report static RAM (.data + .bss) instead of flash")
+    parser.add_argument("--budget", type=int, default=0, help="fail if the total exceeds this many bytes")
+    args = parser.parse_args()
+
+    if not os.path.isdir(args.build):
+        sys.exit("error: no build directory at %s; build first" % args.build)
+
+    face_stems = set()
+    for src in args.faces.split():
+        face_stems.add(os.path.splitext(os.path.basename(src))[0])
+
+    size_tool = find_size_tool()
+    rows = {}
+    for dirpath, _, filenames in os.walk(args.build):
+        for filename in filenames:
+            if not filename.endswith(".o"):
+                continue
+            path = os.path.join(dirpath, filename)
+            sections = object_sections(size_tool, path)
+            if sections is None:
+                continue
+            row = classify(os.path.relpath(path, args.build), face_stems)
+            bucket = rows.setdefault(row, {"text": 0, "rodata": 0, "data": 0, "bss": 0})
+            for key, value in sections.items():
+                bucket[key] += value
+
+    if not rows:
+        sys.exit("error: no object files under %s; build first" % args.build)
+
+    group = "ram" if args.ram else "flash"
+    previous = {}
+    baseline_path = os.path.join(args.build, "%s-report.json" % ("ram" if args.ram else "size"))
+    if os.path.exists(baseline_path):
+        with open(baseline_path) as baseline_file:
+            previous = json.load(baseline_file)
+
+    def cost(sections):
+        return sum(sections[key] for key in SECTION_GROUPS[group])
+
+    if args.ram:
+        print("%-32s %8s %8s %8s  %s" % ("", "data", "bss", "ram", "delta"))
+    else:
+        print("%-32s %8s %8s %8s %8s  %s" % ("", "text", "rodata", "bss", "flash", "delta"))
+    total = 0
+    total_delta = 0
+    for row in sorted(rows, key=lambda name: -cost(rows[name])):
+        sections = rows[row]
+        row_cost = cost(sections)
+        total += row_cost
+        delta = ""
+        if row in previous:
+            diff = row_cost - cost(previous[row])
+            total_delta += diff
+            if diff:
+                delta = "%+d" % diff
+        elif previous:
+            delta = "new"
+            total_delta += row_cost
+        if args.ram:
+            if row_cost == 0 and not delta:
+                continue
+            print("%-32s %8d %8d %8d  %s" % (
+                row, sections["data"], sections["bss"], row_cost, delta))
+        else:
+            print("%-32s %8d %8d %8d %8d  %s" % (
+                row, sections["text"], sections["rodata"], sections["bss"], row_cost, delta))
+    for row in previous:
+        if row not in rows:
+            diff = -cost(previous[row])
+            total_delta += diff
+            print("%-32s %8s %8s %8s %8s  %+d (removed)" % (row, "-", "-", "-", "-", diff))
+
+    delta_note = (" (%+d since last report)" % total_delta) if previous and total_delta else ""
+    label = "total static ram from objects" if args.ram else "total flash from objects"
+    print("%-32s %35d%s" % (label, total, delta_note))
+    if args.ram:
+        print("note: totals exclude the stack, heap, and linker padding.")
+    else:
+        print("note: totals exclude linker padding and garbage collection; the elf is smaller.")
+
+    with open(baseline_path, "w") as baseline_file:
+        json.dump(rows, baseline_file, indent=2)
+
+    if args.budget and total > args.budget:
+        sys.exit("error: static RAM total %d exceeds budget %d by %d bytes" % (
+            total, args.budget, total - args.budget))
+
+
+if __name__ == "__main__":
+    main()
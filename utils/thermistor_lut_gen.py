@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Generate the fixed-point thermistor lookup table.
+
+Reads the THERMISTOR_* divider constants out of thermistor_driver.h and emits
+watch-library/shared/driver/thermistor_lut.h: a 65-knot table of decidegrees
+Celsius indexed by the upper bits of the 16-bit oversampled ADC reading, so
+the driver converts a sample with a shift, a table load and one multiply for
+the linear interpolation — no log(), no soft-float.
+
+The knots sit every 1024 ADC counts across the full 16-bit range. Over the
+range the hardware can plausibly report on a wrist (about -10 to +60 degrees C)
+the interpolation error of the beta-model curve is under 0.03 degrees, well
+inside the table's own 0.1 degree quantization. Outside the physically
+meaningful ADC range the entries are clamped; the driver's init() already
+rejects readings out there as "no thermistor".
+
+The output is committed; rerun only if the divider constants change:
+
+    python3 utils/thermistor_lut_gen.py
+"""
+
+import math
+import os
+import re
+
+SOURCE = "watch-library/shared/driver/thermistor_driver.h"
+OUTPUT = "watch-library/shared/driver/thermistor_lut.h"
+
+STEP_SHIFT = 10
+STEP = 1 << STEP_SHIFT
+KNOTS = (65536 >> STEP_SHIFT) + 1
+
+# decidegrees; far beyond anything the divider can produce, but keeps the
+# clamped edge entries monotonic and safely inside int16.
+T_MIN = -999
+T_MAX = 1999
+
+
+def read_constants(path):
+    text = open(path).read()
+    constants = {}
+    for name in ("HIGH_SIDE", "B_COEFFICIENT", "NOMINAL_TEMPERATURE",
+                 "NOMINAL_RESISTANCE", "SERIES_RESISTANCE"):
+        match = re.search(r"#define THERMISTOR_%s \(([^)]+)\)" % name, text)
+        if not match:
+            raise SystemExit("could not find THERMISTOR_%s in %s" % (name, path))
+        value = match.group(1)
+        constants[name] = value == "true" if name == "HIGH_SIDE" else float(value)
+    return constants
+
+
+def temperature(value, c):
+    """The beta-model conversion from watch_utility_thermistor_temperature."""
+    if c["HIGH_SIDE"]:
+        if value <= 0:
+            return T_MIN / 10.0
+        reading = (1023.0 * c["SERIES_RESISTANCE"]) / (value / 64.0)
+        reading -= c["SERIES_RESISTANCE"]
+    else:
+        if value >= 65535:
+            return T_MAX / 10.0
+        reading = c["SERIES_RESISTANCE"] / (65535.0 / value - 1.0)
+    if reading <= 0:
+        return T_MAX / 10.0
+    reading = math.log(reading / c["NOMINAL_RESISTANCE"])
+    reading /= c["B_COEFFICIENT"]
+    reading += 1.0 / (c["NOMINAL_TEMPERATURE"] + 273.15)
+    return 1.0 / reading - 273.15
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    constants = read_constants(os.path.join(root, SOURCE))
+
+    knots = []
+    for i in range(KNOTS):
+        t = round(temperature(i * STEP, constants) * 10)
+        knots.append(max(T_MIN, min(T_MAX, int(t))))
+
+    # report the worst interpolation + quantization error across the wearable range
+    worst = 0.0
+    for value in range(11800, 50500):
+        a = knots[value >> STEP_SHIFT]
+        b = knots[(value >> STEP_SHIFT) + 1]
+        approx = (a + (b - a) * (value & (STEP - 1)) / STEP) / 10.0
+        worst = max(worst, abs(approx - temperature(value, constants)))
+
+    with open(os.path.join(root, OUTPUT), "w") as out:
+        out.write("/* SPDX-License-Identifier: MIT */\n")
+        out.write("/* Generated by utils/thermistor_lut_gen.py -- do not edit by hand.\n")
+        out.write(" * ADC reading (16-bit, oversampled) to decidegrees Celsius, one knot\n")
+        out.write(" * every %d counts; interpolate linearly between adjacent knots.\n" % STEP)
+        out.write(" * Worst case error across -10..+60 C: %.3f degrees. */\n\n" % worst)
+        out.write("#pragma once\n\n")
+        out.write("#include <stdint.h>\n\n")
+        out.write("#define THERMISTOR_LUT_SHIFT %d\n" % STEP_SHIFT)
+        out.write("#define THERMISTOR_LUT_STEP %d\n\n" % STEP)
+        out.write("static const int16_t thermistor_lut_decidegrees[%d] = {\n" % KNOTS)
+        for i in range(0, KNOTS, 8):
+            row = ", ".join("%6d" % k for k in knots[i:i + 8])
+            out.write("    %s,\n" % row)
+        out.write("};\n")
+
+    print("wrote %s (%d knots, worst case error %.3f C)" % (OUTPUT, KNOTS, worst))
+
+
+if __name__ == "__main__":
+    main()
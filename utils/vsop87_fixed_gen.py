@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""Generate fixed-point VSOP87 term tables from the legacy double library.
+
+Parses legacy/lib/vsop87/vsop87a_milli.c (public domain, Greg Miller's
+VSOP87-Multilang) and emits lib/vsop87/vsop87_fixed_data.h: per-planet
+cosine-series term tables truncated so the dropped terms cost less than
+a few arcseconds of heliocentric position, which keeps the fixed-point
+evaluator inside an arcminute of the double-precision original in
+geocentric coordinates over 1900-2100.
+
+Term encoding (12 bytes each, matching vsop87_fixed.c):
+  amp    int32, amplitude in AU as Q6.25
+  phase  uint32, phase as a binary fraction of a turn (2^-32 turns)
+  freq   uint32, frequency in turns per day, 2^-32 scale
+
+Angles become exact modular arithmetic on uint32 turns: phase + freq*days
+wraps at 2^32 precisely where the angle wraps at 360 degrees.
+
+The output is committed; rerun only if the truncation budget changes:
+
+    python3 utils/vsop87_fixed_gen.py
+"""
+
+import math
+import os
+import re
+import sys
+
+SOURCE = "legacy/lib/vsop87/vsop87a_milli.c"
+OUTPUT = "lib/vsop87/vsop87_fixed_data.h"
+
+BODIES = ["mercury", "venus", "earth", "mars", "jupiter", "saturn", "uranus", "neptune"]
+
+# |t| in Julian millennia the tables must stay accurate over: 1900-2100.
+T_MAX = 0.1
+# Per-coordinate truncation budget as an angle at the body's mean distance.
+# 3e-5 rad is about 6 arcseconds heliocentric; geocentric geometry amplifies
+# coordinate error by (r_planet + r_earth) / separation -- around 5x for Mars
+# at opposition -- so the heliocentric budget has to be this tight for the
+# geocentric result to stay inside an arcminute everywhere.
+ANGLE_BUDGET_RAD = 3e-5
+
+DAYS_PER_MILLENNIUM = 365250.0
+TWO_PI = 2.0 * math.pi
+
+TERM_RE = re.compile(r"(\w+)_([xyz])_(\d+)\+=\s*([0-9.]+)\s*\*\s*cos\(\s*([0-9.]+)\s*\+\s*([0-9.]+)\s*\*t\)")
+
+
+def parse(path):
+    """-> {body: {coord: {power: [(amp, phase, freq_rad_per_millennium)]}}}"""
+    series = {}
+    with open(path) as f:
+        for line in f:
+            m = TERM_RE.search(line)
+            if not m:
+                continue
+            body, coord, power, amp, phase, freq = m.groups()
+            if body not in series:
+                series[body] = {c: {} for c in "xyz"}
+            series[body][coord].setdefault(int(power), []).append(
+                (float(amp), float(phase), float(freq)))
+    return series
+
+
+def truncate(terms, budget_au):
+    """Drop the smallest terms whose summed worst-case contribution fits the budget."""
+    # weight t^k series by the largest |t^k| in the window
+    weighted = sorted(terms, key=lambda t: t[0] * (T_MAX ** t[3]))
+    dropped = 0.0
+    keep_from = 0
+    for i, t in enumerate(weighted):
+        eff = t[0] * (T_MAX ** t[3])
+        if dropped + eff > budget_au:
+            break
+        dropped += eff
+        keep_from = i + 1
+    return weighted[keep_from:]
+
+
+def encode(amp, phase, freq):
+    amp_q25 = round(amp * (1 << 25))
+    assert -2**31 <= amp_q25 < 2**31
+    phase_u32 = round((phase / TWO_PI % 1.0) * 2**32) % 2**32
+    freq_turns_per_day = freq / TWO_PI / DAYS_PER_MILLENNIUM
+    assert freq_turns_per_day < 0.5, "frequency would alias against the day grid"
+    freq_u32 = round(freq_turns_per_day * 2**32)
+    return amp_q25, phase_u32, freq_u32
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    series = parse(os.path.join(root, SOURCE))
+
+    out = []
+    out.append("// Generated by utils/vsop87_fixed_gen.py from %s." % SOURCE)
+    out.append("// Do not edit by hand; see that script for the encoding and truncation rules.")
+    out.append("")
+    out.append("#pragma once")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("typedef struct {")
+    out.append("    int32_t amp;     // AU, Q6.25")
+    out.append("    uint32_t phase;  // turns, 2^-32")
+    out.append("    uint32_t freq;   // turns per day, 2^-32")
+    out.append("} vsop87_fixed_term_t;")
+    out.append("")
+    out.append("#define VSOP87_FIXED_MAX_POWER (%d)" % max(
+        p for b in BODIES for c in "xyz" for p in series[b][c]))
+    out.append("")
+    out.append("typedef struct {")
+    out.append("    const vsop87_fixed_term_t *terms;   // x powers 0..n, then y, then z")
+    out.append("    uint8_t counts[3][VSOP87_FIXED_MAX_POWER + 1];")
+    out.append("} vsop87_fixed_body_series_t;")
+    out.append("")
+
+    max_power = max(p for b in BODIES for c in "xyz" for p in series[b][c])
+    total_terms = 0
+    for body in BODIES:
+        # mean distance from the dominant power-0 x amplitude
+        r_mean = max(a for a, p, f in series[body]["x"].get(0, [(1, 0, 0)]))
+        budget = r_mean * ANGLE_BUDGET_RAD
+
+        flat = []
+        counts = {c: [0] * (max_power + 1) for c in "xyz"}
+        for coord in "xyz":
+            coord_terms = []
+            for power, terms in series[body][coord].items():
+                coord_terms.extend((a, p, f, power) for a, p, f in terms)
+            kept = truncate(coord_terms, budget)
+            for power in range(max_power + 1):
+                power_terms = sorted((t for t in kept if t[3] == power), reverse=True)
+                counts[coord][power] = len(power_terms)
+                flat.extend(power_terms)
+        total_terms += len(flat)
+
+        out.append("static const vsop87_fixed_term_t _vsop87_%s_terms[%d] = {" % (body, len(flat)))
+        for amp, phase, freq, power in flat:
+            a, p, f = encode(amp, phase, freq)
+            out.append("    { %d, %uu, %uu }," % (a, p, f))
+        out.append("};")
+        out.append("")
+
+    out.append("static const vsop87_fixed_body_series_t _vsop87_bodies[] = {")
+    for body in BODIES:
+        r_mean = max(a for a, p, f in series[body]["x"].get(0, [(1, 0, 0)]))
+        budget = r_mean * ANGLE_BUDGET_RAD
+        counts = {c: [0] * (max_power + 1) for c in "xyz"}
+        for coord in "xyz":
+            coord_terms = []
+            for power, terms in series[body][coord].items():
+                coord_terms.extend((a, p, f, power) for a, p, f in terms)
+            kept = truncate(coord_terms, budget)
+            for power in range(max_power + 1):
+                counts[coord][power] = len([t for t in kept if t[3] == power])
+        rows = ", ".join("{ %s }" % ", ".join(str(n) for n in counts[c]) for c in "xyz")
+        out.append("    { _vsop87_%s_terms, { %s } }," % (body, rows))
+    out.append("};")
+    out.append("")
+
+    path = os.path.join(root, OUTPUT)
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w") as f:
+        f.write("\n".join(out) + "\n")
+    print("wrote %s: %d terms, %d bytes of tables" % (OUTPUT, total_terms, total_terms * 12))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
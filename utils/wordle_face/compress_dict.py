@@ -0,0 +1,157 @@
+"""Compress a plain wordle_face_dict.h into the bit-packed format.
+
+Reads a dictionary header in the old plain-string format (as printed by
+wordle_list.py) and writes the compressed header used by wordle_face:
+
+  - The answer list is packed 5 bits per letter into one uint32_t per word
+    (A=0 .. Z=25, first letter in the most significant bits), keeping the
+    original order so the random-guess tiers still work.
+  - The full guess dictionary (answers + guess-only words) is sorted and
+    front-coded: words are grouped into blocks of 16, the first word of each
+    block is stored verbatim in a uint32_t array (which doubles as the binary
+    search index), and each following word is stored in a bit stream as a
+    3-bit shared-prefix length plus 5 bits per remaining letter.
+
+Usage:
+    python wordle_list.py | python compress_dict.py > ../../watch-faces/complication/wordle_face_dict.h
+    python compress_dict.py plain_dict.h > ../../watch-faces/complication/wordle_face_dict.h
+"""
+
+import re
+import sys
+
+BLOCK_SHIFT = 4
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+WORD_LENGTH = 5
+
+
+def pack(word):
+    value = 0
+    for ch in word:
+        value = (value << 5) | (ord(ch) - ord('A'))
+    return value
+
+
+def parse_plain_header(text):
+    """Extract the letter list and both word lists from the plain header."""
+    letters = re.search(r'_valid_letters\[\]\s*=\s*\{([^}]*)\}', text).group(1)
+    letters = re.findall(r"'([A-Z])'", letters)
+
+    def words_of(name):
+        body = re.search(name + r'\[\]\[WORDLE_LENGTH \+ 1\]\s*=\s*\{(.*?)\n\};', text, re.S).group(1)
+        return re.findall(r'"([A-Z]{%d})"' % WORD_LENGTH, body)
+
+    return letters, words_of('_valid_words'), words_of('_possible_words')
+
+
+class BitStream:
+    def __init__(self):
+        self.bits = []
+
+    def append(self, value, count):
+        for i in range(count):
+            self.bits.append((value >> i) & 1)
+
+    def bytes(self):
+        # pad with three zero bytes so the 4-byte reads in the decoder
+        # never run off the end of the array
+        data = bytearray((len(self.bits) + 7) // 8 + 3)
+        for i, bit in enumerate(self.bits):
+            data[i >> 3] |= bit << (i & 7)
+        return data
+
+
+def front_code(sorted_packed):
+    block_first = []
+    block_offset = []
+    stream = BitStream()
+    previous = 0
+    for i, word in enumerate(sorted_packed):
+        if i % BLOCK_SIZE == 0:
+            block_first.append(word)
+            block_offset.append(len(stream.bits))
+        else:
+            prefix = 0
+            while prefix < WORD_LENGTH - 1:
+                shift = (WORD_LENGTH - 1 - prefix) * 5
+                if (word >> shift) != (previous >> shift):
+                    break
+                prefix += 1
+            suffix_letters = WORD_LENGTH - prefix
+            stream.append(prefix, 3)
+            stream.append(word & ((1 << (suffix_letters * 5)) - 1), suffix_letters * 5)
+        previous = word
+    return block_first, block_offset, stream.bytes()
+
+
+def emit_table(out, values, fmt, per_row):
+    for i in range(0, len(values), per_row):
+        out.write('    ' + ''.join(fmt % v for v in values[i:i + per_row]).rstrip() + '\n')
+
+
+def main():
+    text = open(sys.argv[1]).read() if len(sys.argv) > 1 else sys.stdin.read()
+    letters, valid_words, possible_words = parse_plain_header(text)
+
+    answers = [pack(w) for w in valid_words]
+    dictionary = sorted(set(answers) | {pack(w) for w in possible_words})
+    block_first, block_offset, stream = front_code(dictionary)
+    assert max(block_offset) < 0x10000, "bit offsets no longer fit in uint16_t"
+
+    out = sys.stdout
+    out.write('#ifndef WORDLE_FACE_DICT_H_\n')
+    out.write('#define WORDLE_FACE_DICT_H_\n')
+    out.write('\n// Generated by utils/wordle_face/compress_dict.py; do not edit by hand.\n')
+    out.write('// See that script for the bit-packed dictionary layout.\n')
+    out.write('\n#ifndef WORDLE_LENGTH\n#define WORDLE_LENGTH 5\n#endif\n')
+    out.write('\n#ifndef WORDLE_USE_RANDOM_GUESS\n#define WORDLE_USE_RANDOM_GUESS 2\n#endif\n\n')
+
+    out.write('static const char _valid_letters[] = {%s};\n\n' %
+              ', '.join("'%s'" % l for l in letters))
+
+    out.write('// Answer words, 5 bits per letter (A=0), first letter in the top bits.\n')
+    out.write('// Original order preserved: the random-guess tiers index into this array.\n')
+    out.write('#define WORDLE_NUM_WORDS %d\n' % len(answers))
+    out.write('static const uint32_t _valid_words[WORDLE_NUM_WORDS] = {\n')
+    emit_table(out, answers, '0x%07x, ', 8)
+    out.write('};\n\n')
+
+    out.write('#if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES\n')
+    out.write('// Every accepted guess (answers included), sorted. The first word of each\n')
+    out.write('// 16-word block is stored verbatim below and binary searched; the rest are\n')
+    out.write('// front-coded in _dict_stream as 3 bits of shared-prefix length plus\n')
+    out.write('// 5 bits per remaining letter, least significant bit first.\n')
+    out.write('#define WORDLE_DICT_WORDS %d\n' % len(dictionary))
+    out.write('#define WORDLE_DICT_BLOCK_SHIFT %d\n' % BLOCK_SHIFT)
+    out.write('#define WORDLE_DICT_BLOCKS %d\n' % len(block_first))
+    out.write('static const uint32_t _dict_block_first[WORDLE_DICT_BLOCKS] = {\n')
+    emit_table(out, block_first, '0x%07x, ', 8)
+    out.write('};\n')
+    out.write('static const uint16_t _dict_block_offset[WORDLE_DICT_BLOCKS] = {\n')
+    emit_table(out, block_offset, '%5d, ', 12)
+    out.write('};\n')
+    out.write('static const uint8_t _dict_stream[%d] = {\n' % len(stream))
+    emit_table(out, stream, '0x%02x, ', 16)
+    out.write('};\n')
+    out.write('#endif // !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES\n\n')
+
+    out.write('#if (WORDLE_USE_RANDOM_GUESS == 3)\n')
+    out.write('static const uint16_t _num_random_guess_words = 13;  '
+              '// The valid_words array begins with this many words that are considered the top 3% best options.\n')
+    out.write('#elif (WORDLE_USE_RANDOM_GUESS == 2)\n')
+    out.write('static const uint16_t _num_random_guess_words = 257;  '
+              '// The valid_words array begins with this many words where each letter is different.\n')
+    out.write('#elif (WORDLE_USE_RANDOM_GUESS == 1)\n')
+    out.write('static const uint16_t _num_random_guess_words = WORDLE_NUM_WORDS;\n')
+    out.write('#endif\n\n')
+
+    out.write('#endif // WORDLE_FACE_DICT_H_\n')
+
+    old = (len(answers) + len(possible_words)) * (WORD_LENGTH + 1)
+    new = len(answers) * 4 + len(block_first) * 6 + len(stream)
+    sys.stderr.write('dictionary: %d words, %d -> %d bytes (%.0f%% smaller)\n' %
+                     (len(dictionary), old, new, 100.0 * (old - new) / old))
+
+
+if __name__ == "__main__":
+    main()
@@ -1,4 +1,6 @@
-SRCS += \
+# Faces build as part of SRCS below, but keep their own list so tooling
+# (the size-report target) can tell face objects from everything else.
+FACE_SRCS += \
   ./watch-faces/clock/clock_face.c \
   ./watch-faces/clock/beats_face.c \
   ./watch-faces/clock/world_clock_face.c \
@@ -22,18 +24,21 @@ SRCS += \
   ./watch-faces/demo/character_set_face.c \
   ./watch-faces/demo/light_sensor_face.c \
   ./watch-faces/demo/peek_memory_face.c \
+  ./watch-faces/demo/profiler_face.c \
   ./watch-faces/demo/rtccount_face.c \
   ./watch-faces/sensor/accelerometer_status_face.c \
   ./watch-faces/sensor/temperature_display_face.c \
   ./watch-faces/sensor/temperature_logging_face.c \
   ./watch-faces/sensor/activity_logging_face.c \
   ./watch-faces/sensor/voltage_face.c \
+  ./watch-faces/sensor/battery_runtime_face.c \
   ./watch-faces/settings/set_time_face.c \
   ./watch-faces/settings/settings_face.c \
   ./watch-faces/settings/finetune_face.c \
   ./watch-faces/settings/nanosec_face.c \
   ./watch-faces/io/chirpy_demo_face.c \
   ./watch-faces/io/irda_upload_face.c \
+  ./watch-faces/io/irda_bench_face.c \
   ./watch-faces/complication/probability_face.c \
   ./watch-faces/clock/close_enough_face.c \
   ./watch-faces/complication/tarot_face.c \
@@ -55,4 +60,80 @@ SRCS += \
   ./watch-faces/complication/lander_face.c \
   ./watch-faces/complication/simon_face.c \
   ./watch-faces/complication/ping_face.c \
-# New watch faces go above this line.
+  ./watch-faces/complication/planetary_face.c \
+  ./watch-faces/complication/smallchess_face.c \
+./watch-faces/complication/morse_trainer_face.c \
+  # New watch faces go above this line.
+
+# Not a face: the fixed-timestep helper the game faces share. The shell's
+# framestat command reads its counters too, so it always builds.
+SRCS += ./watch-faces/lib/game_frame.c
+SRCS += ./watch-faces/lib/game_score.c
+
+# ----------------------------------------------------------------------------
+# Dependency metadata: the faces that pull in each optional library. When none
+# of a library's faces were chosen in movement_config.h, the library drops out
+# of the build along with the unchosen faces themselves. The buzzer, littlefs
+# and utz are dependencies of the Movement core, not of any face, so they are
+# not candidates for stripping here.
+#
+# Flags derived from the face list go in FACE_DEFINES, not DEFINES, so the
+# face-config stamp at the bottom of this file can tell when they changed.
+FACE_DEFINES :=
+CHIRPY_FACES := chirpy_demo_face
+SUNRISET_FACES := sunrise_sunset_face
+EPHEMERIS_FACES := sunrise_sunset_face moon_phase_face
+VSOP87_FACES := planetary_face
+TOTP_FACES := totp_face totp_lfs_face
+
+ifneq (,$(ACTIVE_FACES))
+ifndef FULL_BUILD
+
+# Compile only the faces chosen in movement_config.h.
+FACE_SRCS := $(filter $(foreach face,$(ACTIVE_FACES),%/$(face).c),$(FACE_SRCS))
+
+EXCLUDED_LIB_SRCS :=
+ifeq (,$(filter $(CHIRPY_FACES),$(ACTIVE_FACES)))
+  EXCLUDED_LIB_SRCS += ./lib/chirpy_tx/chirpy_tx.c
+endif
+ifeq (,$(filter $(SUNRISET_FACES),$(ACTIVE_FACES)))
+  EXCLUDED_LIB_SRCS += ./lib/sunriset/sunriset.c ./lib/sunriset/sunriset_fixed.c
+endif
+ifeq (,$(filter $(EPHEMERIS_FACES),$(ACTIVE_FACES)))
+  EXCLUDED_LIB_SRCS += ./lib/ephemeris/ephemeris.c
+  # also drops the daily priming block in movement.c
+  FACE_DEFINES += -DMOVEMENT_NO_EPHEMERIS
+endif
+ifeq (,$(filter $(VSOP87_FACES),$(ACTIVE_FACES)))
+  EXCLUDED_LIB_SRCS += ./lib/vsop87/vsop87_fixed.c
+endif
+ifeq (,$(filter $(TOTP_FACES),$(ACTIVE_FACES)))
+  EXCLUDED_LIB_SRCS += ./lib/TOTP/sha1.c ./lib/TOTP/sha256.c ./lib/TOTP/sha512.c ./lib/TOTP/TOTP.c ./lib/base32/base32.c
+endif
+
+SRCS := $(filter-out $(EXCLUDED_LIB_SRCS),$(SRCS))
+
+endif
+endif
+
+DEFINES += $(FACE_DEFINES)
+
+SRCS += $(FACE_SRCS)
+
+# ----------------------------------------------------------------------------
+# Incremental rebuild hygiene. Each face is its own translation unit, so make
+# already recompiles only the faces you touched; the weak spot is movement.c,
+# the one file that includes movement_config.h, whose object also depends on
+# FACE_DEFINES above — neither of which make's timestamp checks can see.
+# Record both in a stamp in the build directory and drop the stale movement.o
+# when they change: an edit to the face list then costs exactly one compile
+# and a relink, with no need for a clean build.
+ifeq (,$(filter clean install,$(MAKECMDGOALS)))
+FACE_CONFIG_FILE := $(or $(BUILD),./build)/face-config
+FACE_CONFIG := $(shell cksum movement_config.h 2>/dev/null) $(FACE_DEFINES)
+ifneq ($(FACE_CONFIG),$(shell cat $(FACE_CONFIG_FILE) 2>/dev/null))
+  $(shell mkdir -p $(dir $(FACE_CONFIG_FILE)); \
+          find $(dir $(FACE_CONFIG_FILE)) -name movement.o -delete 2>/dev/null; \
+          echo '$(FACE_CONFIG)' > $(FACE_CONFIG_FILE))
+endif
+endif
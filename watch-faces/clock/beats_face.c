@@ -29,26 +29,51 @@
 
 const uint8_t BEAT_REFRESH_FREQUENCY = 8;
 
+// Catch up with the real clock about once a minute, in case any ticks were
+// dropped while the main loop was busy; in between, the centibeat advances
+// by pure accumulator arithmetic.
+static const uint16_t RESYNC_INTERVAL_TICKS = 8 * 64;
+
+// Exact n / 864 for any millisecond of the day, without the runtime division
+// loop: 864 = 32 * 27, and the magic number below holds for all n >> 5 values
+// a day can produce (exhaustively verified on the host).
+static inline uint32_t _div_864(uint32_t n) {
+    return (uint32_t)((((uint64_t)(n >> 5)) * 159072863ull) >> 32);
+}
+
+// Derive the centibeat and the milliseconds toward the next one from the RTC.
+static void _beats_sync(beats_face_state_t *state, uint8_t subsecond) {
+    watch_date_time_t date_time = movement_get_utc_date_time();
+    uint8_t bmt_hour = (date_time.unit.hour + 1) % 24; // BMT = Biel Mean Time
+    uint32_t ms = ((bmt_hour * 3600 + date_time.unit.minute * 60 + date_time.unit.second) * 1000)
+                + ((subsecond * 1000) / BEAT_REFRESH_FREQUENCY);
+    state->centibeats = _div_864(ms);
+    state->rem_ms = ms - state->centibeats * 864;
+    state->ticks_to_resync = RESYNC_INTERVAL_TICKS;
+}
+
+static void _beats_display(uint32_t centibeats) {
+    char buf[16];
+    sprintf(buf, "%6u", (unsigned int)centibeats); // Cast to unsigned int to avoid compiler warnings, as centibeats is 0-100000
+    watch_display_text_with_fallback(WATCH_POSITION_TOP, "beat", "bt");
+    watch_display_text(WATCH_POSITION_BOTTOM, buf);
+}
+
 void beats_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     (void) context_ptr;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(beats_face_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(beats_face_state_t));
     }
 }
 
 void beats_face_activate(void *context) {
-    beats_face_state_t *state = (beats_face_state_t *)context;
-    state->next_subsecond_update = 0;
-    state->last_centibeat_displayed = 0;
+    (void) context;
     movement_request_tick_frequency(BEAT_REFRESH_FREQUENCY);
 }
 
 bool beats_face_loop(movement_event_t event, void *context) {
     beats_face_state_t *state = (beats_face_state_t *)context;
-    if (event.event_type == EVENT_TICK && event.subsecond != state->next_subsecond_update) {
-         return true; // math is hard, don't do it if we don't have to.
-    }
 
     char buf[16];
     uint32_t centibeats;
@@ -57,21 +82,24 @@ bool beats_face_loop(movement_event_t event, void *context) {
     uint8_t bmt_hour; // BMT = Biel Mean Time
     switch (event.event_type) {
         case EVENT_ACTIVATE:
+            _beats_sync(state, event.subsecond);
+            _beats_display(state->centibeats);
+            break;
         case EVENT_TICK:
-            date_time = movement_get_utc_date_time();
-            bmt_hour = (date_time.unit.hour + 1) % 24;
-            centibeats = clock2beats(bmt_hour, date_time.unit.minute, date_time.unit.second, event.subsecond);
-            if (centibeats == state->last_centibeat_displayed) {
-                // we missed this update, try again next subsecond
-                state->next_subsecond_update = (event.subsecond + 1) % BEAT_REFRESH_FREQUENCY;
-            } else {
-                state->next_subsecond_update = (event.subsecond + 1 + (BEAT_REFRESH_FREQUENCY * 2 / 3)) % BEAT_REFRESH_FREQUENCY;
-                state->last_centibeat_displayed = centibeats;
+            // each 8 Hz tick is exactly 125 ms and a centibeat is 864 ms, so the
+            // display advances by at most one per tick and there is nothing to
+            // divide; redraw only on the ticks where it actually moves.
+            state->rem_ms += 1000 / BEAT_REFRESH_FREQUENCY;
+            if (state->rem_ms >= 864) {
+                state->rem_ms -= 864;
+                if (++state->centibeats == 100000) state->centibeats = 0;
+                _beats_display(state->centibeats);
+            }
+            if (--state->ticks_to_resync == 0) {
+                centibeats = state->centibeats;
+                _beats_sync(state, event.subsecond);
+                if (state->centibeats != centibeats) _beats_display(state->centibeats);
             }
-            sprintf(buf, "%6u", (unsigned int)centibeats); // Cast to unsigned int to avoid compiler warnings, as centibeats is 0-100000
-
-            watch_display_text_with_fallback(WATCH_POSITION_TOP, "beat", "bt");
-            watch_display_text(WATCH_POSITION_BOTTOM, buf);
             break;
         case EVENT_LOW_ENERGY_UPDATE:
             if (!watch_sleep_animation_is_running()) watch_start_sleep_animation(432);
@@ -99,7 +127,5 @@ uint32_t clock2beats(uint32_t hours, uint32_t minutes, uint32_t seconds, uint32_
     // Calculate total milliseconds since midnight
     uint32_t ms = ((hours * 3600 + minutes * 60 + seconds) * 1000) + ((subseconds * 1000) / BEAT_REFRESH_FREQUENCY);
     // 1 beat = 86.4 seconds = 86400 ms, so 1 centibeat = 864 ms
-    uint32_t centibeats = ms / 864;
-    centibeats %= 100000;
-    return centibeats;
+    return _div_864(ms);
 }
@@ -46,8 +46,9 @@
 #include "movement.h"
 
 typedef struct {
-    int8_t next_subsecond_update;
-    uint32_t last_centibeat_displayed;
+    uint32_t centibeats;      // currently displayed centibeat, 0-99999
+    uint16_t rem_ms;          // milliseconds accumulated toward the next centibeat, 0-863
+    uint16_t ticks_to_resync; // 8 Hz ticks until the next full resync from the RTC
 } beats_face_state_t;
 
 uint32_t clock2beats(uint32_t hours, uint32_t minutes, uint32_t seconds, uint32_t subseconds);
@@ -50,18 +50,10 @@ static void clock_indicate(watch_indicator_t indicator, bool on) {
     }
 }
 
-static void clock_indicate_alarm() {
-    clock_indicate(WATCH_INDICATOR_SIGNAL, movement_alarm_enabled());
-}
-
 static void clock_indicate_time_signal(clock_state_t *state) {
     clock_indicate(WATCH_INDICATOR_BELL, state->time_signal_enabled);
 }
 
-static void clock_indicate_24h() {
-    clock_indicate(WATCH_INDICATOR_24H, !!movement_clock_mode_24h());
-}
-
 static bool clock_is_pm(watch_date_time_t date_time) {
     return date_time.unit.hour >= 12;
 }
@@ -110,20 +102,34 @@ static void clock_toggle_time_signal(clock_state_t *state) {
     clock_indicate_time_signal(state);
 }
 
-static void clock_display_all(watch_date_time_t date_time) {
+// The weekday and the day of the month change once a day, but every full repaint
+// used to re-derive them — including two runs of the day-of-week congruence in
+// watch_utility. Cache the formatted results and refresh them only when the
+// date bits of the timestamp roll over.
+static void clock_refresh_date_cache(clock_state_t *state, watch_date_time_t date_time) {
+    uint32_t key = date_time.reg >> 17;  // day, month and year: changes at midnight
+    if (state->date_cache.key == key) return;
+
+    state->date_cache.key = key;
+    state->date_cache.weekday = watch_utility_get_long_weekday(date_time);
+    state->date_cache.weekday_fallback = watch_utility_get_weekday(date_time);
+    watch_format_two_digits(state->date_cache.day_digits, date_time.unit.day,
+                            movement_clock_mode_24h() == MOVEMENT_CLOCK_MODE_024H);
+}
+
+static void clock_display_all(clock_state_t *state, watch_date_time_t date_time) {
     char buf[8 + 1];
+    bool leading_zero = movement_clock_mode_24h() == MOVEMENT_CLOCK_MODE_024H;
 
-    snprintf(
-        buf,
-        sizeof(buf),
-        movement_clock_mode_24h() == MOVEMENT_CLOCK_MODE_024H ? "%02d%02d%02d%02d" : "%2d%2d%02d%02d",
-        date_time.unit.day,
-        date_time.unit.hour,
-        date_time.unit.minute,
-        date_time.unit.second
-    );
-
-    watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, watch_utility_get_long_weekday(date_time), watch_utility_get_weekday(date_time));
+    clock_refresh_date_cache(state, date_time);
+    buf[0] = state->date_cache.day_digits[0];
+    buf[1] = state->date_cache.day_digits[1];
+    watch_format_two_digits(buf + 2, date_time.unit.hour, leading_zero);
+    watch_format_two_digits(buf + 4, date_time.unit.minute, true);
+    watch_format_two_digits(buf + 6, date_time.unit.second, true);
+    buf[8] = 0;
+
+    watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, state->date_cache.weekday, state->date_cache.weekday_fallback);
     watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
     watch_display_text(WATCH_POSITION_BOTTOM, buf + 2);
 }
@@ -132,26 +138,15 @@ static bool clock_display_some(watch_date_time_t current, watch_date_time_t prev
     if ((current.reg >> 6) == (previous.reg >> 6)) {
         // everything before seconds is the same, don't waste cycles setting those segments.
 
-        watch_display_character_lp_seconds('0' + current.unit.second / 10, 8);
-        watch_display_character_lp_seconds('0' + current.unit.second % 10, 9);
+        watch_display_seconds(current.unit.second);
 
         return true;
 
     } else if ((current.reg >> 12) == (previous.reg >> 12)) {
         // everything before minutes is the same.
 
-        char buf[4 + 1];
-
-        snprintf(
-            buf,
-            sizeof(buf),
-            "%02d%02d",
-            current.unit.minute,
-            current.unit.second
-        );
-
-        watch_display_text(WATCH_POSITION_MINUTES, buf);
-        watch_display_text(WATCH_POSITION_SECONDS, buf + 2);
+        watch_display_u8(WATCH_POSITION_MINUTES, current.unit.minute, true);
+        watch_display_seconds(current.unit.second);
 
         return true;
 
@@ -167,38 +162,32 @@ static void clock_display_clock(clock_state_t *state, watch_date_time_t current)
             clock_indicate_pm(current);
             current = clock_24h_to_12h(current);
         }
-        clock_display_all(current);
+        clock_display_all(state, current);
     }
 }
 
-static void clock_display_low_energy(watch_date_time_t date_time) {
+static void clock_display_low_energy(clock_state_t *state, watch_date_time_t date_time) {
     if (movement_clock_mode_24h() == MOVEMENT_CLOCK_MODE_12H) {
         clock_indicate_pm(date_time);
         date_time = clock_24h_to_12h(date_time);
     }
     char buf[8 + 1];
-
-    snprintf(
-        buf,
-        sizeof(buf),
-        movement_clock_mode_24h() == MOVEMENT_CLOCK_MODE_024H ? "%02d%02d%02d  " : "%2d%2d%02d  ",
-        date_time.unit.day,
-        date_time.unit.hour,
-        date_time.unit.minute
-    );
-
-    watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, watch_utility_get_long_weekday(date_time), watch_utility_get_weekday(date_time));
+    bool leading_zero = movement_clock_mode_24h() == MOVEMENT_CLOCK_MODE_024H;
+
+    clock_refresh_date_cache(state, date_time);
+    buf[0] = state->date_cache.day_digits[0];
+    buf[1] = state->date_cache.day_digits[1];
+    watch_format_two_digits(buf + 2, date_time.unit.hour, leading_zero);
+    watch_format_two_digits(buf + 4, date_time.unit.minute, true);
+    buf[6] = ' ';
+    buf[7] = ' ';
+    buf[8] = 0;
+
+    watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, state->date_cache.weekday, state->date_cache.weekday_fallback);
     watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
     watch_display_text(WATCH_POSITION_BOTTOM, buf + 2);
 }
 
-static void clock_start_tick_tock_animation(void) {
-    if (!watch_sleep_animation_is_running()) {
-        watch_start_sleep_animation(500);
-        watch_start_indicator_blink_if_possible(WATCH_INDICATOR_COLON, 500);
-    }
-}
-
 static void clock_stop_tick_tock_animation(void) {
     if (watch_sleep_animation_is_running()) {
         watch_stop_sleep_animation();
@@ -210,7 +199,7 @@ void clock_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(clock_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(clock_state_t));
         clock_state_t *state = (clock_state_t *) *context_ptr;
         state->time_signal_enabled = false;
         state->watch_face_index = watch_face_index;
@@ -222,14 +211,23 @@ void clock_face_activate(void *context) {
 
     clock_stop_tick_tock_animation();
 
-    clock_indicate_time_signal(state);
-    clock_indicate_alarm();
-    clock_indicate_24h();
+    // reconfigure all the indicators this face owns in one batch: a single
+    // commit for the ones to set, one more for the ones to clear.
+    const uint8_t owned = (1 << WATCH_INDICATOR_BELL) | (1 << WATCH_INDICATOR_SIGNAL) | (1 << WATCH_INDICATOR_24H);
+    uint8_t on = 0;
+    if (state->time_signal_enabled) on |= 1 << WATCH_INDICATOR_BELL;
+    if (movement_alarm_enabled()) on |= 1 << WATCH_INDICATOR_SIGNAL;
+    if (movement_clock_mode_24h()) on |= 1 << WATCH_INDICATOR_24H;
+    watch_set_indicators(on);
+    watch_clear_indicators(owned & ~on);
 
     watch_set_colon();
 
     // this ensures that none of the timestamp fields will match, so we can re-render them all.
     state->date_time.previous.reg = 0xFFFFFFFF;
+    // ...and this forces the cached weekday and date to re-derive, in case the time
+    // or the leading zero preference changed while another face was active.
+    state->date_cache.key = 0xFFFFFFFF;
 }
 
 bool clock_face_loop(movement_event_t event, void *context) {
@@ -238,8 +236,13 @@ bool clock_face_loop(movement_event_t event, void *context) {
 
     switch (event.event_type) {
         case EVENT_LOW_ENERGY_UPDATE:
-            clock_start_tick_tock_animation();
-            clock_display_low_energy(movement_get_local_date_time());
+            current = movement_get_local_date_time();
+            clock_display_low_energy(state, current);
+            // keep the seconds digits ticking from the RTC interrupt rather than
+            // parking the display at minute resolution; next to live seconds the
+            // tick-tock sleep animation would be redundant.
+            movement_request_low_energy_seconds();
+            watch_display_seconds(current.unit.second);
             break;
         case EVENT_TICK:
         case EVENT_ACTIVATE:
@@ -47,6 +47,12 @@ typedef struct {
     struct {
         watch_date_time_t previous;
     } date_time;
+    struct {
+        uint32_t key;                 // day/month/year bits of the last formatted date
+        const char *weekday;          // long weekday for the custom LCD...
+        const char *weekday_fallback; // ...and the two-character classic fallback
+        char day_digits[2];
+    } date_cache;
     uint8_t last_battery_check;
     uint8_t watch_face_index;
     bool time_signal_enabled;
@@ -24,7 +24,6 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 #include "close_enough_face.h"
 #include "watch.h"
 #include "watch_utility.h"
@@ -36,24 +35,21 @@
 #define CLOCK_FACE_LOW_BATTERY_VOLTAGE_THRESHOLD 2400
 #endif
 
-static const char *words[12] = {
-    "  ",
-    " 5",
-    "10",
-    "15",
-    "20",
-    "25",
-    "30",
-    "35",
-    "40",
-    "45",
-    "50",
-    "55",
+// Leading four characters of the bottom row for each five-minute period,
+// precomputed: minutes word plus " P" (past) or " 2" (to). Period 0 is the
+// special "  HH OC" layout and doesn't use this table.
+static const char period_words[12][5] = {
+    "    ",
+    " 5 P", "10 P", "15 P", "20 P", "25 P", "30 P", "35 P",
+    "20 2", "15 2", "10 2", " 5 2",
 };
 
-static const char *past_word = " P";
-static const char *to_word = " 2";
-static const char *oclock_word = "OC";
+// Space-padded hour digits, so the per-minute update is table lookups and
+// memcpy instead of sprintf.
+static const char hour_digits[24][2] = {
+    " 0", " 1", " 2", " 3", " 4", " 5", " 6", " 7", " 8", " 9", "10", "11",
+    "12", "13", "14", "15", "16", "17", "18", "19", "20", "21", "22", "23",
+};
 
 // sets when in the five minute period we switch
 // from "X past HH" to  "X to HH+1"
@@ -77,7 +73,7 @@ static void clock_indicate(watch_indicator_t indicator, bool on) {
 void close_enough_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(close_enough_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(close_enough_state_t));
         memset(*context_ptr, 0, sizeof(close_enough_state_t));
     }
 }
@@ -149,7 +145,7 @@ bool close_enough_face_loop(movement_event_t event, void *context) {
             int five_minute_period = (date_time.unit.minute / 5) % 12;
 
             // Move to next five minute period if we are above 50% through the current five minute period (we are only checking the remainder)
-            if (fmodf(date_time.unit.minute / 5.0f, 1.0f) > 0.5f) {
+            if ((date_time.unit.minute % 5) >= 3) {
                 // If we are on the last 5 interval and moving to the next period we need to display the next hour
                 if (five_minute_period == 11) {
                     show_next_hour = true;
@@ -185,50 +181,24 @@ bool close_enough_face_loop(movement_event_t event, void *context) {
                 }
             }
 
-            char first_word[3];
-            char second_word[3];
-            char third_word[3];
-            if (five_minute_period == 0) { // "  HH OC",
-                sprintf(first_word, "  ");
-                sprintf(second_word, "%2d", close_enough_hour);
-                strncpy(third_word, oclock_word, 3);
+            char words_buf[6 + 1];
+            if (five_minute_period == 0) { // "  HH OC"
+                memcpy(words_buf, "  ", 2);
+                memcpy(words_buf + 2, hour_digits[close_enough_hour], 2);
+                memcpy(words_buf + 4, "OC", 2);
             } else { // "MM P HH" or "MM 2 HH+1"
-                int words_length = sizeof(words) / sizeof(words[0]);
-
-                strncpy(
-                    first_word,
-                    show_next_hour ?
-                        words[words_length - five_minute_period] :
-                        words[five_minute_period],
-                    3
-                );
-                strncpy(
-                    second_word,
-                    show_next_hour ? to_word : past_word,
-                    3
-                );
-                sprintf(third_word, "%2d", close_enough_hour);
+                memcpy(words_buf, period_words[five_minute_period], 4);
+                memcpy(words_buf + 4, hour_digits[close_enough_hour], 2);
             }
+            words_buf[6] = '\0';
 
             watch_display_text_with_fallback(
                 WATCH_POSITION_TOP_LEFT,
                 watch_utility_get_long_weekday(date_time), watch_utility_get_weekday(date_time)
             );
 
-            char day_buf[2 + 1];
-            sprintf(day_buf, "%2d", date_time.unit.day);
-            watch_display_text(
-                WATCH_POSITION_TOP_RIGHT,
-                day_buf
-            );
+            watch_display_u8(WATCH_POSITION_TOP_RIGHT, date_time.unit.day, false);
 
-            char words_buf[6 + 1];
-            sprintf(words_buf,
-                "%s%s%s",
-                first_word,
-                second_word,
-                third_word
-            );
             watch_display_text(
                 WATCH_POSITION_BOTTOM,
                 words_buf
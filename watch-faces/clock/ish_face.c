@@ -33,6 +33,13 @@
 #define ISH_LEVEL_MIN 1
 #define ISH_LEVEL_MAX 3
 
+// Zero-padded hour digits, so the per-minute update assembles the display
+// from table lookups instead of snprintf.
+static const char _hour_digits[24][2] = {
+    "00", "01", "02", "03", "04", "05", "06", "07", "08", "09", "10", "11",
+    "12", "13", "14", "15", "16", "17", "18", "19", "20", "21", "22", "23",
+};
+
 // Check if the vague time should update based on the current minute
 static bool ish_face_should_update(ish_face_state_t *state, watch_date_time_t date_time) {
     uint8_t current_minute = date_time.unit.minute;
@@ -51,33 +58,28 @@ static void ish_face_update_display(ish_face_state_t *state, watch_date_time_t d
     char buf[8];
     uint8_t hour = date_time.unit.hour;
     uint8_t minute = date_time.unit.minute;
+    uint8_t h;
+    const char *min_str = NULL; // minute digits, or NULL to show the hour alone
     // Support 12/24h mode
     if (movement_clock_mode_24h() == MOVEMENT_CLOCK_MODE_12H) {
         hour = hour % 12;
         if (hour == 0) hour = 12;
     }
-    // Compute vague time string based on the current vagueness level
+    h = hour;
+    // Compute vague time based on the current vagueness level
     switch (state->vagueness_level) {
-        case 1: { // Level 1: Hour, switch at 30 minute mark
-            if (minute >= 30) hour = (hour + 1) % 24;
-            snprintf(buf, sizeof(buf), "%02d", hour);
+        case 1: // Level 1: Hour, switch at 30 minute mark
+            if (minute >= 30) h = (hour + 1) % 24;
             break;
-        }
-        case 2: { // Level 2: Half hour, explicit mapping, o instead of 0 to signify vagueness
-            uint8_t h = hour;
-            const char *min_str;
+        case 2: // Level 2: Half hour, explicit mapping, o instead of 0 to signify vagueness
             if (minute < 15 || minute >= 45) {
                 if (minute >= 45) h = (hour + 1) % 24;
                 min_str = "0o";
             } else {
                 min_str = "3o";
             }
-            snprintf(buf, sizeof(buf), "%02d%s", h, min_str);
             break;
-        }
-        case 3: { // Level 3: Quarter hour, explicit mapping
-            uint8_t h = hour;
-            const char *min_str;
+        case 3: // Level 3: Quarter hour, explicit mapping
             if (minute < 8) {
                 min_str = "00";
             } else if (minute < 23) {
@@ -90,17 +92,15 @@ static void ish_face_update_display(ish_face_state_t *state, watch_date_time_t d
                 h = (hour + 1) % 24;
                 min_str = "00";
             }
-            snprintf(buf, sizeof(buf), "%02d%s", h, min_str);
             break;
-        }
         default:
-            snprintf(buf, sizeof(buf), "%02d", hour);
             break;
     }
-    // Pad buf with spaces to 5 characters to clear leftover segments
-    size_t len = strlen(buf);
-    while (len < 5) buf[len++] = ' ';
-    buf[len] = '\0';
+    // Five characters, space padded to clear leftover segments
+    memcpy(buf, _hour_digits[h], 2);
+    memcpy(buf + 2, min_str ? min_str : "  ", 2);
+    buf[4] = ' ';
+    buf[5] = '\0';
     
     watch_display_text_with_fallback(WATCH_POSITION_TOP, "ISH", "SH");
     watch_display_text(WATCH_POSITION_BOTTOM, buf);
@@ -128,7 +128,7 @@ static void ish_face_stop_tick_tock_animation(void) {
 void ish_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(ish_face_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(ish_face_state_t));
         memset(*context_ptr, 0, sizeof(ish_face_state_t));
         ish_face_state_t *state = (ish_face_state_t *)*context_ptr;
         state->vagueness_level = 1; // Default to level 1 on initial load
@@ -37,29 +37,47 @@ static void _display_date(watch_date_time_t date_time) {
 
 static void _display_time(ke_decimal_time_state_t *state, watch_date_time_t date_time, bool low_energy) {
     char buf[8];
-    uint32_t value = date_time.unit.hour * 3600 + date_time.unit.minute * 60 + date_time.unit.second;
-
-    if (value == state->previous_time) return;
+    uint32_t seconds = date_time.unit.hour * 3600 + date_time.unit.minute * 60 + date_time.unit.second;
+
+    if (seconds == state->previous_time) return;
+
+    if (state->previous_time != 0xFFFFFFFF && seconds == state->previous_time + 1) {
+        // Normal tick: decimal time gains one count every 8.64 seconds, i.e.
+        // 25/216 of a count per second, so add with carry instead of dividing.
+        state->decimal_frac += 25;
+        if (state->decimal_frac >= 216) {
+            state->decimal_frac -= 216;
+            state->decimal_value++;
+            if (state->decimal_value >= 10000) state->decimal_value = 0;
+        } else {
+            // the displayed value didn't change this second
+            state->previous_time = seconds;
+            return;
+        }
+    } else {
+        // Time jumped (activation, wake, time set): recompute the accumulator.
+        // 25/216 is 100/864 reduced; this is the only division in the face.
+        uint32_t scaled = seconds * 25;
+        state->decimal_value = scaled / 216;
+        state->decimal_frac = scaled % 216;
+    }
+    state->previous_time = seconds;
 
-    value = value * 100;
-    value = value / 864;
-    snprintf(buf, sizeof(buf), "%04ld#o", value);
+    snprintf(buf, sizeof(buf), "%04u#o", state->decimal_value);
 
     // if under 10%, display 0.00 instead of 00.00
-    if (value < 1000) buf[0] = ' ';
+    if (state->decimal_value < 1000) buf[0] = ' ';
 
     // if low energy, truncate at the tens place
     if (low_energy) buf[3] = 0;
 
     watch_display_text(WATCH_POSITION_BOTTOM, buf);
-
-    state->previous_time = value;
 }
 
 void ke_decimal_time_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(ke_decimal_time_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(ke_decimal_time_state_t));
         memset(*context_ptr, 0, sizeof(ke_decimal_time_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
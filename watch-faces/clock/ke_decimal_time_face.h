@@ -41,6 +41,8 @@
 typedef struct {
     uint8_t previous_day;
     uint32_t previous_time;
+    uint16_t decimal_value; // hundredths of a percent of the day, 0-9999
+    uint8_t decimal_frac;   // accumulator remainder, in 216ths of a count
 } ke_decimal_time_state_t;
 
 void ke_decimal_time_face_setup(uint8_t watch_face_index, void ** context_ptr);
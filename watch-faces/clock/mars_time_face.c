@@ -53,22 +53,19 @@ static uint16_t landing_sols[MARS_TIME_NUM_SITES] = {
     49269,
 };
 
-typedef struct {
-    uint8_t hour;
-    uint8_t minute;
-    uint8_t second;
-} mars_clock_hms_t;
-
-static void _h_to_hms(mars_clock_hms_t *date_time, double h) {
-	unsigned int seconds = (unsigned int)(h * 3600.0);
-	date_time->hour = seconds / 3600;
-	seconds = seconds % 3600;
-	date_time->minute = floor(seconds / 60);
-	date_time->second = round(seconds % 60);
-}
-
-static void _update(mars_time_state_t *state, bool low_energy_mode) {
-    char buf[8];
+// One Earth second advances local Mars time by 1 / 1.0274912517 Mars seconds,
+// or about 973244297 nanoseconds. Accumulating this per tick keeps the per-second
+// cost down to an add and a compare; the sub-nanosecond truncation is wiped out by
+// the periodic resync below.
+static const uint32_t MARS_NS_PER_EARTH_SECOND = 973244297;
+
+// Full resyncs run this many ticks apart (and on activation or a mode change);
+// in between, Mars time advances by pure accumulator arithmetic.
+static const uint8_t RESYNC_INTERVAL_TICKS = 64;
+
+// The full epoch conversion: Earth unix time to Mars Sol Date to local Mars time.
+// This is the only place the double math runs; the tick path never touches it.
+static void _mars_time_sync(mars_time_state_t *state) {
     watch_date_time_t date_time = movement_get_local_date_time();
     uint32_t now = watch_utility_date_time_to_unix_time(date_time, movement_get_current_timezone_offset());
     // TODO: I'm skipping over some steps here.
@@ -88,23 +85,34 @@ static void _update(mars_time_state_t *state, bool low_energy_mode) {
         lmt = fmod(lmst + 24, 24);
     }
 
+    double seconds_of_sol = lmt * 3600.0;
+    uint32_t seconds = (uint32_t)seconds_of_sol;
+    state->rem_ns = (uint32_t)((seconds_of_sol - (double)seconds) * 1000000000.0);
+    state->hour = seconds / 3600;
+    seconds = seconds % 3600;
+    state->minute = seconds / 60;
+    state->second = seconds % 60;
+    // TODO: this is not right, mission sol should turn over at midnight local time?
+    state->sol = floor(msd) - landing_sols[state->current_site];
+    state->ticks_to_resync = RESYNC_INTERVAL_TICKS;
+}
+
+static void _update(mars_time_state_t *state, bool low_energy_mode) {
+    char buf[8];
+
     watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, site_names_custom[state->current_site], site_names_classic[state->current_site]);
 
     if (state->displaying_sol && !low_energy_mode) {
-        // TODO: this is not right, mission sol should turn over at midnight local time?
-        uint16_t sol = floor(msd) - landing_sols[state->current_site];
-        sprintf(buf, "%6d", sol);
+        sprintf(buf, "%6d", state->sol);
         watch_display_text(WATCH_POSITION_TOP_RIGHT, " $");
         watch_display_text(WATCH_POSITION_BOTTOM, buf);
         watch_clear_colon();
         watch_clear_indicator(WATCH_INDICATOR_24H);
     } else {
-        mars_clock_hms_t mars_time;
-        _h_to_hms(&mars_time, lmt);
         if (low_energy_mode) {
-            sprintf(buf, "%02d%02d  ", mars_time.hour, mars_time.minute);
+            sprintf(buf, "%02d%02d  ", state->hour, state->minute);
         } else {
-            sprintf(buf, "%02d%02d%02d", mars_time.hour, mars_time.minute, mars_time.second);
+            sprintf(buf, "%02d%02d%02d", state->hour, state->minute, state->second);
         }
         watch_display_text(WATCH_POSITION_TOP_RIGHT, "  ");
         watch_display_text(WATCH_POSITION_BOTTOM, buf);
@@ -116,7 +124,7 @@ static void _update(mars_time_state_t *state, bool low_energy_mode) {
 void mars_time_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(mars_time_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(mars_time_state_t));
         memset(*context_ptr, 0, sizeof(mars_time_state_t));
     }
 }
@@ -136,9 +144,31 @@ bool mars_time_face_loop(movement_event_t event, void *context) {
 
     switch (event.event_type) {
         case EVENT_ACTIVATE:
-        case EVENT_TICK:
+            _mars_time_sync(state);
             _update(state, false);
             break;
+        case EVENT_TICK:
+            // a Mars second is a touch longer than an Earth second, so roughly one
+            // tick in 37 the displayed time holds still for a beat.
+            state->rem_ns += MARS_NS_PER_EARTH_SECOND;
+            if (state->rem_ns >= 1000000000u) {
+                state->rem_ns -= 1000000000u;
+                if (++state->second == 60) {
+                    state->second = 0;
+                    if (++state->minute == 60) {
+                        state->minute = 0;
+                        if (++state->hour == 24) state->hour = 0;
+                    }
+                }
+                if (!state->displaying_sol) _update(state, false);
+            }
+            if (--state->ticks_to_resync == 0) {
+                // pick up the true clock again in case any ticks were dropped; this
+                // also refreshes the sol number shortly after it turns over.
+                _mars_time_sync(state);
+                _update(state, false);
+            }
+            break;
         case EVENT_LIGHT_BUTTON_UP:
             state->displaying_sol = !state->displaying_sol;
             _update(state, false);
@@ -148,6 +178,7 @@ bool mars_time_face_loop(movement_event_t event, void *context) {
             break;
         case EVENT_ALARM_LONG_PRESS:
             state->current_site = (state->current_site + 1) % MARS_TIME_NUM_SITES;
+            _mars_time_sync(state);
             _update(state, false);
             break;
         case EVENT_LOW_ENERGY_UPDATE:
@@ -156,6 +187,8 @@ bool mars_time_face_loop(movement_event_t event, void *context) {
                 watch_start_sleep_animation(514);
                 watch_start_indicator_blink_if_possible(WATCH_INDICATOR_COLON, 514);
             }
+            // once-a-minute updates don't accumulate; do the full conversion.
+            _mars_time_sync(state);
             _update(state, true);
             break;
         case EVENT_LIGHT_BUTTON_DOWN:
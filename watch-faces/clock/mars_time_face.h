@@ -63,6 +63,14 @@ typedef enum {
 typedef struct {
     mars_time_site_t current_site;
     bool displaying_sol;
+    // local Mars time, advanced incrementally on each 1 Hz tick and periodically
+    // resynced from the real clock
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
+    uint32_t rem_ns;          // nanoseconds accumulated toward the next Mars second
+    uint16_t sol;             // current (mission) sol for the selected site
+    uint8_t ticks_to_resync;  // ticks until the next full resync
 } mars_time_state_t;
 
 void mars_time_face_setup(uint8_t watch_face_index, void ** context_ptr);
@@ -42,7 +42,7 @@ static void persist_world_clock_settings(world_clock_state_t *state) {
 
     filesystem_read_file(filename, (char *) &maybe_settings.reg, sizeof(world_clock_settings_t));
     if (state->settings.reg != maybe_settings.reg) {
-        filesystem_write_file(filename, (char *) &state->settings.reg, sizeof(world_clock_settings_t));
+        filesystem_write_file_deferred(filename, (char *) &state->settings.reg, sizeof(world_clock_settings_t));
     }
 }
 
@@ -127,7 +127,7 @@ static void _update_timezone_offset(world_clock_state_t *state) {
 void world_clock_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(world_clock_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(world_clock_state_t));
         memset(*context_ptr, 0, sizeof(world_clock_state_t));
         world_clock_state_t *state = (world_clock_state_t *)*context_ptr;
         state->clock_index = world_clock_instances++;
@@ -169,10 +169,24 @@ static bool world_clock_face_do_display_mode(movement_event_t event, world_clock
             if (movement_clock_mode_24h()) watch_set_indicator(WATCH_INDICATOR_24H);
             watch_set_colon();
             state->previous_date_time = 0xFFFFFFFF;
+            state->previous_timestamp = 0;
             // fall through
         case EVENT_TICK:
         case EVENT_LOW_ENERGY_UPDATE:
-            date_time = movement_get_date_time_in_zone(state->settings.bit.timezone_index);
+        {
+            // in the common once-a-second case, this zone's civil time is just last
+            // tick's plus one second; the full unix-to-civil conversion only runs at
+            // minute rollover or after a discontinuity. offsets themselves come from
+            // movement's flat per-zone cache, so none of this evaluates zone rules.
+            uint32_t timestamp = movement_get_utc_timestamp();
+            date_time.reg = state->previous_date_time;
+            if (state->previous_timestamp != 0 && timestamp == state->previous_timestamp + 1 &&
+                date_time.unit.second < 59 && event.event_type == EVENT_TICK) {
+                date_time.unit.second++;
+            } else {
+                date_time = movement_get_date_time_in_zone(state->settings.bit.timezone_index);
+            }
+            state->previous_timestamp = timestamp;
             previous_date_time = state->previous_date_time;
             state->previous_date_time = date_time.reg;
             if ((date_time.reg >> 6) == (previous_date_time >> 6) && event.event_type != EVENT_LOW_ENERGY_UPDATE) {
@@ -189,7 +203,9 @@ static bool world_clock_face_do_display_mode(movement_event_t event, world_clock
                     _update_timezone_offset(state);
                 }
             } else {
-                // other stuff changed; let's do it all.
+                // other stuff changed; let's do it all, as a single atomic frame so a
+                // zone switch never shows a half-rewritten display.
+                watch_display_begin_frame();
                 if (!movement_clock_mode_24h()) {
                     // if we are in 12 hour mode, do some cleanup.
                     if (date_time.unit.hour < 12) {
@@ -218,7 +234,9 @@ static bool world_clock_face_do_display_mode(movement_event_t event, world_clock
                 } else {
                     watch_display_text(WATCH_POSITION_SECONDS, buf + 6);
                 }
+                watch_display_commit_frame();
             }
+        }
             break;
         case EVENT_ALARM_LONG_PRESS:
             movement_request_tick_frequency(4);
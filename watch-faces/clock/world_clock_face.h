@@ -63,6 +63,7 @@ typedef struct {
     uint8_t clock_index;
     uint8_t current_screen;
     uint32_t previous_date_time;
+    uint32_t previous_timestamp;
     int32_t current_offset;
 } world_clock_state_t;
 
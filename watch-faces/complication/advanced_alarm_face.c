@@ -147,6 +147,61 @@ static void _advanced_alarm_face_draw(alarm_state_t *state, uint8_t subsecond) {
     _alarm_set_signal(state);
 }
 
+static bool _alarm_day_matches(uint8_t day, uint8_t weekday_idx) {
+    if (day == ALARM_DAY_EACH_DAY || day == ALARM_DAY_ONE_TIME) return true;
+    if (day == ALARM_DAY_WORKDAY) return weekday_idx < 5;
+    if (day == ALARM_DAY_WEEKEND) return weekday_idx >= 5;
+    return day == weekday_idx;
+}
+
+// Recomputes the cached date/time of the next alarm to fire, in local wall time
+// (0 if no alarm is enabled). This runs only when the alarm configuration changes
+// or an alarm fires, so the every-minute advisory poll reduces to a single compare
+// instead of scanning repeat masks across all sixteen slots.
+static void _alarm_update_next_fire(alarm_state_t *state) {
+    watch_date_time_t now = movement_get_local_date_time();
+    uint16_t now_minutes_of_day = now.unit.hour * 60 + now.unit.minute;
+    uint8_t today_weekday = _get_weekday_idx(now);
+    uint32_t best_reg = 0;
+
+    for (uint8_t i = 0; i < ALARM_ALARMS; i++) {
+        if (!state->alarm[i].enabled) continue;
+        uint16_t alarm_minutes_of_day = state->alarm[i].hour * 60 + state->alarm[i].minute;
+        watch_date_time_t candidate = now;
+        uint8_t weekday_idx = today_weekday;
+        // start today if the alarm is still ahead of us, tomorrow otherwise,
+        // then walk forward to the first day the repeat setting allows.
+        if (alarm_minutes_of_day <= now_minutes_of_day) {
+            candidate = watch_utility_date_time_advance_day(candidate);
+            weekday_idx = (weekday_idx + 1) % 7;
+        }
+        for (uint8_t d = 0; d < 7; d++) {
+            if (_alarm_day_matches(state->alarm[i].day, weekday_idx)) break;
+            candidate = watch_utility_date_time_advance_day(candidate);
+            weekday_idx = (weekday_idx + 1) % 7;
+        }
+        candidate.unit.hour = state->alarm[i].hour;
+        candidate.unit.minute = state->alarm[i].minute;
+        candidate.unit.second = 0;
+        if (best_reg == 0 || candidate.reg < best_reg) best_reg = candidate.reg;
+    }
+
+    state->next_fire_reg = best_reg;
+    if (best_reg) {
+        watch_date_time_t best;
+        best.reg = best_reg;
+        state->next_fire_utc = watch_utility_date_time_to_unix_time(best, movement_get_current_timezone_offset());
+    } else {
+        state->next_fire_utc = 0;
+    }
+}
+
+static void _alarm_update_alarm_enabled(alarm_state_t *state) {
+    // indicate on the clock faces whether any alarm fires within the next 24 h
+    movement_set_alarm_enabled(state->next_fire_utc != 0 &&
+                               state->next_fire_utc - movement_get_utc_timestamp() < 86400);
+}
+
 static void _alarm_initiate_setting(alarm_state_t *state, uint8_t subsecond) {
     state->is_setting = true;
     state->setting_state = 0;
@@ -156,50 +211,11 @@ static void _alarm_initiate_setting(alarm_state_t *state, uint8_t subsecond) {
 
 static void _alarm_resume_setting(alarm_state_t *state, uint8_t subsecond) {
     state->is_setting = false;
+    _alarm_update_next_fire(state);
     movement_request_tick_frequency(1);
     _advanced_alarm_face_draw(state, subsecond);
 }
 
-static void _alarm_update_alarm_enabled(alarm_state_t *state) {
-    // save indication for active alarms to movement settings
-    bool active_alarms = false;
-    watch_date_time_t now;
-    bool now_init = false;
-    uint8_t weekday_idx;
-    uint16_t now_minutes_of_day;
-    uint16_t alarm_minutes_of_day;
-    for (uint8_t i = 0; i < ALARM_ALARMS; i++) {
-        if (state->alarm[i].enabled) {
-            // figure out if alarm is to go off in the next 24 h
-            if (state->alarm[i].day == ALARM_DAY_EACH_DAY || state->alarm[i].day == ALARM_DAY_ONE_TIME) {
-            active_alarms = true;
-            break;
-            } else {
-                if (!now_init) {
-                    now = movement_get_local_date_time();
-                    now_init = true;
-                    weekday_idx = _get_weekday_idx(now);
-                    now_minutes_of_day = now.unit.hour * 60 + now.unit.minute;
-                }
-                alarm_minutes_of_day = state->alarm[i].hour * 60 + state->alarm[i].minute;
-                // no more shortcuts: check days and times for all possible cases...
-                if ((state->alarm[i].day == weekday_idx && alarm_minutes_of_day >= now_minutes_of_day)
-                    || ((weekday_idx + 1) % 7 == state->alarm[i].day && alarm_minutes_of_day <= now_minutes_of_day) 
-                    || (state->alarm[i].day == ALARM_DAY_WORKDAY && (weekday_idx < 4
-                        || (weekday_idx == 4 && alarm_minutes_of_day >= now_minutes_of_day)
-                        || (weekday_idx == 6 && alarm_minutes_of_day <= now_minutes_of_day)))
-                    || (state->alarm[i].day == ALARM_DAY_WEEKEND && (weekday_idx == 5
-                        || (weekday_idx == 6 && alarm_minutes_of_day >= now_minutes_of_day)
-                        || (weekday_idx == 4 && alarm_minutes_of_day <= now_minutes_of_day)))) {
-                    active_alarms = true;
-                    break;
-                }
-            }
-        }
-    }
-    movement_set_alarm_enabled(active_alarms);
-}
-
 static void _alarm_play_short_beep(uint8_t pitch_idx) {
     // play a short double beep
     static int8_t beep_sequence[] = {
@@ -238,7 +254,7 @@ void advanced_alarm_face_setup(uint8_t watch_face_index, void **context_ptr) {
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(alarm_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(alarm_state_t));
         alarm_state_t *state = (alarm_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(alarm_state_t));
         // initialize the default alarm values
@@ -247,7 +263,6 @@ void advanced_alarm_face_setup(uint8_t watch_face_index, void **context_ptr) {
             state->alarm[i].beeps = 5;
             state->alarm[i].pitch = 1;
         }
-        state->alarm_handled_minute = -1;
         _wait_ticks = -1;
 
         if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) {
@@ -269,6 +284,7 @@ void advanced_alarm_face_activate(void *context) {
 void advanced_alarm_face_resign(void *context) {
     alarm_state_t *state = (alarm_state_t *)context;
     state->is_setting = false;
+    _alarm_update_next_fire(state);
     _alarm_update_alarm_enabled(state);
     watch_set_led_off();
     state->alarm_quick_ticks = false;
@@ -280,35 +296,36 @@ movement_watch_face_advisory_t advanced_alarm_face_advise(void *context) {
     alarm_state_t *state = (alarm_state_t *)context;
     movement_watch_face_advisory_t retval = { 0 };
 
+    if (state->next_fire_reg == 0) return retval;
+
+    // the 24h window for the signal indicator slides, so refresh it here; this is
+    // two cached reads and a compare, not a scan.
+    _alarm_update_alarm_enabled(state);
+
+    // fast path for the once-a-minute poll: nothing to evaluate until the
+    // precomputed fire time arrives. the fire time is kept in local wall time,
+    // so time zone and DST changes move it the way the wearer expects.
     watch_date_time_t now = movement_get_local_date_time();
-    // just a failsafe: never fire more than one alarm within a minute
-    if (state->alarm_handled_minute == now.unit.minute) return retval;
-    state->alarm_handled_minute = now.unit.minute;
-    // check the rest
+    now.unit.second = 0;
+    if (now.reg < state->next_fire_reg) return retval;
+
+    // we've reached the fire minute: only now do we scan for the matching slot.
+    uint8_t weekday_idx = _get_weekday_idx(now);
     for (uint8_t i = 0; i < ALARM_ALARMS; i++) {
-        if (state->alarm[i].enabled) {
-            if (state->alarm[i].minute == now.unit.minute) {
-                if (state->alarm[i].hour == now.unit.hour) {
-                    state->alarm_playing_idx = i;
-                    if (state->alarm[i].day == ALARM_DAY_EACH_DAY || state->alarm[i].day == ALARM_DAY_ONE_TIME) retval.wants_background_task = true;
-                    uint8_t weekday_idx = _get_weekday_idx(now);
-                    if (state->alarm[i].day == weekday_idx) retval.wants_background_task = true;
-                    if (state->alarm[i].day == ALARM_DAY_WORKDAY && weekday_idx < 5) retval.wants_background_task = true;
-                    if (state->alarm[i].day == ALARM_DAY_WEEKEND && weekday_idx >= 5) retval.wants_background_task = true;
-                }
-            }
+        if (state->alarm[i].enabled
+            && state->alarm[i].minute == now.unit.minute
+            && state->alarm[i].hour == now.unit.hour
+            && _alarm_day_matches(state->alarm[i].day, weekday_idx)) {
+            state->alarm_playing_idx = i;
+            retval.wants_background_task = true;
         }
     }
 
-    if (retval.wants_background_task) {
-        // FIXME for #SecondMovement: I think that this replicates the previous behavior of returning true in the conditionals above,
-        // but would like to do more testing
-        return retval;
-    }
-
-    state->alarm_handled_minute = -1;
-    // update the movement's alarm indicator five times an hour
-    if (now.unit.minute % 12 == 0) _alarm_update_alarm_enabled(state);
+    // move the cached fire time past this minute. if it had gone stale (say the
+    // clock was set forward past it), the scan above finds nothing and this
+    // heals the cache; the background task recomputes again after a one-time
+    // alarm erases itself.
+    _alarm_update_next_fire(state);
     return retval;
 }
 
@@ -332,6 +349,7 @@ bool advanced_alarm_face_loop(movement_event_t event, void *context) {
                 if (state->alarm_idx) {
                     // revert change of enabled flag and show it briefly
                     state->alarm[state->alarm_idx].enabled ^= 1;
+                    _alarm_update_next_fire(state);
                     _alarm_set_signal(state);
                     _alarm_show_alarm_on_text(state);
                     delay_ms(275);
@@ -413,6 +431,7 @@ bool advanced_alarm_face_loop(movement_event_t event, void *context) {
         if (!state->is_setting) {
             // toggle the enabled flag for current alarm
             state->alarm[state->alarm_idx].enabled ^= 1;
+            _alarm_update_next_fire(state);
             // start wait ticks counter
             _wait_ticks = 0;
         } else {
@@ -457,6 +476,7 @@ bool advanced_alarm_face_loop(movement_event_t event, void *context) {
             state->alarm[state->alarm_playing_idx].beeps = 5;
             state->alarm[state->alarm_playing_idx].pitch = 1;
             state->alarm[state->alarm_playing_idx].enabled = false;
+            _alarm_update_next_fire(state);
             _alarm_update_alarm_enabled(state);
         }
         break;
@@ -78,9 +78,10 @@ typedef struct {
     uint8_t alarm_idx : 4;
     uint8_t alarm_playing_idx : 4;
     uint8_t setting_state : 3;
-    int8_t alarm_handled_minute;
     bool alarm_quick_ticks : 1;
     bool is_setting : 1;
+    uint32_t next_fire_reg;  // local date/time of the next alarm to fire (watch_date_time_t reg), 0 if none
+    uint32_t next_fire_utc;  // the same instant as a unix timestamp, for the 24h signal indicator
     alarm_setting_t alarm[ALARM_ALARMS];
 } alarm_state_t;
 
@@ -127,6 +127,33 @@ static inline void _start(baby_kicks_state_t *state) {
     uint32_t now_unix = watch_utility_date_time_to_unix_time(*now, 0);
 
     state->start = now_unix;
+
+    /* With an accelerometer, the hardware activity engine records kicks
+     * in the background; the MCU sleeps between bursts and the session
+     * keeps counting even if this face resigns. */
+    state->auto_capture = movement_start_motion_capture_session();
+    state->captured_merged = 0;
+}
+
+/** @brief Folds in movements the accelerometer captured since the last
+  *        merge.
+  * @details Captured bursts flow through the same counters as button
+  *          presses.  Bursts merged in the same pass land in the same
+  *          one-minute stretch, which is what the stretch counter means
+  *          anyway: this runs at least once a minute via the background
+  *          task.
+  */
+static void _merge_captured_movements(baby_kicks_state_t *state) {
+    if (!state->auto_capture || !_is_running(state)) {
+        return;
+    }
+
+    uint32_t total = movement_get_motion_capture_count();
+
+    while (state->captured_merged < total) {
+        _increment_counts(state);
+        state->captured_merged++;
+    }
 }
 
 /** @brief Resets the counter.
@@ -135,6 +162,7 @@ static inline void _start(baby_kicks_state_t *state) {
   *          `BABY_KICKS_MODE_SPLASH`.
   */
 static void _reset(baby_kicks_state_t *state) {
+    movement_stop_motion_capture_session();
     memset(state, 0, sizeof(baby_kicks_state_t));
     memset(
         state->undo_buffer.stretches,
@@ -304,7 +332,7 @@ void baby_kicks_face_setup(uint8_t watch_face_index,
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(baby_kicks_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(baby_kicks_state_t));
         _reset(*context_ptr);
     }
 }
@@ -327,6 +355,7 @@ bool baby_kicks_face_loop(movement_event_t event, void *context) {
     switch (event.event_type) {
         case EVENT_ACTIVATE:
             state->currently_displayed = true;
+            _merge_captured_movements(state);
             _update_display_mode(state);
             _update_display(state);
             break;
@@ -400,12 +429,20 @@ bool baby_kicks_face_loop(movement_event_t event, void *context) {
             }
             break;
         case EVENT_BACKGROUND_TASK:     /* Update minute display. */
+            _merge_captured_movements(state);
             _update_display_mode(state);
 
             switch (state->mode) {
-                case BABY_KICKS_MODE_ACTIVE:    /* fallthrough */
                 case BABY_KICKS_MODE_TIMED_OUT:
+                    /* The session is over; stop the capture session. */
+                    if (state->auto_capture) {
+                        movement_stop_motion_capture_session();
+                        state->auto_capture = false;
+                    }
+                    /* fallthrough */
+                case BABY_KICKS_MODE_ACTIVE:
                     if (state->currently_displayed) {
+                        _display_counts(state);
                         _display_elapsed_minutes(state);
                     }
                     break;
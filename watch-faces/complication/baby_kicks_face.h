@@ -79,6 +79,15 @@
  * The watch face times out after 99 minutes, since it cannot display
  * more than 99 one-minute stretches in the "hour" position.  When this
  * happens, the "weekday digits" position shows "TO".
+ *
+ * If the watch has an accelerometer, a session also records movements
+ * automatically: the accelerometer's hardware activity engine counts
+ * bursts of motion in the background (see
+ * movement_start_motion_capture_session), so kicks are captured with
+ * the MCU asleep between them, even while another watch face is shown.
+ * Captured movements are folded into the same counters once a minute.
+ * Worn against the belly, this makes an hour-long session hands-free;
+ * the buttons still work as before for manual counting.
  */
 
 #include "movement.h"
@@ -114,6 +123,8 @@ typedef struct {
     uint32_t latest_stretch_start;
     uint8_t stretch_count;   /* Between 0 and `BABY_KICKS_TIMEOUT`. */
     uint16_t movement_count; /* Between 0 and 9999. */
+    bool auto_capture;       /* A hardware capture session is running. */
+    uint32_t captured_merged; /* Captured movements already folded in. */
     baby_kicks_undo_buffer_t undo_buffer;
 } baby_kicks_state_t;
 
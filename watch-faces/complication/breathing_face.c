@@ -35,20 +35,20 @@ typedef struct {
 
 static void update_indicators(breathing_state_t *state);
 
-const int NOTE_LENGTH = 80;
-static const watch_buzzer_note_t IN_NOTES[] = { BUZZER_NOTE_C4, BUZZER_NOTE_D4, BUZZER_NOTE_E4 };
-static const uint16_t IN_DUR[] = { NOTE_LENGTH, NOTE_LENGTH, NOTE_LENGTH };
-static const watch_buzzer_note_t IN_HOLD_NOTES[] = { BUZZER_NOTE_E4, BUZZER_NOTE_REST, BUZZER_NOTE_E4 };
-static const uint16_t IN_HOLD_DUR[] = { NOTE_LENGTH, NOTE_LENGTH * 2, NOTE_LENGTH };
-static const watch_buzzer_note_t OUT_NOTES[] = { BUZZER_NOTE_E4, BUZZER_NOTE_D4, BUZZER_NOTE_C4 };
-static const uint16_t OUT_DUR[] = { NOTE_LENGTH, NOTE_LENGTH, NOTE_LENGTH };
-static const watch_buzzer_note_t OUT_HOLD_NOTES[] = { BUZZER_NOTE_C4, BUZZER_NOTE_REST * 2, BUZZER_NOTE_C4 };
-static const uint16_t OUT_HOLD_DUR[] = { NOTE_LENGTH, NOTE_LENGTH, NOTE_LENGTH };
+// Stage melodies for the buzzer sequencer: note, duration in 1/64 s ticks.
+// The sequencer plays these from its own timer (which keeps running in standby),
+// so a stage boundary costs one play call instead of three overlapping
+// play_note calls that each cancelled the previous one.
+#define NOTE_TICKS 5 // ~80 ms
+static const int8_t IN_SEQ[] = { BUZZER_NOTE_C4, NOTE_TICKS, BUZZER_NOTE_D4, NOTE_TICKS, BUZZER_NOTE_E4, NOTE_TICKS, 0 };
+static const int8_t IN_HOLD_SEQ[] = { BUZZER_NOTE_E4, NOTE_TICKS, BUZZER_NOTE_REST, NOTE_TICKS * 2, BUZZER_NOTE_E4, NOTE_TICKS, 0 };
+static const int8_t OUT_SEQ[] = { BUZZER_NOTE_E4, NOTE_TICKS, BUZZER_NOTE_D4, NOTE_TICKS, BUZZER_NOTE_C4, NOTE_TICKS, 0 };
+static const int8_t OUT_HOLD_SEQ[] = { BUZZER_NOTE_C4, NOTE_TICKS, BUZZER_NOTE_REST, NOTE_TICKS * 2, BUZZER_NOTE_C4, NOTE_TICKS, 0 };
 
 void breathing_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index; // Unused parameter
     if (*context_ptr == NULL) {
-        breathing_state_t *state = malloc(sizeof(breathing_state_t));
+        breathing_state_t *state = movement_face_context_alloc(sizeof(breathing_state_t));
         state->current_stage = 0;
         state->indication_mode = 0; // Start with sound only
         state->led_on_state = 0;
@@ -80,16 +80,15 @@ static void update_indicators(breathing_state_t *state) {
     }
 }
 
-static void breathe_notify(breathing_state_t *state, const watch_buzzer_note_t *notes, const uint16_t *durations, size_t count, bool use_red_led) {
-    if (state->indication_mode == 2) return;
-    for (size_t i = 0; i < count; i++) {
-        if (state->indication_mode == 1 && notes[i] != BUZZER_NOTE_REST) {
-            if (use_red_led) watch_set_led_red();
-            else watch_set_led_green();
-            state->led_on_state = 1;
-        } else if (state->indication_mode == 0) {
-            watch_buzzer_play_note(notes[i], durations[i]);
-        }
+static void breathe_notify(breathing_state_t *state, const int8_t *sequence, bool use_red_led) {
+    if (state->indication_mode == 1) {
+        // swell the LED in over the stage boundary; the driver's fade engine
+        // times it off the TCC, so no fast tick frequency is needed here.
+        if (use_red_led) watch_led_fade_to(255, 0, 0, 400, NULL);
+        else watch_led_fade_to(0, 255, 0, 400, NULL);
+        state->led_on_state = 1;
+    } else if (state->indication_mode == 0) {
+        watch_buzzer_play_sequence(sequence, NULL);
     }
 }
 
@@ -100,7 +99,7 @@ bool breathing_face_loop(movement_event_t event, void *context) {
         case EVENT_ACTIVATE:
         case EVENT_TICK:
             if (state->led_on_state == 1) {
-                watch_set_led_off();
+                watch_led_fade_to(0, 0, 0, 500, NULL);
                 state->led_on_state = 0;
             }
 
@@ -108,7 +107,7 @@ bool breathing_face_loop(movement_event_t event, void *context) {
               case 0: {
                 watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, "Breath", "Breath");
                 if (state->indication_mode != 2)
-                  breathe_notify(state, IN_NOTES, IN_DUR, 3, false);
+                  breathe_notify(state, IN_SEQ, false);
                 break;
               }
               case 1:
@@ -124,7 +123,7 @@ bool breathing_face_loop(movement_event_t event, void *context) {
               case 4: {
                 watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, "Hold 4", "Hold 4");
                 if (state->indication_mode != 2)
-                  breathe_notify(state, IN_HOLD_NOTES, IN_HOLD_DUR, 3, true);
+                  breathe_notify(state, IN_HOLD_SEQ, true);
                 break;
               }
               case 5:
@@ -140,7 +139,7 @@ bool breathing_face_loop(movement_event_t event, void *context) {
               case 8: {
                 watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, "Out  4", "Ou t 4");
                 if (state->indication_mode != 2)
-                  breathe_notify(state, OUT_NOTES, OUT_DUR, 3, false);
+                  breathe_notify(state, OUT_SEQ, false);
                 break;
               }
               case 9:
@@ -156,7 +155,7 @@ bool breathing_face_loop(movement_event_t event, void *context) {
               case 12: {
                 watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, "Hold 4", "Hold 4");
                 if (state->indication_mode != 2)
-                  breathe_notify(state, OUT_HOLD_NOTES, OUT_HOLD_DUR, 3, true);
+                  breathe_notify(state, OUT_HOLD_SEQ, true);
                 break;
               }
               case 13:
@@ -195,7 +195,7 @@ void countdown_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(countdown_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(countdown_state_t));
         countdown_state_t *state = (countdown_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(countdown_state_t));
         state->minutes = DEFAULT_MINUTES;
@@ -362,7 +362,12 @@ bool countdown_face_loop(movement_event_t event, void *context) {
             }
             break;
         case EVENT_LOW_ENERGY_UPDATE:
-            // we will only get this if the timer is stopped.
+            if (state->mode == cd_running) {
+                // the timer keeps running in low energy mode off its scheduled task;
+                // resync and show the remaining time at minute resolution.
+                state->now_ts = watch_utility_date_time_to_unix_time(movement_get_utc_date_time(), movement_get_current_timezone_offset());
+                draw(state, event.subsecond);
+            }
             if (watch_get_lcd_type() == WATCH_LCD_TYPE_CLASSIC) {
                 // clear out the last two digits and replace them with the sleep mode indicator
                 watch_display_text(WATCH_POSITION_SECONDS, "  ");
@@ -395,6 +400,32 @@ bool countdown_face_loop(movement_event_t event, void *context) {
     return true;
 }
 
+uint8_t countdown_face_serialize(void *context, uint8_t *buffer, uint8_t size) {
+    (void) size;
+    countdown_state_t *state = (countdown_state_t *)context;
+    // The configured duration is the only thing worth carrying across BACKUP mode:
+    // a running timer's scheduled task would not survive the reset anyway, and the
+    // factory default is not worth a snapshot entry.
+    if (state->set_hours == 0 && state->set_minutes == DEFAULT_MINUTES &&
+        state->set_seconds == 0 && !state->repeat) return 0;
+    buffer[0] = state->set_hours;
+    buffer[1] = state->set_minutes;
+    buffer[2] = state->set_seconds;
+    buffer[3] = state->repeat ? 1 : 0;
+    return 4;
+}
+
+void countdown_face_deserialize(void *context, const uint8_t *buffer, uint8_t length) {
+    countdown_state_t *state = (countdown_state_t *)context;
+    if (length != 4) return;
+    if (buffer[0] > 23 || buffer[1] > 59 || buffer[2] > 59) return;
+    state->set_hours = buffer[0];
+    state->set_minutes = buffer[1];
+    state->set_seconds = buffer[2];
+    state->repeat = buffer[3] != 0;
+    load_countdown(state);
+}
+
 void countdown_face_resign(void *context) {
     countdown_state_t *state = (countdown_state_t *)context;
     if (state->mode == cd_setting) {
@@ -38,8 +38,11 @@
  *
  * Max countdown is 23 hours, 59 minutes and 59 seconds.
  *
- * Note: we have to prevent the watch from going to deep sleep using
- * movement_schedule_background_task() while the timer is running.
+ * Note: a running timer no longer keeps the watch awake; movement fires the
+ * scheduled background task from an RTC comparison, even in low energy mode.
+ *
+ * The configured duration and repeat flag are snapshotted across BACKUP mode,
+ * so they survive shelf storage without costing a backup register.
  */
 
 #include "movement.h"
@@ -73,6 +76,8 @@ void countdown_face_setup(uint8_t watch_face_index, void ** context_ptr);
 void countdown_face_activate(void *context);
 bool countdown_face_loop(movement_event_t event, void *context);
 void countdown_face_resign(void *context);
+uint8_t countdown_face_serialize(void *context, uint8_t *buffer, uint8_t size);
+void countdown_face_deserialize(void *context, const uint8_t *buffer, uint8_t length);
 
 #define countdown_face ((const watch_face_t){ \
     countdown_face_setup, \
@@ -80,6 +85,8 @@ void countdown_face_resign(void *context);
     countdown_face_loop, \
     countdown_face_resign, \
     NULL, \
+    countdown_face_serialize, \
+    countdown_face_deserialize, \
 })
 
 #endif // COUNTDOWN_FACE_H_
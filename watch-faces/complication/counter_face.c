@@ -36,13 +36,23 @@ static inline bool lcd_is_custom(void) {
 void counter_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(counter_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(counter_state_t));
         memset(*context_ptr, 0, sizeof(counter_state_t));
         counter_state_t *state = (counter_state_t *)*context_ptr;
         state->beep_on = true;
+        bool restored;
+        state->backup_register = movement_claim_tagged_backup_register(MOVEMENT_BACKUP_TAG('C', 'N', 'T', 'R'), &restored);
+        if (state->backup_register && restored) {
+            uint32_t saved = movement_get_tagged_backup_data(state->backup_register);
+            if (saved <= 99) state->counter_idx = saved;
+        }
     }
 }
 
+static void counter_face_save(counter_state_t *state) {
+    movement_set_tagged_backup_data(state->counter_idx, state->backup_register);
+}
+
 void counter_face_activate(void *context) {
     counter_state_t *state = (counter_state_t *)context;
     if (state->beep_on) {
@@ -83,7 +93,7 @@ bool counter_face_loop(movement_event_t event, void *context) {
             print_counter(state);
             break;
         case EVENT_TIMEOUT:
-            // ignore timeout
+            counter_face_save(state);
             break;
         default:
             movement_default_loop_handler(event);
@@ -135,7 +145,7 @@ void beep_counter(counter_state_t *state) {
         i++;
         sound_seq[i] = high_count-1;
     }
-    watch_buzzer_play_sequence((int8_t *)sound_seq, NULL);
+    watch_buzzer_play_sequence(sound_seq, NULL);
 }
 
 
@@ -143,11 +153,14 @@ void beep_counter(counter_state_t *state) {
 void print_counter(counter_state_t *state) {
     char buf[14];
     watch_display_text_with_fallback(WATCH_POSITION_TOP, "COUNT", "CO");
-    sprintf(buf, "  %02d", state->counter_idx); // center of LCD display
+    buf[0] = ' ';
+    buf[1] = ' ';
+    watch_format_two_digits(buf + 2, state->counter_idx, true); // center of LCD display
+    buf[4] = 0;
     watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, buf, buf);
 
 }
 
 void counter_face_resign(void *context) {
-    (void) context;
+    counter_face_save((counter_state_t *)context);
 }
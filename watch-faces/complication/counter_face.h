@@ -34,6 +34,9 @@
  * Short-press ALARM to increment the counter (loops at 99)
  * Long-press ALARM to reset the counter.
  * Long-press LIGHT to toggle sound.
+ *
+ * The count is saved in an RTC backup register on resign or timeout, so it
+ * survives resets and firmware updates (though not a battery change).
  */
 
 #include "movement.h"
@@ -41,6 +44,7 @@
 typedef struct {
     uint8_t counter_idx;
     bool beep_on;
+    uint8_t backup_register;
 } counter_state_t;
 
 
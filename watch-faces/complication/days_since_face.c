@@ -31,6 +31,17 @@
 
 static int days_since_instances;
 
+static uint32_t _days_since_face_juliandaynum(uint16_t year, uint16_t month, uint16_t day);
+
+// The Julian day number of January 1, 1970; adding it to an epoch day yields a JDN.
+#define JDN_UNIX_EPOCH 2440588
+
+static void _days_since_face_cache_jdn(days_since_state_t *state) {
+    // the stored date only changes in settings mode, so the conversion happens
+    // here rather than on every display update
+    state->since_jdn = _days_since_face_juliandaynum(state->working_year, state->working_month, state->working_day);
+}
+
 static void persist_date(days_since_state_t *state) {
     days_since_date_t maybe_date;
     days_since_date_t current_date = {0};
@@ -45,8 +56,10 @@ static void persist_date(days_since_state_t *state) {
 
     filesystem_read_file(filename, (char *) &maybe_date.reg, sizeof(days_since_date_t));
     if (current_date.reg != maybe_date.reg) {
-        filesystem_write_file(filename, (char *) &current_date.reg, sizeof(days_since_date_t));
+        filesystem_write_file_deferred(filename, (char *) &current_date.reg, sizeof(days_since_date_t));
     }
+
+    _days_since_face_cache_jdn(state);
 }
 
 static uint32_t _days_since_face_juliandaynum(uint16_t year, uint16_t month, uint16_t day) {
@@ -56,9 +69,12 @@ static uint32_t _days_since_face_juliandaynum(uint16_t year, uint16_t month, uin
 
 static void _days_since_face_update(days_since_state_t *state) {
     char buf[15];
-    watch_date_time_t date_time = watch_rtc_get_date_time();
-    uint32_t julian_now_date = _days_since_face_juliandaynum(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day);
-    uint32_t julian_since_date = _days_since_face_juliandaynum(state->working_year, state->working_month, state->working_day);
+    // both sides of the subtraction are precomputed day counts; no date
+    // conversion happens here. note this now rolls over at local midnight,
+    // where the raw RTC date flipped at UTC midnight.
+    state->last_epoch_day = movement_get_local_epoch_day();
+    uint32_t julian_now_date = state->last_epoch_day + JDN_UNIX_EPOCH;
+    uint32_t julian_since_date = state->since_jdn;
     watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "DAY", "DA");
     watch_display_text(WATCH_POSITION_TOP_RIGHT, "  ");
     if (julian_now_date < julian_since_date) {
@@ -97,7 +113,7 @@ static void _days_since_face_increment(days_since_state_t *state) {
 void days_since_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(days_since_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(days_since_state_t));
         memset(*context_ptr, 0, sizeof(days_since_state_t));
         days_since_date_t since_date = {0};
         days_since_state_t *state = (days_since_state_t *)*context_ptr;
@@ -119,6 +135,7 @@ void days_since_face_setup(uint8_t watch_face_index, void ** context_ptr) {
         state->working_year = since_date.bit.year;
         state->working_month = since_date.bit.month;
         state->working_day = since_date.bit.day;
+        _days_since_face_cache_jdn(state);
     }
 }
 
@@ -178,12 +195,11 @@ bool days_since_face_loop(movement_event_t event, void *context) {
                     }
                     break;
                 // otherwise, check if we have to update. the display only needs to change at midnight!
-                case PAGE_DISPLAY: {
-                    watch_date_time_t date_time = watch_rtc_get_date_time();
-                    if (date_time.unit.hour == 0 &&  date_time.unit.minute == 0 && date_time.unit.second == 0) {
+                case PAGE_DISPLAY:
+                    if (movement_get_local_epoch_day() != state->last_epoch_day) {
                         _days_since_face_update(state);
                     }
-                    break;}
+                    break;
                 case PAGE_DATE:
                     if (state->ticks > 0) {
                         state->ticks--;
@@ -244,9 +260,8 @@ bool days_since_face_loop(movement_event_t event, void *context) {
                     break;
                 case PAGE_DISPLAY:
                 {
-                    watch_date_time_t date_time = watch_rtc_get_date_time();
-                    uint32_t julian_now_date = _days_since_face_juliandaynum(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day);
-                    uint32_t julian_since_date = _days_since_face_juliandaynum(state->working_year, state->working_month, state->working_day);
+                    uint32_t julian_now_date = movement_get_local_epoch_day() + JDN_UNIX_EPOCH;
+                    uint32_t julian_since_date = state->since_jdn;
                     if (julian_now_date < julian_since_date) {
                         watch_display_text_with_fallback(WATCH_POSITION_TOP, "Until", "DA");
                     } else {
@@ -76,6 +76,8 @@ typedef struct {
     bool birthday_changed;
     bool quick_cycle;
     uint8_t ticks;
+    uint32_t since_jdn;       // Julian day number of the stored date, kept in sync with it
+    uint32_t last_epoch_day;  // movement epoch day at the last display update
 } days_since_state_t;
 
 void days_since_face_setup(uint8_t watch_face_index, void ** context_ptr);
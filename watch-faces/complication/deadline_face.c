@@ -52,10 +52,16 @@ static bool _deadline_settings_loop(movement_event_t event, void *context);
 static void _deadline_settings_display(movement_event_t event, deadline_state_t * state,
                                        watch_date_time_t date);
 
-/* Check for leap year */
+/* Month lengths, shared by every edit and display path. Const, so they live in
+   flash; the old per-call stack copies re-materialized the table on every held
+   button repeat. */
+static const uint8_t _month_lengths[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+/* Check for leap year. Years are RTC years; the century rule next matters in
+   2100, past what the six year bits can represent. */
 static inline bool _is_leap(int16_t y)
 {
-    y += 1900;
+    y += WATCH_RTC_REFERENCE_YEAR;
     return !(y % 4) && ((y % 100) || !(y % 400));
 }
 
@@ -66,16 +72,25 @@ static inline unsigned int _mod(int a, int b)
     return r < 0 ? r + b : r;
 }
 
+/* Leap flag cached for the year most recently asked about, so fast-repeat day
+   scrolling pays for the leap rule once per year edited, not once per repeat. */
+static int16_t _leap_cache_year = -1;
+static bool _leap_cache;
+
 /* Return days in month */
 static inline int _days_in_month(int16_t month, int16_t year)
 {
-    uint8_t days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
     month = _mod(month - 1, 12);
 
-    if (month == 1 && _is_leap(year)) {
-        return days[month] + 1;
+    if (year != _leap_cache_year) {
+        _leap_cache_year = year;
+        _leap_cache = _is_leap(year);
+    }
+
+    if (month == 1 && _leap_cache) {
+        return _month_lengths[month] + 1;
     } else {
-        return days[month];
+        return _month_lengths[month];
     }
 }
 
@@ -143,6 +158,15 @@ static uint8_t _closest_deadline(deadline_state_t *state)
     return min_index;
 }
 
+/* Refresh the cached civil form of a deadline after its timestamp changes, so
+   the running display never has to convert epochs on a tick */
+static void _deadline_cache_refresh(deadline_state_t *state, uint8_t index)
+{
+    watch_date_time_t dt = watch_utility_date_time_from_unix_time(state->deadlines[index], 0);
+    state->deadline_dts[index] = dt;
+    state->deadline_days[index] = watch_utility_convert_to_epoch_day(dt.unit.year + WATCH_RTC_REFERENCE_YEAR, dt.unit.month, dt.unit.day);
+}
+
 /* Play background alarm */
 static void _background_alarm_play(deadline_state_t *state)
 {
@@ -164,6 +188,7 @@ static inline void _reset_deadline(deadline_state_t *state)
     ts += 24 * 60 * 60;
 
     state->deadlines[state->current_index] = ts;
+    _deadline_cache_refresh(state, state->current_index);
 }
 
 /* Calculate the naive difference between deadline and current time */
@@ -227,8 +252,6 @@ static void _correct_time_difference(int16_t *units, watch_date_time_t deadline)
 /* Increment date in settings mode. Function taken from `set_time_face.c` */
 static void _increment_date(deadline_state_t *state, watch_date_time_t date_time)
 {
-    const uint8_t days_in_month[12] = { 31, 28, 31, 30, 31, 30, 30, 31, 30, 31, 30, 31 };
-
     switch (state->current_page) {
         case 0:
             /* Only 10 years covered. Fix this sometime next decade */
@@ -240,12 +263,7 @@ static void _increment_date(deadline_state_t *state, watch_date_time_t date_time
         case 2:
             date_time.unit.day = date_time.unit.day + 1;
 
-            /* Check for leap years */
-            int8_t days = days_in_month[date_time.unit.month - 1];
-            if (date_time.unit.month == 2 && _is_leap(date_time.unit.year))
-                days++;
-
-            if (date_time.unit.day > days)
+            if (date_time.unit.day > _days_in_month(date_time.unit.month, date_time.unit.year))
                 date_time.unit.day = 1;
             break;
         case 3:
@@ -256,8 +274,14 @@ static void _increment_date(deadline_state_t *state, watch_date_time_t date_time
             break;
     }
 
-    uint32_t ts = watch_utility_date_time_to_unix_time(date_time, 0);
-    state->deadlines[state->current_index] = ts;
+    /* We already hold the edited civil form: store it straight into the cache
+       rather than converting the timestamp back out again, which was the
+       divide-heavy round trip that made fast-repeat scrolling stutter. */
+    state->deadlines[state->current_index] = watch_utility_date_time_to_unix_time(date_time, 0);
+    state->deadline_dts[state->current_index] = date_time;
+    state->deadline_days[state->current_index] =
+        watch_utility_convert_to_epoch_day(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR,
+                                           date_time.unit.month, date_time.unit.day);
 }
 
 /* Update display in running mode */
@@ -281,11 +305,16 @@ static void _deadline_running_display(movement_event_t event, deadline_state_t *
         watch_clear_indicator(WATCH_INDICATOR_BELL);
 
     watch_date_time_t now = movement_get_local_date_time();
-    uint32_t now_ts = watch_utility_date_time_to_unix_time(now, 0);
+    watch_date_time_t deadline = state->deadline_dts[state->current_index];
+    uint32_t dl_ts = state->deadlines[state->current_index];
 
-    /* Deadline expired */
-    if (state->deadlines[state->current_index] < now_ts) {
-        if (state->deadlines[state->current_index] + 24 * 60 * 60 > now_ts)
+    /* Deadline expired (the packed registers compare like the timestamps did,
+       without converting the current time to an epoch every second) */
+    if (dl_ts == 0 || deadline.reg < now.reg) {
+        /* Within 24 hours of expiry show OVER, afterwards dashes; day counts
+           are precomputed, the time-of-day fields sit in the low 17 bits */
+        uint32_t day_diff = movement_get_local_epoch_day() - state->deadline_days[state->current_index];
+        if (dl_ts != 0 && (day_diff == 0 || (day_diff == 1 && (now.reg & 0x1FFFF) < (deadline.reg & 0x1FFFF))))
             sprintf(buf, "OVER  ");
         else
             sprintf(buf, "----  ");
@@ -294,10 +323,6 @@ static void _deadline_running_display(movement_event_t event, deadline_state_t *
         return;
     }
 
-    /* Get date time structs */
-    uint32_t dl_ts = state->deadlines[state->current_index];
-    watch_date_time_t deadline = watch_utility_date_time_from_unix_time(dl_ts, 0);
-
     /* Calculate and format time remaining */
     _calculate_time_remaining(deadline, now, units);
     _correct_time_difference(units, deadline);
@@ -434,8 +459,7 @@ static void _deadline_settings_init(deadline_state_t *state)
 static bool _deadline_settings_loop(movement_event_t event, void *context)
 {
     deadline_state_t *state = (deadline_state_t *) context;
-    watch_date_time_t date_time;
-    date_time = watch_utility_date_time_from_unix_time(state->deadlines[state->current_index], 0);
+    watch_date_time_t date_time = state->deadline_dts[state->current_index];
 
     if (event.event_type != EVENT_BACKGROUND_TASK)
         _deadline_settings_display(event, state, date_time);
@@ -502,12 +526,15 @@ void deadline_face_setup(uint8_t watch_face_index, void **context_ptr)
         return; /* Skip setup if context available */
 
     /* Allocate state */
-    *context_ptr = malloc(sizeof(deadline_state_t));
+    *context_ptr = movement_face_context_alloc(sizeof(deadline_state_t));
     memset(*context_ptr, 0, sizeof(deadline_state_t));
 
     /* Store face index for background tasks */
     deadline_state_t *state = (deadline_state_t *) * context_ptr;
     state->face_idx = watch_face_index;
+
+    for (uint8_t i = 0; i < DEADLINE_FACE_DATES; i++)
+        _deadline_cache_refresh(state, i);
 }
 
 /* Activate face */
@@ -120,6 +120,8 @@ typedef struct {
     uint8_t tick_freq;
     uint8_t face_idx;
     uint32_t deadlines[DEADLINE_FACE_DATES];
+    watch_date_time_t deadline_dts[DEADLINE_FACE_DATES];  /* civil form of deadlines[], kept in sync */
+    uint32_t deadline_days[DEADLINE_FACE_DATES];          /* epoch day of each deadline */
 } deadline_state_t;
 
 void deadline_face_setup(uint8_t watch_face_index, void **context_ptr);
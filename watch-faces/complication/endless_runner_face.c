@@ -26,6 +26,8 @@
 #include <string.h>
 #include "endless_runner_face.h"
 #include "delay.h"
+#include "watch_utility.h"
+#include "game_frame.h"
 
 typedef enum {
     JUMPING_FINAL_FRAME = 0,
@@ -132,11 +134,7 @@ static void print_binary(uint32_t value, int bits) {
 }
 
 static uint32_t get_random(uint32_t max) {
-    #if __EMSCRIPTEN__
-    return rand() % max;
-    #else
-    return arc4random_uniform(max);
-    #endif
+    return watch_utility_random_uniform(max);
 }
 
 static uint32_t get_random_nonzero(uint32_t max) {
@@ -274,6 +272,13 @@ static void display_fuel(uint8_t subsecond, uint8_t difficulty) {
     watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
 }
 
+// hi score and the month it was earned, packed into the score store's 24 bits
+static void persist_hi_score(endless_runner_state_t *state) {
+    game_score_set(&state -> score_store, (uint32_t)state -> hi_score
+        | (uint32_t)state -> month_last_hi_score << 10
+        | (uint32_t)state -> year_last_hi_score << 14);
+}
+
 static void check_and_reset_hi_score(endless_runner_state_t *state) {
     // Resets the hi score at the beginning of each month.
     watch_date_time_t date_time = movement_get_local_date_time();
@@ -284,6 +289,7 @@ static void check_and_reset_hi_score(endless_runner_state_t *state) {
         state -> hi_score = 0;
         state -> year_last_hi_score = date_time.unit.year;
         state -> month_last_hi_score = date_time.unit.month;
+        persist_hi_score(state);
     }
 }
 
@@ -428,6 +434,7 @@ static void begin_playing(endless_runner_state_t *state) {
 
 static void display_lose_screen(endless_runner_state_t *state) {
     game_state.curr_screen = SCREEN_LOSE;
+    persist_hi_score(state);
     game_state.curr_score = 0;
     watch_clear_display();
     watch_display_text(WATCH_POSITION_BOTTOM, " LOSE ");
@@ -549,18 +556,22 @@ static void update_game(endless_runner_state_t *state, uint8_t subsecond) {
         delay_ms(200);  // To show the player jumping onto the obstacle before displaying the lose screen.
         display_lose_screen(state);
     }
-    else if (game_state.fuel_mode)
+    else if (game_state.fuel_mode && !game_frame_should_skip_render())
         display_fuel(subsecond, state -> difficulty);
 }
 
 void endless_runner_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(endless_runner_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(endless_runner_state_t));
         memset(*context_ptr, 0, sizeof(endless_runner_state_t));
         endless_runner_state_t *state = (endless_runner_state_t *)*context_ptr;
         state->difficulty = DIFF_NORM;
         state->tap_control_on = false;
+        uint32_t persisted = game_score_init(&state->score_store, MOVEMENT_BACKUP_TAG('E', 'R', 'N', 0), "runner.hs");
+        state->hi_score = persisted & 0x3FF;
+        state->month_last_hi_score = (persisted >> 10) & 0xF;
+        state->year_last_hi_score = (persisted >> 14) & 0x3F;
     }
 }
 
@@ -593,7 +604,9 @@ bool endless_runner_face_loop(movement_event_t event, void *context) {
             case SCREEN_TIME:
                 break;
             default:
+                game_frame_begin((state -> difficulty == DIFF_BABY) ? FREQ_SLOW : FREQ);
                 update_game(state, event.subsecond);
+                game_frame_end();
                 break;
             }
             break;
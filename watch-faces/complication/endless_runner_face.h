@@ -26,6 +26,7 @@
 #define ENDLESS_RUNNER_FACE_H_
 
 #include "movement.h"
+#include "game_score.h"
 
 /*
     ENDLESS_RUNNER face
@@ -46,6 +47,7 @@ typedef struct {
     uint8_t soundOn : 1;
     uint8_t tap_control_on : 1;
     uint8_t unused : 7;
+    game_score_t score_store;
 } endless_runner_state_t;
 
 void endless_runner_face_setup(uint8_t watch_face_index, void ** context_ptr);
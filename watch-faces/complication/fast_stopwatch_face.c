@@ -31,6 +31,7 @@
 #include "watch_common_display.h"
 #include "watch_utility.h"
 #include "watch_rtc.h"
+#include "ring_log.h"
 #include "slcd.h"
 
 /*
@@ -49,7 +50,8 @@ typedef enum {
     SW_STATUS_RUNNING,
     SW_STATUS_RUNNING_LAPPING,
     SW_STATUS_STOPPED,
-    SW_STATUS_STOPPED_LAPPING
+    SW_STATUS_STOPPED_LAPPING,
+    SW_STATUS_REVIEW
 } stopwatch_status_t;
 
 static inline void _button_beep() {
@@ -58,9 +60,11 @@ static inline void _button_beep() {
 }
 
 // How quickly should the elapsing time be displayed?
-// This is just for looks, timekeeping is always accurate to 128Hz
+// This is just for looks, timekeeping is always accurate to 128Hz:
+// start/stop/lap instants come from the RTC counter, so even at a 1 Hz
+// refresh the recorded times lose nothing.
 static const uint8_t DISPLAY_RUNNING_RATE = 32;
-static const uint8_t DISPLAY_RUNNING_RATE_SLOW = 2;
+static const uint8_t DISPLAY_RUNNING_RATE_SLOW = 1;
 
 /// @brief Display minutes, seconds and fractions derived from 128 Hz tick counter
 ///        on the lcd.
@@ -72,7 +76,7 @@ static void _display_elapsed(fast_stopwatch_state_t *state, uint32_t ticks) {
         watch_display_character_lp_seconds(' ', 8);
         watch_display_character_lp_seconds(' ', 9);
     } else {
-        uint8_t sec_100 = (ticks & 0x7F) * 100 / 128;
+        uint8_t sec_100 = watch_rtc_counter_to_centiseconds(ticks & 0x7F);
 
         watch_display_character_lp_seconds('0' + sec_100 / 10, 8);
         watch_display_character_lp_seconds('0' + sec_100 % 10, 9);
@@ -116,14 +120,75 @@ static void _display_elapsed(fast_stopwatch_state_t *state, uint32_t ticks) {
     }
 }
 
+// Lap splits are appended to the external flash ring log as they happen, so the
+// history survives a face resign or a battery swap. Review scans the log in place
+// rather than caching records in RAM.
+typedef struct {
+    uint32_t count;  // lap records seen so far
+    uint32_t target; // index (oldest first) of the record to fetch
+    uint32_t ticks;  // 128 Hz lap ticks from the target record
+    bool found;
+} lap_scan_t;
+
+static bool _lap_scan_cb(const ring_log_record_t *record, void *context) {
+    lap_scan_t *scan = (lap_scan_t *)context;
+    if (record->type != RING_LOG_TYPE_LAP) return true;
+    if (scan->count == scan->target) {
+        memcpy(&scan->ticks, record->data, sizeof(scan->ticks));
+        scan->found = true;
+    }
+    scan->count++;
+    return true;
+}
+
+static uint16_t _lap_count(void) {
+    lap_scan_t scan = { .target = UINT32_MAX };
+    ring_log_iterate(_lap_scan_cb, &scan);
+    return (uint16_t)scan.count;
+}
+
+static void _display_review(fast_stopwatch_state_t *state) {
+    char buf[3];
+    lap_scan_t scan = { .target = (uint32_t)(state->review_count - 1 - state->review_index) };
+    ring_log_iterate(_lap_scan_cb, &scan);
+
+    watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "LAP", "LP");
+    sprintf(buf, "%2u", (state->review_index + 1) % 100);
+    watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
+    watch_set_indicator(WATCH_INDICATOR_LAP);
+    watch_set_colon();
+
+    if (!scan.found) {
+        // should not happen unless the log wrapped mid-review
+        watch_display_text(WATCH_POSITION_BOTTOM, "no dat");
+        return;
+    }
+
+    uint8_t sec_100 = watch_rtc_counter_to_centiseconds(scan.ticks & 0x7F);
+    watch_display_character_lp_seconds('0' + sec_100 / 10, 8);
+    watch_display_character_lp_seconds('0' + sec_100 % 10, 9);
+
+    uint32_t seconds = scan.ticks >> 7;
+    sprintf(buf, "%02lu", seconds % 60);
+    watch_display_text(WATCH_POSITION_MINUTES, buf);
+    sprintf(buf, "%02lu", (seconds / 60) % 60);
+    watch_display_text(WATCH_POSITION_HOURS, buf);
+}
+
 static void _draw_indicators(fast_stopwatch_state_t *state, movement_event_t event, uint32_t elapsed) {
     uint8_t subsecond;
     bool tock;
 
     switch (state->status) {
         case SW_STATUS_RUNNING:
-            subsecond = elapsed & 127;
-            tock = subsecond >= 64;
+            if (state->slow_refresh) {
+                // at a 1 Hz refresh there is no mid-second tick to blink on;
+                // toggle the colon on the elapsed seconds instead.
+                tock = (elapsed >> 7) & 1;
+            } else {
+                subsecond = elapsed & 127;
+                tock = subsecond >= 64;
+            }
 
             watch_clear_indicator(WATCH_INDICATOR_LAP);
             if (tock) {
@@ -188,6 +253,14 @@ static void state_transition(fast_stopwatch_state_t *state, rtc_counter_t counte
                     state->start_counter = counter;
                     movement_request_tick_frequency(get_refresh_rate(state));
                     return;
+                case EVENT_LIGHT_BUTTON_DOWN:
+                    // review logged laps, newest first, if any have been recorded
+                    state->review_count = _lap_count();
+                    if (state->review_count) {
+                        state->status = SW_STATUS_REVIEW;
+                        state->review_index = 0;
+                    }
+                    return;
                 case EVENT_LIGHT_LONG_PRESS:
                     state->slow_refresh = !state->slow_refresh;
                     return;
@@ -202,11 +275,15 @@ static void state_transition(fast_stopwatch_state_t *state, rtc_counter_t counte
                     state->stop_counter = counter;
                     movement_request_tick_frequency(get_refresh_rate(state));
                     return;
-                case EVENT_LIGHT_BUTTON_DOWN:
+                case EVENT_LIGHT_BUTTON_DOWN: {
+                    uint32_t lap_ticks = counter - state->start_counter;
                     state->status = SW_STATUS_RUNNING_LAPPING;
                     state->lap_counter = counter;
+                    // persist the lap split to the external flash ring log, if this board has one.
+                    ring_log_append(RING_LOG_TYPE_LAP, watch_rtc_get_date_time().reg, &lap_ticks, sizeof(lap_ticks));
                     movement_request_tick_frequency(get_refresh_rate(state));
                     return;
+                }
                 default:
                     return;
             }
@@ -261,6 +338,18 @@ static void state_transition(fast_stopwatch_state_t *state, rtc_counter_t counte
                     return;
             }
 
+        case SW_STATUS_REVIEW:
+            switch (event_type) {
+                case EVENT_LIGHT_BUTTON_DOWN:
+                    state->review_index = (state->review_index + 1) % state->review_count;
+                    return;
+                case EVENT_ALARM_BUTTON_DOWN:
+                    state->status = SW_STATUS_IDLE;
+                    return;
+                default:
+                    return;
+            }
+
         default:
             return;
     }
@@ -289,13 +378,15 @@ static uint32_t elapsed_time(fast_stopwatch_state_t *state, rtc_counter_t counte
 void fast_stopwatch_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(fast_stopwatch_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(fast_stopwatch_state_t));
         memset(*context_ptr, 0, sizeof(fast_stopwatch_state_t));
         fast_stopwatch_state_t *state = (fast_stopwatch_state_t *)*context_ptr;
         state->start_counter = 0;
         state->stop_counter = 0;
         state->lap_counter = 0;
         state->status = SW_STATUS_IDLE;
+        // no-op on boards without the Sensor Board's SPI flash.
+        ring_log_mount();
     }
 }
 
@@ -313,7 +404,34 @@ bool fast_stopwatch_face_loop(movement_event_t event, void *context) {
 
     rtc_counter_t counter = watch_rtc_get_counter();
 
+    uint8_t old_status = state->status;
     state_transition(state, counter, event.event_type);
+    if ((old_status == SW_STATUS_REVIEW) != (state->status == SW_STATUS_REVIEW)) {
+        // entering or leaving lap review replaces the whole display
+        watch_clear_display();
+        state->old_display.seconds = UINT_MAX;
+        state->old_display.minutes = UINT_MAX;
+        state->old_display.hours = UINT_MAX;
+        if (state->status != SW_STATUS_REVIEW) {
+            watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "STW", "ST");
+        }
+    }
+
+    if (state->status == SW_STATUS_REVIEW) {
+        switch (event.event_type) {
+            case EVENT_LIGHT_BUTTON_DOWN:
+                _button_beep();
+                // fall through
+            case EVENT_ACTIVATE:
+                _display_review(state);
+                break;
+            default:
+                movement_default_loop_handler(event);
+                break;
+        }
+        return true;
+    }
+
     rtc_counter_t elapsed = elapsed_time(state, counter);
 
     switch (event.event_type) {
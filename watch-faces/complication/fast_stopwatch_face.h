@@ -43,6 +43,11 @@
  *    (up to 24 hours).
  *  o Long-press the light button to toggle the LED behavior.
  *    It either turns on with each button press or remains off.
+ *  o On boards with the Sensor Board's SPI flash, every lap split is also
+ *    appended to the flash ring log, so lap history survives leaving the
+ *    face and even a battery swap. While the stopwatch is idle, press the
+ *    LIGHT button to page through recorded laps (newest first, with the
+ *    lap indicator lit); press the ALARM button to leave the review.
  *
  * NOTE:
  * This watch face relies heavily on static vars in fast_stopwatch.c.
@@ -60,6 +65,8 @@ typedef struct {
     rtc_counter_t stop_counter;  // rtc counter when the stopwatch was stopped
     uint8_t status;              // the status the stopwatch is in (idle, running, stopped)
     bool slow_refresh;           // update the display slowly (same 128Hz timekeeping accuracy)
+    uint16_t review_index;       // which logged lap is being reviewed (0 = newest)
+    uint16_t review_count;       // lap records in the flash log when review began
     struct {
         rtc_counter_t seconds;
         rtc_counter_t minutes;
@@ -356,24 +356,24 @@ static void _handle_alarm_button(interval_face_state_t *state) {
 static void _set_next_timestamp(interval_face_state_t *state) {
     // set next timestamp for the running timer, set background task and pay sound sequence
     uint16_t delta = 0;
-    int8_t *sound_seq;
+    const int8_t *sound_seq;
     interval_timer_setting_t timer = state->timer[state->timer_idx];
     switch (_timer_run_state) {
     case 0:
         delta = timer.warmup_minutes * 60 + timer.warmup_seconds;
-        sound_seq = (int8_t *)_sound_seq_warmup;
+        sound_seq = _sound_seq_warmup;
         break;
     case 1:
         delta = timer.work_minutes * 60 + timer.work_seconds;
-        sound_seq = (int8_t *)_sound_seq_work;
+        sound_seq = _sound_seq_work;
         break;
     case 2:
         delta = timer.break_minutes * 60 + timer.break_seconds;
-        sound_seq = (int8_t *)_sound_seq_break;
+        sound_seq = _sound_seq_break;
         break;
     case 3:
         delta = timer.cooldown_minutes * 60 + timer.cooldown_seconds;
-        sound_seq = (int8_t *)_sound_seq_cooldown;
+        sound_seq = _sound_seq_cooldown;
         break;
     default:
         sound_seq = NULL;
@@ -424,7 +424,7 @@ static void _resume_paused_timer(interval_face_state_t *state) {
 void interval_face_setup(uint8_t watch_face_index, void **context_ptr) {
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(interval_face_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(interval_face_state_t));
         interval_face_state_t *state = (interval_face_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(interval_face_state_t));
         state->face_idx = watch_face_index;
@@ -454,7 +454,11 @@ void interval_face_activate(void *context) {
         state->face_state = interval_state_intro;
         _ticks = 0;
         movement_request_tick_frequency(8);
-    } else watch_set_colon();
+    } else {
+        watch_set_colon();
+        // coming back mid-run: another face owned the display in between
+        if (state->face_state >= interval_state_running) watch_set_indicator(WATCH_INDICATOR_BELL);
+    }
 }
 
 void interval_face_resign(void *context) {
@@ -659,15 +663,19 @@ bool interval_face_loop(movement_event_t event, void *context) {
             // transition to next timer phase
             _set_next_timestamp(state);
         } else {
-            // timer has finished
+            // timer has finished; only draw if we are the face on screen
             state->face_state = interval_state_waiting;
             _init_timer_info(state);
-            _face_draw(state, event.subsecond);
-            watch_buzzer_play_sequence((int8_t *)_sound_seq_finish, NULL);
+            if (state->is_active) _face_draw(state, event.subsecond);
+            watch_buzzer_play_sequence(_sound_seq_finish, NULL);
         }
         break;
     case EVENT_TIMEOUT:
-        if (state->face_state != interval_state_running) movement_move_to_face(0);
+        // A running timer doesn't need us in the foreground: every phase change
+        // arrives as a scheduled background task and its sound plays from the
+        // hardware sequencer, so return to the clock and let the watch sleep
+        // between phases instead of burning a wake per second on the countdown.
+        movement_move_to_face(0);
         break;
     case EVENT_LIGHT_BUTTON_DOWN:
         // don't light up every time light is hit
@@ -70,6 +70,14 @@
  *   rounds to be counted. A "-" means, that there is no limit and the 
  *   timer keeps alternating between work and break phases.
  *
+ * - A running timer does not keep the watch awake: after a minute of
+ *   inactivity the display returns to the clock, and the timer keeps
+ *   running in the background. Phase changes are scheduled as RTC alarms
+ *   and their sounds play from the hardware tune sequencer, so a 45+
+ *   minute workout costs one wake per phase change, not one per second.
+ *   Switch back to the interval face at any time to see the countdown,
+ *   pause, or abort.
+ *
  * - This watch face comes with several pre-defined interval timers,
  *   suitable for hiit training (timer slots 1 to 4) as well as doing
  *   work according to the pomodoro principle (timer slots 5 to 6).
@@ -30,10 +30,11 @@
 
 typedef struct
 {
-    char name[6];          // Name to display on selection
-    double conv_factor_uk; // Unit as represented in base units (UK)
-    double conv_factor_us; // Unit as represented in base units (US)
-    int16_t linear_factor; // Addition of constant (For temperatures)
+    char name[6];            // Name to display on selection
+    uint32_t conv_factor_uk; // Numerator: base units per this unit (UK)
+    uint32_t conv_factor_us; // Numerator: base units per this unit (US)
+    uint32_t conv_divisor;   // Denominator shared by both numerators
+    int16_t linear_factor;   // Addition of constant (For temperatures)
 } unit;
 
 #define TICK_FREQ 4
@@ -53,35 +54,38 @@ static char measures_custom[MEASURES_COUNT][7] = {"n&ass", "  temp", "Volume"};
 #define VOL_COUNT 9
 const uint8_t units_count[4] = {WEIGHT_COUNT, TEMP_COUNT, VOL_COUNT};
 
+// All conversion factors are exact decimal fractions, stored as integer
+// (numerator_uk, numerator_us, denominator) triples: one 64-bit mul-div-round
+// replaces the soft-float library the old double math pulled into the build.
 static const unit weights[WEIGHT_COUNT] = {
-    {" g", 1., 1., 0}, // BASE
-    {" kg", 1000., 1000, 0},
-    {"Ounce", 28.34952, 28.34952, 0},
-    {" Pound", 453.5924, 453.5924, 0},
+    {" g", 1, 1, 1, 0}, // BASE
+    {" kg", 1000, 1000, 1, 0},
+    {"Ounce", 2834952, 2834952, 100000, 0}, // 28.34952 g
+    {" Pound", 4535924, 4535924, 10000, 0}, // 453.5924 g
 };
 
 static const unit temps[TEMP_COUNT] = {
-    {" # C", 1.8, 1.8, 32},
-    {" # F", 1., 1., 0}, // BASE
-    {"Gas Mk", 25., 25., 250},
+    {" # C", 18, 18, 10, 32},
+    {" # F", 1, 1, 1, 0}, // BASE
+    {"Gas Mk", 25, 25, 1, 250},
 };
 
 static const unit temps_custom[TEMP_COUNT] = {
-    {" #C", 1.8, 1.8, 32},
-    {" #F", 1., 1., 0}, // BASE
-    {"Gas Mk", 25., 25., 250},
+    {" #C", 18, 18, 10, 32},
+    {" #F", 1, 1, 1, 0}, // BASE
+    {"Gas Mk", 25, 25, 1, 250},
 };
 
 static const unit vols[VOL_COUNT] = {
-    {"  n&L", 1., 1., 0}, // BASE (ml)
-    {"   L", 1000., 1000., 0},
-    {" Fl Oz", 28.41306, 29.57353, 0},
-    {" Tbsp", 17.75816, 14.78677, 0},
-    {" Tsp", 5.919388, 4.928922, 0},
-    {"  Cup", 284.1306, 236.5882, 0},
-    {" Pint", 568.2612, 473.1765, 0},
-    {" Quart", 1136.522, 946.353, 0},
-    {"Gallon", 4546.09, 3785.412, 0},
+    {"  n&L", 1, 1, 1, 0}, // BASE (ml)
+    {"   L", 1000, 1000, 1, 0},
+    {" Fl Oz", 2841306, 2957353, 100000, 0}, // 28.41306 / 29.57353 ml
+    {" Tbsp", 1775816, 1478677, 100000, 0},  // 17.75816 / 14.78677 ml
+    {" Tsp", 5919388, 4928922, 1000000, 0},  // 5.919388 / 4.928922 ml
+    {"  Cup", 2841306, 2365882, 10000, 0},   // 284.1306 / 236.5882 ml
+    {" Pint", 5682612, 4731765, 10000, 0},   // 568.2612 / 473.1765 ml
+    {" Quart", 1136522, 946353, 1000, 0},    // 1136.522 / 946.353 ml
+    {"Gallon", 4546090, 3785412, 1000, 0},   // 4546.09 / 3785.412 ml
 };
 
 static int8_t calc_success_seq[5] = {BUZZER_NOTE_G6, 10, BUZZER_NOTE_C7, 10, 0};
@@ -106,7 +110,7 @@ void kitchen_conversions_face_setup(uint8_t watch_face_index, void **context_ptr
     (void)watch_face_index;
     if (*context_ptr == NULL)
     {
-        *context_ptr = malloc(sizeof(kitchen_conversions_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(kitchen_conversions_state_t));
         memset(*context_ptr, 0, sizeof(kitchen_conversions_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
@@ -258,15 +262,16 @@ static void display(kitchen_conversions_state_t *state, uint8_t subsec)
         unit froms = get_unit_list(state->measurement_i)[state->from_i];
         unit tos = get_unit_list(state->measurement_i)[state->to_i];
         // Chooses correct factor for locale
-        double f_conv_factor = state->from_is_us ? froms.conv_factor_us : froms.conv_factor_uk;
-        double t_conv_factor = state->to_is_us ? tos.conv_factor_us : tos.conv_factor_uk;
-        // Converts
-        double to_base = (state->selection_value * f_conv_factor) + 100 * froms.linear_factor;
-        double conversion = ((to_base - 100 * tos.linear_factor) / t_conv_factor);
+        uint32_t f_conv_factor = state->from_is_us ? froms.conv_factor_us : froms.conv_factor_uk;
+        uint32_t t_conv_factor = state->to_is_us ? tos.conv_factor_us : tos.conv_factor_uk;
+        // Converts: the value in target units is exactly numerator / denominator
+        int64_t numerator = (int64_t)state->selection_value * f_conv_factor * tos.conv_divisor
+            + 100LL * (froms.linear_factor - tos.linear_factor) * froms.conv_divisor * tos.conv_divisor;
+        int64_t denominator = (int64_t)froms.conv_divisor * t_conv_factor;
 
         // If number too large or too small
         uint8_t lower_bound = (state->measurement_i == TEMP && state->to_i == 2) ? 100 : 0;
-        if (conversion >= 1000000 || conversion < lower_bound)
+        if (numerator >= 1000000 * denominator || numerator < (int64_t)lower_bound * denominator)
         {
             watch_set_indicator(WATCH_INDICATOR_BELL);
             watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, " Error", " Err");
@@ -276,7 +281,10 @@ static void display(kitchen_conversions_state_t *state, uint8_t subsec)
         }
         else
         {
-            uint32_t rounded = conversion + .5;
+            // round to nearest; quotient-plus-remainder avoids overflowing 2 * numerator
+            int64_t rounded64 = numerator / denominator;
+            if (2 * (numerator % denominator) >= denominator) rounded64++;
+            uint32_t rounded = (uint32_t)rounded64;
             char buf[7];
             sprintf(buf, "%6lu", rounded);
             watch_display_text(WATCH_POSITION_BOTTOM, buf);
@@ -22,16 +22,12 @@
  * SOFTWARE.
  */
 
-// Emulator only: need time() to seed the random number generator.
-#if __EMSCRIPTEN__
-#include <time.h>
-#endif
-
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 #include "lander_face.h"
 #include "watch_common_display.h"
+#include "watch_utility.h"
+#include "game_frame.h"
 
 #ifndef max
 #define max(x, y) ((y) > (x) ? (y) : (x))
@@ -102,29 +98,15 @@ static int gen_random_int (int16_t lower, int16_t upper) {
     int retVal;
     range = upper - lower + 1;
     if ( range < 2 ) range = 2;
-    // Emulator: use rand. Hardware: use arc4random.
-    #if __EMSCRIPTEN__
-    retVal = rand() % range;
-    #else
-    retVal = arc4random_uniform(range);
-    #endif
+    retVal = watch_utility_random_uniform(range);
     retVal += lower;
     return retVal;
 }
 
 static uint8_t assignProb ( uint8_t lowerProb, uint8_t upperProb, int16_t lowerSpeed, int16_t upperSpeed, int16_t actSpeed ) {
-    float probRange, speedRange;
-    float ratio, probFloat;
-    int probInt;
-    speedRange = upperSpeed - lowerSpeed;
-    if (speedRange<1.0) speedRange = 1.0;
-    probRange = upperProb - lowerProb;
-    ratio = ( (float) actSpeed - (float) lowerSpeed ) / speedRange;
-    probFloat = (float) lowerProb + ( ratio * probRange );
-    probInt = (int) ( probFloat + 0.5 );
-    probInt = min ( probInt, upperProb );
-    probInt = max ( probInt, lowerProb );
-    return (uint8_t) probInt;
+    int16_t speedRange = upperSpeed - lowerSpeed;
+    if ( speedRange < 1 ) speedRange = 1;
+    return (uint8_t) game_frame_lerp ( lowerProb, upperProb, actSpeed - lowerSpeed, speedRange );
 }
 
 static void write_to_lander_EEPROM(lander_state_t *state) {
@@ -143,15 +125,11 @@ static void write_to_lander_EEPROM(lander_state_t *state) {
 void lander_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(lander_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(lander_state_t));
         memset(*context_ptr, 0, sizeof(lander_state_t));
         lander_state_t *state = (lander_state_t *)*context_ptr;
         state->led_enabled = false;
     }
-    // Emulator only: Seed random number generator
-    #if __EMSCRIPTEN__
-    srand(time(NULL));
-    #endif
 }
 
 void lander_face_activate(void *context) {
@@ -205,6 +183,7 @@ bool lander_face_loop(movement_event_t event, void *context) {
 
     switch (event.event_type) {
         case EVENT_TICK:
+            game_frame_begin ( LANDER_TICK_FREQUENCY );
             state->tick_counter++;
             if ( state->mode == MODE_PLAYING ) {
                 int16_t accel = state->gravity;
@@ -239,7 +218,7 @@ bool lander_face_loop(movement_event_t event, void *context) {
                     state->tick_counter = 0;
                     state->mode = MODE_TOUCHDOWN_BLANK;
                 }
-                else {
+                else if ( !game_frame_should_skip_render ( ) ) {
                     // Update height display
                     sprintf ( buf, "%4d", (int) ( state->height / GRANUL ) );
                     watch_display_text( WATCH_POSITION_BOTTOM, buf );
@@ -252,11 +231,9 @@ bool lander_face_loop(movement_event_t event, void *context) {
                     watch_display_text( WATCH_POSITION_BOTTOM, "      " );
                     
                     // Also calc fuel score now.
-                    float fuel_score_float;
                     uint16_t fuel_used;
                     fuel_used = state->fuel_start - state->fuel_remaining;
-                    fuel_score_float = (float) fuel_used / (float) state->fuel_tpl;
-                    state->fuel_score = (int) (fuel_score_float * 100.0 + 0.5);
+                    state->fuel_score = (int) ( ( (uint32_t) fuel_used * 100 + state->fuel_tpl / 2 ) / state->fuel_tpl );
                     if ( state->legend_counter == 0 ) state->fuel_score -= 8;	// First Earth is easier
                         // Monitor reset_counter
                         if ( fuel_used >= 1 ) state->reset_counter = 0;
@@ -434,7 +411,7 @@ bool lander_face_loop(movement_event_t event, void *context) {
                             watch_display_text ( WATCH_POSITION_BOTTOM, buf );
                         }
                         // Wait long enough, then start game.
-                        if ( state->tick_counter >= ( 2.0 * LANDER_TICK_FREQUENCY ) ) {
+                        if ( state->tick_counter >= ( 2 * LANDER_TICK_FREQUENCY ) ) {
                             state->tick_counter = 0;
                             // Houston, WE ARE LAUNCHING NOW....
                             state->mode = MODE_PLAYING;
@@ -447,7 +424,7 @@ bool lander_face_loop(movement_event_t event, void *context) {
                             watch_display_text ( WATCH_POSITION_TOP_RIGHT, "  " );
                             watch_display_text ( WATCH_POSITION_BOTTOM, buf );
                         }
-                        if ( state->tick_counter == (int) ( 1.5 * LANDER_TICK_FREQUENCY + 1 ) ) {
+                        if ( state->tick_counter == ( ( 3 * LANDER_TICK_FREQUENCY ) / 2 + 1 ) ) {
                             sprintf ( buf, "EArTH " );
                             watch_display_text ( WATCH_POSITION_TOP_RIGHT, "  " );
                             watch_display_text ( WATCH_POSITION_BOTTOM, buf );
@@ -497,13 +474,15 @@ bool lander_face_loop(movement_event_t event, void *context) {
                         }
                         else if ( state->tick_counter >= MONSTER_DISPLAY_TICKS * 4 ) state->mode = MODE_WAITING_TO_START; // Safety
                     } // End if MODE_MONSTER
+            game_frame_end ( );
             break;  // End case EVENT_TICK
         case EVENT_ALARM_BUTTON_DOWN:
             if ( state->mode == MODE_WAITING_TO_START ) {
                 // That was the go signal - start a new game!!
-                float numerator, denominator, timeSquared;
+                int32_t numerator, denominator, timeSquared256;
                 int16_t gravity, thrust;
-                float myTime, distToTop, fuel_mult;
+                int32_t distToTop;
+                uint8_t fuel_mult10;
                 uint8_t skill_level;
                 int32_t tplTop;			// Top lander height for TPL calculations
                 movement_request_tick_frequency(LANDER_TICK_FREQUENCY);
@@ -517,21 +496,21 @@ bool lander_face_loop(movement_event_t event, void *context) {
                 state->gravity = gen_random_int ( -3, -2 ) * 2;	// negative downwards value
                 skill_level = gen_random_int ( 1, 4 );			// Precursor to fuel allocation
                 // Theoretical Perfect Landing (TPL) calculations start here.
-                myTime = (float) state->speed / (float) state->gravity;	// How long to reach this speed? Don't care which way sign is.
-                distToTop = fabs ( 0.5 * state->gravity * myTime * myTime );
-                tplTop = (int) ( state->height + distToTop + 0.5 );	// Theoretical highest point based on all of speed, height and gravity.
-                // Time squared = ( 2 * grav * height ) / ( t*t + g*t ), where t is net acceleration with thrust on.
                 gravity = abs ( state->gravity );
+                // Coasting distance to the top: speed^2 / ( 2 * gravity ), rounded. Sign doesn't matter.
+                distToTop = ( (int32_t) state->speed * state->speed + gravity ) / ( 2 * gravity );
+                tplTop = state->height + distToTop;	// Theoretical highest point based on all of speed, height and gravity.
+                // Time squared = ( 2 * grav * height ) / ( t*t + g*t ), where t is net acceleration with thrust on.
                 thrust = ENGINE_THRUST + state->gravity;
-                numerator = 2.0 * (float) gravity * (float) tplTop;
-                denominator = thrust * thrust + thrust * gravity;
-                timeSquared = numerator / denominator;
-                state->fuel_tpl = (int) ( sqrt ( timeSquared ) + 0.5 );  // Fuel required for theoretical perfect landing (TPL).
-                if ( skill_level == 1 ) fuel_mult = 4.0;		// TPL + 300%
-                else if ( skill_level == 2 ) fuel_mult = 2.5;	// TPL + 150%
-                else if ( skill_level == 3 ) fuel_mult = 1.6;	// TPL + 60%
-                else fuel_mult = 1.3;							// TPL + 30%
-                state->fuel_start = state->fuel_tpl * fuel_mult;
+                numerator = 2 * (int32_t) gravity * tplTop;
+                denominator = (int32_t) thrust * thrust + (int32_t) thrust * gravity;
+                timeSquared256 = ( numerator * 256 ) / denominator;	// Keep 8 fraction bits through the square root
+                state->fuel_tpl = ( game_frame_isqrt ( timeSquared256 ) + 8 ) / 16;  // Fuel required for theoretical perfect landing (TPL).
+                if ( skill_level == 1 ) fuel_mult10 = 40;		// TPL + 300%
+                else if ( skill_level == 2 ) fuel_mult10 = 25;	// TPL + 150%
+                else if ( skill_level == 3 ) fuel_mult10 = 16;	// TPL + 60%
+                else fuel_mult10 = 13;							// TPL + 30%
+                state->fuel_start = ( state->fuel_tpl * fuel_mult10 ) / 10;
                 state->fuel_remaining = state->fuel_start;
                 state->skill_level = skill_level;
                 state->tick_counter = 0;
@@ -30,27 +30,28 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
-#include <math.h>
 #include "moon_phase_face.h"
 #include "watch_utility.h"
+#include "ephemeris.h"
 
-#define LUNAR_DAYS 29.53058770576
-#define LUNAR_SECONDS (LUNAR_DAYS * (24 * 60 * 60))
-#define FIRST_MOON 947182440 // Saturday, 6 January 2000 18:14:00 in unix epoch time
 #define NUM_PHASES 8
 
-static const float phase_changes[] = {0, 1, 6.38264692644, 8.38264692644, 13.76529385288, 15.76529385288, 21.14794077932, 23.14794077932, 28.53058770576, 29.53058770576};
+// phase boundaries in hundredths of a day, matching ephemeris_moon_age_centidays.
+static const uint16_t phase_changes[] = {0, 100, 638, 838, 1377, 1577, 2115, 2315, 2853, 2954};
 
 void moon_phase_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(moon_phase_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(moon_phase_state_t));
         memset(*context_ptr, 0, sizeof(moon_phase_state_t));
     }
 }
 
 void moon_phase_face_activate(void *context) {
     (void) context;
+    // the displayed phase only changes hourly; run tickless and let the top-of-minute
+    // tick drive updates instead of waking every second.
+    movement_request_tick_frequency(0);
 }
 
 static void _update(moon_phase_state_t *state, uint32_t offset) {
@@ -59,12 +60,11 @@ static void _update(moon_phase_state_t *state, uint32_t offset) {
     watch_date_time_t date_time = watch_rtc_get_date_time();
     uint32_t now = watch_utility_date_time_to_unix_time(date_time, movement_get_current_timezone_offset()) + offset;
     date_time = watch_utility_date_time_from_unix_time(now, movement_get_current_timezone_offset());
-    double currentfrac = fmod(now - FIRST_MOON, LUNAR_SECONDS) / LUNAR_SECONDS;
-    double currentday = currentfrac * LUNAR_DAYS;
+    uint16_t age_centidays = ephemeris_moon_age_centidays(now);
     uint8_t phase_index = 0;
 
     for(phase_index = 0; phase_index <= NUM_PHASES; phase_index++) {
-        if (currentday > phase_changes[phase_index] && currentday <= phase_changes[phase_index + 1]) break;
+        if (age_centidays <= phase_changes[phase_index + 1]) break;
     }
 
     sprintf(buf, "%2d", date_time.unit.day);
@@ -81,7 +81,7 @@ static void _update(moon_phase_state_t *state, uint32_t offset) {
             if (watch_get_lcd_type() == WATCH_LCD_TYPE_CLASSIC) {
                 watch_set_pixel(2, 13);
                 watch_set_pixel(2, 15);
-                if (currentfrac > 0.125) watch_set_pixel(1, 13);
+                if (age_centidays > 369) watch_set_pixel(1, 13); // past 1/8 of the cycle
             }
             break;
         case 2:
@@ -146,7 +146,7 @@ static void _update(moon_phase_state_t *state, uint32_t offset) {
             if (watch_get_lcd_type() == WATCH_LCD_TYPE_CLASSIC) {
                 watch_set_pixel(0, 14);
                 watch_set_pixel(0, 13);
-                if (currentfrac < 0.875) watch_set_pixel(2, 14);
+                if (age_centidays < 2584) watch_set_pixel(2, 14); // before 7/8 of the cycle
             }
             break;
     }
@@ -0,0 +1,232 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "morse_trainer_face.h"
+#include "watch.h"
+#include "watch_utility.h"
+
+// One byte per character: a marker bit followed by the elements, MSB first,
+// 0 = dit and 1 = dah. 'A' (di-dah) is 0b101: marker, dit, dah. Indices 0-25
+// are A-Z, 26-35 are 0-9.
+#define MORSE_TRAINER_NUM_CHARS (36)
+static const uint8_t _morse_code[MORSE_TRAINER_NUM_CHARS] = {
+    0b101,    // A .-
+    0b11000,  // B -...
+    0b11010,  // C -.-.
+    0b1100,   // D -..
+    0b10,     // E .
+    0b10010,  // F ..-.
+    0b1110,   // G --.
+    0b10000,  // H ....
+    0b100,    // I ..
+    0b10111,  // J .---
+    0b1101,   // K -.-
+    0b10100,  // L .-..
+    0b111,    // M --
+    0b110,    // N -.
+    0b1111,   // O ---
+    0b10110,  // P .--.
+    0b11101,  // Q --.-
+    0b1010,   // R .-.
+    0b1000,   // S ...
+    0b11,     // T -
+    0b1001,   // U ..-
+    0b10001,  // V ...-
+    0b1011,   // W .--
+    0b11001,  // X -..-
+    0b11011,  // Y -.--
+    0b11100,  // Z --..
+    0b111111, // 0 -----
+    0b101111, // 1 .----
+    0b100111, // 2 ..---
+    0b100011, // 3 ...--
+    0b100001, // 4 ....-
+    0b100000, // 5 .....
+    0b110000, // 6 -....
+    0b111000, // 7 --...
+    0b111100, // 8 ---..
+    0b111110, // 9 ----.
+};
+
+// element timing, in buzzer sequencer ticks (1/64 s). 6 ticks per dit is
+// roughly 13 words per minute: brisk enough to learn rhythm, slow enough to copy.
+#define MORSE_TRAINER_DIT (6)
+
+// worst case six elements (the digits): six note/duration pairs, six rests, terminator.
+static int8_t _morse_seq[4 * 6 + 1];
+
+static const int8_t _morse_dit_seq[] = {BUZZER_NOTE_A5, MORSE_TRAINER_DIT, 0};
+static const int8_t _morse_dah_seq[] = {BUZZER_NOTE_A5, 3 * MORSE_TRAINER_DIT, 0};
+
+static char _morse_trainer_char(uint8_t index) {
+    return (index < 26) ? ('A' + index) : ('0' + index - 26);
+}
+
+// Hand the whole character to the buzzer sequencer in one go; it paces the
+// elements on its own timer, so no per-element wakes land on the face.
+static void _morse_trainer_play(uint8_t code) {
+    uint8_t len = 0;
+    uint8_t n = 7;
+    while (!(code & (1u << n))) n--;
+    while (n--) {
+        _morse_seq[len++] = BUZZER_NOTE_A5;
+        _morse_seq[len++] = (code & (1u << n)) ? 3 * MORSE_TRAINER_DIT : MORSE_TRAINER_DIT;
+        _morse_seq[len++] = BUZZER_NOTE_REST;
+        _morse_seq[len++] = MORSE_TRAINER_DIT;
+    }
+    _morse_seq[len] = 0;
+    watch_buzzer_play_sequence(_morse_seq, NULL);
+}
+
+static void _morse_trainer_update_display(morse_trainer_state_t *state) {
+    char buf[7];
+
+    watch_display_text(WATCH_POSITION_TOP_RIGHT, "  ");
+    if (state->keying_mode) {
+        watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "KEY", "KE");
+        if (state->keyed > 1) {
+            // count the elements keyed so far in the top right
+            uint8_t count = 0;
+            for (uint8_t v = state->keyed; v > 1; v >>= 1) count++;
+            sprintf(buf, "%2d", count);
+            watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
+        }
+        if (state->revealed) {
+            // scan the table for what was keyed; everything else shows as --
+            char decoded = '-';
+            for (uint8_t i = 0; i < MORSE_TRAINER_NUM_CHARS; i++) {
+                if (_morse_code[i] == state->keyed) {
+                    decoded = _morse_trainer_char(i);
+                    break;
+                }
+            }
+            sprintf(buf, "  %c%c  ", decoded, decoded == '-' ? '-' : ' ');
+            watch_display_text(WATCH_POSITION_BOTTOM, buf);
+        } else {
+            watch_display_text(WATCH_POSITION_BOTTOM, "      ");
+        }
+    } else {
+        watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "MOR", "MO");
+        if (state->revealed) {
+            sprintf(buf, "  %c   ", _morse_trainer_char(state->current));
+            watch_display_text(WATCH_POSITION_BOTTOM, buf);
+        } else {
+            watch_display_text(WATCH_POSITION_BOTTOM, "      ");
+        }
+    }
+}
+
+static void _morse_trainer_next_challenge(morse_trainer_state_t *state) {
+    state->current = watch_utility_random_uniform(MORSE_TRAINER_NUM_CHARS);
+    state->revealed = false;
+    _morse_trainer_update_display(state);
+    _morse_trainer_play(_morse_code[state->current]);
+}
+
+static void _morse_trainer_key_element(morse_trainer_state_t *state, bool dah) {
+    if (state->revealed) {
+        // last character was decoded; this element starts a new one
+        state->revealed = false;
+        state->keyed = 1;
+    }
+    // six elements is the longest code we know; ignore anything past that
+    if (state->keyed < 0b1000000) state->keyed = (state->keyed << 1) | (dah ? 1 : 0);
+    watch_buzzer_play_sequence(dah ? _morse_dah_seq : _morse_dit_seq, NULL);
+    _morse_trainer_update_display(state);
+}
+
+void morse_trainer_face_setup(uint8_t watch_face_index, void ** context_ptr) {
+    (void) watch_face_index;
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(morse_trainer_state_t));
+        memset(*context_ptr, 0, sizeof(morse_trainer_state_t));
+    }
+}
+
+void morse_trainer_face_activate(void *context) {
+    morse_trainer_state_t *state = (morse_trainer_state_t *)context;
+    state->revealed = false;
+    state->keyed = 1;
+    // nothing here animates; the buzzer sequencer keeps its own time.
+    movement_request_tick_frequency(0);
+}
+
+bool morse_trainer_face_loop(movement_event_t event, void *context) {
+    morse_trainer_state_t *state = (morse_trainer_state_t *)context;
+
+    switch (event.event_type) {
+        case EVENT_ACTIVATE:
+            if (state->keying_mode) _morse_trainer_update_display(state);
+            else _morse_trainer_next_challenge(state);
+            break;
+        case EVENT_ALARM_BUTTON_UP:
+            if (state->keying_mode) {
+                _morse_trainer_key_element(state, false);
+            } else if (state->revealed) {
+                _morse_trainer_next_challenge(state);
+            } else {
+                state->revealed = true;
+                _morse_trainer_update_display(state);
+            }
+            break;
+        case EVENT_ALARM_LONG_PRESS:
+            // a hold past half a second is a dah; listen mode has no use for it
+            if (state->keying_mode) _morse_trainer_key_element(state, true);
+            break;
+        case EVENT_LIGHT_BUTTON_DOWN:
+            if (state->keying_mode) {
+                // decode what was keyed (the next element starts a new character)
+                if (state->keyed > 1) {
+                    state->revealed = true;
+                    _morse_trainer_update_display(state);
+                }
+            } else {
+                // replay the current character
+                _morse_trainer_play(_morse_code[state->current]);
+            }
+            break;
+        case EVENT_LIGHT_LONG_PRESS:
+            // switch between copy practice and keying practice
+            state->keying_mode = !state->keying_mode;
+            state->revealed = false;
+            state->keyed = 1;
+            if (state->keying_mode) _morse_trainer_update_display(state);
+            else _morse_trainer_next_challenge(state);
+            break;
+        case EVENT_TIMEOUT:
+            movement_move_to_face(0);
+            break;
+        default:
+            movement_default_loop_handler(event);
+            break;
+    }
+
+    return true;
+}
+
+void morse_trainer_face_resign(void *context) {
+    (void) context;
+}
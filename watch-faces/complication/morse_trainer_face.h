@@ -0,0 +1,72 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "pins.h"
+
+/*
+ * MORSE CODE TRAINER
+ *
+ * A copy-and-keying trainer for International Morse Code. Each character's
+ * code lives in one const byte: a marker bit followed by the dit/dah elements
+ * (0 = dit, 1 = dah), so the whole A–Z 0–9 table costs 36 bytes of flash and
+ * encoding or decoding a character is a shift loop over that byte. Playback
+ * hands a prebuilt note sequence to the buzzer sequencer, which runs the
+ * elements on its own timing — the watch face doesn't wake per dit.
+ *
+ * Listen mode (“MOR”): the face plays a random character's code without
+ * showing it. Press ALARM to reveal the answer; press ALARM again for the
+ * next character. A short press of LIGHT replays the code.
+ *
+ * Keying mode (“KEY”): tap ALARM for a dit, hold it past half a second for a
+ * dah; the face echoes each element on the buzzer and counts them in the top
+ * right. A short press of LIGHT decodes what you keyed and shows the
+ * character (or “--” if it isn't one). The next tap starts a new character.
+ *
+ * A long press of LIGHT switches between the two modes.
+ */
+
+#include "movement.h"
+#include "watch.h"
+
+typedef struct {
+    bool keying_mode;       // false = listen (copy) practice, true = keying practice
+    bool revealed;          // listen mode: the answer is on screen
+    uint8_t current;        // listen mode: index of the character being played
+    uint8_t keyed;          // keying mode: marker bit + elements keyed so far
+} morse_trainer_state_t;
+
+void morse_trainer_face_setup(uint8_t watch_face_index, void ** context_ptr);
+void morse_trainer_face_activate(void *context);
+bool morse_trainer_face_loop(movement_event_t event, void *context);
+void morse_trainer_face_resign(void *context);
+
+#define morse_trainer_face ((const watch_face_t){ \
+    morse_trainer_face_setup, \
+    morse_trainer_face_activate, \
+    morse_trainer_face_loop, \
+    morse_trainer_face_resign, \
+    NULL, \
+})
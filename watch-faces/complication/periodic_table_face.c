@@ -35,8 +35,6 @@
 
 static bool _quick_ticks_running;
 static uint8_t _ts_ticks = 0;
-static int16_t _text_pos;
-static const char* _text_looping;
 static const char title_text[] = "Periodic table";
 
 void periodic_table_face_setup(uint8_t watch_face_index, void **context_ptr)
@@ -44,7 +42,7 @@ void periodic_table_face_setup(uint8_t watch_face_index, void **context_ptr)
     (void)watch_face_index;
     if (*context_ptr == NULL)
     {
-        *context_ptr = malloc(sizeof(periodic_table_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(periodic_table_state_t));
         memset(*context_ptr, 0, sizeof(periodic_table_state_t));
     }
 }
@@ -120,139 +118,174 @@ static inline const char* _get_group_name(PeriodicGroup group) {
     return group_name[group];
 }
 
+// Element names live in one shared pool; each record stores a byte offset into it.
+static const char name_pool[] =
+    "Hydrogen\0" "Helium\0" "Lithium\0" "Beryllium\0" "Boron\0" "Carbon\0"
+    "Nitrogen\0" "Oxygen\0" "Fluorine\0" "Neon\0" "Sodium\0" "Magnesium\0"
+    "Aluminium\0" "Silicon\0" "Phosphorus\0" "Sulfur\0" "Chlorine\0" "Argon\0"
+    "Potassium\0" "Calcium\0" "Scandium\0" "Titanium\0" "Vanadium\0" "Chromium\0"
+    "Manganese\0" "Iron\0" "Cobalt\0" "Nickel\0" "Copper\0" "Zinc\0"
+    "Gallium\0" "Germanium\0" "Arsenic\0" "Selenium\0" "Bromine\0" "Krypton\0"
+    "Rubidium\0" "Strontium\0" "Yttrium\0" "Zirconium\0" "Niobium\0" "Molybdenum\0"
+    "Technetium\0" "Ruthenium\0" "Rhodium\0" "Palladium\0" "Silver\0" "Cadmium\0"
+    "Indium\0" "Tin\0" "Antimony\0" "Tellurium\0" "Iodine\0" "Xenon\0"
+    "Caesium\0" "Barium\0" "Lanthanum\0" "Cerium\0" "Praseodymium\0" "Neodymium\0"
+    "Promethium\0" "Samarium\0" "Europium\0" "Gadolinium\0" "Terbium\0" "Dysprosium\0"
+    "Holmium\0" "Erbium\0" "Thulium\0" "Ytterbium\0" "Lutetium\0" "Hafnium\0"
+    "Tantalum\0" "Tungsten\0" "Rhenium\0" "Osmium\0" "Iridium\0" "Platinum\0"
+    "Gold\0" "Mercury\0" "Thallium\0" "Lead\0" "Bismuth\0" "Polonium\0"
+    "Astatine\0" "Radon\0" "Francium\0" "Radium\0" "Actinium\0" "Thorium\0"
+    "Protactinium\0" "Uranium\0" "Neptunium\0" "Plutonium\0" "Americium\0" "Curium\0"
+    "Berkelium\0" "Californium\0" "Einsteinium\0" "Fermium\0" "Mendelevium\0" "Nobelium\0"
+    "Lawrencium\0" "Rutherfordium\0" "Dubnium\0" "Seaborgium\0" "Bohrium\0" "Hassium\0"
+    "Meitnerium\0" "Darmstadtium\0" "Roentgenium\0" "Copernicium\0" "Nihonium\0" "Flerovium\0"
+    "Moscovium\0" "Livermorium\0" "Tennessine\0" "Oganesson\0";
+
 typedef struct
 {
-    char symbol[3];
-    char name[14];  // Longest is Rutherfordium
-    int16_t year_discovered;  // Negative is BC
+    char symbol[2];  // one-letter symbols are NUL-padded; use _element_symbol() to display
+    uint16_t name_offset;  // offset of the NUL-terminated name in name_pool
     uint16_t atomic_mass;  // In units of 0.01 AMU
-    uint16_t electronegativity;  // In units of 0.01
-    PeriodicGroup group;
-} element;
+    int16_t year_discovered;  // Negative is BC
+    uint16_t electronegativity : 12;  // In units of 0.01
+    uint16_t group : 4;  // PeriodicGroup
+} element;  // 10 bytes per record, indexed by atomic number - 1
 
 // Comments on the table denote symbols that cannot be displayed
 #define MAX_ELEMENT 118
 const element table[MAX_ELEMENT] = {
-    { .symbol = "H", .name = "Hydrogen", .year_discovered = 1671, .atomic_mass = 101, .electronegativity = 220, .group = NONE },
-    { .symbol = "He", .name = "Helium", .year_discovered = 1868, .atomic_mass = 400, .electronegativity = 0, .group = ZERO },
-    { .symbol = "Li", .name = "Lithium", .year_discovered = 1817, .atomic_mass = 694, .electronegativity = 98, .group = ONE },
-    { .symbol = "Be", .name = "Beryllium", .year_discovered = 1798, .atomic_mass = 901, .electronegativity = 157, .group = TWO },
-    { .symbol = "B", .name = "Boron", .year_discovered = 1787, .atomic_mass = 1081, .electronegativity = 204, .group = THREE },
-    { .symbol = "C", .name = "Carbon", .year_discovered = -26000, .atomic_mass = 1201, .electronegativity = 255, .group = FOUR },
-    { .symbol = "N", .name = "Nitrogen", .year_discovered = 1772, .atomic_mass = 1401, .electronegativity = 304, .group = FIVE },
-    { .symbol = "O", .name = "Oxygen", .year_discovered = 1771, .atomic_mass = 1600, .electronegativity = 344, .group = SIX },
-    { .symbol = "F", .name = "Fluorine", .year_discovered = 1771, .atomic_mass = 1900, .electronegativity = 398, .group = SEVEN },
-    { .symbol = "Ne", .name = "Neon", .year_discovered = 1898, .atomic_mass = 2018, .electronegativity = 0, .group = ZERO },
-    { .symbol = "Na", .name = "Sodium", .year_discovered = 1702, .atomic_mass = 2299, .electronegativity = 93, .group = ONE },
-    { .symbol = "Mg", .name = "Magnesium", .year_discovered = 1755, .atomic_mass = 2431, .electronegativity = 131, .group = TWO },
-    { .symbol = "Al", .name = "Aluminium", .year_discovered = 1746, .atomic_mass = 2698, .electronegativity = 161, .group = THREE },
-    { .symbol = "Si", .name = "Silicon", .year_discovered = 1739, .atomic_mass = 2809, .electronegativity = 190, .group = FOUR },
-    { .symbol = "P", .name = "Phosphorus", .year_discovered = 1669, .atomic_mass = 3097, .electronegativity = 219, .group = FIVE },
-    { .symbol = "S", .name = "Sulfur", .year_discovered = -2000, .atomic_mass = 3206, .electronegativity = 258, .group = SIX },
-    { .symbol = "Cl", .name = "Chlorine", .year_discovered = 1774, .atomic_mass = 3545., .electronegativity = 316, .group = SEVEN },
-    { .symbol = "Ar", .name = "Argon", .year_discovered = 1894, .atomic_mass = 3995., .electronegativity = 0, .group = ZERO },
-    { .symbol = "K", .name = "Potassium", .year_discovered = 1702, .atomic_mass = 3910, .electronegativity = 82, .group = ONE },
-    { .symbol = "Ca", .name = "Calcium", .year_discovered = 1739, .atomic_mass = 4008, .electronegativity = 100, .group = TWO },
-    { .symbol = "Sc", .name = "Scandium", .year_discovered = 1879, .atomic_mass = 4496, .electronegativity = 136, .group = TRANSITION },
-    { .symbol = "Ti", .name = "Titanium", .year_discovered = 1791, .atomic_mass = 4787, .electronegativity = 154, .group = TRANSITION },
-    { .symbol = "W", .name = "Vanadium", .year_discovered = 1801, .atomic_mass = 5094, .electronegativity = 163, .group = TRANSITION },
-    { .symbol = "Cr", .name = "Chromium", .year_discovered = 1797, .atomic_mass = 5200, .electronegativity = 166, .group = TRANSITION },
-    { .symbol = "Mn", .name = "Manganese", .year_discovered = 1774, .atomic_mass = 5494, .electronegativity = 155, .group = TRANSITION },
-    { .symbol = "Fe", .name = "Iron", .year_discovered = -5000, .atomic_mass = 5585, .electronegativity = 183, .group = TRANSITION },
-    { .symbol = "Co", .name = "Cobalt", .year_discovered = 1735, .atomic_mass = 5893, .electronegativity = 188, .group = TRANSITION },
-    { .symbol = "Ni", .name = "Nickel", .year_discovered = 1751, .atomic_mass = 5869, .electronegativity = 191, .group = TRANSITION },
-    { .symbol = "Cu", .name = "Copper", .year_discovered = -9000, .atomic_mass = 6355, .electronegativity = 190, .group = TRANSITION },
-    { .symbol = "Zn", .name = "Zinc", .year_discovered = -1000, .atomic_mass = 6538, .electronegativity = 165, .group = TRANSITION },
-    { .symbol = "Ga", .name = "Gallium", .year_discovered = 1875, .atomic_mass = 6972, .electronegativity = 181, .group = THREE },
-    { .symbol = "Ge", .name = "Germanium", .year_discovered = 1886, .atomic_mass = 7263, .electronegativity = 201, .group = FOUR },
-    { .symbol = "As", .name = "Arsenic", .year_discovered = 300, .atomic_mass = 7492, .electronegativity = 218, .group = FIVE },
-    { .symbol = "Se", .name = "Selenium", .year_discovered = 1817, .atomic_mass = 7897, .electronegativity = 255, .group = SIX },
-    { .symbol = "Br", .name = "Bromine", .year_discovered = 1825, .atomic_mass = 7990., .electronegativity = 296, .group = SEVEN },
-    { .symbol = "Kr", .name = "Krypton", .year_discovered = 1898, .atomic_mass = 8380, .electronegativity = 300, .group = ZERO },
-    { .symbol = "Rb", .name = "Rubidium", .year_discovered = 1861, .atomic_mass = 8547, .electronegativity = 82, .group = ONE },
-    { .symbol = "Sr", .name = "Strontium", .year_discovered = 1787, .atomic_mass = 8762, .electronegativity = 95, .group = TWO },
-    { .symbol = "Y", .name = "Yttrium", .year_discovered = 1794, .atomic_mass = 8891, .electronegativity = 122, .group = TRANSITION },
-    { .symbol = "Zr", .name = "Zirconium", .year_discovered = 1789, .atomic_mass = 9122, .electronegativity = 133, .group = TRANSITION },
-    { .symbol = "Nb", .name = "Niobium", .year_discovered = 1801, .atomic_mass = 9291, .electronegativity = 160, .group = TRANSITION },
-    { .symbol = "Mo", .name = "Molybdenum", .year_discovered = 1778, .atomic_mass = 9595, .electronegativity = 216, .group = TRANSITION },
-    { .symbol = "Tc", .name = "Technetium", .year_discovered = 1937, .atomic_mass = 9700, .electronegativity = 190, .group = TRANSITION },
-    { .symbol = "Ru", .name = "Ruthenium", .year_discovered = 1844, .atomic_mass = 10107, .electronegativity = 220, .group = TRANSITION },
-    { .symbol = "Rh", .name = "Rhodium", .year_discovered = 1804, .atomic_mass = 10291, .electronegativity = 228, .group = TRANSITION },
-    { .symbol = "Pd", .name = "Palladium", .year_discovered = 1802, .atomic_mass = 10642, .electronegativity = 220, .group = TRANSITION },
-    { .symbol = "Ag", .name = "Silver", .year_discovered = -5000, .atomic_mass = 10787, .electronegativity = 193, .group = TRANSITION },
-    { .symbol = "Cd", .name = "Cadmium", .year_discovered = 1817, .atomic_mass = 11241, .electronegativity = 169, .group = TRANSITION },
-    { .symbol = "In", .name = "Indium", .year_discovered = 1863, .atomic_mass = 11482, .electronegativity = 178, .group = THREE },
-    { .symbol = "Sn", .name = "Tin", .year_discovered = -3500, .atomic_mass = 11871, .electronegativity = 196, .group = FOUR },
-    { .symbol = "Sb", .name = "Antimony", .year_discovered = -3000, .atomic_mass = 12176, .electronegativity = 205, .group = FIVE },
-    { .symbol = "Te", .name = "Tellurium", .year_discovered = 1782, .atomic_mass = 12760, .electronegativity = 210, .group = SIX },
-    { .symbol = "I", .name = "Iodine", .year_discovered = 1811, .atomic_mass = 12690, .electronegativity = 266, .group = SEVEN },
-    { .symbol = "Xe", .name = "Xenon", .year_discovered = 1898, .atomic_mass = 13129, .electronegativity = 260, .group = ZERO },
-    { .symbol = "Cs", .name = "Caesium", .year_discovered = 1860, .atomic_mass = 13291, .electronegativity = 79, .group = ONE },
-    { .symbol = "Ba", .name = "Barium", .year_discovered = 1772, .atomic_mass = 13733., .electronegativity = 89, .group = TWO },
-    { .symbol = "La", .name = "Lanthanum", .year_discovered = 1838, .atomic_mass = 13891, .electronegativity = 110, .group = LANTHANIDE },
-    { .symbol = "Ce", .name = "Cerium", .year_discovered = 1803, .atomic_mass = 14012, .electronegativity = 112, .group = LANTHANIDE },
-    { .symbol = "Pr", .name = "Praseodymium", .year_discovered = 1885, .atomic_mass = 14091, .electronegativity = 113, .group = LANTHANIDE },
-    { .symbol = "Nd", .name = "Neodymium", .year_discovered = 1841, .atomic_mass = 14424, .electronegativity = 114, .group = LANTHANIDE },
-    { .symbol = "Pm", .name = "Promethium", .year_discovered = 1945, .atomic_mass = 14500, .electronegativity = 113, .group = LANTHANIDE },
-    { .symbol = "Sm", .name = "Samarium", .year_discovered = 1879, .atomic_mass = 15036., .electronegativity = 117, .group = LANTHANIDE },
-    { .symbol = "Eu", .name = "Europium", .year_discovered = 1896, .atomic_mass = 15196, .electronegativity = 120, .group = LANTHANIDE },
-    { .symbol = "Gd", .name = "Gadolinium", .year_discovered = 1880, .atomic_mass = 15725, .electronegativity = 120, .group = LANTHANIDE },
-    { .symbol = "Tb", .name = "Terbium", .year_discovered = 1843, .atomic_mass = 15893, .electronegativity = 120, .group = LANTHANIDE },
-    { .symbol = "Dy", .name = "Dysprosium", .year_discovered = 1886, .atomic_mass = 16250, .electronegativity = 122, .group = LANTHANIDE },
-    { .symbol = "Ho", .name = "Holmium", .year_discovered = 1878, .atomic_mass = 16493, .electronegativity = 123, .group = LANTHANIDE },
-    { .symbol = "Er", .name = "Erbium", .year_discovered = 1843, .atomic_mass = 16726, .electronegativity = 124, .group = LANTHANIDE },
-    { .symbol = "Tm", .name = "Thulium", .year_discovered = 1879, .atomic_mass = 16893, .electronegativity = 125, .group = LANTHANIDE },
-    { .symbol = "Yb", .name = "Ytterbium", .year_discovered = 1878, .atomic_mass = 17305, .electronegativity = 110, .group = LANTHANIDE },
-    { .symbol = "Lu", .name = "Lutetium", .year_discovered = 1906, .atomic_mass = 17497, .electronegativity = 127, .group = LANTHANIDE },
-    { .symbol = "Hf", .name = "Hafnium", .year_discovered = 1922, .atomic_mass = 17849, .electronegativity = 130, .group = TRANSITION },
-    { .symbol = "Ta", .name = "Tantalum", .year_discovered = 1802, .atomic_mass = 18095, .electronegativity = 150, .group = TRANSITION },
-    { .symbol = "W", .name = "Tungsten", .year_discovered = 1781, .atomic_mass = 18384, .electronegativity = 236, .group = TRANSITION },
-    { .symbol = "Re", .name = "Rhenium", .year_discovered = 1908, .atomic_mass = 18621, .electronegativity = 190, .group = TRANSITION },
-    { .symbol = "Os", .name = "Osmium", .year_discovered = 1803, .atomic_mass = 19023, .electronegativity = 220, .group = TRANSITION },
-    { .symbol = "Ir", .name = "Iridium", .year_discovered = 1803, .atomic_mass = 19222, .electronegativity = 220, .group = TRANSITION },
-    { .symbol = "Pt", .name = "Platinum", .year_discovered = -600, .atomic_mass = 19508, .electronegativity = 228, .group = TRANSITION },
-    { .symbol = "Au", .name = "Gold", .year_discovered = -6000, .atomic_mass = 19697, .electronegativity = 254, .group = TRANSITION },
-    { .symbol = "Hf", .name = "Mercury", .year_discovered = -1500, .atomic_mass = 20059, .electronegativity = 200, .group = TRANSITION },
-    { .symbol = "Tl", .name = "Thallium", .year_discovered = 1861, .atomic_mass = 20438, .electronegativity = 162, .group = THREE },
-    { .symbol = "Pb", .name = "Lead", .year_discovered = -7000, .atomic_mass = 20720, .electronegativity = 187, .group = FOUR },
-    { .symbol = "Bi", .name = "Bismuth", .year_discovered = 1500, .atomic_mass = 20898, .electronegativity = 202, .group = FIVE },
-    { .symbol = "Po", .name = "Polonium", .year_discovered = 1898, .atomic_mass = 20900, .electronegativity = 200, .group = SIX },
-    { .symbol = "At", .name = "Astatine", .year_discovered = 1940, .atomic_mass = 21000, .electronegativity = 220, .group = SEVEN },
-    { .symbol = "Rn", .name = "Radon", .year_discovered = 1899, .atomic_mass = 22200, .electronegativity = 220, .group = ZERO },
-    { .symbol = "Fr", .name = "Francium", .year_discovered = 1939, .atomic_mass = 22300, .electronegativity = 79, .group = ONE },
-    { .symbol = "Ra", .name = "Radium", .year_discovered = 1898, .atomic_mass = 22600, .electronegativity = 90, .group = TWO },
-    { .symbol = "Ac", .name = "Actinium", .year_discovered = 1902, .atomic_mass = 22700, .electronegativity = 110, .group = ACTINIDE },
-    { .symbol = "Th", .name = "Thorium", .year_discovered = 1829, .atomic_mass = 23204, .electronegativity = 130, .group = ACTINIDE },
-    { .symbol = "Pa", .name = "Protactinium", .year_discovered = 1913, .atomic_mass = 23104, .electronegativity = 150, .group = ACTINIDE },
-    { .symbol = "U", .name = "Uranium", .year_discovered = 1789, .atomic_mass = 23803, .electronegativity = 138, .group = ACTINIDE },
-    { .symbol = "Np", .name = "Neptunium", .year_discovered = 1940, .atomic_mass = 23700, .electronegativity = 136, .group = ACTINIDE },
-    { .symbol = "Pu", .name = "Plutonium", .year_discovered = 1941, .atomic_mass = 24400, .electronegativity = 128, .group = ACTINIDE },
-    { .symbol = "Am", .name = "Americium", .year_discovered = 1944, .atomic_mass = 24300, .electronegativity = 113, .group = ACTINIDE },
-    { .symbol = "Cm", .name = "Curium", .year_discovered = 1944, .atomic_mass = 24700, .electronegativity = 128, .group = ACTINIDE },
-    { .symbol = "Bk", .name = "Berkelium", .year_discovered = 1949, .atomic_mass = 24700, .electronegativity = 130, .group = ACTINIDE },
-    { .symbol = "Cf", .name = "Californium", .year_discovered = 1950, .atomic_mass = 25100, .electronegativity = 130, .group = ACTINIDE },
-    { .symbol = "Es", .name = "Einsteinium", .year_discovered = 1952, .atomic_mass = 25200, .electronegativity = 130, .group = ACTINIDE },
-    { .symbol = "Fm", .name = "Fermium", .year_discovered = 1953, .atomic_mass = 25700, .electronegativity = 130, .group = ACTINIDE },
-    { .symbol = "Md", .name = "Mendelevium", .year_discovered = 1955, .atomic_mass = 25800, .electronegativity = 130, .group = ACTINIDE },
-    { .symbol = "No", .name = "Nobelium", .year_discovered = 1965, .atomic_mass = 25900, .electronegativity = 130, .group = ACTINIDE },
-    { .symbol = "Lr", .name = "Lawrencium", .year_discovered = 1961, .atomic_mass = 26600, .electronegativity = 130, .group = ACTINIDE },
-    { .symbol = "Rf", .name = "Rutherfordium", .year_discovered = 1969, .atomic_mass = 26700, .electronegativity = 0, .group = TRANSITION },
-    { .symbol = "Db", .name = "Dubnium", .year_discovered = 1970, .atomic_mass = 26800, .electronegativity = 0, .group = TRANSITION },
-    { .symbol = "Sg", .name = "Seaborgium", .year_discovered = 1974, .atomic_mass = 26700, .electronegativity = 0, .group = TRANSITION },
-    { .symbol = "Bh", .name = "Bohrium", .year_discovered = 1981, .atomic_mass = 27000, .electronegativity = 0, .group = TRANSITION },
-    { .symbol = "Hs", .name = "Hassium", .year_discovered = 1984, .atomic_mass = 27100, .electronegativity = 0, .group = TRANSITION },
-    { .symbol = "Mt", .name = "Meitnerium", .year_discovered = 1982, .atomic_mass = 27800, .electronegativity = 0, .group = TRANSITION },
-    { .symbol = "Ds", .name = "Darmstadtium", .year_discovered = 1994, .atomic_mass = 28100, .electronegativity = 0, .group = TRANSITION },
-    { .symbol = "Rg", .name = "Roentgenium", .year_discovered = 1994, .atomic_mass = 28200, .electronegativity = 0, .group = TRANSITION },
-    { .symbol = "Cn", .name = "Copernicium", .year_discovered = 1996, .atomic_mass = 28500, .electronegativity = 0, .group = TRANSITION },
-    { .symbol = "Nh", .name = "Nihonium", .year_discovered = 2004, .atomic_mass = 28600, .electronegativity = 0, .group = THREE },
-    { .symbol = "Fl", .name = "Flerovium", .year_discovered = 1999, .atomic_mass = 28900, .electronegativity = 0, .group = FOUR },
-    { .symbol = "Mc", .name = "Moscovium", .year_discovered = 2003, .atomic_mass = 29000, .electronegativity = 0, .group = FIVE },
-    { .symbol = "Lw", .name = "Livermorium", .year_discovered = 2000, .atomic_mass = 29300, .electronegativity = 0, .group = SIX },
-    { .symbol = "Ts", .name = "Tennessine", .year_discovered = 2009, .atomic_mass = 29400, .electronegativity = 0, .group = SEVEN },
-    { .symbol = "Og", .name = "Oganesson", .year_discovered = 2002, .atomic_mass = 29400, .electronegativity = 0, .group = ZERO },
+    { .symbol = "H", .name_offset = 0, .atomic_mass = 101, .year_discovered = 1671, .electronegativity = 220, .group = NONE },
+    { .symbol = "He", .name_offset = 9, .atomic_mass = 400, .year_discovered = 1868, .electronegativity = 0, .group = ZERO },
+    { .symbol = "Li", .name_offset = 16, .atomic_mass = 694, .year_discovered = 1817, .electronegativity = 98, .group = ONE },
+    { .symbol = "Be", .name_offset = 24, .atomic_mass = 901, .year_discovered = 1798, .electronegativity = 157, .group = TWO },
+    { .symbol = "B", .name_offset = 34, .atomic_mass = 1081, .year_discovered = 1787, .electronegativity = 204, .group = THREE },
+    { .symbol = "C", .name_offset = 40, .atomic_mass = 1201, .year_discovered = -26000, .electronegativity = 255, .group = FOUR },
+    { .symbol = "N", .name_offset = 47, .atomic_mass = 1401, .year_discovered = 1772, .electronegativity = 304, .group = FIVE },
+    { .symbol = "O", .name_offset = 56, .atomic_mass = 1600, .year_discovered = 1771, .electronegativity = 344, .group = SIX },
+    { .symbol = "F", .name_offset = 63, .atomic_mass = 1900, .year_discovered = 1771, .electronegativity = 398, .group = SEVEN },
+    { .symbol = "Ne", .name_offset = 72, .atomic_mass = 2018, .year_discovered = 1898, .electronegativity = 0, .group = ZERO },
+    { .symbol = "Na", .name_offset = 77, .atomic_mass = 2299, .year_discovered = 1702, .electronegativity = 93, .group = ONE },
+    { .symbol = "Mg", .name_offset = 84, .atomic_mass = 2431, .year_discovered = 1755, .electronegativity = 131, .group = TWO },
+    { .symbol = "Al", .name_offset = 94, .atomic_mass = 2698, .year_discovered = 1746, .electronegativity = 161, .group = THREE },
+    { .symbol = "Si", .name_offset = 104, .atomic_mass = 2809, .year_discovered = 1739, .electronegativity = 190, .group = FOUR },
+    { .symbol = "P", .name_offset = 112, .atomic_mass = 3097, .year_discovered = 1669, .electronegativity = 219, .group = FIVE },
+    { .symbol = "S", .name_offset = 123, .atomic_mass = 3206, .year_discovered = -2000, .electronegativity = 258, .group = SIX },
+    { .symbol = "Cl", .name_offset = 130, .atomic_mass = 3545, .year_discovered = 1774, .electronegativity = 316, .group = SEVEN },
+    { .symbol = "Ar", .name_offset = 139, .atomic_mass = 3995, .year_discovered = 1894, .electronegativity = 0, .group = ZERO },
+    { .symbol = "K", .name_offset = 145, .atomic_mass = 3910, .year_discovered = 1702, .electronegativity = 82, .group = ONE },
+    { .symbol = "Ca", .name_offset = 155, .atomic_mass = 4008, .year_discovered = 1739, .electronegativity = 100, .group = TWO },
+    { .symbol = "Sc", .name_offset = 163, .atomic_mass = 4496, .year_discovered = 1879, .electronegativity = 136, .group = TRANSITION },
+    { .symbol = "Ti", .name_offset = 172, .atomic_mass = 4787, .year_discovered = 1791, .electronegativity = 154, .group = TRANSITION },
+    { .symbol = "W", .name_offset = 181, .atomic_mass = 5094, .year_discovered = 1801, .electronegativity = 163, .group = TRANSITION },
+    { .symbol = "Cr", .name_offset = 190, .atomic_mass = 5200, .year_discovered = 1797, .electronegativity = 166, .group = TRANSITION },
+    { .symbol = "Mn", .name_offset = 199, .atomic_mass = 5494, .year_discovered = 1774, .electronegativity = 155, .group = TRANSITION },
+    { .symbol = "Fe", .name_offset = 209, .atomic_mass = 5585, .year_discovered = -5000, .electronegativity = 183, .group = TRANSITION },
+    { .symbol = "Co", .name_offset = 214, .atomic_mass = 5893, .year_discovered = 1735, .electronegativity = 188, .group = TRANSITION },
+    { .symbol = "Ni", .name_offset = 221, .atomic_mass = 5869, .year_discovered = 1751, .electronegativity = 191, .group = TRANSITION },
+    { .symbol = "Cu", .name_offset = 228, .atomic_mass = 6355, .year_discovered = -9000, .electronegativity = 190, .group = TRANSITION },
+    { .symbol = "Zn", .name_offset = 235, .atomic_mass = 6538, .year_discovered = -1000, .electronegativity = 165, .group = TRANSITION },
+    { .symbol = "Ga", .name_offset = 240, .atomic_mass = 6972, .year_discovered = 1875, .electronegativity = 181, .group = THREE },
+    { .symbol = "Ge", .name_offset = 248, .atomic_mass = 7263, .year_discovered = 1886, .electronegativity = 201, .group = FOUR },
+    { .symbol = "As", .name_offset = 258, .atomic_mass = 7492, .year_discovered = 300, .electronegativity = 218, .group = FIVE },
+    { .symbol = "Se", .name_offset = 266, .atomic_mass = 7897, .year_discovered = 1817, .electronegativity = 255, .group = SIX },
+    { .symbol = "Br", .name_offset = 275, .atomic_mass = 7990, .year_discovered = 1825, .electronegativity = 296, .group = SEVEN },
+    { .symbol = "Kr", .name_offset = 283, .atomic_mass = 8380, .year_discovered = 1898, .electronegativity = 300, .group = ZERO },
+    { .symbol = "Rb", .name_offset = 291, .atomic_mass = 8547, .year_discovered = 1861, .electronegativity = 82, .group = ONE },
+    { .symbol = "Sr", .name_offset = 300, .atomic_mass = 8762, .year_discovered = 1787, .electronegativity = 95, .group = TWO },
+    { .symbol = "Y", .name_offset = 310, .atomic_mass = 8891, .year_discovered = 1794, .electronegativity = 122, .group = TRANSITION },
+    { .symbol = "Zr", .name_offset = 318, .atomic_mass = 9122, .year_discovered = 1789, .electronegativity = 133, .group = TRANSITION },
+    { .symbol = "Nb", .name_offset = 328, .atomic_mass = 9291, .year_discovered = 1801, .electronegativity = 160, .group = TRANSITION },
+    { .symbol = "Mo", .name_offset = 336, .atomic_mass = 9595, .year_discovered = 1778, .electronegativity = 216, .group = TRANSITION },
+    { .symbol = "Tc", .name_offset = 347, .atomic_mass = 9700, .year_discovered = 1937, .electronegativity = 190, .group = TRANSITION },
+    { .symbol = "Ru", .name_offset = 358, .atomic_mass = 10107, .year_discovered = 1844, .electronegativity = 220, .group = TRANSITION },
+    { .symbol = "Rh", .name_offset = 368, .atomic_mass = 10291, .year_discovered = 1804, .electronegativity = 228, .group = TRANSITION },
+    { .symbol = "Pd", .name_offset = 376, .atomic_mass = 10642, .year_discovered = 1802, .electronegativity = 220, .group = TRANSITION },
+    { .symbol = "Ag", .name_offset = 386, .atomic_mass = 10787, .year_discovered = -5000, .electronegativity = 193, .group = TRANSITION },
+    { .symbol = "Cd", .name_offset = 393, .atomic_mass = 11241, .year_discovered = 1817, .electronegativity = 169, .group = TRANSITION },
+    { .symbol = "In", .name_offset = 401, .atomic_mass = 11482, .year_discovered = 1863, .electronegativity = 178, .group = THREE },
+    { .symbol = "Sn", .name_offset = 408, .atomic_mass = 11871, .year_discovered = -3500, .electronegativity = 196, .group = FOUR },
+    { .symbol = "Sb", .name_offset = 412, .atomic_mass = 12176, .year_discovered = -3000, .electronegativity = 205, .group = FIVE },
+    { .symbol = "Te", .name_offset = 421, .atomic_mass = 12760, .year_discovered = 1782, .electronegativity = 210, .group = SIX },
+    { .symbol = "I", .name_offset = 431, .atomic_mass = 12690, .year_discovered = 1811, .electronegativity = 266, .group = SEVEN },
+    { .symbol = "Xe", .name_offset = 438, .atomic_mass = 13129, .year_discovered = 1898, .electronegativity = 260, .group = ZERO },
+    { .symbol = "Cs", .name_offset = 444, .atomic_mass = 13291, .year_discovered = 1860, .electronegativity = 79, .group = ONE },
+    { .symbol = "Ba", .name_offset = 452, .atomic_mass = 13733, .year_discovered = 1772, .electronegativity = 89, .group = TWO },
+    { .symbol = "La", .name_offset = 459, .atomic_mass = 13891, .year_discovered = 1838, .electronegativity = 110, .group = LANTHANIDE },
+    { .symbol = "Ce", .name_offset = 469, .atomic_mass = 14012, .year_discovered = 1803, .electronegativity = 112, .group = LANTHANIDE },
+    { .symbol = "Pr", .name_offset = 476, .atomic_mass = 14091, .year_discovered = 1885, .electronegativity = 113, .group = LANTHANIDE },
+    { .symbol = "Nd", .name_offset = 489, .atomic_mass = 14424, .year_discovered = 1841, .electronegativity = 114, .group = LANTHANIDE },
+    { .symbol = "Pm", .name_offset = 499, .atomic_mass = 14500, .year_discovered = 1945, .electronegativity = 113, .group = LANTHANIDE },
+    { .symbol = "Sm", .name_offset = 510, .atomic_mass = 15036, .year_discovered = 1879, .electronegativity = 117, .group = LANTHANIDE },
+    { .symbol = "Eu", .name_offset = 519, .atomic_mass = 15196, .year_discovered = 1896, .electronegativity = 120, .group = LANTHANIDE },
+    { .symbol = "Gd", .name_offset = 528, .atomic_mass = 15725, .year_discovered = 1880, .electronegativity = 120, .group = LANTHANIDE },
+    { .symbol = "Tb", .name_offset = 539, .atomic_mass = 15893, .year_discovered = 1843, .electronegativity = 120, .group = LANTHANIDE },
+    { .symbol = "Dy", .name_offset = 547, .atomic_mass = 16250, .year_discovered = 1886, .electronegativity = 122, .group = LANTHANIDE },
+    { .symbol = "Ho", .name_offset = 558, .atomic_mass = 16493, .year_discovered = 1878, .electronegativity = 123, .group = LANTHANIDE },
+    { .symbol = "Er", .name_offset = 566, .atomic_mass = 16726, .year_discovered = 1843, .electronegativity = 124, .group = LANTHANIDE },
+    { .symbol = "Tm", .name_offset = 573, .atomic_mass = 16893, .year_discovered = 1879, .electronegativity = 125, .group = LANTHANIDE },
+    { .symbol = "Yb", .name_offset = 581, .atomic_mass = 17305, .year_discovered = 1878, .electronegativity = 110, .group = LANTHANIDE },
+    { .symbol = "Lu", .name_offset = 591, .atomic_mass = 17497, .year_discovered = 1906, .electronegativity = 127, .group = LANTHANIDE },
+    { .symbol = "Hf", .name_offset = 600, .atomic_mass = 17849, .year_discovered = 1922, .electronegativity = 130, .group = TRANSITION },
+    { .symbol = "Ta", .name_offset = 608, .atomic_mass = 18095, .year_discovered = 1802, .electronegativity = 150, .group = TRANSITION },
+    { .symbol = "W", .name_offset = 617, .atomic_mass = 18384, .year_discovered = 1781, .electronegativity = 236, .group = TRANSITION },
+    { .symbol = "Re", .name_offset = 626, .atomic_mass = 18621, .year_discovered = 1908, .electronegativity = 190, .group = TRANSITION },
+    { .symbol = "Os", .name_offset = 634, .atomic_mass = 19023, .year_discovered = 1803, .electronegativity = 220, .group = TRANSITION },
+    { .symbol = "Ir", .name_offset = 641, .atomic_mass = 19222, .year_discovered = 1803, .electronegativity = 220, .group = TRANSITION },
+    { .symbol = "Pt", .name_offset = 649, .atomic_mass = 19508, .year_discovered = -600, .electronegativity = 228, .group = TRANSITION },
+    { .symbol = "Au", .name_offset = 658, .atomic_mass = 19697, .year_discovered = -6000, .electronegativity = 254, .group = TRANSITION },
+    { .symbol = "Hf", .name_offset = 663, .atomic_mass = 20059, .year_discovered = -1500, .electronegativity = 200, .group = TRANSITION },
+    { .symbol = "Tl", .name_offset = 671, .atomic_mass = 20438, .year_discovered = 1861, .electronegativity = 162, .group = THREE },
+    { .symbol = "Pb", .name_offset = 680, .atomic_mass = 20720, .year_discovered = -7000, .electronegativity = 187, .group = FOUR },
+    { .symbol = "Bi", .name_offset = 685, .atomic_mass = 20898, .year_discovered = 1500, .electronegativity = 202, .group = FIVE },
+    { .symbol = "Po", .name_offset = 693, .atomic_mass = 20900, .year_discovered = 1898, .electronegativity = 200, .group = SIX },
+    { .symbol = "At", .name_offset = 702, .atomic_mass = 21000, .year_discovered = 1940, .electronegativity = 220, .group = SEVEN },
+    { .symbol = "Rn", .name_offset = 711, .atomic_mass = 22200, .year_discovered = 1899, .electronegativity = 220, .group = ZERO },
+    { .symbol = "Fr", .name_offset = 717, .atomic_mass = 22300, .year_discovered = 1939, .electronegativity = 79, .group = ONE },
+    { .symbol = "Ra", .name_offset = 726, .atomic_mass = 22600, .year_discovered = 1898, .electronegativity = 90, .group = TWO },
+    { .symbol = "Ac", .name_offset = 733, .atomic_mass = 22700, .year_discovered = 1902, .electronegativity = 110, .group = ACTINIDE },
+    { .symbol = "Th", .name_offset = 742, .atomic_mass = 23204, .year_discovered = 1829, .electronegativity = 130, .group = ACTINIDE },
+    { .symbol = "Pa", .name_offset = 750, .atomic_mass = 23104, .year_discovered = 1913, .electronegativity = 150, .group = ACTINIDE },
+    { .symbol = "U", .name_offset = 763, .atomic_mass = 23803, .year_discovered = 1789, .electronegativity = 138, .group = ACTINIDE },
+    { .symbol = "Np", .name_offset = 771, .atomic_mass = 23700, .year_discovered = 1940, .electronegativity = 136, .group = ACTINIDE },
+    { .symbol = "Pu", .name_offset = 781, .atomic_mass = 24400, .year_discovered = 1941, .electronegativity = 128, .group = ACTINIDE },
+    { .symbol = "Am", .name_offset = 791, .atomic_mass = 24300, .year_discovered = 1944, .electronegativity = 113, .group = ACTINIDE },
+    { .symbol = "Cm", .name_offset = 801, .atomic_mass = 24700, .year_discovered = 1944, .electronegativity = 128, .group = ACTINIDE },
+    { .symbol = "Bk", .name_offset = 808, .atomic_mass = 24700, .year_discovered = 1949, .electronegativity = 130, .group = ACTINIDE },
+    { .symbol = "Cf", .name_offset = 818, .atomic_mass = 25100, .year_discovered = 1950, .electronegativity = 130, .group = ACTINIDE },
+    { .symbol = "Es", .name_offset = 830, .atomic_mass = 25200, .year_discovered = 1952, .electronegativity = 130, .group = ACTINIDE },
+    { .symbol = "Fm", .name_offset = 842, .atomic_mass = 25700, .year_discovered = 1953, .electronegativity = 130, .group = ACTINIDE },
+    { .symbol = "Md", .name_offset = 850, .atomic_mass = 25800, .year_discovered = 1955, .electronegativity = 130, .group = ACTINIDE },
+    { .symbol = "No", .name_offset = 862, .atomic_mass = 25900, .year_discovered = 1965, .electronegativity = 130, .group = ACTINIDE },
+    { .symbol = "Lr", .name_offset = 871, .atomic_mass = 26600, .year_discovered = 1961, .electronegativity = 130, .group = ACTINIDE },
+    { .symbol = "Rf", .name_offset = 882, .atomic_mass = 26700, .year_discovered = 1969, .electronegativity = 0, .group = TRANSITION },
+    { .symbol = "Db", .name_offset = 896, .atomic_mass = 26800, .year_discovered = 1970, .electronegativity = 0, .group = TRANSITION },
+    { .symbol = "Sg", .name_offset = 904, .atomic_mass = 26700, .year_discovered = 1974, .electronegativity = 0, .group = TRANSITION },
+    { .symbol = "Bh", .name_offset = 915, .atomic_mass = 27000, .year_discovered = 1981, .electronegativity = 0, .group = TRANSITION },
+    { .symbol = "Hs", .name_offset = 923, .atomic_mass = 27100, .year_discovered = 1984, .electronegativity = 0, .group = TRANSITION },
+    { .symbol = "Mt", .name_offset = 931, .atomic_mass = 27800, .year_discovered = 1982, .electronegativity = 0, .group = TRANSITION },
+    { .symbol = "Ds", .name_offset = 942, .atomic_mass = 28100, .year_discovered = 1994, .electronegativity = 0, .group = TRANSITION },
+    { .symbol = "Rg", .name_offset = 955, .atomic_mass = 28200, .year_discovered = 1994, .electronegativity = 0, .group = TRANSITION },
+    { .symbol = "Cn", .name_offset = 967, .atomic_mass = 28500, .year_discovered = 1996, .electronegativity = 0, .group = TRANSITION },
+    { .symbol = "Nh", .name_offset = 979, .atomic_mass = 28600, .year_discovered = 2004, .electronegativity = 0, .group = THREE },
+    { .symbol = "Fl", .name_offset = 988, .atomic_mass = 28900, .year_discovered = 1999, .electronegativity = 0, .group = FOUR },
+    { .symbol = "Mc", .name_offset = 998, .atomic_mass = 29000, .year_discovered = 2003, .electronegativity = 0, .group = FIVE },
+    { .symbol = "Lw", .name_offset = 1008, .atomic_mass = 29300, .year_discovered = 2000, .electronegativity = 0, .group = SIX },
+    { .symbol = "Ts", .name_offset = 1020, .atomic_mass = 29400, .year_discovered = 2009, .electronegativity = 0, .group = SEVEN },
+    { .symbol = "Og", .name_offset = 1031, .atomic_mass = 29400, .year_discovered = 2002, .electronegativity = 0, .group = ZERO },
 };
 
+static const char *_element_symbol(uint8_t atomic_num) {
+    static char buf[3];
+    buf[0] = table[atomic_num - 1].symbol[0];
+    buf[1] = table[atomic_num - 1].symbol[1];
+    buf[2] = '\0';
+    return buf;
+}
+
+static const char *_element_name(uint8_t atomic_num) {
+    return &name_pool[table[atomic_num - 1].name_offset];
+}
+
 static void _make_upper(char *string) {
     size_t i = 0;
     while(string[i] != 0) {
@@ -271,11 +304,11 @@ static void _display_element(periodic_table_state_t *state)
     watch_display_text(WATCH_POSITION_TOP_RIGHT, _get_group_name(table[atomic_num - 1].group));
 
     if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) { // Display symbol at top
-        watch_display_text(WATCH_POSITION_TOP_LEFT, table[atomic_num - 1].symbol);
+        watch_display_text(WATCH_POSITION_TOP_LEFT, _element_symbol(atomic_num));
         sprintf(buf, "%3d", atomic_num);
         watch_display_text(WATCH_POSITION_BOTTOM, buf);
     } else {
-        strcpy(ele, table[atomic_num - 1].symbol);
+        strcpy(ele, _element_symbol(atomic_num));
         _make_upper(ele);
         sprintf(buf, "%3d %-2s", atomic_num, ele);
         watch_display_text(WATCH_POSITION_BOTTOM, buf);
@@ -289,7 +322,7 @@ static void _display_atomic_mass(periodic_table_state_t *state)
     uint16_t integer = mass / 100;
     uint16_t decimal = mass % 100;
 
-    watch_display_text(WATCH_POSITION_TOP_LEFT, table[state->atomic_num - 1].symbol);
+    watch_display_text(WATCH_POSITION_TOP_LEFT, _element_symbol(state->atomic_num));
     watch_display_text(WATCH_POSITION_TOP_RIGHT, _get_screen_name(state->mode));
 
     if (decimal == 0) {
@@ -322,32 +355,27 @@ static void _display_year_discovered(periodic_table_state_t *state)
         year_buf[5] = 'c';
     }
 
-    watch_display_text(WATCH_POSITION_TOP_LEFT, table[state->atomic_num - 1].symbol);
+    watch_display_text(WATCH_POSITION_TOP_LEFT, _element_symbol(state->atomic_num));
     watch_display_text(WATCH_POSITION_TOP_RIGHT, _get_screen_name(state->mode));
     watch_display_text(WATCH_POSITION_BOTTOM, year_buf); 
 }
 
 static void _display_name(periodic_table_state_t *state)
 {
-    watch_display_text(WATCH_POSITION_TOP_LEFT, table[state->atomic_num - 1].symbol);
+    watch_display_text(WATCH_POSITION_TOP_LEFT, _element_symbol(state->atomic_num));
     watch_display_text(WATCH_POSITION_TOP_RIGHT, _get_screen_name(state->mode));
 
-    const char* elm_name = table[state->atomic_num - 1].name;
+    const char* elm_name = _element_name(state->atomic_num);
 
     // Better display for 'I' on new LCD
     if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM && elm_name[0] == 'I' && strlen(elm_name) <= 7){
+        watch_display_scroll_stop();
         watch_display_text(WATCH_POSITION_BOTTOM, elm_name+1); 
         watch_set_pixel(0, 22);
         return;
     }
 
-
-    _text_looping = elm_name;
-    _text_pos = 0;
-
-    char buf[7];
-    sprintf(buf, "%.6s", elm_name);
-    watch_display_text(WATCH_POSITION_BOTTOM, buf); 
+    watch_display_scroll_start(WATCH_POSITION_BOTTOM, elm_name, 0);
 }
 
 static void _display_electronegativity(periodic_table_state_t *state)
@@ -357,7 +385,7 @@ static void _display_electronegativity(periodic_table_state_t *state)
     uint16_t integer = electronegativity / 100;
     uint16_t decimal = electronegativity % 100;
 
-    watch_display_text(WATCH_POSITION_TOP_LEFT, table[state->atomic_num - 1].symbol);
+    watch_display_text(WATCH_POSITION_TOP_LEFT, _element_symbol(state->atomic_num));
     watch_display_text(WATCH_POSITION_TOP_RIGHT, _get_screen_name(state->mode));
 
     if (decimal == 0){
@@ -384,40 +412,17 @@ static void stop_quick_cyc(void){
     movement_request_tick_frequency(FREQ);
 }
 
-static int16_t _loop_text(const char* text, int8_t curr_loc, bool shift){
-    // if curr_loc, then use that many ticks as a delay before looping
-    char buf[15];
-    uint8_t text_len = strlen(text);
-    if (curr_loc == -1) curr_loc = 0;  // To avoid double-showing the 0
-    if (text_len <= 6 || curr_loc < 0) {
-        if (shift)
-            sprintf(buf, " %.5s", text);
-        else
-            sprintf(buf, "%.6s", text);
-        watch_display_text(WATCH_POSITION_BOTTOM, buf);
-        if (curr_loc < 0) return ++curr_loc;
-        return 0;
-    }
-    else if (curr_loc == (text_len + 1))
-        curr_loc = 0;
-
-    if (shift) // Extra space on title screen on F-91W screen
-        sprintf(buf, " %.6s %.6s", text + curr_loc, text);  // Take wrapping substring
-    else 
-        sprintf(buf, "%.6s %.6s", text + curr_loc, text);  // Take wrapping substring
-
-    buf[6] = '\0'; // Prevent overflow
-    watch_display_text(WATCH_POSITION_BOTTOM, buf);
-    return curr_loc + 1; // Next position
-}
-
 static void _display_title(periodic_table_state_t *state){
     state->atomic_num = 0;
     watch_clear_colon();
     watch_clear_all_indicators();
-    _text_looping = title_text;
-    _text_pos = FREQ * -1;
-    _text_pos = _loop_text(_text_looping, _text_pos, watch_get_lcd_type() != WATCH_LCD_TYPE_CUSTOM);
+    if (watch_get_lcd_type() != WATCH_LCD_TYPE_CUSTOM) {
+        // position 4 is hard to read on the F-91W LCD; leave it blank and scroll through 5-9.
+        watch_display_character(' ', 4);
+        watch_display_scroll_start_at(5, 5, title_text, FREQ);
+    } else {
+        watch_display_scroll_start(WATCH_POSITION_BOTTOM, title_text, FREQ);
+    }
 }
 
 static void _display_screen(periodic_table_state_t *state, bool should_sound){
@@ -499,10 +504,7 @@ bool periodic_table_face_loop(movement_event_t event, void *context)
         _display_screen(state, false);
         break;
     case EVENT_TICK:
-        if (state->mode == SCREEN_TITLE) _text_pos = _loop_text(_text_looping, _text_pos, watch_get_lcd_type() != WATCH_LCD_TYPE_CUSTOM);
-        else if (state->mode == SCREEN_FULL_NAME && 
-            !(watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM && table[state->atomic_num - 1].name[0] == 'I' && strlen(table[state->atomic_num - 1].name) <= 7)) 
-                _text_pos = _loop_text(_text_looping, _text_pos, false);
+        if (state->mode == SCREEN_TITLE || state->mode == SCREEN_FULL_NAME) watch_display_scroll_frame();
         if (_quick_ticks_running) {
             if (HAL_GPIO_BTN_LIGHT_read()) _handle_backward(state, false);
             else if (HAL_GPIO_BTN_ALARM_read()) _handle_forward(state, false);
@@ -596,5 +598,5 @@ void periodic_table_face_resign(void *context)
 {
     (void)context;
 
-    // handle any cleanup before your watch face goes off-screen.
+    watch_display_scroll_stop();
 }
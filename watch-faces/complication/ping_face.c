@@ -87,14 +87,14 @@ static game_state_t game_state;
 static int8_t _ticks_show_title = 0;
 static bool _is_custom_lcd;
 
-static int8_t start_tune[] = {
+static const int8_t start_tune[] = {
     BUZZER_NOTE_C5, 15,
     BUZZER_NOTE_E5, 15,
     BUZZER_NOTE_G5, 15,
     0
 };
 
-static int8_t lose_tune[] = {
+static const int8_t lose_tune[] = {
     BUZZER_NOTE_D3, 10,
     BUZZER_NOTE_C3SHARP_D3FLAT, 10,
     BUZZER_NOTE_C3, 10,
@@ -474,7 +474,7 @@ static void update_game(ping_state_t *state) {
 void ping_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(ping_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(ping_state_t));
         memset(*context_ptr, 0, sizeof(ping_state_t));
         ping_state_t *state = (ping_state_t *)*context_ptr;
         state->difficulty = DIFF_NORM;
@@ -0,0 +1,155 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include <stdio.h>
+#include "planetary_face.h"
+#include "watch_utility.h"
+#include "vsop87_fixed.h"
+
+#define NUM_BODIES (8)
+
+// display order: sun first, then outward from the sun (skipping Earth)
+static const vsop87_fixed_body_t _bodies[NUM_BODIES] = {
+    VSOP87_FIXED_SUN,
+    VSOP87_FIXED_MERCURY,
+    VSOP87_FIXED_VENUS,
+    VSOP87_FIXED_MARS,
+    VSOP87_FIXED_JUPITER,
+    VSOP87_FIXED_SATURN,
+    VSOP87_FIXED_URANUS,
+    VSOP87_FIXED_NEPTUNE,
+};
+
+static const char _body_names[NUM_BODIES][4] = {
+    "SUN", "MER", "VEN", "MAR", "JUP", "SAT", "URA", "NEP"
+};
+static const char _body_names_classic[NUM_BODIES][3] = {
+    "SU", "ME", "VE", "MA", "JU", "SA", "UR", "NE"
+};
+
+// zodiac signs, 30 degrees each from the March equinox
+static const char _sign_names[12][4] = {
+    "ARI", "TAU", "GEM", "CAN", "LEO", "VIR",
+    "LIB", "SCO", "SAG", "CAP", "AQU", "PIS"
+};
+
+void planetary_face_setup(uint8_t watch_face_index, void ** context_ptr) {
+    (void) watch_face_index;
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(planetary_state_t));
+        memset(*context_ptr, 0, sizeof(planetary_state_t));
+    }
+}
+
+void planetary_face_activate(void *context) {
+    (void) context;
+    // positions move at most a few degrees a day; no need for a second tick.
+    movement_request_tick_frequency(0);
+}
+
+// Ensure the cache holds today's position for the selected body, computing it
+// on a miss. One VSOP87 evaluation costs two planets' worth of series (the
+// body and Earth), so on a typical day each body is computed at most once.
+static void _ensure_cached(planetary_state_t *state) {
+    uint32_t now = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), movement_get_current_timezone_offset());
+    int32_t days = vsop87_fixed_days_since_j2000(now);
+
+    if (days != state->cache_days) {
+        state->cache_days = days;
+        state->cache_valid = 0;
+    }
+    if (state->cache_valid & (1 << state->body_idx)) return;
+
+    vsop87_fixed_geocentric(_bodies[state->body_idx], days,
+                            &state->lon_centideg[state->body_idx], NULL,
+                            &state->dist_milli_au[state->body_idx]);
+    state->cache_valid |= (1 << state->body_idx);
+}
+
+static void _update(planetary_state_t *state) {
+    char buf[8];
+    _ensure_cached(state);
+
+    watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT,
+                                     _body_names[state->body_idx],
+                                     _body_names_classic[state->body_idx]);
+    watch_display_text(WATCH_POSITION_TOP_RIGHT, "  ");
+
+    if (state->show_distance) {
+        // distance from Earth in AU, hundredths: " 1.52", "30.11"
+        uint32_t centi_au = (state->dist_milli_au[state->body_idx] + 5) / 10;
+        sprintf(buf, "%2lu.%02lu ", (unsigned long)(centi_au / 100), (unsigned long)(centi_au % 100));
+        watch_display_text(WATCH_POSITION_BOTTOM, buf);
+    } else {
+        int32_t lon = state->lon_centideg[state->body_idx];
+        uint8_t sign = (uint8_t)(lon / 3000);
+        uint8_t degrees = (uint8_t)((lon % 3000) / 100);
+        sprintf(buf, "%s%3u", _sign_names[sign], degrees);
+        watch_display_text(WATCH_POSITION_BOTTOM, buf);
+    }
+}
+
+bool planetary_face_loop(movement_event_t event, void *context) {
+    planetary_state_t *state = (planetary_state_t *)context;
+
+    switch (event.event_type) {
+        case EVENT_ACTIVATE:
+            if (watch_sleep_animation_is_running()) watch_stop_sleep_animation();
+            _update(state);
+            break;
+        case EVENT_TICK:
+            break;
+        case EVENT_LOW_ENERGY_UPDATE:
+            // once a minute is plenty; the display only changes at the date rollover.
+            _update(state);
+            if (!watch_sleep_animation_is_running()) watch_start_sleep_animation(1000);
+            break;
+        case EVENT_ALARM_BUTTON_UP:
+            state->body_idx = (state->body_idx + 1) % NUM_BODIES;
+            _update(state);
+            break;
+        case EVENT_ALARM_LONG_PRESS:
+            state->show_distance = !state->show_distance;
+            _update(state);
+            break;
+        case EVENT_LIGHT_LONG_PRESS:
+            movement_illuminate_led();
+            break;
+        case EVENT_TIMEOUT:
+            // snap back to the sun so the face always wakes up somewhere familiar
+            state->body_idx = 0;
+            state->show_distance = false;
+            movement_move_to_face(0);
+            break;
+        default:
+            return movement_default_loop_handler(event);
+    }
+
+    return true;
+}
+
+void planetary_face_resign(void *context) {
+    (void) context;
+}
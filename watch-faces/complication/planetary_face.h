@@ -0,0 +1,72 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PLANETARY_FACE_H_
+#define PLANETARY_FACE_H_
+
+/*
+ * PLANETARY POSITION face
+ *
+ * Displays where the sun and the planets are along the zodiac: the body's
+ * code at the top left, and its geocentric ecliptic longitude at the bottom
+ * as a zodiac sign and degrees within the sign (tropical, measured from the
+ * March equinox).
+ *
+ * Press the Alarm button to step through the bodies: sun, Mercury, Venus,
+ * Mars, Jupiter, Saturn, Uranus, Neptune. Hold the Alarm button to toggle
+ * between the zodiac position and the body's distance from Earth in
+ * astronomical units. Hold the Light button to illuminate the display.
+ *
+ * Positions come from a fixed-point VSOP87 port (see lib/vsop87) and are
+ * computed for local noon of the current day, then cached: revisiting the
+ * face or cycling back to a body costs a table lookup until the date rolls
+ * over. Accuracy is about an arcminute, far finer than the whole degrees
+ * shown.
+ */
+
+#include "movement.h"
+
+typedef struct {
+    int32_t cache_days;         // days since J2000 the cache was computed for
+    int32_t lon_centideg[8];
+    uint32_t dist_milli_au[8];
+    uint8_t cache_valid;        // bit per body
+    uint8_t body_idx;
+    bool show_distance;
+} planetary_state_t;
+
+void planetary_face_setup(uint8_t watch_face_index, void ** context_ptr);
+void planetary_face_activate(void *context);
+bool planetary_face_loop(movement_event_t event, void *context);
+void planetary_face_resign(void *context);
+
+#define planetary_face ((const watch_face_t){ \
+    planetary_face_setup, \
+    planetary_face_activate, \
+    planetary_face_loop, \
+    planetary_face_resign, \
+    NULL, \
+})
+
+#endif // PLANETARY_FACE_H_
@@ -22,15 +22,11 @@
  * SOFTWARE.
  */
 
-// Emulator only: need time() to seed the random number generator.
-#if __EMSCRIPTEN__
-#include <time.h>
-#endif
-
 #include <stdlib.h>
 #include <string.h>
 #include "probability_face.h"
 #include "watch_common_display.h"
+#include "watch_utility.h"
 
 #define DEFAULT_DICE_SIDES 2
 #define PROBABILITY_ANIMATION_TICK_FREQUENCY 8
@@ -108,8 +104,7 @@ static void display_dice_roll(probability_state_t *state)
         // Show "00" for d100
         watch_display_text_with_fallback(WATCH_POSITION_TOP_RIGHT, "00", " C");
     } else {
-        sprintf(buf, "%2d", state->dice_sides);
-        watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
+        watch_display_u8(WATCH_POSITION_TOP_RIGHT, state->dice_sides, false);
     }
 
     // Display rolled value
@@ -140,12 +135,7 @@ static void display_dice_roll(probability_state_t *state)
 
 static void generate_random_number(probability_state_t *state)
 {
-// Emulator: use rand. Hardware: use arc4random.
-#if __EMSCRIPTEN__
-    state->rolled_value = rand() % state->dice_sides + 1;
-#else
-    state->rolled_value = arc4random_uniform(state->dice_sides) + 1;
-#endif
+    state->rolled_value = watch_utility_random_uniform(state->dice_sides) + 1;
 }
 
 static void roll_dice(probability_state_t *state)
@@ -214,13 +204,9 @@ void probability_face_setup(uint8_t watch_face_index, void **context_ptr)
     (void)watch_face_index;
     if (*context_ptr == NULL)
     {
-        *context_ptr = malloc(sizeof(probability_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(probability_state_t));
         memset(*context_ptr, 0, sizeof(probability_state_t));
     }
-// Emulator only: Seed random number generator
-#if __EMSCRIPTEN__
-    srand(time(NULL));
-#endif
 }
 
 void probability_face_activate(void *context)
@@ -41,9 +41,11 @@
 #define PULSOMETER_FACE_CALIBRATION_INCREMENT (10)
 #endif
 
-// tick frequency will be 2 to this power Hz (0 for 1 Hz, 2 for 4 Hz, etc.)
+// Refresh rate of the live readout while the button is held, 2 to this power Hz.
+// This only paces the display: the measurement itself is captured as RTC counter
+// timestamps at the button edges, so lowering it costs no resolution.
 #ifndef PULSOMETER_FACE_FREQUENCY_FACTOR
-#define PULSOMETER_FACE_FREQUENCY_FACTOR (4ul)
+#define PULSOMETER_FACE_FREQUENCY_FACTOR (2ul)
 #endif
 
 #define PULSOMETER_FACE_FREQUENCY (1 << PULSOMETER_FACE_FREQUENCY_FACTOR)
@@ -51,7 +53,7 @@
 typedef struct {
     bool measuring;
     int16_t pulses;
-    int16_t ticks;
+    rtc_counter_t start_counter;
     int8_t calibration;
 } pulsometer_state_t;
 
@@ -103,7 +105,8 @@ static void pulsometer_indicate(pulsometer_state_t *pulsometer) {
 static void pulsometer_start_measurement(pulsometer_state_t *pulsometer) {
     pulsometer->measuring = true;
     pulsometer->pulses = INT16_MAX;
-    pulsometer->ticks = 0;
+    // one counter read marks the start; the free-running RTC counter does the timing
+    pulsometer->start_counter = watch_rtc_get_counter();
 
     pulsometer_indicate(pulsometer);
 
@@ -113,19 +116,24 @@ static void pulsometer_start_measurement(pulsometer_state_t *pulsometer) {
 static void pulsometer_measure(pulsometer_state_t *pulsometer) {
     if (!pulsometer->measuring) { return; }
 
-    pulsometer->ticks++;
+    uint32_t elapsed = (rtc_counter_t)(watch_rtc_get_counter() - pulsometer->start_counter);
+    if (elapsed == 0) { return; }
 
-    float ticks_per_minute = 60 << PULSOMETER_FACE_FREQUENCY_FACTOR;
-    float pulses_while_button_held = ticks_per_minute / pulsometer->ticks;
-    float calibrated_pulses = pulses_while_button_held * pulsometer->calibration;
-    calibrated_pulses += 0.5f;
+    // pulses per minute at counter resolution, rounded to nearest: the elapsed
+    // interval is measured in 1/128 s regardless of how often we repaint.
+    uint32_t freq = watch_rtc_get_frequency();
+    uint32_t pulses = ((uint32_t)pulsometer->calibration * 60 * freq + elapsed / 2) / elapsed;
 
-    pulsometer->pulses = (int16_t) calibrated_pulses;
+    pulsometer->pulses = pulses > INT16_MAX ? INT16_MAX : (int16_t)pulses;
 
     pulsometer_display_measurement(pulsometer);
 }
 
 static void pulsometer_stop_measurement(pulsometer_state_t *pulsometer) {
+    // the second counter read: the final reading comes from the button edges,
+    // not from however many display refreshes happened in between
+    pulsometer_measure(pulsometer);
+
     movement_request_tick_frequency(1);
 
     pulsometer->measuring = false;
@@ -155,11 +163,11 @@ void pulsometer_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        pulsometer_state_t *pulsometer = malloc(sizeof(pulsometer_state_t));
+        pulsometer_state_t *pulsometer = movement_face_context_alloc(sizeof(pulsometer_state_t));
 
         pulsometer->calibration = PULSOMETER_FACE_CALIBRATION_DEFAULT;
         pulsometer->pulses = 0;
-        pulsometer->ticks = 0;
+        pulsometer->start_counter = 0;
 
         *context_ptr = pulsometer;
     }
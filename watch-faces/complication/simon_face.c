@@ -23,28 +23,31 @@
  */
 
 #include "simon_face.h"
-#include "delay.h"
+#include "watch_utility.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-// Emulator only: need time() to seed the random number generator
-#if __EMSCRIPTEN__
-#include <time.h>
-#endif
-
 static char _simon_display_buf[12];
 static uint8_t _timer;
 static uint16_t _delay_beep;
 static uint16_t _timeout;
-static uint8_t _secSub;
+
+// The pattern is paced by the buzzer sequencer, which runs from a timer that
+// stays on in standby: each note (or silent rest, when sound is off) is a tiny
+// sequence, and _simon_note_done is called back at the note boundary to advance
+// the game. The CPU sleeps between notes instead of burning delay_ms loops.
+static simon_state_t *_simon_note_state;
+static int8_t _simon_note_seq[5];
+static uint8_t _tone_ticks;         // note length in 64 Hz sequencer ticks
+static uint8_t _teach_period_ticks; // note-to-note spacing while teaching
+static bool _wrong_pending;         // the buzz now playing is the game-over one
+static bool _round_pause_pending;   // the rest between a completed round and the next
+
+static void _simon_note_done(void);
 
 static inline uint8_t _simon_get_rand_num(uint8_t num_values) {
-#if __EMSCRIPTEN__
-    return rand() % num_values;
-#else
-    return arc4random_uniform(num_values);
-#endif
+    return watch_utility_random_uniform(num_values);
 }
 
 static void _simon_clear_display(simon_state_t *state) {
@@ -83,6 +86,10 @@ static void _simon_not_playing_display(simon_state_t *state) {
 }
 
 static void _simon_reset(simon_state_t *state) {
+    watch_buzzer_abort_sequence();
+    watch_set_led_off();
+    _wrong_pending = false;
+    _round_pause_pending = false;
     state->playing_state = SIMON_NOT_PLAYING;
     state->listen_index = 0;
     state->sequence_length = 0;
@@ -114,43 +121,55 @@ static void _simon_display_note(SimonNote note, simon_state_t *state) {
     }
 }
 
-static void _simon_play_note(SimonNote note, simon_state_t *state, bool skip_rest) {
+// Display a note and start it on the sequencer; returns immediately, and the
+// sequencer calls _simon_note_done when the note (plus teaching rest) is over.
+static void _simon_start_note(SimonNote note, simon_state_t *state, bool with_rest) {
+    uint8_t tone_ticks = (note == SIMON_WRONG_NOTE) ? 51 : _tone_ticks; // 51 ticks = the old 800 ms buzz
+    int8_t tone;
+
     _simon_display_note(note, state);
     switch (note) {
         case SIMON_LED_NOTE:
             if (!state->lightOff) watch_set_led_yellow();
-            if (!state->soundOff) watch_buzzer_play_note(BUZZER_NOTE_D3, _delay_beep);
-            delay_ms(_delay_beep);
+            tone = BUZZER_NOTE_D3;
             break;
         case SIMON_MODE_NOTE:
             if (!state->lightOff) watch_set_led_red();
-            if (!state->soundOff) watch_buzzer_play_note(BUZZER_NOTE_E4, _delay_beep);
-            delay_ms(_delay_beep);
+            tone = BUZZER_NOTE_E4;
             break;
         case SIMON_ALARM_NOTE:
             if (!state->lightOff) watch_set_led_green();
-            if (!state->soundOff) watch_buzzer_play_note(BUZZER_NOTE_C3, _delay_beep);
-            delay_ms(_delay_beep);
+            tone = BUZZER_NOTE_C3;
             break;
-        case SIMON_WRONG_NOTE:
-            if (!state->soundOff) watch_buzzer_play_note(BUZZER_NOTE_A1, 800);
-            delay_ms(800);
+        default:
+            // A1 is the sequencer's end-of-sequence marker and can't be played;
+            // use the next note up for the game-over buzz.
+            tone = BUZZER_NOTE_A1SHARP_B1FLAT;
             break;
     }
-    watch_set_led_off();
+    // With sound off the sequence is all rests: it makes no noise but still
+    // paces the pattern, with the CPU asleep until the boundary callback.
+    if (state->soundOff) tone = BUZZER_NOTE_REST;
 
-    if (note != SIMON_WRONG_NOTE) {
-        _simon_clear_display(state);
-        if (!skip_rest) {
-            delay_ms((_delay_beep * 2)/3);
-        }
+    _simon_note_seq[0] = tone;
+    _simon_note_seq[1] = tone_ticks;
+    if (with_rest && _teach_period_ticks > tone_ticks) {
+        _simon_note_seq[2] = BUZZER_NOTE_REST;
+        _simon_note_seq[3] = _teach_period_ticks - tone_ticks;
+        _simon_note_seq[4] = 0;
+    } else {
+        _simon_note_seq[2] = 0;
     }
+    _simon_note_state = state;
+    watch_buzzer_play_sequence(_simon_note_seq, _simon_note_done);
 }
 
 
 static void _simon_setup_next_note(simon_state_t *state) {
     if (state->sequence_length > state->best_score) {
         state->best_score = state->sequence_length;
+        // backup register now, filesystem archive in an idle window
+        game_score_set(&state->score_store, state->best_score);
     }
 
     _simon_clear_display(state);
@@ -163,16 +182,16 @@ static void _simon_setup_next_note(simon_state_t *state) {
 
 static void _simon_listen(SimonNote note, simon_state_t *state) {
     if (state->sequence[state->listen_index] == note) {
-        _simon_play_note(note, state, true);
         state->listen_index++;
         _timer = 0;
 
         if (state->listen_index == state->sequence_length) {
             state->playing_state = SIMON_READY_FOR_NEXT_NOTE;
         }
+        _simon_start_note(note, state, false);
     } else {
-        _simon_play_note(SIMON_WRONG_NOTE, state, true);
-        _simon_reset(state);
+        _wrong_pending = true;
+        _simon_start_note(SIMON_WRONG_NOTE, state, false);
     }
 }
 
@@ -181,45 +200,93 @@ static void _simon_begin_listening(simon_state_t *state) {
     state->listen_index = 0;
 }
 
+static void _simon_teach_note(simon_state_t *state) {
+    // skip the rest after the final note to let the player jump in faster
+    bool with_rest = state->teaching_index < state->sequence_length - 1;
+    _simon_start_note(state->sequence[state->teaching_index], state, with_rest);
+}
+
+// Sequencer end-of-note callback: the pattern boundary where the game advances.
+static void _simon_note_done(void) {
+    simon_state_t *state = _simon_note_state;
+    watch_set_led_off();
+
+    if (_wrong_pending) {
+        _wrong_pending = false;
+        _simon_reset(state);
+        return;
+    }
+
+    switch (state->playing_state) {
+        case SIMON_TEACHING:
+            _simon_clear_display(state);
+            state->teaching_index++;
+            if (state->teaching_index == state->sequence_length) _simon_begin_listening(state);
+            else _simon_teach_note(state);
+            break;
+        case SIMON_LISTENING_BACK:
+            // echo of a correct button press finished
+            _simon_clear_display(state);
+            break;
+        case SIMON_READY_FOR_NEXT_NOTE:
+            if (!_round_pause_pending) {
+                // round complete: rest one teaching period before the longer sequence
+                _round_pause_pending = true;
+                _simon_clear_display(state);
+                _simon_note_seq[0] = BUZZER_NOTE_REST;
+                _simon_note_seq[1] = _teach_period_ticks;
+                _simon_note_seq[2] = 0;
+                watch_buzzer_play_sequence(_simon_note_seq, _simon_note_done);
+            } else {
+                _round_pause_pending = false;
+                _timer = 0;
+                _simon_setup_next_note(state);
+                _simon_teach_note(state);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
 static void _simon_change_speed(simon_state_t *state){
       switch (state->mode)
   {
   case SIMON_MODE_HARD:
         _delay_beep = DELAY_FOR_TONE_MS / 2;
-        _secSub = SIMON_FACE_FREQUENCY / 2;
-        _timeout = (TIMER_MAX * SIMON_FACE_FREQUENCY) / 2;
+        _teach_period_ticks = 32; // half a second per taught note
+        _timeout = (TIMER_MAX + 1) / 2;
     break;
   default:
         _delay_beep = DELAY_FOR_TONE_MS;
-        _secSub = SIMON_FACE_FREQUENCY;
-        _timeout = TIMER_MAX * SIMON_FACE_FREQUENCY;
+        _teach_period_ticks = 64; // one second per taught note
+        _timeout = TIMER_MAX;
     break;
   }
+  _tone_ticks = (_delay_beep * 64) / 1000;
 }
 
 void simon_face_setup(uint8_t watch_face_index,
         void **context_ptr) {
     (void)watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(simon_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(simon_state_t));
         memset(*context_ptr, 0, sizeof(simon_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens
         // only at boot.
+        simon_state_t *state = (simon_state_t *)*context_ptr;
+        state->best_score = game_score_init(&state->score_store, MOVEMENT_BACKUP_TAG('S', 'I', 'M', 0), "simon.hs");
     }
     // Do any pin or peripheral setup here; this will be called whenever the watch
     // wakes from deep sleep.
-#if __EMSCRIPTEN__
-    // simulator only: seed the randon number generator
-    time_t t;
-    srand((unsigned)time(&t));
-#endif
 }
 
 void simon_face_activate(void *context) {
-  (void) context;
   simon_state_t *state = (simon_state_t *)context;
   _simon_change_speed(state);
-  movement_request_tick_frequency(SIMON_FACE_FREQUENCY);
+  _simon_note_state = state;
+  _wrong_pending = false;
+  _round_pause_pending = false;
    _timer = 0;
 }
 
@@ -233,30 +300,17 @@ bool simon_face_loop(movement_event_t event,
             _simon_reset(state);
             break;
         case EVENT_TICK:
+            // Teaching and round transitions are paced by the sequencer callback;
+            // the 1 Hz tick only times out an unresponsive player.
             if (state->playing_state == SIMON_LISTENING_BACK && state->mode != SIMON_MODE_EASY)
             {
                 _timer++;
                 if(_timer >= (_timeout)){
                     _timer = 0;
-                    _simon_play_note(SIMON_WRONG_NOTE, state, true);
-                    _simon_reset(state);
+                    _wrong_pending = true;
+                    _simon_start_note(SIMON_WRONG_NOTE, state, false);
                 }
             }
-            else if (state->playing_state == SIMON_TEACHING && event.subsecond  == 0) {
-                SimonNote note = state->sequence[state->teaching_index];
-                // if this is the final note in the sequence, don't play the rest to let
-                // the player jump in faster
-                _simon_play_note(note, state, state->teaching_index == (state->sequence_length - 1));
-                state->teaching_index++;
-
-                if (state->teaching_index == state->sequence_length) {
-                    _simon_begin_listening(state);
-                }
-            }
-            else if (state->playing_state == SIMON_READY_FOR_NEXT_NOTE && (event.subsecond % _secSub)  == 0) {
-                _timer = 0;
-                _simon_setup_next_note(state);
-            }
             break;
         case EVENT_LIGHT_BUTTON_DOWN:
             break;
@@ -280,6 +334,7 @@ bool simon_face_loop(movement_event_t event,
                 watch_clear_indicator(WATCH_INDICATOR_BELL);
                 watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
                 _simon_setup_next_note(state);
+                _simon_teach_note(state);
             } else if (state->playing_state == SIMON_LISTENING_BACK) {
                 _simon_listen(SIMON_LED_NOTE, state);
             }
@@ -323,6 +378,7 @@ bool simon_face_loop(movement_event_t event,
 
 void simon_face_resign(void *context) {
     (void)context;
+    watch_buzzer_abort_sequence();
     watch_set_led_off();
     watch_set_buzzer_off();
 }
@@ -26,6 +26,7 @@
 #define SIMON_FACE_H_
 
 #include "movement.h"
+#include "game_score.h"
 
 /*
  * simon_face
@@ -80,6 +81,7 @@ typedef enum SimonMode {
 
 typedef struct {
     uint8_t best_score;
+    game_score_t score_store;
     SimonNote sequence[MAX_SEQUENCE];
     uint8_t sequence_length;
     uint8_t teaching_index;
@@ -105,7 +107,6 @@ void simon_face_resign(void *context);
      })
 
 #define TIMER_MAX 5
-#define SIMON_FACE_FREQUENCY 8
 #define DELAY_FOR_TONE_MS 300
 
 #endif // SIMON_FACE_H_
@@ -27,11 +27,12 @@
 #include <string.h>
 #include "simple_coin_flip_face.h"
 #include "delay.h"
+#include "watch_utility.h"
 
 void simple_coin_flip_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(simple_coin_flip_face_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(simple_coin_flip_face_state_t));
         memset(*context_ptr, 0, sizeof(simple_coin_flip_face_state_t));
     }
 }
@@ -41,12 +42,7 @@ void simple_coin_flip_face_activate(void *context) {
 }
 
 static uint32_t get_random(uint32_t max) {
-    #if __EMSCRIPTEN__
-        return rand() % max;
-    #else
-        return arc4random_uniform(max);
-    #endif
-
+    return watch_utility_random_uniform(max);
 }
 
 static void draw_start_face(void) {
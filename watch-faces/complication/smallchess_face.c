@@ -0,0 +1,598 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Jeremy O'Brien
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <setjmp.h>
+#include <stdio.h>
+#include <string.h>
+
+/* engine configuration: a 4 KB transposition table (512 entries) fits
+   comfortably next to the face context arena, and the incremental evaluation
+   replaces smallchesslib's move-generating one at the search leaves. This is
+   the only translation unit that includes smallchesslib. The library's
+   watchdog hook is borrowed as a per-node callback so a search that blows
+   its time budget can be aborted cleanly (see _smallchess_node_hook). */
+void _smallchess_node_hook(void);
+#define wdt_reset _smallchess_node_hook
+#define SCL_CALL_WDT_RESET 1
+#define SCL_TRANSPOSITION_TABLE_SIZE 512
+#define SCL_INCREMENTAL_EVAL 1
+#define SCL_EVALUATION_FUNCTION SCL_boardEvaluateStaticFast
+#include "smallchesslib.h"
+
+#include "smallchess_face.h"
+#include "watch.h"
+#include "watch_common_display.h"
+
+#define PIECE_LIST_END_MARKER 0xff
+#define NUM_ELEMENTS(a) (sizeof(a) / sizeof(a[0]))
+
+/* Per-move think budget in 128 Hz RTC ticks: about one second. */
+#define SMALLCHESS_AI_BUDGET_TICKS 128
+#define SMALLCHESS_AI_MAX_DEPTH 6
+
+static const int8_t cpu_done_beep[] = {BUZZER_NOTE_C5, 5, BUZZER_NOTE_C6, 5, BUZZER_NOTE_C7, 5, 0};
+
+static void smallchess_init_board(smallchess_face_state_t *state) {
+    SCL_gameInit((SCL_Game *)state->game, 0);
+    memset(state->moveable_pieces, 0xff, sizeof(state->moveable_pieces));
+    memset(state->moveable_dests, 0xff, sizeof(state->moveable_dests));
+}
+
+void smallchess_face_setup(uint8_t watch_face_index, void ** context_ptr) {
+    (void) watch_face_index;
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(smallchess_face_state_t));
+        memset(*context_ptr, 0, sizeof(smallchess_face_state_t));
+
+        /* now alloc/init the game board */
+        smallchess_face_state_t *state = (smallchess_face_state_t *)*context_ptr;
+        state->game = movement_face_context_alloc(sizeof(SCL_Game));
+        smallchess_init_board(*context_ptr);
+    }
+}
+
+void smallchess_face_activate(void *context) {
+    (void) context;
+}
+
+static void _smallchess_calc_moveable_pieces(smallchess_face_state_t *state) {
+    int moveable_pieces_idx = 0;
+    SCL_Game *game = (SCL_Game *)state->game;
+    for (int i = 0; i < SCL_BOARD_SQUARES; ++i) {
+        if (game->board[i] != '.' &&
+                SCL_pieceIsWhite(game->board[i]) == SCL_boardWhitesTurn(game->board)) {
+            SCL_SquareSet moveable_pieces = SCL_SQUARE_SET_EMPTY;
+            SCL_boardGetMoves(game->board, i, moveable_pieces);
+            if (SCL_squareSetSize(moveable_pieces) != 0) {
+                state->moveable_pieces[moveable_pieces_idx] = i;
+                moveable_pieces_idx++;
+            }
+        }
+    }
+    state->moveable_pieces[moveable_pieces_idx] = PIECE_LIST_END_MARKER;
+    state->moveable_pieces_idx = 0;
+}
+
+static jmp_buf _search_abort;
+static rtc_counter_t _search_deadline;
+static uint8_t _search_check;
+static bool _search_abortable;
+
+/* Called by smallchesslib at every search node (through the wdt_reset hook).
+   Every 256 nodes, compare the RTC counter against the deadline and bail out
+   of the search with longjmp if it has passed; the caller restores the board
+   and falls back to the previous depth's move. 256 nodes is a few
+   milliseconds at 4 MHz, so the overshoot past the deadline is invisible. */
+void _smallchess_node_hook(void) {
+    if (!_search_abortable) return;
+    if (++_search_check) return;
+    if ((int32_t)(watch_rtc_get_counter() - _search_deadline) > 0) longjmp(_search_abort, 1);
+}
+
+/* Iterative deepening against a measured budget: time each completed depth
+   with the RTC counter, and only start the next one if its predicted cost
+   (the last pass scaled by the measured growth between the last two passes)
+   still fits. Extensions make that prediction unreliable in tactical
+   positions, so the deadline is also enforced the hard way: a pass that
+   overruns is aborted mid-search and its partial result discarded. The
+   transposition table is kept across passes, which is what makes redoing the
+   shallow plies nearly free; it is cleared between moves because the root
+   position changed and stale depths would otherwise serve scores for lines
+   the opponent has since closed off. */
+static void _smallchess_search_with_budget(smallchess_face_state_t *state, uint8_t rep_from, uint8_t rep_to,
+                                           uint8_t *from, uint8_t *to, char *prom) {
+    SCL_Game *game = (SCL_Game *)state->game;
+    char board_copy[SCL_BOARD_STATE_SIZE];
+    rtc_counter_t start = watch_rtc_get_counter();
+    /* volatile: these live across the setjmp and are read after a longjmp */
+    volatile uint32_t last_pass = 0;
+    volatile uint32_t prev_pass = 0;
+    volatile uint8_t depth = 1;
+
+    _search_deadline = start + SMALLCHESS_AI_BUDGET_TICKS;
+    SCL_boardResetMaterial(game->board);
+    SCL_transpositionClear();
+
+    for (;;) {
+        uint8_t pass_from, pass_to;
+        char pass_prom;
+        rtc_counter_t pass_start = watch_rtc_get_counter();
+
+        memcpy(board_copy, game->board, SCL_BOARD_STATE_SIZE);
+        if (setjmp(_search_abort) != 0) {
+            /* deadline hit mid-pass: the board is somewhere down a search
+               line; put it back and keep the move from the last full pass */
+            _search_abortable = false;
+            memcpy(game->board, board_copy, SCL_BOARD_STATE_SIZE);
+            depth--;
+            break;
+        }
+
+        /* the first pass must run to completion so a move always exists */
+        _search_abortable = depth > 1;
+        SCL_getAIMove(game->board, depth, 1, 0, SCL_boardEvaluateStaticFast,
+                      NULL, 0, rep_from, rep_to, &pass_from, &pass_to, &pass_prom);
+        _search_abortable = false;
+
+        *from = pass_from;
+        *to = pass_to;
+        *prom = pass_prom;
+
+        rtc_counter_t now = watch_rtc_get_counter();
+        prev_pass = last_pass;
+        last_pass = now - pass_start;
+        if (depth >= SMALLCHESS_AI_MAX_DEPTH) break;
+
+        /* effective branching factor from the last two passes; first passes
+           are too quick to measure, so assume a conservative default */
+        uint32_t growth = 8;
+        if (prev_pass > 0 && last_pass > prev_pass) growth = (last_pass + prev_pass - 1) / prev_pass;
+        if (growth < 2) growth = 2;
+        if (growth > 16) growth = 16;
+
+        if ((uint32_t)(now - start) + last_pass * growth > SMALLCHESS_AI_BUDGET_TICKS) break;
+        depth++;
+    }
+
+    state->ai_depth = depth;
+}
+
+static void _smallchess_make_ai_move(smallchess_face_state_t *state) {
+    char ai_from_str[3] = {0};
+    char ai_to_str[3] = {0};
+    uint8_t rep_from, rep_to;
+    char ai_prom;
+
+    watch_clear_display();
+    watch_start_character_blink('C', 100);
+    SCL_gameGetRepetiotionMove(state->game, &rep_from, &rep_to);
+
+    _smallchess_search_with_budget(state, rep_from, rep_to, &state->ai_from_square, &state->ai_to_square, &ai_prom);
+
+    SCL_gameMakeMove(state->game, state->ai_from_square, state->ai_to_square, ai_prom);
+    watch_stop_blink();
+
+    watch_buzzer_play_sequence(cpu_done_beep, NULL);
+
+    /* cache the move as a string for SHOW_CPU_MOVE state */
+    SCL_squareToString(state->ai_from_square, ai_from_str);
+    SCL_squareToString(state->ai_to_square, ai_to_str);
+    snprintf(state->last_move_str, sizeof(state->last_move_str), " %s-%s", ai_from_str, ai_to_str);
+
+    /* now cache the list of legal pieces we can move */
+    _smallchess_calc_moveable_pieces(state);
+}
+
+static char _smallchess_make_lowercase(char c) {
+    if (c < 0x61)
+        return c + 0x20;
+
+    return c;
+}
+
+static void _smallchess_display(const char *top_left, uint16_t ply, const char *bottom) {
+    char buf[4];
+
+    watch_display_text(WATCH_POSITION_TOP_LEFT, top_left);
+    snprintf(buf, sizeof(buf), "%2u", ply % 100);
+    watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
+    watch_display_text(WATCH_POSITION_BOTTOM, bottom);
+}
+
+static void _smallchess_display_piece(char piece, uint16_t ply, const char *bottom) {
+    char top_left[3];
+
+    top_left[0] = _smallchess_make_lowercase(piece);
+    top_left[1] = ' ';
+    top_left[2] = '\0';
+    _smallchess_display(top_left, ply, bottom);
+}
+
+static void _smallchess_display_endgame(smallchess_face_state_t *state) {
+    uint8_t endgame_state = ((SCL_Game *)state->game)->state;
+    uint16_t ply = ((SCL_Game *)state->game)->ply;
+
+    switch (endgame_state) {
+        case SCL_GAME_STATE_WHITE_WIN:
+            _smallchess_display("Wh", ply, "m&ate ");
+            break;
+        case SCL_GAME_STATE_BLACK_WIN:
+            _smallchess_display("bL", ply, "m&ate ");
+            break;
+        case SCL_GAME_STATE_DRAW:
+        case SCL_GAME_STATE_DRAW_STALEMATE:
+        case SCL_GAME_STATE_DRAW_REPETITION:
+        case SCL_GAME_STATE_DRAW_50:
+        case SCL_GAME_STATE_DRAW_DEAD:
+            _smallchess_display("  ", ply, " Drauu");
+            break;
+        default:
+            _smallchess_display("  ", ply, " Error");
+            break;
+    }
+}
+
+static void _smallchess_face_update_lcd(smallchess_face_state_t *state) {
+    uint8_t start_square;
+    uint8_t end_square;
+    char start_coord[3] = {0};
+    char end_coord[3] = {0};
+    char buf[8] = {0};
+
+    uint16_t ply = ((SCL_Game *)state->game)->ply;
+
+    switch (state->state) {
+        case SMALLCHESS_MENU_RESUME:
+            _smallchess_display("SC", ply, "Resume");
+            break;
+        case SMALLCHESS_MENU_UNDO:
+            _smallchess_display("SC", ply, " Undo ");
+            break;
+        case SMALLCHESS_MENU_SHOW_LAST_MOVE:
+            _smallchess_display("SC", ply, "ShLast");
+            break;
+        case SMALLCHESS_MENU_NEW_WHITE:
+            _smallchess_display("Wh", ply, "Start ");
+            break;
+        case SMALLCHESS_MENU_NEW_BLACK:
+            _smallchess_display("bL", ply, "Start ");
+            break;
+        case SMALLCHESS_SHOW_CPU_MOVE:
+        case SMALLCHESS_SHOW_LAST_MOVE:
+            _smallchess_display_piece(((SCL_Game *)state->game)->board[state->ai_to_square], ply, state->last_move_str);
+            break;
+        case SMALLCHESS_SELECT_PIECE:
+            if (((SCL_Game *)state->game)->state != SCL_GAME_STATE_PLAYING) {
+                _smallchess_display_endgame(state);
+                break;
+            }
+            start_square = state->moveable_pieces[state->moveable_pieces_idx];
+            SCL_squareToString(start_square, start_coord);
+            snprintf(buf, sizeof(buf), " %s-  ", start_coord);
+            _smallchess_display_piece(((SCL_Game *)state->game)->board[start_square], ply + 1, buf);
+            break;
+        case SMALLCHESS_SELECT_DEST:
+            start_square = state->moveable_pieces[state->moveable_pieces_idx];
+            SCL_squareToString(start_square, start_coord);
+            end_square = state->moveable_dests[state->moveable_dests_idx];
+            SCL_squareToString(end_square, end_coord);
+            snprintf(buf, sizeof(buf), " %s-%s", start_coord, end_coord);
+            _smallchess_display_piece(((SCL_Game *)state->game)->board[start_square], ply + 1, buf);
+            break;
+        default:
+            break;
+    }
+}
+
+static void _smallchess_select_main_menu_subitem(smallchess_face_state_t *state) {
+    char from_str[3] = {0};
+    char to_str[3] = {0};
+    char prom;
+
+    switch (state->state) {
+        case SMALLCHESS_MENU_RESUME:
+            state->state = SMALLCHESS_SELECT_PIECE;
+            break;
+        case SMALLCHESS_MENU_UNDO:
+            /* undo twice to undo the CPU's move and our move */
+            SCL_gameUndoMove((SCL_Game *)state->game);
+            SCL_gameUndoMove((SCL_Game *)state->game);
+            /* and re-calculate the moveable pieces for this new state */
+            _smallchess_calc_moveable_pieces(state);
+            break;
+        case SMALLCHESS_MENU_NEW_WHITE:
+            SCL_gameInit((SCL_Game *)state->game, 0);
+            _smallchess_calc_moveable_pieces(state);
+            state->state = SMALLCHESS_SELECT_PIECE;
+            break;
+        case SMALLCHESS_MENU_NEW_BLACK:
+            SCL_gameInit((SCL_Game *)state->game, 0);
+            /* force a move since black is playing */
+            _smallchess_make_ai_move(state);
+            state->state = SMALLCHESS_SHOW_CPU_MOVE;
+            break;
+        case SMALLCHESS_MENU_SHOW_LAST_MOVE:
+            /* fetch the move */
+            SCL_recordGetMove(((SCL_Game *)state->game)->record, ((SCL_Game *)state->game)->ply - 1, &state->ai_from_square, &state->ai_to_square, &prom);
+            SCL_squareToString(state->ai_from_square, from_str);
+            SCL_squareToString(state->ai_to_square, to_str);
+            snprintf(state->last_move_str, sizeof(state->last_move_str), " %s-%s", from_str, to_str);
+            state->state = SMALLCHESS_SHOW_LAST_MOVE;
+            break;
+        default:
+            break;
+    }
+}
+
+static void _smallchess_handle_select_piece_button_event(smallchess_face_state_t *state, movement_event_t event) {
+    SCL_SquareSet moveable_dests = SCL_SQUARE_SET_EMPTY;
+
+    /* back to main menu on any event when game ends */
+    if (((SCL_Game *)state->game)->state != SCL_GAME_STATE_PLAYING) {
+        state->state = SMALLCHESS_MENU_RESUME;
+        return;
+    }
+
+    switch (event.event_type) {
+        case EVENT_ALARM_BUTTON_UP:
+            // check for no moves possible state (shouldn't happen but this will prevent weirdness)
+            if (state->moveable_pieces[0] == PIECE_LIST_END_MARKER) {
+                return;
+            }
+
+            state->moveable_pieces_idx += 1;
+            if (state->moveable_pieces_idx >= NUM_ELEMENTS(state->moveable_pieces)) {
+                state->moveable_pieces_idx = 0;
+            }
+
+            if (state->moveable_pieces[state->moveable_pieces_idx] == PIECE_LIST_END_MARKER) {
+                state->moveable_pieces_idx = 0;
+            }
+            break;
+        case EVENT_LIGHT_BUTTON_UP:
+            // check for no moves possible state (shouldn't happen but this will prevent weirdness)
+            if (state->moveable_pieces[0] == PIECE_LIST_END_MARKER) {
+                return;
+            }
+
+            /* handle wrap around */
+            if (state->moveable_pieces_idx == 0) {
+                for (unsigned int i = 0; i < NUM_ELEMENTS(state->moveable_pieces); i++) {
+                    if (state->moveable_pieces[i] == 0xff) {
+                        state->moveable_pieces_idx = i - 1;
+                        break;
+                    }
+                }
+            } else {
+                state->moveable_pieces_idx -= 1;
+            }
+            break;
+        case EVENT_LIGHT_LONG_PRESS:
+            if (((SCL_Game *)state->game)->ply == 0) {
+                state->state = SMALLCHESS_MENU_NEW_WHITE;
+            } else {
+                state->state = SMALLCHESS_MENU_RESUME;
+            }
+            break;
+        case EVENT_ALARM_LONG_PRESS:
+            /* pre-calculate the possible moves this piece can make */
+            SCL_boardGetMoves(((SCL_Game *)state->game)->board, state->moveable_pieces[state->moveable_pieces_idx], moveable_dests);
+            state->moveable_dests_idx = 0;
+            SCL_SQUARE_SET_ITERATE_BEGIN(moveable_dests)
+                state->moveable_dests[state->moveable_dests_idx] = iteratedSquare;
+                state->moveable_dests_idx++;
+            SCL_SQUARE_SET_ITERATE_END
+            state->moveable_dests[state->moveable_dests_idx] = PIECE_LIST_END_MARKER;
+            state->moveable_dests_idx = 0;
+            state->state = SMALLCHESS_SELECT_DEST;
+        default:
+            break;
+    }
+}
+
+static void _smallchess_handle_select_dest_button_event(smallchess_face_state_t *state, movement_event_t event) {
+    switch (event.event_type) {
+        case EVENT_ALARM_BUTTON_UP:
+            // check for no moves possible state (shouldn't happen but this will prevent weirdness)
+            if (state->moveable_dests[0] == PIECE_LIST_END_MARKER) {
+                return;
+            }
+            state->moveable_dests_idx += 1;
+            if (state->moveable_dests_idx >= (sizeof(state->moveable_dests) / sizeof(state->moveable_dests[0]))) {
+                state->moveable_dests_idx = 0;
+            }
+
+            if (state->moveable_dests[state->moveable_dests_idx] == PIECE_LIST_END_MARKER) {
+                state->moveable_dests_idx = 0;
+            }
+            break;
+        case EVENT_LIGHT_BUTTON_UP:
+            // check for no moves possible state (shouldn't happen but this will prevent weirdness)
+            if (state->moveable_dests[0] == PIECE_LIST_END_MARKER) {
+                return;
+            }
+
+            /* handle wrap around */
+            if (state->moveable_dests_idx == 0) {
+                for (unsigned int i = 0; i < NUM_ELEMENTS(state->moveable_dests); i++) {
+                    if (state->moveable_dests[i] == 0xff) {
+                        state->moveable_dests_idx = i - 1;
+                        break;
+                    }
+                }
+            } else {
+                state->moveable_dests_idx -= 1;
+            }
+            break;
+        case EVENT_LIGHT_LONG_PRESS:
+            state->state = SMALLCHESS_SELECT_PIECE;
+            break;
+        case EVENT_ALARM_LONG_PRESS:
+            SCL_gameMakeMove((SCL_Game *)state->game, state->moveable_pieces[state->moveable_pieces_idx], state->moveable_dests[state->moveable_dests_idx], 'q');
+
+            /* if the player didn't win or draw here, calculate a move */
+            if (((SCL_Game *)state->game)->state == SCL_GAME_STATE_PLAYING) {
+                _smallchess_make_ai_move(state);
+                state->state = SMALLCHESS_SHOW_CPU_MOVE;
+            } else {
+                /* player ended the game through mate or draw; jump to select piece screen to show state */
+                state->state = SMALLCHESS_SELECT_PIECE;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/* this just waits until any button is hit */
+static void _smallchess_handle_show_cpu_move_button_event(smallchess_face_state_t *state, movement_event_t event) {
+    switch (event.event_type) {
+        case EVENT_ALARM_BUTTON_UP:
+        case EVENT_LIGHT_BUTTON_UP:
+        case EVENT_ALARM_LONG_PRESS:
+        case EVENT_LIGHT_LONG_PRESS:
+            state->state = SMALLCHESS_SELECT_PIECE;
+            break;
+        default:
+            break;
+    }
+}
+
+static void _smallchess_handle_show_last_move_button_event(smallchess_face_state_t *state, movement_event_t event) {
+    switch (event.event_type) {
+        case EVENT_ALARM_BUTTON_UP:
+        case EVENT_LIGHT_BUTTON_UP:
+        case EVENT_ALARM_LONG_PRESS:
+        case EVENT_LIGHT_LONG_PRESS:
+            state->state = SMALLCHESS_MENU_SHOW_LAST_MOVE;
+            break;
+        default:
+            break;
+    }
+}
+
+static void _smallchess_handle_playing_button_event(smallchess_face_state_t *state, movement_event_t event) {
+    if (state->state == SMALLCHESS_SELECT_PIECE) {
+        _smallchess_handle_select_piece_button_event(state, event);
+    } else if (state->state == SMALLCHESS_SELECT_DEST) {
+        _smallchess_handle_select_dest_button_event(state, event);
+    } else if (state->state == SMALLCHESS_SHOW_CPU_MOVE) {
+        _smallchess_handle_show_cpu_move_button_event(state, event);
+    } else if (state->state == SMALLCHESS_SHOW_LAST_MOVE) {
+        _smallchess_handle_show_last_move_button_event(state, event);
+    }
+}
+
+static void _smallchess_handle_main_menu_button_event(smallchess_face_state_t *state, movement_event_t event) {
+    uint16_t ply = ((SCL_Game *)state->game)->ply;
+
+    switch (event.event_type) {
+        case EVENT_ALARM_BUTTON_UP:
+            /* no game started; only offer start white/start black */
+            if (ply == 0) {
+                if (state->state == SMALLCHESS_MENU_NEW_WHITE) {
+                    state->state = SMALLCHESS_MENU_NEW_BLACK;
+                } else {
+                    state->state = SMALLCHESS_MENU_NEW_WHITE;
+                }
+            } else {
+                state->state++;
+                if (state->state >= SMALLCHESS_PLAYING_SPLIT) {
+                    state->state = SMALLCHESS_MENU_RESUME;
+                }
+            }
+
+            break;
+        case EVENT_LIGHT_BUTTON_UP:
+            /* no game started; only offer start white/start black */
+            if (ply == 0) {
+                if (state->state == SMALLCHESS_MENU_NEW_BLACK) {
+                    state->state = SMALLCHESS_MENU_NEW_WHITE;
+                } else {
+                    state->state = SMALLCHESS_MENU_NEW_BLACK;
+                }
+            } else {
+                if (state->state == SMALLCHESS_MENU_RESUME) {
+                    state->state = SMALLCHESS_PLAYING_SPLIT - 1;
+                } else {
+                    state->state--;
+                }
+            }
+
+            break;
+        case EVENT_ALARM_LONG_PRESS:
+            _smallchess_select_main_menu_subitem(state);
+            break;
+        default:
+            break;
+    }
+}
+
+static void _smallchess_handle_button_event(smallchess_face_state_t *state, movement_event_t event) {
+    if (state->state < SMALLCHESS_PLAYING_SPLIT) {
+        /* in main menu */
+        _smallchess_handle_main_menu_button_event(state, event);
+    } else if (state->state > SMALLCHESS_PLAYING_SPLIT) {
+        /* in piece selection */
+        _smallchess_handle_playing_button_event(state, event);
+    }
+}
+
+bool smallchess_face_loop(movement_event_t event, void *context) {
+    smallchess_face_state_t *state = (smallchess_face_state_t *)context;
+
+    switch (event.event_type) {
+        case EVENT_ACTIVATE:
+            if (((SCL_Game *)state->game)->ply == 0) {
+                state->state = SMALLCHESS_MENU_NEW_WHITE;
+            } else {
+                state->state = SMALLCHESS_MENU_RESUME;
+            }
+            _smallchess_face_update_lcd(state);
+            break;
+        case EVENT_LIGHT_BUTTON_UP:
+        case EVENT_LIGHT_LONG_PRESS:
+        case EVENT_ALARM_BUTTON_UP:
+        case EVENT_ALARM_LONG_PRESS:
+            _smallchess_handle_button_event(state, event);
+            _smallchess_face_update_lcd(state);
+            break;
+        case EVENT_TICK:
+            break;
+        case EVENT_TIMEOUT:
+            break;
+        case EVENT_LIGHT_BUTTON_DOWN:
+            break;
+        default:
+            return movement_default_loop_handler(event);
+    }
+
+    return true;
+}
+
+void smallchess_face_resign(void *context) {
+    (void) context;
+    watch_set_led_off();
+}
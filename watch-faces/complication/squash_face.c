@@ -26,6 +26,7 @@
 #include <string.h>
 #include <stdio.h>
 #include "squash_face.h"
+#include "ring_log.h"
 
 // https://en.wikipedia.org/wiki/Squash_(sport)#Scoring_system
 // Using "point-a-rally scoring (PARS)" to 11 below.
@@ -50,10 +51,8 @@ static void update_display(squash_state_t *state) {
     watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
 
     // Show current score: P1-P2
-    sprintf(buf, "%02d", state->player1_score);
-    watch_display_text(WATCH_POSITION_HOURS, buf);
-    sprintf(buf, "%02d", state->player2_score);
-    watch_display_text(WATCH_POSITION_MINUTES, buf);
+    watch_display_u8(WATCH_POSITION_HOURS, state->player1_score, true);
+    watch_display_u8(WATCH_POSITION_MINUTES, state->player2_score, true);
 
     // If game over, show indicator
     if (state->is_game_over) {
@@ -63,6 +62,16 @@ static void update_display(squash_state_t *state) {
     }
 }
 
+static void log_game_result(squash_state_t *state) {
+    // One record per completed game: final rally scores plus the games tally.
+    uint8_t payload[5] = {
+        state->is_game_over,
+        state->player1_score, state->player2_score,
+        state->player1_games, state->player2_games,
+    };
+    ring_log_append(RING_LOG_TYPE_SQUASH, watch_rtc_get_date_time().reg, payload, sizeof(payload));
+}
+
 static void check_game_status(squash_state_t *state) {
     // Check if a player has won the current game
     if ((state->player1_score >= POINTS_TO_WIN_GAME || state->player2_score >= POINTS_TO_WIN_GAME) &&
@@ -82,7 +91,12 @@ static void check_game_status(squash_state_t *state) {
         if (state->player1_games >= GAMES_TO_WIN_MATCH || state->player2_games >= GAMES_TO_WIN_MATCH) {
             state->is_game_over = true;
             movement_play_signal();
-        } else {
+        }
+
+        // Persist the completed game to the external flash ring log, if this board has one.
+        log_game_result(state);
+
+        if (!state->is_game_over) {
             // Reset for next game
             state->player1_score = 0;
             state->player2_score = 0;
@@ -104,8 +118,10 @@ void squash_face_setup(uint8_t watch_face_index, void **context_ptr) {
     (void)watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(squash_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(squash_state_t));
         memset(*context_ptr, 0, sizeof(squash_state_t));
+        // no-op on boards without the Sensor Board's SPI flash.
+        ring_log_mount();
     }
 }
 
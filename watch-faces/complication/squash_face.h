@@ -35,6 +35,10 @@
  * - Alarm button: Increment player 2's score
  * - Mode button long press: Reset scores
  * - Mode button: Switch to next watch face
+ *
+ * On boards with the Sensor Board's SPI flash, every completed game is
+ * appended to the flash ring log (final scores and the games tally), so
+ * match history survives leaving the face and even a battery swap.
  */
 
 typedef struct {
@@ -38,7 +38,7 @@ static const watch_date_time_t distant_future = {
 void stopwatch_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(stopwatch_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(stopwatch_state_t));
         memset(*context_ptr, 0, sizeof(stopwatch_state_t));
     }
 }
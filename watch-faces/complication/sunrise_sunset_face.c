@@ -27,13 +27,12 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 #include "sunrise_sunset_face.h"
 #include "watch.h"
 #include "watch_utility.h"
 #include "watch_common_display.h"
 #include "filesystem.h"
-#include "sunriset.h"
+#include "ephemeris.h"
 
 #if __EMSCRIPTEN__
 #include <emscripten.h>
@@ -46,7 +45,7 @@ static void persist_location_to_filesystem(movement_location_t new_location) {
 
     filesystem_read_file("location.u32", (char *) &maybe_location.reg, sizeof(movement_location_t));
     if (new_location.reg != maybe_location.reg) {
-        filesystem_write_file("location.u32", (char *) &new_location.reg, sizeof(movement_location_t));
+        filesystem_write_file_deferred("location.u32", (char *) &new_location.reg, sizeof(movement_location_t));
     }
 }
 
@@ -65,7 +64,7 @@ static void _sunrise_sunset_set_expiration(sunrise_sunset_state_t *state, watch_
 
 static void _sunrise_sunset_face_update(sunrise_sunset_state_t *state) {
     char buf[14];
-    double rise, set, minutes, seconds;
+    int16_t rise, set;
     bool show_next_match = false;
     movement_location_t movement_location;
     if (state->longLatToUse == 0 || _location_count <= 1)
@@ -85,22 +84,17 @@ static void _sunrise_sunset_face_update(sunrise_sunset_state_t *state) {
     watch_date_time_t scratch_time; // scratchpad, contains different values at different times
     scratch_time.reg = date_time.reg;
 
-    // Weird quirky unsigned things were happening when I tried to cast these directly to doubles below.
-    // it looks redundant, but extracting them to local int16's seemed to fix it.
     int16_t lat_centi = (int16_t)movement_location.bit.latitude;
     int16_t lon_centi = (int16_t)movement_location.bit.longitude;
 
-    double lat = (double)lat_centi / 100.0;
-    double lon = (double)lon_centi / 100.0;
-
-    // sunriset returns the rise/set times as signed decimal hours in UTC.
-    // this can mean hours below 0 or above 31, which won't fit into a watch_date_time_t struct.
-    // to deal with this, we set aside the offset in hours, and add it back before converting it to a watch_date_time_t.
-    double hours_from_utc = ((double)movement_get_current_timezone_offset()) / 3600.0;
+    // the fixed-point sunriset returns the rise/set times as minutes in UTC.
+    // these can fall below 0 or above 24*60, which won't fit into a watch_date_time_t struct.
+    // to deal with this, we set aside the offset in minutes, and add it back before converting it to a watch_date_time_t.
+    int32_t minutes_from_utc = movement_get_current_timezone_offset() / 60;
 
     // we loop twice because if it's after sunset today, we need to recalculate to display values for tomorrow.
     for(int i = 0; i < 2; i++) {
-        uint8_t result = sun_rise_set(scratch_time.unit.year + WATCH_RTC_REFERENCE_YEAR, scratch_time.unit.month, scratch_time.unit.day, lon, lat, &rise, &set);
+        uint8_t result = ephemeris_sun_rise_set(scratch_time.unit.year + WATCH_RTC_REFERENCE_YEAR, scratch_time.unit.month, scratch_time.unit.day, lon_centi, lat_centi, &rise, &set);
 
         if (result != 0) {
             watch_clear_colon();
@@ -117,14 +111,12 @@ static void _sunrise_sunset_face_update(sunrise_sunset_state_t *state) {
         watch_set_colon();
         if (movement_clock_mode_24h()) watch_set_indicator(WATCH_INDICATOR_24H);
 
-        rise += hours_from_utc;
-        set += hours_from_utc;
+        rise += minutes_from_utc;
+        set += minutes_from_utc;
 
-        minutes = 60.0 * fmod(rise, 1);
-        seconds = 60.0 * fmod(minutes, 1);
-        scratch_time.unit.hour = floor(rise);
-        if (seconds < 30) scratch_time.unit.minute = floor(minutes);
-        else scratch_time.unit.minute = ceil(minutes);
+        // floor division, so a rise just before local midnight stays on the right day
+        scratch_time.unit.hour = (rise >= 0 ? rise : rise - 59) / 60;
+        scratch_time.unit.minute = ((rise % 60) + 60) % 60;
 
         // Handle hour overflow from timezone conversion
         while (scratch_time.unit.hour >= 24) {
@@ -135,11 +127,6 @@ static void _sunrise_sunset_face_update(sunrise_sunset_state_t *state) {
             scratch_time = watch_utility_date_time_from_unix_time(timestamp, 0);
         }
 
-        if (scratch_time.unit.minute == 60) {
-            scratch_time.unit.minute = 0;
-            scratch_time.unit.hour = (scratch_time.unit.hour + 1) % 24;
-        }
-
         if (date_time.reg < scratch_time.reg) _sunrise_sunset_set_expiration(state, scratch_time);
 
         if (date_time.reg < scratch_time.reg || show_next_match) {
@@ -159,11 +146,8 @@ static void _sunrise_sunset_face_update(sunrise_sunset_state_t *state) {
             }
         }
 
-        minutes = 60.0 * fmod(set, 1);
-        seconds = 60.0 * fmod(minutes, 1);
-        scratch_time.unit.hour = floor(set);
-        if (seconds < 30) scratch_time.unit.minute = floor(minutes);
-        else scratch_time.unit.minute = ceil(minutes);
+        scratch_time.unit.hour = (set >= 0 ? set : set - 59) / 60;
+        scratch_time.unit.minute = ((set % 60) + 60) % 60;
 
         // Handle hour overflow from timezone conversion
         while (scratch_time.unit.hour >= 24) {
@@ -174,11 +158,6 @@ static void _sunrise_sunset_face_update(sunrise_sunset_state_t *state) {
             scratch_time = watch_utility_date_time_from_unix_time(timestamp, 0);
         }
 
-        if (scratch_time.unit.minute == 60) {
-            scratch_time.unit.minute = 0;
-            scratch_time.unit.hour = (scratch_time.unit.hour + 1) % 24;
-        }
-
         if (date_time.reg < scratch_time.reg) _sunrise_sunset_set_expiration(state, scratch_time);
 
         if (date_time.reg < scratch_time.reg || show_next_match) {
@@ -451,9 +430,10 @@ static void _sunrise_sunset_face_advance_digit(sunrise_sunset_state_t *state) {
 }
 
 void sunrise_sunset_face_setup(uint8_t watch_face_index, void ** context_ptr) {
-    (void) watch_face_index;
+    // solar position math is double-precision trigonometry; run it at full clock.
+    movement_set_face_compute_heavy(watch_face_index, true);
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(sunrise_sunset_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(sunrise_sunset_state_t));
         memset(*context_ptr, 0, sizeof(sunrise_sunset_state_t));
     }
 }
@@ -53,15 +53,32 @@ static const int16_t _tally_default[] = {
 void tally_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(tally_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(tally_state_t));
         memset(*context_ptr, 0, sizeof(tally_state_t));
         tally_state_t *state = (tally_state_t *)*context_ptr;
         state->tally_default_idx = 0;
         state->tally_idx = _tally_default[state->tally_default_idx];
         _init_val = true;
+        bool restored;
+        state->backup_register = movement_claim_tagged_backup_register(MOVEMENT_BACKUP_TAG('T', 'L', 'Y', 0), &restored);
+        if (state->backup_register && restored) {
+            // Low half is the tally, byte above it the preset index.
+            uint32_t saved = movement_get_tagged_backup_data(state->backup_register);
+            int16_t saved_tally = (int16_t)(saved & 0xFFFF);
+            uint8_t saved_idx = (saved >> 16) & 0xFF;
+            if (saved_idx < TALLY_FACE_PRESETS_SIZE() && saved_tally >= TALLY_FACE_MIN && saved_tally <= TALLY_FACE_MAX) {
+                state->tally_default_idx = saved_idx;
+                state->tally_idx = saved_tally;
+                _init_val = (state->tally_idx == _tally_default[state->tally_default_idx]);
+            }
+        }
     }
 }
 
+static void tally_face_save(tally_state_t *state) {
+    movement_set_tagged_backup_data(((uint32_t)state->tally_default_idx << 16) | (uint16_t)state->tally_idx, state->backup_register);
+}
+
 void tally_face_activate(void *context) {
     (void) context;
     _quick_ticks_running = false;
@@ -192,7 +209,7 @@ bool tally_face_loop(movement_event_t event, void *context) {
             print_tally(state, movement_button_should_sound());
             break;
         case EVENT_TIMEOUT:
-            // ignore timeout
+            tally_face_save(state);
             break;
         default:
             movement_default_loop_handler(event);
@@ -221,5 +238,5 @@ void print_tally(tally_state_t *state, bool sound_on) {
 }
 
 void tally_face_resign(void *context) {
-    (void) context;
+    tally_face_save((tally_state_t *)context);
 }
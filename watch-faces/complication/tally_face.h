@@ -45,6 +45,10 @@
  *                       Else: Resets counter
  * 
  * Incrementing or Decrementing the tally will beep if Beeping is set in the global Preferences
+ *
+ * The tally and selected preset are saved in an RTC backup register on resign
+ * or timeout, so they survive resets and firmware updates (though not a
+ * battery change).
  */
 
 #include "movement.h"
@@ -52,6 +56,7 @@
 typedef struct {
     int16_t tally_idx;
     uint8_t tally_default_idx;
+    uint8_t backup_register;
 } tally_state_t;
 
 //#define TALLY_FACE_PRESETS_MTG
@@ -23,15 +23,11 @@
  * SOFTWARE.
  */
 
-// Emulator only: need time() to seed the random number generator.
-#if __EMSCRIPTEN__
-#include <time.h>
-#endif
-
 #include <stdlib.h>
 
 #include <string.h>
 #include "tarot_face.h"
+#include "watch_utility.h"
 
 #define TAROT_ANIMATION_TICK_FREQUENCY 8
 #define FLIPPED_BIT_POS 7
@@ -186,12 +182,7 @@ static void tarot_display(tarot_state_t *state) {
 }
 
 static uint8_t get_rand_num(uint8_t num_values) {
-    // Emulator: use rand. Hardware: use arc4random.
-#if __EMSCRIPTEN__
-    return rand() % num_values;
-#else
-    return arc4random_uniform(num_values);
-#endif
+    return watch_utility_random_uniform(num_values);
 }
 
 static uint8_t draw_one_card(tarot_state_t *state) {
@@ -278,16 +269,12 @@ static void display_animation(tarot_state_t *state) {
 void tarot_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(tarot_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(tarot_state_t));
         memset(*context_ptr, 0, sizeof(tarot_state_t));
         tarot_state_t *state = (tarot_state_t *)*context_ptr;
         state->major_arcana_only = true;
         state->num_cards_to_draw = 3;
     }
-    // Emulator only: Seed random number generator
-#if __EMSCRIPTEN__
-    srand(time(NULL));
-#endif
 }
 
 void tarot_face_activate(void *context) {
@@ -39,7 +39,7 @@ static uint8_t _beeps_to_play;    // temporary counter for ring signals playing
 static void _signal_callback() {
     if (_beeps_to_play) {
         _beeps_to_play--;
-        watch_buzzer_play_sequence((int8_t *)_sound_seq_beep, _signal_callback);
+        watch_buzzer_play_sequence(_sound_seq_beep, _signal_callback);
     }
 }
 
@@ -58,7 +58,7 @@ static void _start(timer_state_t *state, bool with_beep) {
     state->mode = running;
     movement_schedule_background_task_for_face(state->watch_face_index, target_dt);
     watch_set_indicator(WATCH_INDICATOR_BELL);
-    if (with_beep) watch_buzzer_play_sequence((int8_t *)_sound_seq_start, NULL);
+    if (with_beep) watch_buzzer_play_sequence(_sound_seq_start, NULL);
 }
 
 static void _draw(timer_state_t *state, uint8_t subsecond) {
@@ -193,7 +193,7 @@ static inline bool _check_for_signal() {
 void timer_face_setup(uint8_t watch_face_index, void ** context_ptr) {
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(timer_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(timer_state_t));
         timer_state_t *state = (timer_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(timer_state_t));
         state->watch_face_index = watch_face_index;
@@ -234,7 +234,9 @@ bool timer_face_loop(movement_event_t event, void *context) {
                     subsecond = 0;
                 } else _abort_quick_cycle(state);
             }
-            _draw(state, subsecond);
+            // if more events landed in this pass (e.g. a button press alongside the
+            // tick), skip this draw; the last event's handler will redraw.
+            if (!movement_more_events_this_pass()) _draw(state, subsecond);
             break;
         case EVENT_LIGHT_BUTTON_DOWN:
             switch (state->mode) {
@@ -302,7 +304,7 @@ bool timer_face_loop(movement_event_t event, void *context) {
         case EVENT_BACKGROUND_TASK:
             // play the alarm
             _beeps_to_play = 4;
-            watch_buzzer_play_sequence((int8_t *)_sound_seq_beep, _signal_callback);
+            watch_buzzer_play_sequence(_sound_seq_beep, _signal_callback);
             _reset(state);
             if (state->timers[state->current_timer].unit.repeat) _start(state, false);
             break;
@@ -162,13 +162,14 @@ static inline uint32_t totp_compute_base_timestamp() {
 }
 
 void totp_face_setup(uint8_t watch_face_index, void ** context_ptr) {
-    (void) watch_face_index;
+    // each code is an HMAC-SHA-1 over the time step; run those at full clock.
+    movement_set_face_compute_heavy(watch_face_index, true);
 
     totp_validate_key_lengths();
 
     if (*context_ptr == NULL) {
-        totp_state_t *totp = malloc(sizeof(totp_state_t));
-        totp->current_decoded_key = malloc(TOTP_FACE_MAX_KEY_LENGTH);
+        totp_state_t *totp = movement_face_context_alloc(sizeof(totp_state_t));
+        totp->current_decoded_key = movement_face_context_alloc(TOTP_FACE_MAX_KEY_LENGTH);
         *context_ptr = totp;
     }
 }
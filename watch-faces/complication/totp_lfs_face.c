@@ -38,6 +38,23 @@
 #define MAX_TOTP_SECRET_SIZE 128
 #define TOTP_FILE "totp_uris.txt"
 
+// Parsed records are cached in a binary index file so later activations do one
+// small read instead of re-parsing every URI in the text file. The index is a
+// raw dump of the totp_records array behind a small header; the version field
+// guards against layout changes, and the recorded source file size tells us
+// when totp_uris.txt has been replaced and the index must be rebuilt. (A
+// same-size edit slips past that check; rm the index to force a rebuild.)
+#define TOTP_IDX_FILE "totp_uris.idx"
+#define TOTP_IDX_MAGIC 0x4954  // "TI"
+#define TOTP_IDX_VERSION 1
+
+typedef struct {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t num_records;
+    uint32_t source_size;
+} totp_idx_header_t;
+
 const char* TOTP_URI_START = "otpauth://totp/";
 
 struct totp_record {
@@ -127,6 +144,66 @@ static bool totp_lfs_face_read_param(struct totp_record *totp_record, char *para
     return true;
 }
 
+// Reads one newline-terminated line through the persistent handle opened with
+// filesystem_open_read, advancing *offset past the line. Same contract as
+// filesystem_read_line, but without reopening the file and seeking from scratch per call.
+static bool totp_lfs_face_read_line(char *buf, int32_t *offset, int32_t length) {
+    int32_t bytes_read = filesystem_read_at(*offset, buf, length - 1);
+    if (bytes_read < 0) return false;
+    for (int32_t i = 0; i < bytes_read; i++) {
+        (*offset)++;
+        if (buf[i] == '\n') {
+            buf[i] = 0;
+            break;
+        }
+    }
+    // warm the caches for the next line while the caller parses this one
+    filesystem_read_ahead(*offset);
+    return true;
+}
+
+static bool totp_lfs_face_load_index(void) {
+    int32_t source_size = filesystem_get_file_size(TOTP_FILE);
+    if (source_size < 0) return false;
+    if (!filesystem_open_read(TOTP_IDX_FILE)) return false;
+
+    // one byte of slack in each buffer: filesystem_read_at null-terminates.
+    char buf[sizeof(totp_idx_header_t) + sizeof(totp_records) + 1];
+    totp_idx_header_t header;
+    bool ok = filesystem_read_at(0, buf, sizeof(totp_idx_header_t)) == sizeof(totp_idx_header_t);
+    if (ok) {
+        memcpy(&header, buf, sizeof(header));
+        ok = header.magic == TOTP_IDX_MAGIC
+            && header.version == TOTP_IDX_VERSION
+            && header.num_records > 0
+            && header.num_records <= MAX_TOTP_RECORDS
+            && header.source_size == (uint32_t)source_size;
+    }
+    if (ok) {
+        int32_t length = header.num_records * sizeof(struct totp_record);
+        ok = filesystem_read_at(sizeof(totp_idx_header_t), buf, length) == length;
+        if (ok) {
+            memcpy(totp_records, buf, length);
+            num_totp_records = header.num_records;
+        }
+    }
+    filesystem_close();
+    return ok;
+}
+
+static void totp_lfs_face_write_index(int32_t source_size) {
+    char buf[sizeof(totp_idx_header_t) + sizeof(totp_records)];
+    totp_idx_header_t header = {
+        .magic = TOTP_IDX_MAGIC,
+        .version = TOTP_IDX_VERSION,
+        .num_records = num_totp_records,
+        .source_size = (uint32_t)source_size,
+    };
+    memcpy(buf, &header, sizeof(header));
+    memcpy(buf + sizeof(header), totp_records, num_totp_records * sizeof(struct totp_record));
+    filesystem_write_file(TOTP_IDX_FILE, buf, sizeof(header) + num_totp_records * sizeof(struct totp_record));
+}
+
 static void totp_lfs_face_read_file(char *filename) {
     // For 'format' of file, see comment at top.
     const size_t uri_start_len = strlen(TOTP_URI_START);
@@ -136,9 +213,14 @@ static void totp_lfs_face_read_file(char *filename) {
         return;
     }
 
+    if (!filesystem_open_read(filename)) {
+        printf("TOTP file error: %s\n", filename);
+        return;
+    }
+
     char line[256];
     int32_t offset = 0, old_offset = 0;
-    while (old_offset = offset, filesystem_read_line(filename, line, &offset, 255) && strlen(line)) {
+    while (old_offset = offset, totp_lfs_face_read_line(line, &offset, 255) && strlen(line)) {
         if (num_totp_records == MAX_TOTP_RECORDS) {
             printf("TOTP max records: %d\n", MAX_TOTP_RECORDS);
             break;
@@ -187,17 +269,30 @@ static void totp_lfs_face_read_file(char *filename) {
             printf("TOTP missing secret: %s\n", line);
         }
     }
+
+    filesystem_close();
+}
+
+// Load the preparsed index if it's still good for the current totp_uris.txt;
+// otherwise parse the text file and compile a fresh index from the result.
+static void totp_lfs_face_load_records(void) {
+    if (totp_lfs_face_load_index()) return;
+
+    int32_t source_size = filesystem_get_file_size(TOTP_FILE);
+    totp_lfs_face_read_file(TOTP_FILE);
+    if (num_totp_records > 0) totp_lfs_face_write_index(source_size);
 }
 
 void totp_lfs_face_setup(uint8_t watch_face_index, void ** context_ptr) {
-    (void) watch_face_index;
+    // each code is an HMAC-SHA-1 over the time step; run those at full clock.
+    movement_set_face_compute_heavy(watch_face_index, true);
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(totp_lfs_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(totp_lfs_state_t));
     }
 
 #if !(__EMSCRIPTEN__)
     if (num_totp_records == 0) {
-        totp_lfs_face_read_file(TOTP_FILE);
+        totp_lfs_face_load_records();
     }
 #endif
 }
@@ -206,16 +301,16 @@ static uint8_t *totp_lfs_face_get_file_secret(struct totp_record *record) {
     char buffer[BASE32_LEN(MAX_TOTP_SECRET_SIZE) + 1];
     int32_t file_secret_offset = record->file_secret_offset;
 
-    /* TODO filesystem_read_line is quite inefficient. Consider writing a new function,
-     * and keeping the file open?
-     */
-    if (!filesystem_read_line(TOTP_FILE, buffer, &file_secret_offset, record->file_secret_length + 1)) {
+    bool read_ok = filesystem_open_read(TOTP_FILE)
+        && filesystem_read_at(file_secret_offset, buffer, record->file_secret_length) >= 0;
+    filesystem_close();
+    if (!read_ok) {
         /* Shouldn't happen at this point. Return current_secret, which is misleading but will not cause a crash. */
-        printf("TOTP can't read expected secret from totp_uris.txt (failed readline)\n");
+        printf("TOTP can't read expected secret from totp_uris.txt (failed read)\n");
         return current_secret;
     }
     if (base32_decode((unsigned char *)buffer, current_secret) != record->secret_size) {
-        printf("TOTP can't properly decode secret '%s' from totp_uris.txt; failed at offset %d; read to %ld\n", buffer, record->file_secret_offset, file_secret_offset);
+        printf("TOTP can't properly decode secret '%s' from totp_uris.txt; offset %d, length %d\n", buffer, record->file_secret_offset, record->file_secret_length);
     }
     return current_secret;
 }
@@ -248,7 +343,7 @@ void totp_lfs_face_activate(void *context) {
     if (num_totp_records == 0) {
         // Doing this here rather than in setup makes things a bit more pleasant in the simulator, since there's no easy way to trigger
         // setup again after uploading the data.
-        totp_lfs_face_read_file(TOTP_FILE);
+        totp_lfs_face_load_records();
     }
 #endif
 
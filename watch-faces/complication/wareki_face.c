@@ -34,6 +34,37 @@
 static bool _alarm_button_press;
 static bool _light_button_press;
 
+// Era boundaries as epoch days (days since 1970-01-01, the same count that
+// watch_utility_convert_to_epoch_day and movement_get_local_epoch_day produce),
+// sorted ascending. An era that began before the epoch gets day 0: the RTC
+// cannot represent dates that early, so it just acts as the table floor.
+typedef struct {
+    uint32_t start_epoch_day;
+    uint16_t gannen;     // Gregorian year of the era's year 1
+    char label[4];       // top-left label on the custom LCD
+    char label_short[3]; // top-left label on the classic LCD
+} wareki_era_t;
+
+static const wareki_era_t _wareki_eras[] = {
+    { 0,     SHOWA_GANNEN,  "Sho", "s " },  // Showa, from 1926-12-25 (before the epoch)
+    { 6947,  HEISEI_GANNEN, "HEI", "h " },  // Heisei, from 1989-01-08
+    { 18017, REIWA_GANNEN,  "REI", "r " },  // Reiwa, from 2019-05-01
+};
+#define WAREKI_ERA_COUNT (sizeof(_wareki_eras) / sizeof(_wareki_eras[0]))
+
+// greatest era whose start is on or before the given day. The table is sorted,
+// so this is a binary search: two table loads deep for three eras, and adding
+// a future era keeps it logarithmic.
+static uint8_t _wareki_era_for_epoch_day(uint32_t epoch_day) {
+    uint8_t lo = 0, hi = WAREKI_ERA_COUNT - 1;
+    while (lo < hi) {
+        uint8_t mid = (lo + hi + 1) / 2;
+        if (_wareki_eras[mid].start_epoch_day <= epoch_day) lo = mid;
+        else hi = mid - 1;
+    }
+    return lo;
+}
+
 
 void wareki_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
@@ -41,7 +72,7 @@ void wareki_setup(uint8_t watch_face_index, void ** context_ptr) {
     //printf("wareki_setup() \n");
     
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(wareki_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(wareki_state_t));
         memset(*context_ptr, 0, sizeof(wareki_state_t));
 
         //debug code 
@@ -75,61 +106,40 @@ static void draw_wareki_splash(wareki_state_t *state) {
 //draw year and Japanese wareki
 static void draw_year_and_wareki(wareki_state_t *state) {
     char buf[16];
-    
-    bool is_custom_lcd = watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM;
 
-    if(state->disp_year == REIWA_GANNEN){
-        //The first year of Reiwa (2019) began on May 1. The period before May 1 is Heisei 31.
-        //In other words, 2019 is Heisei Year 31 and it is possible that it is Reiwa Year 1.
-        watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "H31", " r");
+    bool is_custom_lcd = watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM;
 
-        if (is_custom_lcd)
-        {
-            //For custom LCDs, display both Heisei and Reiwa.
-            watch_display_text(WATCH_POSITION_TOP_RIGHT, "r1");
-        }
-        else{
-            watch_display_text(WATCH_POSITION_TOP_RIGHT, " 1");
-        }
+    // the era for the displayed year, from the gannen column of the table
+    uint8_t era = WAREKI_ERA_COUNT - 1;
+    while (era > 0 && state->disp_year < _wareki_eras[era].gannen) era--;
+
+    // A gannen year straddles two eras: e.g. 2019 is Heisei 31 through April 30
+    // and Reiwa 1 from May 1. When browsing arbitrary years we show both, but
+    // for the current year, today's epoch day resolves the ambiguity exactly.
+    bool boundary = (era > 0 && state->disp_year == _wareki_eras[era].gannen);
+    if (boundary && state->disp_year == state->real_year) {
+        era = state->today_era;
+        boundary = false;
     }
-    else if(state->disp_year == HEISEI_GANNEN){
-        //The year 1989 could be Showa 64 or it could be Heisei 1.
-        watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "S64", " h");
-
-        if (is_custom_lcd)
-        {
-            //For custom LCDs, display both Showa and Heisei.
-            watch_display_text(WATCH_POSITION_TOP_RIGHT, "h1");
-        }
-        else{
+
+    if (boundary) {
+        //Display both the outgoing era's final year and year 1 of the new era.
+        const wareki_era_t *prev = &_wareki_eras[era - 1];
+        char fallback[4];
+        sprintf(buf, "%c%2d", prev->label[0], (int)(state->disp_year - prev->gannen + 1));
+        sprintf(fallback, " %c", _wareki_eras[era].label_short[0]);
+        watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, buf, fallback);
+        if (is_custom_lcd) {
+            //For custom LCDs, display both eras at once.
+            sprintf(buf, "%c1", _wareki_eras[era].label_short[0]);
+            watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
+        } else {
             watch_display_text(WATCH_POSITION_TOP_RIGHT, " 1");
         }
-    }
-    else if(state->disp_year < HEISEI_GANNEN){
-        //Showa
-        //sprintf(buf, " h%2d%4d  ", (int)state->disp_year - HEISEI_GANNEN + 1, (int)state->disp_year);
-
-        watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "Sho", "s ");
-
-        sprintf(buf, "%2d", (int)state->disp_year - SHOWA_GANNEN + 1);
-        watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
-    }
-    else if(state->disp_year < REIWA_GANNEN){
-        //Heisei
-        //sprintf(buf, " h%2d%4d  ", (int)state->disp_year - HEISEI_GANNEN + 1, (int)state->disp_year);
-
-        watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "HEI", "h ");
-
-        sprintf(buf, "%2d", (int)state->disp_year - HEISEI_GANNEN + 1);
-        watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
-    }
-    else{
-        //Reiwa
-        //sprintf(buf, " r%2d%4d  ", (int)state->disp_year - REIWA_GANNEN + 1 , (int)state->disp_year);
-    
-        watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "REI", "r ");
-
-        sprintf(buf, "%2d", (int)state->disp_year - REIWA_GANNEN + 1);
+    } else {
+        const wareki_era_t *e = &_wareki_eras[era];
+        watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, (char *)e->label, (char *)e->label_short);
+        sprintf(buf, "%2d", (int)(state->disp_year - e->gannen + 1));
         watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
     }
 
@@ -154,6 +164,8 @@ void wareki_activate(void *context) {
     state->real_year = watch_rtc_get_date_time().unit.year + WATCH_RTC_REFERENCE_YEAR;
     state->start_year = state->real_year;
     state->disp_year = state->real_year;
+    //movement caches today's epoch day; looking up the era is two table loads
+    state->today_era = _wareki_era_for_epoch_day(movement_get_local_epoch_day());
 
     movement_request_tick_frequency(1);
 }
@@ -187,6 +199,7 @@ bool wareki_loop(movement_event_t event, void *context) {
     wareki_state_t *state = (wareki_state_t *)context;
 
     state->real_year = watch_rtc_get_date_time().unit.year + WATCH_RTC_REFERENCE_YEAR;
+    state->today_era = _wareki_era_for_epoch_day(movement_get_local_epoch_day());
 
     if( state->real_year != state->start_year ){
         state->start_year = state->real_year;
@@ -54,6 +54,7 @@ typedef struct {
     uint32_t disp_year;     //Current displayed year 
     uint32_t start_year;    //Year when this screen was launched
     uint32_t real_year;     //The actual current year     
+    uint8_t today_era;      //Era index for today's date, resolved by epoch day
 } wareki_state_t;
 
 void wareki_setup(uint8_t watch_face_index, void ** context_ptr);
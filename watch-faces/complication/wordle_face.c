@@ -29,11 +29,18 @@
 #include "watch_common_display.h"
 
 static uint32_t get_random(uint32_t max) {
-    #if __EMSCRIPTEN__
-    return rand() % max;
-    #else
-    return arc4random_uniform(max);
-    #endif
+    return watch_utility_random_uniform(max);
+}
+
+// The dictionary stores 5 bits per letter; see utils/wordle_face/compress_dict.py.
+static char _dict_letter(uint32_t packed_word, size_t position) {
+    return 'A' + ((packed_word >> ((WORDLE_LENGTH - 1 - position) * 5)) & 0x1F);
+}
+
+static void _dict_word(uint32_t packed_word, char *buf) {
+    for (size_t i = 0; i < WORDLE_LENGTH; i++)
+        buf[i] = _dict_letter(packed_word, i);
+    buf[WORDLE_LENGTH] = '\0';
 }
 
 static uint8_t get_first_pos(wordle_letter_result *word_elements_result) {
@@ -111,29 +118,48 @@ static void display_already_guessed(wordle_state_t *state) {
     state->ignore_btn_ticks = WORDLE_TICK_BAD_GUESS;
 }
 
+static uint32_t _dict_read_bits(uint32_t bit_pos, uint8_t count) {
+    uint32_t byte = bit_pos >> 3;
+    uint32_t acc = (uint32_t)_dict_stream[byte]
+                 | ((uint32_t)_dict_stream[byte + 1] << 8)
+                 | ((uint32_t)_dict_stream[byte + 2] << 16)
+                 | ((uint32_t)_dict_stream[byte + 3] << 24);
+    return (acc >> (bit_pos & 7)) & (0xFFFFFFFFul >> (32 - count));
+}
+
+// Binary search the sorted guess dictionary. Returns the word's index in it,
+// or WORDLE_DICT_WORDS if the guess is not a word.
 static uint32_t check_word_in_dict(uint8_t *word_elements) {
-    bool is_exact_match;
-    for (uint16_t i = 0; i < WORDLE_NUM_WORDS; i++) {
-        is_exact_match = true;
-        for (size_t j = 0; j < WORDLE_LENGTH; j++) {
-            if (_valid_letters[word_elements[j]] != _valid_words[i][j]) {
-                is_exact_match = false;
-                break;  
-            }
-        }
-        if (is_exact_match) return i;
+    uint32_t key = 0;
+    for (size_t j = 0; j < WORDLE_LENGTH; j++)
+        key = (key << 5) | (_valid_letters[word_elements[j]] - 'A');
+
+    if (key < _dict_block_first[0]) return WORDLE_DICT_WORDS;
+    uint16_t lo = 0, hi = WORDLE_DICT_BLOCKS - 1;
+    while (lo < hi) {
+        uint16_t mid = (lo + hi + 1) >> 1;
+        if (_dict_block_first[mid] <= key) lo = mid;
+        else hi = mid - 1;
     }
-    for (uint16_t i = 0; i < WORDLE_NUM_POSSIBLE_WORDS; i++) {
-        is_exact_match = true;
-        for (size_t j = 0; j < WORDLE_LENGTH; j++) {
-            if (_valid_letters[word_elements[j]] != _possible_words[i][j]) {
-                is_exact_match = false;
-                break;  
-            }
-        }
-        if (is_exact_match) return WORDLE_NUM_WORDS + i;
+    // decode the block this word would be in: the first word is verbatim,
+    // each later one reuses a prefix of its predecessor
+    uint32_t word = _dict_block_first[lo];
+    if (word == key) return (uint32_t)lo << WORDLE_DICT_BLOCK_SHIFT;
+    uint16_t block_len = (lo == WORDLE_DICT_BLOCKS - 1)
+        ? (WORDLE_DICT_WORDS - (lo << WORDLE_DICT_BLOCK_SHIFT))
+        : (1 << WORDLE_DICT_BLOCK_SHIFT);
+    uint32_t bit_pos = _dict_block_offset[lo];
+    for (uint16_t i = 1; i < block_len; i++) {
+        uint8_t prefix = _dict_read_bits(bit_pos, 3);
+        bit_pos += 3;
+        uint8_t suffix_bits = (WORDLE_LENGTH - prefix) * 5;
+        uint32_t mask = (1ul << suffix_bits) - 1;
+        word = (word & ~mask) | _dict_read_bits(bit_pos, suffix_bits);
+        bit_pos += suffix_bits;
+        if (word == key) return ((uint32_t)lo << WORDLE_DICT_BLOCK_SHIFT) + i;
+        if (word > key) break;
     }
-    return WORDLE_NUM_WORDS + WORDLE_NUM_POSSIBLE_WORDS;
+    return WORDLE_DICT_WORDS;
 }
 #endif
 
@@ -142,7 +168,7 @@ static bool check_word(wordle_state_t *state) {
     bool is_exact_match = true;
     bool answer_already_accounted[WORDLE_LENGTH] = { false };
     for (size_t i = 0; i < WORDLE_LENGTH; i++) {
-        if (_valid_letters[state->word_elements[i]] == _valid_words[state->curr_answer][i]) {
+        if (_valid_letters[state->word_elements[i]] == _dict_letter(_valid_words[state->curr_answer], i)) {
             state->word_elements_result[i] = WORDLE_LETTER_CORRECT;
             answer_already_accounted[i] = true;
         }
@@ -157,7 +183,7 @@ static bool check_word(wordle_state_t *state) {
         if (state->word_elements_result[i] != WORDLE_LETTER_WRONG) continue;
         for (size_t j = 0; j < WORDLE_LENGTH; j++) {
             if (answer_already_accounted[j]) continue;
-            if (_valid_letters[state->word_elements[i]] == _valid_words[state->curr_answer][j]) {
+            if (_valid_letters[state->word_elements[i]] == _dict_letter(_valid_words[state->curr_answer], j)) {
                 state->word_elements_result[i] = WORDLE_LETTER_WRONG_LOC;
                 answer_already_accounted[j] = true;
                 break;
@@ -219,7 +245,7 @@ static void reset_all_elements(wordle_state_t *state) {
     }
 #if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES
     for (size_t i = 0; i < WORDLE_MAX_ATTEMPTS; i++) {
-        state->guessed_words[i] = WORDLE_NUM_WORDS + WORDLE_NUM_POSSIBLE_WORDS;
+        state->guessed_words[i] = WORDLE_DICT_WORDS;
     }
 #endif
     state->using_random_guess = false;
@@ -250,7 +276,9 @@ static void reset_board(wordle_state_t *state) {
     display_playing(state);
     watch_display_character('-', 5);
 #if __EMSCRIPTEN__
-    printf("ANSWER: %s\r\n", _valid_words[state->curr_answer]);
+    char answer[WORDLE_LENGTH + 1];
+    _dict_word(_valid_words[state->curr_answer], answer);
+    printf("ANSWER: %s\r\n", answer);
 #endif
 }
 
@@ -318,9 +346,20 @@ static uint32_t get_day_unix_time(void) {
     return watch_utility_date_time_to_unix_time(now, 0);
 }
 
+// streak plus the day it was last played, packed into the streak store's 24 bits.
+// the day is stored as whole days since the epoch (16 bits reach the year 2149)
+// and comes back as that day's midnight, which is exact for daily-streak mode 2
+// and within a day for mode 1 — close enough for the reset checks either way.
+static void persist_streak(wordle_state_t *state) {
+    game_score_set(&state->streak_store,
+        (uint32_t)state->streak | ((state->day_last_game_started / 86400) & 0xFFFF) << 8);
+}
+
 static void display_lose(wordle_state_t *state, uint8_t subsecond) {
     char buf[10];
-    sprintf(buf," %s", subsecond % 2 ? _valid_words[state->curr_answer] : "     ");
+    char answer[WORDLE_LENGTH + 1];
+    _dict_word(_valid_words[state->curr_answer], answer);
+    sprintf(buf," %s", subsecond % 2 ? answer : "     ");
     watch_display_text(WATCH_POSITION_TOP_RIGHT, "  ");
     watch_display_text_with_fallback(WATCH_POSITION_TOP, "LOSE", "L ");
     watch_display_text(WATCH_POSITION_BOTTOM, buf);
@@ -398,6 +437,7 @@ static bool act_on_btn(wordle_state_t *state, const wordle_pin_enum pin) {
         return true;
     case WORDLE_SCREEN_STREAK:
         state->day_last_game_started = get_day_unix_time();
+        persist_streak(state);
         reset_board(state);
         return true;
     case WORDLE_SCREEN_WIN:
@@ -424,6 +464,7 @@ static bool act_on_btn(wordle_state_t *state, const wordle_pin_enum pin) {
             else {
                 reset_board(state);
                 state->streak = 0;
+                persist_streak(state);
                 display_streak(state);
             }
             break;
@@ -453,7 +494,7 @@ static void get_result(wordle_state_t *state) {
 #if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES
     // Check if it's in the dict
     uint16_t in_dict = check_word_in_dict(state->word_elements);
-    if (in_dict == WORDLE_NUM_WORDS + WORDLE_NUM_POSSIBLE_WORDS) {
+    if (in_dict == WORDLE_DICT_WORDS) {
         display_not_in_dict(state);
         return;
     }
@@ -477,12 +518,14 @@ static void get_result(wordle_state_t *state) {
 #if WORDLE_USE_DAILY_STREAK == 2
         state->day_last_game_started = get_day_unix_time();  // On the edge-case where we solve the puzzle at midnight
 #endif
+        persist_streak(state);
         return;
     }
     if (++state->attempt >= WORDLE_MAX_ATTEMPTS) {
         state->curr_screen = WORDLE_SCREEN_LOSE;
         win_lose_shared(state);
         state->streak = 0;
+        persist_streak(state);
         return;
     }
     update_known_wrong_letters(state);
@@ -500,7 +543,7 @@ static void insert_random_guess(wordle_state_t *state) {
     for (size_t i = 0; i < WORDLE_LENGTH; i++) {
         for (size_t j = 0; j < WORDLE_NUM_VALID_LETTERS; j++)
         {
-            if (_valid_words[random_guess][i] == _valid_letters[j])
+            if (_dict_letter(_valid_words[random_guess], i) == _valid_letters[j])
                 state->word_elements[i] = j;     
         }
     } 
@@ -517,6 +560,7 @@ static void _activate(wordle_state_t *state) {
     if ((WORDLE_USE_DAILY_STREAK == 2 && now >= (state->day_last_game_started + (2*one_day)))
         || (now >= (state->day_last_game_started + one_day) && is_playing(state))) {
         state->streak = 0;
+        persist_streak(state);
         reset_board(state);
     }
 #endif
@@ -534,13 +578,16 @@ static void _activate(wordle_state_t *state) {
 void wordle_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(wordle_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(wordle_state_t));
         memset(*context_ptr, 0, sizeof(wordle_state_t));
         wordle_state_t *state = (wordle_state_t *)*context_ptr;
         state->curr_screen = WORDLE_SCREEN_TITLE;
         state->skip_wrong_letter = true;
         reset_all_elements(state);
         memset(state->not_to_use, 0xff, sizeof(state->not_to_use));
+        uint32_t persisted = game_score_init(&state->streak_store, MOVEMENT_BACKUP_TAG('W', 'R', 'D', 0), "wordle.hs");
+        state->streak = persisted & 0xFF;
+        state->day_last_game_started = ((persisted >> 8) & 0xFFFF) * 86400;
     }
     // Do any pin or peripheral setup here; this will be called whenever the watch wakes from deep sleep.
 }
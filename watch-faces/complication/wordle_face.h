@@ -26,6 +26,7 @@
 #define WORDLE_FACE_H_
 
 #include "movement.h"
+#include "game_score.h"
 
 /*
  * Wordle Face
@@ -94,8 +95,6 @@
 #define WORDLE_MAX_BETWEEN_REPEATS 50
 #include "wordle_face_dict.h"
 
-#define WORDLE_NUM_WORDS (sizeof(_valid_words) / sizeof(_valid_words[0]))
-#define WORDLE_NUM_POSSIBLE_WORDS (sizeof(_possible_words) / sizeof(_possible_words[0]))
 #define WORDLE_NUM_VALID_LETTERS (sizeof(_valid_letters) / sizeof(_valid_letters[0]))
 
 typedef enum {
@@ -141,6 +140,7 @@ typedef struct {
     bool continuing : 1;
     bool skip_wrong_letter : 1;
     uint8_t streak;
+    game_score_t streak_store;
     wordle_screen curr_screen;
     bool known_wrong_letters[WORDLE_NUM_VALID_LETTERS];
     uint32_t day_last_game_started;
@@ -1,6 +1,9 @@
 #ifndef WORDLE_FACE_DICT_H_
 #define WORDLE_FACE_DICT_H_
 
+// Generated by utils/wordle_face/compress_dict.py; do not edit by hand.
+// See that script for the bit-packed dictionary layout.
+
 #ifndef WORDLE_LENGTH
 #define WORDLE_LENGTH 5
 #endif
@@ -11,283 +14,343 @@
 
 static const char _valid_letters[] = {'A', 'C', 'E', 'H', 'I', 'L', 'N', 'O', 'P', 'R', 'S', 'T'};
 
-// From: https://matthewminer.name/projects/calculators/wordle-words-left/
-// Number of words found: 432
-static const char _valid_words[][WORDLE_LENGTH + 1] = {
-    "SLATE", "STARE", "SNARE", "SANER", "CRANE", "STALE", "CRATE", "RAISE", "TRACE", 
-    "SHARE", "ARISE", "SCARE", "SPARE", "CHAOS", "TAPIR", "CAIRN", "TENOR", "CLEAN", 
-    "HEART", "SCOPE", "SNARL", "SLEPT", "SINCE", "EPOCH", "SPACE", "RELIC", "SPOIL", 
-    "LITER", "LEAPT", "LANCE", "RANCH", "HORSE", "LEACH", "LATER", "STEAL", "CHEAP", 
-    "SHORT", "ETHIC", "CHANT", "ACTOR", "REACH", "SEPIA", "ONSET", "SPLAT", "LEANT", 
-    "REACT", "OCTAL", "SPORE", "IRATE", "CORAL", "NICER", "SPILT", "SCENT", "PANIC", 
-    "SHIRT", "PECAN", "SLAIN", "SPLIT", "ROACH", "ASCOT", "PHONE", "LITHE", "STOIC", 
-    "STRIP", "RENAL", "POISE", "ENACT", "CHEAT", "PITCH", "NOISE", "INLET", "PEARL", 
-    "POLAR", "PEACH", "STOLE", "CASTE", "CREST", "CRONE", "ETHOS", "THEIR", "STONE", 
-    "SHIRE", "LATCH", "HASTE", "CLOSE", "SPINE", "SLANT", "SPEAR", "SCALE", "CAPER", 
-    "RETCH", "PESTO", "CHIRP", "SPORT", "OPTIC", "SNAIL", "PRICE", "PLANE", "TORCH", 
-    "PASTE", "RECAP", "SOLAR", "CRASH", "LINER", "OPINE", "ASHEN", "PALER", "ECLAT", 
-    "SPELT", "TRIAL", "PERIL", "SLICE", "SCANT", "SAINT", "POSIT", "ATONE", "SPIRE", 
-    "COAST", "INEPT", "SHOAL", "CLASH", "THORN", "PHASE", "SCORE", "TRICE", "PERCH", 
-    "PORCH", "SHEAR", "CHOIR", "RHINO", "PLANT", "SHONE", "CHORE", "LEARN", "ALTER", 
-    "CHAIN", "PANEL", "PLIER", "STEIN", "COPSE", "SONIC", "ALIEN", "CHOSE", "ACORN", 
-    "ANTIC", "CHEST", "OTHER", "CHINA", "TALON", "SCORN", "PLAIN", "PILOT", "RIPEN", 
-    "PATCH", "SPICE", "CLONE", "SCION", "SCONE", "STRAP", "PARSE", "SHALE", "RISEN", 
-    "CANOE", "INTER", "LEASH", "ISLET", "PRINT", "SHINE", "NORTH", "CLEAT", "PLAIT", 
-    "SCRAP", "CLEAR", "SLOTH", "LAPSE", "CHAIR", "SNORT", "SHARP", "OPERA", "STAIN", 
-    "TEACH", "TRAIL", "TRAIN", "LATHE", "PIANO", "PINCH", "PETAL", "STERN", "PRONE", 
-    "PROSE", "PLEAT", "TROPE", "PLACE", "POSER", "INERT", "CHASE", "CAROL", "STAIR", 
-    "SATIN", "SPITE", "LOATH", "ROAST", "ARSON", "SHAPE", "CLASP", "LOSER", "SALON", 
-    "CATER", "SHALT", "INTRO", "ALERT", "PENAL", "SHORE", "RINSE", "CREPT", "APRON", 
-    "SONAR", "AISLE", "AROSE", "HATER", "NICHE", "POINT", "EARTH", "PINTO", "THOSE", 
-    "CLOTH", "NOTCH", "TOPIC", "RESIN", "SCALP", "HEIST", "HERON", "TRIPE", "TONAL", 
-    "TAPER", "SHORN", "TONIC", "HOIST", "SNORE", "STORE", "SLOPE", "OCEAN", "CHART", 
-    "PAINT", "SPENT", "SNIPE", "CRISP", "TRASH", "PATIO", "PLATE", "HOTEL", "LEAST", 
-    "ALONE", "RALPH", "SPIEL", "SIREN", "RATIO", "STOOP", "TROLL", "ATOLL", "SLASH", 
-    "RETRO", "CREEP", "STILT", "SPREE", "TASTE", "CACHE", "CANON", "EATEN", "TEPEE", 
-    "SHEET", "SNEER", "ERROR", "NATAL", "SLEEP", "STINT", "TROOP", "SHALL", "STALL", 
-    "PIPER", "TOAST", "NASAL", "CORER", "THERE", "POOCH", "SCREE", "ELITE", "ALTAR", 
-    "PENCE", "EATER", "ALPHA", "TENTH", "LINEN", "SHEER", "TAINT", "HEATH", "CRIER", 
-    "TENSE", "CARAT", "CANAL", "APNEA", "THESE", "HATCH", "SHELL", "CIRCA", "APART", 
-    "SPILL", "STEEL", "LOCAL", "STOOL", "SHEEN", "RESET", "STEEP", "ELATE", "PRESS", 
-    "SLEET", "CROSS", "TOTAL", "TREAT", "ONION", "STATE", "CINCH", "ASSET", "THREE", 
-    "TORSO", "SNOOP", "PENNE", "SPOON", "SHEEP", "PAPAL", "STILL", "CHILL", "THETA", 
-    "LEECH", "INNER", "HONOR", "LOOSE", "CONIC", "SCENE", "COACH", "CONCH", "LATTE", 
-    "ERASE", "ESTER", "PEACE", "PASTA", "INANE", "SPOOL", "TEASE", "HARSH", "PIECE", 
-    "STEER", "SCOOP", "NINTH", "OTTER", "OCTET", "EERIE", "RISER", "LAPEL", "HIPPO", 
-    "PREEN", "ETHER", "AORTA", "SENSE", "TRACT", "SHOOT", "SLOOP", "REPEL", "TITHE", 
-    "IONIC", "CELLO", "CHESS", "SOOTH", "COCOA", "TITAN", "TOOTH", "TIARA", "CRESS", 
-    "SLOSH", "RARER", "TERSE", "ERECT", "HELLO", "PARER", "RIPER", "NOOSE", "CREPE", 
-    "CACAO", "ILIAC", "POSSE", "CACTI", "EASEL", "LASSO", "ROOST", "ALLOT", "COLON", 
-    "LEPER", "TEETH", "TITLE", "HENCE", "NIECE", "PAPER", "TRITE", "SPELL", "RACER", 
-    "ATTIC", "CRASS", "HITCH", "LEASE", "CEASE", "ROTOR", "ELOPE", "APPLE", "CHILI", 
-    "START", "PHOTO", "SALSA", "STASH", "PRIOR", "TAROT", "COLOR", "CHEER", "CLASS", 
-    "ARENA", "ELECT", "ENTER", "CATCH", "TENET", "TACIT", "TRAIT", "TERRA", "LILAC", 
+// Answer words, 5 bits per letter (A=0), first letter in the top bits.
+// Original order preserved: the random-guess tiers index into this array.
+#define WORDLE_NUM_WORDS 432
+static const uint32_t _valid_words[WORDLE_NUM_WORDS] = {
+    0x1258264, 0x1298224, 0x1268224, 0x1203491, 0x02881a4, 0x1298164, 0x0288264, 0x1102244,
+    0x1388044, 0x1238224, 0x008a244, 0x1210224, 0x1278224, 0x02381d2, 0x1303d11, 0x020222d,
+    0x13235d1, 0x025900d, 0x0720233, 0x12139e4, 0x126822b, 0x12591f3, 0x1243444, 0x047b847,
+    0x1278044, 0x1122d02, 0x127b90b, 0x0b44c91, 0x0b201f3, 0x0b03444, 0x1103447, 0x0774644,
+    0x0b20047, 0x0b04c91, 0x129900b, 0x023900f, 0x123ba33, 0x0499d02, 0x02381b3, 0x0014dd1,
+    0x1120047, 0x1223d00, 0x0e6c893, 0x127ac13, 0x0b201b3, 0x1120053, 0x0e14c0b, 0x127ba24,
+    0x0888264, 0x027440b, 0x0d40891, 0x127a173, 0x12111b3, 0x0f03502, 0x123a233, 0x0f2080d,
+    0x125810d, 0x127ad13, 0x1170047, 0x00909d3, 0x0f3b9a4, 0x0b44ce4, 0x129b902, 0x129c50f,
+    0x112340b, 0x0f72244, 0x0468053, 0x0239013, 0x0f44c47, 0x0d72244, 0x086ac93, 0x0f2022b,
+    0x0f72c11, 0x0f20047, 0x129b964, 0x0204a64, 0x0289253, 0x028b9a4, 0x0499dd2, 0x1339111,
+    0x129b9a4, 0x123a224, 0x0b04c47, 0x0704a64, 0x025ba44, 0x127a1a4, 0x12581b3, 0x1279011,
+    0x1210164, 0x0203c91, 0x1124c47, 0x0f24a6e, 0x023a22f, 0x127ba33, 0x0e7cd02, 0x126810b,
+    0x0f8a044, 0x0f581a4, 0x1374447, 0x0f04a64, 0x112080f, 0x1272c11, 0x0288247, 0x0b43491,
+    0x0e7a1a4, 0x0091c8d, 0x0f02c91, 0x0412c13, 0x1279173, 0x138a00b, 0x0f2450b, 0x125a044,
+    0x12101b3, 0x12021b3, 0x0f74913, 0x009b9a4, 0x127a224, 0x0270253, 0x08691f3, 0x123b80b,
+    0x0258247, 0x133ba2d, 0x0f38244, 0x1213a24, 0x138a044, 0x0f24447, 0x0f74447, 0x1239011,
+    0x023b911, 0x113a1ae, 0x0f581b3, 0x123b9a4, 0x023ba24, 0x0b2022d, 0x005cc91, 0x023810d,
+    0x0f0348b, 0x0f5a091, 0x129910d, 0x0273e44, 0x1273502, 0x005a08d, 0x023ba44, 0x0013a2d,
+    0x006cd02, 0x0239253, 0x0e99c91, 0x023a1a0, 0x1302dcd, 0x1213a2d, 0x0f5810d, 0x0f42dd3,
+    0x1143c8d, 0x0f04c47, 0x127a044, 0x025b9a4, 0x12121cd, 0x12139a4, 0x129c40f, 0x0f04644,
+    0x1238164, 0x114488d, 0x02035c4, 0x086cc91, 0x0b20247, 0x0892c93, 0x0f8a1b3, 0x123a1a4,
+    0x0d74667, 0x0259013, 0x0f58113, 0x121440f, 0x0259011, 0x125ba67, 0x0b03e44, 0x0238111,
+    0x126ba33, 0x123822f, 0x0e79220, 0x129810d, 0x1320047, 0x138810b, 0x138810d, 0x0b04ce4,
+    0x0f401ae, 0x0f43447, 0x0f24c0b, 0x129922d, 0x0f8b9a4, 0x0f8ba44, 0x0f59013, 0x138b9e4,
+    0x0f58044, 0x0f74891, 0x0869233, 0x0238244, 0x02045cb, 0x1298111, 0x1204d0d, 0x127a264,
+    0x0b70267, 0x1170253, 0x008c9cd, 0x12381e4, 0x025824f, 0x0b74891, 0x1202dcd, 0x0204c91,
+    0x1238173, 0x086ce2e, 0x0059233, 0x0f2340b, 0x123ba24, 0x1143644, 0x02891f3, 0x007c5cd,
+    0x1273411, 0x0044964, 0x008ba44, 0x0704c91, 0x0d408e4, 0x0f721b3, 0x0404667, 0x0f4366e,
+    0x133ba44, 0x025ba67, 0x0d74c47, 0x1373d02, 0x112490d, 0x121016f, 0x0722253, 0x07245cd,
+    0x138a1e4, 0x137340b, 0x1303c91, 0x123ba2d, 0x1373502, 0x0772253, 0x126ba24, 0x129ba24,
+    0x125b9e4, 0x0e1100d, 0x0238233, 0x0f021b3, 0x12791b3, 0x126a1e4, 0x028a24f, 0x1388247,
+    0x0f04d0e, 0x0f58264, 0x0774c8b, 0x0b20253, 0x005b9a4, 0x1102de7, 0x127a08b, 0x124448d,
+    0x1104d0e, 0x129b9cf, 0x138b96b, 0x009b96b, 0x1258247, 0x1124e2e, 0x028908f, 0x129a173,
+    0x127c484, 0x1304a64, 0x02008e4, 0x02035cd, 0x0404c8d, 0x1323c84, 0x1239093, 0x1269091,
+    0x048c5d1, 0x0d04c0b, 0x125908f, 0x129a1b3, 0x138b9cf, 0x123816b, 0x129816b, 0x0f43c91,
+    0x1370253, 0x0d0480b, 0x0274491, 0x1339224, 0x0f73847, 0x1214484, 0x045a264, 0x005cc11,
+    0x0f23444, 0x0404c91, 0x005bce0, 0x1323667, 0x0b4348d, 0x1239091, 0x13021b3, 0x0720267,
+    0x028a091, 0x1323644, 0x0204413, 0x020340b, 0x007b480, 0x1339244, 0x0704c47, 0x123916b,
+    0x0244440, 0x0078233, 0x127a16b, 0x129908b, 0x0b7080b, 0x129b9cb, 0x123908d, 0x1124893,
+    0x129908f, 0x0458264, 0x0f89252, 0x1259093, 0x028ba52, 0x1374c0b, 0x1389013, 0x0e6a1cd,
+    0x1298264, 0x0243447, 0x0094893, 0x133c484, 0x137464e, 0x126b9cf, 0x0f235a4, 0x127b9cd,
+    0x123908f, 0x0f03c0b, 0x129a16b, 0x023a16b, 0x1339260, 0x0b21047, 0x086b491, 0x07735d1,
+    0x0b73a44, 0x0273502, 0x12111a4, 0x0270047, 0x0273447, 0x0b04e64, 0x0488244, 0x0494c91,
+    0x0f20044, 0x0f04a60, 0x08681a4, 0x127b9cb, 0x1320244, 0x0704647, 0x0f41044, 0x1299091,
+    0x12139cf, 0x0d43667, 0x0e9cc91, 0x0e14c93, 0x0424504, 0x1144891, 0x0b03c8b, 0x0743dee,
+    0x0f8908d, 0x0499c91, 0x0074660, 0x1223644, 0x1388053, 0x123b9d3, 0x125b9cf, 0x1123c8b,
+    0x1344ce4, 0x0873502, 0x0222d6e, 0x0239252, 0x1273a67, 0x02709c0, 0x1344c0d, 0x1373a67,
+    0x1340220, 0x0289252, 0x125ba47, 0x1104491, 0x1324644, 0x0489053, 0x0722d6e, 0x0f04491,
+    0x1143c91, 0x0d73a44, 0x02891e4, 0x020080e, 0x085a002, 0x0f74a44, 0x0200a68, 0x040488b,
+    0x0b04a4e, 0x1173a53, 0x005add3, 0x0272dcd, 0x0b23c91, 0x1321267, 0x1344d64, 0x0723444,
+    0x0d41044, 0x0f03c91, 0x138a264, 0x127916b, 0x1100891, 0x009cd02, 0x0288252, 0x0744c47,
+    0x0b20244, 0x0220244, 0x1174dd1, 0x045b9e4, 0x007bd64, 0x023a168, 0x1298233, 0x0f3ba6e,
+    0x1202e40, 0x1298247, 0x0f8a1d1, 0x13045d3, 0x0272dd1, 0x0239091, 0x0258252, 0x00891a0,
+    0x0459053, 0x046cc91, 0x0204c47, 0x1323493, 0x1300913, 0x1388113, 0x1324620, 0x0b42c02,
 };
 
-// These are words that'll never be used, but still need to be in the dictionary for guesses.
-// Number of words found: 1898
-static const char _possible_words[][WORDLE_LENGTH + 1] = {
 #if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES
-    "AALII", "AARTI", "ACAIS", "ACARI", "ACCAS", "ACERS", "ACETA", "ACHAR", "ACHES", 
-    "ACHOO", "ACINI", "ACNES", "ACRES", "ACROS", "ACTIN", "ACTON", "AECIA", "AEONS", 
-    "AERIE", "AEROS", "AESIR", "AHEAP", "AHENT", "AHINT", "AINEE", "AIOLI", "AIRER", 
-    "AIRNS", "AIRTH", "AIRTS", "AITCH", "ALAAP", "ALANE", "ALANS", "ALANT", "ALAPA", 
-    "ALAPS", "ALATE", "ALCOS", "ALECS", "ALEPH", "ALIAS", "ALINE", "ALIST", "ALLEE", 
-    "ALLEL", "ALLIS", "ALOES", "ALOHA", "ALOIN", "ALOOS", "ALTHO", "ALTOS", "ANANA", 
-    "ANATA", "ANCHO", "ANCLE", "ANCON", "ANEAR", "ANELE", "ANENT", "ANILE", "ANILS", 
-    "ANION", "ANISE", "ANLAS", "ANNAL", "ANNAS", "ANNAT", "ANOAS", "ANOLE", "ANSAE", 
-    "ANTAE", "ANTAR", "ANTAS", "ANTES", "ANTIS", "ANTRA", "ANTRE", "APACE", "APERS", 
-    "APERT", "APHIS", "APIAN", "APIOL", "APISH", "APOOP", "APORT", "APPAL", "APPEL", 
-    "APPRO", "APRES", "APSES", "APSIS", "APSOS", "APTER", "ARARS", "ARCHI", "ARCOS", 
-    "AREAE", "AREAL", "AREAR", "AREAS", "ARECA", "AREIC", "ARENE", "AREPA", "ARERE", 
-    "ARETE", "ARETS", "ARETT", "ARHAT", "ARIAS", "ARIEL", "ARILS", "ARIOT", "ARISH", 
-    "ARLES", "ARNAS", "AROHA", "ARPAS", "ARPEN", "ARRAH", "ARRAS", "ARRET", "ARRIS", 
-    "ARSES", "ARSIS", "ARTAL", "ARTEL", "ARTIC", "ARTIS", "ASANA", "ASCON", "ASHES", 
-    "ASHET", "ASPEN", "ASPER", "ASPIC", "ASPIE", "ASPIS", "ASPRO", "ASSAI", "ASSES", 
-    "ASSOT", "ASTER", "ASTIR", "ATAPS", "ATILT", "ATLAS", "ATOCS", "ATRIA", "ATRIP", 
-    "ATTAP", "ATTAR", "CACAS", "CAECA", "CAESE", "CAINS", "CALLA", "CALLS", "CALOS", 
-    "CALPA", "CALPS", "CANEH", "CANER", "CANES", "CANNA", "CANNS", "CANSO", "CANST", 
-    "CANTO", "CANTS", "CAPAS", "CAPES", "CAPHS", "CAPLE", "CAPON", "CAPOS", "CAPOT", 
-    "CAPRI", "CARAP", "CARER", "CARES", "CARET", "CARLE", "CARLS", "CARNS", "CARON", 
-    "CARPI", "CARPS", "CARRS", "CARSE", "CARTA", "CARTE", "CARTS", "CASAS", "CASCO", 
-    "CASES", "CASTS", "CATES", "CECAL", "CEILI", "CEILS", "CELLA", "CELLI", "CELLS", 
-    "CELTS", "CENSE", "CENTO", "CENTS", "CEORL", "CEPES", "CERCI", "CERES", "CERIA", 
-    "CERIC", "CERNE", "CEROC", "CEROS", "CERTS", "CESSE", "CESTA", "CESTI", "CETES", 
-    "CHACE", "CHACO", "CHAIS", "CHALS", "CHANA", "CHAPE", "CHAPS", "CHAPT", "CHARA", 
-    "CHARE", "CHARR", "CHARS", "CHATS", "CHEEP", "CHELA", "CHELP", "CHERE", "CHERT", 
-    "CHETH", "CHIAO", "CHIAS", "CHICA", "CHICH", "CHICO", "CHICS", "CHIEL", "CHILE", 
-    "CHINE", "CHINO", "CHINS", "CHIPS", "CHIRL", "CHIRO", "CHIRR", "CHIRT", "CHITS", 
-    "CHOCO", "CHOCS", "CHOIL", "CHOLA", "CHOLI", "CHOLO", "CHONS", "CHOON", "CHOPS", 
-    "CHOTA", "CHOTT", "CIELS", "CILIA", "CILLS", "CINCT", "CINES", "CIONS", "CIPPI", 
-    "CIRCS", "CIRES", "CIRLS", "CIRRI", "CISCO", "CISTS", "CITAL", "CITER", "CITES", 
-    "CLACH", "CLAES", "CLANS", "CLAPS", "CLAPT", "CLARO", "CLART", "CLAST", "CLATS", 
-    "CLEEP", "CLEPE", "CLEPT", "CLIES", "CLINE", "CLINT", "CLIPE", "CLIPS", "CLIPT", 
-    "CLITS", "CLONS", "CLOOP", "CLOOT", "CLOPS", "CLOTE", "CLOTS", "COACT", "COALA", 
-    "COALS", "COAPT", "COATE", "COATI", "COATS", "COCAS", "COCCI", "COCCO", "COCOS", 
-    "COHEN", "COHOE", "COHOS", "COILS", "COINS", "COIRS", "COITS", "COLAS", "COLES", 
-    "COLIC", "COLIN", "COLLS", "COLTS", "CONES", "CONIA", "CONIN", "CONNE", "CONNS", 
-    "CONTE", "CONTO", "COOCH", "COOEE", "COOER", "COOLS", "COONS", "COOPS", "COOPT", 
-    "COOST", "COOTS", "COPAL", "COPEN", "COPER", "COPES", "COPRA", "CORES", "CORIA", 
-    "CORNI", "CORNO", "CORNS", "CORPS", "CORSE", "CORSO", "COSEC", "COSES", "COSET", 
-    "COSIE", "COSTA", "COSTE", "COSTS", "COTAN", "COTES", "COTHS", "COTTA", "COTTS", 
-    "CRAAL", "CRAIC", "CRANS", "CRAPE", "CRAPS", "CRARE", "CREEL", "CREES", "CRENA", 
-    "CREPS", "CRIAS", "CRIES", "CRINE", "CRIOS", "CRIPE", "CRIPS", "CRISE", "CRITH", 
-    "CRITS", "CROCI", "CROCS", "CRONS", "CROOL", "CROON", "CROPS", "CRORE", "CROST", 
-    "CTENE", "EALES", "EARLS", "EARNS", "EARNT", "EARST", "EASER", "EASES", "EASLE", 
-    "EASTS", "EATHE", "ECHES", "ECHOS", "EISEL", "ELAIN", "ELANS", "ELCHI", "ELINT", 
-    "ELOIN", "ELOPS", "ELPEE", "ELSIN", "ENATE", "ENIAC", "ENLIT", "ENOLS", "ENROL", 
-    "ENTIA", "EORLS", "EOSIN", "EPACT", "EPEES", "EPHAH", "EPHAS", "EPHOR", "EPICS", 
-    "EPOPT", "EPRIS", "ERICA", "ERICS", "ERNES", "EROSE", "ERSES", "ESCAR", "ESCOT", 
-    "ESILE", "ESNES", "ESSES", "ESTOC", "ESTOP", "ESTRO", "ETAPE", "ETATS", "ETENS", 
-    "ETHAL", "ETHNE", "ETICS", "ETNAS", "ETTIN", "ETTLE", "HAARS", "HAETS", "HAHAS", 
-    "HAILS", "HAINS", "HAINT", "HAIRS", "HAITH", "HALAL", "HALER", "HALES", "HALLO", 
-    "HALLS", "HALON", "HALOS", "HALSE", "HALTS", "HANAP", "HANCE", "HANCH", "HANSA", 
-    "HANSE", "HANTS", "HAOLE", "HAPPI", "HARES", "HARLS", "HARNS", "HAROS", "HARPS", 
-    "HARTS", "HASPS", "HASTA", "HATES", "HATHA", "HEALS", "HEAPS", "HEARE", "HEARS", 
-    "HEAST", "HEATS", "HECHT", "HEELS", "HEILS", "HEIRS", "HELES", "HELIO", "HELLS", 
-    "HELOS", "HELOT", "HELPS", "HENCH", "HENNA", "HENTS", "HEPAR", "HERES", "HERLS", 
-    "HERNS", "HEROS", "HERSE", "HESPS", "HESTS", "HETES", "HETHS", "HIANT", "HILAR", 
-    "HILCH", "HILLO", "HILLS", "HILTS", "HINTS", "HIOIS", "HIREE", "HIRER", "HIRES", 
-    "HISTS", "HITHE", "HOARS", "HOAST", "HOERS", "HOISE", "HOLES", "HOLLA", "HOLLO", 
-    "HOLON", "HOLOS", "HOLTS", "HONAN", "HONER", "HONES", "HOOCH", "HOONS", "HOOPS", 
-    "HOORS", "HOOSH", "HOOTS", "HOPER", "HOPES", "HORAH", "HORAL", "HORAS", "HORIS", 
-    "HORNS", "HORST", "HOSEL", "HOSEN", "HOSER", "HOSES", "HOSTA", "HOSTS", "HOTCH", 
-    "HOTEN", "ICERS", "ICHES", "ICHOR", "ICIER", "ICONS", "ICTAL", "ICTIC", "ILEAC", 
-    "ILEAL", "ILIAL", "ILLER", "ILLTH", "INAPT", "INCEL", "INCLE", "INION", "INNIT", 
-    "INSET", "INSPO", "INTEL", "INTIL", "INTIS", "INTRA", "IOTAS", "IPPON", "IRONE", 
-    "IRONS", "ISHES", "ISLES", "ISNAE", "ISSEI", "ISTLE", "ITHER", "LAARI", "LACER", 
-    "LACES", "LACET", "LAERS", "LAHAL", "LAHAR", "LAICH", "LAICS", "LAIRS", "LAITH", 
-    "LALLS", "LANAI", "LANAS", "LANCH", "LANES", "LANTS", "LAPIN", "LAPIS", "LARCH", 
-    "LAREE", "LARES", "LARIS", "LARNS", "LARNT", "LASER", "LASES", "LASSI", "LASTS", 
-    "LATAH", "LATEN", "LATHI", "LATHS", "LEANS", "LEAPS", "LEARE", "LEARS", "LEATS", 
-    "LEEAR", "LEEPS", "LEERS", "LEESE", "LEETS", "LEHRS", "LEIRS", "LEISH", "LENES", 
-    "LENIS", "LENOS", "LENSE", "LENTI", "LENTO", "LEONE", "LEPRA", "LEPTA", "LERES", 
-    "LERPS", "LESES", "LESTS", "LETCH", "LETHE", "LIANA", "LIANE", "LIARS", "LIART", 
-    "LICHI", "LICHT", "LICIT", "LIENS", "LIERS", "LILLS", "LILOS", "LILTS", "LINAC", 
-    "LINCH", "LINES", "LININ", "LINNS", "LINOS", "LINTS", "LIONS", "LIPAS", "LIPES", 
-    "LIPIN", "LIPOS", "LIRAS", "LIROT", "LISLE", "LISPS", "LISTS", "LITAI", "LITAS", 
-    "LITES", "LITHO", "LITHS", "LITRE", "LLANO", "LOACH", "LOANS", "LOAST", "LOCHE", 
-    "LOCHS", "LOCIE", "LOCIS", "LOCOS", "LOESS", "LOHAN", "LOINS", "LOIPE", "LOIRS", 
-    "LOLLS", "LONER", "LOOIE", "LOONS", "LOOPS", "LOOTS", "LOPER", "LOPES", "LORAL", 
-    "LORAN", "LOREL", "LORES", "LORIC", "LORIS", "LOSEL", "LOSEN", "LOSES", "LOTAH", 
-    "LOTAS", "LOTES", "LOTIC", "LOTOS", "LOTSA", "LOTTA", "LOTTE", "LOTTO", "NAANS", 
-    "NACHE", "NACHO", "NACRE", "NAHAL", "NAILS", "NAIRA", "NALAS", "NALLA", "NANAS", 
-    "NANCE", "NANNA", "NANOS", "NAPAS", "NAPES", "NAPOO", "NAPPA", "NAPPE", "NARAS", 
-    "NARCO", "NARCS", "NARES", "NARIC", "NARIS", "NARRE", "NASHI", "NATCH", "NATES", 
-    "NATIS", "NEALS", "NEAPS", "NEARS", "NEATH", "NEATS", "NEELE", "NEEPS", "NEESE", 
-    "NEIST", "NELIS", "NENES", "NEONS", "NEPER", "NEPIT", "NERAL", "NEROL", "NERTS", 
-    "NESTS", "NETES", "NETOP", "NETTS", "NICHT", "NICOL", "NIHIL", "NILLS", "NINER", 
-    "NINES", "NINON", "NIPAS", "NIRLS", "NISEI", "NISSE", "NITER", "NITES", "NITON", 
-    "NITRE", "NITRO", "NOAHS", "NOELS", "NOILS", "NOINT", "NOIRS", "NOLES", "NOLLS", 
-    "NOLOS", "NONAS", "NONCE", "NONES", "NONET", "NONIS", "NOOIT", "NOONS", "NOOPS", 
-    "NOPAL", "NORIA", "NORIS", "NOSER", "NOSES", "NOTAL", "NOTER", "NOTES", "OASES", 
-    "OASIS", "OASTS", "OATEN", "OATER", "OATHS", "OCHER", "OCHES", "OCHRE", "OCREA", 
-    "OCTAN", "OCTAS", "OHIAS", "OHONE", "OILER", "OINTS", "OLEIC", "OLEIN", "OLENT", 
-    "OLEOS", "OLIOS", "OLLAS", "OLLER", "OLLIE", "OLPAE", "OLPES", "ONCER", "ONCES", 
-    "ONCET", "ONERS", "ONTIC", "OONTS", "OORIE", "OOSES", "OPAHS", "OPALS", "OPENS", 
-    "OPEPE", "OPPOS", "OPSIN", "OPTER", "ORACH", "ORALS", "ORANT", "ORATE", "ORCAS", 
-    "ORCIN", "ORIEL", "ORLES", "ORLON", "ORLOP", "ORNIS", "ORPIN", "ORRIS", "ORTHO", 
-    "OSCAR", "OSHAC", "OSIER", "OSSIA", "OSTIA", "OTTAR", "OTTOS", "PAALS", "PAANS", 
-    "PACAS", "PACER", "PACES", "PACHA", "PACOS", "PACTA", "PACTS", "PAEAN", "PAEON", 
-    "PAILS", "PAINS", "PAIRE", "PAIRS", "PAISA", "PAISE", "PALAS", "PALEA", "PALES", 
-    "PALET", "PALIS", "PALLA", "PALLS", "PALPI", "PALPS", "PALSA", "PANCE", "PANES", 
-    "PANNE", "PANNI", "PANTO", "PANTS", "PAOLI", "PAOLO", "PAPAS", "PAPES", "PAPPI", 
-    "PARAE", "PARAS", "PARCH", "PAREN", "PAREO", "PARES", "PARIS", "PARLE", "PAROL", 
-    "PARPS", "PARRA", "PARRS", "PARTI", "PARTS", "PASEO", "PASES", "PASHA", "PASSE", 
-    "PASTS", "PATEN", "PATER", "PATES", "PATHS", "PATIN", "PATTE", "PEALS", "PEANS", 
-    "PEARE", "PEARS", "PEART", "PEASE", "PEATS", "PECHS", "PEECE", "PEELS", "PEENS", 
-    "PEEPE", "PEEPS", "PEERS", "PEINS", "PEISE", "PELAS", "PELES", "PELLS", "PELON", 
-    "PELTA", "PELTS", "PENES", "PENIE", "PENIS", "PENNA", "PENNI", "PENTS", "PEONS", 
-    "PEPLA", "PEPOS", "PEPSI", "PERAI", "PERCE", "PERCS", "PEREA", "PERES", "PERIS", 
-    "PERNS", "PERPS", "PERSE", "PERST", "PERTS", "PESOS", "PESTS", "PETAR", "PETER", 
-    "PETIT", "PETRE", "PETRI", "PETTI", "PETTO", "PHARE", "PHEER", "PHENE", "PHEON", 
-    "PHESE", "PHIAL", "PHISH", "PHOCA", "PHONO", "PHONS", "PHOTS", "PHPHT", "PIANI", 
-    "PIANS", "PICAL", "PICAS", "PICOT", "PICRA", "PIERS", "PIERT", "PIETA", "PIETS", 
-    "PILAE", "PILAO", "PILAR", "PILCH", "PILEA", "PILEI", "PILER", "PILES", "PILIS", 
-    "PILLS", "PINAS", "PINES", "PINNA", "PINON", "PINOT", "PINTA", "PINTS", "PIONS", 
-    "PIPAL", "PIPAS", "PIPES", "PIPET", "PIPIS", "PIPIT", "PIRAI", "PIRLS", "PIRNS", 
-    "PISCO", "PISES", "PISOS", "PISTE", "PITAS", "PITHS", "PITON", "PITOT", "PITTA", 
-    "PLAAS", "PLANS", "PLAPS", "PLASH", "PLAST", "PLATS", "PLATT", "PLEAS", "PLENA", 
-    "PLEON", "PLESH", "PLICA", "PLIES", "PLOAT", "PLOPS", "PLOTS", "POACH", "POEPS", 
-    "POETS", "POLER", "POLES", "POLIO", "POLIS", "POLLS", "POLOS", "POLTS", "PONCE", 
-    "PONES", "PONTS", "POOHS", "POOLS", "POONS", "POOPS", "POORI", "POORT", "POOTS", 
-    "POPES", "POPPA", "PORAE", "PORAL", "PORER", "PORES", "PORIN", "PORNO", "PORNS", 
-    "PORTA", "PORTS", "POSES", "POSHO", "POSTS", "POTAE", "POTCH", "POTES", "POTIN", 
-    "POTOO", "POTTO", "POTTS", "PRANA", "PRAOS", "PRASE", "PRATE", "PRATS", "PRATT", 
-    "PREES", "PRENT", "PREON", "PREOP", "PREPS", "PRESA", "PRESE", "PREST", "PRIAL", 
-    "PRIER", "PRIES", "PRILL", "PRION", "PRISE", "PRISS", "PROAS", "PROIN", "PROLE", 
-    "PROLL", "PROPS", "PRORE", "PROSO", "PROSS", "PROST", "PROTO", "PSION", "PSOAE", 
-    "PSOAI", "PSOAS", "PSORA", "RACES", "RACHE", "RACON", "RAIAS", "RAILE", "RAILS", 
-    "RAINE", "RAINS", "RAITA", "RAITS", "RALES", "RANAS", "RANCE", "RANEE", "RANIS", 
-    "RANTS", "RAPER", "RAPES", "RAPHE", "RAPPE", "RAREE", "RARES", "RASER", "RASES", 
-    "RASPS", "RASSE", "RASTA", "RATAL", "RATAN", "RATAS", "RATCH", "RATEL", "RATER", 
-    "RATES", "RATHA", "RATHE", "RATHS", "RATOO", "RATOS", "REAIS", "REALO", "REALS", 
-    "REANS", "REAPS", "REARS", "REAST", "REATA", "REATE", "RECAL", "RECCE", "RECCO", 
-    "RECIT", "RECON", "RECTA", "RECTI", "RECTO", "REECH", "REELS", "REENS", "REEST", 
-    "REINS", "REIST", "RELET", "RELIE", "RELIT", "RELLO", "RENIN", "RENNE", "RENOS", 
-    "RENTE", "RENTS", "REOIL", "REPIN", "REPLA", "REPOS", "REPOT", "REPPS", "REPRO", 
-    "RERAN", "RESAT", "RESEE", "RESES", "RESIT", "RESTO", "RESTS", "RETIA", "RETIE", 
-    "RHEAS", "RHIES", "RHINE", "RHONE", "RIALS", "RIANT", "RIATA", "RICER", "RICES", 
-    "RICHT", "RICIN", "RIELS", "RILES", "RILLE", "RILLS", "RINES", "RIOTS", "RIPES", 
-    "RIPPS", "RISES", "RISHI", "RISPS", "RITES", "RITTS", "ROANS", "ROARS", "ROATE", 
-    "ROHES", "ROILS", "ROINS", "ROIST", "ROLES", "ROLLS", "RONEO", "RONES", "RONIN", 
-    "RONNE", "RONTE", "RONTS", "ROONS", "ROOPS", "ROOSA", "ROOSE", "ROOTS", "ROPER", 
-    "ROPES", "RORAL", "RORES", "RORIC", "RORIE", "RORTS", "ROSES", "ROSET", "ROSHI", 
-    "ROSIN", "ROSIT", "ROSTI", "ROSTS", "ROTAL", "ROTAN", "ROTAS", "ROTCH", "ROTES", 
-    "ROTIS", "ROTLS", "ROTON", "ROTOS", "ROTTE", "SACRA", "SAICE", "SAICS", "SAILS", 
-    "SAINE", "SAINS", "SAIRS", "SAIST", "SAITH", "SALAL", "SALAT", "SALEP", "SALES", 
-    "SALET", "SALIC", "SALLE", "SALOL", "SALOP", "SALPA", "SALPS", "SALSE", "SALTO", 
-    "SALTS", "SANES", "SANSA", "SANTO", "SANTS", "SAOLA", "SAPAN", "SAPOR", "SARAN", 
-    "SAREE", "SARIN", "SARIS", "SAROS", "SASER", "SASIN", "SASSE", "SATAI", "SATES", 
-    "SATIS", "SCAIL", "SCALA", "SCALL", "SCANS", "SCAPA", "SCAPE", "SCAPI", "SCARP", 
-    "SCARS", "SCART", "SCATH", "SCATS", "SCATT", "SCEAT", "SCENA", "SCOOT", "SCOPA", 
-    "SCOPS", "SCOTS", "SCRAE", "SCRAN", "SCRAT", "SCRIP", "SEALS", "SEANS", "SEARE", 
-    "SEARS", "SEASE", "SEATS", "SECCO", "SECHS", "SECTS", "SEELS", "SEEPS", "SEERS", 
-    "SEHRI", "SEILS", "SEINE", "SEIRS", "SEISE", "SELAH", "SELES", "SELLA", "SELLE", 
-    "SELLS", "SENAS", "SENES", "SENNA", "SENOR", "SENSA", "SENSI", "SENTE", "SENTI", 
-    "SENTS", "SEPAL", "SEPIC", "SEPTA", "SEPTS", "SERAC", "SERAI", "SERAL", "SERER", 
-    "SERES", "SERIC", "SERIN", "SERON", "SERRA", "SERRE", "SERRS", "SESSA", "SETAE", 
-    "SETAL", "SETON", "SETTS", "SHAHS", "SHANS", "SHAPS", "SHARN", "SHASH", "SHCHI", 
-    "SHEAL", "SHEAS", "SHEEL", "SHENT", "SHEOL", "SHERE", "SHERO", "SHETS", "SHIAI", 
-    "SHIEL", "SHIER", "SHIES", "SHILL", "SHINS", "SHIPS", "SHIRR", "SHIRS", "SHISH", 
-    "SHISO", "SHIST", "SHITE", "SHITS", "SHLEP", "SHOAT", "SHOER", "SHOES", "SHOLA", 
-    "SHOOL", "SHOON", "SHOOS", "SHOPE", "SHOPS", "SHORL", "SHOTE", "SHOTS", "SHOTT", 
-    "SHRIS", "SIALS", "SICES", "SICHT", "SIENS", "SIENT", "SIETH", "SILEN", "SILER", 
-    "SILES", "SILLS", "SILOS", "SILTS", "SINES", "SINHS", "SIPES", "SIREE", "SIRES", 
-    "SIRIH", "SIRIS", "SIROC", "SIRRA", "SISAL", "SISES", "SISTA", "SISTS", "SITAR", 
-    "SITES", "SITHE", "SLAES", "SLANE", "SLAPS", "SLART", "SLATS", "SLEER", "SLIER", 
-    "SLIPE", "SLIPS", "SLIPT", "SLISH", "SLITS", "SLOAN", "SLOES", "SLOOT", "SLOPS", 
-    "SLOTS", "SNAPS", "SNARS", "SNASH", "SNATH", "SNEAP", "SNEES", "SNELL", "SNIES", 
-    "SNIPS", "SNIRT", "SNITS", "SNOEP", "SNOOL", "SNOOT", "SNOTS", "SOAPS", "SOARE", 
-    "SOARS", "SOCAS", "SOCES", "SOCLE", "SOILS", "SOLAH", "SOLAN", "SOLAS", "SOLEI", 
-    "SOLER", "SOLES", "SOLON", "SOLOS", "SONCE", "SONES", "SONNE", "SONSE", "SOOLE", 
-    "SOOLS", "SOOPS", "SOOTE", "SOOTS", "SOPHS", "SOPOR", "SOPRA", "SORAL", "SORAS", 
-    "SOREE", "SOREL", "SORER", "SORES", "SORNS", "SORRA", "SORTA", "SORTS", "SOTHS", 
-    "SOTOL", "SPAER", "SPAES", "SPAHI", "SPAIL", "SPAIN", "SPAIT", "SPALE", "SPALL", 
-    "SPALT", "SPANE", "SPANS", "SPARS", "SPART", "SPATE", "SPATS", "SPEAL", "SPEAN", 
-    "SPEAT", "SPECS", "SPECT", "SPEEL", "SPEER", "SPEIL", "SPEIR", "SPEOS", "SPETS", 
-    "SPIAL", "SPICA", "SPICS", "SPIER", "SPIES", "SPILE", "SPINA", "SPINS", "SPIRT", 
-    "SPITS", "SPOOR", "SPOOT", "SPOSH", "SPOTS", "SPRAT", "SPRIT", "STANE", "STAPH", 
-    "STAPS", "STARN", "STARR", "STARS", "STATS", "STEAN", "STEAR", "STEEN", "STEIL", 
-    "STELA", "STELE", "STELL", "STENO", "STENS", "STENT", "STEPS", "STEPT", "STERE", 
-    "STETS", "STICH", "STIES", "STILE", "STIPA", "STIPE", "STIRE", "STIRP", "STIRS", 
-    "STOAE", "STOAI", "STOAS", "STOAT", "STOEP", "STOIT", "STOLN", "STONN", "STOOR", 
-    "STOPE", "STOPS", "STOPT", "STOSS", "STOTS", "STOTT", "STRAE", "STREP", "STRIA", 
-    "STROP", "TAALS", "TAATA", "TACAN", "TACES", "TACET", "TACHE", "TACHO", "TACHS", 
-    "TACOS", "TACTS", "TAELS", "TAHAS", "TAHRS", "TAILS", "TAINS", "TAIRA", "TAISH", 
-    "TAITS", "TALAR", "TALAS", "TALCS", "TALEA", "TALER", "TALES", "TALLS", "TALPA", 
-    "TANAS", "TANHS", "TANNA", "TANTI", "TANTO", "TAPAS", "TAPEN", "TAPES", "TAPET", 
-    "TAPIS", "TAPPA", "TARAS", "TARES", "TARNS", "TAROC", "TAROS", "TARPS", "TARRE", 
-    "TARSI", "TARTS", "TASAR", "TASER", "TASES", "TASSA", "TASSE", "TASSO", "TATAR", 
-    "TATER", "TATES", "TATHS", "TATIE", "TATTS", "TEALS", "TEARS", "TEATS", "TECHS", 
-    "TECTA", "TEELS", "TEENE", "TEENS", "TEERS", "TEHRS", "TEILS", "TEINS", "TELAE", 
-    "TELCO", "TELES", "TELIA", "TELIC", "TELLS", "TELOI", "TELOS", "TENCH", "TENES", 
-    "TENIA", "TENNE", "TENNO", "TENON", "TENTS", "TEPAL", "TEPAS", "TERAI", "TERAS", 
-    "TERCE", "TERES", "TERNE", "TERNS", "TERTS", "TESLA", "TESTA", "TESTE", "TESTS", 
-    "TETES", "TETHS", "TETRA", "TETRI", "THALE", "THALI", "THANA", "THANE", "THANS", 
-    "THARS", "THECA", "THEES", "THEIC", "THEIN", "THENS", "THESP", "THETE", "THILL", 
-    "THINE", "THINS", "THIOL", "THIRL", "THOLE", "THOLI", "THORO", "THORP", "THRAE", 
-    "THRIP", "THROE", "TIANS", "TIARS", "TICAL", "TICCA", "TICES", "TIERS", "TILER", 
-    "TILES", "TILLS", "TILTH", "TILTS", "TINAS", "TINCT", "TINEA", "TINES", "TINTS", 
-    "TIPIS", "TIRES", "TIRLS", "TIROS", "TIRRS", "TITCH", "TITER", "TITIS", "TITRE", 
-    "TOCOS", "TOEAS", "TOHOS", "TOILE", "TOILS", "TOISE", "TOITS", "TOLAN", "TOLAR", 
-    "TOLAS", "TOLES", "TOLLS", "TOLTS", "TONER", "TONES", "TONNE", "TOOLS", "TOONS", 
-    "TOOTS", "TOPEE", "TOPER", "TOPES", "TOPHE", "TOPHI", "TOPHS", "TOPIS", "TOPOI", 
-    "TOPOS", "TORAH", "TORAN", "TORAS", "TORCS", "TORES", "TORIC", "TORII", "TOROS", 
-    "TOROT", "TORRS", "TORSE", "TORSI", "TORTA", "TORTE", "TORTS", "TOSAS", "TOSES", 
-    "TOTER", "TOTES", "TRANS", "TRANT", "TRAPE", "TRAPS", "TRAPT", "TRASS", "TRATS", 
-    "TRATT", "TREEN", "TREES", "TRESS", "TREST", "TRETS", "TRIAC", "TRIER", "TRIES", 
-    "TRILL", "TRINE", "TRINS", "TRIOL", "TRIOR", "TRIOS", "TRIPS", "TRIST", "TROAT", 
-    "TROIS", "TRONA", "TRONC", "TRONE", "TRONS", "TROTH", "TROTS", "TSARS", 
-#endif
+// Every accepted guess (answers included), sorted. The first word of each
+// 16-word block is stored verbatim below and binary searched; the rest are
+// front-coded in _dict_stream as 3 bits of shared-prefix length plus
+// 5 bits per remaining letter, least significant bit first.
+#define WORDLE_DICT_WORDS 2330
+#define WORDLE_DICT_BLOCK_SHIFT 4
+#define WORDLE_DICT_BLOCKS 146
+static const uint32_t _dict_block_first[WORDLE_DICT_BLOCKS] = {
+    0x0002d08, 0x0014dcd, 0x0044964, 0x005a253, 0x0068260, 0x006b964, 0x007a00d, 0x0088232,
+    0x0089c13, 0x008c512, 0x0093d02, 0x009c500, 0x0202de0, 0x0203c92, 0x02045cd, 0x0220244,
+    0x0224500, 0x02381a0, 0x0239091, 0x023a168, 0x023b911, 0x0243492, 0x02581f2, 0x025a1a4,
+    0x0270053, 0x0272172, 0x027350d, 0x0273c91, 0x0274893, 0x0288224, 0x028a1a4, 0x028ba52,
+    0x0404ce4, 0x045bc84, 0x0479dd1, 0x0493492, 0x049cd0d, 0x0702dd2, 0x0704647, 0x0720272,
+    0x0723672, 0x0742d72, 0x0772c92, 0x0773c91, 0x0774c8b, 0x08681f3, 0x086ce2e, 0x0b00892,
+    0x0b03c8b, 0x0b04c47, 0x0b20247, 0x0b23668, 0x0b408e8, 0x0b435d2, 0x0b44ce4, 0x0b71c0d,
+    0x0b74492, 0x0d001b2, 0x0d03de0, 0x0d201f2, 0x0d24a72, 0x0d44572, 0x0d72dd2, 0x0d74c0b,
+    0x0e14c0d, 0x0e5bc92, 0x0e7a1a4, 0x0e8bd0d, 0x0f00892, 0x0f02c91, 0x0f03672, 0x0f04564,
+    0x0f04c8d, 0x0f20272, 0x0f22e72, 0x0f24447, 0x0f24c91, 0x0f3b9ae, 0x0f41272, 0x0f435cd,
+    0x0f4484e, 0x0f581b3, 0x0f5b9f2, 0x0f73492, 0x0f74492, 0x0f74dce, 0x0f89244, 0x0f8b96b,
+    0x11008e4, 0x1103512, 0x1104c12, 0x11201b2, 0x1121172, 0x112390b, 0x1124a72, 0x114090d,
+    0x11449f2, 0x117350d, 0x1174672, 0x1174dd1, 0x1202c92, 0x120366e, 0x1204d12, 0x1210272,
+    0x1214404, 0x12211f2, 0x1223640, 0x1224502, 0x12381e4, 0x12391b3, 0x123a233, 0x123b9d3,
+    0x1241267, 0x12445c2, 0x1258264, 0x125b9d3, 0x126916b, 0x1270812, 0x1273502, 0x1274491,
+    0x127816b, 0x1279091, 0x127a16b, 0x127ba24, 0x1298231, 0x1299164, 0x129a1e0, 0x129b9cb,
+    0x1300172, 0x13021b3, 0x1303668, 0x13045f2, 0x1304e72, 0x1322c04, 0x1323644, 0x1324a60,
+    0x133910d, 0x133ba2e, 0x1342d72, 0x1344ce4, 0x1372d72, 0x1373cf2, 0x1374644, 0x13881b2,
+    0x138a00b, 0x138b96b,
+};
+static const uint16_t _dict_block_offset[WORDLE_DICT_BLOCKS] = {
+        0,   250,   495,   705,   925,  1135,  1345,  1570,  1745,  1960,  2165,  2380,
+     2590,  2760,  2930,  3110,  3315,  3500,  3660,  3825,  3980,  4175,  4395,  4560,
+     4735,  4910,  5100,  5285,  5460,  5645,  5815,  5985,  6195,  6450,  6715,  6975,
+     7205,  7420,  7625,  7820,  8025,  8250,  8480,  8670,  8840,  9085,  9305,  9590,
+     9785,  9970, 10140, 10350, 10565, 10760, 10970, 11175, 11390, 11560, 11780, 11985,
+    12210, 12435, 12655, 12860, 13085, 13325, 13575, 13810, 14080, 14270, 14440, 14615,
+    14795, 14965, 15175, 15375, 15550, 15760, 15950, 16130, 16305, 16500, 16685, 16900,
+    17100, 17290, 17475, 17655, 17850, 18040, 18230, 18400, 18580, 18775, 18965, 19185,
+    19385, 19610, 19795, 19975, 20170, 20335, 20545, 20705, 20880, 21075, 21280, 21440,
+    21625, 21785, 21955, 22125, 22310, 22500, 22705, 22890, 23075, 23265, 23445, 23630,
+    23815, 23970, 24140, 24305, 24490, 24645, 24810, 24965, 25130, 25330, 25520, 25690,
+    25875, 26095, 26270, 26460, 26645, 26825, 27035, 27240, 27455, 27640, 27805, 27980,
+    28150, 28325,
+};
+static const uint8_t _dict_stream[3557] = {
+    0x42, 0x33, 0x46, 0x22, 0x20, 0x86, 0xa2, 0x24, 0x10, 0x92, 0x91, 0x0c, 0x4c, 0x45, 0x70, 0x26,
+    0xc9, 0x9c, 0x13, 0x6a, 0x48, 0x92, 0x34, 0xb5, 0xe8, 0x24, 0x49, 0x9c, 0x74, 0x6a, 0x68, 0x32,
+    0x06, 0x20, 0x41, 0x24, 0x9b, 0x13, 0x41, 0x71, 0xd2, 0x29, 0x22, 0x99, 0x07, 0xc8, 0xd9, 0x6c,
+    0x9a, 0x0d, 0x85, 0x90, 0x86, 0x84, 0x96, 0x53, 0x24, 0x71, 0xb2, 0xed, 0x4c, 0x4a, 0x1d, 0x31,
+    0xf3, 0x00, 0x58, 0x23, 0x8d, 0x92, 0x73, 0xe0, 0x51, 0x8e, 0x4c, 0x49, 0x27, 0x24, 0x05, 0xd9,
+    0x79, 0x9b, 0x51, 0x12, 0xa0, 0x35, 0x32, 0xd2, 0x44, 0xc8, 0xe2, 0x9a, 0x44, 0x9b, 0x4e, 0x92,
+    0xb8, 0x81, 0xb3, 0x86, 0x46, 0xda, 0xa4, 0x13, 0x38, 0x4f, 0x11, 0xcc, 0x45, 0x32, 0x77, 0x26,
+    0x5d, 0x40, 0x03, 0x4d, 0xee, 0x88, 0x91, 0xb5, 0xe6, 0x14, 0x01, 0x19, 0x59, 0x9b, 0x4d, 0x64,
+    0x21, 0xca, 0x35, 0x37, 0x22, 0x25, 0xc1, 0xd2, 0x02, 0x8d, 0x92, 0x53, 0x12, 0x38, 0x11, 0x20,
+    0x45, 0xc0, 0x64, 0xa4, 0x9c, 0x24, 0x13, 0x88, 0x72, 0x20, 0x92, 0x04, 0xcc, 0xe8, 0x42, 0x04,
+    0x78, 0x9b, 0x51, 0x32, 0x12, 0x4e, 0x49, 0x74, 0xb6, 0xdc, 0x8e, 0x14, 0x20, 0x4d, 0xcf, 0xb9,
+    0xcd, 0xa8, 0x05, 0xde, 0x16, 0x19, 0x59, 0x73, 0x51, 0x92, 0xc4, 0x35, 0x27, 0x49, 0xe4, 0x24,
+    0x9a, 0x74, 0x8a, 0x64, 0x0a, 0x1d, 0x31, 0xe9, 0x44, 0x00, 0xe1, 0x62, 0xa4, 0x1c, 0x10, 0x13,
+    0x68, 0xa0, 0x91, 0x0c, 0xbc, 0x91, 0x38, 0x32, 0x29, 0x39, 0x25, 0x01, 0xda, 0x22, 0x93, 0x6b,
+    0xd3, 0x8d, 0x48, 0x1e, 0x49, 0xb2, 0x24, 0x41, 0x13, 0x38, 0x6e, 0x44, 0x4a, 0x82, 0xb7, 0x46,
+    0x74, 0x40, 0xa4, 0xdc, 0x24, 0x92, 0x44, 0x4e, 0xa2, 0x35, 0xa7, 0x05, 0xe6, 0x16, 0x99, 0x40,
+    0x94, 0x01, 0x0d, 0x48, 0x35, 0x27, 0x38, 0xd5, 0xc8, 0xa1, 0xe4, 0x54, 0x23, 0x8f, 0x91, 0x84,
+    0x72, 0x2e, 0x0a, 0x01, 0x39, 0x49, 0x38, 0x37, 0x9d, 0x22, 0x99, 0x8b, 0x28, 0xf2, 0x81, 0xa9,
+    0xb9, 0x90, 0x24, 0x58, 0x92, 0xc2, 0x6d, 0xad, 0x91, 0xc6, 0xa7, 0x07, 0x26, 0xe3, 0x04, 0x82,
+    0x03, 0x02, 0x08, 0xca, 0x91, 0x33, 0x34, 0x05, 0x04, 0x19, 0x91, 0x92, 0x0d, 0xad, 0x45, 0x81,
+    0xb5, 0x28, 0x27, 0x1d, 0xa5, 0x16, 0x68, 0x3b, 0x84, 0x91, 0x72, 0xa0, 0x51, 0x8e, 0x38, 0xb6,
+    0x39, 0xc9, 0x39, 0x37, 0x29, 0x25, 0xc1, 0x5b, 0x24, 0x93, 0x67, 0x64, 0xad, 0x39, 0x4a, 0xce,
+    0xa1, 0xa8, 0x07, 0x22, 0xe7, 0x22, 0xa1, 0xe4, 0x1c, 0x59, 0x94, 0x93, 0x6d, 0xcb, 0x0d, 0x3d,
+    0xca, 0xc9, 0x38, 0x22, 0x07, 0x26, 0x09, 0xa5, 0x24, 0x90, 0x73, 0x62, 0x92, 0x8c, 0x4c, 0x4a,
+    0x1d, 0x31, 0x17, 0x09, 0xa5, 0x16, 0x10, 0x42, 0x0b, 0x51, 0x0a, 0xac, 0x45, 0x44, 0x47, 0x39,
+    0x39, 0x45, 0x64, 0x9b, 0x9b, 0x94, 0x5a, 0xd1, 0x49, 0x92, 0x27, 0x24, 0xe2, 0x24, 0xa1, 0x18,
+    0x69, 0x13, 0x8e, 0x72, 0x72, 0x8a, 0x48, 0x39, 0x30, 0x89, 0x24, 0xc9, 0x0c, 0x11, 0xe0, 0xd0,
+    0xad, 0x21, 0x46, 0xca, 0xc9, 0xc5, 0x39, 0xe9, 0x46, 0x1e, 0x25, 0xe7, 0x40, 0x24, 0x61, 0xa4,
+    0xe4, 0x1c, 0x91, 0x93, 0x53, 0x0f, 0x10, 0xce, 0x3d, 0x32, 0xb0, 0xf8, 0x46, 0x22, 0xe7, 0xa4,
+    0xe4, 0xdc, 0x99, 0x72, 0x00, 0x51, 0x0e, 0x08, 0x1e, 0x3a, 0xca, 0x2d, 0x32, 0xb2, 0xb8, 0x06,
+    0x1a, 0x09, 0x1d, 0xe5, 0xe4, 0xdb, 0x8a, 0x74, 0x7c, 0x8c, 0x9c, 0x93, 0x53, 0x4e, 0x38, 0xca,
+    0x2d, 0x34, 0xb0, 0x88, 0xe8, 0x26, 0xdb, 0x9a, 0x9b, 0x7c, 0x23, 0x71, 0x44, 0x0e, 0x4c, 0xce,
+    0xc8, 0x45, 0x90, 0x00, 0x5a, 0x93, 0x4b, 0x47, 0x34, 0x4e, 0xc9, 0xe6, 0x84, 0xde, 0x13, 0x10,
+    0x91, 0x72, 0x92, 0x4c, 0xae, 0xa1, 0x28, 0x27, 0xe4, 0xe4, 0xd4, 0x02, 0x73, 0x91, 0x50, 0xe6,
+    0x08, 0xb0, 0x26, 0xc9, 0x64, 0xe3, 0x9c, 0x8b, 0x9c, 0x3b, 0x92, 0x8f, 0x92, 0x73, 0x72, 0xaa,
+    0x01, 0xc2, 0xc8, 0xb9, 0x47, 0x46, 0x1e, 0xa7, 0x24, 0x41, 0x9c, 0x23, 0x8f, 0x92, 0x73, 0x72,
+    0x8a, 0x34, 0x47, 0xb9, 0xe7, 0x38, 0x27, 0xdf, 0x88, 0x1c, 0x99, 0x3c, 0x94, 0x39, 0x02, 0xb8,
+    0x81, 0x45, 0xb9, 0xf9, 0x36, 0xe5, 0xc8, 0x24, 0xa2, 0x94, 0x04, 0x62, 0x48, 0xd0, 0x0d, 0x38,
+    0x4a, 0x35, 0x72, 0x46, 0x1c, 0xe5, 0x64, 0x9b, 0x8c, 0x93, 0x53, 0x12, 0xac, 0x49, 0x32, 0x81,
+    0xd8, 0x26, 0xd7, 0x9a, 0x63, 0x9c, 0x9c, 0x3a, 0xa2, 0x4d, 0x92, 0x01, 0x44, 0x31, 0xd2, 0x28,
+    0x47, 0x26, 0x9d, 0x8e, 0x70, 0x23, 0x84, 0x71, 0x72, 0x4d, 0xb6, 0xc9, 0xc7, 0xb9, 0x29, 0x27,
+    0xa7, 0x16, 0x78, 0x6b, 0x84, 0x72, 0x20, 0x8e, 0x48, 0x2d, 0x10, 0x17, 0x09, 0xe5, 0x00, 0x1a,
+    0x6a, 0x74, 0x94, 0x93, 0x6f, 0x44, 0xd2, 0x49, 0x10, 0x49, 0x39, 0x82, 0x06, 0x26, 0x09, 0xa5,
+    0x1a, 0x98, 0x93, 0x64, 0xf2, 0x0c, 0x4c, 0xca, 0x2c, 0x00, 0xe2, 0x04, 0x1a, 0x69, 0x94, 0x23,
+    0x8f, 0x72, 0x47, 0x52, 0x8e, 0x4c, 0x2d, 0x42, 0xf8, 0x28, 0x07, 0xda, 0xc8, 0xa3, 0xe4, 0x9c,
+    0x94, 0x9c, 0x92, 0x00, 0x2d, 0x12, 0xca, 0x49, 0x37, 0xf2, 0x28, 0x47, 0x24, 0xdf, 0xce, 0xa4,
+    0x14, 0x12, 0x8e, 0x72, 0xa4, 0x51, 0x6e, 0x39, 0xb6, 0xc9, 0x37, 0x12, 0x39, 0x43, 0x1a, 0x99,
+    0x90, 0x64, 0x01, 0x22, 0xb9, 0xe2, 0x64, 0xe3, 0xdc, 0x94, 0x3b, 0x53, 0x8b, 0x48, 0x46, 0xca,
+    0x91, 0x35, 0x39, 0xd5, 0xc8, 0x64, 0x8c, 0x24, 0x47, 0x4c, 0x3a, 0x4d, 0xb0, 0x42, 0x50, 0x24,
+    0x59, 0x44, 0xa2, 0x34, 0x04, 0xd6, 0x64, 0x1b, 0x99, 0x42, 0x47, 0x68, 0x0a, 0xa2, 0xd9, 0xd0,
+    0xc8, 0x54, 0x43, 0x6e, 0xe4, 0x51, 0xaa, 0x21, 0x99, 0x29, 0x40, 0x1b, 0x99, 0x12, 0x00, 0x69,
+    0xa2, 0x25, 0xb9, 0x9c, 0x96, 0x8b, 0x8a, 0x64, 0x0e, 0xa0, 0xc8, 0x15, 0x9d, 0x1a, 0x92, 0x99,
+    0x02, 0x3c, 0x49, 0x42, 0x74, 0xc0, 0xa1, 0x94, 0x14, 0x48, 0x47, 0xb8, 0xcd, 0x27, 0x89, 0x62,
+    0x88, 0x04, 0x51, 0x53, 0x10, 0x01, 0x81, 0x28, 0x25, 0x49, 0x13, 0x91, 0x4e, 0xd1, 0x45, 0x49,
+    0x22, 0x13, 0x81, 0x90, 0x9b, 0x4e, 0x64, 0x21, 0x49, 0x22, 0x15, 0xc9, 0x9c, 0x70, 0x7c, 0x73,
+    0x31, 0xe4, 0x81, 0x39, 0x39, 0x25, 0x1b, 0xd1, 0x02, 0x67, 0x91, 0x4c, 0xa0, 0x91, 0x36, 0xe9,
+    0x24, 0x05, 0x92, 0x04, 0x6d, 0x64, 0x41, 0x46, 0x00, 0x8e, 0xe4, 0x24, 0x92, 0xe0, 0x48, 0x2e,
+    0x34, 0xd9, 0x38, 0x27, 0xe3, 0xce, 0xd4, 0x02, 0x6b, 0x91, 0x50, 0xce, 0x2d, 0xca, 0x35, 0x37,
+    0x22, 0x27, 0xa7, 0x1e, 0x68, 0x23, 0x82, 0x67, 0x40, 0x92, 0x4c, 0x4e, 0x91, 0xe5, 0x84, 0xde,
+    0x93, 0x24, 0x71, 0x72, 0x4d, 0xb6, 0x49, 0x37, 0xf9, 0x26, 0xa7, 0xe4, 0x93, 0x03, 0x93, 0x44,
+    0x47, 0xcc, 0x45, 0x42, 0x39, 0x70, 0x22, 0x17, 0x20, 0x93, 0x6f, 0x24, 0x52, 0x72, 0x6e, 0xca,
+    0x9d, 0xa9, 0x79, 0x84, 0xe4, 0x22, 0x92, 0x0b, 0x4d, 0xc6, 0x4d, 0x29, 0x49, 0xd6, 0x1c, 0x9a,
+    0x5b, 0x94, 0x93, 0x8e, 0x73, 0xf2, 0x89, 0x88, 0xc6, 0x33, 0xd0, 0x14, 0xc1, 0x93, 0x24, 0x71,
+    0x72, 0x4d, 0xb6, 0x35, 0x47, 0x39, 0x22, 0x25, 0x9f, 0x9c, 0x9c, 0x92, 0x64, 0x4e, 0x9e, 0xcc,
+    0x06, 0x90, 0x22, 0x58, 0x3b, 0x62, 0x6e, 0x4d, 0x4e, 0xc9, 0xd9, 0x24, 0x91, 0x93, 0x7b, 0x4f,
+    0x84, 0x44, 0x46, 0x4a, 0xc9, 0x29, 0x75, 0xc4, 0x1c, 0x39, 0x91, 0x11, 0xb8, 0x4d, 0x29, 0x19,
+    0x89, 0x88, 0x44, 0x9c, 0x03, 0x8b, 0x6e, 0xcd, 0x51, 0x4e, 0x4e, 0x35, 0xd0, 0x16, 0x09, 0xe5,
+    0xa2, 0xd3, 0x11, 0x6e, 0xb2, 0x4d, 0xbe, 0xc9, 0xb8, 0x23, 0x27, 0x27, 0xa5, 0x0e, 0x88, 0x5c,
+    0x94, 0x93, 0x68, 0xb2, 0x8d, 0x48, 0x4e, 0x2d, 0x22, 0xd9, 0x18, 0x29, 0x07, 0x26, 0xa5, 0x8e,
+    0x98, 0x6c, 0x90, 0x91, 0x08, 0x24, 0x49, 0xce, 0xa2, 0x53, 0x24, 0x48, 0xb2, 0x39, 0x2d, 0x30,
+    0x27, 0x50, 0x04, 0x20, 0x8b, 0x4b, 0x02, 0x20, 0x2e, 0x45, 0xb2, 0x76, 0x66, 0x48, 0x03, 0x4d,
+    0x8b, 0x88, 0x91, 0xa5, 0xf9, 0xc8, 0x66, 0x54, 0x73, 0x48, 0x93, 0x2c, 0x45, 0xd2, 0x36, 0x91,
+    0x26, 0x91, 0x73, 0x4f, 0x8b, 0x4c, 0xc6, 0x2d, 0x44, 0x39, 0x10, 0x23, 0x50, 0x73, 0x92, 0x60,
+    0xa6, 0xb9, 0xf7, 0x42, 0x26, 0x88, 0x22, 0xcd, 0x51, 0x46, 0x92, 0x23, 0x25, 0xc9, 0xe2, 0x14,
+    0x01, 0x4d, 0x88, 0x48, 0x91, 0x35, 0x13, 0xc9, 0x99, 0x40, 0x11, 0x80, 0xa5, 0x48, 0x04, 0xa7,
+    0x64, 0x24, 0x5a, 0xe0, 0x30, 0xea, 0x08, 0x44, 0x39, 0x19, 0x77, 0xa6, 0xe4, 0x5a, 0x42, 0xa0,
+    0x51, 0x8e, 0x08, 0x9e, 0x49, 0x32, 0x39, 0xd7, 0x10, 0xe5, 0x88, 0xd4, 0x11, 0x71, 0x84, 0x50,
+    0x4e, 0xa2, 0xc9, 0xc6, 0xa9, 0x48, 0x24, 0xe5, 0x90, 0xa4, 0x9b, 0x9c, 0x3a, 0x60, 0xae, 0x11,
+    0xc6, 0x91, 0x43, 0x44, 0x39, 0x32, 0x73, 0x04, 0x20, 0x93, 0x8d, 0x73, 0xf2, 0x71, 0x8e, 0x44,
+    0x36, 0xca, 0x11, 0xc9, 0x39, 0x39, 0x15, 0x01, 0xd9, 0x11, 0x93, 0x6f, 0x32, 0x8e, 0xc8, 0xc9,
+    0x29, 0x19, 0x8f, 0x64, 0x44, 0x3b, 0x52, 0x92, 0xb4, 0x49, 0x34, 0xe9, 0x46, 0x24, 0x9d, 0x48,
+    0x73, 0x8a, 0xe4, 0x0d, 0xc4, 0x81, 0x29, 0x49, 0xe2, 0xe4, 0x93, 0x24, 0x72, 0x72, 0xea, 0x88,
+    0x39, 0x72, 0x02, 0x1a, 0x40, 0x24, 0x93, 0x91, 0x93, 0x73, 0x13, 0x49, 0x36, 0x32, 0x19, 0x25,
+    0xc0, 0x9a, 0x5c, 0x93, 0x6e, 0x72, 0x4a, 0x80, 0xb6, 0x23, 0xd6, 0x08, 0x23, 0xe5, 0x1a, 0x9a,
+    0x6c, 0x93, 0x53, 0xb2, 0x39, 0x49, 0xf0, 0x26, 0xc9, 0x1a, 0x9a, 0x74, 0x92, 0x20, 0x6e, 0x3a,
+    0x91, 0x25, 0x27, 0xdf, 0xe4, 0x14, 0x02, 0x93, 0x72, 0x91, 0x50, 0xd2, 0x51, 0x8e, 0xc4, 0xb8,
+    0x06, 0x56, 0x8e, 0x00, 0x6e, 0xb2, 0x6d, 0xca, 0x9d, 0xa9, 0x05, 0xc4, 0xc8, 0xa1, 0x1c, 0x41,
+    0x94, 0x93, 0x4e, 0x52, 0x12, 0xc9, 0x86, 0x46, 0xde, 0x64, 0x94, 0x5c, 0x4b, 0x91, 0x34, 0x11,
+    0xe4, 0x26, 0xdb, 0xe4, 0x1b, 0x91, 0x93, 0x53, 0x91, 0x3c, 0x4a, 0x2d, 0x10, 0xd9, 0xb6, 0xc8,
+    0x04, 0xa2, 0xd4, 0x22, 0x92, 0x8d, 0x91, 0x52, 0x07, 0x4c, 0xca, 0x49, 0x32, 0x81, 0x26, 0xdd,
+    0x80, 0x1c, 0x98, 0x24, 0x74, 0x22, 0x47, 0xd0, 0x8d, 0x44, 0x2d, 0x70, 0x24, 0x17, 0x1a, 0x88,
+    0x92, 0x60, 0x0d, 0x2c, 0x49, 0xd0, 0x46, 0xc4, 0x40, 0x9b, 0x74, 0x92, 0xe0, 0x4d, 0x92, 0x39,
+    0x47, 0x22, 0x09, 0xe2, 0x9c, 0xa0, 0x9c, 0x24, 0x13, 0x88, 0x72, 0x24, 0x6a, 0x01, 0x39, 0x74,
+    0xb4, 0xc0, 0xdc, 0x11, 0x93, 0x64, 0x12, 0x45, 0x2e, 0x40, 0x26, 0xe3, 0xce, 0xa4, 0x14, 0x59,
+    0x64, 0xf2, 0x8d, 0x48, 0x4d, 0x89, 0x24, 0xd1, 0x92, 0x24, 0x4d, 0xb2, 0x39, 0x45, 0xf2, 0x36,
+    0x91, 0x16, 0x88, 0x5b, 0x6e, 0x72, 0x4a, 0x92, 0xb9, 0xe7, 0x26, 0x67, 0x22, 0x11, 0x68, 0xe4,
+    0x70, 0x6e, 0x39, 0x11, 0x41, 0xb4, 0xd0, 0x91, 0x5c, 0x4b, 0x91, 0x34, 0xca, 0x35, 0xb7, 0x33,
+    0x25, 0xc1, 0x13, 0x22, 0x72, 0x44, 0x2a, 0x92, 0x49, 0xb9, 0xe6, 0x46, 0x22, 0x5d, 0xe4, 0x01,
+    0x4e, 0x72, 0x11, 0xc9, 0x85, 0x36, 0xdb, 0x64, 0x1c, 0x91, 0x92, 0x64, 0x4d, 0x2e, 0x49, 0xd0,
+    0x46, 0xc4, 0x24, 0xe1, 0x9c, 0x44, 0x9a, 0xc8, 0x4d, 0xb6, 0xc9, 0x37, 0x22, 0xb5, 0xc0, 0x13,
+    0x40, 0x91, 0x72, 0x67, 0x2a, 0x12, 0x49, 0xb9, 0x23, 0x16, 0x09, 0x25, 0x24, 0x91, 0xc0, 0x4d,
+    0xa2, 0xc9, 0xa9, 0x46, 0x26, 0xe3, 0xe4, 0x49, 0x03, 0x44, 0x28, 0x92, 0x43, 0x39, 0x12, 0x05,
+    0x48, 0xd4, 0x02, 0x93, 0x72, 0x93, 0x44, 0x02, 0x74, 0x44, 0x9a, 0x4b, 0x24, 0x0b, 0x49, 0xce,
+    0x16, 0x81, 0xc8, 0x62, 0xdb, 0x6c, 0x93, 0x4e, 0xd2, 0x21, 0x49, 0xb0, 0x16, 0xc9, 0x08, 0x12,
+    0x01, 0x2f, 0x91, 0x88, 0x46, 0xc9, 0x29, 0x19, 0x89, 0x9a, 0x43, 0x9a, 0x44, 0x4a, 0xa0, 0x19,
+    0x39, 0x9b, 0x13, 0x41, 0x51, 0x92, 0xc8, 0xc8, 0x03, 0xde, 0xe4, 0x92, 0x6c, 0x64, 0xe4, 0x0d,
+    0x44, 0x49, 0xf7, 0xd4, 0x90, 0x54, 0x24, 0x73, 0x02, 0xe5, 0x08, 0x10, 0x27, 0xd7, 0x66, 0x1b,
+    0x99, 0x92, 0x40, 0xac, 0x21, 0x2d, 0x82, 0x24, 0xc9, 0x5a, 0x73, 0x7c, 0x92, 0xa8, 0x49, 0xa2,
+    0x28, 0x77, 0x66, 0x22, 0x10, 0x52, 0x02, 0x1c, 0x45, 0x82, 0x04, 0x90, 0x14, 0x40, 0x33, 0x91,
+    0x9c, 0xa9, 0x08, 0xe6, 0x22, 0x99, 0x74, 0x90, 0x0b, 0x80, 0x37, 0xd9, 0x24, 0x81, 0x58, 0x24,
+    0x03, 0x67, 0xd2, 0x0d, 0x4c, 0x4a, 0x35, 0x40, 0xd6, 0x9c, 0xe4, 0x42, 0x93, 0x8d, 0x73, 0x24,
+    0x52, 0x0e, 0x48, 0x12, 0x49, 0xb0, 0x06, 0x08, 0x25, 0xe7, 0x24, 0x1a, 0x58, 0x94, 0x43, 0x8f,
+    0x72, 0x40, 0x8a, 0x88, 0xb6, 0x45, 0x28, 0x27, 0xd0, 0x48, 0x23, 0x9a, 0x9b, 0x42, 0xcb, 0xd1,
+    0x69, 0x81, 0x47, 0xb9, 0x48, 0x28, 0x87, 0x9e, 0x08, 0x88, 0x94, 0x3b, 0x62, 0x8d, 0xd0, 0x31,
+    0x52, 0x4e, 0xa2, 0x2d, 0x37, 0xf9, 0x06, 0x22, 0xe5, 0x88, 0x1c, 0x9a, 0x94, 0x72, 0x44, 0x52,
+    0x0e, 0x9c, 0x11, 0x39, 0x30, 0x49, 0x28, 0x75, 0xc4, 0x64, 0xa4, 0x9c, 0x3c, 0x6b, 0x88, 0x6e,
+    0x64, 0x86, 0x08, 0x40, 0x78, 0x26, 0xd7, 0x64, 0x1b, 0x89, 0x5c, 0x94, 0x9c, 0x23, 0x52, 0x0d,
+    0x88, 0xc9, 0x23, 0x22, 0xc8, 0xe4, 0x9a, 0x6c, 0x23, 0x8f, 0x72, 0x32, 0x4a, 0x36, 0x34, 0x22,
+    0x25, 0xc1, 0x9a, 0x24, 0x93, 0x6b, 0xcd, 0x0d, 0x4c, 0x2d, 0xd0, 0x46, 0xc4, 0x24, 0x19, 0x41,
+    0x94, 0x03, 0x8d, 0x84, 0x68, 0x72, 0x4a, 0x36, 0x27, 0xb0, 0xde, 0xa4, 0x1b, 0x92, 0x42, 0x20,
+    0x8e, 0x08, 0xca, 0x01, 0x42, 0xb9, 0x85, 0x28, 0x27, 0xdb, 0xe4, 0x1b, 0x91, 0x9c, 0x93, 0x53,
+    0xd2, 0xc9, 0xb9, 0x49, 0xa9, 0x05, 0x26, 0xe3, 0x26, 0x1a, 0x89, 0x44, 0x43, 0x93, 0x2e, 0x24,
+    0x82, 0x33, 0x22, 0x15, 0x09, 0x19, 0x69, 0x6b, 0x6e, 0x44, 0x6a, 0x01, 0xb4, 0x23, 0x05, 0x84,
+    0x1b, 0x69, 0x94, 0x73, 0x93, 0x52, 0xf3, 0xbc, 0xa0, 0x06, 0x10, 0x1d, 0xa5, 0x16, 0x10, 0x94,
+    0x9b, 0x6e, 0x20, 0x8a, 0x08, 0x32, 0x19, 0x39, 0x07, 0xa6, 0x08, 0x58, 0x74, 0x8c, 0x3b, 0x62,
+    0x80, 0x10, 0x31, 0x52, 0x4e, 0xa2, 0xc9, 0xb5, 0xe9, 0x24, 0x41, 0xdb, 0x11, 0x93, 0x64, 0xa0,
+    0x71, 0x0e, 0x4c, 0x3a, 0x4a, 0xc9, 0xe6, 0xb4, 0xc0, 0xa3, 0x5c, 0x24, 0x94, 0x9c, 0x93, 0x88,
+    0x53, 0x08, 0xc4, 0xc9, 0x35, 0xd9, 0x26, 0xc9, 0xa4, 0x1b, 0x99, 0x92, 0x60, 0xee, 0x88, 0xc9,
+    0xb3, 0xe6, 0x38, 0x07, 0x66, 0x24, 0x00, 0x6b, 0x44, 0xac, 0x21, 0xce, 0x91, 0x46, 0x39, 0xf9,
+    0x76, 0x24, 0xe7, 0xc8, 0xa4, 0xe4, 0x94, 0x04, 0x84, 0x73, 0xa0, 0xad, 0xb9, 0x1d, 0x29, 0x20,
+    0xd0, 0x22, 0xa1, 0xd4, 0x04, 0x6e, 0x72, 0xe6, 0x08, 0xe0, 0x24, 0x1f, 0x99, 0x9c, 0x9a, 0x0d,
+    0x8d, 0x48, 0x45, 0xb0, 0x16, 0x09, 0xe5, 0x1c, 0xa2, 0x9c, 0x5c, 0x93, 0x6e, 0x72, 0x8a, 0x88,
+    0x36, 0x39, 0x75, 0x84, 0x9b, 0x3c, 0x93, 0x6b, 0xb2, 0x4d, 0xbe, 0xa1, 0xc8, 0x39, 0x39, 0x25,
+    0xc9, 0x1b, 0x78, 0x22, 0x20, 0x72, 0xed, 0x88, 0x45, 0xb2, 0x86, 0xe6, 0x1a, 0xe5, 0xc0, 0xa4,
+    0x54, 0x24, 0x92, 0x72, 0xee, 0x6c, 0xa2, 0x11, 0x39, 0x39, 0x45, 0xc0, 0xdc, 0x11, 0x93, 0x64,
+    0x0d, 0xcd, 0x4d, 0xca, 0x80, 0x06, 0xe2, 0xa4, 0x1b, 0x91, 0x23, 0x93, 0x92, 0x53, 0x8d, 0x10,
+    0xca, 0xcd, 0xb6, 0xe6, 0xf8, 0x26, 0xdf, 0x80, 0xa4, 0xe4, 0xd4, 0x02, 0x68, 0x44, 0x2c, 0x12,
+    0xca, 0xad, 0xb5, 0xd9, 0xd6, 0x1c, 0xe3, 0x88, 0xa4, 0x94, 0x04, 0x6e, 0x0d, 0x8d, 0xac, 0x91,
+    0x36, 0xf9, 0x46, 0xe2, 0x88, 0xa4, 0xa3, 0xe4, 0x9c, 0x9b, 0x69, 0x0e, 0x49, 0x11, 0xe0, 0x88,
+    0x28, 0x07, 0x22, 0x22, 0x11, 0x20, 0x52, 0xae, 0x39, 0x49, 0x80, 0x46, 0x16, 0xe5, 0x48, 0xa3,
+    0x1c, 0x91, 0x03, 0x93, 0x52, 0x92, 0xac, 0x9d, 0x27, 0x09, 0xda, 0x88, 0xe0, 0x19, 0x21, 0x93,
+    0x53, 0x91, 0x3c, 0xca, 0x91, 0x33, 0xf2, 0x44, 0x48, 0x64, 0xa4, 0x54, 0x24, 0x92, 0x72, 0xf2,
+    0x8d, 0xc8, 0x81, 0xa9, 0x05, 0x26, 0xdb, 0x8e, 0xd8, 0x22, 0x8c, 0x94, 0x03, 0x87, 0x84, 0x72,
+    0x0e, 0xcd, 0x39, 0xca, 0x1c, 0x01, 0x08, 0xe7, 0x24, 0x9a, 0x5b, 0x94, 0x93, 0x6f, 0x32, 0x6e,
+    0xca, 0x81, 0x49, 0xa2, 0x05, 0x04, 0xdf, 0x88, 0xa0, 0xdb, 0x44, 0x6b, 0x6e, 0x60, 0x12, 0xd1,
+    0xe9, 0x08, 0x32, 0xd9, 0x36, 0xa5, 0x64, 0x43, 0x9b, 0x52, 0x93, 0xac, 0x09, 0x44, 0xc2, 0x39,
+    0xb7, 0xb4, 0x40, 0x5b, 0x43, 0x23, 0x6d, 0xd2, 0x8d, 0x4c, 0x4a, 0x2d, 0xf2, 0xd6, 0xd0, 0xc0,
+    0x9a, 0x74, 0x9c, 0x93, 0x6f, 0x2e, 0xaa, 0x81, 0xa8, 0x09, 0xe4, 0x08, 0xa1, 0xe4, 0x5c, 0x43,
+    0x9c, 0x73, 0x53, 0x47, 0xcc, 0x01, 0x44, 0x32, 0x17, 0x23, 0x01, 0x39, 0x92, 0x04, 0x8d, 0x34,
+    0x3a, 0x91, 0xe6, 0x22, 0x17, 0x40, 0x9b, 0x6d, 0x60, 0x2a, 0x12, 0x41, 0xb9, 0x79, 0x24, 0x17,
+    0x91, 0x24, 0x6b, 0x64, 0x51, 0x4a, 0x92, 0x36, 0x22, 0x25, 0xa7, 0x53, 0x23, 0x8f, 0x91, 0x72,
+    0xf2, 0xa9, 0x11, 0xc9, 0x48, 0x39, 0x74, 0x24, 0xc9, 0x9c, 0x9c, 0x39, 0x02, 0xb8, 0xc9, 0x36,
+    0x19, 0x37, 0xe5, 0xc8, 0x94, 0x24, 0x47, 0x72, 0xa1, 0xc9, 0xb6, 0x29, 0x25, 0xc9, 0x9a, 0x5c,
+    0x72, 0xa4, 0x51, 0x8e, 0xb4, 0x91, 0x49, 0x29, 0xd9, 0xdc, 0xe4, 0x1b, 0x90, 0x24, 0x9c, 0x93,
+    0x53, 0x91, 0x3c, 0x4a, 0x2d, 0x10, 0x27, 0xc9, 0x04, 0x22, 0x91, 0x24, 0x92, 0x73, 0xe8, 0xac,
+    0x21, 0xce, 0xa1, 0x49, 0xa9, 0x05, 0x26, 0x1b, 0xe5, 0x8e, 0x98, 0x24, 0x93, 0x68, 0x72, 0xad,
+    0x39, 0xca, 0x91, 0x09, 0x10, 0x05, 0x90, 0x22, 0x02, 0x51, 0x4e, 0xae, 0x91, 0x46, 0xc9, 0x39,
+    0x19, 0x37, 0xe5, 0xce, 0xd4, 0x02, 0x8b, 0x73, 0x8f, 0x70, 0x4e, 0xa0, 0x91, 0xb5, 0xe5, 0xd8,
+    0xf8, 0x06, 0x1e, 0xe5, 0x80, 0x24, 0x99, 0x9b, 0x94, 0x8a, 0xa4, 0x51, 0x0e, 0x48, 0x4a, 0x81,
+    0xe5, 0xd4, 0xc0, 0x5b, 0x74, 0x6a, 0x20, 0x8e, 0x90, 0x35, 0x44, 0x39, 0xe9, 0x14, 0x89, 0x5c,
+    0x43, 0x23, 0x52, 0x08, 0xcc, 0x49, 0xb2, 0x86, 0xb2, 0x10, 0x10, 0x03, 0x8b, 0x84, 0x8b, 0x6f,
+    0xb2, 0x71, 0x0e, 0x3c, 0x12, 0xa2, 0x91, 0xc8, 0x47, 0xc9, 0xb9, 0x33, 0x39, 0x35, 0x01, 0x19,
+    0x68, 0x24, 0x9c, 0x6a, 0x0e, 0x89, 0x34, 0xb7, 0xe7, 0x38, 0x07, 0x1e, 0x09, 0xe5, 0x48, 0x64,
+    0x9b, 0x9c, 0x6c, 0x7c, 0x9c, 0x23, 0x64, 0x0f, 0x45, 0x2e, 0x40, 0x26, 0xdb, 0x48, 0xa4, 0x1c,
+    0x91, 0x93, 0x53, 0x4e, 0x88, 0xc9, 0x33, 0x39, 0x25, 0x17, 0x99, 0x8c, 0x42, 0xf1, 0x48, 0x2e,
+    0x34, 0xd2, 0x26, 0xe3, 0x88, 0xd4, 0x01, 0x6b, 0x92, 0x0c, 0x2c, 0x12, 0x4a, 0x49, 0xd0, 0x26,
+    0xc9, 0x40, 0x5b, 0x74, 0x24, 0x44, 0x23, 0x93, 0x88, 0x52, 0x0b, 0xbc, 0x01, 0x44, 0x31, 0x30,
+    0x29, 0x25, 0x40, 0x24, 0xe2, 0x5a, 0x24, 0x94, 0x6c, 0x6b, 0x6e, 0x20, 0x92, 0x50, 0x0a, 0x48,
+    0x29, 0x02, 0x26, 0xd7, 0x9a, 0x9b, 0x9c, 0x91, 0x07, 0x9c, 0x91, 0xc5, 0xc5, 0x39, 0xd9, 0x28,
+    0x47, 0x22, 0x1b, 0xdf, 0x8e, 0x14, 0x3a, 0x42, 0x0b, 0x10, 0x46, 0xca, 0x2d, 0xc2, 0xc6, 0xc7,
+    0xc8, 0xb9, 0xb5, 0xb6, 0xdc, 0x48, 0xa4, 0x9b, 0x9c, 0x42, 0x00, 0x6d, 0x11, 0x46, 0xca, 0xad,
+    0x35, 0xd2, 0x28, 0x27, 0xdf, 0x48, 0x64, 0xa4, 0xdc, 0x91, 0x74, 0x9c, 0x23, 0x93, 0x52, 0x8f,
+    0x2c, 0x2d, 0xe0, 0x38, 0x17, 0x09, 0xe5, 0xc0, 0x1a, 0x69, 0x5b, 0x8e, 0x8d, 0x72, 0xe4, 0x51,
+    0x8e, 0x44, 0x2e, 0x36, 0xce, 0x91, 0x49, 0xc9, 0x29, 0x89, 0x62, 0xe4, 0x02, 0x48, 0x92, 0x88,
+    0xcd, 0x23, 0xd9, 0x08, 0xa7, 0x1a, 0x59, 0x8c, 0x94, 0x93, 0x6b, 0xd2, 0x4d, 0x4e, 0x11, 0xd1,
+    0x26, 0xc9, 0xe4, 0x91, 0x24, 0x4f, 0x84, 0x44, 0x36, 0xca, 0x1d, 0x44, 0x39, 0x10, 0xb5, 0x80,
+    0x9c, 0x24, 0x03, 0x93, 0x52, 0x11, 0xcc, 0x49, 0x32, 0x72, 0x22, 0x09, 0x58, 0x6b, 0x68, 0xa4,
+    0x71, 0x4e, 0xbe, 0xcd, 0xb8, 0x23, 0x29, 0xf5, 0x08, 0x61, 0xe4, 0xdc, 0x7c, 0x22, 0x02, 0x2d,
+    0x92, 0x91, 0x47, 0xc9, 0xb9, 0x23, 0x27, 0xa7, 0x1a, 0x70, 0x93, 0x64, 0xcf, 0x8d, 0x3c, 0xca,
+    0x1d, 0xb9, 0x33, 0x29, 0xb3, 0x10, 0x68, 0x93, 0x6f, 0x24, 0x72, 0x51, 0xee, 0xc8, 0x9d, 0xa9,
+    0x07, 0xc8, 0x22, 0xa1, 0x94, 0x24, 0x68, 0xe4, 0x51, 0x6e, 0xc6, 0xc9, 0xa9, 0x47, 0xdc, 0x96,
+    0xe3, 0xe3, 0x1c, 0x89, 0x9c, 0x93, 0x33, 0xf2, 0x01, 0x37, 0x12, 0x29, 0x27, 0xc9, 0xc8, 0x92,
+    0x5c, 0x48, 0x07, 0x2c, 0x36, 0x46, 0xca, 0x21, 0xc2, 0x48, 0xb9, 0xe6, 0x28, 0x15, 0x41, 0x1b,
+    0x11, 0x93, 0x64, 0xa4, 0x8d, 0x48, 0x91, 0xe5, 0x28, 0x27, 0xdf, 0xc8, 0xe4, 0xa1, 0x94, 0x3c,
+    0x6f, 0xd1, 0x0d, 0x44, 0x2d, 0x10, 0x29, 0x47, 0x08, 0x17, 0xe5, 0x64, 0x1b, 0x88, 0x03, 0x93,
+    0x52, 0xf2, 0xcc, 0x2d, 0x17, 0x22, 0xc0, 0x5b, 0x24, 0x94, 0x43, 0x67, 0x0b, 0xb1, 0x71, 0x8e,
+    0x2c, 0xce, 0x91, 0x46, 0x39, 0x12, 0x29, 0x39, 0x47, 0x26, 0xa5, 0x16, 0x20, 0x6c, 0x8c, 0x9c,
+    0x93, 0x82, 0x73, 0x8b, 0x6c, 0x21, 0xc6, 0xad, 0xc5, 0xb9, 0xd9, 0x26, 0xdd, 0xe4, 0xd4, 0x02,
+    0x68, 0x40, 0x90, 0x50, 0x6e, 0x11, 0x46, 0xca, 0x91, 0xc5, 0x39, 0xd0, 0x48, 0x28, 0x47, 0x22,
+    0xe7, 0xc8, 0xa4, 0xd4, 0x04, 0x6b, 0x13, 0x69, 0x21, 0xb7, 0xe5, 0xd8, 0x18, 0x39, 0x39, 0x77,
+    0xe4, 0xe4, 0xd4, 0x04, 0x71, 0x84, 0x6c, 0xa2, 0x34, 0x04, 0x26, 0xe3, 0xc8, 0xe2, 0x1a, 0x69,
+    0x3b, 0x8f, 0x72, 0x24, 0xb2, 0x51, 0x72, 0xee, 0xc8, 0x91, 0x49, 0xa9, 0x05, 0x08, 0x1b, 0xe3,
+    0x16, 0x61, 0xe3, 0x63, 0xdc, 0x42, 0x6c, 0x03, 0x8b, 0x6b, 0xae, 0x51, 0x72, 0x4e, 0x3e, 0xce,
+    0x91, 0xc8, 0x36, 0x39, 0x75, 0x04, 0x9a, 0x24, 0x23, 0x8b, 0x8b, 0x73, 0xb3, 0x91, 0x8c, 0x44,
+    0x3e, 0x4a, 0x11, 0xe0, 0x88, 0x28, 0x39, 0xf7, 0xc8, 0x04, 0xe2, 0x1c, 0x59, 0x6c, 0x23, 0x8d,
+    0x8d, 0x8f, 0x71, 0xe4, 0x51, 0x72, 0x8e, 0xc4, 0x49, 0x39, 0x39, 0x39, 0x45, 0x40, 0xe4, 0xdb,
+    0x23, 0x03, 0x88, 0x6f, 0xcf, 0x0d, 0x4c, 0x35, 0x20, 0x26, 0x09, 0xe7, 0xc8, 0xa1, 0xa3, 0xdc,
+    0x44, 0x93, 0x6e, 0x72, 0x4a, 0x2e, 0x22, 0x09, 0xce, 0x64, 0x94, 0x5c, 0x68, 0xb2, 0x0d, 0xc4,
+    0x1d, 0x39, 0x39, 0x15, 0xc1, 0xa2, 0x9c, 0x14, 0x03, 0x84, 0x91, 0x72, 0x72, 0xad, 0xb9, 0x81,
+    0x27, 0x09, 0xda, 0xe4, 0x19, 0x68, 0x74, 0x92, 0xe0, 0xad, 0x11, 0x46, 0x4a, 0xce, 0x45, 0x44,
+    0x39, 0xf0, 0x24, 0x41, 0x9c, 0x24, 0x93, 0x6d, 0xc2, 0x51, 0x72, 0x8e, 0xc4, 0x21, 0x39, 0x39,
+    0x15, 0x81, 0x5c, 0x24, 0x94, 0x03, 0x92, 0x84, 0x6e, 0x64, 0x2a, 0x82, 0xb9, 0x48, 0x28, 0x27,
+    0xcf, 0x08, 0xca, 0x11, 0x80, 0x4c, 0xae, 0xc9, 0x38, 0x22, 0x27, 0xa7, 0xe4, 0x11, 0x03, 0x53,
+    0x72, 0x91, 0x91, 0x46, 0x39, 0x19, 0x77, 0xa6, 0x64, 0x3c, 0x92, 0x0b, 0x4d, 0xb6, 0x39, 0x31,
+    0x49, 0x06, 0x10, 0xc5, 0xe4, 0x1a, 0x72, 0x94, 0x3a, 0xa2, 0x4d, 0x12, 0xce, 0x01, 0x34, 0xd2,
+    0xe8, 0xd6, 0x1c, 0xe3, 0xce, 0xa4, 0xd4, 0x02, 0x8f, 0x72, 0x84, 0x08, 0x81, 0x48, 0x39, 0x22,
+    0x26, 0xc9, 0x48, 0xa3, 0x1c, 0x88, 0x23, 0x72, 0x72, 0x0a, 0x2c, 0x49, 0x42, 0x29, 0x49, 0xe6,
+    0xe4, 0x19, 0x88, 0x44, 0x21, 0x0b, 0x1c, 0xa2, 0x81, 0x46, 0x42, 0x39, 0x19, 0x05, 0x04, 0x99,
+    0x24, 0x13, 0x88, 0x71, 0xb2, 0x8d, 0xc4, 0x11, 0xc9, 0x37, 0x30, 0x49, 0xb4, 0x16, 0x1a, 0x69,
+    0x94, 0x5b, 0x6e, 0x2b, 0x8a, 0x2c, 0x47, 0xb4, 0x16, 0xf9, 0x46, 0xa4, 0x08, 0x88, 0x23, 0x64,
+    0x0f, 0x8d, 0xb8, 0xc8, 0x06, 0xd0, 0x40, 0xa4, 0xd4, 0x02, 0x62, 0x40, 0x4c, 0x12, 0xc9, 0x48,
+    0x14, 0xc9, 0xa2, 0xdc, 0x99, 0x94, 0x92, 0xa0, 0x6d, 0x8a, 0x01, 0x42, 0x39, 0x39, 0x25, 0xd1,
+    0x93, 0x24, 0x71, 0x72, 0x4d, 0xba, 0xc9, 0xa8, 0x06, 0xe6, 0x8e, 0x58, 0x24, 0x93, 0x68, 0x64,
+    0x8d, 0xc4, 0x4c, 0x09, 0x9c, 0xa4, 0x13, 0x92, 0x80, 0x48, 0xba, 0x23, 0xb2, 0x10, 0xe5, 0x88,
+    0x9c, 0x9c, 0x6a, 0x60, 0x31, 0x52, 0x4e, 0x92, 0xc9, 0xa9, 0x05, 0xda, 0x22, 0xa1, 0x9c, 0x40,
+    0x23, 0x4d, 0x72, 0xb9, 0xc9, 0xb6, 0x33, 0x29, 0x45, 0xc8, 0x63, 0xa4, 0x1c, 0x39, 0x44, 0x13,
+    0x88, 0x72, 0xc8, 0x51, 0xea, 0x80, 0xc8, 0x46, 0xb9, 0x23, 0x28, 0x27, 0xc9, 0x04, 0x22, 0x9a,
+    0x74, 0x9c, 0x93, 0x91, 0x88, 0x6e, 0x60, 0x92, 0x50, 0x4a, 0x02, 0x39, 0x49, 0xb4, 0xc0, 0x5c,
+    0x24, 0x94, 0x21, 0x02, 0x44, 0xce, 0x2d, 0xc4, 0xc6, 0xc9, 0x39, 0xf2, 0x28, 0x39, 0x77, 0x24,
+    0xe5, 0xe4, 0xe4, 0xd4, 0x04, 0x64, 0x8d, 0x50, 0x4e, 0x4a, 0xce, 0xc9, 0x29, 0x01, 0xd0, 0x88,
+    0x58, 0x24, 0x94, 0x5b, 0x6b, 0xa4, 0x51, 0x6e, 0x39, 0x46, 0xca, 0x91, 0x47, 0xb9, 0x29, 0x47,
+    0xa6, 0x26, 0x70, 0x93, 0x68, 0xa0, 0x51, 0x90, 0x50, 0xee, 0xb9, 0x91, 0xb7, 0x33, 0x29, 0x23,
+    0x23, 0x90, 0x00, 0x00, 0x00,
 };
+#endif // !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES
 
 #if (WORDLE_USE_RANDOM_GUESS == 3)
 static const uint16_t _num_random_guess_words = 13;  // The valid_words array begins with this many words that are considered the top 3% best options.
 #elif (WORDLE_USE_RANDOM_GUESS == 2)
 static const uint16_t _num_random_guess_words = 257;  // The valid_words array begins with this many words where each letter is different.
 #elif (WORDLE_USE_RANDOM_GUESS == 1)
-static const uint16_t _num_random_guess_words = _num_words;
+static const uint16_t _num_random_guess_words = WORDLE_NUM_WORDS;
 #endif
 
-#endif // WORDLE_FACE_DICT_H_
\ No newline at end of file
+#endif // WORDLE_FACE_DICT_H_
@@ -27,13 +27,12 @@
 #include "all_segments_face.h"
 #include "watch.h"
 
-void all_segments_face_setup(uint8_t watch_face_index, void ** context_ptr) {
-    (void) watch_face_index;
-    (void) context_ptr;
-}
+// blink cycle lengths for the sweep stage; Light cycles through these.
+static const uint16_t _blink_rates_ms[] = { 250, 500, 1000, 125 };
+#define ALL_SEGMENTS_NUM_RATES (sizeof(_blink_rates_ms) / sizeof(_blink_rates_ms[0]))
 
-void all_segments_face_activate(void *context) {
-    (void) context;
+// energizes every segment, or only the even/odd segment lines for the short test
+static void _all_segments_fill(bool checkerboard, uint8_t parity) {
     watch_lcd_type_t lcd_type = watch_get_lcd_type();
     uint8_t num_com = 3;
     uint8_t num_seg = 27 - num_com;
@@ -42,21 +41,75 @@ void all_segments_face_activate(void *context) {
         num_com = 4;
     }
 
+    watch_display_begin_frame();
+    watch_clear_display();
     for (int com = 0; com < num_com; com++) {
         for (int seg = 0; seg < num_seg; seg++) {
+            if (checkerboard && (seg & 1) != parity) continue;
             watch_set_pixel(com, seg);
         }
     }
+    watch_display_commit_frame();
+}
+
+static void _all_segments_apply_stage(all_segments_state_t *state) {
+    watch_stop_blink();
+    switch (state->stage) {
+        case 0:
+            _all_segments_fill(false, 0);
+            break;
+        case 1:
+            _all_segments_fill(false, 0);
+            watch_start_display_blink(_blink_rates_ms[state->rate_index]);
+            break;
+        case 2:
+            _all_segments_fill(true, 0);
+            break;
+        default:
+            _all_segments_fill(true, 1);
+            break;
+    }
+}
+
+void all_segments_face_setup(uint8_t watch_face_index, void ** context_ptr) {
+    (void) watch_face_index;
+    if (*context_ptr == NULL) *context_ptr = movement_face_context_alloc(sizeof(all_segments_state_t));
+}
+
+void all_segments_face_activate(void *context) {
+    all_segments_state_t *state = (all_segments_state_t *)context;
+    state->stage = 0;
+    state->rate_index = 0;
+    // nothing here needs a tick; the blink stage runs entirely in SLCD hardware
+    movement_request_tick_frequency(0);
 }
 
 bool all_segments_face_loop(movement_event_t event, void *context) {
-    (void) context;
+    all_segments_state_t *state = (all_segments_state_t *)context;
 
-    movement_default_loop_handler(event);
+    switch (event.event_type) {
+        case EVENT_ACTIVATE:
+            _all_segments_apply_stage(state);
+            break;
+        case EVENT_ALARM_BUTTON_UP:
+            state->stage = (state->stage + 1) % 4;
+            _all_segments_apply_stage(state);
+            break;
+        case EVENT_LIGHT_BUTTON_UP:
+            if (state->stage == 1) {
+                state->rate_index = (state->rate_index + 1) % ALL_SEGMENTS_NUM_RATES;
+                _all_segments_apply_stage(state);
+            }
+            break;
+        default:
+            movement_default_loop_handler(event);
+            break;
+    }
 
     return true;
 }
 
 void all_segments_face_resign(void *context) {
     (void) context;
+    watch_stop_blink();
 }
@@ -27,11 +27,25 @@
 /*
  * ALL SEGMENTS FACE
  *
- * This watch face energizes all segments on the screen at once.
+ * This watch face energizes all segments on the screen at once, and doubles as
+ * the factory display self-test. The Alarm button steps through four stages:
+ *
+ *  1. All segments on — stuck-off segments and dead commons show immediately.
+ *  2. All segments blinking via the SLCD autonomous blink hardware — stuck-on
+ *     segments show as pixels that never go dark. The Light button cycles the
+ *     blink rate. The CPU sleeps through this stage; the sweep costs no ticks.
+ *  3. Even segment lines only, then
+ *  4. Odd segment lines only — a short between adjacent segment lines shows as
+ *     a pixel lit in both patterns.
  */
 
 #include "movement.h"
 
+typedef struct {
+    uint8_t stage;
+    uint8_t rate_index;
+} all_segments_state_t;
+
 void all_segments_face_setup(uint8_t watch_face_index, void ** context_ptr);
 void all_segments_face_activate(void *context);
 bool all_segments_face_loop(movement_event_t event, void *context);
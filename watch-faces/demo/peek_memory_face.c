@@ -29,11 +29,13 @@
 #include "sam.h"
 #include "watch_utility.h"
 #include "watch_common_display.h"
+#include "watch_wake_stats.h"
+#include "watch_boot_trace.h"
 
 void peek_memory_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(peek_memory_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(peek_memory_state_t));
         peek_memory_state_t *state = (peek_memory_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(peek_memory_state_t));
 #if __EMSCRIPTEN__
@@ -64,7 +66,12 @@ bool peek_memory_face_loop(movement_event_t event, void *context) {
             memcpy(&value, state->location, 4);
             switch (state->format) {
                 case PEEK_MEMORY_FORMAT_HEX:
-                    sprintf(buf, "%08lX", value);
+                    // eight nibble picks instead of a printf round trip
+                    for (uint8_t i = 0; i < 8; i++) {
+                        uint8_t nibble = (value >> ((7 - i) * 4)) & 0xF;
+                        buf[i] = nibble < 10 ? '0' + nibble : 'A' + nibble - 10;
+                    }
+                    buf[8] = 0;
                     watch_display_character('M', 0);
                     watch_display_character(buf[0], 1);
                     watch_display_character(buf[1], 10);
@@ -77,16 +84,42 @@ bool peek_memory_face_loop(movement_event_t event, void *context) {
                     break;
                 case PEEK_MEMORY_FORMAT_DATE:
                     datetime = (rtc_date_time_t *)&value;
-                    sprintf(buf, "M%d", datetime->unit.month);
+                    buf[0] = 'M';
+                    watch_utility_format_decimal(buf + 1, datetime->unit.month, 1);
                     watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, buf, buf + 1);
-                    sprintf(buf, "%2d", datetime->unit.day);
+                    watch_format_two_digits(buf, datetime->unit.day, false);
+                    buf[2] = 0;
                     watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
-                    sprintf(buf, "%02d%02d%02d", datetime->unit.hour, datetime->unit.minute, datetime->unit.second);
+                    watch_format_two_digits(buf, datetime->unit.hour, true);
+                    watch_format_two_digits(buf + 2, datetime->unit.minute, true);
+                    watch_format_two_digits(buf + 4, datetime->unit.second, true);
+                    buf[6] = 0;
                     watch_display_text(WATCH_POSITION_BOTTOM, buf);
                     watch_set_colon();
                     break;
             }
             break;
+        case EVENT_ALARM_BUTTON_UP:
+            // page through the wake counters, then the boot phase stamps; one
+            // past the last wraps back to the default location from setup.
+            if (state->wake_source < WATCH_WAKE_SOURCE_COUNT) {
+                state->location = (void *)watch_wake_stats_count_ptr((watch_wake_source_t)state->wake_source);
+                state->format = PEEK_MEMORY_FORMAT_HEX;
+                state->wake_source++;
+            } else if (state->wake_source < WATCH_WAKE_SOURCE_COUNT + WATCH_BOOT_PHASE_COUNT) {
+                state->location = (void *)watch_boot_trace_ptr((watch_boot_phase_t)(state->wake_source - WATCH_WAKE_SOURCE_COUNT));
+                state->format = PEEK_MEMORY_FORMAT_HEX;
+                state->wake_source++;
+            } else {
+                state->wake_source = 0;
+#if __EMSCRIPTEN__
+                state->format = PEEK_MEMORY_FORMAT_HEX;
+#else
+                state->location = (void *)&(RTC->MODE2.TIMESTAMP.reg);
+                state->format = PEEK_MEMORY_FORMAT_DATE;
+#endif
+            }
+            break;
         case EVENT_TIMEOUT:
             movement_move_to_face(0);
             break;
@@ -31,6 +31,10 @@
  * Currently hard coded but would be cool to let user select it somehow.
  *
  * Only works with custom LCD. This is for debugging purposes only.
+ *
+ * Pressing ALARM pages through the live wake counters from watch_wake_stats
+ * and then the boot phase stamps from watch_boot_trace, one per press, then
+ * wraps back to the default location.
  */
 
 #include "movement.h"
@@ -43,6 +47,7 @@ typedef enum {
 
 typedef struct {
     uint8_t format;
+    uint8_t wake_source; // pages through wake counters on ALARM; see loop
     void *location;
 } peek_memory_state_t;
 
@@ -0,0 +1,115 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "profiler_face.h"
+#include "watch.h"
+#include "watch_common_display.h"
+
+#define PROFILER_NUM_PAGES (4)
+
+void profiler_face_setup(uint8_t watch_face_index, void ** context_ptr) {
+    (void) watch_face_index;
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(profiler_state_t));
+        memset(*context_ptr, 0, sizeof(profiler_state_t));
+    }
+}
+
+void profiler_face_activate(void *context) {
+    (void) context;
+}
+
+static void _profiler_draw(profiler_state_t *state) {
+    movement_wake_stats_t stats;
+    movement_get_wake_stats(&stats);
+
+    uint32_t value = 0;
+    char buf[8];
+
+    switch (state->page) {
+        case 0: // last app_loop pass, in RTC ticks
+            watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "LP ", "LP");
+            value = stats.last_wake_ticks;
+            break;
+        case 1: // average ticks per pass
+            watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "AU ", "AU");
+            if (stats.wake_count) value = stats.busy_ticks / stats.wake_count;
+            break;
+        case 2: // wakes per hour since reset
+            watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "UH ", "UH");
+            {
+                uint32_t elapsed = watch_rtc_get_counter() - stats.start_counter;
+                if (elapsed) {
+                    value = (uint32_t)((uint64_t)stats.wake_count * 3600 * watch_rtc_get_frequency() / elapsed);
+                }
+            }
+            break;
+        case 3: // tick delivery jitter, in RTC ticks late
+            watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "Jt ", "Jt");
+            value = state->last_jitter_ticks;
+            break;
+    }
+
+    if (value > 999999) value = 999999;
+    sprintf(buf, "%6lu", (unsigned long)value);
+    watch_display_text(WATCH_POSITION_BOTTOM, buf);
+}
+
+bool profiler_face_loop(movement_event_t event, void *context) {
+    profiler_state_t *state = (profiler_state_t *)context;
+
+    switch (event.event_type) {
+        case EVENT_TICK:
+            {
+                // the 1 Hz tick interrupt fires when the subsecond counter hits
+                // half the RTC frequency; anything past that by the time this
+                // event reaches us is queueing and dispatch latency.
+                uint32_t freq = watch_rtc_get_frequency();
+                uint32_t subsecond = watch_rtc_get_counter() & (freq - 1);
+                state->last_jitter_ticks = (uint8_t)((subsecond - freq / 2) & (freq - 1));
+            }
+            // fall through
+        case EVENT_ACTIVATE:
+            _profiler_draw(state);
+            break;
+        case EVENT_ALARM_BUTTON_UP:
+            state->page = (state->page + 1) % PROFILER_NUM_PAGES;
+            _profiler_draw(state);
+            break;
+        case EVENT_TIMEOUT:
+            movement_move_to_face(0);
+            break;
+        default:
+            movement_default_loop_handler(event);
+            break;
+    }
+
+    return true;
+}
+
+void profiler_face_resign(void *context) {
+    (void) context;
+}
@@ -0,0 +1,62 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+/*
+ * PROFILER FACE
+ *
+ * Live performance counters on the wrist, for reading numbers off a field
+ * unit with no tether. The ALARM button pages through:
+ *
+ *   LP - RTC ticks the last app_loop pass spent awake
+ *   AU - average ticks per pass since the stats were last reset
+ *   UH - wakes per hour since the stats were last reset
+ *   Jt - tick jitter: how many RTC ticks late this face's one-second
+ *        tick event was handled, measured against the tick interrupt's
+ *        nominal subsecond phase
+ *
+ * All numbers come from the same ledger the cpustat shell command reads;
+ * reset them with `cpustat reset`. One RTC tick is 1/128 s.
+ */
+
+#include "movement.h"
+
+typedef struct {
+    uint8_t page;
+    uint8_t last_jitter_ticks;
+} profiler_state_t;
+
+void profiler_face_setup(uint8_t watch_face_index, void ** context_ptr);
+void profiler_face_activate(void *context);
+bool profiler_face_loop(movement_event_t event, void *context);
+void profiler_face_resign(void *context);
+
+#define profiler_face ((const watch_face_t){ \
+    profiler_face_setup, \
+    profiler_face_activate, \
+    profiler_face_loop, \
+    profiler_face_resign, \
+    NULL, \
+})
@@ -87,34 +87,26 @@ static void _rtccount_face_draw(movement_event_t event, rtccount_state_t* state)
 
     _rtccount_face_display_string(buf, 0);
 
-    snprintf(buf, sizeof(buf), "%u", event.subsecond);
-    uint32_t len = strlen(buf);
+    // this face redraws at up to 128 Hz; format through the double-dabble
+    // helper so each frame costs shifts and adds instead of printf divisions.
+    uint8_t len = watch_utility_format_decimal(buf, event.subsecond, 1);
     _rtccount_face_display_string(buf, 4 - len);
 
     switch (state->status) {
         case RTCCOUNT_STATUS_COUNTER: {
-            snprintf(buf, sizeof(buf), "%lu", counter & COUNTER_MASK);
-
-            size_t len = strlen(buf);
-
+            len = watch_utility_format_decimal(buf, counter & COUNTER_MASK, 1);
             _rtccount_face_display_string(buf, 10 - len);
             break;
         }
 
         case RTCCOUNT_STATUS_COUNTER_SUB: {
-            snprintf(buf, sizeof(buf), "%lu", counter & 127);
-
-            size_t len = strlen(buf);
-
+            len = watch_utility_format_decimal(buf, counter & 127, 1);
             _rtccount_face_display_string(buf, 10 - len);
             break;
         }
 
         case RTCCOUNT_STATUS_MINUTES: {
-            snprintf(buf, sizeof(buf), "%lu", state->n_top_of_minute & COUNTER_MASK);
-
-            size_t len = strlen(buf);
-
+            len = watch_utility_format_decimal(buf, state->n_top_of_minute & COUNTER_MASK, 1);
             _rtccount_face_display_string(buf, 10 - len);
             break;
         }
@@ -122,10 +114,7 @@ static void _rtccount_face_draw(movement_event_t event, rtccount_state_t* state)
         case RTCCOUNT_STATUS_MINUTES_DIFF: {
             uint32_t elapsed_minutes = (movement_get_utc_timestamp() - state->ref_timestamp) / 60;
 
-            snprintf(buf, sizeof(buf), "%lu", (elapsed_minutes - state->n_top_of_minute) & COUNTER_MASK);
-
-            size_t len = strlen(buf);
-
+            len = watch_utility_format_decimal(buf, (elapsed_minutes - state->n_top_of_minute) & COUNTER_MASK, 1);
             _rtccount_face_display_string(buf, 10 - len);
             break;
         }
@@ -138,7 +127,7 @@ static void _rtccount_face_draw(movement_event_t event, rtccount_state_t* state)
 void rtccount_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(rtccount_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(rtccount_state_t));
         memset(*context_ptr, 0, sizeof(rtccount_state_t));
         rtccount_state_t *state = (rtccount_state_t *) *context_ptr;
         state->status = RTCCOUNT_STATUS_COUNTER;
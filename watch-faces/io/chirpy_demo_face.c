@@ -31,6 +31,7 @@
 typedef enum {
     CDM_CHOOSE = 0,
     CDM_CHIRPING,
+    CDM_RESUME,
 } chirpy_demo_mode_t;
 
 typedef enum {
@@ -47,9 +48,15 @@ typedef struct {
     // Selected program
     chirpy_demo_program_t program;
 
+    // Modulation rate profile for the next transmission
+    chirpy_rate_t rate;
+
     // Used by chirpy encoder during transmission
     chirpy_encoder_state_t encoder_state;
 
+    // Chunk to restart from after an aborted transmission
+    uint16_t resume_chunk;
+
 } chirpy_demo_state_t;
 
 static uint8_t long_data_str[] =
@@ -90,13 +97,17 @@ static uint8_t short_data[] = {
 
 #define ACTIVITY_DATA_FILE_NAME "activity.dat"
 
+// Payload bytes per chunk: five 15-byte blocks, so block CRCs align with chunk
+// boundaries. Roughly four seconds of audio per chunk at the standard rate.
+#define CHIRPY_DEMO_CHUNK_SIZE 75
+
 static uint8_t *activity_buffer = 0;
 static uint16_t activity_buffer_size = 0;
 
 void chirpy_demo_face_setup(uint8_t watch_face_index, void **context_ptr) {
     (void)watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(chirpy_demo_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(chirpy_demo_state_t));
         memset(*context_ptr, 0, sizeof(chirpy_demo_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
@@ -133,7 +144,13 @@ void chirpy_demo_face_activate(void *context) {
 
 static void _cdf_update_lcd(chirpy_demo_state_t *state) {
     watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "CH", "Chirp");
-    if (state->program == CDP_CLEAR) {
+    watch_display_text(WATCH_POSITION_TOP_RIGHT, state->rate == CHIRPY_RATE_FAST ? " F" : "  ");
+    if (state->mode == CDM_RESUME) {
+        // An aborted transmission: offer to pick up at the chunk that was in flight.
+        char buf[8];
+        sprintf(buf, "Fr%4d", state->resume_chunk);
+        watch_display_text(WATCH_POSITION_BOTTOM, buf);
+    } else if (state->program == CDP_CLEAR) {
         movement_force_led_on(255, 0, 0);
         watch_display_text(WATCH_POSITION_BOTTOM, "CLEAR?");
     } else if (state->program == CDP_INFO_SHORT) {
@@ -148,21 +165,27 @@ static void _cdf_update_lcd(chirpy_demo_state_t *state) {
 }
 
 static uint8_t *curr_data_ptr;
-static uint16_t curr_data_ix;
 static uint16_t curr_data_len;
 static chirpy_demo_state_t *curr_state;
+static chirpy_chunk_state_t curr_chunks;
 
 static uint8_t _cdf_get_next_byte(uint8_t *next_byte) {
-    if (curr_data_ix == curr_data_len)
-        return 0;
-    *next_byte = curr_data_ptr[curr_data_ix];
-    ++curr_data_ix;
-    return 1;
+    return chirpy_get_next_chunk_byte(&curr_chunks, next_byte);
 }
 
 static void _cdf_on_chirping_done(void) {
     if (curr_state) {
-        curr_state->mode = CDM_CHOOSE;
+        uint16_t count = chirpy_get_chunk_count(curr_data_len, CHIRPY_DEMO_CHUNK_SIZE);
+        uint16_t resume = chirpy_get_resume_chunk(&curr_chunks);
+        if (resume < count) {
+            // Aborted mid-transfer: remember where, and offer to resume.
+            curr_state->resume_chunk = resume;
+            curr_state->mode = CDM_RESUME;
+        } else {
+            curr_state->resume_chunk = 0;
+            curr_state->mode = CDM_CHOOSE;
+        }
+        _cdf_update_lcd(curr_state);
     }
     watch_clear_indicator(WATCH_INDICATOR_BELL);
 }
@@ -189,7 +212,7 @@ static bool _cdm_raw_source_fn(uint16_t position, void* userdata, uint16_t* peri
     }
 
     *period = chirpy_get_tone_period(tone);
-    *duration = 3;
+    *duration = chirpy_get_tone_duration(state->rate);
 
     return false;
 }
@@ -200,7 +223,6 @@ static void _cdm_start_transmission(chirpy_demo_state_t *state) {
 
     // Set up the data
     curr_state = state;
-    curr_data_ix = 0;
     if (state->program == CDP_INFO_SHORT) {
         curr_data_ptr = short_data;
         curr_data_len = short_data_len;
@@ -212,6 +234,7 @@ static void _cdm_start_transmission(chirpy_demo_state_t *state) {
         curr_data_len = activity_buffer_size;
     }
 
+    chirpy_init_chunks(&curr_chunks, curr_data_ptr, curr_data_len, CHIRPY_DEMO_CHUNK_SIZE, state->resume_chunk);
     chirpy_init_encoder(&state->encoder_state, _cdf_get_next_byte);
     watch_buzzer_play_raw_source(_cdm_raw_source_fn, state, _cdf_on_chirping_done);
 }
@@ -224,10 +247,26 @@ bool chirpy_demo_face_loop(movement_event_t event, void *context) {
             _cdf_update_lcd(state);
             break;
         case EVENT_LIGHT_BUTTON_DOWN:
+            break;
         case EVENT_LIGHT_BUTTON_UP:
-            // We don't do light.
+            // Toggle between the standard and fast modulation profiles
+            if (state->mode == CDM_CHOOSE) {
+                state->rate = (state->rate == CHIRPY_RATE_STANDARD) ? CHIRPY_RATE_FAST : CHIRPY_RATE_STANDARD;
+                _cdf_update_lcd(state);
+            } else if (state->mode == CDM_RESUME) {
+                // Abandon the resume point, back to the program chooser
+                state->resume_chunk = 0;
+                state->mode = CDM_CHOOSE;
+                _cdf_update_lcd(state);
+            }
             break;
         case EVENT_ALARM_BUTTON_UP:
+            // If offering to resume: step through the chunks to restart from
+            if (state->mode == CDM_RESUME) {
+                state->resume_chunk = (state->resume_chunk + 1) % chirpy_get_chunk_count(curr_data_len, CHIRPY_DEMO_CHUNK_SIZE);
+                _cdf_update_lcd(state);
+                break;
+            }
             // If in choose mode: select next program
             if (state->mode == CDM_CHOOSE) {
                 if (state->program == CDP_CLEAR)
@@ -245,6 +284,17 @@ bool chirpy_demo_face_loop(movement_event_t event, void *context) {
             }
             break;
         case EVENT_ALARM_LONG_PRESS:
+            // While chirping: abort. The end callback records the chunk that was
+            // in flight so the transfer can pick up from there.
+            if (state->mode == CDM_CHIRPING) {
+                watch_buzzer_abort_sequence();
+                break;
+            }
+            // If offering to resume: restart from the selected chunk
+            if (state->mode == CDM_RESUME) {
+                _cdm_start_transmission(state);
+                break;
+            }
             // If in choose mode: start chirping
             if (state->mode == CDM_CHOOSE) {
                 if (state->program == CDP_CLEAR) {
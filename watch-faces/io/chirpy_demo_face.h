@@ -45,7 +45,15 @@
  * famous sea shanty.
  * 
  * Select the transmission you want with ALARM, the press LONG ALARM to chirp.
- * 
+ *
+ * Transmissions go out in chunks of 75 bytes, each preceded by a small header
+ * carrying its offset, length and CRC, so a receiver can verify and place
+ * every chunk independently. LONG ALARM during a chirp aborts it; the face
+ * then shows "Fr" and the chunk that was in flight. From there, ALARM steps
+ * through the chunks, LONG ALARM restarts the transmission from the selected
+ * chunk (so one glitch doesn't cost the whole transfer), and LIGHT returns
+ * to the program chooser.
+ *
  * To record and decode a chirpy transmission on your computer, you can use the web app here:
  * https://jealousmarkup.xyz/off/chirpy/rx/
  */
@@ -0,0 +1,234 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "irda_bench_face.h"
+#include "uart.h"
+#include "watch_uart.h"
+#include "watch_common_display.h"
+
+#ifdef HAS_IR_SENSOR
+
+// Deliberately small DMA ring: the DMAC's half-full wake then lands within a
+// frame or two of the last byte, so arrival timestamps are bounded by half the
+// ring at line rate rather than by the face's tick frequency.
+#define IRDA_BENCH_RING_SIZE (32)
+static uint8_t *_irda_bench_rx_ring;
+
+// ping frame body after the preamble: 'P' <u16 seq> <u16 interval_ms> <crc16>
+#define IRDA_BENCH_FRAME_LEN (7)
+
+enum {
+    IRDA_BENCH_PARSE_SYNC_1 = 0,  // waiting for 0x55
+    IRDA_BENCH_PARSE_SYNC_2,      // waiting for 0xAA
+    IRDA_BENCH_PARSE_BODY,        // collecting the frame body
+};
+
+// stats live outside the face context so `irstat` can read them after resign
+static irda_bench_stats_t _stats;
+
+void irda_bench_get_stats(irda_bench_stats_t *stats) {
+    *stats = _stats;
+}
+
+void irda_bench_reset_stats(void) {
+    memset(&_stats, 0, sizeof(_stats));
+    _stats.min_gap_ticks = 0xFFFF;
+}
+
+static uint16_t _irda_bench_crc16(const uint8_t *data, size_t length) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            if (crc & 0x8000) crc = (crc << 1) ^ 0x1021;
+            else crc <<= 1;
+        }
+    }
+    return crc;
+}
+
+static void _irda_bench_note_ping(irda_bench_state_t *state, uint16_t seq, uint16_t interval_ms) {
+    rtc_counter_t now = watch_rtc_get_counter();
+
+    _stats.interval_ms = interval_ms;
+    if (state->have_last) {
+        uint32_t gap = (rtc_counter_t)(now - state->last_arrival);
+        uint8_t bucket = 0;
+        while ((gap >> bucket) > 1 && bucket < IRDA_BENCH_BUCKETS - 1) bucket++;
+        _stats.buckets[bucket]++;
+        if (gap < _stats.min_gap_ticks) _stats.min_gap_ticks = gap;
+        if (gap > _stats.max_gap_ticks && gap <= 0xFFFF) _stats.max_gap_ticks = gap;
+
+        if (seq == (uint16_t)(state->last_seq + 1)) {
+            // the common case: the next frame in sequence
+        } else if ((uint16_t)(seq - state->last_seq) < 0x8000) {
+            _stats.lost += (uint16_t)(seq - state->last_seq) - 1;
+        } else {
+            // sequence went backwards: the host restarted its counter
+            _stats.replays++;
+        }
+    }
+
+    state->have_last = true;
+    state->last_seq = seq;
+    state->last_arrival = now;
+    _stats.received++;
+}
+
+static void _irda_bench_handle_byte(irda_bench_state_t *state, uint8_t byte) {
+    switch (state->parse_state) {
+        case IRDA_BENCH_PARSE_SYNC_1:
+            if (byte == 0x55) state->parse_state = IRDA_BENCH_PARSE_SYNC_2;
+            break;
+        case IRDA_BENCH_PARSE_SYNC_2:
+            if (byte == 0xAA) {
+                state->frame_pos = 0;
+                state->parse_state = IRDA_BENCH_PARSE_BODY;
+            } else if (byte != 0x55) {
+                state->parse_state = IRDA_BENCH_PARSE_SYNC_1;
+            }
+            break;
+        case IRDA_BENCH_PARSE_BODY:
+            state->frame[state->frame_pos++] = byte;
+            if (state->frame_pos == 1 && byte != 'P') {
+                state->parse_state = IRDA_BENCH_PARSE_SYNC_1;
+                break;
+            }
+            if (state->frame_pos == IRDA_BENCH_FRAME_LEN) {
+                uint16_t seq, interval_ms, expected_crc;
+                memcpy(&seq, &state->frame[1], 2);
+                memcpy(&interval_ms, &state->frame[3], 2);
+                memcpy(&expected_crc, &state->frame[5], 2);
+                if (_irda_bench_crc16(state->frame, 5) == expected_crc) {
+                    _irda_bench_note_ping(state, seq, interval_ms);
+                } else {
+                    _stats.crc_errors++;
+                }
+                state->parse_state = IRDA_BENCH_PARSE_SYNC_1;
+            }
+            break;
+    }
+}
+
+static void _irda_bench_update_display(irda_bench_state_t *state) {
+    char buf[8];
+
+    watch_display_text_with_fallback(WATCH_POSITION_TOP, "IR b ", "IR");
+    switch (state->display_mode) {
+        case 0:
+            // received count; 'P' for pings
+            sprintf(buf, "P%5lu", (unsigned long)(_stats.received % 100000));
+            break;
+        case 1:
+            // implied losses from sequence gaps
+            sprintf(buf, "L%5lu", (unsigned long)(_stats.lost % 100000));
+            break;
+        default:
+            // worst inter-arrival gap, in milliseconds
+            sprintf(buf, "G%5lu", (unsigned long)((uint64_t)_stats.max_gap_ticks * 1000 / watch_rtc_get_frequency()) % 100000);
+            break;
+    }
+    watch_display_text(WATCH_POSITION_BOTTOM, buf);
+}
+
+void irda_bench_face_setup(uint8_t watch_face_index, void ** context_ptr) {
+    (void) watch_face_index;
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(irda_bench_state_t));
+        memset(*context_ptr, 0, sizeof(irda_bench_state_t));
+        irda_bench_reset_stats();
+    }
+}
+
+void irda_bench_face_activate(void *context) {
+    irda_bench_state_t *state = (irda_bench_state_t *)context;
+    memset(state, 0, sizeof(irda_bench_state_t));
+    HAL_GPIO_IR_ENABLE_out();
+    HAL_GPIO_IR_ENABLE_clr();
+    HAL_GPIO_IRSENSE_in();
+    HAL_GPIO_IRSENSE_pmuxen(HAL_GPIO_PMUX_SERCOM_ALT);
+    uart_init_instance(0, UART_TXPO_NONE, UART_RXPO_0, 900);
+    uart_set_irda_mode_instance(0, true);
+    uart_enable_instance(0);
+    // the SERCOM0 interrupt handler lives in irda_upload_face.c; both IR faces
+    // share it, since only one can own the SERCOM at a time.
+    _irda_bench_rx_ring = malloc(IRDA_BENCH_RING_SIZE);
+    watch_uart_rx_dma_enable(0, _irda_bench_rx_ring, IRDA_BENCH_RING_SIZE);
+    // a gentle tick to refresh the counters; frames are parsed on DMA wakes
+    movement_request_tick_frequency(2);
+}
+
+bool irda_bench_face_loop(movement_event_t event, void *context) {
+    irda_bench_state_t *state = (irda_bench_state_t *)context;
+
+    switch (event.event_type) {
+        case EVENT_NONE:
+        case EVENT_ACTIVATE:
+        case EVENT_TICK:
+        {
+            uint8_t data[32];
+            size_t bytes_read;
+            while ((bytes_read = watch_uart_rx_dma_read(data, sizeof(data))) > 0) {
+                for (size_t i = 0; i < bytes_read; i++) {
+                    _irda_bench_handle_byte(state, data[i]);
+                }
+            }
+            watch_set_indicator(WATCH_INDICATOR_ARROWS);
+            _irda_bench_update_display(state);
+        }
+            break;
+        case EVENT_ALARM_BUTTON_UP:
+            state->display_mode = (state->display_mode + 1) % 3;
+            _irda_bench_update_display(state);
+            break;
+        case EVENT_ALARM_LONG_PRESS:
+            irda_bench_reset_stats();
+            state->have_last = false;
+            _irda_bench_update_display(state);
+            break;
+        case EVENT_TIMEOUT:
+            // a bench run can outlast the inactivity timeout; stay put
+            break;
+        default:
+            return movement_default_loop_handler(event);
+    }
+
+    return false;
+}
+
+void irda_bench_face_resign(void *context) {
+    (void) context;
+    watch_uart_rx_dma_disable();
+    free(_irda_bench_rx_ring);
+    _irda_bench_rx_ring = NULL;
+    uart_disable_instance(0);
+    HAL_GPIO_IRSENSE_pmuxdis();
+    HAL_GPIO_IRSENSE_off();
+    HAL_GPIO_IR_ENABLE_off();
+}
+
+#endif // HAS_IR_SENSOR
@@ -0,0 +1,99 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "movement.h"
+
+#ifdef HAS_IR_SENSOR
+
+/*
+ * IrDA LINK BENCHMARK
+ *
+ * A field tool for qualifying the IR receive path against real hardware and
+ * ambient light conditions. The photodiode link is receive-only, so a true
+ * echo round trip is not possible; instead the bench host streams small
+ * sequence-numbered ping frames at a fixed cadence it advertises in each
+ * frame, and the face measures what actually arrives: frames received,
+ * frames lost (sequence gaps), CRC failures, and a log2-bucketed histogram
+ * of inter-arrival times in RTC ticks. Cadence jitter and loss under a desk
+ * lamp versus a dark room is exactly the data the link tuning needs.
+ *
+ * Each ping frame is the 0x55 0xAA preamble followed by 'P', a u16 sequence
+ * number, the host's u16 nominal send interval in milliseconds, and a
+ * CRC-16/CCITT of the five bytes in between (all little-endian).
+ *
+ * The display shows the live received count; Alarm cycles to the loss count
+ * and the worst inter-arrival gap in milliseconds, and a long press of Alarm
+ * resets the statistics. The full histogram dumps from the shell with
+ * `irstat`, which also works after the face has resigned.
+ */
+
+#define IRDA_BENCH_BUCKETS 16
+
+typedef struct {
+    uint32_t received;      // ping frames with a good CRC
+    uint32_t lost;          // frames implied missing by sequence gaps
+    uint32_t replays;       // sequence went backwards (host restarted)
+    uint32_t crc_errors;    // frames dropped for a bad CRC
+    uint16_t interval_ms;   // nominal send interval advertised by the host
+    uint16_t min_gap_ticks; // tightest inter-arrival gap seen
+    uint16_t max_gap_ticks; // widest inter-arrival gap seen
+    uint16_t buckets[IRDA_BENCH_BUCKETS]; // histogram of log2(gap in RTC ticks)
+} irda_bench_stats_t;
+
+/** @brief Copies out the accumulated link statistics, for the `irstat` shell dump. */
+void irda_bench_get_stats(irda_bench_stats_t *stats);
+
+/** @brief Clears the accumulated link statistics. */
+void irda_bench_reset_stats(void);
+
+typedef struct {
+    // frame parser
+    uint8_t parse_state;
+    uint8_t frame[8];
+    uint8_t frame_pos;
+
+    // cadence tracking
+    bool have_last;
+    uint16_t last_seq;
+    rtc_counter_t last_arrival;
+
+    uint8_t display_mode;
+} irda_bench_state_t;
+
+void irda_bench_face_setup(uint8_t watch_face_index, void ** context_ptr);
+void irda_bench_face_activate(void *context);
+bool irda_bench_face_loop(movement_event_t event, void *context);
+void irda_bench_face_resign(void *context);
+
+#define irda_bench_face ((const watch_face_t){ \
+    irda_bench_face_setup, \
+    irda_bench_face_activate, \
+    irda_bench_face_loop, \
+    irda_bench_face_resign, \
+    NULL, \
+})
+
+#endif // HAS_IR_SENSOR
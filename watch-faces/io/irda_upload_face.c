@@ -24,27 +24,191 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <stdio.h>
 #include "irda_upload_face.h"
 #include "tc.h"
 #include "eic.h"
 #include "usb.h"
 #include "uart.h"
+#include "watch_uart.h"
 #include "filesystem.h"
 
 #ifdef HAS_IR_SENSOR
 
+// DMA receive ring; sized for about a second of reception at 4x the current baud rate.
+#define IRDA_UPLOAD_RING_SIZE (512)
+static uint8_t *_irda_rx_ring;
+
+// Framing (multi-byte fields little-endian). Each frame starts with a two-byte
+// preamble, 0x55 0xAA, followed by:
+//   'H' <u16 total_size> <char filename[12]>   header; size 0 deletes the file
+//   'D' <u16 seq> <u8 len> <len payload bytes> data block
+// and ends with a CRC-16/CCITT of everything between the preamble and the CRC.
+// Data blocks carry IRDA_UPLOAD_BLOCK_SIZE bytes, except the last one, which
+// carries whatever remains. The sender may replay frames freely: blocks we
+// already hold are ignored, so one corrupt block only costs its retransmission.
+
+#define IRDA_FRAME_HEADER 'H'
+#define IRDA_FRAME_DATA 'D'
+
+enum {
+    IRDA_PARSE_SYNC_1 = 0,  // waiting for 0x55
+    IRDA_PARSE_SYNC_2,      // waiting for 0xAA
+    IRDA_PARSE_TYPE,        // waiting for the frame type byte
+    IRDA_PARSE_BODY,        // collecting the rest of the frame
+};
+
+static uint16_t _irda_crc16(const uint8_t *data, size_t length) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            if (crc & 0x8000) crc = (crc << 1) ^ 0x1021;
+            else crc <<= 1;
+        }
+    }
+    return crc;
+}
+
+static void _irda_end_transfer(irda_demo_state_t *state) {
+    if (state->file_buffer) {
+        free(state->file_buffer);
+        state->file_buffer = NULL;
+    }
+    state->block_count = 0;
+    state->blocks_received = 0;
+}
+
+static void _irda_handle_header(irda_demo_state_t *state) {
+    uint16_t total_size;
+    memcpy(&total_size, &state->frame[1], 2);
+    memcpy(state->filename, &state->frame[3], 12);
+    state->filename[12] = 0;
+
+    // a transfer was in flight? the sender started over; drop what we had.
+    _irda_end_transfer(state);
+
+    if (total_size == 0) {
+        // Success! All we need is a header to delete a file.
+        movement_force_led_on(0, 48, 0);
+        filesystem_rm(state->filename);
+        watch_display_text_with_fallback(WATCH_POSITION_TOP, "FILE ", "FI");
+        watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, "dELETE", " deLet");
+        return;
+    }
+
+    if (total_size > IRDA_UPLOAD_BLOCK_SIZE * IRDA_UPLOAD_MAX_BLOCKS) {
+        movement_force_led_on(48, 0, 0);
+        watch_display_text_with_fallback(WATCH_POSITION_TOP, "BAD  ", "BA");
+        watch_display_text(WATCH_POSITION_BOTTOM, "2LARGE");
+        return;
+    }
+
+    state->file_buffer = malloc(total_size);
+    if (state->file_buffer == NULL) return;
+    state->file_size = total_size;
+    state->block_count = (total_size + IRDA_UPLOAD_BLOCK_SIZE - 1) / IRDA_UPLOAD_BLOCK_SIZE;
+    memset(state->block_bitmap, 0, sizeof(state->block_bitmap));
+}
+
+static void _irda_handle_data(irda_demo_state_t *state) {
+    uint16_t seq;
+    memcpy(&seq, &state->frame[1], 2);
+    uint8_t len = state->frame[3];
+
+    // no transfer in flight (we may have missed the header), or bogus block
+    if (state->block_count == 0 || seq >= state->block_count) return;
+
+    uint16_t offset = seq * IRDA_UPLOAD_BLOCK_SIZE;
+    uint16_t expected_len = state->file_size - offset;
+    if (expected_len > IRDA_UPLOAD_BLOCK_SIZE) expected_len = IRDA_UPLOAD_BLOCK_SIZE;
+    if (len != expected_len) return;
+
+    // duplicate from a replay pass? we already have it.
+    if (state->block_bitmap[seq / 8] & (1 << (seq % 8))) return;
+
+    memcpy(&state->file_buffer[offset], &state->frame[4], len);
+    state->block_bitmap[seq / 8] |= 1 << (seq % 8);
+    state->blocks_received++;
+
+    if (state->blocks_received == state->block_count) {
+        // Valid and complete! Write it to the file system.
+        filesystem_write_file(state->filename, (char *)state->file_buffer, state->file_size);
+        watch_display_text_with_fallback(WATCH_POSITION_TOP, "RECVd", "RC");
+        movement_force_led_on(0, 48, 0);
+
+        char buf[8];
+        sprintf(buf, "%4db ", state->file_size);
+        watch_display_text(WATCH_POSITION_BOTTOM, buf);
+        _irda_end_transfer(state);
+    }
+}
+
+static void _irda_handle_frame(irda_demo_state_t *state) {
+    uint16_t expected_crc;
+    memcpy(&expected_crc, &state->frame[state->frame_len - 2], 2);
+    if (_irda_crc16(state->frame, state->frame_len - 2) != expected_crc) {
+        // corrupt frame: skip it. if it was a data block, a replay pass fills the hole.
+        return;
+    }
+
+    if (state->frame[0] == IRDA_FRAME_HEADER) _irda_handle_header(state);
+    else _irda_handle_data(state);
+}
+
+static void _irda_handle_byte(irda_demo_state_t *state, uint8_t byte) {
+    switch (state->parse_state) {
+        case IRDA_PARSE_SYNC_1:
+            if (byte == 0x55) state->parse_state = IRDA_PARSE_SYNC_2;
+            break;
+        case IRDA_PARSE_SYNC_2:
+            if (byte == 0xAA) state->parse_state = IRDA_PARSE_TYPE;
+            else if (byte != 0x55) state->parse_state = IRDA_PARSE_SYNC_1;
+            break;
+        case IRDA_PARSE_TYPE:
+            if (byte == IRDA_FRAME_HEADER) {
+                // type + size + filename + crc
+                state->frame_len = 1 + 2 + 12 + 2;
+            } else if (byte == IRDA_FRAME_DATA) {
+                // type + seq + len + payload (unknown until byte 3 arrives) + crc
+                state->frame_len = 1 + 2 + 1 + 2;
+            } else {
+                state->parse_state = IRDA_PARSE_SYNC_1;
+                break;
+            }
+            state->frame[0] = byte;
+            state->frame_pos = 1;
+            state->parse_state = IRDA_PARSE_BODY;
+            break;
+        case IRDA_PARSE_BODY:
+            state->frame[state->frame_pos++] = byte;
+            if (state->frame[0] == IRDA_FRAME_DATA && state->frame_pos == 4) {
+                if (byte > IRDA_UPLOAD_BLOCK_SIZE) {
+                    state->parse_state = IRDA_PARSE_SYNC_1;
+                    break;
+                }
+                state->frame_len += byte;
+            }
+            if (state->frame_pos == state->frame_len) {
+                _irda_handle_frame(state);
+                state->parse_state = IRDA_PARSE_SYNC_1;
+            }
+            break;
+    }
+}
+
 void irda_upload_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(irda_demo_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(irda_demo_state_t));
         memset(*context_ptr, 0, sizeof(irda_demo_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
-    }    
+    }
 }
 
 void irda_upload_face_activate(void *context) {
     irda_demo_state_t *state = (irda_demo_state_t *)context;
-    (void) state;
+    memset(state, 0, sizeof(irda_demo_state_t));
     HAL_GPIO_IR_ENABLE_out();
     HAL_GPIO_IR_ENABLE_clr();
     HAL_GPIO_IRSENSE_in();
@@ -52,83 +216,44 @@ void irda_upload_face_activate(void *context) {
     uart_init_instance(0, UART_TXPO_NONE, UART_RXPO_0, 900);
     uart_set_irda_mode_instance(0, true);
     uart_enable_instance(0);
+    // reception is DMA-fed: the DMAC fills the ring while the CPU sleeps, and its
+    // half-full interrupt wakes us to parse. no polling rate to keep up with, and
+    // the ring absorbs over five seconds of line-rate traffic between ticks.
+    _irda_rx_ring = malloc(IRDA_UPLOAD_RING_SIZE);
+    watch_uart_rx_dma_enable(0, _irda_rx_ring, IRDA_UPLOAD_RING_SIZE);
 }
 
 bool irda_upload_face_loop(movement_event_t event, void *context) {
     irda_demo_state_t *state = (irda_demo_state_t *)context;
-    (void) state;
 
     switch (event.event_type) {
         case EVENT_NONE:
         case EVENT_ACTIVATE:
         case EVENT_TICK:
         {
-            // need more work here: we seem to top out at 64 bytes coming in, and even then it takes a lot of tries.
-            char data[256];
-            size_t bytes_read = uart_read_instance(0, data, 256);
-            watch_clear_display();
-            watch_set_indicator(WATCH_INDICATOR_ARROWS);
-            if (watch_rtc_get_date_time().unit.second % 4 < 2) watch_display_text_with_fallback(WATCH_POSITION_TOP, "IrDA", "IR");
-            else watch_display_text_with_fallback(WATCH_POSITION_TOP, "FREE ", "DF");
-
-            if (bytes_read) {
-                // data is in the following format, where S is Size, F is Filename and C is checksum:
-                // SSFFFFFFFFFFFFCC
-                // after that, we get SS bytes of data, followed by a two-byte checksum
-                uint16_t expected_size = ((uint16_t *)data)[0];
-                uint16_t expected_checksum = ((uint16_t *)data)[7];
-
-                uint16_t checksum = 0;
-
-                for (size_t i = 0; i < 14; i++) checksum += data[i];
-
-                if (checksum != expected_checksum) {
-                    // failed
-                    movement_force_led_on(48, 0, 0);
-                    watch_display_text_with_fallback(WATCH_POSITION_TOP, "BAD  ", "BA");
-                    watch_display_text(WATCH_POSITION_BOTTOM, "HEAdER");
-                    break;
+            uint8_t data[64];
+            size_t bytes_read;
+            while ((bytes_read = watch_uart_rx_dma_read(data, sizeof(data))) > 0) {
+                for (size_t i = 0; i < bytes_read; i++) {
+                    _irda_handle_byte(state, data[i]);
                 }
-                // valid header! To make it easier on ourselves, we're going to make byte 14 zero...
-                data[14] = 0;
-                // so that now buf[2] points to our null-terminated filename.
-                char *filename = data + 2;
-
-                if (expected_size == 0) {
-                    // Success! All we need is a header to delete a file.
-                    movement_force_led_on(0, 48, 0);
-                    filesystem_rm(filename);
-                    watch_display_text_with_fallback(WATCH_POSITION_TOP, "FILE ", "FI");
-                    watch_display_text_with_fallback(WATCH_POSITION_TOP, "dELETE", " deLet");
-                    break;
-                }
-
-                // now let's check the data.
-                checksum = 0;
-                memcpy(&expected_checksum, data + 16 + expected_size, 2);
-                for (uint16_t i = 16; i < 16 + expected_size; i++) checksum += data[i];
-
-                if (checksum != expected_checksum) {
-                    // failed
-                    movement_force_led_on(48, 0, 0);
-                    watch_display_text_with_fallback(WATCH_POSITION_TOP, "BAD  ", "BA");
-                    watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, "data  ", " data ");
-                    break;
-                }
-
-                // Valid data! Write it to the file system.
-                filesystem_write_file(filename, data + 16, expected_size);
-                watch_display_text_with_fallback(WATCH_POSITION_TOP, "RECVd", "RC");
-                movement_force_led_on(0, 48, 0);
+            }
 
+            watch_set_indicator(WATCH_INDICATOR_ARROWS);
+            if (state->block_count) {
+                // transfer in flight: show received blocks over total
+                if (watch_rtc_get_date_time().unit.second % 4 < 2) watch_display_text_with_fallback(WATCH_POSITION_TOP, "IrDA", "IR");
                 char buf[8];
-                sprintf(buf, "%4db ", expected_size);
+                sprintf(buf, "%3d%3d", state->blocks_received, state->block_count);
                 watch_display_text(WATCH_POSITION_BOTTOM, buf);
-            } else {
+            } else if (event.event_type != EVENT_NONE && (watch_rtc_get_date_time().unit.second % 4) < 2) {
                 movement_force_led_off();
+                watch_display_text_with_fallback(WATCH_POSITION_TOP, "IrDA", "IR");
                 char buf[7];
                 snprintf(buf, 7, "%4ld b", filesystem_get_free_space());
                 watch_display_text(WATCH_POSITION_BOTTOM, buf);
+            } else if (event.event_type != EVENT_NONE) {
+                watch_display_text_with_fallback(WATCH_POSITION_TOP, "FREE ", "DF");
             }
         }
             break;
@@ -150,7 +275,11 @@ bool irda_upload_face_loop(movement_event_t event, void *context) {
 }
 
 void irda_upload_face_resign(void *context) {
-    (void) context;
+    irda_demo_state_t *state = (irda_demo_state_t *)context;
+    _irda_end_transfer(state);
+    watch_uart_rx_dma_disable();
+    free(_irda_rx_ring);
+    _irda_rx_ring = NULL;
     uart_disable_instance(0);
     HAL_GPIO_IRSENSE_pmuxdis();
     HAL_GPIO_IRSENSE_off();
@@ -29,15 +29,34 @@
 #ifdef HAS_IR_SENSOR
 
 /*
- * LIGHT SENSOR PLAYGROUND
- *
- * Temporary watch face for playing with the light sensor.
+ * IrDA UPLOAD
  *
+ * Receives files over the IR photodiode using a block protocol: the sender
+ * streams sequence-numbered, CRC-checked blocks, and the face assembles them
+ * into a buffer with a bitmap of what has landed. The link is receive-only,
+ * so there are no acknowledgments; the sender simply replays the stream (or
+ * just the tail of it), and only blocks that are still missing are taken from
+ * the replay. A glitch costs one block, not the whole transfer.
  */
 
+// Largest file we will accept: IRDA_UPLOAD_MAX_BLOCKS * IRDA_UPLOAD_BLOCK_SIZE bytes.
+#define IRDA_UPLOAD_BLOCK_SIZE (64)
+#define IRDA_UPLOAD_MAX_BLOCKS (128)
+
 typedef struct {
-    // Anything you need to keep track of, put it here!
-    uint8_t unused;
+    // frame parser
+    uint8_t parse_state;
+    uint8_t frame[IRDA_UPLOAD_BLOCK_SIZE + 6];
+    uint8_t frame_pos;
+    uint8_t frame_len;
+
+    // transfer in progress
+    uint8_t *file_buffer;
+    uint16_t file_size;
+    uint8_t block_count;
+    uint8_t blocks_received;
+    uint8_t block_bitmap[IRDA_UPLOAD_MAX_BLOCKS / 8];
+    char filename[13];
 } irda_demo_state_t;
 
 void irda_upload_face_setup(uint8_t watch_face_index, void ** context_ptr);
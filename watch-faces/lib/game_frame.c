@@ -0,0 +1,91 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "game_frame.h"
+#include "watch_rtc.h"
+
+static game_frame_stats_t _stats;
+static rtc_counter_t _frame_start;
+static bool _skip_render;
+static bool _in_frame;
+
+void game_frame_begin(uint8_t tick_frequency) {
+    _stats.budget_ticks = (uint16_t)(watch_rtc_get_frequency() / tick_frequency);
+    _frame_start = watch_rtc_get_counter();
+    if (_skip_render) _stats.skipped_renders++;
+    _in_frame = true;
+}
+
+bool game_frame_should_skip_render(void) {
+    return _skip_render;
+}
+
+void game_frame_end(void) {
+    if (!_in_frame) return;
+    _in_frame = false;
+    uint32_t ticks = watch_rtc_get_counter() - _frame_start;
+    _stats.frames++;
+    _stats.total_ticks += ticks;
+    if (ticks > _stats.max_frame_ticks) _stats.max_frame_ticks = (uint16_t)ticks;
+    // degrade for one frame only; a persistent overrun shows up in the stats
+    _skip_render = (ticks > _stats.budget_ticks);
+    if (_skip_render) _stats.overruns++;
+}
+
+void game_frame_get_stats(game_frame_stats_t *stats) {
+    *stats = _stats;
+}
+
+void game_frame_reset_stats(void) {
+    uint16_t budget = _stats.budget_ticks;
+    _stats = (game_frame_stats_t){ 0 };
+    _stats.budget_ticks = budget;
+}
+
+int32_t game_frame_lerp(int32_t from, int32_t to, int32_t numerator, int32_t denominator) {
+    if (denominator == 0) return from;
+    int32_t value = from + ((to - from) * numerator + denominator / 2) / denominator;
+    int32_t lo = (from < to) ? from : to;
+    int32_t hi = (from < to) ? to : from;
+    if (value < lo) return lo;
+    if (value > hi) return hi;
+    return value;
+}
+
+uint16_t game_frame_isqrt(uint32_t value) {
+    // binary digit-by-digit method; at most 16 iterations, no division
+    uint32_t root = 0;
+    uint32_t bit = 1ul << 30;
+    while (bit > value) bit >>= 2;
+    while (bit != 0) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint16_t)root;
+}
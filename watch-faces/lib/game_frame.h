@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAME_FRAME_H_
+#define GAME_FRAME_H_
+
+/*
+ * Shared frame timing for game faces.
+ *
+ * Game faces run their simulation inside movement tick events at 8 Hz or
+ * more, with no feedback on whether a frame's work actually fits the tick
+ * interval. These helpers time each frame against the RTC counter (the only
+ * free-running timebase on this part; the M0+ has no cycle counter). When a
+ * frame overruns its budget, game_frame_should_skip_render() reports true
+ * for the next frame so the face can drop pure display work while the
+ * simulation keeps pace. Only one game face is active at a time, so the
+ * stats are a single shared block, printed from the shell with `framestat`.
+ *
+ * Also home to small integer math helpers shared by game physics, so faces
+ * don't each pull in soft-float routines for a lerp or a square root.
+ */
+
+#include "watch.h"
+
+typedef struct {
+    uint32_t frames;          // frames timed since boot or last reset
+    uint32_t total_ticks;     // RTC ticks spent inside timed frames
+    uint16_t max_frame_ticks; // RTC ticks of the longest single frame
+    uint16_t budget_ticks;    // current per-frame budget (one tick interval)
+    uint16_t overruns;        // frames that exceeded the budget
+    uint16_t skipped_renders; // frames that dropped display work to catch up
+} game_frame_stats_t;
+
+/** @brief Call at the top of each game tick, with the face's tick frequency. */
+void game_frame_begin(uint8_t tick_frequency);
+
+/** @brief True when the previous frame overran its budget; skip pure display
+  *        work this frame and let the simulation catch up.
+  */
+bool game_frame_should_skip_render(void);
+
+/** @brief Call after the frame's update and render work is done. */
+void game_frame_end(void);
+
+void game_frame_get_stats(game_frame_stats_t *stats);
+void game_frame_reset_stats(void);
+
+/** @brief Integer linear interpolation from `from` toward `to` by
+  *        numerator/denominator, rounded to nearest and clamped to the
+  *        [from, to] range. Replaces float ratio math in game physics.
+  */
+int32_t game_frame_lerp(int32_t from, int32_t to, int32_t numerator, int32_t denominator);
+
+/** @brief Integer square root, rounded down. */
+uint16_t game_frame_isqrt(uint32_t value);
+
+#endif // GAME_FRAME_H_
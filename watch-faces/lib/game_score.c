@@ -0,0 +1,90 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "game_score.h"
+#include "filesystem.h"
+
+// every initialized store, so one idle task can archive whichever are dirty.
+// three game faces ship today; four leaves a slot for the next one.
+#define GAME_SCORE_MAX_STORES 4
+static game_score_t *_stores[GAME_SCORE_MAX_STORES];
+static uint8_t _store_count;
+
+// archives one dirty store per slice; littlefs commits are the expensive part,
+// so let the scheduler's budget decide whether a second one fits this window.
+static bool _game_score_idle_task(void) {
+    for (uint8_t i = 0; i < _store_count; i++) {
+        if (!_stores[i]->dirty) continue;
+        _stores[i]->dirty = false;
+        filesystem_write_file(_stores[i]->filename, (char *)&_stores[i]->value, sizeof(uint32_t));
+        // report leftover work if any other store is still dirty
+        for (uint8_t j = i + 1; j < _store_count; j++) {
+            if (_stores[j]->dirty) return true;
+        }
+        return false;
+    }
+    return false;
+}
+
+uint32_t game_score_init(game_score_t *store, uint32_t tag, const char *filename) {
+    bool restored = false;
+
+    memset(store, 0, sizeof(game_score_t));
+    strncpy(store->filename, filename, sizeof(store->filename) - 1);
+    store->reg = movement_claim_tagged_backup_register(tag, &restored);
+
+    if (restored) {
+        // the register survived the reset; it is the freshest copy there is.
+        store->value = movement_get_tagged_backup_data(store->reg);
+    } else {
+        // fresh register: a battery swap or first boot. The archive, if one
+        // exists, carries the score across the swap.
+        uint32_t archived = 0;
+        if (filesystem_read_file(store->filename, (char *)&archived, sizeof(uint32_t))) {
+            store->value = archived & 0xFFFFFF;
+        }
+        if (store->reg) movement_set_tagged_backup_data(store->value, store->reg);
+    }
+
+    if (_store_count < GAME_SCORE_MAX_STORES) {
+        _stores[_store_count++] = store;
+        movement_register_idle_task(_game_score_idle_task, MOVEMENT_IDLE_PRIORITY_OPPORTUNISTIC);
+    }
+
+    return store->value;
+}
+
+uint32_t game_score_get(game_score_t *store) {
+    return store->value;
+}
+
+void game_score_set(game_score_t *store, uint32_t value) {
+    value &= 0xFFFFFF;
+    if (value == store->value) return;
+    store->value = value;
+    // hot copy now, wear-free; the flash archive catches up in an idle window
+    if (store->reg) movement_set_tagged_backup_data(value, store->reg);
+    store->dirty = true;
+}
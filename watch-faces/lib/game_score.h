@@ -0,0 +1,74 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAME_SCORE_H_
+#define GAME_SCORE_H_
+
+/*
+ * Persistent high scores and streaks for game faces.
+ *
+ * Game scores used to live in face context RAM and die on reset, and giving
+ * each game its own filesystem write per game-over would cost latency at the
+ * moment of defeat and flash wear over thousands of games. A game_score_t
+ * layers the two stores the platform already has: the hot copy lives in a
+ * tagged RTC backup register (instant and wear-free, survives any reset),
+ * and a lazy archive to a littlefs file runs from the idle work scheduler,
+ * so the value also survives a battery swap. In the common case a game over
+ * costs one register store; flash is only touched during idle windows, and
+ * only when the value actually changed.
+ *
+ * The payload is the backup registry's 24 bits. Pack what you need — a score,
+ * a streak plus the day it was earned — and keep the packing stable, since
+ * archived values come back through the same unpacking on a fresh battery.
+ */
+
+#include "movement.h"
+
+typedef struct {
+    uint32_t value; // current 24-bit payload
+    uint8_t reg;    // tagged backup register, 0 if none was available
+    bool dirty;     // archive write pending in the idle scheduler
+    char filename[16];
+} game_score_t;
+
+/** @brief Claims the backup register and loads the best surviving copy of the score.
+  * @details Prefers the backup register (warm across any reset); falls back to the
+  *          filesystem archive after a battery swap, and to 0 on a truly fresh watch.
+  *          Call once from your face's setup, in the one-time-allocation branch.
+  * @param store Storage for the score, typically a member of your face's context.
+  * @param tag A tag built with MOVEMENT_BACKUP_TAG, unique to your face.
+  * @param filename The archive file, 15 characters or less.
+  * @return The current payload, for unpacking into your face's state.
+  */
+uint32_t game_score_init(game_score_t *store, uint32_t tag, const char *filename);
+
+/** @brief The current payload. */
+uint32_t game_score_get(game_score_t *store);
+
+/** @brief Stores a new payload: backup register immediately, archive file lazily.
+  *        Values above 24 bits are truncated; storing the same value is free.
+  */
+void game_score_set(game_score_t *store, uint32_t value);
+
+#endif // GAME_SCORE_H_
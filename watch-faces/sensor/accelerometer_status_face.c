@@ -38,15 +38,34 @@ static void _accelerometer_status_face_update_display(accel_interrupt_count_stat
     // sensing is live!
     watch_set_indicator(WATCH_INDICATOR_SIGNAL);
 
-    // Sleep/active state
-    if (HAL_GPIO_A4_read()) watch_display_text(WATCH_POSITION_BOTTOM, "Still ");
-    else watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, "Active", " ACtiv");
+    // Sleep/active state, from the classification movement already tracks via the
+    // INT2 interrupt. No bus traffic, no pin read: the display is event-driven.
+    if (movement_wearer_is_active()) watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, "Active", " ACtiv");
+    else watch_display_text(WATCH_POSITION_BOTTOM, "Still ");
+}
+
+static void _accelerometer_status_face_show_raw(accel_interrupt_count_state_t *state) {
+    char buf[8];
+
+    // the one place this face touches the I2C bus: a spot check of the raw
+    // classifier registers, on request.
+    uint8_t wake_src = (uint8_t)lis2dw_get_wakeup_source();
+    uint8_t int_src = (uint8_t)lis2dw_get_interrupt_source();
+
+    watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
+    watch_display_text_with_fallback(WATCH_POSITION_TOP, "RAWrg", "RA");
+    sprintf(buf, "%02x  %02x", wake_src, int_src);
+    watch_display_text(WATCH_POSITION_BOTTOM, buf);
+
+    // hold the view for a few seconds, then drop back to tickless status display.
+    state->raw_ticks = 3;
+    movement_request_tick_frequency(1);
 }
 
 void accelerometer_status_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(accel_interrupt_count_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(accel_interrupt_count_state_t));
         memset(*context_ptr, 0, sizeof(accel_interrupt_count_state_t));
     }
 }
@@ -56,9 +75,11 @@ void accelerometer_status_face_activate(void *context) {
 
     // never in settings mode at the start
     state->is_setting = false;
+    state->raw_ticks = 0;
 
-    // update more quickly to catch changes, also to blink setting
-    movement_request_tick_frequency(4);
+    // the status display only changes when the classifier does, and those changes
+    // arrive as events; no periodic tick needed at all.
+    movement_request_tick_frequency(0);
 
     // fetch current threshold from accelerometer
     state->threshold = movement_get_accelerometer_motion_threshold();
@@ -92,6 +113,8 @@ bool accelerometer_status_face_loop(movement_event_t event, void *context) {
                 state->threshold = state->new_threshold;
                 watch_clear_decimal_if_available();
                 state->is_setting = false;
+                movement_request_tick_frequency(0);
+                _accelerometer_status_face_update_display(state);
                 break;
             case EVENT_TIMEOUT:
                 movement_move_to_face(0);
@@ -102,10 +125,21 @@ bool accelerometer_status_face_loop(movement_event_t event, void *context) {
         }
     } else {
         switch (event.event_type) {
-            case EVENT_ACTIVATE:
             case EVENT_TICK:
+                if (state->raw_ticks) {
+                    // counting down the raw-register view
+                    if (--state->raw_ticks) break;
+                    movement_request_tick_frequency(0);
+                }
+                // fall through
+            case EVENT_ACTIVATE:
+            case EVENT_ACCELEROMETER_WAKE:
+            case EVENT_ACCELEROMETER_SLEEP:
                 _accelerometer_status_face_update_display(state);
                 break;
+            case EVENT_ALARM_BUTTON_UP:
+                _accelerometer_status_face_show_raw(state);
+                break;
             case EVENT_LOW_ENERGY_UPDATE:
                 // start tick animation if necessary
                 if (!watch_sleep_animation_is_running()) watch_start_sleep_animation(1000);
@@ -117,6 +151,9 @@ bool accelerometer_status_face_loop(movement_event_t event, void *context) {
             case EVENT_ALARM_LONG_PRESS:
                 state->new_threshold = state->threshold;
                 state->is_setting = true;
+                state->raw_ticks = 0;
+                // settings mode blinks, so it does need a fast tick
+                movement_request_tick_frequency(4);
                 return false;
             default:
                 movement_default_loop_handler(event);
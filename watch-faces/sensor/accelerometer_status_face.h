@@ -27,11 +27,13 @@
 /*
  * Accelerometer Status / Settings
  *
- * Meant to be used in conjunction with the activity_logging_face. Shows the current
- * status of the accelerometer active/still status pin, and allows adjusting the
- * motion threshold via a long press of ALARM. Note that this will not work without
- * activity_logging_face in the lineup as activity_logging_face is the one that enables
- * background accelerometer sensing.
+ * Meant to be used in conjunction with the activity_logging_face. Shows the wearer
+ * active/still classification, driven entirely by the accelerometer's interrupt
+ * events — the face runs tickless and touches neither the I2C bus nor the status
+ * pin. A short press of ALARM spot-checks the raw WAKE_UP_SRC and ALL_INT_SRC
+ * registers over the bus; a long press of ALARM adjusts the motion threshold.
+ * Note that this will not work without activity_logging_face in the lineup as
+ * activity_logging_face is the one that enables background accelerometer sensing.
  */
 
 #include "movement.h"
@@ -40,6 +42,7 @@
 typedef struct {
     uint8_t new_threshold;
     uint8_t threshold;
+    uint8_t raw_ticks;
     bool is_setting;
 } accel_interrupt_count_state_t;
 
@@ -26,6 +26,7 @@
 #include <string.h>
 #include "activity_logging_face.h"
 #include "filesystem.h"
+#include "ring_log.h"
 #include "watch.h"
 #include "watch_utility.h"
 
@@ -68,13 +69,117 @@ static void _activity_logging_face_update_display(activity_logging_state_t *stat
     }
 }
 
+// Runs are capped at 63 minutes so a run byte is never 0xFF: the ring log pads
+// payloads shorter than RING_LOG_PAYLOAD_SIZE with 0xFF, and decoders rely on
+// that value to find the end of a record flushed early (i.e. at midnight).
+#define ACTIVITY_RUN_MAX (63)
+
+static void _activity_logging_flush_record(activity_logging_state_t *state) {
+    if (state->rle_len == 0) return;
+    ring_log_append(RING_LOG_TYPE_ACTIVITY_RLE, state->span_start_reg, state->rle_buf, state->rle_len);
+    state->rle_len = 0;
+}
+
+static void _activity_logging_close_run(activity_logging_state_t *state) {
+    if (state->run_length == 0) return;
+    if (state->rle_len == 0) state->span_start_reg = state->run_start_reg;
+    state->rle_buf[state->rle_len++] = (state->run_class << 6) | (state->run_length - 1);
+    state->run_length = 0;
+    if (state->rle_len == RING_LOG_PAYLOAD_SIZE) _activity_logging_flush_record(state);
+}
+
+static void _activity_logging_log_minute(activity_logging_state_t *state, uint8_t activity_class) {
+    if (state->run_length > 0 && activity_class == state->run_class && state->run_length < ACTIVITY_RUN_MAX) {
+        state->run_length++;
+    } else {
+        _activity_logging_close_run(state);
+        state->run_class = activity_class;
+        state->run_length = 1;
+        state->run_start_reg = watch_rtc_get_date_time().reg;
+    }
+}
+
+// Decodes one record's worth of run bytes into active minutes (classes ACTIVE
+// and up; STIRRING is a lone minute and doesn't count, matching the live rule).
+static uint16_t _activity_logging_record_active_minutes(const ring_log_record_t *record) {
+    uint16_t active = 0;
+    for (int i = 0; i < RING_LOG_PAYLOAD_SIZE; i++) {
+        uint8_t run = record->data[i];
+        if (run == 0xFF) break;  // erased filler: the record ended early
+        if ((run >> 6) >= ACTIVITY_CLASS_ACTIVE) active += (run & 0x3F) + 1;
+    }
+    return active;
+}
+
+typedef struct {
+    activity_logging_state_t *state;
+    uint32_t today_days;    // today as whole days since the unix epoch
+    uint32_t current_days;  // the day the last decoded record belonged to
+} activity_logging_rebuild_t;
+
+static bool _activity_logging_rebuild_cb(const ring_log_record_t *record, void *context) {
+    activity_logging_rebuild_t *rebuild = (activity_logging_rebuild_t *)context;
+    activity_logging_state_t *state = rebuild->state;
+    if (record->type != RING_LOG_TYPE_ACTIVITY_RLE) return true;
+
+    watch_date_time_t timestamp;
+    timestamp.reg = record->timestamp;
+    uint32_t days = watch_utility_date_time_to_unix_time(timestamp, movement_get_current_timezone_offset()) / 86400;
+
+    // the timestamp alone tells us whether the record is worth decoding
+    if (rebuild->today_days - days > ACTIVITY_LOGGING_NUM_DAYS) return true;
+
+    uint16_t active = _activity_logging_record_active_minutes(record);
+
+    if (days >= rebuild->today_days) {
+        // records flushed since last midnight: today's running count
+        state->active_minutes_today += active;
+        return true;
+    }
+
+    if (days != rebuild->current_days) {
+        // advance one slot per calendar day so "N days ago" stays aligned,
+        // zeroing any days the watch spent powered down
+        uint32_t gap = (rebuild->current_days == 0) ? 1 : days - rebuild->current_days;
+        if (gap > ACTIVITY_LOGGING_NUM_DAYS) gap = ACTIVITY_LOGGING_NUM_DAYS;
+        while (gap--) {
+            state->activity_log[state->data_points % ACTIVITY_LOGGING_NUM_DAYS] = 0;
+            state->data_points++;
+        }
+        rebuild->current_days = days;
+    }
+    state->activity_log[(state->data_points - 1) % ACTIVITY_LOGGING_NUM_DAYS] += active;
+
+    return true;
+}
+
 void activity_logging_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(activity_logging_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(activity_logging_state_t));
         memset(*context_ptr, 0, sizeof(activity_logging_state_t));
         // At first run, tell Movement to run the accelerometer in the background. It will now run at this rate forever.
         movement_set_accelerometer_background_rate(LIS2DW_DATA_RATE_LOWEST);
+        // no-op on boards without the Sensor Board's SPI flash.
+        if (ring_log_mount()) {
+            // bring the last two weeks of history back from the log
+            activity_logging_rebuild_t rebuild = { 0 };
+            rebuild.state = (activity_logging_state_t *)*context_ptr;
+            rebuild.today_days = watch_utility_date_time_to_unix_time(movement_get_local_date_time(),
+                                                                      movement_get_current_timezone_offset()) / 86400;
+            ring_log_iterate(_activity_logging_rebuild_cb, &rebuild);
+            // if the newest logged day isn't yesterday, pad the gap so the
+            // "N days ago" slots line up with the calendar
+            if (rebuild.current_days != 0 && rebuild.today_days - 1 > rebuild.current_days) {
+                activity_logging_state_t *state = (activity_logging_state_t *)*context_ptr;
+                uint32_t gap = rebuild.today_days - 1 - rebuild.current_days;
+                if (gap > ACTIVITY_LOGGING_NUM_DAYS) gap = ACTIVITY_LOGGING_NUM_DAYS;
+                while (gap--) {
+                    state->activity_log[state->data_points % ACTIVITY_LOGGING_NUM_DAYS] = 0;
+                    state->data_points++;
+                }
+            }
+        }
     }
 }
 
@@ -114,6 +219,10 @@ bool activity_logging_face_loop(movement_event_t event, void *context) {
                 size_t pos = state->data_points % ACTIVITY_LOGGING_NUM_DAYS;
                 state->activity_log[pos] = state->active_minutes_today;
                 state->data_points++;
+                // flush the day's pending run bytes to the external flash ring
+                // log (if this board has one), so no record spans two days.
+                _activity_logging_close_run(state);
+                _activity_logging_flush_record(state);
                 state->active_minutes_today = 0;
             }
             break;
@@ -144,14 +253,21 @@ movement_watch_face_advisory_t activity_logging_face_advise(void *context) {
     activity_logging_state_t *state = (activity_logging_state_t *)context;
     movement_watch_face_advisory_t retval = { 0 };
 
-    if (!HAL_GPIO_A4_read()) {
-        // only count this as an active minute if the previous minute was also active.
-        // otherwise, set the flag and we'll count the next minute if the wearer is still active.
-        if (state->previous_minute_was_active) state->active_minutes_today++;
-        else state->previous_minute_was_active = true;
+    uint8_t activity_class;
+    if (movement_wearer_is_active()) {
+        if (state->active_streak < 255) state->active_streak++;
+        // only count this as an active minute if the previous minute was also active;
+        // a lone active minute is recorded as STIRRING and we'll count the next
+        // minute if the wearer is still at it.
+        if (state->active_streak >= 15) activity_class = ACTIVITY_CLASS_SUSTAINED;
+        else if (state->active_streak >= 2) activity_class = ACTIVITY_CLASS_ACTIVE;
+        else activity_class = ACTIVITY_CLASS_STIRRING;
+        if (state->active_streak >= 2) state->active_minutes_today++;
     } else {
-        state->previous_minute_was_active = false;
+        state->active_streak = 0;
+        activity_class = ACTIVITY_CLASS_STILL;
     }
+    _activity_logging_log_minute(state, activity_class);
 
     watch_date_time_t datetime = movement_get_local_date_time();
     // request a background task at midnight to shuffle the data into the log
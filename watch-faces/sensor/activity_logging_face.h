@@ -43,6 +43,16 @@
  * A short press of the Light button moves forward in the data log, looping around if we're on the most-recent day.
  * Holding the Light button will illuminate the display.
  *
+ * On boards with the Sensor Board's SPI flash, the face also keeps a per-minute activity
+ * history in the ring log. Each minute is classified into one of four classes (still,
+ * stirring, active, sustained) and consecutive identical minutes are run-length coded:
+ * a run byte packs the 2-bit class with a 6-bit run length, so a night of stillness
+ * costs one byte where fixed per-minute records would cost hundreds. A record is only
+ * written when ten run bytes have accumulated (or at midnight, so no record spans two
+ * days), and its timestamp marks the first minute it covers — which doubles as an
+ * index: readers seeking a date range skip records on the timestamp alone without
+ * decoding payloads. The 14-day display is rebuilt from this log at boot, so the
+ * history now survives a reset.
  */
 
 #include "movement.h"
@@ -50,12 +60,24 @@
 
 #define ACTIVITY_LOGGING_NUM_DAYS (14)
 
+// 2-bit per-minute activity classes stored in the ring log.
+#define ACTIVITY_CLASS_STILL (0)        // wearer idle (or watch off wrist)
+#define ACTIVITY_CLASS_STIRRING (1)     // a single active minute, not yet sustained
+#define ACTIVITY_CLASS_ACTIVE (2)       // two or more consecutive active minutes
+#define ACTIVITY_CLASS_SUSTAINED (3)    // fifteen or more: a workout-length block
+
 typedef struct {
     uint16_t activity_log[ACTIVITY_LOGGING_NUM_DAYS];   // the activity log
     uint16_t data_points;                               // the number of days logged
     uint8_t display_index;                              // the index we are displaying on screen
     uint16_t active_minutes_today;                      // the number of active minutes logged today
-    bool previous_minute_was_active;                    // we only want to count two or more consecutive active minutes
+    uint8_t active_streak;                              // consecutive active minutes, for classification
+    uint8_t run_class;                                  // class of the run currently being extended
+    uint8_t run_length;                                 // minutes in that run so far (0 = no open run)
+    uint8_t rle_len;                                    // run bytes accumulated toward the next record
+    uint8_t rle_buf[10];                                // those run bytes (RING_LOG_PAYLOAD_SIZE)
+    uint32_t run_start_reg;                             // timestamp of the open run's first minute
+    uint32_t span_start_reg;                            // timestamp of the pending record's first minute
 } activity_logging_state_t;
 
 void activity_logging_face_setup(uint8_t watch_face_index, void ** context_ptr);
@@ -0,0 +1,231 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "battery_runtime_face.h"
+#include "watch.h"
+#include "watch_power.h"
+
+// the cell is done when Movement's critical power tier engages; project to there,
+// not to the cell's absolute minimum. Matches MOVEMENT_VCC_CRITICAL_MILLIVOLTS.
+#define BATTERY_RUNTIME_EMPTY_MILLIVOLTS 2400
+
+// nominal CR2016 capacity at wristwatch loads, in microamp-hours
+#define BATTERY_RUNTIME_CAPACITY_UAH 90000
+
+// the trend estimate needs this many midnight samples before it participates;
+// fewer than four days of decline is mostly ADC noise.
+#define BATTERY_RUNTIME_MIN_TREND_SAMPLES 4
+
+// Rough average draw of each ledger peripheral while enabled, in microamps.
+// These don't need to be exact: they convert duty factors into a load estimate,
+// and the dominant terms (LED, buzzer) dwarf any error in the small ones.
+static const uint16_t _peripheral_microamps[WATCH_POWER_PERIPHERAL_COUNT] = {
+    800,    // WATCH_POWER_ADC
+    400,    // WATCH_POWER_I2C
+    1500,   // WATCH_POWER_SPI
+    500,    // WATCH_POWER_UART
+    2500,   // WATCH_POWER_BUZZER
+    8000,   // WATCH_POWER_LEDS
+};
+
+// standby floor (RTC + LCD) and the extra draw while the CPU is awake, in microamps
+#define BATTERY_RUNTIME_STANDBY_MICROAMPS 8
+#define BATTERY_RUNTIME_CPU_RUN_MICROAMPS 1500
+
+// CR2016 open-circuit voltage to remaining capacity, coarse piecewise-linear.
+// Lithium manganese cells are flat through the middle of their life, which is
+// exactly why the trend estimate exists; this table mostly matters at the ends.
+static const struct {
+    uint16_t millivolts;
+    uint8_t percent;
+} _capacity_curve[] = {
+    { 3000, 100 },
+    { 2900, 75 },
+    { 2800, 45 },
+    { 2700, 25 },
+    { 2600, 12 },
+    { 2500, 5 },
+    { BATTERY_RUNTIME_EMPTY_MILLIVOLTS, 0 },
+};
+
+static uint8_t _capacity_percent(uint16_t millivolts) {
+    if (millivolts >= _capacity_curve[0].millivolts) return 100;
+    for (uint8_t i = 1; i < sizeof(_capacity_curve) / sizeof(_capacity_curve[0]); i++) {
+        if (millivolts >= _capacity_curve[i].millivolts) {
+            uint16_t span_mv = _capacity_curve[i - 1].millivolts - _capacity_curve[i].millivolts;
+            uint8_t span_pct = _capacity_curve[i - 1].percent - _capacity_curve[i].percent;
+            return _capacity_curve[i].percent + (uint8_t)(((uint32_t)(millivolts - _capacity_curve[i].millivolts) * span_pct) / span_mv);
+        }
+    }
+    return 0;
+}
+
+// average load from the power ledger's duty factors plus CPU awake time, in microamps
+static uint16_t _estimate_load_microamps(void) {
+    movement_wake_stats_t stats;
+    movement_get_wake_stats(&stats);
+
+    uint32_t elapsed = (rtc_counter_t)(watch_rtc_get_counter() - stats.start_counter);
+    if (elapsed == 0) return BATTERY_RUNTIME_STANDBY_MICROAMPS;
+
+    // scale duty factors in 1/65536ths to keep the math in 32 bits
+    uint32_t load = BATTERY_RUNTIME_STANDBY_MICROAMPS << 16;
+    load += (uint64_t)stats.busy_ticks * BATTERY_RUNTIME_CPU_RUN_MICROAMPS * 65536 / elapsed;
+    for (uint8_t i = 0; i < WATCH_POWER_PERIPHERAL_COUNT; i++) {
+        watch_power_entry_t entry;
+        watch_power_get_entry((watch_power_peripheral_t)i, &entry);
+        load += (uint64_t)entry.on_ticks * _peripheral_microamps[i] * 65536 / elapsed;
+    }
+    load >>= 16;
+    return load > 0xFFFF ? 0xFFFF : (uint16_t)load;
+}
+
+static void _recompute_projection(battery_runtime_state_t *state) {
+    uint16_t millivolts = state->daily_millivolts[state->sample_count - 1];
+    int32_t days = -1;
+
+    // load estimate: capacity remaining at this voltage over the measured draw
+    state->load_microamps = _estimate_load_microamps();
+    if (state->load_microamps > 0) {
+        days = ((uint32_t)BATTERY_RUNTIME_CAPACITY_UAH * _capacity_percent(millivolts) / 100)
+            / ((uint32_t)state->load_microamps * 24);
+    }
+
+    // trend estimate: extrapolate the measured decline to the critical threshold.
+    // take the more pessimistic of the two when both are available.
+    if (state->sample_count >= BATTERY_RUNTIME_MIN_TREND_SAMPLES) {
+        int32_t decline = (int32_t)state->daily_millivolts[0] - millivolts;
+        if (decline > 0) {
+            int32_t trend_days = ((int32_t)millivolts - BATTERY_RUNTIME_EMPTY_MILLIVOLTS)
+                * (state->sample_count - 1) / decline;
+            if (days < 0 || trend_days < days) days = trend_days;
+        }
+    }
+
+    if (days > 999) days = 999;
+    state->projected_days = (int16_t)days;
+}
+
+static void _take_daily_sample(battery_runtime_state_t *state) {
+    uint8_t capacity = sizeof(state->daily_millivolts) / sizeof(state->daily_millivolts[0]);
+    if (state->sample_count == capacity) {
+        memmove(&state->daily_millivolts[0], &state->daily_millivolts[1], (capacity - 1) * sizeof(uint16_t));
+        state->sample_count--;
+    }
+    state->daily_millivolts[state->sample_count++] = watch_get_vcc_voltage();
+    _recompute_projection(state);
+}
+
+static void _battery_runtime_update_display(battery_runtime_state_t *state) {
+    char buf[8];
+
+    watch_display_text(WATCH_POSITION_TOP_LEFT, "BA");
+    sprintf(buf, "%2u", (unsigned int)state->sample_count);
+    watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
+
+    switch (state->display_mode) {
+        case 0:
+            // projected days remaining; dashes until the first recompute lands
+            if (state->projected_days < 0) {
+                watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, " --- d", "---d");
+            } else {
+                sprintf(buf, "%4d d", state->projected_days);
+                watch_display_text(WATCH_POSITION_BOTTOM, buf);
+            }
+            break;
+        case 1:
+            // the newest midnight sample, as volts
+            watch_display_float_with_best_effort(state->daily_millivolts[state->sample_count - 1] / 1000.0f, " V");
+            break;
+        default:
+            // estimated average load, for diagnosing a short projection
+            sprintf(buf, "%4uUA", (unsigned int)state->load_microamps);
+            watch_display_text(WATCH_POSITION_BOTTOM, buf);
+            break;
+    }
+}
+
+void battery_runtime_face_setup(uint8_t watch_face_index, void ** context_ptr) {
+    (void) watch_face_index;
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(battery_runtime_state_t));
+        memset(*context_ptr, 0, sizeof(battery_runtime_state_t));
+        battery_runtime_state_t *state = (battery_runtime_state_t *)*context_ptr;
+        state->projected_days = -1;
+        // a first sample at boot gives the voltage and load views something to
+        // show; the trend starts accumulating at the next midnight.
+        _take_daily_sample(state);
+    }
+}
+
+void battery_runtime_face_activate(void *context) {
+    battery_runtime_state_t *state = (battery_runtime_state_t *)context;
+    state->display_mode = 0;
+}
+
+bool battery_runtime_face_loop(movement_event_t event, void *context) {
+    battery_runtime_state_t *state = (battery_runtime_state_t *)context;
+
+    switch (event.event_type) {
+        case EVENT_ACTIVATE:
+        case EVENT_LOW_ENERGY_UPDATE:
+            _battery_runtime_update_display(state);
+            break;
+        case EVENT_ALARM_BUTTON_UP:
+            state->display_mode = (state->display_mode + 1) % 3;
+            _battery_runtime_update_display(state);
+            break;
+        case EVENT_ALARM_LONG_PRESS:
+            // a fresh recompute on demand, for reading the ledger's current story
+            // without waiting for midnight. Doesn't disturb the daily trend samples.
+            _recompute_projection(state);
+            _battery_runtime_update_display(state);
+            break;
+        case EVENT_BACKGROUND_TASK:
+            _take_daily_sample(state);
+            break;
+        default:
+            movement_default_loop_handler(event);
+            break;
+    }
+
+    return true;
+}
+
+void battery_runtime_face_resign(void *context) {
+    (void) context;
+}
+
+movement_watch_face_advisory_t battery_runtime_face_advise(void *context) {
+    (void) context;
+    movement_watch_face_advisory_t retval = { 0 };
+
+    // advised at the top of each minute; we want one sample per day, at midnight
+    watch_date_time_t date_time = watch_rtc_get_date_time();
+    retval.wants_background_task = date_time.unit.hour == 0 && date_time.unit.minute == 0;
+
+    return retval;
+}
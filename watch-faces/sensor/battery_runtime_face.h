@@ -0,0 +1,72 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "movement.h"
+
+/*
+ * BATTERY RUNTIME ESTIMATOR
+ *
+ * Projects how many days of battery remain, so "the watch died unexpectedly"
+ * becomes a number that can be read and scheduled around. Two estimates feed
+ * the projection, recomputed by a daily background task at midnight:
+ *
+ *  - Trend: each midnight samples VCC; once a few days of samples accumulate,
+ *    the measured decline is extrapolated to the critical power tier threshold.
+ *  - Load: the power ledger's per-peripheral duty factors and Movement's CPU
+ *    wake stats are folded into an average current estimate, which is divided
+ *    into the capacity remaining for the measured cell voltage.
+ *
+ * The displayed figure is the more pessimistic of the two (the trend estimate
+ * needs several days of samples before it participates; the load estimate is
+ * available immediately). The main display shows "BA" at the top left and the
+ * projected days remaining on the bottom line. Pressing the Alarm button
+ * cycles through two more views for diagnosing a short projection: the
+ * current cell voltage, and the estimated average load in microamps.
+ */
+
+typedef struct {
+    // one VCC sample per midnight, newest at [count - 1]; shifted when full
+    uint16_t daily_millivolts[8];
+    uint8_t sample_count;
+    // cached projection, recomputed by the daily background task
+    int16_t projected_days; // -1 until enough data
+    uint16_t load_microamps;
+    uint8_t display_mode;
+} battery_runtime_state_t;
+
+void battery_runtime_face_setup(uint8_t watch_face_index, void ** context_ptr);
+void battery_runtime_face_activate(void *context);
+bool battery_runtime_face_loop(movement_event_t event, void *context);
+void battery_runtime_face_resign(void *context);
+movement_watch_face_advisory_t battery_runtime_face_advise(void *context);
+
+#define battery_runtime_face ((const watch_face_t){ \
+    battery_runtime_face_setup, \
+    battery_runtime_face_activate, \
+    battery_runtime_face_loop, \
+    battery_runtime_face_resign, \
+    battery_runtime_face_advise, \
+})
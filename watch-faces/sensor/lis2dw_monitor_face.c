@@ -420,7 +420,7 @@ static void _monitor_update(lis2dw_monitor_state_t *state)
     lis2dw_fifo_t fifo;
     float x = 0, y = 0, z = 0;
 
-    lis2dw_read_fifo(&fifo, LIS2DW_FIFO_TIMEOUT / DISPLAY_FREQUENCY);
+    lis2dw_read_fifo_burst(&fifo);
     if (fifo.count == 0) {
         return;
     }
@@ -531,7 +531,7 @@ void lis2dw_monitor_face_setup(uint8_t watch_face_index, void **context_ptr)
 {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(lis2dw_monitor_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(lis2dw_monitor_state_t));
         memset(*context_ptr, 0, sizeof(lis2dw_monitor_state_t));
     }
     lis2dw_monitor_state_t *state = (lis2dw_monitor_state_t *) * context_ptr;
@@ -541,7 +541,7 @@ void lis2dw_monitor_face_setup(uint8_t watch_face_index, void **context_ptr)
 
     /* Initialize settings */
     uint8_t settings_page = 0;
-    state->settings = malloc(NUM_SETTINGS * sizeof(lis2dw_settings_t));
+    state->settings = movement_face_context_alloc(NUM_SETTINGS * sizeof(lis2dw_settings_t));
     state->settings[settings_page].display = _settings_mode_display;
     state->settings[settings_page].advance = _settings_mode_advance;
     settings_page++;
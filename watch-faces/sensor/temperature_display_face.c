@@ -30,7 +30,17 @@
 static bool skip = false;
 
 static void _temperature_display_face_update_display(bool in_fahrenheit) {
-    float temperature_c = movement_get_temperature();
+    char buf[4];
+    uint32_t age_seconds = 0;
+    float temperature_c = movement_get_cached_temperature(&age_seconds);
+
+    // age of the reading in minutes at the top right, so a reading inherited from
+    // the hourly logging pass is honest about how stale it is.
+    uint32_t age_minutes = age_seconds / 60;
+    if (age_minutes > 99) age_minutes = 99;
+    sprintf(buf, "%2lu", (unsigned long)age_minutes);
+    watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
+
     if (in_fahrenheit) {
         watch_display_float_with_best_effort(temperature_c * 1.8 + 32.0, "#F");
     } else {
@@ -51,43 +61,43 @@ void temperature_display_face_activate(void *context) {
 
 bool temperature_display_face_loop(movement_event_t event, void *context) {
     (void) context;
-    watch_date_time_t date_time = watch_rtc_get_date_time();
     switch (event.event_type) {
         case EVENT_ALARM_LONG_PRESS:
             movement_set_use_imperial_units(!movement_use_imperial_units());
             _temperature_display_face_update_display(movement_use_imperial_units());
             break;
+        case EVENT_ALARM_BUTTON_UP:
+            // on-demand fresh conversion; the indicator flashes until the next tick
+            // to show the sensor actually ran.
+            watch_set_indicator(WATCH_INDICATOR_SIGNAL);
+            movement_get_temperature();
+            _temperature_display_face_update_display(movement_use_imperial_units());
+            break;
         case EVENT_ACTIVATE:
             if (skip) {
                 movement_move_to_next_face();
                 return false;
             }
             if (watch_sleep_animation_is_running()) watch_stop_sleep_animation();
-            watch_display_text_with_fallback(WATCH_POSITION_TOP, "TEMP", "TE");
-            // force a measurement to be taken immediately.
-            date_time.unit.second = 0;
-            // fall through
+            watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "TEM", "TE");
+            // serve whatever reading the logging pass (or setup, on first boot) left
+            // in the cache, so activation costs no sensor bring-up at all.
+            if (movement_get_cached_temperature(NULL) == 0xFFFFFFFF) movement_get_temperature();
+            _temperature_display_face_update_display(movement_use_imperial_units());
+            break;
         case EVENT_TICK:
-            if (date_time.unit.second % 5 == 4) {
-                // Not 100% on this, but I like the idea of using the signal indicator to indicate that we're sensing data.
-                // In this case we turn the indicator on a second before the reading is taken, and clear it when we're done.
-                // In reality the measurement takes a fraction of a second, but this is just to show something is happening.
-                watch_set_indicator(WATCH_INDICATOR_SIGNAL);
-            } else if (date_time.unit.second % 5 == 0) {
-                _temperature_display_face_update_display(movement_use_imperial_units());
-                watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
-            }
+            // no sampling here anymore: just keep the age readout current.
+            watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
+            _temperature_display_face_update_display(movement_use_imperial_units());
             break;
         case EVENT_LOW_ENERGY_UPDATE:
             // clear seconds area and start tick animation if necessary
             if (!watch_sleep_animation_is_running()) {
                 watch_start_sleep_animation(1000);
             }
-            // update every 5 minutes
-            if (date_time.unit.minute % 5 == 0) {
-                watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
-                _temperature_display_face_update_display(movement_use_imperial_units());
-            }
+            // display from the cache only; the hourly logging pass keeps it fresh
+            // enough for sleep mode without this face ever powering the sensor.
+            _temperature_display_face_update_display(movement_use_imperial_units());
             break;
         default:
             movement_default_loop_handler(event);
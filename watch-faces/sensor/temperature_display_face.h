@@ -39,11 +39,13 @@
  * bike handlebars or place it outside of your tent while camping, this watch
  * face can act as a digital thermometer for displaying ambient conditions.
  *
- * The temperature sensor watch face automatically samples the temperature
- * once every five seconds, and it illuminates the Signal indicator just
- * before taking a reading.
+ * The watch face displays the most recent reading any face has taken —
+ * typically the hourly logging pass — so activating it costs no sensor
+ * bring-up at all. The number in the top right shows the reading's age in
+ * minutes. A short press of the ALARM button takes a fresh reading on the
+ * spot, flashing the Signal indicator while the sensor runs.
  *
- * Pressing the ALARM button toggles the unit display from Celsius to
+ * Holding the ALARM button toggles the unit display from Celsius to
  * Fahrenheit. Technically this sets the global “Metric / Imperial” flag, so
  * any other watch face that displays localizable units will display them in
  * the system selected here.
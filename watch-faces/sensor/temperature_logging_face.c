@@ -25,36 +25,117 @@
 #include <stdlib.h>
 #include <string.h>
 #include "temperature_logging_face.h"
+#include "ring_log.h"
 #include "watch.h"
+#include "watch_utility.h"
 
 static bool skip = false;
 
+// The RTC runs on local time, so converting it with no offset gives a "local
+// unix time"; hours of that are the cache keys. Self-consistent and spares us
+// caring about the timezone setting changing under the log.
+static int32_t _temperature_logging_hour(watch_date_time_t date_time) {
+    return (int32_t)(watch_utility_date_time_to_unix_time(date_time, 0) / 3600);
+}
+
+static void _temperature_logging_cache_insert(temperature_logging_state_t *logger_state, int32_t hour, uint16_t value) {
+    if (logger_state->newest_hour != 0 && hour <= logger_state->newest_hour) {
+        // out of order (shouldn't happen, but an RTC set backwards could do it)
+        if (logger_state->newest_hour - hour < TEMPERATURE_LOGGING_CACHE_HOURS)
+            logger_state->cache[hour % TEMPERATURE_LOGGING_CACHE_HOURS] = value;
+        return;
+    }
+    if (logger_state->newest_hour != 0) {
+        // clear any hours skipped since the last reading
+        int32_t gap = hour - logger_state->newest_hour - 1;
+        if (gap > TEMPERATURE_LOGGING_CACHE_HOURS) gap = TEMPERATURE_LOGGING_CACHE_HOURS;
+        while (gap > 0) {
+            logger_state->cache[(hour - gap) % TEMPERATURE_LOGGING_CACHE_HOURS] = TEMPERATURE_LOGGING_EMPTY;
+            gap--;
+        }
+    }
+    logger_state->cache[hour % TEMPERATURE_LOGGING_CACHE_HOURS] = value;
+    logger_state->newest_hour = hour;
+}
+
+static void _temperature_logging_flush(temperature_logging_state_t *logger_state) {
+    if (logger_state->pending_count == 0) return;
+    ring_log_append(RING_LOG_TYPE_TEMPERATURE_PACKED, logger_state->pending_start_reg,
+                    logger_state->pending, logger_state->pending_count * sizeof(uint16_t));
+    logger_state->pending_count = 0;
+}
+
 static void _temperature_logging_face_log_data(temperature_logging_state_t *logger_state) {
     watch_date_time_t date_time = watch_rtc_get_date_time();
-    size_t pos = logger_state->data_points % TEMPERATURE_LOGGING_NUM_DATA_POINTS;
+    int32_t hour = _temperature_logging_hour(date_time);
+
+    // 2-byte fixed point: centikelvin, so the value is always positive and
+    // 0xFFFF (the ring log's erased-byte padding) never occurs naturally.
+    int32_t centikelvin = (int32_t)(movement_get_temperature() * 100.0f) + 27315;
+    if (centikelvin < 0) centikelvin = 0;
+    if (centikelvin >= TEMPERATURE_LOGGING_EMPTY) centikelvin = TEMPERATURE_LOGGING_EMPTY - 1;
+
+    // a record's samples must cover consecutive hours (readers place sample i
+    // at the record's hour + i), so a gap forces the partial batch out early.
+    if (logger_state->pending_count) {
+        watch_date_time_t first;
+        first.reg = logger_state->pending_start_reg;
+        if (hour != _temperature_logging_hour(first) + logger_state->pending_count)
+            _temperature_logging_flush(logger_state);
+    }
+
+    if (logger_state->pending_count == 0) logger_state->pending_start_reg = date_time.reg;
+    logger_state->pending[logger_state->pending_count++] = (uint16_t)centikelvin;
+
+    // batch samples so one flash commit covers five hours instead of one.
+    if (logger_state->pending_count == TEMPERATURE_LOGGING_SAMPLES_PER_RECORD)
+        _temperature_logging_flush(logger_state);
 
-    logger_state->data[pos].timestamp.reg = date_time.reg;
-    logger_state->data[pos].temperature_c = movement_get_temperature();
-    logger_state->data_points++;
+    _temperature_logging_cache_insert(logger_state, hour, (uint16_t)centikelvin);
+}
+
+static bool _temperature_logging_rebuild_cb(const ring_log_record_t *record, void *context) {
+    temperature_logging_state_t *logger_state = (temperature_logging_state_t *)context;
+    if (record->type != RING_LOG_TYPE_TEMPERATURE_PACKED) return true;
+
+    watch_date_time_t timestamp;
+    timestamp.reg = record->timestamp;
+    int32_t hour = _temperature_logging_hour(timestamp);
+
+    for (int i = 0; i < TEMPERATURE_LOGGING_SAMPLES_PER_RECORD; i++) {
+        uint16_t value;
+        memcpy(&value, &record->data[2 * i], sizeof(value));
+        // 0xFFFF is erased padding: the record was cut short (a gap in
+        // sampling forced the batch out before it filled)
+        if (value == TEMPERATURE_LOGGING_EMPTY) break;
+        _temperature_logging_cache_insert(logger_state, hour + i, value);
+    }
+    return true;
 }
 
 static void _temperature_logging_face_update_display(temperature_logging_state_t *logger_state, bool in_fahrenheit, bool clock_mode_24h) {
-    int8_t pos = (logger_state->data_points - 1 - logger_state->display_index) % TEMPERATURE_LOGGING_NUM_DATA_POINTS;
     char buf[7];
+    int32_t hour = logger_state->newest_hour - logger_state->display_index;
+    uint16_t value = TEMPERATURE_LOGGING_EMPTY;
+
+    if (logger_state->newest_hour != 0)
+        value = logger_state->cache[hour % TEMPERATURE_LOGGING_CACHE_HOURS];
 
     watch_clear_indicator(WATCH_INDICATOR_24H);
     watch_clear_indicator(WATCH_INDICATOR_PM);
     watch_clear_colon();
 
-    if (pos < 0) {
-        // no data at this index
+    watch_date_time_t date_time = watch_utility_date_time_from_unix_time((uint32_t)hour * 3600, 0);
+
+    if (value == TEMPERATURE_LOGGING_EMPTY) {
+        // no data at this hour (or no data at all, in which case the day of
+        // the month would be meaningless; show the hour offset instead)
         watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "LOG", "TL");
         watch_display_text(WATCH_POSITION_BOTTOM, "no dat");
-        sprintf(buf, "%2d", logger_state->display_index);
+        sprintf(buf, "%2d", logger_state->newest_hour ? date_time.unit.day : logger_state->display_index);
         watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
     } else if (logger_state->ts_ticks) {
         // we are displaying the timestamp in response to a button press
-        watch_date_time_t date_time = logger_state->data[pos].timestamp;
         watch_set_colon();
         if (clock_mode_24h) {
             watch_set_indicator(WATCH_INDICATOR_24H);
@@ -70,13 +151,14 @@ static void _temperature_logging_face_update_display(temperature_logging_state_t
         watch_display_text(WATCH_POSITION_BOTTOM, buf);
     } else {
         // we are displaying the temperature
+        float temperature_c = ((int32_t)value - 27315) / 100.0f;
         watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "LOG", "TL");
-        sprintf(buf, "%2d", logger_state->display_index);
+        sprintf(buf, "%2d", date_time.unit.day);
         watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
         if (in_fahrenheit) {
-            watch_display_float_with_best_effort(logger_state->data[pos].temperature_c * 1.8 + 32.0, "#F");
+            watch_display_float_with_best_effort(temperature_c * 1.8 + 32.0, "#F");
         } else {
-            watch_display_float_with_best_effort(logger_state->data[pos].temperature_c, "#C");
+            watch_display_float_with_best_effort(temperature_c, "#C");
         }
     }
 }
@@ -88,8 +170,16 @@ void temperature_logging_face_setup(uint8_t watch_face_index, void ** context_pt
     if (movement_get_temperature() == 0xFFFFFFFF) skip = true;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(temperature_logging_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(temperature_logging_state_t));
         memset(*context_ptr, 0, sizeof(temperature_logging_state_t));
+        temperature_logging_state_t *logger_state = (temperature_logging_state_t *)*context_ptr;
+        for (int i = 0; i < TEMPERATURE_LOGGING_CACHE_HOURS; i++)
+            logger_state->cache[i] = TEMPERATURE_LOGGING_EMPTY;
+        // no-op on boards without the Sensor Board's SPI flash.
+        if (ring_log_mount()) {
+            // bring the last week of readings back from the log
+            ring_log_iterate(_temperature_logging_rebuild_cb, logger_state);
+        }
     }
 }
 
@@ -113,8 +203,14 @@ bool temperature_logging_face_loop(movement_event_t event, void *context) {
             logger_state->ts_ticks = 2;
             _temperature_logging_face_update_display(logger_state, movement_use_imperial_units(), movement_clock_mode_24h());
             break;
+        case EVENT_ALARM_LONG_PRESS:
+            // page back a whole day at a time
+            logger_state->display_index = (logger_state->display_index + 24) % TEMPERATURE_LOGGING_CACHE_HOURS;
+            logger_state->ts_ticks = 0;
+            _temperature_logging_face_update_display(logger_state, movement_use_imperial_units(), movement_clock_mode_24h());
+            break;
         case EVENT_ALARM_BUTTON_DOWN:
-            logger_state->display_index = (logger_state->display_index + 1) % TEMPERATURE_LOGGING_NUM_DATA_POINTS;
+            logger_state->display_index = (logger_state->display_index + 1) % TEMPERATURE_LOGGING_CACHE_HOURS;
             logger_state->ts_ticks = 0;
             // fall through
         case EVENT_ACTIVATE:
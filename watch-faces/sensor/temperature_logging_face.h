@@ -29,19 +29,20 @@
 /*
  * THERMISTOR LOGGING (aka Temperature Log)
  *
- * This watch face automatically logs the temperature once an hour, and
- * maintains a 36-hour log of readings. This watch face is admittedly rather
- * complex, and bears some explanation.
+ * This watch face automatically logs the temperature once an hour. The last
+ * week of readings can be reviewed on the watch; on boards with the Sensor
+ * Board's SPI flash, many months more accumulate in the ring log for bulk
+ * export. This watch face is admittedly rather complex, and bears some
+ * explanation.
  *
  * The main display shows the letters “TL” in the top left, indicating the
- * name of the watch face. At the top right, it displays the index of the
- * reading; 0 represents the most recent reading taken, 1 represents one
- * hour earlier, etc. The bottom line in this mode displays the logged
- * temperature.
+ * name of the watch face. At the top right, it displays the day of the
+ * month the displayed reading was taken on. The bottom line displays the
+ * logged temperature, starting from the most recent reading.
  *
- * A short press of the “Alarm” button advances to the next oldest reading;
- * you will see the number at the top right advance from 0 to 1 to 2, all
- * the way to 35, the oldest reading available.
+ * A short press of the “Alarm” button advances to the next oldest reading,
+ * one hour at a time; a long press of the “Alarm” button pages a whole day
+ * at a time. Up to seven days of readings are available for review.
  *
  * A short press of the “Light” button will briefly display the timestamp
  * of the reading. The letters at the top left will display the word “At”,
@@ -52,23 +53,34 @@
  *
  * If you need to illuminate the LED to read the data point, long press the
  * Light button and release it.
+ *
+ * Storage: samples are 2-byte fixed point (centikelvin, so 0xFFFF — the
+ * ring log's erased-byte padding — can never be a real reading and marks an
+ * empty slot). Five hourly samples are batched in RAM and committed to the
+ * ring log as a single record whose timestamp marks the first sample, which
+ * cuts flash commits from 24 to about 5 a day versus appending each reading.
+ * The week-long review cache is rebuilt from the log at boot, so the
+ * history survives a reset.
  */
 
 #include "movement.h"
 #include "watch.h"
 
-#define TEMPERATURE_LOGGING_NUM_DATA_POINTS (36)
-
-typedef struct {
-    watch_date_time_t timestamp;
-    float temperature_c;
-} thermistor_logger_data_point_t;
+// One week of hourly readings reviewable on the watch.
+#define TEMPERATURE_LOGGING_CACHE_HOURS (168)
+// u16 centikelvin samples per ring log record (RING_LOG_PAYLOAD_SIZE / 2).
+#define TEMPERATURE_LOGGING_SAMPLES_PER_RECORD (5)
+// An hour with no reading (watch was off, or the batch was lost to a reset).
+#define TEMPERATURE_LOGGING_EMPTY (0xFFFF)
 
 typedef struct {
-    uint8_t display_index;  // the index we are displaying on screen
+    uint8_t display_index;  // hours back from the most recent reading, 0..167
     uint8_t ts_ticks;       // when the user taps the LIGHT button, we show the timestamp for a few ticks.
-    int32_t data_points;    // the absolute number of data points logged
-    thermistor_logger_data_point_t data[TEMPERATURE_LOGGING_NUM_DATA_POINTS];
+    uint8_t pending_count;  // hourly samples accumulated toward the next ring log record
+    uint32_t pending_start_reg;                                     // timestamp of the first pending sample
+    uint16_t pending[TEMPERATURE_LOGGING_SAMPLES_PER_RECORD];       // the pending samples, centikelvin
+    int32_t newest_hour;    // local hour number (local unix time / 3600) of the newest cached reading, 0 = none
+    uint16_t cache[TEMPERATURE_LOGGING_CACHE_HOURS];                // review cache, slot = hour number % 168
 } temperature_logging_state_t;
 
 void temperature_logging_face_setup(uint8_t watch_face_index, void ** context_ptr);
@@ -172,7 +172,7 @@ static void maybe_roll_day(wash_ctx_t *ctx) {
 void voltage_face_setup(uint8_t watch_face_index, void **context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(wash_ctx_t));
+        *context_ptr = movement_face_context_alloc(sizeof(wash_ctx_t));
         memset(*context_ptr, 0, sizeof(wash_ctx_t));
     }
 }
@@ -101,15 +101,14 @@ static void finetune_adjust_subseconds(int delta) {
         total_adjustment += delta;
     finetune_update_display();
 
-    // Then delay clock
-    watch_rtc_enable(false);
-    delay_ms(delta);
-    if (delta > 500) {
-        uint32_t timestamp = movement_get_utc_timestamp();
-        timestamp += 1;
-        movement_set_utc_timestamp(timestamp);
-    }
-    watch_rtc_enable(true);
+    // Then slew the clock. The RTC keeps running the whole time: the frequency
+    // correction register is held off its baseline until the requested phase has
+    // accumulated, so no tick or scheduled callback is missed and the buttons
+    // return immediately instead of busy-waiting out the delay.
+    if (delta > 500)
+        watch_rtc_phase_adjust(1000 - delta);
+    else
+        watch_rtc_phase_adjust(-delta);
 }
 
 static void finetune_update_correction_time(void) {
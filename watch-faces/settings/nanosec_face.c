@@ -24,7 +24,6 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 #include "nanosec_face.h"
 #include "filesystem.h"
 
@@ -38,8 +37,6 @@ nanosec_state_t nanosec_state;
 int8_t nanosec_screen = 0;
 bool nanosec_changed = false; // We try to avoid saving settings when no changes were made, for example when just browsing through face
 
-const float voltage_coefficient = 0.241666667 * dithering; // 10 * ppm/V. Nominal frequency is at 3V.
-
 static void nanosec_init_profile(void) {
     nanosec_changed = true;
     nanosec_state.correction_cadence = 10;
@@ -139,7 +136,7 @@ void nanosec_save(void) {
         apply_RTC_correction(nanosec_state.freq_correction * 1.0f * dithering / 100); // Will be divided by dithering inside, final resolution is mere 1ppm
     }
 
-    filesystem_write_file("nanosec.ini", (char*)&nanosec_state, sizeof(nanosec_state));
+    filesystem_write_file_deferred("nanosec.ini", (char*)&nanosec_state, sizeof(nanosec_state));
     nanosec_changed = false;
 }
 
@@ -268,6 +265,14 @@ float nanosec_get_aging() // Returns aging correction in ppm
     return years*nanosec_state.aging_ppm_pa/100.0f;
 }
 
+// Aging correction in billionths of a ppm, for the integer correction path below.
+// aging_ppm_pa is hundredths of a ppm per year: seconds * age / (31536000 * 100) ppm.
+static int64_t nanosec_get_aging_nanoppm(void) {
+    uint32_t timestamp = movement_get_utc_timestamp();
+    int64_t seconds = (int64_t)(timestamp - nanosec_state.last_correction_time);
+    return seconds * nanosec_state.aging_ppm_pa * 10000 / 31536;
+}
+
 
 bool nanosec_face_loop(movement_event_t event, void *context) {
     (void) context;
@@ -326,25 +331,34 @@ bool nanosec_face_loop(movement_event_t event, void *context) {
             break;
         case EVENT_BACKGROUND_TASK:
         {
-            // Here we measure temperature and do main frequency correction
+            // Here we measure temperature and do main frequency correction.
+            // This runs unattended every few minutes for the life of the watch, so once the
+            // sensor reading is quantized to hundredths of a degree, everything is integer
+            // math: no software float calls on the every-cadence path.
             float temperature_c = movement_get_temperature();
-            float voltage = (float)watch_get_vcc_voltage() / 1000.0;
+            int32_t temp_centi;
 
             // If temperature is 0xFFFFFFFF, no temperature sensor is installed.
             // Should we assume nominal temperature here? Seems better than aborting.
-            if (temperature_c == 0xFFFFFFFF) temperature_c = nanosec_state.center_temperature;
-            // L22 correction scaling is 0.95367ppm per 1 in FREQCORR
+            if (temperature_c == 0xFFFFFFFF) temp_centi = nanosec_state.center_temperature;
+            else temp_centi = (int32_t)(temperature_c * 100.0f + (temperature_c >= 0 ? 0.5f : -0.5f));
+
             // At wrong temperature crystall starting to run slow, negative correction will speed up frequency to correct
             // Default 32kHz correciton factor is -0.034, centered around 25°C
-            float dt = temperature_c - nanosec_state.center_temperature / 100.0;
-
-            int16_t correction = round((
-                        nanosec_state.freq_correction / 100.0f * dithering +
-                        (-nanosec_state.quadratic_tempco / 100000.0 * dithering) * dt * dt +
-                        (nanosec_state.cubic_tempco / 10000000.0 * dithering) * dt * dt * dt +
-                        (voltage - 3.0) * voltage_coefficient +
-                        nanosec_get_aging() * dithering
-                        ) / 0.95367); // 1 correction unit is 0.095367ppm.
+            int32_t dtc = temp_centi - nanosec_state.center_temperature; // hundredths of a degree
+            int32_t voltage_mv = watch_get_vcc_voltage();
+            int64_t dt2 = (int64_t)dtc * dtc;
+
+            // Accumulate in billionths of a ppm, times the dithering factor.
+            int64_t total = (int64_t)nanosec_state.freq_correction * dithering * 10000000ll; // freq_correction is 0.01ppm units
+            total -= (int64_t)nanosec_state.quadratic_tempco * dithering * dt2;              // tempco is ppm/°C² × 1e5
+            total += (int64_t)nanosec_state.cubic_tempco * dithering * dt2 * dtc / 10000;    // tempco is ppm/°C³ × 1e7
+            total += (int64_t)(voltage_mv - 3000) * dithering * 725000 / 3;                  // 0.241666667 ppm/V, nominal 3V
+            total += nanosec_get_aging_nanoppm() * dithering;
+
+            // One FREQCORR step is 2^-20 = 0.95367432 ppm; round to the nearest step.
+            const int64_t step = 953674316;
+            int16_t correction = (int16_t)((total + (total >= 0 ? step / 2 : -step / 2)) / step);
 
             apply_RTC_correction(correction);
         }
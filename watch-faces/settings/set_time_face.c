@@ -36,7 +36,28 @@ const char set_time_face_fallback_titles[SET_TIME_FACE_NUM_SETTINGS][3] = {"YR",
 static bool _quick_ticks_running;
 static int32_t current_offset;
 
-static void _handle_alarm_button(watch_date_time_t date_time, uint8_t current_page) {
+// The current local time with any staged edits overlaid. Edits are staged per field,
+// so fields the user hasn't touched keep ticking until the commit.
+static watch_date_time_t _merged_date_time(set_time_state_t *state) {
+    watch_date_time_t date_time = movement_get_local_date_time();
+    if (state->dirty & (1 << 0)) date_time.unit.year = state->staged.unit.year;
+    if (state->dirty & (1 << 1)) date_time.unit.month = state->staged.unit.month;
+    if (state->dirty & (1 << 2)) date_time.unit.day = state->staged.unit.day;
+    if (state->dirty & (1 << 4)) date_time.unit.hour = state->staged.unit.hour;
+    if (state->dirty & (1 << 5)) date_time.unit.minute = state->staged.unit.minute;
+    return date_time;
+}
+
+// One clock write for any number of staged edits. Setting the time also resets the
+// minute alarm, re-arms the background task comparison and rebuilds the DST offset
+// cache, so this is what keeps quick-tick stepping from stalling on that work.
+static void _commit_staged(set_time_state_t *state) {
+    if (!state->dirty) return;
+    movement_set_local_date_time(_merged_date_time(state));
+    state->dirty = 0;
+}
+
+static void _handle_alarm_button(set_time_state_t *state, watch_date_time_t date_time, uint8_t current_page) {
     // handles short or long pressing of the alarm button
 
     switch (current_page) {
@@ -61,10 +82,15 @@ static void _handle_alarm_button(watch_date_time_t date_time, uint8_t current_pa
             date_time.unit.minute = (date_time.unit.minute + 1) % 60;
             break;
         case 6: // second
+            // committed on the spot, so zeroing the seconds syncs to the press.
+            // date_time is the merged view, so any staged edits ride along.
             date_time.unit.second = 0;
-            break;
+            movement_set_local_date_time(date_time);
+            state->dirty = 0;
+            return;
     }
-    movement_set_local_date_time(date_time);
+    state->staged = date_time;
+    state->dirty |= (1 << current_page);
 }
 
 static void _abort_quick_ticks() {
@@ -76,27 +102,35 @@ static void _abort_quick_ticks() {
 
 void set_time_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
-    if (*context_ptr == NULL) *context_ptr = malloc(sizeof(uint8_t));
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(set_time_state_t));
+        memset(*context_ptr, 0, sizeof(set_time_state_t));
+    }
 }
 
 void set_time_face_activate(void *context) {
-    *((uint8_t *)context) = 0;
+    set_time_state_t *state = (set_time_state_t *)context;
+    state->current_page = 0;
+    state->dirty = 0;
     movement_request_tick_frequency(4);
     _quick_ticks_running = false;
     current_offset = movement_get_current_timezone_offset();
 }
 
 bool set_time_face_loop(movement_event_t event, void *context) {
-    uint8_t current_page = *((uint8_t *)context);
-    watch_date_time_t date_time = movement_get_local_date_time();
+    set_time_state_t *state = (set_time_state_t *)context;
+    uint8_t current_page = state->current_page;
+    watch_date_time_t date_time = _merged_date_time(state);
 
     switch (event.event_type) {
         case EVENT_ACTIVATE:
             break;
         case EVENT_TICK:
             if (_quick_ticks_running) {
-                if (HAL_GPIO_BTN_ALARM_read()) _handle_alarm_button(date_time, current_page);
-                else _abort_quick_ticks();
+                if (HAL_GPIO_BTN_ALARM_read()) {
+                    _handle_alarm_button(state, date_time, current_page);
+                    date_time = _merged_date_time(state);
+                } else _abort_quick_ticks();
             }
             break;
         case EVENT_ALARM_LONG_PRESS:
@@ -109,15 +143,19 @@ bool set_time_face_loop(movement_event_t event, void *context) {
             _abort_quick_ticks();
             break;
         case EVENT_LIGHT_BUTTON_DOWN:
+            // moving on to the next field commits whatever was staged on this one
+            _commit_staged(state);
             current_page = (current_page + 1) % SET_TIME_FACE_NUM_SETTINGS;
-            *((uint8_t *)context) = current_page;
+            state->current_page = current_page;
             break;
         case EVENT_ALARM_BUTTON_UP:
             _abort_quick_ticks();
-            _handle_alarm_button(date_time, current_page);
+            _handle_alarm_button(state, date_time, current_page);
+            date_time = _merged_date_time(state);
             break;
         case EVENT_TIMEOUT:
             _abort_quick_ticks();
+            _commit_staged(state);
             movement_move_to_face(0);
             break;
         default:
@@ -182,7 +220,8 @@ bool set_time_face_loop(movement_event_t event, void *context) {
 }
 
 void set_time_face_resign(void *context) {
-    (void) context;
+    set_time_state_t *state = (set_time_state_t *)context;
+    _commit_staged(state);
     movement_store_settings();
     movement_request_tick_frequency(1);
 }
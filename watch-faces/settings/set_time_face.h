@@ -40,10 +40,22 @@
  * zone. This allows Sensor Watch to correctly offset the time. This also
  * means that when daylight savings time starts or ends, you must update
  * both the time and the time zone on this screen.
+ *
+ * Field edits are staged in RAM while you step through values (stepping a
+ * field at 8 Hz with the ALARM button held costs no clock writes at all) and
+ * committed to the clock in one update when you move to the next field or
+ * leave the face. Fields you didn't touch keep ticking in the meantime. The
+ * seconds field commits immediately, so zeroing it syncs to the press.
  */
 
 #include "movement.h"
 
+typedef struct {
+    uint8_t current_page;
+    uint8_t dirty;              // bitmask of staged fields, indexed by page
+    watch_date_time_t staged;   // field values edited but not yet committed
+} set_time_state_t;
+
 void set_time_face_setup(uint8_t watch_face_index, void ** context_ptr);
 void set_time_face_activate(void *context);
 bool set_time_face_loop(movement_event_t event, void *context);
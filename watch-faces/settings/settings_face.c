@@ -289,7 +289,7 @@ static void git_hash_setting_advance(void) {
 void settings_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(settings_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(settings_state_t));
         settings_state_t *state = (settings_state_t *)*context_ptr;
         int8_t current_setting = 0;
 
@@ -307,7 +307,7 @@ void settings_face_setup(uint8_t watch_face_index, void ** context_ptr) {
         state->num_settings++;
 #endif
 
-        state->settings_screens = malloc(state->num_settings * sizeof(settings_screen_t));
+        state->settings_screens = movement_face_context_alloc(state->num_settings * sizeof(settings_screen_t));
         state->settings_screens[current_setting].display = clock_setting_display;
         state->settings_screens[current_setting].advance = clock_setting_advance;
         current_setting++;
@@ -413,5 +413,9 @@ bool settings_face_loop(movement_event_t event, void *context) {
 void settings_face_resign(void *context) {
     (void) context;
     movement_force_led_off();
+    // The movement setters the advance handlers call above only touch the RAM copy of
+    // the settings word; this is the single point where edits from this visit are
+    // committed, and it's a no-op if nothing actually changed (or everything was
+    // toggled back to how it started).
     movement_store_settings();
 }
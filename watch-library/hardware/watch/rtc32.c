@@ -83,6 +83,23 @@ void rtc_enable(void) {
     _rtc_sync();
 }
 
+void rtc_enable_periodic_event(uint8_t n) {
+    uint16_t pereo = RTC_MODE0_EVCTRL_PEREO0 << n;
+    if (RTC->MODE0.EVCTRL.reg & pereo) return;
+
+    // EVCTRL is enable-protected; pause the counter just long enough to set the bit.
+    bool was_enabled = rtc_is_enabled();
+    if (was_enabled) {
+        CTRLREG.bit.ENABLE = 0;
+        _rtc_sync();
+    }
+    RTC->MODE0.EVCTRL.reg |= pereo;
+    if (was_enabled) {
+        CTRLREG.bit.ENABLE = 1;
+        _rtc_sync();
+    }
+}
+
 void rtc_set_counter(rtc_counter_t counter) {
     // // syncing before and after was found to increase reliability on Sensor Watch
     _rtc_sync();
@@ -23,11 +23,14 @@
  */
 
 #include "watch_adc.h"
+#include "watch_power.h"
 #include "adc.h"
+#include "rtc32.h"
 
 void watch_enable_adc(void) {
     adc_init();
     adc_enable();
+    watch_power_track_enable(WATCH_POWER_ADC);
 }
 
 void watch_enable_analog_input(const uint16_t port_pin) {
@@ -49,6 +52,188 @@ uint16_t watch_get_analog_pin_level(const uint16_t pin) {
     return adc_get_analog_value(pin);
 }
 
+static volatile bool _adc_result_ready = false;
+static watch_cb_t _vcc_monitor_callback = NULL;
+
+// Background sampling state: the RESRDY interrupt files each event-triggered
+// conversion here, and readers take the latest without touching the ADC.
+static volatile uint16_t _background_sample;
+static volatile bool _background_sample_valid;
+static bool _background_sampling_enabled;
+
+// The EVSYS channel that carries RTC periodic events to the ADC start trigger.
+// Nothing else in the tree uses the event system yet; revisit if that changes.
+#define WATCH_ADC_EVSYS_CHANNEL 0
+
+/// TODO: gossamer keeps its pin-to-channel mapping private; this duplicates it for now.
+static uint8_t _watch_adc_channel_for_pin(const uint16_t port_pin) {
+    uint8_t port = port_pin >> 8;
+    uint8_t pin = port_pin & 0x1F;
+
+    if (port == 0) {
+        if (pin <= 3) return pin - 2;   // PA02, PA03 are AIN[0:1]
+        if (pin <= 7) return pin;       // PA04-PA07 are AIN[4:7]
+        return pin + 8;                 // PA08-PA11 are AIN[16:19]
+    } else {
+        if (pin >= 8) return pin - 6;   // PB08, PB09 are AIN[2:3]
+        return pin + 8;                 // PB00-PB07 are AIN[8:15]
+    }
+}
+
+void irq_handler_adc(void);
+void irq_handler_adc(void) {
+    if (ADC->INTFLAG.bit.WINMON) {
+        ADC->INTFLAG.reg = ADC_INTFLAG_WINMON;
+        // one-shot: stop the free-running conversions before the callback runs, so a
+        // sagging battery raises one event instead of one interrupt per conversion.
+        watch_cb_t callback = _vcc_monitor_callback;
+        watch_disable_vcc_monitor();
+        if (callback) callback();
+    }
+    if (ADC->INTFLAG.bit.RESRDY) {
+        ADC->INTFLAG.reg = ADC_INTFLAG_RESRDY;
+        _adc_result_ready = true;
+        if (_background_sampling_enabled) {
+            _background_sample = ADC->RESULT.reg;
+            _background_sample_valid = true;
+        }
+    }
+}
+
+void watch_enable_background_sampling(const uint16_t pin) {
+    if (!adc_is_enabled()) watch_enable_adc();
+
+    ADC->CTRLA.bit.ENABLE = 0;
+    while (ADC->SYNCBUSY.reg);
+
+    // one conversion per incoming event, at the slowest ADC clock, alive in standby.
+    ADC->INPUTCTRL.bit.MUXPOS = _watch_adc_channel_for_pin(pin);
+    ADC->CTRLB.reg = ADC_CTRLB_PRESCALER_DIV256;
+    ADC->CTRLA.bit.RUNSTDBY = 1;
+    ADC->EVCTRL.reg = ADC_EVCTRL_STARTEI;
+
+    _background_sample_valid = false;
+    _background_sampling_enabled = true;
+    ADC->INTFLAG.reg = ADC_INTFLAG_RESRDY;
+    ADC->INTENSET.reg = ADC_INTENSET_RESRDY;
+    NVIC_ClearPendingIRQ(ADC_IRQn);
+    NVIC_EnableIRQ(ADC_IRQn);
+
+    // the 1 Hz tap off the RTC prescaler, routed to the ADC over an asynchronous
+    // event channel — no generic clock needed, and the path works in standby.
+    rtc_enable_periodic_event(7);
+    MCLK->APBCMASK.reg |= MCLK_APBCMASK_EVSYS;
+    EVSYS->USER[EVSYS_ID_USER_ADC_START].reg = EVSYS_USER_CHANNEL(WATCH_ADC_EVSYS_CHANNEL + 1);
+    EVSYS->CHANNEL[WATCH_ADC_EVSYS_CHANNEL].reg = EVSYS_CHANNEL_EVGEN(EVSYS_ID_GEN_RTC_PER_7) |
+                                                  EVSYS_CHANNEL_PATH_ASYNCHRONOUS;
+
+    ADC->CTRLA.bit.ENABLE = 1;
+    while (ADC->SYNCBUSY.reg);
+}
+
+bool watch_get_background_sample(uint16_t *value) {
+    if (!_background_sample_valid) return false;
+    *value = _background_sample;
+    return true;
+}
+
+void watch_disable_background_sampling(void) {
+    _background_sampling_enabled = false;
+    _background_sample_valid = false;
+
+    // unroute the channel first so no event starts a conversion mid-teardown.
+    EVSYS->USER[EVSYS_ID_USER_ADC_START].reg = 0;
+    EVSYS->CHANNEL[WATCH_ADC_EVSYS_CHANNEL].reg = 0;
+
+    ADC->INTENCLR.reg = ADC_INTENCLR_RESRDY;
+    ADC->CTRLA.bit.ENABLE = 0;
+    while (ADC->SYNCBUSY.reg);
+    ADC->EVCTRL.reg = 0;
+    ADC->CTRLA.bit.RUNSTDBY = 0;
+    watch_disable_adc();
+}
+
+void watch_enable_vcc_monitor(uint16_t threshold_millivolts, watch_cb_t callback) {
+    _vcc_monitor_callback = callback;
+
+    if (!adc_is_enabled()) watch_enable_adc();
+
+    ADC->CTRLA.bit.ENABLE = 0;
+    while (ADC->SYNCBUSY.reg);
+
+    // measure VCC/4 against the 1.024 V internal reference, one 12-bit sample at a time;
+    // at that scale one count works out to almost exactly one millivolt of VCC, so the
+    // threshold can go straight into the window comparator.
+    SUPC->VREF.bit.VREFOE = 1;
+    ADC->REFCTRL.bit.REFSEL = ADC_REFCTRL_REFSEL_INTREF_Val;
+    ADC->AVGCTRL.reg = ADC_AVGCTRL_SAMPLENUM_1;
+    ADC->INPUTCTRL.bit.MUXPOS = ADC_INPUTCTRL_MUXPOS_SCALEDIOVCC_Val;
+
+    // free-running at the slowest ADC clock, kept alive in standby; the window monitor
+    // checks every result in hardware and only interrupts when one lands below WINUT.
+    ADC->CTRLB.reg = ADC_CTRLB_PRESCALER_DIV256;
+    ADC->CTRLC.bit.FREERUN = 1;
+    ADC->CTRLC.bit.WINMODE = 2; // interrupt when RESULT < WINUT
+    ADC->WINLT.reg = 0;
+    ADC->WINUT.reg = threshold_millivolts;
+    ADC->CTRLA.bit.RUNSTDBY = 1;
+
+    ADC->INTFLAG.reg = ADC_INTFLAG_WINMON;
+    ADC->INTENSET.reg = ADC_INTENSET_WINMON;
+    NVIC_ClearPendingIRQ(ADC_IRQn);
+    NVIC_EnableIRQ(ADC_IRQn);
+
+    ADC->CTRLA.bit.ENABLE = 1;
+    while (ADC->SYNCBUSY.reg);
+    ADC->SWTRIG.bit.START = 1; // first conversion; free-run takes it from here
+}
+
+void watch_disable_vcc_monitor(void) {
+    _vcc_monitor_callback = NULL;
+    ADC->INTENCLR.reg = ADC_INTENCLR_WINMON;
+    ADC->CTRLA.bit.ENABLE = 0;
+    while (ADC->SYNCBUSY.reg);
+    ADC->CTRLC.bit.FREERUN = 0;
+    ADC->CTRLC.bit.WINMODE = 0;
+    ADC->CTRLA.bit.RUNSTDBY = 0;
+    watch_disable_adc();
+}
+
+uint16_t watch_get_analog_pin_level_filtered(const uint16_t pin) {
+    // stash the sampling settings so we can put them back; the blocking calls depend on them.
+    uint8_t avgctrl = ADC->AVGCTRL.reg;
+
+    // accumulate 64 samples in one hardware burst. The 18-bit sum is right-shifted by two,
+    // which keeps the result in the same 16-bit range as watch_get_analog_pin_level.
+    ADC->CTRLA.bit.ENABLE = 0;
+    while (ADC->SYNCBUSY.reg);
+    ADC->AVGCTRL.reg = ADC_AVGCTRL_SAMPLENUM_64 | ADC_AVGCTRL_ADJRES(2);
+    ADC->INPUTCTRL.bit.MUXPOS = _watch_adc_channel_for_pin(pin);
+    ADC->CTRLA.bit.ENABLE = 1;
+    while (ADC->SYNCBUSY.reg);
+
+    // trigger the burst and idle until the result-ready interrupt; the ADC samples and
+    // accumulates on its own while the core sleeps.
+    _adc_result_ready = false;
+    ADC->INTENSET.reg = ADC_INTENSET_RESRDY;
+    NVIC_ClearPendingIRQ(ADC_IRQn);
+    NVIC_EnableIRQ(ADC_IRQn);
+    ADC->SWTRIG.bit.START = 1;
+    while (!_adc_result_ready) __WFI();
+    ADC->INTENCLR.reg = ADC_INTENCLR_RESRDY;
+
+    uint16_t value = ADC->RESULT.reg;
+
+    // restore the previous sampling settings.
+    ADC->CTRLA.bit.ENABLE = 0;
+    while (ADC->SYNCBUSY.reg);
+    ADC->AVGCTRL.reg = avgctrl;
+    ADC->CTRLA.bit.ENABLE = 1;
+    while (ADC->SYNCBUSY.reg);
+
+    return value;
+}
+
 /// TODO: put reference voltage stuff into gossamer?
 void _watch_set_analog_reference_voltage(uint8_t reference);
 void _watch_set_analog_reference_voltage(uint8_t reference) {
@@ -99,4 +284,5 @@ inline void watch_disable_analog_input(const uint16_t port_pin) {
 
 inline void watch_disable_adc(void) {
     adc_disable();
+    watch_power_track_disable(WATCH_POWER_ADC);
 }
@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_crc32.h"
+#include "watch.h"
+
+// Bitwise update of the internal (reflected, un-complemented) CRC state, used
+// for the unaligned head and tail around the DSU's word-aligned span.
+static uint32_t _crc32_state_update(uint32_t state, const uint8_t *data, size_t length) {
+    while (length--) {
+        state ^= *data++;
+        for (uint8_t i = 0; i < 8; i++) state = (state >> 1) ^ (0xEDB88320UL & -(state & 1));
+    }
+    return state;
+}
+
+// The DSU runs the same reflected polynomial with DATA as its running state,
+// so it can pick up exactly where the bitwise loop left off and vice versa.
+static uint32_t _crc32_dsu(uint32_t state, const uint8_t *data, size_t length) {
+    // the DSU is PAC-protected against non-debugger writes by default.
+    PAC->WRCTRL.reg = PAC_WRCTRL_PERID(ID_DSU) | PAC_WRCTRL_KEY_CLR;
+
+    DSU->DATA.reg = state;
+    DSU->ADDR.reg = (uint32_t)data;   // word aligned; low bits select the access mode
+    DSU->LENGTH.reg = (uint32_t)length;
+    DSU->STATUSA.reg = DSU_STATUSA_DONE | DSU_STATUSA_BERR; // write-one-to-clear
+    DSU->CTRL.reg = DSU_CTRL_CRC;
+    while (!DSU->STATUSA.bit.DONE);
+
+    bool bus_error = DSU->STATUSA.bit.BERR;
+    if (!bus_error) state = DSU->DATA.reg;
+    DSU->STATUSA.reg = DSU_STATUSA_DONE | DSU_STATUSA_BERR;
+
+    PAC->WRCTRL.reg = PAC_WRCTRL_PERID(ID_DSU) | PAC_WRCTRL_KEY_SET;
+
+    if (bus_error) return _crc32_state_update(state, data, length);
+    return state;
+}
+
+uint32_t watch_crc32_update(uint32_t crc, const void *data, size_t length) {
+    const uint8_t *bytes = data;
+    uint32_t state = ~crc;
+
+    // bitwise until the pointer is word aligned...
+    size_t head = (size_t)(-(uintptr_t)bytes & 3);
+    if (head > length) head = length;
+    state = _crc32_state_update(state, bytes, head);
+    bytes += head;
+    length -= head;
+
+    // ...the DSU for the aligned span...
+    size_t aligned = length & ~(size_t)3;
+    if (aligned) {
+        state = _crc32_dsu(state, bytes, aligned);
+        bytes += aligned;
+        length -= aligned;
+    }
+
+    // ...and bitwise for the leftover tail.
+    return ~_crc32_state_update(state, bytes, length);
+}
+
+uint32_t watch_crc32(const void *data, size_t length) {
+    return watch_crc32_update(0, data, length);
+}
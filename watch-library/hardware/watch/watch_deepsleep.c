@@ -185,6 +185,40 @@ void watch_enter_sleep_mode(void) {
     app_setup();
 }
 
+void watch_enter_sleep_mode_keep_seconds(watch_cb_t seconds_callback, bool (*wake_needed)(void)) {
+    // same teardown as watch_enter_sleep_mode...
+    _watch_disable_all_peripherals_except_slcd();
+    watch_rtc_disable_all_periodic_callbacks();
+    SUPC->INTENCLR.bit.BOD33DET = 1;
+    _watch_disable_all_pins_except_rtc();
+
+    // ...except one concession to the display: a 1 Hz periodic interrupt
+    // repaints the seconds digits, and unless some other wake source has left
+    // work for the caller's run loop, we drop straight back into standby
+    // without paying for the peripheral bring-up below.
+    watch_rtc_register_periodic_callback(seconds_callback, 1);
+    do {
+        sleep(4);
+    } while (!wake_needed());
+    watch_rtc_disable_periodic_callback(1);
+
+    // and we awake! re-enable the brownout detector
+    SUPC->INTENSET.bit.BOD33DET = 1;
+
+    // call app_setup so the app can re-enable everything we disabled.
+    app_setup();
+}
+
+void watch_enter_standby_mode(void) {
+    // no teardown here: anything configured to run in standby keeps running.
+    // still mask the brownout detector interrupt so it can't wake us spuriously.
+    SUPC->INTENCLR.bit.BOD33DET = 1;
+
+    sleep(4);
+
+    SUPC->INTENSET.bit.BOD33DET = 1;
+}
+
 void watch_enter_backup_mode(void) {
     watch_rtc_disable_all_periodic_callbacks();
     _watch_disable_all_pins_except_rtc();
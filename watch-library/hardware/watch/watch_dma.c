@@ -0,0 +1,140 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_dma.h"
+#include <string.h>
+
+DmacDescriptor watch_dma_descriptors[WATCH_DMA_NUM_CHANNELS] __attribute__((aligned(16)));
+DmacDescriptor watch_dma_writeback[WATCH_DMA_NUM_CHANNELS] __attribute__((aligned(16)));
+
+static watch_dma_callback_t _dma_callbacks[WATCH_DMA_NUM_CHANNELS];
+static bool _dma_initialized;
+
+void watch_dma_init(void) {
+    if (_dma_initialized) return;
+
+    MCLK->AHBMASK.bit.DMAC_ = 1;
+    DMAC->CTRL.bit.DMAENABLE = 0;
+    while (DMAC->CTRL.bit.DMAENABLE);
+    DMAC->CTRL.bit.SWRST = 1;
+    while (DMAC->CTRL.bit.SWRST);
+    DMAC->BASEADDR.reg = (uint32_t)watch_dma_descriptors;
+    DMAC->WRBADDR.reg = (uint32_t)watch_dma_writeback;
+    DMAC->CTRL.reg = DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN0;
+    NVIC_ClearPendingIRQ(DMAC_IRQn);
+    NVIC_EnableIRQ(DMAC_IRQn);
+    _dma_initialized = true;
+}
+
+void watch_dma_setup_channel(uint8_t channel, uint8_t trigger) {
+    DMAC->CHID.reg = channel;
+    DMAC->CHCTRLA.reg = 0;
+    while (DMAC->CHCTRLA.bit.ENABLE);
+    DMAC->CHCTRLB.reg = DMAC_CHCTRLB_TRIGSRC(trigger) | DMAC_CHCTRLB_TRIGACT_BEAT;
+}
+
+void watch_dma_set_callback(uint8_t channel, watch_dma_callback_t callback) {
+    _dma_callbacks[channel] = callback;
+}
+
+void watch_dma_critical_enter(void) {
+    NVIC_DisableIRQ(DMAC_IRQn);
+}
+
+void watch_dma_critical_exit(void) {
+    NVIC_EnableIRQ(DMAC_IRQn);
+}
+
+// Below this, the channel setup costs more cycles than the copy it saves.
+#define WATCH_DMA_MEMCPY_MIN_LENGTH (32)
+
+static volatile bool _memcpy_busy;
+static watch_dma_callback_t _memcpy_user_callback;
+
+static void _watch_dma_memcpy_complete(void) {
+    watch_dma_callback_t callback = _memcpy_user_callback;
+    _memcpy_user_callback = NULL;
+    _memcpy_busy = false;
+    if (callback) callback();
+}
+
+bool watch_dma_memcpy(void *dst, const void *src, size_t length, watch_dma_callback_t callback) {
+    if (length < WATCH_DMA_MEMCPY_MIN_LENGTH || _memcpy_busy) {
+        memcpy(dst, src, length);
+        if (callback) callback();
+        return false;
+    }
+
+    watch_dma_init();
+    _memcpy_busy = true;
+    _memcpy_user_callback = callback;
+
+    // word beats when everything lines up, byte beats otherwise. Addresses point
+    // one past the end of each buffer when incrementing, per the DMAC's scheme.
+    uint16_t beats = length;
+    uint32_t btctrl = DMAC_BTCTRL_VALID | DMAC_BTCTRL_SRCINC | DMAC_BTCTRL_DSTINC | DMAC_BTCTRL_BEATSIZE_BYTE;
+    if ((((uint32_t)dst | (uint32_t)src | length) & 3) == 0) {
+        btctrl = DMAC_BTCTRL_VALID | DMAC_BTCTRL_SRCINC | DMAC_BTCTRL_DSTINC | DMAC_BTCTRL_BEATSIZE_WORD;
+        beats = length >> 2;
+    }
+    DmacDescriptor *desc = &watch_dma_descriptors[WATCH_DMA_CHANNEL_MEMCPY];
+    desc->BTCTRL.reg = btctrl;
+    desc->BTCNT.reg = beats;
+    desc->SRCADDR.reg = (uint32_t)src + length;
+    desc->DSTADDR.reg = (uint32_t)dst + length;
+    desc->DESCADDR.reg = 0;
+
+    watch_dma_critical_enter();
+    watch_dma_set_callback(WATCH_DMA_CHANNEL_MEMCPY, _watch_dma_memcpy_complete);
+    watch_dma_setup_channel(WATCH_DMA_CHANNEL_MEMCPY, 0); // no peripheral trigger; software below
+    // one software trigger moves the whole block, rather than a trigger per beat.
+    DMAC->CHCTRLB.reg = DMAC_CHCTRLB_TRIGACT_TRANSACTION;
+    DMAC->CHINTENSET.reg = DMAC_CHINTENSET_TCMPL | DMAC_CHINTENSET_TERR;
+    DMAC->CHCTRLA.bit.ENABLE = 1;
+    watch_dma_critical_exit();
+
+    DMAC->SWTRIGCTRL.reg = (1 << WATCH_DMA_CHANNEL_MEMCPY);
+    return true;
+}
+
+bool watch_dma_memcpy_busy(void) {
+    return _memcpy_busy;
+}
+
+void watch_dma_memcpy_wait(void) {
+    while (_memcpy_busy);
+}
+
+void irq_handler_dmac(void);
+void irq_handler_dmac(void) {
+    // INTPEND tells us the lowest pending channel; loop in case several fired.
+    while (DMAC->INTPEND.reg & (DMAC_INTPEND_TCMPL | DMAC_INTPEND_TERR | DMAC_INTPEND_SUSP)) {
+        uint8_t channel = DMAC->INTPEND.bit.ID;
+        DMAC->CHID.reg = channel;
+        DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR | DMAC_CHINTFLAG_SUSP;
+        if (channel < WATCH_DMA_NUM_CHANNELS && _dma_callbacks[channel]) {
+            _dma_callbacks[channel]();
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+// Shared DMAC core for the hardware watch library. The DMAC has one descriptor
+// table and one interrupt for all channels, so every user goes through here:
+// channel numbers are assigned statically below, and the shared interrupt
+// handler dispatches to a per-channel callback.
+//
+// The CHID register bank-switches all per-channel registers. Any sequence of
+// channel register accesses from thread context must be wrapped in
+// watch_dma_critical_enter()/_exit(), or a DMAC interrupt landing in the middle
+// will leave CHID pointing somewhere else.
+
+#include "sam.h"
+#include <stddef.h>
+
+#define WATCH_DMA_CHANNEL_SPI_RX (0)
+#define WATCH_DMA_CHANNEL_SPI_TX (1)
+#define WATCH_DMA_CHANNEL_UART_RX (2)
+#define WATCH_DMA_CHANNEL_MEMCPY (3)
+#define WATCH_DMA_CHANNEL_UART_TX (4)
+#define WATCH_DMA_NUM_CHANNELS (5)
+
+typedef void (*watch_dma_callback_t)(void);
+
+// First descriptor for each channel. Channels that chain additional descriptors
+// (like the UART RX ring) keep the extra links in their own translation unit.
+extern DmacDescriptor watch_dma_descriptors[WATCH_DMA_NUM_CHANNELS];
+extern DmacDescriptor watch_dma_writeback[WATCH_DMA_NUM_CHANNELS];
+
+// Enables the DMAC and installs the descriptor table. Idempotent; call before
+// touching any channel.
+void watch_dma_init(void);
+
+// Disables the channel and assigns its trigger source, leaving CHID set so the
+// caller can finish configuring and enable it. Call inside a critical section.
+void watch_dma_setup_channel(uint8_t channel, uint8_t trigger);
+
+// Callback invoked from the DMAC interrupt when the channel raises transfer
+// complete or error. The handler clears the flags before dispatching.
+void watch_dma_set_callback(uint8_t channel, watch_dma_callback_t callback);
+
+void watch_dma_critical_enter(void);
+void watch_dma_critical_exit(void);
+
+// Copies length bytes from src to dst. Large copies go out over the dedicated
+// memcpy channel and return immediately with the copy in flight: the CPU can
+// sleep or do other work, the callback (if any) runs from interrupt context on
+// completion, and both buffers must be left alone until then. Copies shorter
+// than the setup is worth, or issued while another DMA copy is still running,
+// fall back to a plain memcpy and invoke the callback before returning.
+// Returns true if the copy is in flight on the channel, false if it already
+// completed synchronously. Word beats are used when src, dst and length are
+// all word aligned; byte beats otherwise.
+bool watch_dma_memcpy(void *dst, const void *src, size_t length, watch_dma_callback_t callback);
+
+// True while a watch_dma_memcpy is still in flight.
+bool watch_dma_memcpy_busy(void);
+
+// Spins until any in-flight memcpy completes. Cheap insurance before touching
+// a buffer that may still be a DMA source or destination.
+void watch_dma_memcpy_wait(void);
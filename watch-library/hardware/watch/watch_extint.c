@@ -25,10 +25,23 @@
 #include <stdio.h>
 #include "watch_extint.h"
 #include "watch_gpio.h"
+#include "watch_wake_stats.h"
 #include "eic.h"
 
 watch_cb_t eic_callbacks[16] = { NULL };
 
+// wake source per EIC channel, classified once at registration so the interrupt
+// path only pays an array load to tag itself.
+static uint8_t eic_wake_sources[16];
+
+static watch_wake_source_t _watch_eic_classify(const uint8_t pin) {
+    if (pin == HAL_GPIO_BTN_MODE_pin()) return WATCH_WAKE_BTN_MODE;
+    if (pin == HAL_GPIO_BTN_LIGHT_pin()) return WATCH_WAKE_BTN_LIGHT;
+    if (pin == HAL_GPIO_BTN_ALARM_pin()) return WATCH_WAKE_BTN_ALARM;
+    if (pin == HAL_GPIO_A3_pin() || pin == HAL_GPIO_A4_pin()) return WATCH_WAKE_ACCELEROMETER;
+    return WATCH_WAKE_EIC_OTHER;
+}
+
 void watch_eic_callback(uint8_t channel);
 
 void watch_enable_external_interrupts(void) {
@@ -41,26 +54,59 @@ void watch_disable_external_interrupts(void) {
     eic_disable();
 }
 
+static void _watch_eic_set_async(uint8_t channel, bool async) {
+    uint32_t mask = 1 << channel;
+    if (((EIC->ASYNCH.reg & mask) != 0) == async) return;
+
+    // ASYNCH is enable-protected, so cycle the EIC around the write.
+    /// FIXME: #SecondMovement, we need a gossamer wrapper for async edge detection.
+    eic_disable();
+    if (async) EIC->ASYNCH.reg |= mask;
+    else EIC->ASYNCH.reg &= ~mask;
+    eic_enable();
+}
+
 void watch_register_interrupt_callback(const uint8_t pin, watch_cb_t callback, eic_interrupt_trigger_t trigger) {
+    watch_register_interrupt_callback_with_filter(pin, callback, trigger, WATCH_INTERRUPT_FILTER_DEFAULT);
+}
+
+void watch_register_interrupt_callback_with_filter(const uint8_t pin, watch_cb_t callback, eic_interrupt_trigger_t trigger, watch_interrupt_filter_t filter) {
     watch_enable_digital_input(pin);
-    bool filten = false;
+    bool is_button = false;
 
     // check if this is a button pin
     if (pin == HAL_GPIO_BTN_LIGHT_pin() || pin == HAL_GPIO_BTN_MODE_pin() || pin == HAL_GPIO_BTN_ALARM_pin()) {
         // if so, enable the pull-down resistor
         watch_enable_pull_down(pin);
-        filten = true;
+        is_button = true;
+    }
+
+    bool filten;
+    switch (filter) {
+        case WATCH_INTERRUPT_FILTER_MAJORITY:
+            filten = true;
+            break;
+        case WATCH_INTERRUPT_FILTER_ASYNC:
+            filten = false;
+            break;
+        default:
+            // the longstanding behavior: majority-vote filtering on buttons only.
+            filten = is_button;
+            break;
     }
 
     int8_t channel = eic_configure_pin(pin, trigger, filten);
     if (channel >= 0 && channel < 16) {
         printf("Configured port %d pin %d on channel %d\n", pin >> 5, pin & 0x1F, channel);
+        _watch_eic_set_async((uint8_t)channel, filter == WATCH_INTERRUPT_FILTER_ASYNC);
         eic_enable_interrupt(pin);
         eic_callbacks[channel] = callback;
+        eic_wake_sources[channel] = (uint8_t)_watch_eic_classify(pin);
     }
 }
 
-void watch_eic_callback(uint8_t channel) {
+WATCH_RAMFUNC void watch_eic_callback(uint8_t channel) {
+    watch_wake_stats_record((watch_wake_source_t)eic_wake_sources[channel]);
     if (eic_callbacks[channel] != NULL) {
         eic_callbacks[channel]();
     }
@@ -0,0 +1,126 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "watch_fault.h"
+#include "watch.h"
+
+// The ring lives in .noinit: allocated in RAM like .bss, but the startup code
+// neither loads nor zeroes it, so its contents ride through the system reset
+// the fault handler triggers. SRAM is only lost on actual power loss, after
+// which the checksum below fails and watch_fault_init starts fresh.
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+    watch_fault_record_t records[WATCH_FAULT_RING_DEPTH];
+    uint32_t checksum;
+} watch_fault_ring_t;
+
+#define WATCH_FAULT_MAGIC 0x46415531  // "FAU1"
+
+static watch_fault_ring_t _fault_ring __attribute__((section(".noinit")));
+static volatile uint8_t _fault_face_idx;
+
+static uint32_t _fault_ring_checksum(void) {
+    const uint32_t *words = (const uint32_t *)&_fault_ring;
+    uint32_t sum = 0x5EED5EED;
+    for (size_t i = 0; i < offsetof(watch_fault_ring_t, checksum) / sizeof(uint32_t); i++) {
+        sum = (sum << 5) - sum + words[i];
+    }
+    return sum;
+}
+
+static void _fault_ring_reset(void) {
+    memset(&_fault_ring, 0, sizeof(_fault_ring));
+    _fault_ring.magic = WATCH_FAULT_MAGIC;
+    _fault_ring.checksum = _fault_ring_checksum();
+}
+
+void watch_fault_init(void) {
+    if (_fault_ring.magic != WATCH_FAULT_MAGIC || _fault_ring.checksum != _fault_ring_checksum()) {
+        _fault_ring_reset();
+    }
+}
+
+void watch_fault_set_context(uint8_t face_idx) {
+    _fault_face_idx = face_idx;
+}
+
+uint32_t watch_fault_count(void) {
+    return _fault_ring.seq;
+}
+
+uint8_t watch_fault_get_records(watch_fault_record_t *out, uint8_t max) {
+    uint32_t available = _fault_ring.seq;
+    if (available > WATCH_FAULT_RING_DEPTH) available = WATCH_FAULT_RING_DEPTH;
+    if (available > max) available = max;
+    for (uint32_t i = 0; i < available; i++) {
+        // newest first: seq - 1 is the slot written last
+        out[i] = _fault_ring.records[(_fault_ring.seq - 1 - i) % WATCH_FAULT_RING_DEPTH];
+    }
+    return (uint8_t)available;
+}
+
+void watch_fault_clear(void) {
+    _fault_ring_reset();
+}
+
+// Tail-called from the fault handler with a pointer to the stacked exception
+// frame. Not static: the handler's assembly references it by name.
+void _watch_fault_capture(uint32_t *frame);
+void _watch_fault_capture(uint32_t *frame) {
+    // a fault can hit before watch_fault_init (or corrupt the ring itself);
+    // start a fresh ring rather than XOR-chaining onto garbage.
+    if (_fault_ring.magic != WATCH_FAULT_MAGIC || _fault_ring.checksum != _fault_ring_checksum()) {
+        _fault_ring_reset();
+    }
+
+    watch_fault_record_t *rec = &_fault_ring.records[_fault_ring.seq % WATCH_FAULT_RING_DEPTH];
+    _fault_ring.seq++;
+    rec->pc = frame[6];  // hardware pushes r0-r3, r12, lr, pc, xpsr
+    rec->lr = frame[5];
+    rec->sp = (uint32_t)frame;
+    rec->seq = (uint16_t)_fault_ring.seq;
+    rec->face_idx = _fault_face_idx;
+    rec->reserved = 0;
+    _fault_ring.checksum = _fault_ring_checksum();
+
+    NVIC_SystemReset();
+    while (1);
+}
+
+// Overrides the weak HardFault_Handler alias in the startup code. Everything
+// in this firmware runs on the main stack, so the exception frame the
+// hardware pushed is sitting right at MSP on entry; with no prologue to move
+// the stack pointer, MSP is the frame pointer we hand to the capture routine.
+__attribute__((naked)) void HardFault_Handler(void);
+__attribute__((naked)) void HardFault_Handler(void) {
+    __asm volatile (
+        "mrs r0, msp                  \n"
+        "ldr r1, =_watch_fault_capture\n"
+        "bx  r1                       \n"
+        ".ltorg                       \n"
+    );
+}
@@ -66,3 +66,27 @@ void watch_set_pin_level(const uint8_t pin, const bool level) {
         PORT->Group[pin >> 5].OUTCLR.reg = (1 << (pin & 0x1F));
     }
 }
+
+void watch_set_pins(const uint8_t port, const uint32_t mask) {
+    PORT->Group[port].OUTSET.reg = mask;
+}
+
+void watch_clear_pins(const uint8_t port, const uint32_t mask) {
+    PORT->Group[port].OUTCLR.reg = mask;
+}
+
+void watch_toggle_pins(const uint8_t port, const uint32_t mask) {
+    PORT->Group[port].OUTTGL.reg = mask;
+}
+
+void watch_enable_output_pins(const uint8_t port, const uint32_t mask) {
+    PORT->Group[port].DIRSET.reg = mask;
+}
+
+void watch_disable_output_pins(const uint8_t port, const uint32_t mask) {
+    PORT->Group[port].DIRCLR.reg = mask;
+}
+
+uint32_t watch_get_pins(const uint8_t port, const uint32_t mask) {
+    return PORT->Group[port].IN.reg & mask;
+}
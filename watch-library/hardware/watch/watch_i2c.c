@@ -23,19 +23,32 @@
  */
 
 #include "watch_i2c.h"
+#include "watch_power.h"
+#include "watch_bus.h"
 #include "i2c.h"
+#include "system.h"
 
 #ifdef I2C_SERCOM
 
+static watch_i2c_speed_t _i2c_speed = WATCH_I2C_SPEED_STANDARD;
+
+static void _watch_i2c_apply_speed(void);
+
 void watch_enable_i2c(void) {
+    if (!_watch_bus_claim(WATCH_BUS_I2C)) return;
     HAL_GPIO_SDA_pmuxen(HAL_GPIO_PMUX_SERCOM);
     HAL_GPIO_SCL_pmuxen(HAL_GPIO_PMUX_SERCOM);
     i2c_init();
     i2c_enable();
+    // i2c_init programs the standard 100 kHz baud; restore the selected speed.
+    if (_i2c_speed != WATCH_I2C_SPEED_STANDARD) _watch_i2c_apply_speed();
+    watch_power_track_enable(WATCH_POWER_I2C);
 }
 
 void watch_disable_i2c(void) {
+    if (!_watch_bus_release(WATCH_BUS_I2C)) return;
     i2c_disable();
+    watch_power_track_disable(WATCH_POWER_I2C);
 }
 
 int8_t watch_i2c_send(int16_t addr, uint8_t *buf, uint16_t length) {
@@ -104,4 +117,145 @@ uint32_t watch_i2c_read32(int16_t addr, uint8_t reg) {
     return data;
 }
 
+// ---- Asynchronous transfers -----------------------------------------------------------
+// The blocking calls above spin on the SERCOM sync flags for every byte. The engine below
+// runs the same write-then-read sequence from the SERCOM interrupt so the core can sit in
+// IDLE between bytes. Direct register access, same as the TC and SLCD code elsewhere in
+// this library; gossamer has no async I2C wrapper yet.
+
+#define _I2C_SERCOM_INST(n) SERCOM ## n
+#define I2C_SERCOM_INST(n) _I2C_SERCOM_INST(n)
+#define _I2C_SERCOM_IRQN(n) SERCOM ## n ## _IRQn
+#define I2C_SERCOM_IRQN(n) _I2C_SERCOM_IRQN(n)
+#define _I2C_SERCOM_HANDLER(n) irq_handler_sercom ## n
+#define I2C_SERCOM_HANDLER(n) _I2C_SERCOM_HANDLER(n)
+#define I2CM (I2C_SERCOM_INST(I2C_SERCOM)->I2CM)
+
+static struct {
+    int16_t addr;
+    const uint8_t *tx_buf;
+    uint16_t tx_length;
+    uint16_t tx_pos;
+    uint8_t *rx_buf;
+    uint16_t rx_length;
+    uint16_t rx_pos;
+    watch_i2c_cb_t callback;
+    volatile bool in_progress;
+} _i2c_async;
+
+static inline void _i2c_sync(void) {
+    while (I2CM.SYNCBUSY.bit.SYSOP);
+}
+
+static void _watch_i2c_apply_speed(void) {
+    // BAUD = GCLK / (2 * f_SCL) - 5, ignoring the rise time term like i2c_init does.
+    // The SERCOM core clock follows the CPU clock, so compute against the current rate.
+    uint32_t target_hz = (_i2c_speed == WATCH_I2C_SPEED_FAST) ? 400000 : 100000;
+    uint32_t baud = get_cpu_frequency() / (2 * target_hz);
+    baud = (baud > 5) ? (baud - 5) : 0;
+    if (baud > 255) baud = 255;
+
+    // BAUD is enable-protected: bring the SERCOM down to change it, then force
+    // the bus state machine back to idle.
+    I2CM.CTRLA.bit.ENABLE = 0;
+    while (I2CM.SYNCBUSY.reg);
+    I2CM.BAUD.bit.BAUD = baud;
+    I2CM.CTRLA.bit.ENABLE = 1;
+    while (I2CM.SYNCBUSY.reg);
+    I2CM.STATUS.bit.BUSSTATE = 1;
+    _i2c_sync();
+}
+
+void watch_i2c_set_speed(watch_i2c_speed_t speed) {
+    if (speed == _i2c_speed) return;
+    _i2c_speed = speed;
+    if (I2CM.CTRLA.bit.ENABLE) _watch_i2c_apply_speed();
+}
+
+watch_i2c_speed_t watch_i2c_get_speed(void) {
+    return _i2c_speed;
+}
+
+static void _watch_i2c_async_finish(int8_t result) {
+    I2CM.INTENCLR.reg = SERCOM_I2CM_INTENCLR_MB | SERCOM_I2CM_INTENCLR_SB | SERCOM_I2CM_INTENCLR_ERROR;
+    _i2c_async.in_progress = false;
+    if (_i2c_async.callback) _i2c_async.callback(result);
+}
+
+bool watch_i2c_submit(int16_t addr, const uint8_t *tx_buf, uint16_t tx_length, uint8_t *rx_buf, uint16_t rx_length, watch_i2c_cb_t callback_on_complete) {
+    if (_i2c_async.in_progress) return false;
+    if (tx_length == 0 && rx_length == 0) return false;
+
+    _i2c_async.addr = addr;
+    _i2c_async.tx_buf = tx_buf;
+    _i2c_async.tx_length = tx_length;
+    _i2c_async.tx_pos = 0;
+    _i2c_async.rx_buf = rx_buf;
+    _i2c_async.rx_length = rx_length;
+    _i2c_async.rx_pos = 0;
+    _i2c_async.callback = callback_on_complete;
+    _i2c_async.in_progress = true;
+
+    NVIC_ClearPendingIRQ(I2C_SERCOM_IRQN(I2C_SERCOM));
+    NVIC_EnableIRQ(I2C_SERCOM_IRQN(I2C_SERCOM));
+    I2CM.INTENSET.reg = SERCOM_I2CM_INTENSET_MB | SERCOM_I2CM_INTENSET_SB | SERCOM_I2CM_INTENSET_ERROR;
+
+    I2CM.CTRLB.bit.ACKACT = 0;
+    _i2c_sync();
+    // writing the address with the direction bit kicks off the transfer; everything else
+    // happens in the interrupt handler.
+    I2CM.ADDR.reg = ((uint16_t)addr << 1) | (tx_length ? 0 : 1);
+    return true;
+}
+
+bool watch_i2c_async_in_progress(void) {
+    return _i2c_async.in_progress;
+}
+
+void I2C_SERCOM_HANDLER(I2C_SERCOM)(void);
+void I2C_SERCOM_HANDLER(I2C_SERCOM)(void) {
+    if (I2CM.INTFLAG.bit.ERROR) {
+        // bus error or arbitration lost; give up.
+        I2CM.INTFLAG.reg = SERCOM_I2CM_INTFLAG_ERROR;
+        _watch_i2c_async_finish(-1);
+        return;
+    }
+
+    if (I2CM.INTFLAG.bit.MB) {
+        // controller on bus: the previous address or data byte finished clocking out.
+        if (I2CM.STATUS.bit.RXNACK) {
+            I2CM.CTRLB.bit.CMD = 3; // stop
+            _i2c_sync();
+            _watch_i2c_async_finish(-1);
+        } else if (_i2c_async.tx_pos < _i2c_async.tx_length) {
+            I2CM.DATA.reg = _i2c_async.tx_buf[_i2c_async.tx_pos++];
+        } else if (_i2c_async.rx_length) {
+            // repeated start with the read bit; continues in the SB branch below.
+            I2CM.ADDR.reg = ((uint16_t)_i2c_async.addr << 1) | 1;
+        } else {
+            I2CM.CTRLB.bit.CMD = 3; // stop
+            _i2c_sync();
+            _watch_i2c_async_finish(0);
+        }
+        return;
+    }
+
+    if (I2CM.INTFLAG.bit.SB) {
+        // target on bus: a received byte is waiting in DATA.
+        if (_i2c_async.rx_pos == _i2c_async.rx_length - 1) {
+            // last byte: NACK and stop before pulling it out of DATA.
+            I2CM.CTRLB.bit.ACKACT = 1;
+            I2CM.CTRLB.bit.CMD = 3;
+            _i2c_sync();
+            _i2c_async.rx_buf[_i2c_async.rx_pos++] = I2CM.DATA.reg;
+            I2CM.CTRLB.bit.ACKACT = 0;
+            _watch_i2c_async_finish(0);
+        } else {
+            I2CM.CTRLB.bit.CMD = 2; // ack and clock in the next byte
+            _i2c_sync();
+            _i2c_async.rx_buf[_i2c_async.rx_pos++] = I2CM.DATA.reg;
+        }
+    }
+}
+
 #endif // I2C_SERCOM
@@ -29,9 +29,44 @@
 #include "usb.h"
 #include "system.h"
 
+// CPU SPEED ARBITRATION
+// Reference counts per speed level; the core runs at the highest level anyone has
+// an outstanding request for, falling back to 4 MHz. USB holds a permanent 8 MHz
+// request while enabled, and Movement raises 16 MHz around compute-heavy face work.
+static uint8_t _cpu_speed_requests[WATCH_CPU_SPEED_COUNT];
+static const uint32_t _cpu_speed_hz[WATCH_CPU_SPEED_COUNT] = {4000000, 8000000, 16000000};
+static uint32_t _cpu_speed_current;
+
+static void _watch_apply_cpu_speed(void) {
+    watch_cpu_speed_t top = WATCH_CPU_SPEED_4MHZ;
+    for (int i = WATCH_CPU_SPEED_COUNT - 1; i > 0; i--) {
+        if (_cpu_speed_requests[i]) {
+            top = (watch_cpu_speed_t)i;
+            break;
+        }
+    }
+    if (_cpu_speed_hz[top] != _cpu_speed_current) {
+        _cpu_speed_current = _cpu_speed_hz[top];
+        set_cpu_frequency(_cpu_speed_current);
+    }
+}
+
+void watch_request_cpu_speed(watch_cpu_speed_t speed) {
+    if (speed >= WATCH_CPU_SPEED_COUNT) return;
+    if (_cpu_speed_requests[speed] < UINT8_MAX) _cpu_speed_requests[speed]++;
+    _watch_apply_cpu_speed();
+}
+
+void watch_release_cpu_speed(watch_cpu_speed_t speed) {
+    if (speed >= WATCH_CPU_SPEED_COUNT) return;
+    if (_cpu_speed_requests[speed] == 0) return; // unbalanced release
+    _cpu_speed_requests[speed]--;
+    _watch_apply_cpu_speed();
+}
+
 void _watch_init(void) {
-    // set frequency to 4 MHz
-    set_cpu_frequency(4000000);
+    // start at the 4 MHz baseline; requests raise it from here
+    _watch_apply_cpu_speed();
 
     // disable debugger hot-plugging
     HAL_GPIO_SWCLK_pmuxdis();
@@ -133,7 +168,11 @@ int getentropy(void *buf, size_t buflen) {
 
 
 void _watch_enable_usb(void) {
-    set_cpu_frequency(8000000);
+    // USB needs an 8 MHz floor as long as it is enabled; this request is never released.
+    watch_request_cpu_speed(WATCH_CPU_SPEED_8MHZ);
+    // build the string descriptors before attaching, so the host's first GET
+    // STRING request doesn't wait on the serial number being hexified.
+    watch_usb_descriptors_build();
     usb_init();
     usb_enable();
 }
@@ -29,6 +29,7 @@
 #include "watch_rtc.h"
 #include "watch_private.h"
 #include "watch_utility.h"
+#include "watch_wake_stats.h"
 
 static const uint32_t RTC_OSC_DIV = 10;
 static const uint32_t RTC_OSC_HZ = 1 << RTC_OSC_DIV; // 2^10 = 1024
@@ -44,6 +45,11 @@ static const int TB_BKUP_REG = 7;
 
 #define WATCH_RTC_N_COMP_CB 8
 
+// One extra comp slot, past the range the public API accepts, drives the
+// frequency correction phase slew at the bottom of this file.
+#define RTC_SLEW_COMP_INDEX WATCH_RTC_N_COMP_CB
+#define RTC_N_COMP_SLOTS (WATCH_RTC_N_COMP_CB + 1)
+
 typedef struct {
     volatile uint32_t counter;
     volatile watch_cb_t callback;
@@ -53,7 +59,12 @@ typedef struct {
 volatile uint32_t scheduled_comp_counter;
 
 watch_cb_t tick_callbacks[8];
-comp_cb_t comp_callbacks[WATCH_RTC_N_COMP_CB];
+
+// Maps a nonzero nibble to the index of its highest set bit. Deliberately not
+// const: as an initialized static it lands in .data, so the RAM-resident ISR
+// below resolves pending PER bits without ever touching flash.
+static uint8_t per_msb_nibble[16] = { 0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3 };
+comp_cb_t comp_callbacks[RTC_N_COMP_SLOTS];
 watch_cb_t alarm_callback;
 watch_cb_t btn_alarm_callback;
 watch_cb_t a2_callback;
@@ -73,7 +84,7 @@ void _watch_rtc_init(void) {
     rtc_enable();
     rtc_configure_callback(watch_rtc_callback);
 
-    for (uint8_t index = 0; index < WATCH_RTC_N_COMP_CB; ++index) {
+    for (uint8_t index = 0; index < RTC_N_COMP_SLOTS; ++index) {
         comp_callbacks[index].counter = 0;
         comp_callbacks[index].callback = NULL;
         comp_callbacks[index].enabled = false;
@@ -145,6 +156,10 @@ uint32_t watch_rtc_get_ticks_per_minute(void) {
     return RTC_CNT_TICKS_PER_MINUTE;
 }
 
+uint32_t watch_rtc_counter_to_centiseconds(rtc_counter_t ticks) {
+    return (ticks >> RTC_CNT_DIV) * 100 + (((ticks & RTC_CNT_SUBSECOND_MASK) * 100) >> RTC_CNT_DIV);
+}
+
 rtc_date_time_t watch_get_init_date_time(void) {
     rtc_date_time_t date_time;
 #ifdef BUILD_YEAR
@@ -183,6 +198,13 @@ void watch_rtc_register_periodic_callback(watch_cb_t callback, uint8_t frequency
     // we told them, it has to be a power of 2.
     if (__builtin_popcount(frequency) != 1) return;
 
+    // the interrupt dispatch assumes every enabled PER bit has a callback
+    // behind it; treat a NULL registration as a disable to keep that true.
+    if (callback == NULL) {
+        watch_rtc_disable_periodic_callback(frequency);
+        return;
+    }
+
     // this left-justifies the period in a 32-bit integer.
     uint32_t tmp = (frequency & 0xFF) << 24;
     // now we can count the leading zeroes to get the value we need.
@@ -222,7 +244,7 @@ void watch_rtc_schedule_next_comp(void) {
     rtc_counter_t comp_counter;
     rtc_counter_t min_diff = UINT_MAX;
 
-    for (uint8_t index = 0; index < WATCH_RTC_N_COMP_CB; ++index) {
+    for (uint8_t index = 0; index < RTC_N_COMP_SLOTS; ++index) {
         if (comp_callbacks[index].enabled) {
             rtc_counter_t diff = comp_callbacks[index].counter - lax_curr_counter;
             if (diff <= min_diff) {
@@ -289,24 +311,29 @@ void watch_rtc_disable_comp_callback_no_schedule(uint8_t index) {
     comp_callbacks[index].enabled = false;
 }
 
-void watch_rtc_callback(uint16_t interrupt_cause) {
+WATCH_RAMFUNC void watch_rtc_callback(uint16_t interrupt_cause) {
     // First read all relevant registers, to ensure no changes occurr during the callbacks
     rtc_counter_t curr_counter = watch_rtc_get_counter();
     uint16_t interrupt_enabled = (uint16_t)RTC->MODE0.INTENSET.reg;
 
-    if ((interrupt_cause & interrupt_enabled) & RTC_MODE0_INTFLAG_PER_Msk) {
-        // handle the tick callback first, it's what we do the most.
-        // start from PER7, the 1 Hz tick.
-        for(int8_t i = 7; i >= 0; i--) {
-            if ((interrupt_cause & interrupt_enabled) & (1 << i)) {
-                if (tick_callbacks[i] != NULL) {
-                    tick_callbacks[i]();
-                }
-            }
-        }
+    uint16_t per_pending = (interrupt_cause & interrupt_enabled) & RTC_MODE0_INTFLAG_PER_Msk;
+    if (per_pending) {
+        watch_wake_stats_record(WATCH_WAKE_RTC_PERIODIC);
+        // registration guarantees a callback behind every enabled PER bit, so
+        // pending bits index straight into the slot table: no scan over the
+        // eight slots and no NULL checks. The usual interrupt has exactly one
+        // bit pending, making this a single table load and indirect call.
+        // dispatch the highest bit first; PER7 is the 1 Hz tick.
+        do {
+            uint8_t slot = (per_pending & 0xF0) ? (4 + per_msb_nibble[per_pending >> 4])
+                                                : per_msb_nibble[per_pending];
+            tick_callbacks[slot]();
+            per_pending &= ~(1 << slot);
+        } while (per_pending);
     }
 
     if ((interrupt_cause & interrupt_enabled) & RTC_MODE0_INTFLAG_TAMPER) {
+        watch_wake_stats_record(WATCH_WAKE_RTC_EXTWAKE);
         // handle the extwake interrupts next.
         uint8_t reason = RTC->MODE0.TAMPID.reg;
         if (reason & RTC_TAMPID_TAMPID2) {
@@ -320,7 +347,8 @@ void watch_rtc_callback(uint16_t interrupt_cause) {
     }
 
     if ((interrupt_cause & interrupt_enabled) & RTC_MODE0_INTFLAG_CMP0) {
-        for (uint8_t index = 0; index < WATCH_RTC_N_COMP_CB; ++index) {
+        watch_wake_stats_record(WATCH_WAKE_RTC_COMP);
+        for (uint8_t index = 0; index < RTC_N_COMP_SLOTS; ++index) {
             if (comp_callbacks[index].enabled &&
                 (curr_counter - comp_callbacks[index].counter) < (RTC_COMP_GRACE_PERIOD * 4)
             ) {
@@ -348,13 +376,144 @@ void watch_rtc_enable(bool en) {
     while (RTC->MODE0.SYNCBUSY.reg);
 }
 
-void watch_rtc_freqcorr_write(int16_t value, int16_t sign) {
+// Signed FREQCORR steps requested through watch_rtc_freqcorr_write, plus the
+// extra steps the phase slew below is temporarily holding on top of them.
+// A positive correction slows the clock down; a negative one speeds it up.
+static volatile int16_t freqcorr_baseline;
+static volatile int16_t slew_offset;
+
+// Phase still owed to the caller, in microseconds; positive advances the clock.
+static volatile int32_t slew_pending_us;
+static volatile rtc_counter_t slew_start_counter;
+static volatile uint32_t slew_leg_ticks;
+static volatile int32_t slew_leg_us;
+
+// The slew bookkeeping above is shared with cb_slew_complete, which runs from the
+// RTC compare interrupt. A leg completing while the main thread is mid-settlement
+// would subtract the leg's slipped phase twice, so the main-thread entry points
+// mask the RTC interrupt across the account/start pair (the same shape as
+// watch_dma_critical_enter for the DMAC). A completion that fires while masked
+// stays pending and is dispatched harmlessly after: the old leg's comp slot has
+// been retired or rearmed for the new leg by then.
+static void _watch_rtc_slew_critical_enter(void) {
+    NVIC_DisableIRQ(RTC_IRQn);
+}
+
+static void _watch_rtc_slew_critical_exit(void) {
+    NVIC_EnableIRQ(RTC_IRQn);
+}
+
+static void _watch_rtc_freqcorr_apply(void) {
+    int16_t correction = freqcorr_baseline + slew_offset;
     RTC_FREQCORR_Type data;
 
-    data.bit.VALUE = value;
-    data.bit.SIGN = sign;
+    if (correction < 0) {
+        data.bit.VALUE = -correction;
+        data.bit.SIGN = 1;
+    } else {
+        data.bit.VALUE = correction;
+        data.bit.SIGN = 0;
+    }
 
     RTC->MODE0.FREQCORR.reg = data.reg; // Setting correction in single write operation
 
     // We do not sycnronize. We are not in a hurry
 }
+
+// One FREQCORR step changes the rate by 2^-20 and the counter ticks 2^7 times a
+// second, so a leg of T ticks at offset S slips S * T / 2^27 seconds. A positive
+// offset slows the clock, i.e. the slipped phase is negative.
+static int32_t _watch_rtc_slew_leg_us(int16_t offset, uint32_t ticks) {
+    return (int32_t)-(((int64_t)offset * ticks * 1000000 + (1 << 26)) >> 27);
+}
+
+// Settles the books on the leg in flight, if any: subtracts the phase it has
+// slipped so far from what is owed and retires its comp slot.
+static void _watch_rtc_slew_account(void) {
+    if (slew_leg_ticks == 0) return;
+
+    rtc_counter_t elapsed = watch_rtc_get_counter() - slew_start_counter;
+    if (elapsed >= slew_leg_ticks) {
+        slew_pending_us -= slew_leg_us;
+    } else {
+        slew_pending_us -= (int32_t)((int64_t)slew_leg_us * elapsed / slew_leg_ticks);
+    }
+
+    slew_leg_ticks = 0;
+    comp_callbacks[RTC_SLEW_COMP_INDEX].enabled = false;
+}
+
+static void cb_slew_complete(void);
+
+static void _watch_rtc_slew_start(void) {
+    int32_t pending = slew_pending_us;
+    slew_leg_ticks = 0;
+    slew_offset = 0;
+
+    // One tick at the rail slips just under a microsecond; anything below two
+    // is beneath the quantization and would only set up an oscillating pair of
+    // one-tick legs with opposite signs. Call it done.
+    if (pending > -2 && pending < 2) {
+        slew_pending_us = 0;
+    } else {
+        // Pin the total correction at whichever register rail moves the phase
+        // in the needed direction. If the baseline already sits at that rail
+        // there is no room to slew; hold the debt until the baseline moves.
+        int16_t offset = ((pending > 0) ? -127 : 127) - freqcorr_baseline;
+        if (offset != 0) {
+            // ticks = |pending| * 2^27 / (|offset| * 10^6), rounded to nearest.
+            uint64_t denominator = (uint64_t)((offset < 0) ? -offset : offset) * 1000000;
+            uint64_t ticks = (((uint64_t)((pending < 0) ? -pending : pending) << 27) + denominator / 2) / denominator;
+            // half the counter range keeps the comp target unambiguous; the
+            // remainder of an oversized debt rolls into the next leg.
+            if (ticks > (UINT_MAX >> 1)) ticks = UINT_MAX >> 1;
+
+            slew_offset = offset;
+            slew_start_counter = watch_rtc_get_counter();
+            slew_leg_ticks = ticks;
+            slew_leg_us = _watch_rtc_slew_leg_us(offset, ticks);
+
+            comp_callbacks[RTC_SLEW_COMP_INDEX].counter = slew_start_counter + ticks;
+            comp_callbacks[RTC_SLEW_COMP_INDEX].callback = cb_slew_complete;
+            comp_callbacks[RTC_SLEW_COMP_INDEX].enabled = true;
+        }
+    }
+
+    _watch_rtc_freqcorr_apply();
+    watch_rtc_schedule_next_comp();
+}
+
+static void cb_slew_complete(void) {
+    _watch_rtc_slew_account();
+    _watch_rtc_slew_start();
+}
+
+void watch_rtc_phase_adjust(int32_t milliseconds) {
+    _watch_rtc_slew_critical_enter();
+    _watch_rtc_slew_account();
+
+    int64_t pending = (int64_t)slew_pending_us + (int64_t)milliseconds * 1000;
+    // an hour of debt already means weeks at the rail; don't let it overflow.
+    if (pending > 3600000000ll) pending = 3600000000ll;
+    else if (pending < -3600000000ll) pending = -3600000000ll;
+    slew_pending_us = (int32_t)pending;
+
+    _watch_rtc_slew_start();
+    _watch_rtc_slew_critical_exit();
+}
+
+void watch_rtc_freqcorr_write(int16_t value, int16_t sign) {
+    _watch_rtc_slew_critical_enter();
+    freqcorr_baseline = sign ? -value : value;
+
+    if (slew_leg_ticks != 0 || slew_pending_us != 0) {
+        // A leg in flight was timed against the old baseline: settle what it has
+        // slipped so far and restart it at the rail relative to the new one. This
+        // also resumes a debt that was parked because the old baseline left no room.
+        _watch_rtc_slew_account();
+        _watch_rtc_slew_start();
+    } else {
+        _watch_rtc_freqcorr_apply();
+    }
+    _watch_rtc_slew_critical_exit();
+}
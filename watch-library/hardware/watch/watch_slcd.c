@@ -23,11 +23,13 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include "delay.h"
 #include "usb.h"
 #include "pins.h"
 #include "watch_slcd.h"
 #include "watch_common_display.h"
+#include "watch_deepsleep.h"
 #include "slcd.h"
 #include "tc.h"
 #include "adc.h"
@@ -40,12 +42,22 @@ static uint16_t _slcd_fc_min_ms_bypass = 0;
 
 static watch_lcd_type_t _installed_display = WATCH_LCD_TYPE_UNKNOWN;
 
+// Backup register used to persist the LCD detection result across resets; 0 when
+// caching is disabled. The magic keeps stale garbage from masquerading as a result.
+static uint8_t _lcd_type_cache_register;
+#define LCD_TYPE_CACHE_CLASSIC 0x4C43441C
+#define LCD_TYPE_CACHE_CUSTOM  0x4C43442C
+
+void watch_enable_lcd_type_cache(uint8_t backup_register) {
+    _lcd_type_cache_register = backup_register;
+}
+
 /// NOTE: The function below was commented out because LCD autodetection proved unreliable.
 /// While I would love to fix it, I can't figure it out in time for the product launch.
 /// Instead, this function simply implements the failsafe: red LED glows until one of two
 /// buttons is pressed: bottom left button for classic LCD, bottom right button for custom.
 /// 
-void watch_discover_lcd_type(void) {
+WATCH_COLDFUNC void watch_discover_lcd_type(void) {
     #if defined(FORCE_CUSTOM_LCD_TYPE)
     _installed_display = WATCH_LCD_TYPE_CUSTOM;
     _watch_update_indicator_segments();
@@ -58,6 +70,21 @@ void watch_discover_lcd_type(void) {
     // Don't bother detecting the LCD type if we're plugged into USB.
     if (usb_is_enabled()) return;
 
+    // If a previous boot already detected the LCD, trust the cached result and skip
+    // the blocking probe; the cache survives everything short of a backup-domain reset.
+    if (_lcd_type_cache_register) {
+        uint32_t cached = watch_get_backup_data(_lcd_type_cache_register);
+        if (cached == LCD_TYPE_CACHE_CLASSIC) {
+            _installed_display = WATCH_LCD_TYPE_CLASSIC;
+            return;
+        }
+        if (cached == LCD_TYPE_CACHE_CUSTOM) {
+            _installed_display = WATCH_LCD_TYPE_CUSTOM;
+            _watch_update_indicator_segments();
+            return;
+        }
+    }
+
     // Set red LED to indicate that LED detection is active.
     watch_enable_leds();
     watch_set_led_color_rgb(16, 0, 0);
@@ -88,12 +115,18 @@ void watch_discover_lcd_type(void) {
     watch_set_led_off();
     watch_disable_leds();
 
+    // Remember the answer so the next boot doesn't have to ask.
+    if (_lcd_type_cache_register) {
+        watch_store_backup_data(_installed_display == WATCH_LCD_TYPE_CLASSIC ? LCD_TYPE_CACHE_CLASSIC : LCD_TYPE_CACHE_CUSTOM,
+                                _lcd_type_cache_register);
+    }
+
     // Update indicator segment mapping based on the detected display (they are v different).
     _watch_update_indicator_segments();
 }
 
 /*
-void watch_discover_lcd_type(void) {
+WATCH_COLDFUNC void watch_discover_lcd_type(void) {
     #if defined(FORCE_CUSTOM_LCD_TYPE)
     _installed_display = WATCH_LCD_TYPE_CUSTOM;
     goto valid_display_detected;
@@ -264,15 +297,82 @@ void watch_disable_display(void) {
     slcd_disable();
 }
 
+// Frame buffering: while a frame is open, pixel writes land in a RAM shadow of the
+// SDATAL words and the commit stores only the words that changed. The SDATAL/SDATAH
+// register pairs are laid out contiguously, so the low word for a given common line
+// lives at stride 2 from SDATAL0.
+static uint8_t _frame_depth;
+static uint32_t _frame_sdata[8];
+
+WATCH_RAMFUNC void watch_display_begin_frame(void) {
+    if (_frame_depth++ == 0) {
+        volatile uint32_t *sdatal = &SLCD->SDATAL0.reg;
+        for (uint8_t com = 0; com < 8; com++) _frame_sdata[com] = sdatal[com * 2];
+    }
+}
+
+WATCH_RAMFUNC void watch_display_commit_frame(void) {
+    if (_frame_depth == 0) return;
+    if (--_frame_depth == 0) {
+        volatile uint32_t *sdatal = &SLCD->SDATAL0.reg;
+        // Latch the display memory while we store the new frame: the panel keeps
+        // scanning the old contents until the lock is released, and the controller
+        // picks up the whole new frame on its next refresh. A multi-word update can
+        // never be seen half-applied, no matter where the frame scan is.
+        SLCD->CTRLC.bit.LOCK = 1;
+        for (uint8_t com = 0; com < 8; com++) {
+            if (sdatal[com * 2] != _frame_sdata[com]) sdatal[com * 2] = _frame_sdata[com];
+        }
+        SLCD->CTRLC.bit.LOCK = 0;
+    }
+}
+
+// Wake snapshot: the last-committed normal-mode frame, captured at low energy
+// entry and put back the instant the watch wakes. Same layout as the frame shadow.
+static uint32_t _snapshot_sdata[8];
+
+void watch_display_snapshot(void) {
+    volatile uint32_t *sdatal = &SLCD->SDATAL0.reg;
+    for (uint8_t com = 0; com < 8; com++) _snapshot_sdata[com] = sdatal[com * 2];
+}
+
+void watch_display_restore_snapshot(void) {
+    volatile uint32_t *sdatal = &SLCD->SDATAL0.reg;
+    // the restored pixels no longer match characters cached from the sleep frame
+    watch_display_cache_invalidate();
+    // latch the display memory around the stores, as in watch_display_commit_frame,
+    // so the panel can never scan out a half-restored frame.
+    SLCD->CTRLC.bit.LOCK = 1;
+    for (uint8_t com = 0; com < 8; com++) sdatal[com * 2] = _snapshot_sdata[com];
+    SLCD->CTRLC.bit.LOCK = 0;
+}
+
 inline void watch_set_pixel(uint8_t com, uint8_t seg) {
+    // a raw pixel write may overdraw a cached character; drop the shadow buffer
+    if (!_watch_display_character_in_progress) watch_display_cache_invalidate();
+    if (_frame_depth && seg < 32) {
+        _frame_sdata[com] |= (uint32_t)1 << seg;
+        return;
+    }
     slcd_set_segment(com, seg);
 }
 
 inline void watch_clear_pixel(uint8_t com, uint8_t seg) {
+    if (!_watch_display_character_in_progress) watch_display_cache_invalidate();
+    if (_frame_depth && seg < 32) {
+        _frame_sdata[com] &= ~((uint32_t)1 << seg);
+        return;
+    }
     slcd_clear_segment(com, seg);
 }
 
 void watch_clear_display(void) {
+    watch_display_cache_invalidate();
+    if (_frame_depth) {
+        // clearing inside an open frame clears the shadow; the commit stores the zeros.
+        memset(_frame_sdata, 0, sizeof(_frame_sdata));
+        return;
+    }
     slcd_clear();
 }
 
@@ -296,41 +396,65 @@ void watch_start_character_blink(char character, uint32_t duration) {
     slcd_enable();
 }
 
+bool watch_start_pixel_blink_if_possible(uint8_t com, uint8_t seg, uint32_t duration) {
+    // The blink hardware can only blink pixels on segment lines 0 and 1.
+    if (seg > 1) return false;
+
+    watch_set_pixel(com, seg);
+
+    if (duration <= _slcd_fc_min_ms_bypass) {
+        slcd_configure_frame_counter(0, (duration / (1000 / _slcd_framerate)) - 1, false);
+    } else {
+        slcd_configure_frame_counter(0, ((duration / (1000 / _slcd_framerate)) / 8 - 1), true);
+    }
+    slcd_set_frame_counter_enabled(0, true);
+
+    slcd_disable();
+    slcd_set_blink_enabled(false);
+    slcd_configure_blink(false, seg == 0 ? (1 << com) : 0, seg == 1 ? (1 << com) : 0, 0);
+    slcd_set_blink_enabled(true);
+    slcd_enable();
+
+    return true;
+}
+
+void watch_start_display_blink(uint32_t duration) {
+    slcd_set_frame_counter_enabled(0, false);
+
+    if (duration <= _slcd_fc_min_ms_bypass) {
+        slcd_configure_frame_counter(0, (duration / (1000 / _slcd_framerate)) - 1, false);
+    } else {
+        slcd_configure_frame_counter(0, ((duration / (1000 / _slcd_framerate)) / 8 - 1), true);
+    }
+    slcd_set_frame_counter_enabled(0, true);
+
+    slcd_disable();
+    slcd_set_blink_enabled(false);
+    // blink-all mode: the segment selects are ignored and every pixel toggles
+    slcd_configure_blink(true, 0, 0, 0);
+    slcd_set_blink_enabled(true);
+    slcd_enable();
+}
+
 void watch_start_indicator_blink_if_possible(watch_indicator_t indicator, uint32_t duration) {
     if (_installed_display == WATCH_LCD_TYPE_CUSTOM) {
-        // Indicators can only blink on the custom LCD.
-        uint8_t mask = 0;
+        // Indicators can only blink on the custom LCD, where they live on segment line 0.
         switch (indicator) {
         case WATCH_INDICATOR_COLON:
-            mask = 0b0001;
+            watch_start_pixel_blink_if_possible(0, 0, duration);
             break;
         case WATCH_INDICATOR_LAP:
-            mask = 0b0010;
+            watch_start_pixel_blink_if_possible(1, 0, duration);
             break;
         case WATCH_INDICATOR_ARROWS:
-            mask = 0b0100;
+            watch_start_pixel_blink_if_possible(2, 0, duration);
             break;
         case WATCH_INDICATOR_SLEEP:
-            mask = 0b1000;
+            watch_start_pixel_blink_if_possible(3, 0, duration);
             break;
         default:
             return;
         }
-        watch_set_indicator(indicator);
-
-        if (duration <= _slcd_fc_min_ms_bypass) {
-            slcd_configure_frame_counter(0, (duration / (1000 / _slcd_framerate)) - 1, false);
-        } else {
-            slcd_configure_frame_counter(0, ((duration / (1000 / _slcd_framerate)) / 8 - 1), true);
-        }
-        slcd_set_frame_counter_enabled(0, true);
-
-
-        slcd_disable();
-        slcd_set_blink_enabled(false);
-        slcd_configure_blink(false, mask, 0, 0);
-        slcd_set_blink_enabled(true);
-        slcd_enable();
     }
 }
 
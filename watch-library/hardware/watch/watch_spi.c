@@ -23,18 +23,185 @@
  */
 
 #include "watch_spi.h"
+#include "watch_power.h"
+#include "watch_bus.h"
+#include "watch_dma.h"
 #include "spi.h"
+#include "system.h"
+
+#ifdef SPI_SERCOM
+
+// ---- DMA bulk transfers ---------------------------------------------------------------
+// Byte-at-a-time spi_transfer leaves a CPU-sized gap between every byte on the bus. For
+// bulk transfers we hand the job to the DMAC (shared core in watch_dma.c) instead: one
+// channel feeds the SERCOM's DATA register on its TX trigger, another drains it on the
+// RX trigger, and the core idles until the transfer-complete interrupt. Short transfers
+// aren't worth the channel setup and stay on the polled path.
+
+#define _SPI_SERCOM_INST(n) SERCOM ## n
+#define SPI_SERCOM_INST(n) _SPI_SERCOM_INST(n)
+#define _SPI_SERCOM_DMAC_ID_TX(n) SERCOM ## n ## _DMAC_ID_TX
+#define SPI_SERCOM_DMAC_ID_TX(n) _SPI_SERCOM_DMAC_ID_TX(n)
+#define _SPI_SERCOM_DMAC_ID_RX(n) SERCOM ## n ## _DMAC_ID_RX
+#define SPI_SERCOM_DMAC_ID_RX(n) _SPI_SERCOM_DMAC_ID_RX(n)
+
+#define WATCH_SPI_DMA_THRESHOLD 16
+
+static volatile bool _dma_transfer_done;
+static uint8_t _dma_fill_byte = 0;
+static uint8_t _dma_sink_byte;
+
+static void _watch_spi_dma_rx_complete(void) {
+    // only the RX channel's transfer-complete interrupt is enabled; by the time the last
+    // byte has been drained, the TX side is long done.
+    _dma_transfer_done = true;
+}
+
+static bool _watch_spi_dma_run(const uint8_t *tx_buf, uint8_t *rx_buf, uint16_t length) {
+    watch_dma_init();
+    watch_dma_set_callback(WATCH_DMA_CHANNEL_SPI_RX, _watch_spi_dma_rx_complete);
+
+    uint32_t data_reg = (uint32_t)&SPI_SERCOM_INST(SPI_SERCOM)->SPI.DATA.reg;
+
+    // RX channel drains every byte the SERCOM clocks in, either into the caller's buffer
+    // or into a one-byte sink for write-only transfers. DMAC addresses point past the end
+    // of the buffer when incrementing.
+    watch_dma_descriptors[WATCH_DMA_CHANNEL_SPI_RX].BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE | (rx_buf ? DMAC_BTCTRL_DSTINC : 0);
+    watch_dma_descriptors[WATCH_DMA_CHANNEL_SPI_RX].BTCNT.reg = length;
+    watch_dma_descriptors[WATCH_DMA_CHANNEL_SPI_RX].SRCADDR.reg = data_reg;
+    watch_dma_descriptors[WATCH_DMA_CHANNEL_SPI_RX].DSTADDR.reg = rx_buf ? (uint32_t)(rx_buf + length) : (uint32_t)&_dma_sink_byte;
+    watch_dma_descriptors[WATCH_DMA_CHANNEL_SPI_RX].DESCADDR.reg = 0;
+
+    // TX channel feeds the data register, either from the caller's buffer or with a fixed
+    // fill byte for read-only transfers.
+    watch_dma_descriptors[WATCH_DMA_CHANNEL_SPI_TX].BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE | (tx_buf ? DMAC_BTCTRL_SRCINC : 0);
+    watch_dma_descriptors[WATCH_DMA_CHANNEL_SPI_TX].BTCNT.reg = length;
+    watch_dma_descriptors[WATCH_DMA_CHANNEL_SPI_TX].SRCADDR.reg = tx_buf ? (uint32_t)(tx_buf + length) : (uint32_t)&_dma_fill_byte;
+    watch_dma_descriptors[WATCH_DMA_CHANNEL_SPI_TX].DSTADDR.reg = data_reg;
+    watch_dma_descriptors[WATCH_DMA_CHANNEL_SPI_TX].DESCADDR.reg = 0;
+
+    _dma_transfer_done = false;
+
+    // another channel's interrupt (like the UART RX ring) could land mid-setup and move
+    // CHID out from under us; keep the DMAC interrupt masked while we bank-switch.
+    watch_dma_critical_enter();
+    watch_dma_setup_channel(WATCH_DMA_CHANNEL_SPI_RX, SPI_SERCOM_DMAC_ID_RX(SPI_SERCOM));
+    DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR;
+    DMAC->CHINTENSET.reg = DMAC_CHINTENSET_TCMPL;
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_ENABLE;
+
+    // enabling the TX channel starts the transfer; idle until the RX side finishes.
+    watch_dma_setup_channel(WATCH_DMA_CHANNEL_SPI_TX, SPI_SERCOM_DMAC_ID_TX(SPI_SERCOM));
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_ENABLE;
+    watch_dma_critical_exit();
+
+    while (!_dma_transfer_done) __WFI();
+
+    watch_dma_critical_enter();
+    DMAC->CHID.reg = WATCH_DMA_CHANNEL_SPI_RX;
+    DMAC->CHINTENCLR.reg = DMAC_CHINTENCLR_TCMPL;
+    watch_dma_critical_exit();
+
+    return true;
+}
+
+// ---- Per-device bus configuration -----------------------------------------------------
+// spi_init programs one conservative 1 MHz baud for everyone; the flash is rated an order
+// of magnitude faster than that. Rather than reconfiguring from scratch on every chip
+// select, we compute each device's BAUD and CTRLA register images once (per CPU clock,
+// since BAUD is derived from it) and cache them; switching devices is then two stores
+// around the SERCOM's enable cycle, and selecting the same device twice in a row is free.
+
+#define SPIM (SPI_SERCOM_INST(SPI_SERCOM)->SPI)
+
+#define WATCH_SPI_DEVICE_CACHE_SIZE 4
+
+static struct {
+    const watch_spi_device_t *device;
+    uint32_t cpu_hz;
+    uint32_t ctrla;     // base CTRLA with the device's CPOL/CPHA, ENABLE clear
+    uint8_t baud;
+} _spi_device_cache[WATCH_SPI_DEVICE_CACHE_SIZE];
+static const watch_spi_device_t *_spi_current_device;
+static uint32_t _spi_current_cpu_hz;
+
+static void _watch_spi_apply_device(const watch_spi_device_t *device) {
+    uint32_t cpu_hz = get_cpu_frequency();
+    uint8_t slot;
+
+    for (slot = 0; slot < WATCH_SPI_DEVICE_CACHE_SIZE; slot++) {
+        if (_spi_device_cache[slot].device == device && _spi_device_cache[slot].cpu_hz == cpu_hz) break;
+    }
+    if (slot == WATCH_SPI_DEVICE_CACHE_SIZE) {
+        // not cached yet: evict round-robin and compute the register images.
+        static uint8_t next_slot = 0;
+        slot = next_slot;
+        next_slot = (next_slot + 1) % WATCH_SPI_DEVICE_CACHE_SIZE;
+
+        // f_SCK = GCLK / (2 * (BAUD + 1)); round the divider up so we never exceed the
+        // device's rating. A request at or above GCLK/2 lands on BAUD=0, the SERCOM's top speed.
+        uint32_t baud = (cpu_hz + 2 * device->baud - 1) / (2 * device->baud);
+        baud = baud ? baud - 1 : 0;
+        if (baud > 255) baud = 255;
+
+        uint32_t ctrla = SPIM.CTRLA.reg & ~(SERCOM_SPI_CTRLA_CPOL | SERCOM_SPI_CTRLA_CPHA | SERCOM_SPI_CTRLA_ENABLE);
+        if (device->mode & 2) ctrla |= SERCOM_SPI_CTRLA_CPOL;
+        if (device->mode & 1) ctrla |= SERCOM_SPI_CTRLA_CPHA;
+
+        _spi_device_cache[slot].device = device;
+        _spi_device_cache[slot].cpu_hz = cpu_hz;
+        _spi_device_cache[slot].ctrla = ctrla;
+        _spi_device_cache[slot].baud = baud;
+    }
+
+    // BAUD and the clock mode bits are enable-protected; cycle the enable bit around the swap.
+    SPIM.CTRLA.bit.ENABLE = 0;
+    while (SPIM.SYNCBUSY.bit.ENABLE);
+    SPIM.CTRLA.reg = _spi_device_cache[slot].ctrla;
+    SPIM.BAUD.reg = _spi_device_cache[slot].baud;
+    SPIM.CTRLA.reg = _spi_device_cache[slot].ctrla | SERCOM_SPI_CTRLA_ENABLE;
+    while (SPIM.SYNCBUSY.bit.ENABLE);
+
+    _spi_current_device = device;
+    _spi_current_cpu_hz = cpu_hz;
+}
+
+#endif // SPI_SERCOM
+
+void watch_spi_device_select(const watch_spi_device_t *device) {
+#ifdef SPI_SERCOM
+    if (device != _spi_current_device || get_cpu_frequency() != _spi_current_cpu_hz) {
+        _watch_spi_apply_device(device);
+    }
+#endif
+    gpio_set_pin_level(device->cs_pin, false);
+}
+
+void watch_spi_device_deselect(const watch_spi_device_t *device) {
+    gpio_set_pin_level(device->cs_pin, true);
+}
 
 void watch_enable_spi(void) {
+    if (!_watch_bus_claim(WATCH_BUS_SPI)) return;
     spi_init(1000000);
     spi_enable();
+#ifdef SPI_SERCOM
+    // spi_init rewrote CTRLA and BAUD; force a reconfiguration on the next select.
+    _spi_current_device = NULL;
+#endif
+    watch_power_track_enable(WATCH_POWER_SPI);
 }
 
 void watch_disable_spi(void) {
+    if (!_watch_bus_release(WATCH_BUS_SPI)) return;
     spi_disable();
+    watch_power_track_disable(WATCH_POWER_SPI);
 }
 
 bool watch_spi_write(const uint8_t *buf, uint16_t length) {
+#ifdef SPI_SERCOM
+    if (length >= WATCH_SPI_DMA_THRESHOLD) return _watch_spi_dma_run(buf, NULL, length);
+#endif
     for (uint16_t i = 0; i < length; i++) {
         spi_transfer(buf[i]);
     }
@@ -43,6 +210,9 @@ bool watch_spi_write(const uint8_t *buf, uint16_t length) {
 }
 
 bool watch_spi_read(uint8_t *buf, uint16_t length) {
+#ifdef SPI_SERCOM
+    if (length >= WATCH_SPI_DMA_THRESHOLD) return _watch_spi_dma_run(NULL, buf, length);
+#endif
     for (uint16_t i = 0; i < length; i++) {
         buf[i] = spi_transfer(0);
     }
@@ -51,6 +221,9 @@ bool watch_spi_read(uint8_t *buf, uint16_t length) {
 }
 
 bool watch_spi_transfer(const uint8_t *data_out, uint8_t *data_in, uint16_t length) {
+#ifdef SPI_SERCOM
+    if (length >= WATCH_SPI_DMA_THRESHOLD) return _watch_spi_dma_run(data_out, data_in, length);
+#endif
     for (uint16_t i = 0; i < length; i++) {
         data_in[i] = spi_transfer(data_out[i]);
     }
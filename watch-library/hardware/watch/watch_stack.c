@@ -0,0 +1,77 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_stack.h"
+#include "watch.h"
+
+// Bounds of the main stack, from the linker script: _sstack is the lowest
+// address (where an overflow lands), _estack the initial stack pointer.
+extern uint32_t _sstack;
+extern uint32_t _estack;
+
+#define STACK_PAINT_WORD (0x57ACCA11)
+
+// Lowest address known to have been overwritten. Everything below it was still
+// painted the last time we looked; usage only ever deepens, so each check picks
+// up where the previous one stopped instead of rescanning the whole stack.
+static uint32_t *_stack_watermark;
+
+void watch_stack_paint(void) {
+    // read the live stack pointer, and leave a few words of headroom below it
+    // so we don't paint over this function's own frame.
+    uint32_t *sp = (uint32_t *)__get_MSP() - 8;
+    for (uint32_t *p = &_sstack; p < sp; p++) *p = STACK_PAINT_WORD;
+    _stack_watermark = sp;
+}
+
+uint32_t watch_stack_size(void) {
+    return (uint32_t)((uintptr_t)&_estack - (uintptr_t)&_sstack);
+}
+
+uint32_t watch_stack_high_water(void) {
+    if (!_stack_watermark) return 0;
+
+    // Walk down from the last known watermark. Frames can skip over locals they
+    // never touch, leaving painted holes inside used stack, so we only declare
+    // the new watermark once we've seen a solid run of intact paint below it.
+    uint32_t *p = _stack_watermark;
+    uint32_t *deepest = _stack_watermark;
+    uint8_t run = 0;
+    while (p > &_sstack && run < 8) {
+        p--;
+        if (*p == STACK_PAINT_WORD) {
+            run++;
+        } else {
+            run = 0;
+            deepest = p;
+        }
+    }
+    _stack_watermark = deepest;
+
+    return (uint32_t)((uintptr_t)&_estack - (uintptr_t)deepest);
+}
+
+bool watch_stack_overflowed(void) {
+    return _stack_watermark && _sstack != STACK_PAINT_WORD;
+}
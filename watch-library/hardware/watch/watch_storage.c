@@ -7,6 +7,25 @@
 #define RWWEE_ADDR_END (NVMCTRL_RWW_EEPROM_ADDR + NVMCTRL_PAGE_SIZE * NVMCTRL_RWWEE_PAGES)
 #define NVM_MEMORY ((volatile uint16_t *)FLASH_ADDR)
 
+#define PAGES_PER_ROW (NVMCTRL_ROW_SIZE / NVMCTRL_PAGE_SIZE)
+
+/*
+ * Row write buffer. littlefs programs one 64-byte page per call, and every
+ * page program used to pay full NVMCTRL command latency on the spot. Instead,
+ * writes land in a one-row RAM buffer and flush when the caller syncs, reads
+ * another row, or writes elsewhere. At flush time each dirty page is compared
+ * against the flash contents and programmed only if it differs — rewrites of
+ * identical data (settings saved with no changes, littlefs metadata replays)
+ * cost nothing — and erasing a row that already reads all 0xFF is skipped,
+ * which is where most of the wear savings on the 8 KB region come from.
+ * littlefs only requires durability at sync, and its sync callback calls
+ * watch_storage_sync, so the buffering is invisible to the filesystem.
+ */
+static uint8_t _row_buffer[NVMCTRL_ROW_SIZE];
+static uint32_t _row_buffer_row;
+static bool _row_buffer_valid = false;
+static uint8_t _row_buffer_dirty; // bitmask, one bit per page in the row
+
 static bool _is_valid_address(uint32_t addr, uint32_t size) {
     if ((addr < NVMCTRL_RWW_EEPROM_ADDR) || (addr > (NVMCTRL_RWW_EEPROM_ADDR + NVMCTRL_PAGE_SIZE * NVMCTRL_RWWEE_PAGES))) {
         return false;
@@ -18,7 +37,15 @@ static bool _is_valid_address(uint32_t addr, uint32_t size) {
     return true;
 }
 
-bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t size) {
+static void _wait_ready(void) {
+    while (!NVMCTRL->INTFLAG.bit.READY) {
+        // wait for flash to become ready
+    }
+
+    NVMCTRL->STATUS.reg = NVMCTRL_STATUS_MASK;
+}
+
+static bool _storage_read_raw(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t size) {
     uint32_t address = RWWEE_ADDR_START + row * NVMCTRL_ROW_SIZE + offset;
     if (!_is_valid_address(address, size)) return false;
 
@@ -26,7 +53,7 @@ bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t
     uint32_t i;
     uint16_t data;
 
-    watch_storage_sync();
+    _wait_ready();
 
     if (address % 2) {
         data      = NVM_MEMORY[nvm_address++];
@@ -47,17 +74,17 @@ bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t
     return true;
 }
 
-bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
+static bool _storage_write_raw(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
     uint32_t address = RWWEE_ADDR_START + row * NVMCTRL_ROW_SIZE + offset;
     if (!_is_valid_address(address, size)) return false;
 
-    watch_storage_sync();
+    _wait_ready();
 
     uint32_t nvm_address = address / 2;
     uint16_t i, data;
 
     NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMD_PBC | NVMCTRL_CTRLA_CMDEX_KEY;
-    watch_storage_sync();
+    _wait_ready();
 
     for (i = 0; i < size; i += 2) {
         data = buffer[i];
@@ -72,11 +99,86 @@ bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, u
     return true;
 }
 
+static bool _row_buffer_flush(void) {
+    if (!_row_buffer_valid || _row_buffer_dirty == 0) {
+        _row_buffer_dirty = 0;
+        return true;
+    }
+    for (uint8_t page = 0; page < PAGES_PER_ROW; page++) {
+        if (!(_row_buffer_dirty & (1 << page))) continue;
+        uint32_t offset = (uint32_t)page * NVMCTRL_PAGE_SIZE;
+        uint8_t current[NVMCTRL_PAGE_SIZE];
+        if (!_storage_read_raw(_row_buffer_row, offset, current, NVMCTRL_PAGE_SIZE)) return false;
+        if (memcmp(current, _row_buffer + offset, NVMCTRL_PAGE_SIZE) == 0) continue;
+        if (!_storage_write_raw(_row_buffer_row, offset, _row_buffer + offset, NVMCTRL_PAGE_SIZE)) return false;
+    }
+    _row_buffer_dirty = 0;
+    return true;
+}
+
+bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t size) {
+    if (_row_buffer_valid && row == _row_buffer_row && offset + size <= NVMCTRL_ROW_SIZE) {
+        // the buffer is the current view of this row; serve from it.
+        memcpy(buffer, _row_buffer + offset, size);
+        return true;
+    }
+    // a read that spans out of the buffered row needs the flash to be current.
+    if (_row_buffer_valid && !_row_buffer_flush()) return false;
+    return _storage_read_raw(row, offset, buffer, size);
+}
+
+bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
+    if (offset + size > NVMCTRL_ROW_SIZE) {
+        // row-spanning writes bypass the buffer; nobody writes these today.
+        if (!_row_buffer_flush()) return false;
+        _row_buffer_valid = false;
+        return _storage_write_raw(row, offset, buffer, size);
+    }
+
+    if (_row_buffer_valid && row != _row_buffer_row) {
+        if (!_row_buffer_flush()) return false;
+        _row_buffer_valid = false;
+    }
+    if (!_row_buffer_valid) {
+        if (!_storage_read_raw(row, 0, _row_buffer, NVMCTRL_ROW_SIZE)) return false;
+        _row_buffer_row = row;
+        _row_buffer_valid = true;
+        _row_buffer_dirty = 0;
+    }
+
+    memcpy(_row_buffer + offset, buffer, size);
+    for (uint32_t page = offset / NVMCTRL_PAGE_SIZE; page <= (offset + size - 1) / NVMCTRL_PAGE_SIZE; page++) {
+        _row_buffer_dirty |= 1 << page;
+    }
+    return true;
+}
+
 bool watch_storage_erase(uint32_t row) {
     uint32_t address = RWWEE_ADDR_START + row * NVMCTRL_ROW_SIZE;
     if (!_is_valid_address(address, NVMCTRL_ROW_SIZE)) return false;
 
-    watch_storage_sync();
+    // an erase obliterates the row; pending buffered writes to it are moot.
+    if (_row_buffer_valid && row == _row_buffer_row) {
+        _row_buffer_valid = false;
+        _row_buffer_dirty = 0;
+    }
+
+    // skip the erase entirely if the row already reads as erased: littlefs
+    // re-erases blocks it never got around to programming, and each skipped
+    // erase is a wear cycle the region keeps.
+    uint8_t current[NVMCTRL_ROW_SIZE];
+    if (_storage_read_raw(row, 0, current, NVMCTRL_ROW_SIZE)) {
+        bool erased = true;
+        for (uint32_t i = 0; i < NVMCTRL_ROW_SIZE; i++) {
+            if (current[i] != 0xFF) {
+                erased = false;
+                break;
+            }
+        }
+        if (erased) return true;
+    }
+
+    _wait_ready();
     NVMCTRL->ADDR.reg = address / 2;
     NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMD_RWWEEER | NVMCTRL_CTRLA_CMDEX_KEY;
 
@@ -84,11 +186,7 @@ bool watch_storage_erase(uint32_t row) {
 }
 
 bool watch_storage_sync(void) {
-    while (!NVMCTRL->INTFLAG.bit.READY) {
-        // wait for flash to become ready
-    }
-
-    NVMCTRL->STATUS.reg = NVMCTRL_STATUS_MASK;
-
+    if (!_row_buffer_flush()) return false;
+    _wait_ready();
     return true;
 }
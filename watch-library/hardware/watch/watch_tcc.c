@@ -23,6 +23,7 @@
  */
 
 #include "watch_tcc.h"
+#include "watch_power.h"
 #include "delay.h"
 #include "tcc.h"
 #include "tc.h"
@@ -36,13 +37,15 @@ static void _watch_disable_led_pins(void);
 static void (*_cb_tc0)(void) = NULL;
 static void cb_watch_buzzer_seq(void);
 static void cb_watch_buzzer_raw_source(void);
+static void _watch_set_buzzer_period_and_cc(uint32_t period, uint32_t cc);
 
 static uint16_t _seq_position;
-static int8_t _tone_ticks, _repeat_counter;
-static int8_t *_sequence;
+static int8_t _repeat_counter;
+static uint32_t _note_counts_remaining;
+static const int8_t *_sequence;
 static watch_buzzer_raw_source_t _raw_source;
 static void* _userdata;
-static uint8_t _volume;
+static watch_buzzer_volume_t _volume;
 static void (*_cb_finished)(void);
 static watch_cb_t _cb_start_global = NULL;
 static watch_cb_t _cb_stop_global = NULL;
@@ -70,22 +73,37 @@ static inline void _tc0_stop() {
 }
 
 static void _tc0_initialize() {
-    // setup and initialize TC0 for a 64 Hz interrupt
+    // setup and initialize TC0. The counter runs at 512 Hz (1024 Hz clock divided by 2);
+    // note durations are expressed in 64 Hz ticks, i.e. 8 counts per tick. The period is
+    // reprogrammed for each note so the interrupt fires at note boundaries, not 64 times
+    // a second; the initial period of 7 just gets the first note started ~15 ms from now.
     tc_init(0, GENERIC_CLOCK_3, TC_PRESCALER_DIV2);
     tc_set_counter_mode(0, TC_COUNTER_MODE_8BIT);
     tc_set_run_in_standby(0, true);
-    tc_count8_set_period(0, 7); // 1024 Hz divided by 2 divided by 8 equals 64 Hz
+    tc_count8_set_period(0, 7);
     /// FIXME: #SecondMovement, we need a gossamer wrapper for interrupts.
     TC0->COUNT8.INTENSET.bit.OVF = 1;
     NVIC_ClearPendingIRQ(TC0_IRQn);
     NVIC_EnableIRQ (TC0_IRQn);
 }
 
-void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void)) {
+static void _tc0_schedule_counts(uint32_t counts) {
+    // The 8-bit counter can sleep through up to 256 counts (half a second) per interrupt;
+    // a longer note carries its remainder into the next interrupt.
+    if (counts > 256) {
+        _note_counts_remaining = counts - 256;
+        tc_count8_set_period(0, 255);
+    } else {
+        _note_counts_remaining = 0;
+        tc_count8_set_period(0, (uint8_t)(counts - 1));
+    }
+}
+
+void watch_buzzer_play_sequence(const int8_t *note_sequence, void (*callback_on_end)(void)) {
     watch_buzzer_play_sequence_with_volume(note_sequence, callback_on_end, WATCH_BUZZER_VOLUME_LOUD);
 }
 
-void watch_buzzer_play_sequence_with_volume(int8_t *note_sequence, void (*callback_on_end)(void), watch_buzzer_volume_t volume) {
+void watch_buzzer_play_sequence_with_volume(const int8_t *note_sequence, void (*callback_on_end)(void), watch_buzzer_volume_t volume) {
     // Abort any previous sequence
     watch_buzzer_abort_sequence();
 
@@ -97,9 +115,9 @@ void watch_buzzer_play_sequence_with_volume(int8_t *note_sequence, void (*callba
     watch_set_buzzer_off();
     _sequence = note_sequence;
     _cb_finished = callback_on_end;
-    _volume = volume == WATCH_BUZZER_VOLUME_SOFT ? 5 : 25;
+    _volume = volume;
     _seq_position = 0;
-    _tone_ticks = 0;
+    _note_counts_remaining = 0;
     _repeat_counter = -1;
     // prepare buzzer
     
@@ -111,41 +129,46 @@ void watch_buzzer_play_sequence_with_volume(int8_t *note_sequence, void (*callba
 }
 
 void cb_watch_buzzer_seq(void) {
-    // callback for reading the note sequence
-    if (_tone_ticks == 0) {
-        if (_sequence[_seq_position] < 0 && _sequence[_seq_position + 1]) {
-            // repeat indicator found
-            if (_repeat_counter == -1) {
-                // first encounter: load repeat counter
-                _repeat_counter = _sequence[_seq_position + 1];
-            } else _repeat_counter--;
-            if (_repeat_counter > 0)
-                // rewind
-                if (_seq_position > _sequence[_seq_position] * -2)
-                    _seq_position += _sequence[_seq_position] * 2;
-                else
-                    _seq_position = 0;
-            else {
-                // continue
-                _seq_position += 2;
-                _repeat_counter = -1;
-            }
-        }
-        if (_sequence[_seq_position] && _sequence[_seq_position + 1]) {
-            // read note
-            watch_buzzer_note_t note = _sequence[_seq_position];
-            if (note != BUZZER_NOTE_REST) {
-                watch_set_buzzer_period_and_duty_cycle(NotePeriods[note], _volume);
-                watch_set_buzzer_on();
-            } else watch_set_buzzer_off();
-            // set duration ticks and move to next tone
-            _tone_ticks = _sequence[_seq_position + 1] - 1;
+    // callback for reading the note sequence; fires once per note boundary. Each
+    // interrupt programs the buzzer and the timer period for the whole note, then
+    // the core sleeps through it.
+    if (_note_counts_remaining) {
+        // a long note still in progress; schedule its remainder and go back to sleep.
+        _tc0_schedule_counts(_note_counts_remaining);
+        return;
+    }
+    if (_sequence[_seq_position] < 0 && _sequence[_seq_position + 1]) {
+        // repeat indicator found
+        if (_repeat_counter == -1) {
+            // first encounter: load repeat counter
+            _repeat_counter = _sequence[_seq_position + 1];
+        } else _repeat_counter--;
+        if (_repeat_counter > 0)
+            // rewind
+            if (_seq_position > _sequence[_seq_position] * -2)
+                _seq_position += _sequence[_seq_position] * 2;
+            else
+                _seq_position = 0;
+        else {
+            // continue
             _seq_position += 2;
-        } else {
-            // end the sequence
-            watch_buzzer_abort_sequence();
+            _repeat_counter = -1;
         }
-    } else _tone_ticks--;
+    }
+    if (_sequence[_seq_position] && _sequence[_seq_position + 1]) {
+        // read note
+        watch_buzzer_note_t note = _sequence[_seq_position];
+        if (note != BUZZER_NOTE_REST) {
+            _watch_set_buzzer_period_and_cc(NotePeriods[note], NoteDutyCycles[_volume][note]);
+            watch_set_buzzer_on();
+        } else watch_set_buzzer_off();
+        // sleep for the note's duration (in 64 Hz ticks, 8 counts each) and move on
+        _tc0_schedule_counts((uint32_t)_sequence[_seq_position + 1] * 8);
+        _seq_position += 2;
+    } else {
+        // end the sequence
+        watch_buzzer_abort_sequence();
+    }
 }
 
 void watch_buzzer_play_raw_source(watch_buzzer_raw_source_t raw_source, void* userdata, watch_cb_t callback_on_end) {
@@ -166,9 +189,9 @@ void watch_buzzer_play_raw_source_with_volume(watch_buzzer_raw_source_t raw_sour
     _raw_source = raw_source;
     _userdata = userdata;
     _cb_finished = callback_on_end;
-    _volume = volume == WATCH_BUZZER_VOLUME_SOFT ? 5 : 25;
+    _volume = volume;
     _seq_position = 0;
-    _tone_ticks = 0;
+    _note_counts_remaining = 0;
     // prepare buzzer
 
     _cb_tc0 = cb_watch_buzzer_raw_source;
@@ -179,31 +202,34 @@ void watch_buzzer_play_raw_source_with_volume(watch_buzzer_raw_source_t raw_sour
 }
 
 void cb_watch_buzzer_raw_source(void) {
-    // callback for reading the note sequence
+    // callback for reading the note sequence; same per-note scheduling as above.
     uint16_t period;
     uint16_t duration;
     bool done;
 
-    if (_tone_ticks == 0) {
-        done = _raw_source(_seq_position, _userdata, &period, &duration);
+    if (_note_counts_remaining) {
+        _tc0_schedule_counts(_note_counts_remaining);
+        return;
+    }
+
+    done = _raw_source(_seq_position, _userdata, &period, &duration);
 
-        if (done || duration == 0) {
-            // end the sequence
-            watch_buzzer_abort_sequence();
+    if (done || duration == 0) {
+        // end the sequence
+        watch_buzzer_abort_sequence();
+    } else {
+        if (period == WATCH_BUZZER_PERIOD_REST) {
+            watch_set_buzzer_off();
         } else {
-            if (period == WATCH_BUZZER_PERIOD_REST) {
-                watch_set_buzzer_off();
-            } else {
-                watch_set_buzzer_period_and_duty_cycle(period, _volume);
-                watch_set_buzzer_on();
-            }
-
-            // set duration ticks and move to next tone
-            _tone_ticks = duration - 1;
-            _seq_position += 1;
+            // raw sources supply arbitrary periods, so no table applies; the divisors are
+            // constants here, which the compiler reduces to a multiply and shift.
+            _watch_set_buzzer_period_and_cc(period, _volume == WATCH_BUZZER_VOLUME_SOFT ? period / 20 : period / 4);
+            watch_set_buzzer_on();
         }
-    } else {
-        _tone_ticks--;
+
+        // sleep for the tone's duration and move to the next one
+        _tc0_schedule_counts((uint32_t)duration * 8);
+        _seq_position += 1;
     }
 }
 
@@ -230,7 +256,7 @@ void watch_buzzer_abort_sequence(void) {
 }
 
 void watch_buzzer_register_global_callbacks(watch_cb_t cb_start, watch_cb_t cb_stop) {
-    _cb_stop_global = cb_start;
+    _cb_start_global = cb_start;
     _cb_stop_global = cb_stop;
 }
 
@@ -267,19 +293,23 @@ void _watch_maybe_disable_tcc(void) {
 }
 
 void watch_enable_buzzer(void) {
+    watch_power_track_enable(WATCH_POWER_BUZZER);
     _buzzer_is_active = true;
     _watch_maybe_enable_tcc();
 }
 
 void watch_disable_buzzer(void) {
+    watch_power_track_disable(WATCH_POWER_BUZZER);
     _buzzer_is_active = false;
     watch_set_buzzer_off();
     _watch_maybe_disable_tcc();
 }
 
-void watch_set_buzzer_period_and_duty_cycle(uint32_t period, uint8_t duty) {
+// programs the period and a precomputed compare value directly; the sequencer callbacks
+// use this with table-driven counts so no duty arithmetic happens at note boundaries.
+static void _watch_set_buzzer_period_and_cc(uint32_t period, uint32_t cc) {
     tcc_set_period(0, period, true);
-    tcc_set_cc(0, (WATCH_BUZZER_TCC_CHANNEL) % 4, period / (100 / duty), true);
+    tcc_set_cc(0, (WATCH_BUZZER_TCC_CHANNEL) % 4, cc, true);
     // The buzzer determines the period, which means that if the LED was active before it will flicker
     // Update the LED duty cycle to match the new period required by the buzzer.
     if (_led_is_active) {
@@ -287,6 +317,10 @@ void watch_set_buzzer_period_and_duty_cycle(uint32_t period, uint8_t duty) {
     }
 }
 
+void watch_set_buzzer_period_and_duty_cycle(uint32_t period, uint8_t duty) {
+    _watch_set_buzzer_period_and_cc(period, period / (100 / duty));
+}
+
 inline void watch_set_buzzer_on(void) {
     HAL_GPIO_BUZZER_out();
     HAL_GPIO_BUZZER_pmuxen(HAL_GPIO_PMUX_TCC_ALT);
@@ -374,13 +408,101 @@ void _watch_disable_tcc(void) {
     tcc_disable(0);
 }
 
+// LED FADE ENGINE
+// Fades run off the TCC's own overflow interrupt rather than Movement's tick
+// pipeline: the ~1 kHz PWM overflow is divided down to a ~125 Hz step rate, and
+// each step interpolates the duty cycles in 8.8 fixed point. The interrupt is
+// only unmasked while a fade is in flight — a window where the LED itself
+// dominates the power budget — so effects like a breathing pulse no longer need
+// a face holding a fast tick frequency awake. The last step lands exactly on
+// the target and fires the completion callback from interrupt context.
+#define LED_FADE_PRESCALE 8
+
+static volatile bool _fade_active = false;
+static uint8_t _fade_prescale_counter;
+static uint16_t _fade_steps_remaining;
+static uint16_t _fade_current[3]; // 8.8 fixed point
+static int16_t _fade_delta[3];    // 8.8 fixed point, per step
+static uint8_t _fade_target[3];
+static watch_cb_t _fade_callback;
+
+void watch_led_fade_to(uint8_t red, uint8_t green, uint8_t blue, uint16_t duration_ms, watch_cb_t callback_on_complete) {
+    watch_led_fade_abort();
+
+    // make sure the TCC is running so there are overflows to count; the starting
+    // point is whatever color is showing now (black if the LED was off).
+    watch_enable_leds();
+
+    // two steps minimum: it keeps the per-step delta within int16_t even for a
+    // full-scale fade, and a one-step "fade" is just a set.
+    uint16_t steps = duration_ms / LED_FADE_PRESCALE;
+    if (steps < 2) steps = 2;
+
+    const uint8_t target[3] = {red, green, blue};
+    for (int i = 0; i < 3; i++) {
+        _fade_current[i] = (uint16_t)_current_led_color[i] << 8;
+        _fade_delta[i] = (int16_t)((((int32_t)target[i] << 8) - (int32_t)_fade_current[i]) / (int32_t)steps);
+        _fade_target[i] = target[i];
+    }
+    _fade_steps_remaining = steps;
+    _fade_prescale_counter = 0;
+    _fade_callback = callback_on_complete;
+    _fade_active = true;
+
+    TCC0->INTENSET.bit.OVF = 1;
+    NVIC_ClearPendingIRQ(TCC0_IRQn);
+    NVIC_EnableIRQ(TCC0_IRQn);
+}
+
+bool watch_led_fade_in_progress(void) {
+    return _fade_active;
+}
+
+void watch_led_fade_abort(void) {
+    if (!_fade_active) return;
+    _fade_active = false;
+    TCC0->INTENCLR.bit.OVF = 1;
+    _fade_callback = NULL;
+}
+
+void irq_handler_tcc0(void);
+void irq_handler_tcc0(void) {
+    TCC0->INTFLAG.reg = TCC_INTFLAG_OVF;
+    if (!_fade_active) return;
+    if (++_fade_prescale_counter < LED_FADE_PRESCALE) return;
+    _fade_prescale_counter = 0;
+
+    if (--_fade_steps_remaining == 0) {
+        _fade_active = false;
+        TCC0->INTENCLR.bit.OVF = 1;
+        watch_cb_t callback = _fade_callback;
+        _fade_callback = NULL;
+        // land exactly on the target; accumulated rounding error stops here. A
+        // black target shuts the LEDs (and the TCC, if the buzzer is idle) down.
+        watch_set_led_color_rgb(_fade_target[0], _fade_target[1], _fade_target[2]);
+        if (callback) callback();
+        return;
+    }
+
+    for (int i = 0; i < 3; i++) {
+        _fade_current[i] = (uint16_t)((int32_t)_fade_current[i] + _fade_delta[i]);
+        _current_led_color[i] = _fade_current[i] >> 8;
+    }
+    // fetch the period fresh each step; a buzzer note may have changed it.
+    _watch_set_led_duty_cycle(tcc_get_period(0), _current_led_color[0], _current_led_color[1], _current_led_color[2]);
+}
+
 void watch_enable_leds(void) {
+    watch_power_track_enable(WATCH_POWER_LEDS);
     _led_is_active = true;
     _watch_enable_led_pins();
     _watch_maybe_enable_tcc();
 }
 
 void watch_disable_leds(void) {
+    // a fade can't run without the TCC; don't leave one stalled mid-flight.
+    watch_led_fade_abort();
+    watch_power_track_disable(WATCH_POWER_LEDS);
     _led_is_active = false;
     _watch_disable_led_pins();
     _watch_maybe_disable_tcc();
@@ -439,6 +561,9 @@ static void _watch_set_led_duty_cycle(uint32_t period, uint8_t red, uint8_t gree
 }
 
 void watch_set_led_color_rgb(uint8_t red, uint8_t green, uint8_t blue) {
+    // a direct set wins over an in-flight fade.
+    watch_led_fade_abort();
+
     bool turning_on = (red | green | blue) != 0;
 
     if (turning_on) {
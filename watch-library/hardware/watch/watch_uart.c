@@ -23,11 +23,15 @@
  */
 
 #include "watch_uart.h"
+#include "watch_power.h"
+#include "watch_bus.h"
+#include "watch_dma.h"
 #include "uart.h"
 #include "usb.h"
 #include <string.h>
 
 void watch_enable_uart(const uint16_t tx_pin, const uint16_t rx_pin, uint32_t baud) {
+    if (!_watch_bus_claim(WATCH_BUS_UART)) return;
     uart_rxpo_t rxpo = UART_RXPO_NONE;
 
     if (rx_pin == HAL_GPIO_A1_pin()) {
@@ -59,6 +63,7 @@ void watch_enable_uart(const uint16_t tx_pin, const uint16_t rx_pin, uint32_t ba
     }
 
     uart_enable_instance(3);
+    watch_power_track_enable(WATCH_POWER_UART);
 }
 
 void watch_uart_puts(char *s) {
@@ -72,4 +77,202 @@ size_t watch_uart_gets(char *data, size_t max_length) {
 void irq_handler_sercom3(void);
 void irq_handler_sercom3(void) {
     uart_irq_handler(3);
-}
\ No newline at end of file
+}
+
+// ---- DMA receive ring -----------------------------------------------------------------
+// Two half-ring descriptors linked in a loop turn the caller's buffer into a circular
+// buffer the DMAC fills on the SERCOM's RX trigger, with a transfer-complete interrupt
+// (the high-watermark wake) as each half fills. The CPU sleeps through reception and
+// only copies bytes out when a consumer asks.
+
+static Sercom *const _uart_sercoms[] = SERCOM_INSTS;
+static const uint8_t _uart_rx_triggers[] = {
+    SERCOM0_DMAC_ID_RX,
+    SERCOM1_DMAC_ID_RX,
+    SERCOM2_DMAC_ID_RX,
+    SERCOM3_DMAC_ID_RX,
+#ifdef SERCOM4
+    SERCOM4_DMAC_ID_RX,
+#endif
+#ifdef SERCOM5
+    SERCOM5_DMAC_ID_RX,
+#endif
+};
+
+static DmacDescriptor _uart_rx_descriptor_b __attribute__((aligned(16)));
+static uint8_t *_uart_rx_ring;
+static size_t _uart_rx_ring_size;
+static size_t _uart_rx_half_size;
+// free-running counts; the difference between write and read is what's in the ring.
+static volatile size_t _uart_rx_halves_done;
+static size_t _uart_rx_read_pos;
+static Sercom *_uart_rx_sercom;
+
+static void _watch_uart_rx_dma_half_complete(void) {
+    _uart_rx_halves_done++;
+}
+
+void watch_uart_rx_dma_enable(uint8_t sercom_instance, uint8_t *buffer, size_t size) {
+    watch_dma_init();
+
+    _uart_rx_ring = buffer;
+    _uart_rx_ring_size = size;
+    _uart_rx_half_size = size / 2;
+    _uart_rx_halves_done = 0;
+    _uart_rx_read_pos = 0;
+    _uart_rx_sercom = _uart_sercoms[sercom_instance];
+
+    uint32_t data_reg = (uint32_t)&_uart_rx_sercom->USART.DATA.reg;
+    DmacDescriptor *first = &watch_dma_descriptors[WATCH_DMA_CHANNEL_UART_RX];
+    uint16_t btctrl = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE | DMAC_BTCTRL_DSTINC | DMAC_BTCTRL_BLOCKACT_INT;
+
+    first->BTCTRL.reg = btctrl;
+    first->BTCNT.reg = _uart_rx_half_size;
+    first->SRCADDR.reg = data_reg;
+    first->DSTADDR.reg = (uint32_t)(buffer + _uart_rx_half_size);
+    first->DESCADDR.reg = (uint32_t)&_uart_rx_descriptor_b;
+
+    _uart_rx_descriptor_b.BTCTRL.reg = btctrl;
+    _uart_rx_descriptor_b.BTCNT.reg = _uart_rx_half_size;
+    _uart_rx_descriptor_b.SRCADDR.reg = data_reg;
+    _uart_rx_descriptor_b.DSTADDR.reg = (uint32_t)(buffer + size);
+    _uart_rx_descriptor_b.DESCADDR.reg = (uint32_t)first;
+
+    // preload the writeback slot so a progress snapshot taken before the first
+    // byte arrives reads as "nothing transferred yet".
+    watch_dma_writeback[WATCH_DMA_CHANNEL_UART_RX].BTCNT.reg = _uart_rx_half_size;
+    watch_dma_writeback[WATCH_DMA_CHANNEL_UART_RX].DESCADDR.reg = (uint32_t)&_uart_rx_descriptor_b;
+
+    // the DMAC and the driver's per-byte interrupt would race each other for the
+    // data register; reception belongs to the DMAC until we're disabled.
+    _uart_rx_sercom->USART.INTENCLR.reg = SERCOM_USART_INTENCLR_RXC;
+
+    watch_dma_set_callback(WATCH_DMA_CHANNEL_UART_RX, _watch_uart_rx_dma_half_complete);
+
+    watch_dma_critical_enter();
+    watch_dma_setup_channel(WATCH_DMA_CHANNEL_UART_RX, _uart_rx_triggers[sercom_instance]);
+    DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR | DMAC_CHINTFLAG_SUSP;
+    DMAC->CHINTENSET.reg = DMAC_CHINTENSET_TCMPL;
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_ENABLE | DMAC_CHCTRLA_RUNSTDBY;
+    watch_dma_critical_exit();
+}
+
+size_t watch_uart_rx_dma_read(uint8_t *data, size_t max_length) {
+    if (_uart_rx_ring == NULL) return 0;
+
+    // briefly suspend the channel: that forces a coherent snapshot of the active
+    // descriptor's remaining count into writeback memory. bytes arriving meanwhile
+    // wait in the SERCOM's receive FIFO.
+    watch_dma_critical_enter();
+    DMAC->CHID.reg = WATCH_DMA_CHANNEL_UART_RX;
+    DMAC->CHCTRLB.bit.CMD = DMAC_CHCTRLB_CMD_SUSPEND_Val;
+    while (!(DMAC->CHINTFLAG.reg & DMAC_CHINTFLAG_SUSP));
+    size_t partial = _uart_rx_half_size - watch_dma_writeback[WATCH_DMA_CHANNEL_UART_RX].BTCNT.reg;
+    size_t halves = _uart_rx_halves_done;
+    DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_SUSP;
+    DMAC->CHCTRLB.bit.CMD = DMAC_CHCTRLB_CMD_RESUME_Val;
+    watch_dma_critical_exit();
+
+    // a half that completed while the interrupt was masked above isn't counted yet;
+    // its bytes just become visible on the next read instead.
+    size_t write_pos = halves * _uart_rx_half_size + partial;
+    if (write_pos < _uart_rx_read_pos) write_pos = _uart_rx_read_pos;
+
+    // ring overflow: drop the oldest bytes, the consumer's framing will resync.
+    if (write_pos - _uart_rx_read_pos > _uart_rx_ring_size) {
+        _uart_rx_read_pos = write_pos - _uart_rx_ring_size;
+    }
+
+    size_t count = write_pos - _uart_rx_read_pos;
+    if (count > max_length) count = max_length;
+
+    for (size_t i = 0; i < count; i++) {
+        data[i] = _uart_rx_ring[_uart_rx_read_pos++ % _uart_rx_ring_size];
+    }
+
+    return count;
+}
+
+void watch_uart_rx_dma_disable(void) {
+    if (_uart_rx_ring == NULL) return;
+
+    watch_dma_critical_enter();
+    DMAC->CHID.reg = WATCH_DMA_CHANNEL_UART_RX;
+    DMAC->CHINTENCLR.reg = DMAC_CHINTENCLR_TCMPL;
+    DMAC->CHCTRLA.reg = 0;
+    while (DMAC->CHCTRLA.bit.ENABLE);
+    watch_dma_critical_exit();
+
+    watch_dma_set_callback(WATCH_DMA_CHANNEL_UART_RX, NULL);
+    _uart_rx_sercom->USART.INTENSET.reg = SERCOM_USART_INTENSET_RXC;
+    _uart_rx_ring = NULL;
+}
+
+// ---- DMA transmit ---------------------------------------------------------------------
+// The transmit twin of the ring above: one descriptor feeds the SERCOM a byte per
+// data-register-empty trigger, so a whole frame goes out at line rate with the core
+// asleep and a single interrupt at the end instead of a poll per byte.
+
+static const uint8_t _uart_tx_triggers[] = {
+    SERCOM0_DMAC_ID_TX,
+    SERCOM1_DMAC_ID_TX,
+    SERCOM2_DMAC_ID_TX,
+    SERCOM3_DMAC_ID_TX,
+#ifdef SERCOM4
+    SERCOM4_DMAC_ID_TX,
+#endif
+#ifdef SERCOM5
+    SERCOM5_DMAC_ID_TX,
+#endif
+};
+
+static volatile bool _uart_tx_busy;
+static void (*_uart_tx_user_callback)(void);
+
+static void _watch_uart_tx_dma_complete(void) {
+    void (*callback)(void) = _uart_tx_user_callback;
+    _uart_tx_user_callback = NULL;
+    _uart_tx_busy = false;
+    if (callback) callback();
+}
+
+bool watch_uart_tx_dma_write(uint8_t sercom_instance, const uint8_t *data, size_t length, void (*callback)(void)) {
+    if (length == 0) {
+        if (callback) callback();
+        return false;
+    }
+
+    watch_dma_init();
+    // one channel; an earlier frame still in flight goes out first.
+    watch_uart_tx_dma_wait();
+
+    Sercom *sercom = _uart_sercoms[sercom_instance];
+    DmacDescriptor *desc = &watch_dma_descriptors[WATCH_DMA_CHANNEL_UART_TX];
+    desc->BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE | DMAC_BTCTRL_SRCINC | DMAC_BTCTRL_BLOCKACT_INT;
+    desc->BTCNT.reg = length;
+    // with SRCINC set, the DMAC wants the address one past the last beat.
+    desc->SRCADDR.reg = (uint32_t)(data + length);
+    desc->DSTADDR.reg = (uint32_t)&sercom->USART.DATA.reg;
+    desc->DESCADDR.reg = 0;
+
+    _uart_tx_busy = true;
+    _uart_tx_user_callback = callback;
+    watch_dma_set_callback(WATCH_DMA_CHANNEL_UART_TX, _watch_uart_tx_dma_complete);
+
+    watch_dma_critical_enter();
+    watch_dma_setup_channel(WATCH_DMA_CHANNEL_UART_TX, _uart_tx_triggers[sercom_instance]);
+    DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR | DMAC_CHINTFLAG_SUSP;
+    DMAC->CHINTENSET.reg = DMAC_CHINTENSET_TCMPL;
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_ENABLE | DMAC_CHCTRLA_RUNSTDBY;
+    watch_dma_critical_exit();
+
+    return true;
+}
+
+bool watch_uart_tx_dma_busy(void) {
+    return _uart_tx_busy;
+}
+
+void watch_uart_tx_dma_wait(void) {
+    while (_uart_tx_busy);
+}
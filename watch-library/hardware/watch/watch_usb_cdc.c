@@ -25,28 +25,41 @@
 
 #include <stddef.h>
 #include "watch_usb_cdc.h"
+#include "watch_rtc.h"
+#include "watch_wake_stats.h"
 #include "tusb.h"
 
 /*
- * Implement a circular buffer for the USB CDC Serial read buffer.
- * The size of the buffer must be a power of two for this circular buffer
- * implementation to work.
+ * Circular buffers for the USB CDC serial connection. Indices free-run and are
+ * masked on use, so head - tail is always the number of buffered bytes; sizes
+ * must be powers of two for the masking to work.
+ *
+ * Data moves in contiguous spans: the tinyusb FIFO is drained with bulk reads
+ * straight into the ring, and _read/_write hand spans to memcpy rather than
+ * looping per byte. When the read ring fills we simply stop draining tinyusb,
+ * whose own FIFO then NAKs the host -- backpressure instead of dropped
+ * characters during fast pastes.
  */
 
-// Size of the circular buffer. Must be a power of two.
+// Size of the circular buffers. Must be powers of two.
 #define CDC_WRITE_BUF_SZ  (1024)
-// Macro function to perform modular arithmetic on an index.
-// eg. (63 + 2) & (64 - 1) -> 1
 #define CDC_WRITE_BUF_IDX(x)  ((x) & (CDC_WRITE_BUF_SZ - 1))
 static char s_write_buf[CDC_WRITE_BUF_SZ] = {0};
-static size_t s_write_buf_pos = 0;
-static size_t s_write_buf_len = 0;
+static size_t s_write_head = 0;
+static size_t s_write_tail = 0;
 
 #define CDC_READ_BUF_SZ  (256)
 #define CDC_READ_BUF_IDX(x)  ((x) & (CDC_READ_BUF_SZ - 1))
 static char s_read_buf[CDC_READ_BUF_SZ] = {0};
-static size_t s_read_buf_pos = 0;
-static size_t s_read_buf_len = 0;
+static size_t s_read_head = 0;
+static size_t s_read_tail = 0;
+
+size_t cdc_write_free(void) {
+    return CDC_WRITE_BUF_SZ - (s_write_head - s_write_tail);
+}
+
+// forward declaration: _write drains through this when the ring backs up.
+static void prv_handle_writes(void);
 
 int _write(int file, char *ptr, int len) {
     (void) file;
@@ -55,15 +68,32 @@ int _write(int file, char *ptr, int len) {
         return -1;
     }
 
-    int bytes_written = 0;
-
-    for (int i = 0; i < len; i++) {
-        s_write_buf[s_write_buf_pos] = ptr[i];
-        s_write_buf_pos = CDC_WRITE_BUF_IDX(s_write_buf_pos + 1);
-        if (s_write_buf_len < CDC_WRITE_BUF_SZ) {
-            s_write_buf_len++;
+    // If the ring can't hold this write, drain it to the host first: a command
+    // that emits more than the ring in one pass should be paced by USB
+    // throughput, not truncated. Give a stalled host a quarter second, then
+    // fall back to dropping the oldest unsent output -- with the port closed
+    // (no DTR) we don't wait at all, so boot-time logging can't hang here.
+    size_t free_space = cdc_write_free();
+    if ((size_t) len > free_space && tud_cdc_connected()) {
+        const rtc_counter_t deadline = watch_rtc_get_counter() + 32;
+        while ((size_t) len > (free_space = cdc_write_free())) {
+            if ((int32_t) (watch_rtc_get_counter() - deadline) >= 0) break;
+            tud_task();
+            prv_handle_writes();
         }
-        bytes_written++;
+    }
+    if ((size_t) len > free_space) {
+        s_write_tail += (size_t) len - free_space;
+    }
+
+    int bytes_written = 0;
+    while (bytes_written < len) {
+        const size_t idx = CDC_WRITE_BUF_IDX(s_write_head);
+        size_t span = CDC_WRITE_BUF_SZ - idx;  // contiguous space to the end of the ring
+        if (span > (size_t)(len - bytes_written)) span = len - bytes_written;
+        memcpy(&s_write_buf[idx], ptr + bytes_written, span);
+        s_write_head += span;
+        bytes_written += span;
     }
 
     return bytes_written;
@@ -72,64 +102,66 @@ int _write(int file, char *ptr, int len) {
 int _read(int file, char *ptr, int len) {
     (void) file;
 
-    if (ptr == NULL || len <= 0 || s_read_buf_len == 0) {
+    const size_t available = s_read_head - s_read_tail;
+    if (ptr == NULL || len <= 0 || available == 0) {
         return -1;
     }
 
-    // Clamp to the length of the read buffer
-    if ((size_t) len > s_read_buf_len) {
-        len = s_read_buf_len;
+    if ((size_t) len > available) {
+        len = available;
     }
 
-    // Calculate the start of the circular buffer, and iterate from there
-    const size_t start_pos = CDC_READ_BUF_IDX(s_read_buf_pos - len);
-    for (size_t i = 0; i < (size_t) len; i++) {
-        const size_t idx = CDC_READ_BUF_IDX(start_pos + i);
-        ptr[i] = s_read_buf[idx];
-        s_read_buf[idx] = 0;
+    int bytes_read = 0;
+    while (bytes_read < len) {
+        const size_t idx = CDC_READ_BUF_IDX(s_read_tail);
+        size_t span = CDC_READ_BUF_SZ - idx;
+        if (span > (size_t)(len - bytes_read)) span = len - bytes_read;
+        memcpy(ptr + bytes_read, &s_read_buf[idx], span);
+        s_read_tail += span;
+        bytes_read += span;
     }
 
-    // Update circular buffer position and length
-    s_read_buf_len -= len;
-    s_read_buf_pos = CDC_READ_BUF_IDX(s_read_buf_pos - len);
-
-    return len;
+    return bytes_read;
 }
 
 static void prv_handle_reads(void) {
+    // tag host activity for the wake ledger; the USB interrupt itself lives in
+    // the vendored stack, so this is the nearest observable point.
+    if (tud_cdc_available()) watch_wake_stats_record(WATCH_WAKE_USB);
+
+    // Drain the tinyusb FIFO in bulk, one contiguous span of the ring at a time.
+    // If the ring is full we leave the rest in tinyusb's FIFO; once that fills
+    // too, the host gets NAKed until the shell catches up.
     while (tud_cdc_available()) {
-        int c = tud_cdc_read_char();
-        if (c < 0) {
-            continue;
-        }
-        s_read_buf[s_read_buf_pos] = c;
-        s_read_buf_pos = CDC_READ_BUF_IDX(s_read_buf_pos + 1);
-        if (s_read_buf_len < CDC_READ_BUF_SZ) {
-            s_read_buf_len++;
-        }
+        const size_t free_space = CDC_READ_BUF_SZ - (s_read_head - s_read_tail);
+        if (free_space == 0) break;
+        const size_t idx = CDC_READ_BUF_IDX(s_read_head);
+        size_t span = CDC_READ_BUF_SZ - idx;
+        if (span > free_space) span = free_space;
+        const uint32_t count = tud_cdc_read(&s_read_buf[idx], span);
+        if (count == 0) break;
+        s_read_head += count;
     }
 }
 
 static void prv_handle_writes(void) {
-    if (s_write_buf_len > 0) {
-        const size_t start_pos =
-            CDC_WRITE_BUF_IDX(s_write_buf_pos - s_write_buf_len);
-        for (size_t i = 0; i < (size_t) s_write_buf_len; i++) {
-            const size_t idx = CDC_WRITE_BUF_IDX(start_pos + i);
-            if (tud_cdc_available() > 0) {
-                // If we receive data while doing a large write, we need to
-                // fully service it before continuing to write, or the
-                // stack will crash.
-                prv_handle_reads();
-            }
-            if (tud_cdc_write_available()) {
-                tud_cdc_write(&s_write_buf[idx], 1);
-            }
-            s_write_buf[idx] = 0;
-            s_write_buf_len--;
+    while (s_write_head != s_write_tail) {
+        if (tud_cdc_available() > 0) {
+            // If we receive data while doing a large write, we need to
+            // fully service it before continuing to write, or the
+            // stack will crash.
+            prv_handle_reads();
         }
-        tud_cdc_write_flush();
+        const uint32_t writable = tud_cdc_write_available();
+        if (writable == 0) break;
+        const size_t idx = CDC_WRITE_BUF_IDX(s_write_tail);
+        size_t span = CDC_WRITE_BUF_SZ - idx;
+        const size_t pending = s_write_head - s_write_tail;
+        if (span > pending) span = pending;
+        if (span > writable) span = writable;
+        s_write_tail += tud_cdc_write(&s_write_buf[idx], span);
     }
+    tud_cdc_write_flush();
 }
 
 void cdc_task(void) {
@@ -25,6 +25,12 @@
 
 #pragma once
 
+#include <stddef.h>
+
 int _write(int file, char *ptr, int len);
+// Free space in the CDC write buffer. With the port open, _write paces itself
+// against this by draining to the host; only when the host isn't listening do
+// bytes written beyond it overwrite the oldest unsent output.
+size_t cdc_write_free(void);
 int _read(int file, char *ptr, int len);
 void cdc_task(void);
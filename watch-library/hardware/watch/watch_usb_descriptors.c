@@ -24,6 +24,7 @@
  */
 
 #include "tusb.h"
+#include "watch_usb_msc.h"
 
 //--------------------------------------------------------------------+
 // Device Descriptors
@@ -68,11 +69,21 @@ enum {
     ITF_NUM_TOTAL
 };
 
-#define CONFIG_TOTAL_LEN    (TUD_CONFIG_DESC_LEN + TUD_CDC_DESC_LEN)
+// Interface numbering for the alternate configuration with mass storage enabled.
+// CDC keeps its interfaces and endpoints so the shell stays usable alongside the drive.
+enum {
+    ITF_NUM_MSC = ITF_NUM_TOTAL,
+    ITF_NUM_TOTAL_MSC
+};
+
+#define CONFIG_TOTAL_LEN        (TUD_CONFIG_DESC_LEN + TUD_CDC_DESC_LEN)
+#define CONFIG_TOTAL_LEN_MSC    (TUD_CONFIG_DESC_LEN + TUD_CDC_DESC_LEN + TUD_MSC_DESC_LEN)
 
 #define EPNUM_CDC_NOTIF   0x81
 #define EPNUM_CDC_OUT     0x02
 #define EPNUM_CDC_IN      0x82
+#define EPNUM_MSC_OUT     0x03
+#define EPNUM_MSC_IN      0x83
 
 uint8_t const desc_fs_configuration[] = {
     // Config number, interface count, string index, total length, attribute, power in mA
@@ -82,11 +93,25 @@ uint8_t const desc_fs_configuration[] = {
     TUD_CDC_DESCRIPTOR(ITF_NUM_CDC, 4, EPNUM_CDC_NOTIF, 8, EPNUM_CDC_OUT, EPNUM_CDC_IN, 64),
 };
 
+uint8_t const desc_fs_configuration_msc[] = {
+    // Config number, interface count, string index, total length, attribute, power in mA
+    TUD_CONFIG_DESCRIPTOR(1, ITF_NUM_TOTAL_MSC, 0, CONFIG_TOTAL_LEN_MSC, TUSB_DESC_CONFIG_ATT_REMOTE_WAKEUP, 100),
+
+    // Interface number, string index, EP notification address and size, EP data address (out, in) and size.
+    TUD_CDC_DESCRIPTOR(ITF_NUM_CDC, 4, EPNUM_CDC_NOTIF, 8, EPNUM_CDC_OUT, EPNUM_CDC_IN, 64),
+
+    // Interface number, string index, EP Out & EP In address, EP size
+    TUD_MSC_DESCRIPTOR(ITF_NUM_MSC, 5, EPNUM_MSC_OUT, EPNUM_MSC_IN, 64),
+};
+
 // Invoked when received GET CONFIGURATION DESCRIPTOR
 // Application return pointer to descriptor
 // Descriptor contents must exist long enough for transfer to complete
 uint8_t const * tud_descriptor_configuration_cb(uint8_t index) {
     (void) index; // for multiple configurations
+    // watch_usb_msc_enable re-enumerates after flipping this, so the host always
+    // sees a configuration consistent with the current mode.
+    if (watch_usb_msc_enabled()) return desc_fs_configuration_msc;
     return desc_fs_configuration;
 }
 
@@ -94,61 +119,75 @@ uint8_t const * tud_descriptor_configuration_cb(uint8_t index) {
 // String Descriptors
 //--------------------------------------------------------------------+
 
-static char serialnum[32 * 2 + 1] = {'\0'}; // 2 chars per hexnumber + '\0'
-
 // array of pointer to string descriptors
 char const* string_desc_arr [] = {
     (const char[]) { 0x09, 0x04 },  // 0: is supported language is English (0x0409)
     "Oddly Specific Objects",       // 1: Manufacturer
     "Sensor Watch",                 // 2: Product
-    serialnum,                      // 3: Serial number
+    NULL,                           // 3: Serial number (from the chip unique ID)
     "TinyUSB CDC",                  // 4: CDC Interface
+    "Sensor Watch Files",           // 5: MSC Interface
 };
 
-static uint16_t _desc_str[32];
-static bool serial_number_written = false;
+#define STRING_DESC_COUNT (sizeof(string_desc_arr) / sizeof(string_desc_arr[0]))
+
+// String descriptors are built once, before the stack attaches, so a GET STRING
+// request during enumeration returns a finished buffer instead of hexifying the
+// serial number and converting ASCII to UTF-16 on the wire's clock. They live
+// packed end to end in one pool with an offset per index.
+static uint16_t _string_desc_pool[128];
+static uint8_t _string_desc_offset[STRING_DESC_COUNT];
+static bool _string_descs_built = false;
+
+void watch_usb_descriptors_build(void) {
+    if (_string_descs_built) return;
+
+    // Serial number from the chip unique ID, eight hex digits per word.
+    char serialnum[33];
+    const uint32_t chipid[4] = {
+        *((uint32_t *)0x0080A00C),
+        *((uint32_t *)0x0080A040),
+        *((uint32_t *)0x0080A044),
+        *((uint32_t *)0x0080A048),
+    };
+    char *s = serialnum;
+    for (uint8_t word = 0; word < 4; word++) {
+        for (int8_t shift = 28; shift >= 0; shift -= 4) {
+            *s++ = "0123456789ABCDEF"[(chipid[word] >> shift) & 0xF];
+        }
+    }
+    *s = '\0';
+
+    uint8_t pos = 0;
+    for (uint8_t index = 0; index < STRING_DESC_COUNT; index++) {
+        _string_desc_offset[index] = pos;
+        if (index == 0) {
+            // the language list is already UTF-16, not ASCII
+            _string_desc_pool[pos] = (TUSB_DESC_STRING << 8) | 4;
+            memcpy(&_string_desc_pool[pos + 1], string_desc_arr[0], 2);
+            pos += 2;
+            continue;
+        }
+        const char *str = (index == 3) ? serialnum : string_desc_arr[index];
+        uint8_t chr_count = strlen(str);
+        if (chr_count > 31) chr_count = 31;
+        // first byte is length (including header), second byte is string type
+        _string_desc_pool[pos] = (TUSB_DESC_STRING << 8) | (2 * chr_count + 2);
+        for (uint8_t i = 0; i < chr_count; i++) {
+            _string_desc_pool[pos + 1 + i] = str[i];
+        }
+        pos += 1 + chr_count;
+    }
+    _string_descs_built = true;
+}
 
 // Invoked when received GET STRING DESCRIPTOR request
 // Application return pointer to descriptor, whose contents must exist long enough for transfer to complete
 uint16_t const* tud_descriptor_string_cb(uint8_t index, uint16_t langid) {
     (void) langid;
-    uint8_t chr_count;
-
-    if (!serial_number_written) {
-        // Generate serial number based on chip unique ID
-        uint32_t chipid[4];
-        chipid[0] = *((uint32_t *)0x0080A00C);
-        chipid[1] = *((uint32_t *)0x0080A040);
-        chipid[2] = *((uint32_t *)0x0080A044);
-        chipid[3] = *((uint32_t *)0x0080A048);
-
-        sprintf(serialnum, "%08lX%08lX%08lX%08lX", chipid[0], chipid[1], chipid[2], chipid[3]);
-        serial_number_written = true;
-    }
-
-    if (index == 0) {
-        memcpy(&_desc_str[1], string_desc_arr[0], 2);
-        chr_count = 1;
-    } else {
-        // Note: the 0xEE index string is a Microsoft OS 1.0 Descriptors.
-        // https://docs.microsoft.com/en-us/windows-hardware/drivers/usbcon/microsoft-defined-usb-descriptors
-
-        if ( !(index < sizeof(string_desc_arr)/sizeof(string_desc_arr[0])) ) return NULL;
-
-        const char* str = string_desc_arr[index];
-
-        // Cap at max char
-        chr_count = strlen(str);
-        if ( chr_count > 31 ) chr_count = 31;
-
-        // Convert ASCII string into UTF-16
-        for(uint8_t i=0; i<chr_count; i++) {
-            _desc_str[1+i] = str[i];
-        }
-    }
-
-    // first byte is length (including header), second byte is string type
-    _desc_str[0] = (TUSB_DESC_STRING << 8 ) | (2*chr_count + 2);
-
-    return _desc_str;
+    // Note: the 0xEE index string is a Microsoft OS 1.0 Descriptors.
+    // https://docs.microsoft.com/en-us/windows-hardware/drivers/usbcon/microsoft-defined-usb-descriptors
+    if (index >= STRING_DESC_COUNT) return NULL;
+    if (!_string_descs_built) watch_usb_descriptors_build();    // _watch_enable_usb builds these; this is a belt and braces
+    return &_string_desc_pool[_string_desc_offset[index]];
 }
@@ -0,0 +1,385 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "watch_usb_msc.h"
+#include "tusb.h"
+#include "lfs.h"
+#include "ring_log.h"
+#include "delay.h"
+
+// The littlefs instance lives in filesystem.c; we read through it directly so
+// sectors can be served from any offset of any file without staging.
+extern lfs_t eeprom_filesystem;
+
+// Volume geometry. One 512-byte sector per cluster keeps the cluster<->sector
+// math trivial; the FAT is sized for 8190 data clusters (about 4 MB), which is
+// comfortably past the 4085-cluster floor below which hosts would treat the
+// volume as FAT12, and leaves room for the 1 MB ring log plus the 8 KB
+// filesystem many times over. Clusters beyond the snapshotted files are simply
+// never mapped, so the oversized volume costs nothing.
+#define MSC_SECTOR_SIZE (512)
+#define MSC_RESERVED_SECTORS (1)
+#define MSC_FAT_SECTORS (32)
+#define MSC_ROOT_DIR_SECTORS (4)
+#define MSC_ROOT_DIR_ENTRIES (MSC_ROOT_DIR_SECTORS * (MSC_SECTOR_SIZE / 32))
+#define MSC_DATA_CLUSTERS (MSC_FAT_SECTORS * (MSC_SECTOR_SIZE / 2) - 2)
+#define MSC_TOTAL_SECTORS (MSC_RESERVED_SECTORS + MSC_FAT_SECTORS + MSC_ROOT_DIR_SECTORS + MSC_DATA_CLUSTERS)
+#define MSC_DATA_START_SECTOR (MSC_RESERVED_SECTORS + MSC_FAT_SECTORS + MSC_ROOT_DIR_SECTORS)
+
+// Room for the volume label, the ring log, and the littlefs listing. The
+// filesystem is 8 KB; more than 30 files would mean they average under 273
+// bytes, so this is not the limit anyone hits first.
+#define MSC_MAX_FILES (31)
+
+// All dates in the volume are fixed: littlefs keeps no timestamps, and a fake
+// "now" would just make every export look freshly modified. 0x5D01 = 2026-08-01.
+#define MSC_FAT_DATE (((2026 - 1980) << 9) | (8 << 5) | 1)
+
+typedef struct {
+    char name83[11];        // 8.3 name, space padded, as it goes in the directory
+    char lfs_name[40];      // littlefs path; empty string marks the ring log
+    uint32_t size;
+    uint16_t first_cluster; // 0 for empty files (no clusters allocated)
+    uint16_t cluster_count;
+} msc_file_t;
+
+static msc_file_t _files[MSC_MAX_FILES];
+static uint8_t _file_count;
+static bool _enabled;
+
+// One littlefs handle stays open across reads so sequential sectors of the
+// same file cost one traversal, not one per sector. -1 = nothing open.
+static lfs_file_t _open_file;
+static int8_t _open_file_idx = -1;
+
+// Hosts often split a sector across several tinyusb buffer fills; synthesize
+// each sector once and serve the pieces from here.
+static uint8_t _sector_cache[MSC_SECTOR_SIZE];
+static uint32_t _cached_lba = 0xFFFFFFFF;
+
+static void _put16(uint8_t *p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static void _put32(uint8_t *p, uint32_t v) {
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    p[2] = (v >> 16) & 0xFF;
+    p[3] = (v >> 24) & 0xFF;
+}
+
+// Converts a littlefs filename to a space-padded 8.3 directory name: uppercase,
+// split at the last dot, anything FAT disallows becomes an underscore.
+static void _make_83_name(const char *name, char out[11]) {
+    memset(out, ' ', 11);
+    const char *dot = strrchr(name, '.');
+    if (dot == name) dot = NULL;    // dotfile: treat the whole name as the stem
+    uint8_t pos = 0;
+    for (const char *p = name; *p && (!dot || p < dot) && pos < 8; p++) {
+        char ch = *p;
+        if (ch >= 'a' && ch <= 'z') ch -= 32;
+        if (!((ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_' || ch == '-' || ch == '~')) ch = '_';
+        out[pos++] = ch;
+    }
+    if (dot) {
+        pos = 8;
+        for (const char *p = dot + 1; *p && pos < 11; p++) {
+            char ch = *p;
+            if (ch >= 'a' && ch <= 'z') ch -= 32;
+            if (!((ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_' || ch == '-' || ch == '~')) ch = '_';
+            out[pos++] = ch;
+        }
+    }
+}
+
+static bool _83_name_taken(const char name83[11], uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (memcmp(_files[i].name83, name83, 11) == 0) return true;
+    }
+    return false;
+}
+
+// Builds the export table: every regular file in the littlefs root, plus the
+// raw ring log region if one is mounted. Clusters are handed out contiguously
+// in table order, so the FAT chains are pure runs.
+static void _snapshot_files(void) {
+    _file_count = 0;
+    _open_file_idx = -1;
+    _cached_lba = 0xFFFFFFFF;
+    uint16_t next_cluster = 2;
+
+    if (ring_log_mount()) {
+        msc_file_t *f = &_files[_file_count++];
+        memcpy(f->name83, "RINGLOG BIN", 11);
+        f->lfs_name[0] = '\0';
+        f->size = ring_log_raw_size();
+        f->first_cluster = next_cluster;
+        f->cluster_count = (f->size + MSC_SECTOR_SIZE - 1) / MSC_SECTOR_SIZE;
+        next_cluster += f->cluster_count;
+    }
+
+    lfs_dir_t dir;
+    struct lfs_info info;
+    if (lfs_dir_open(&eeprom_filesystem, &dir, "/") < 0) return;
+    while (lfs_dir_read(&eeprom_filesystem, &dir, &info) > 0) {
+        if (info.type != LFS_TYPE_REG) continue;
+        if (_file_count >= MSC_MAX_FILES) break;
+        uint16_t clusters = (info.size + MSC_SECTOR_SIZE - 1) / MSC_SECTOR_SIZE;
+        if (next_cluster + clusters > MSC_DATA_CLUSTERS + 2) continue;
+
+        msc_file_t *f = &_files[_file_count];
+        _make_83_name(info.name, f->name83);
+        if (_83_name_taken(f->name83, _file_count)) {
+            // Two names truncated to the same stem; stamp the slot number in to
+            // keep the directory unambiguous. Crude, but collisions on an 8 KB
+            // filesystem are rare enough that pretty isn't worth the code.
+            f->name83[6] = '~';
+            f->name83[7] = '0' + (_file_count % 10);
+        }
+        strncpy(f->lfs_name, info.name, sizeof(f->lfs_name) - 1);
+        f->lfs_name[sizeof(f->lfs_name) - 1] = '\0';
+        f->size = info.size;
+        if (clusters) {
+            f->first_cluster = next_cluster;
+            next_cluster += clusters;
+        } else {
+            f->first_cluster = 0;
+        }
+        f->cluster_count = clusters;
+        _file_count++;
+    }
+    lfs_dir_close(&eeprom_filesystem, &dir);
+}
+
+static void _build_boot_sector(uint8_t *buf) {
+    buf[0] = 0xEB; buf[1] = 0x3C; buf[2] = 0x90;            // jump, for form's sake
+    memcpy(&buf[3], "MSWIN4.1", 8);                          // OEM name
+    _put16(&buf[11], MSC_SECTOR_SIZE);
+    buf[13] = 1;                                             // sectors per cluster
+    _put16(&buf[14], MSC_RESERVED_SECTORS);
+    buf[16] = 1;                                             // one FAT copy
+    _put16(&buf[17], MSC_ROOT_DIR_ENTRIES);
+    _put16(&buf[19], MSC_TOTAL_SECTORS);                     // fits in 16 bits
+    buf[21] = 0xF8;                                          // fixed disk media byte
+    _put16(&buf[22], MSC_FAT_SECTORS);
+    _put16(&buf[24], 1);                                     // sectors per track (unused)
+    _put16(&buf[26], 1);                                     // heads (unused)
+    buf[36] = 0x80;                                          // drive number
+    buf[38] = 0x29;                                          // extended boot signature
+    _put32(&buf[39], 0x57415443);                            // volume serial
+    memcpy(&buf[43], "SENSORWATCH", 11);
+    memcpy(&buf[54], "FAT16   ", 8);
+    buf[510] = 0x55; buf[511] = 0xAA;
+}
+
+// FAT entry for a cluster: since allocations are contiguous runs, the entry is
+// just "next cluster" inside a file and the end marker at its last cluster.
+static uint16_t _fat_entry(uint32_t cluster) {
+    if (cluster == 0) return 0xFFF8;    // media byte echo
+    if (cluster == 1) return 0xFFFF;
+    for (uint8_t i = 0; i < _file_count; i++) {
+        msc_file_t *f = &_files[i];
+        if (f->cluster_count && cluster >= f->first_cluster && cluster < (uint32_t)f->first_cluster + f->cluster_count) {
+            if (cluster == (uint32_t)f->first_cluster + f->cluster_count - 1) return 0xFFFF;
+            return cluster + 1;
+        }
+    }
+    return 0x0000;                      // free
+}
+
+static void _build_fat_sector(uint32_t fat_sector, uint8_t *buf) {
+    uint32_t first_entry = fat_sector * (MSC_SECTOR_SIZE / 2);
+    for (uint32_t i = 0; i < MSC_SECTOR_SIZE / 2; i++) {
+        _put16(&buf[i * 2], _fat_entry(first_entry + i));
+    }
+}
+
+static void _build_dir_entry(uint8_t *entry, const msc_file_t *f) {
+    memcpy(entry, f->name83, 11);
+    entry[11] = 0x01;                   // read-only
+    _put16(&entry[24], MSC_FAT_DATE);   // modified date (time stays 00:00)
+    _put16(&entry[26], f->first_cluster);
+    _put32(&entry[28], f->size);
+}
+
+static void _build_root_dir_sector(uint32_t dir_sector, uint8_t *buf) {
+    // entry 0 of sector 0 is the volume label; files follow
+    uint32_t first_slot = dir_sector * (MSC_SECTOR_SIZE / 32);
+    for (uint32_t slot = first_slot; slot < first_slot + (MSC_SECTOR_SIZE / 32); slot++) {
+        uint8_t *entry = &buf[(slot - first_slot) * 32];
+        if (slot == 0) {
+            memcpy(entry, "SENSORWATCH", 11);
+            entry[11] = 0x08;           // volume label attribute
+            _put16(&entry[24], MSC_FAT_DATE);
+        } else if (slot <= _file_count) {
+            _build_dir_entry(entry, &_files[slot - 1]);
+        }
+    }
+}
+
+// Serves one sector of file data. The cluster has already been mapped to a
+// file and byte offset; short reads past the snapshot size come back zeroed.
+static void _read_file_data(uint8_t file_idx, uint32_t offset, uint8_t *buf) {
+    msc_file_t *f = &_files[file_idx];
+    uint32_t length = MSC_SECTOR_SIZE;
+    if (offset >= f->size) return;
+    if (length > f->size - offset) length = f->size - offset;
+
+    if (f->lfs_name[0] == '\0') {
+        ring_log_read_raw(offset, buf, length);
+        return;
+    }
+
+    if (_open_file_idx != (int8_t)file_idx) {
+        if (_open_file_idx >= 0) lfs_file_close(&eeprom_filesystem, &_open_file);
+        _open_file_idx = -1;
+        if (lfs_file_open(&eeprom_filesystem, &_open_file, f->lfs_name, LFS_O_RDONLY) < 0) return;
+        _open_file_idx = file_idx;
+    }
+    if (lfs_file_seek(&eeprom_filesystem, &_open_file, offset, LFS_SEEK_SET) < 0) return;
+    lfs_file_read(&eeprom_filesystem, &_open_file, buf, length);
+}
+
+static void _synthesize_sector(uint32_t lba, uint8_t *buf) {
+    memset(buf, 0, MSC_SECTOR_SIZE);
+    if (lba == 0) {
+        _build_boot_sector(buf);
+    } else if (lba < MSC_RESERVED_SECTORS + MSC_FAT_SECTORS) {
+        _build_fat_sector(lba - MSC_RESERVED_SECTORS, buf);
+    } else if (lba < MSC_DATA_START_SECTOR) {
+        _build_root_dir_sector(lba - MSC_RESERVED_SECTORS - MSC_FAT_SECTORS, buf);
+    } else {
+        uint32_t cluster = lba - MSC_DATA_START_SECTOR + 2;
+        for (uint8_t i = 0; i < _file_count; i++) {
+            msc_file_t *f = &_files[i];
+            if (f->cluster_count && cluster >= f->first_cluster && cluster < (uint32_t)f->first_cluster + f->cluster_count) {
+                _read_file_data(i, (cluster - f->first_cluster) * MSC_SECTOR_SIZE, buf);
+                break;
+            }
+        }
+        // unmapped clusters read as zeros
+    }
+}
+
+bool watch_usb_msc_enable(void) {
+    if (_enabled) return false;
+    _snapshot_files();
+    _enabled = true;
+    // Drop off the bus long enough for the host to notice, then come back with
+    // the MSC interface in the configuration.
+    tud_disconnect();
+    delay_ms(50);
+    tud_connect();
+    return true;
+}
+
+void watch_usb_msc_disable(void) {
+    if (!_enabled) return;
+    _enabled = false;
+    if (_open_file_idx >= 0) {
+        lfs_file_close(&eeprom_filesystem, &_open_file);
+        _open_file_idx = -1;
+    }
+    tud_disconnect();
+    delay_ms(50);
+    tud_connect();
+}
+
+bool watch_usb_msc_enabled(void) {
+    return _enabled;
+}
+
+//--------------------------------------------------------------------+
+// tinyusb MSC callbacks
+//--------------------------------------------------------------------+
+
+void tud_msc_inquiry_cb(uint8_t lun, uint8_t vendor_id[8], uint8_t product_id[16], uint8_t product_rev[4]) {
+    (void) lun;
+    memcpy(vendor_id, "OSO     ", 8);
+    memcpy(product_id, "Sensor Watch    ", 16);
+    memcpy(product_rev, "1.0 ", 4);
+}
+
+bool tud_msc_test_unit_ready_cb(uint8_t lun) {
+    if (!_enabled) {
+        tud_msc_set_sense(lun, SCSI_SENSE_NOT_READY, 0x3A, 0x00);   // medium not present
+        return false;
+    }
+    return true;
+}
+
+void tud_msc_capacity_cb(uint8_t lun, uint32_t *block_count, uint16_t *block_size) {
+    (void) lun;
+    *block_count = MSC_TOTAL_SECTORS;
+    *block_size = MSC_SECTOR_SIZE;
+}
+
+bool tud_msc_is_writable_cb(uint8_t lun) {
+    (void) lun;
+    return false;
+}
+
+int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset, void *buffer, uint32_t bufsize) {
+    (void) lun;
+    if (lba >= MSC_TOTAL_SECTORS) return -1;
+    if (offset >= MSC_SECTOR_SIZE) return -1;
+
+    if (lba != _cached_lba) {
+        _synthesize_sector(lba, _sector_cache);
+        _cached_lba = lba;
+    }
+    uint32_t count = MSC_SECTOR_SIZE - offset;
+    if (count > bufsize) count = bufsize;
+    memcpy(buffer, &_sector_cache[offset], count);
+    return count;
+}
+
+int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *buffer, uint32_t bufsize) {
+    (void) lba;
+    (void) offset;
+    (void) buffer;
+    (void) bufsize;
+    // Shouldn't happen — we report the unit not writable — but belt and braces.
+    tud_msc_set_sense(lun, SCSI_SENSE_DATA_PROTECT, 0x27, 0x00);    // write protected
+    return -1;
+}
+
+bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, bool start, bool load_eject) {
+    (void) lun;
+    (void) power_condition;
+    (void) start;
+    (void) load_eject;
+    return true;
+}
+
+int32_t tud_msc_scsi_cb(uint8_t lun, uint8_t const scsi_cmd[16], void *buffer, uint16_t bufsize) {
+    (void) buffer;
+    (void) bufsize;
+    // Everything we support is handled by the dedicated callbacks above.
+    tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x20, 0x00); // invalid command
+    (void) scsi_cmd;
+    return -1;
+}
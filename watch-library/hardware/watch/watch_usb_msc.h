@@ -0,0 +1,54 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+// USB mass storage export. When armed, the watch re-enumerates as a composite
+// CDC + MSC device and presents a read-only FAT16 volume synthesized on the
+// fly: the littlefs files appear in the root directory under 8.3 names, and
+// the SPI flash ring log region ships whole as RINGLOG.BIN. Nothing is staged
+// anywhere — each 512-byte sector the host asks for is built from the boot
+// sector / FAT / directory templates or read straight out of littlefs or the
+// flash, so the mode costs one sector buffer of RAM. The volume is strictly
+// read-only (writes are rejected at the SCSI level); pulling files out is
+// drag and drop, putting them back is still the shell's `put`.
+//
+// The directory listing and file sizes are snapshotted when the mode is armed.
+// Files that grow or change afterward are served at their snapshot size; if
+// that matters, disarm and re-arm to take a fresh snapshot.
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Arms mass storage mode: snapshots the filesystem listing and re-enumerates
+// with the MSC interface present. Returns false if it was already armed.
+bool watch_usb_msc_enable(void);
+
+// Disarms mass storage mode and re-enumerates back to CDC only. The host
+// should have ejected the volume first, but nothing breaks if it didn't —
+// the drive just disappears.
+void watch_usb_msc_disable(void);
+
+// True while mass storage mode is armed.
+bool watch_usb_msc_enabled(void);
@@ -22,11 +22,23 @@
  * SOFTWARE.
  */
 
+#include <stdlib.h>
+#include <string.h>
 #include "lis2dw.h"
 #include "watch.h"
 
+// The simulator emulates the LIS2DW at the register level behind the standard
+// I2C calls (see watch-library/simulator/watch/watch_i2c.c), so build the real
+// driver there too instead of compiling it down to stubs.
+#if defined(__EMSCRIPTEN__) && !defined(I2C_SERCOM)
+#define I2C_SERCOM 0
+#endif
+
 bool lis2dw_begin(void) {
 #ifdef I2C_SERCOM
+    // run this device's transactions in fast mode; the selection latches, so
+    // the config accessors below inherit it without asking again.
+    watch_i2c_set_speed(LIS2DW_I2C_SPEED);
     if (lis2dw_get_device_id() != LIS2DW_WHO_AM_I_VAL) {
         return false;
     }
@@ -280,6 +292,7 @@ inline void lis2dw_disable_fifo(void) {
 bool lis2dw_read_fifo(lis2dw_fifo_t *fifo_data, uint32_t timeout) {
     // timeout is in terms of 1/RTC_CNT_HZ seconds (likely 128 timeouts is one second)
 #ifdef I2C_SERCOM
+    watch_i2c_set_speed(LIS2DW_I2C_SPEED);
     uint8_t temp = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_FIFO_SAMPLE);
     bool overrun = !!(temp & LIS2DW_FIFO_SAMPLE_OVERRUN);
 
@@ -301,6 +314,104 @@ bool lis2dw_read_fifo(lis2dw_fifo_t *fifo_data, uint32_t timeout) {
 #endif
 }
 
+bool lis2dw_read_fifo_burst(lis2dw_fifo_t *fifo_data) {
+#ifdef I2C_SERCOM
+    watch_i2c_set_speed(LIS2DW_I2C_SPEED);
+    uint8_t temp = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_FIFO_SAMPLE);
+    bool overrun = !!(temp & LIS2DW_FIFO_SAMPLE_OVERRUN);
+
+    fifo_data->count = temp & LIS2DW_FIFO_SAMPLE_COUNT;
+    if (fifo_data->count > 32) fifo_data->count = 32;
+
+    if (fifo_data->count) {
+        // With IF_ADD_INC set (we set it in lis2dw_begin), reads past OUT_Z_H wrap back
+        // to OUT_X_L and pop the next FIFO entry, so the whole FIFO drains in a single
+        // transaction. lis2dw_reading_t is three little-endian int16s, which is exactly
+        // the wire format, so we can read straight into the caller's buffer.
+        uint8_t reg = LIS2DW_REG_OUT_X_L | 0x80; // set high bit for consecutive reads
+        watch_i2c_send(LIS2DW_ADDRESS, &reg, 1);
+        watch_i2c_receive(LIS2DW_ADDRESS, (uint8_t *)fifo_data->readings, 6 * fifo_data->count);
+    }
+
+    return overrun;
+#else
+    (void) fifo_data;
+    return false;
+#endif
+}
+
+// One-pole high-pass state, kept in Q4 for headroom; persists across batches so the DC
+// (gravity) estimate doesn't restart on every FIFO read.
+static int32_t _feature_dc_estimate[3];
+static bool _feature_dc_primed = false;
+static bool _feature_peak_armed = true;
+
+static inline int16_t _feature_high_pass(int32_t *dc, int16_t sample) {
+    // low-pass the input with alpha = 1/16, then subtract: what's left is the high-passed
+    // signal. The estimate is held scaled by 16 so the shift doesn't truncate to zero.
+    *dc += (((int32_t)sample << 4) - *dc) >> 4;
+    return (int16_t)(sample - (*dc >> 4));
+}
+
+// Integer vector magnitude approximation: largest component plus a quarter of each of the
+// others. Stays within roughly 15% of the true magnitude with no multiply or square root,
+// which is plenty for thresholding and peak picking.
+static uint16_t _feature_magnitude(int16_t x, int16_t y, int16_t z) {
+    uint16_t ax = abs(x);
+    uint16_t ay = abs(y);
+    uint16_t az = abs(z);
+    uint16_t max = ax;
+    if (ay > max) max = ay;
+    if (az > max) max = az;
+    return max + ((ax + ay + az - max) >> 2);
+}
+
+bool lis2dw_extract_features(lis2dw_features_t *features, uint16_t peak_threshold) {
+    lis2dw_fifo_t fifo;
+    lis2dw_read_fifo_burst(&fifo);
+
+    memset(features, 0, sizeof(lis2dw_features_t));
+    features->sample_count = fifo.count;
+    if (fifo.count == 0) return false;
+
+    if (!_feature_dc_primed) {
+        // seed the DC estimate with the first sample so the first batch isn't one big
+        // artificial step from zero.
+        _feature_dc_estimate[0] = (int32_t)fifo.readings[0].x << 4;
+        _feature_dc_estimate[1] = (int32_t)fifo.readings[0].y << 4;
+        _feature_dc_estimate[2] = (int32_t)fifo.readings[0].z << 4;
+        _feature_dc_primed = true;
+    }
+
+    uint32_t magnitude_sum = 0;
+    for (int8_t i = 0; i < fifo.count; i++) {
+        int16_t hx = _feature_high_pass(&_feature_dc_estimate[0], fifo.readings[i].x);
+        int16_t hy = _feature_high_pass(&_feature_dc_estimate[1], fifo.readings[i].y);
+        int16_t hz = _feature_high_pass(&_feature_dc_estimate[2], fifo.readings[i].z);
+        uint16_t magnitude = _feature_magnitude(hx, hy, hz);
+
+        magnitude_sum += magnitude;
+        if (magnitude > features->peak_magnitude) features->peak_magnitude = magnitude;
+
+        // hysteresis: count a peak on the way up, then wait for the magnitude to fall
+        // below half the threshold before another one can count.
+        if (_feature_peak_armed && magnitude >= peak_threshold) {
+            features->peak_count++;
+            _feature_peak_armed = false;
+        } else if (!_feature_peak_armed && magnitude < (peak_threshold >> 1)) {
+            _feature_peak_armed = true;
+        }
+    }
+    features->mean_magnitude = magnitude_sum / fifo.count;
+
+    return true;
+}
+
+void lis2dw_reset_feature_pipeline(void) {
+    _feature_dc_primed = false;
+    _feature_peak_armed = true;
+}
+
 void lis2dw_clear_fifo(void) {
 #ifdef I2C_SERCOM
     watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_FIFO_CTRL, LIS2DW_FIFO_CTRL_MODE_OFF);
@@ -350,6 +461,33 @@ void lis2dw_disable_stationary_motion_detection(void) {
 #endif
 }
 
+void lis2dw_configure_activity_detection(uint8_t wakeup_threshold) {
+#ifdef I2C_SERCOM
+    // One-stop setup for the hardware activity engine: stationary/motion detection keeps
+    // sampling at 1.6 Hz even while asleep, the sleep state machine classifies the wearer
+    // as active or stationary against the wakeup threshold, and INT2 carries both the
+    // state (level) and its transitions (pulse), so the MCU can sleep until something
+    // actually changes.
+    lis2dw_enable_stationary_motion_detection();
+    lis2dw_enable_sleep();
+    lis2dw_configure_wakeup_threshold(wakeup_threshold);
+    lis2dw_configure_int2(LIS2DW_CTRL5_INT2_SLEEP_STATE | LIS2DW_CTRL5_INT2_SLEEP_CHG);
+#else
+    (void)wakeup_threshold;
+#endif
+}
+
+lis2dw_motion_state_t lis2dw_get_motion_state(void) {
+#ifdef I2C_SERCOM
+    if (watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_SRC) & LIS2DW_WAKE_UP_SRC_VAL_SLEEP_STATE_IA) {
+        return LIS2DW_MOTION_STATE_STATIONARY;
+    }
+    return LIS2DW_MOTION_STATE_ACTIVE;
+#else
+    return LIS2DW_MOTION_STATE_STATIONARY;
+#endif
+}
+
 void lis2dw_configure_wakeup_threshold(uint8_t threshold) {
 #ifdef I2C_SERCOM
     uint8_t configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_THS) & 0b11000000;
@@ -126,6 +126,9 @@ typedef enum {
 // Assumes SA0 is high; if low, its 0x18
 #define LIS2DW_ADDRESS (0x19)
 
+// I2C speed capability: the LIS2DW12 supports fast mode (400 kHz).
+#define LIS2DW_I2C_SPEED WATCH_I2C_SPEED_FAST
+
 #define LIS2DW_REG_OUT_TEMP_L 0x0D  ///< Temperature data low bit
 #define LIS2DW_REG_OUT_TEMP_H 0x0E  ///< Temperature data high bit
 
@@ -349,6 +352,32 @@ void lis2dw_disable_fifo(void);
 
 bool lis2dw_read_fifo(lis2dw_fifo_t *fifo_data, uint32_t timeout);
 
+// Drains the entire FIFO with a single multi-byte read instead of one transaction per
+// sample; roughly 6x less I2C bus-on time than lis2dw_read_fifo. Returns true if the
+// FIFO had overrun. No timeout needed: the transfer length is known up front.
+bool lis2dw_read_fifo_burst(lis2dw_fifo_t *fifo_data);
+
+// Features computed over one FIFO batch by lis2dw_extract_features. All magnitudes are
+// in raw accelerometer counts; no floats anywhere in the pipeline.
+typedef struct {
+    uint16_t peak_magnitude;  // largest high-passed magnitude in the batch
+    uint16_t mean_magnitude;  // average high-passed magnitude across the batch
+    uint8_t peak_count;       // distinct excursions above the caller's threshold
+    uint8_t sample_count;     // number of FIFO samples processed
+} lis2dw_features_t;
+
+// Drains the FIFO with one burst read and reduces it to features in a single fixed-point
+// pass: a one-pole high-pass per axis strips gravity, an add-and-shift approximation
+// stands in for the vector magnitude, and peaks are counted with hysteresis (a new peak
+// arms only after the magnitude falls below half the threshold). Filter state persists
+// across batches, so a face can poll this at FIFO-drain rate — every second or two —
+// instead of processing raw samples at tick rate. Returns false if the FIFO was empty.
+bool lis2dw_extract_features(lis2dw_features_t *features, uint16_t peak_threshold);
+
+// Forgets the high-pass and peak-detector state; call when starting a new measurement
+// session so the previous wearer motion doesn't bleed into the first batch.
+void lis2dw_reset_feature_pipeline(void);
+
 void lis2dw_clear_fifo(void);
 
 void lis2dw_enable_double_tap(void);
@@ -369,6 +398,21 @@ void lis2dw_disable_tap_detection(void);
 
 void lis2dw_configure_wakeup_threshold(uint8_t threshold);
 
+typedef enum {
+    LIS2DW_MOTION_STATE_ACTIVE = 0,     // wakeup events within the inactivity window
+    LIS2DW_MOTION_STATE_STATIONARY,     // no motion above threshold; ODR dropped to 12.5 Hz
+} lis2dw_motion_state_t;
+
+// Configures the on-chip activity classifier: stationary/motion detection, the sleep
+// state machine and the given wakeup threshold, with the classified state and its
+// transitions routed to INT2. Pair with an interrupt on the INT2 pin to track wearer
+// activity with the MCU asleep.
+void lis2dw_configure_activity_detection(uint8_t wakeup_threshold);
+
+// Reads the classifier's current verdict from WAKE_UP_SRC. Prefer the INT2 pin level
+// where it is wired up; this is for spot checks and platforms without the interrupt.
+lis2dw_motion_state_t lis2dw_get_motion_state(void);
+
 void lis2dw_configure_6d_threshold(uint8_t threshold);
 
 void lis2dw_configure_tap_threshold(uint8_t threshold_x, uint8_t threshold_y, uint8_t threshold_z, uint8_t axes_to_enable);
@@ -397,4 +441,16 @@ lis2dw_wakeup_source_t lis2dw_get_wakeup_source(void);
 
 uint8_t lis2dw_get_wakeup_threshold(void);
 
+#ifdef __EMSCRIPTEN__
+// Feed the simulator's emulated accelerometer from a recorded trace instead of
+// the built-in synthetic motion. Samples are served at the configured ODR and
+// repeat from the start when exhausted; the caller's buffer must stay valid.
+// Pass NULL/0 to return to synthetic motion.
+void lis2dw_sim_set_trace(const lis2dw_reading_t *readings, uint8_t count);
+
+// Scale the synthetic wrist motion, in raw counts of triangle-wave swing.
+// Zero means a perfectly stationary wearer (the sleep state machine engages).
+void lis2dw_sim_set_motion_amplitude(uint16_t amplitude);
+#endif
+
 #endif // LIS2DW_H
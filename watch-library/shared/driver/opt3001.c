@@ -35,6 +35,7 @@ THE SOFTWARE.
 
 uint16_t opt3001_readManufacturerID(uint8_t devaddr) {
 	uint8_t buf[2];
+	watch_i2c_set_speed(OPT3001_I2C_SPEED);
 	buf[0] = (uint8_t) OPT3001_MANUFACTURER_ID; 
 	watch_i2c_send(devaddr, buf, 1);
 	watch_i2c_receive(devaddr, buf, 2);
@@ -43,6 +44,7 @@ uint16_t opt3001_readManufacturerID(uint8_t devaddr) {
 
 uint16_t opt3001_readDeviceID(uint8_t devaddr) {
 	uint8_t buf[2];
+	watch_i2c_set_speed(OPT3001_I2C_SPEED);
    	buf[0] = (uint8_t) OPT3001_DEVICE_ID; 
 	watch_i2c_send(devaddr, buf, 1);
 	watch_i2c_receive(devaddr, buf, 2);
@@ -51,6 +53,7 @@ uint16_t opt3001_readDeviceID(uint8_t devaddr) {
 
 opt3001_Config_t opt3001_readConfig(uint8_t devaddr) {
 	opt3001_Config_t config;
+	watch_i2c_set_speed(OPT3001_I2C_SPEED);
 	uint8_t buf[2];
 	buf[0] = (uint8_t) OPT3001_CONFIG; 
 	watch_i2c_send(devaddr, buf, 1);
@@ -60,6 +63,7 @@ opt3001_Config_t opt3001_readConfig(uint8_t devaddr) {
 }
 
 void opt3001_writeConfig(uint8_t devaddr, opt3001_Config_t config) {
+	watch_i2c_set_speed(OPT3001_I2C_SPEED);
     uint8_t buf[3] = {OPT3001_CONFIG, (uint8_t)(config.rawData >> 8), (uint8_t)(config.rawData & 0x00FF)};
     watch_i2c_send(devaddr, buf, 3);
 	return;
@@ -77,10 +81,40 @@ opt3001_t opt3001_readLowLimit(uint8_t devaddr) {
 	return opt3001_readRegister(devaddr, OPT3001_LOW_LIMIT);
 }
 
+static uint8_t _opt3001_int_devaddr;
+static opt3001_conversion_cb_t _opt3001_conversion_callback;
+
+static void _opt3001_conversion_ready(void) {
+	// reading the result register clears the latched INT line for the next conversion.
+	if (_opt3001_conversion_callback) _opt3001_conversion_callback(opt3001_readResult(_opt3001_int_devaddr));
+}
+
+void opt3001_enableConversionReadyInterrupt(uint8_t devaddr, uint8_t int_pin, opt3001_conversion_cb_t callback) {
+	_opt3001_int_devaddr = devaddr;
+	_opt3001_conversion_callback = callback;
+
+	// setting the two MSBs of the low limit register's exponent selects end-of-conversion
+	// mode: INT asserts when a conversion finishes rather than on a limit crossing.
+	uint8_t buf[3] = {OPT3001_LOW_LIMIT, 0xC0, 0x00};
+	watch_i2c_set_speed(OPT3001_I2C_SPEED);
+	watch_i2c_send(devaddr, buf, 3);
+
+	// INT is active low and latched until the result is read.
+	watch_register_interrupt_callback(int_pin, _opt3001_conversion_ready, INTERRUPT_TRIGGER_FALLING);
+}
+
+void opt3001_startOneShotConversion(uint8_t devaddr) {
+	opt3001_Config_t config = opt3001_readConfig(devaddr);
+	config.Latch = 1;
+	config.ModeOfConversionOperation = 1; // single-shot; the sensor shuts itself down after
+	opt3001_writeConfig(devaddr, config);
+}
+
 opt3001_t opt3001_readRegister(uint8_t devaddr, opt3001_Command_t command) {
     opt3001_t result;
     opt3001_ER_t er;
     uint8_t buf[2]; 
+	watch_i2c_set_speed(OPT3001_I2C_SPEED);
 	buf[0] = (uint8_t) command; 
 	watch_i2c_send(devaddr, buf, 1);
 	watch_i2c_receive(devaddr, buf, 2);
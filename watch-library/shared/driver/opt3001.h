@@ -32,6 +32,9 @@ THE SOFTWARE.
 #define OPT3001_
 #include <stdint.h>
 
+// I2C speed capability: the OPT3001 supports fast mode (400 kHz).
+#define OPT3001_I2C_SPEED WATCH_I2C_SPEED_FAST
+
 typedef enum {
 	OPT3001_RESULT		= 0x00,
 	OPT3001_CONFIG		= 0x01,
@@ -73,6 +76,8 @@ typedef struct {
 	opt3001_ER_t raw;
 } opt3001_t;
 
+typedef void (*opt3001_conversion_cb_t)(opt3001_t result);
+
 uint16_t opt3001_readManufacturerID(uint8_t devaddr);
 uint16_t opt3001_readDeviceID(uint8_t devaddr);
 
@@ -84,4 +89,14 @@ opt3001_Config_t opt3001_readConfig(uint8_t devaddr);
 void opt3001_writeConfig(uint8_t devaddr, opt3001_Config_t config);
 opt3001_t opt3001_readRegister(uint8_t devaddr, opt3001_Command_t command);
 
+// Puts the sensor in end-of-conversion mode and routes its INT pin (active low, latched)
+// through the external interrupt controller. The callback runs in interrupt context with
+// the finished reading; reading the result also releases the INT line for the next shot.
+void opt3001_enableConversionReadyInterrupt(uint8_t devaddr, uint8_t int_pin, opt3001_conversion_cb_t callback);
+
+// Kicks off a single-shot conversion. The sensor integrates for 100 or 800 ms (per the
+// ConversionTime config bit) while the MCU sleeps, then asserts INT; the callback passed
+// to opt3001_enableConversionReadyInterrupt delivers the result.
+void opt3001_startOneShotConversion(uint8_t devaddr);
+
 #endif // OPT3001_
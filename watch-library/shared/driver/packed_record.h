@@ -0,0 +1,151 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+/*
+ * PACKED RECORD CODEC
+ *
+ * The single source of truth for the ring log's on-flash wire format, shared
+ * between the on-watch writer (ring_log.c) and the host-side decoding tools
+ * (utils/motion_express_utilities). Everything here is plain C99 over raw byte
+ * buffers — no watch dependencies, no struct overlays, no assumptions about
+ * the compiler's endianness or padding — so the same header compiles into the
+ * firmware and into a native host utility, and a record format change is one
+ * edit instead of a parser fork.
+ *
+ * All multi-byte fields are little-endian. The wire format is versioned by the
+ * sector header; bump PACKED_RECORD_FORMAT_VERSION when the layout changes and
+ * keep the old decoder around on the host side for old dumps.
+ *
+ * Wire layout, format version 1:
+ *
+ *   sector header (8 bytes):  u16 magic "RL" | u8 version | u8 crc | u32 sequence
+ *   record (16 bytes):        u8 type | u8 crc | u32 timestamp | payload[10]
+ *
+ * Both CRCs are CRC-8 (polynomial 0x07, init 0) over the full structure with
+ * the crc byte zeroed. Unwritten payload bytes read as 0xFF, matching erased
+ * NOR flash; a type byte of 0xFF marks an erased record slot.
+ */
+
+#define PACKED_RECORD_SECTOR_SIZE (4096)
+#define PACKED_RECORD_HEADER_SIZE (8)
+#define PACKED_RECORD_RECORD_SIZE (16)
+#define PACKED_RECORD_PAYLOAD_SIZE (10)
+#define PACKED_RECORD_MAGIC (0x4C52)  // "RL"
+#define PACKED_RECORD_FORMAT_VERSION (1)
+
+// ---- little-endian field primitives ----------------------------------------
+
+static inline void packed_record_put_u16(uint8_t *p, uint16_t value) {
+    p[0] = value & 0xFF;
+    p[1] = (value >> 8) & 0xFF;
+}
+
+static inline void packed_record_put_u32(uint8_t *p, uint32_t value) {
+    p[0] = value & 0xFF;
+    p[1] = (value >> 8) & 0xFF;
+    p[2] = (value >> 16) & 0xFF;
+    p[3] = (value >> 24) & 0xFF;
+}
+
+static inline uint16_t packed_record_get_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+static inline uint32_t packed_record_get_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint8_t packed_record_crc8(const uint8_t *data, uint16_t length) {
+    uint8_t crc = 0;
+    while (length--) {
+        crc ^= *data++;
+        for (uint8_t i = 0; i < 8; i++) crc = (crc & 0x80) ? ((crc << 1) ^ 0x07) : (crc << 1);
+    }
+    return crc;
+}
+
+// ---- sector headers --------------------------------------------------------
+
+/** @brief Encodes a sector header into an 8-byte wire buffer, CRC included. */
+static inline void packed_record_header_encode(uint8_t buf[PACKED_RECORD_HEADER_SIZE], uint32_t sequence) {
+    packed_record_put_u16(buf, PACKED_RECORD_MAGIC);
+    buf[2] = PACKED_RECORD_FORMAT_VERSION;
+    buf[3] = 0;
+    packed_record_put_u32(buf + 4, sequence);
+    buf[3] = packed_record_crc8(buf, PACKED_RECORD_HEADER_SIZE);
+}
+
+/** @brief Decodes and validates a sector header.
+  * @return true if the magic, version and CRC all check out.
+  */
+static inline bool packed_record_header_decode(const uint8_t buf[PACKED_RECORD_HEADER_SIZE], uint32_t *sequence) {
+    uint8_t check[PACKED_RECORD_HEADER_SIZE];
+
+    if (packed_record_get_u16(buf) != PACKED_RECORD_MAGIC) return false;
+    if (buf[2] != PACKED_RECORD_FORMAT_VERSION) return false;
+    memcpy(check, buf, PACKED_RECORD_HEADER_SIZE);
+    check[3] = 0;
+    if (packed_record_crc8(check, PACKED_RECORD_HEADER_SIZE) != buf[3]) return false;
+    if (sequence) *sequence = packed_record_get_u32(buf + 4);
+    return true;
+}
+
+// ---- records ---------------------------------------------------------------
+
+/** @brief Encodes one record into a 16-byte wire buffer, CRC included.
+  * @param payload The payload bytes, or NULL if length is 0. Bytes past length
+  *                are written as 0xFF, matching what erased flash reads back.
+  */
+static inline void packed_record_encode(uint8_t buf[PACKED_RECORD_RECORD_SIZE], uint8_t type, uint32_t timestamp, const void *payload, uint8_t length) {
+    memset(buf, 0xFF, PACKED_RECORD_RECORD_SIZE);
+    buf[0] = type;
+    buf[1] = 0;
+    packed_record_put_u32(buf + 2, timestamp);
+    if (length) memcpy(buf + 6, payload, length);
+    buf[1] = packed_record_crc8(buf, PACKED_RECORD_RECORD_SIZE);
+}
+
+/** @brief Decodes and validates one record.
+  * @param payload On success, points into buf at the first of the 10 payload bytes.
+  * @return true for a valid record; false for an erased slot (type 0xFF), a slot
+  *         torn by a reset, or storage corruption.
+  */
+static inline bool packed_record_decode(const uint8_t buf[PACKED_RECORD_RECORD_SIZE], uint8_t *type, uint32_t *timestamp, const uint8_t **payload) {
+    uint8_t check[PACKED_RECORD_RECORD_SIZE];
+
+    if (buf[0] == 0xFF) return false;
+    memcpy(check, buf, PACKED_RECORD_RECORD_SIZE);
+    check[1] = 0;
+    if (packed_record_crc8(check, PACKED_RECORD_RECORD_SIZE) != buf[1]) return false;
+    if (type) *type = buf[0];
+    if (timestamp) *timestamp = packed_record_get_u32(buf + 2);
+    if (payload) *payload = buf + 6;
+    return true;
+}
@@ -0,0 +1,200 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "ring_log.h"
+#include "packed_record.h"
+#include "spiflash.h"
+#include "watch.h"
+
+// The region of the 1 MB flash the log owns, in 4 KB sectors. The whole chip for now;
+// carve these down if another on-flash consumer ever lands.
+#define RING_LOG_FIRST_SECTOR (0)
+#define RING_LOG_NUM_SECTORS (256)
+
+// The on-flash wire format — header and record layout, CRCs, endianness — lives in
+// packed_record.h, which the host-side decoding tools compile against as well. Keep
+// format changes there so both sides move together.
+#define RING_LOG_SECTOR_SIZE PACKED_RECORD_SECTOR_SIZE
+#define RING_LOG_HEADER_SIZE PACKED_RECORD_HEADER_SIZE
+#define RING_LOG_RECORD_SIZE PACKED_RECORD_RECORD_SIZE
+#define RING_LOG_RECORDS_PER_SECTOR ((RING_LOG_SECTOR_SIZE - RING_LOG_HEADER_SIZE) / RING_LOG_RECORD_SIZE)
+
+static bool _mount_attempted = false;
+static bool _mounted = false;
+static uint16_t _head_sector;    // index into the region, not an absolute sector number
+static uint16_t _head_record;    // next free record slot in the head sector
+static uint32_t _head_sequence;  // sequence number of the head sector
+
+static uint32_t _sector_address(uint16_t sector) {
+    return (uint32_t)(RING_LOG_FIRST_SECTOR + sector) * RING_LOG_SECTOR_SIZE;
+}
+
+// Spin until the flash finishes its program or erase. Page programs are under a
+// millisecond; sector erases (once per 255 appends) run tens of milliseconds.
+static void _wait_for_flash(void) {
+    uint8_t status;
+    do {
+        spi_flash_read_command(CMD_READ_STATUS, &status, 1);
+    } while (status & 0x01);
+}
+
+static bool _read_header(uint16_t sector, uint32_t *sequence) {
+    uint8_t buf[RING_LOG_HEADER_SIZE];
+    spi_flash_read_data(_sector_address(sector), buf, RING_LOG_HEADER_SIZE);
+    return packed_record_header_decode(buf, sequence);
+}
+
+static void _write_header(uint16_t sector, uint32_t sequence) {
+    uint8_t buf[RING_LOG_HEADER_SIZE];
+    packed_record_header_encode(buf, sequence);
+
+    spi_flash_command(CMD_ENABLE_WRITE);
+    spi_flash_write_data(_sector_address(sector), buf, RING_LOG_HEADER_SIZE);
+    _wait_for_flash();
+}
+
+static void _erase_sector(uint16_t sector) {
+    spi_flash_command(CMD_ENABLE_WRITE);
+    spi_flash_sector_command(CMD_SECTOR_ERASE, _sector_address(sector));
+    _wait_for_flash();
+}
+
+// Find the first empty record slot in a sector (all slots used returns RECORDS_PER_SECTOR).
+static uint16_t _find_first_empty_record(uint16_t sector) {
+    uint8_t buf[RING_LOG_RECORD_SIZE];
+    for (uint16_t i = 0; i < RING_LOG_RECORDS_PER_SECTOR; i++) {
+        spi_flash_read_data(_sector_address(sector) + RING_LOG_HEADER_SIZE + (uint32_t)i * RING_LOG_RECORD_SIZE, buf, RING_LOG_RECORD_SIZE);
+        if (buf[0] == 0xFF) return i;
+    }
+    return RING_LOG_RECORDS_PER_SECTOR;
+}
+
+bool ring_log_mount(void) {
+    if (_mount_attempted) return _mounted;
+    _mount_attempted = true;
+
+    spi_flash_init();
+
+    // probe for the chip; boards without the Sensor Board's flash read back bus idle.
+    uint8_t jedec_id[3] = {0};
+    spi_flash_read_command(CMD_READ_JEDEC_ID, jedec_id, 3);
+    if ((jedec_id[0] == 0x00 || jedec_id[0] == 0xFF)) {
+        watch_disable_spi();
+        return false;
+    }
+
+    // walk the sector headers looking for the highest sequence number; that's the head.
+    bool found = false;
+    uint32_t sequence;
+    for (uint16_t i = 0; i < RING_LOG_NUM_SECTORS; i++) {
+        if (!_read_header(i, &sequence)) continue;
+        if (!found || (int32_t)(sequence - _head_sequence) > 0) {
+            _head_sector = i;
+            _head_sequence = sequence;
+            found = true;
+        }
+    }
+
+    if (found) {
+        _head_record = _find_first_empty_record(_head_sector);
+    } else {
+        // virgin region: start the log in the first sector.
+        _erase_sector(0);
+        _write_header(0, 1);
+        _head_sector = 0;
+        _head_sequence = 1;
+        _head_record = 0;
+    }
+
+    _mounted = true;
+    return true;
+}
+
+bool ring_log_append(uint8_t type, uint32_t timestamp, const void *payload, uint8_t length) {
+    if (!_mounted) return false;
+    if (type == 0xFF) return false;
+    if (length > RING_LOG_PAYLOAD_SIZE) return false;
+
+    // if the head sector is full, rotate into the next one: erase whatever was there
+    // (the oldest data in the log) and stamp it with the next sequence number.
+    if (_head_record >= RING_LOG_RECORDS_PER_SECTOR) {
+        _head_sector = (_head_sector + 1) % RING_LOG_NUM_SECTORS;
+        _erase_sector(_head_sector);
+        _write_header(_head_sector, ++_head_sequence);
+        _head_record = 0;
+    }
+
+    uint8_t buf[RING_LOG_RECORD_SIZE];
+    packed_record_encode(buf, type, timestamp, payload, length);
+
+    spi_flash_command(CMD_ENABLE_WRITE);
+    spi_flash_write_data(_sector_address(_head_sector) + RING_LOG_HEADER_SIZE + (uint32_t)_head_record * RING_LOG_RECORD_SIZE, buf, RING_LOG_RECORD_SIZE);
+    _wait_for_flash();
+    _head_record++;
+
+    return true;
+}
+
+void ring_log_iterate(ring_log_iterate_cb_t callback, void *context) {
+    if (!_mounted) return;
+
+    // walking positions from just past the head back around to the head visits sectors
+    // oldest first, since the log rotates through the region strictly in order.
+    for (uint16_t n = 1; n <= RING_LOG_NUM_SECTORS; n++) {
+        uint16_t sector = (_head_sector + n) % RING_LOG_NUM_SECTORS;
+
+        if (!_read_header(sector, NULL)) continue;
+
+        // read a page's worth of records at a time so the bulk of it moves via DMA.
+        uint8_t buf[RING_LOG_RECORD_SIZE * 16];
+        for (uint16_t i = 0; i < RING_LOG_RECORDS_PER_SECTOR; i++) {
+            uint8_t *record_bytes = buf + (i % 16) * RING_LOG_RECORD_SIZE;
+            if (i % 16 == 0) {
+                uint16_t records_left = RING_LOG_RECORDS_PER_SECTOR - i;
+                if (records_left > 16) records_left = 16;
+                spi_flash_read_data(_sector_address(sector) + RING_LOG_HEADER_SIZE + (uint32_t)i * RING_LOG_RECORD_SIZE, buf, records_left * RING_LOG_RECORD_SIZE);
+            }
+
+            if (record_bytes[0] == 0xFF) break;  // first empty slot ends the sector
+
+            ring_log_record_t record;
+            const uint8_t *payload;
+            if (!packed_record_decode(record_bytes, &record.type, &record.timestamp, &payload)) continue;  // torn or corrupted; skip
+            memcpy(record.data, payload, RING_LOG_PAYLOAD_SIZE);
+
+            if (!callback(&record, context)) return;
+        }
+    }
+}
+
+uint32_t ring_log_raw_size(void) {
+    return (uint32_t)RING_LOG_NUM_SECTORS * RING_LOG_SECTOR_SIZE;
+}
+
+bool ring_log_read_raw(uint32_t offset, void *buf, uint32_t length) {
+    if (!_mounted) return false;
+    if (offset > ring_log_raw_size() || length > ring_log_raw_size() - offset) return false;
+    return spi_flash_read_data((uint32_t)RING_LOG_FIRST_SECTOR * RING_LOG_SECTOR_SIZE + offset, buf, length);
+}
@@ -28,14 +28,24 @@
 
 #include "spiflash.h"
 
-#define SPI_FLASH_FAST_READ false
+// Use the 0x0B fast-read opcode: it costs one dummy byte up front, but unlike plain 0x03
+// it stays in spec if the bus clock is ever raised past the part's slow-read limit.
+#define SPI_FLASH_FAST_READ true
+
+// The GD25Q16 is rated well past anything the SERCOM can generate, so ask for the bus
+// ceiling; watch_spi_device_select caps the request at half the CPU clock.
+static const watch_spi_device_t flash_spi_device = {
+    .baud = 8000000,
+    .mode = 0,
+    .cs_pin = A3,
+};
 
 static void flash_enable(void) {
-    HAL_GPIO_A3_clr();
+    watch_spi_device_select(&flash_spi_device);
 }
 
 static void flash_disable(void) {
-    HAL_GPIO_A3_set();
+    watch_spi_device_deselect(&flash_spi_device);
 }
 
 static bool transfer(uint8_t *command, uint32_t command_length, uint8_t *data_in, uint8_t *data_out, uint32_t data_length) {
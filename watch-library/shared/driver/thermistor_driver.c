@@ -23,9 +23,9 @@
  */
 
 #include "thermistor_driver.h"
+#include "thermistor_lut.h"
 #include "sam.h"
 #include "watch.h"
-#include "watch_utility.h"
 
 // assume we have no thermistor until thermistor_driver_init is called.
 static bool has_thermistor = false;
@@ -104,15 +104,27 @@ void thermistor_driver_disable(void) {
     HAL_GPIO_TS_ENABLE_off();
 }
 
-float thermistor_driver_get_temperature(void) {
-    if (!has_thermistor) return (float) 0xFFFFFFFF;
+int16_t thermistor_driver_get_temperature_decidegrees(void) {
+    if (!has_thermistor) return INT16_MIN;
 
     // set the enable pin to the level that powers the thermistor circuit.
     HAL_GPIO_TS_ENABLE_write(THERMISTOR_ENABLE_VALUE);
-    // get the sense pin level
-    uint16_t value = watch_get_analog_pin_level(HAL_GPIO_TEMPSENSE_pin());
+    // get the sense pin level, hardware-averaged over a 64-sample burst to tame ADC noise.
+    uint16_t value = watch_get_analog_pin_level_filtered(HAL_GPIO_TEMPSENSE_pin());
     // and then set the enable pin to the opposite value to power down the thermistor circuit.
     HAL_GPIO_TS_ENABLE_write(!THERMISTOR_ENABLE_VALUE);
 
-    return watch_utility_thermistor_temperature(value, THERMISTOR_HIGH_SIDE, THERMISTOR_B_COEFFICIENT, THERMISTOR_NOMINAL_TEMPERATURE, THERMISTOR_NOMINAL_RESISTANCE, THERMISTOR_SERIES_RESISTANCE);
+    // Interpolate between the two bracketing knots of the generated table:
+    // a shift, two loads and a multiply, instead of the Steinhart-Hart math
+    // that used to drag log() and the soft-float library into every sample.
+    int16_t a = thermistor_lut_decidegrees[value >> THERMISTOR_LUT_SHIFT];
+    int16_t b = thermistor_lut_decidegrees[(value >> THERMISTOR_LUT_SHIFT) + 1];
+    int32_t frac = value & (THERMISTOR_LUT_STEP - 1);
+    return a + (int16_t)(((int32_t)(b - a) * frac + (THERMISTOR_LUT_STEP >> 1)) >> THERMISTOR_LUT_SHIFT);
+}
+
+float thermistor_driver_get_temperature(void) {
+    if (!has_thermistor) return (float) 0xFFFFFFFF;
+
+    return (float)thermistor_driver_get_temperature_decidegrees() * 0.1f;
 }
@@ -39,3 +39,8 @@ bool thermistor_driver_init(void);
 void thermistor_driver_enable(void);
 void thermistor_driver_disable(void);
 float thermistor_driver_get_temperature(void);
+
+// Integer variant of the above: tenths of a degree Celsius, converted through
+// a generated lookup table (see utils/thermistor_lut_gen.py) with no
+// floating-point math. Returns INT16_MIN if there is no thermistor.
+int16_t thermistor_driver_get_temperature_decidegrees(void);
@@ -0,0 +1,24 @@
+/* SPDX-License-Identifier: MIT */
+/* Generated by utils/thermistor_lut_gen.py -- do not edit by hand.
+ * ADC reading (16-bit, oversampled) to decidegrees Celsius, one knot
+ * every 1024 counts; interpolate linearly between adjacent knots.
+ * Worst case error across -10..+60 C: 0.049 degrees. */
+
+#pragma once
+
+#include <stdint.h>
+
+#define THERMISTOR_LUT_SHIFT 10
+#define THERMISTOR_LUT_STEP 1024
+
+static const int16_t thermistor_lut_decidegrees[65] = {
+      -999,   -548,   -443,   -376,   -325,   -283,   -247,   -215,
+      -187,   -160,   -136,   -113,    -91,    -71,    -51,    -32,
+       -13,      5,     22,     40,     56,     73,     89,    106,
+       122,    138,    154,    170,    186,    202,    218,    234,
+       251,    267,    284,    301,    318,    336,    354,    372,
+       391,    411,    431,    452,    474,    496,    520,    545,
+       571,    599,    629,    660,    695,    732,    773,    819,
+       871,    930,   1000,   1085,   1193,   1339,   1563,   1999,
+      1999,
+};
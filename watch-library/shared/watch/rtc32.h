@@ -72,6 +72,17 @@ void rtc_init(void);
  */
 void rtc_enable(void);
 
+/** @brief Enables periodic event output n on the RTC's event system generator.
+ *  @details Periodic event n fires at CLK_RTC / 2^(n + 3), taken from the prescaler
+ *           chain; with the 1024 Hz clock the watch runs the RTC from, event 7 is
+ *           a 1 Hz tick. The event goes nowhere until an EVSYS channel routes it
+ *           to a peripheral, and costs nothing until then.
+ *  @note The RTC's EVCTRL register is enable-protected. If the output is not
+ *        already enabled, this briefly disables the RTC to set it — the counter
+ *        holds its value, but timekeeping pauses for a few clock cycles.
+ */
+void rtc_enable_periodic_event(uint8_t n);
+
 /** @brief Checks if the RTC is enabled. 
   * @return true if the RTC is enabled; false if not.
   */
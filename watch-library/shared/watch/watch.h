@@ -61,6 +61,29 @@
  */
 typedef void (*watch_cb_t)(void);
 
+/** @brief Placement attribute for the hottest interrupt-path functions.
+  * @details Functions marked WATCH_RAMFUNC are copied into the .ramfunc RAM section at
+  *          startup and execute with zero wait states, where flash execution pays a wait
+  *          state at the boosted clock speeds. Reserve it for code that runs on every tick
+  *          or button edge; RAM is scarcer than flash. Build with NO_RAMFUNC=1 to keep
+  *          everything in flash if RAM gets tight.
+  */
+#if defined(__EMSCRIPTEN__) || defined(MOVEMENT_NO_RAMFUNC)
+#define WATCH_RAMFUNC
+#else
+#define WATCH_RAMFUNC __attribute__((section(".ramfunc")))
+#endif
+
+/** @brief Placement attribute for rarely-executed code: boot-time discovery, error paths.
+  * @details The compiler optimizes cold functions for size and groups them away from the
+  *          hot text, which improves cache and prefetch locality for everything else.
+  */
+#ifdef __EMSCRIPTEN__
+#define WATCH_COLDFUNC
+#else
+#define WATCH_COLDFUNC __attribute__((cold))
+#endif
+
 #include "watch_rtc.h"
 #include "watch_slcd.h"
 #include "watch_extint.h"
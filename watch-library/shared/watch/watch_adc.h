@@ -52,6 +52,18 @@ void watch_enable_analog_input(const uint16_t pin);
   **/
 uint16_t watch_get_analog_pin_level(const uint16_t pin);
 
+/** @brief Reads an analog value from one of the pins using hardware oversampling.
+  * @details Where watch_get_analog_pin_level takes the ADC's default measurement, this
+  *          triggers a single 64-sample burst that the ADC accumulates entirely in hardware,
+  *          with the CPU idling until the result-ready interrupt fires. The extra samples
+  *          average out the sample-to-sample noise that individual conversions pick up, so
+  *          this is the call to use for slow-moving signals like the thermistor divider.
+  * @param pin One of the analog pins, access using the HAL_GPIO_Ax_pin() macro.
+  * @return a 16-bit unsigned integer from 0-65535 representing the filtered value, in the
+  *         same scale as watch_get_analog_pin_level with the default settings.
+  **/
+uint16_t watch_get_analog_pin_level_filtered(const uint16_t pin);
+
 /** @brief Returns the voltage of the VCC supply in millivolts (i.e. 3000 mV == 3.0 V). If running on
   *        a coin cell, this will be the battery voltage. If the ADC is not running when this function
   *        is called, it enabled the ADC briefly, and returns it to the off state.
@@ -65,6 +77,51 @@ uint16_t watch_get_analog_pin_level(const uint16_t pin);
   */
 uint16_t watch_get_vcc_voltage(void);
 
+/** @brief Arms the ADC's window monitor to fire a callback the moment VCC sags below a threshold.
+  * @details Puts the ADC in free-running mode at its slowest clock, measuring VCC against the
+  *          internal reference, with the hardware window comparator checking every result — no
+  *          software polling, and the monitor keeps running in standby. The callback fires from
+  *          interrupt context the first time a result lands below the threshold; the monitor
+  *          disarms itself before calling it, so a sagging battery raises one event rather than
+  *          an interrupt storm. Re-arm from the callback (or later) to keep watching.
+  * @param threshold_millivolts The VCC level to watch for, in millivolts (i.e. 2400 == 2.4 V).
+  * @param callback The function to call when VCC first measures below the threshold.
+  * @note The monitor owns the ADC while armed: other ADC calls will disturb it, and the
+  *       free-running conversions cost some standby power. Arm it when the system is doing
+  *       something brownout-sensitive rather than leaving it on unconditionally.
+  */
+void watch_enable_vcc_monitor(uint16_t threshold_millivolts, watch_cb_t callback);
+
+/** @brief Disarms the VCC window monitor and shuts the ADC back down.
+  */
+void watch_disable_vcc_monitor(void);
+
+/** @brief Starts sampling an analog pin autonomously, with no CPU in the loop.
+  * @details Routes the RTC's 1 Hz periodic event through the event system to the ADC's
+  *          start trigger, so the ADC takes one conversion per second entirely in
+  *          hardware — the CPU stays asleep through the trigger, the conversion, and
+  *          everything but the brief result-ready interrupt that files the result.
+  *          Read the most recent result at any time with watch_get_background_sample;
+  *          it is never more than a second old and costs nothing to read.
+  * @param pin One of the analog pins, access using the HAL_GPIO_Ax_pin() macro.
+  * @note Like the VCC monitor, background sampling owns the ADC while enabled: other
+  *       ADC calls will disturb it. The ADC also keeps running in standby, which costs
+  *       some sleep power — use this while a sensor actually needs continuous data,
+  *       not as a default.
+  */
+void watch_enable_background_sampling(const uint16_t pin);
+
+/** @brief Fetches the most recent background sample.
+  * @param value Filled with the latest conversion result, in the same scale as
+  *        watch_get_analog_pin_level.
+  * @return false until the first conversion after enabling completes; true after.
+  */
+bool watch_get_background_sample(uint16_t *value);
+
+/** @brief Stops background sampling, unroutes the event channel, and shuts the ADC down.
+  */
+void watch_disable_background_sampling(void);
+
 /** @brief Disables the analog circuitry on the selected pin.
   * @param pin One of pins A0-A4.
   */
@@ -0,0 +1,68 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_boot_trace.h"
+#include "watch_rtc.h"
+
+static uint32_t _stamps[WATCH_BOOT_PHASE_COUNT];
+static uint8_t _marked; // bitmask; a counter of 0 is a legitimate stamp right after reset
+
+static const char *_names[WATCH_BOOT_PHASE_COUNT] = {
+    "reset", "filesystem", "settings", "display", "face setup", "first frame"
+};
+
+static const uint16_t _budgets_ms[WATCH_BOOT_PHASE_COUNT] = {
+    0, 150, 25, 60, 60, 30
+};
+
+void watch_boot_trace_mark(watch_boot_phase_t phase) {
+    if (phase >= WATCH_BOOT_PHASE_COUNT) return;
+    if (_marked & (1 << phase)) return;
+    _stamps[phase] = watch_rtc_get_counter();
+    _marked |= 1 << phase;
+}
+
+uint32_t watch_boot_trace_get(watch_boot_phase_t phase, bool *was_marked) {
+    if (phase >= WATCH_BOOT_PHASE_COUNT) {
+        if (was_marked) *was_marked = false;
+        return 0;
+    }
+    if (was_marked) *was_marked = (_marked & (1 << phase)) != 0;
+    return _stamps[phase];
+}
+
+const char *watch_boot_phase_name(watch_boot_phase_t phase) {
+    if (phase >= WATCH_BOOT_PHASE_COUNT) return "?";
+    return _names[phase];
+}
+
+uint16_t watch_boot_phase_budget_ms(watch_boot_phase_t phase) {
+    if (phase >= WATCH_BOOT_PHASE_COUNT) return 0;
+    return _budgets_ms[phase];
+}
+
+const uint32_t *watch_boot_trace_ptr(watch_boot_phase_t phase) {
+    if (phase >= WATCH_BOOT_PHASE_COUNT) phase = 0;
+    return &_stamps[phase];
+}
@@ -0,0 +1,79 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * BOOT PHASE TRACE
+ *
+ * RTC counter stamps for each phase of startup, recorded into a fixed RAM
+ * array so a slow boot can be broken down numerically instead of by feel.
+ * Each phase is stamped once per boot (later marks are ignored, so the wake
+ * path through app_setup cannot overwrite the boot record). Read the trace
+ * from the shell with `bootstat`, or page through the raw stamps on the
+ * wrist with the peek memory face.
+ *
+ * Budgets, in milliseconds from the previous phase, at 128 RTC ticks/s
+ * (so one tick is ~7.8 ms — phases well under a tick read as zero):
+ *
+ *   filesystem  150   littlefs mount, plus a format on first boot ever
+ *   settings     25   settings file read
+ *   display      60   LCD type probe and SLCD bring-up
+ *   face setup   60   active face setup + activate
+ *   first frame  30   first pass through app_loop
+ *
+ * A phase over budget is flagged in the bootstat output. The budgets are
+ * targets, not guarantees; first boot after a filesystem format will blow
+ * the filesystem budget and that is expected.
+ */
+
+typedef enum {
+    WATCH_BOOT_PHASE_RESET = 0,   // entry into app_init
+    WATCH_BOOT_PHASE_FILESYSTEM,  // littlefs mounted
+    WATCH_BOOT_PHASE_SETTINGS,    // settings loaded
+    WATCH_BOOT_PHASE_DISPLAY,     // LCD probed and enabled
+    WATCH_BOOT_PHASE_FACE_SETUP,  // active face set up and activated
+    WATCH_BOOT_PHASE_FIRST_FRAME, // first app_loop pass complete
+    WATCH_BOOT_PHASE_COUNT
+} watch_boot_phase_t;
+
+/** @brief Stamps a boot phase with the current RTC counter. First call per phase wins. */
+void watch_boot_trace_mark(watch_boot_phase_t phase);
+
+/** @brief The RTC counter value when the phase was stamped.
+  * @param was_marked Set to whether the phase has been stamped this boot; may be NULL.
+  */
+uint32_t watch_boot_trace_get(watch_boot_phase_t phase, bool *was_marked);
+
+/** @brief A short printable name for the phase, for the shell dump. */
+const char *watch_boot_phase_name(watch_boot_phase_t phase);
+
+/** @brief The phase's budget in milliseconds from the previous phase. */
+uint16_t watch_boot_phase_budget_ms(watch_boot_phase_t phase);
+
+/** @brief The address of one phase's stamp, for the peek memory face. */
+const uint32_t *watch_boot_trace_ptr(watch_boot_phase_t phase);
@@ -0,0 +1,67 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_bus.h"
+#include "watch_power.h"
+#include "watch.h"
+
+static uint8_t _claims[WATCH_BUS_COUNT];
+
+bool _watch_bus_claim(watch_bus_t bus) {
+    if (bus >= WATCH_BUS_COUNT) return false;
+    if (_claims[bus] == UINT8_MAX) return false; // saturate; the bus is already on
+    return _claims[bus]++ == 0;
+}
+
+bool _watch_bus_release(watch_bus_t bus) {
+    if (bus >= WATCH_BUS_COUNT) return false;
+    if (_claims[bus] == 0) return false; // unbalanced release; nothing to gate
+    if (_claims[bus] == UINT8_MAX) return false; // saturated counts never release
+    return --_claims[bus] == 0;
+}
+
+uint8_t _watch_bus_claim_count(watch_bus_t bus) {
+    if (bus >= WATCH_BUS_COUNT) return 0;
+    return _claims[bus];
+}
+
+void watch_gate_unclaimed_buses(void) {
+    watch_power_entry_t entry;
+
+    // A claim followed by the driver's own disable routes the force-gate through
+    // the normal 1 -> 0 release path, so the hardware shutdown stays in one place.
+    watch_power_get_entry(WATCH_POWER_I2C, &entry);
+    if (entry.enabled && _claims[WATCH_BUS_I2C] == 0) {
+        _watch_bus_claim(WATCH_BUS_I2C);
+        watch_disable_i2c();
+    }
+
+    watch_power_get_entry(WATCH_POWER_SPI, &entry);
+    if (entry.enabled && _claims[WATCH_BUS_SPI] == 0) {
+        _watch_bus_claim(WATCH_BUS_SPI);
+        watch_disable_spi();
+    }
+
+    // the UART has no disable call; once enabled it stays claimed.
+}
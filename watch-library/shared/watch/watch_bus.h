@@ -0,0 +1,72 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * SERCOM BUS CLAIM REGISTRY
+ *
+ * Reference counts for the shared serial buses. The watch_enable_* functions
+ * in watch_i2c/watch_spi/watch_uart claim the bus and only touch the hardware
+ * on the first claim; the watch_disable_* functions release it and only gate
+ * the hardware on the last release. This makes disabling a bus safe for code
+ * that shares it: a face shutting down "its" I2C no longer powers the bus out
+ * from under Movement's accelerometer.
+ *
+ * Claims saturate rather than wrap, so a caller that re-enables an already
+ * enabled bus (the old idempotent contract, which Movement's wake path still
+ * follows) never causes a spurious gate. The cost is that such a bus reads as
+ * permanently claimed, which is what a permanently enabled bus is.
+ *
+ * watch_gate_unclaimed_buses() is the idle sweep: Movement calls it on the way
+ * into low energy sleep to force-gate any bus whose clock was left running
+ * with no outstanding claims (an unbalanced release, or an enable that went
+ * around the watch_* wrappers).
+ */
+
+typedef enum {
+    WATCH_BUS_I2C = 0,
+    WATCH_BUS_SPI,
+    WATCH_BUS_UART,
+    WATCH_BUS_COUNT
+} watch_bus_t;
+
+/** @brief Called by the bus drivers' enable functions.
+  * @return true if this was the first claim and the caller should power the bus up.
+  */
+bool _watch_bus_claim(watch_bus_t bus);
+
+/** @brief Called by the bus drivers' disable functions.
+  * @return true if this was the last claim and the caller should gate the bus.
+  */
+bool _watch_bus_release(watch_bus_t bus);
+
+/** @brief The number of outstanding claims on a bus. */
+uint8_t _watch_bus_claim_count(watch_bus_t bus);
+
+/** @brief Force-gates any bus that is powered but has no outstanding claims. */
+void watch_gate_unclaimed_buses(void);
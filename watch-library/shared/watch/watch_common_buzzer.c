@@ -27,3 +27,13 @@
 // note: the buzzer uses a 1 MHz clock. these values were determined by dividing 1,000,000 by the target frequency.
 // i.e. for a 440 Hz tone (A4 on the piano), 1MHz/440Hz = 2273
 const uint16_t NotePeriods[108] = {18182,17161,16197,15288,14430,13620,12857,12134,11453,10811,10204,9631,9091,8581,8099,7645,7216,6811,6428,6068,5727,5405,5102,4816,4545,4290,4050,3822,3608,3405,3214,3034,2863,2703,2551,2408,2273,2145,2025,1911,1804,1703,1607,1517,1432,1351,1276,1204,1136,1073,1012,956,902,851,804,758,716,676,638,602,568,536,506,478,451,426,402,379,358,338,319,301,284,268,253,239,225,213,201,190,179,169,159,150,142,134,127};
+
+// Per-volume TCC compare values for each note, precomputed so that the note-transition
+// interrupt never has to derive a duty cycle at runtime. Row 0 is WATCH_BUZZER_VOLUME_909,858,809,764,721,681,642,606,572,540,510,481,454,429,404,382,360,340,321,303,286,270,255,240,227,214,202,191,180,170,160,151,143,135,127,120,113,107,101,95,90,85,80,75,71,67,63,60,56,53,50,47,45,42,40,37,35,33,31,30,28,26,25,23,22,21,20,18,17,16,15,15,14,13,12,11,11,10,10,9,8,8,7,7,7,6,6
+// (5 percent duty), row 1 is WATCH_BUZZER_VOLUME_4545,4290,4049,3822,3607,3405,3214,3033,2863,2702,2551,2407,2272,2145,2024,1911,1804,1702,1607,1517,1431,1351,1275,1204,1136,1072,1012,955,902,851,803,758,715,675,637,602,568,536,506,477,451,425,401,379,358,337,319,301,284,268,253,239,225,212,201,189,179,169,159,150,142,134,126,119,112,106,100,94,89,84,79,75,71,67,63,59,56,53,50,47,44,42,39,37,35,33,31 (25 percent); each entry is simply the
+// matching NotePeriods value divided down, i.e. the count the sequencer would otherwise
+// compute per note.
+const uint16_t NoteDutyCycles[2][108] = {
+    {909,858,809,764,721,681,642,606,572,540,510,481,454,429,404,382,360,340,321,303,286,270,255,240,227,214,202,191,180,170,160,151,143,135,127,120,113,107,101,95,90,85,80,75,71,67,63,60,56,53,50,47,45,42,40,37,35,33,31,30,28,26,25,23,22,21,20,18,17,16,15,15,14,13,12,11,11,10,10,9,8,8,7,7,7,6,6},
+    {4545,4290,4049,3822,3607,3405,3214,3033,2863,2702,2551,2407,2272,2145,2024,1911,1804,1702,1607,1517,1431,1351,1275,1204,1136,1072,1012,955,902,851,803,758,715,675,637,602,568,536,506,477,451,425,401,379,358,337,319,301,284,268,253,239,225,212,201,189,179,169,159,150,142,134,126,119,112,106,100,94,89,84,79,75,71,67,63,59,56,53,50,47,44,42,39,37,35,33,31},
+};
@@ -29,6 +29,26 @@
 #include <stdlib.h>
 #include <math.h>
 
+// Cached pointers into the const character set and display mapping tables for the
+// installed LCD, so the per-character path is two indexed loads instead of a branch
+// and a 32-byte mapping copy on every call. Refreshed if the detected LCD type changes.
+static watch_lcd_type_t _mapped_lcd_type = (watch_lcd_type_t)0xFF;
+static const digit_mapping_t *_display_mapping = Classic_LCD_Display_Mapping;
+static const uint8_t *_character_set = Classic_LCD_Character_Set;
+
+static inline void _watch_resolve_lcd_tables(void) {
+    watch_lcd_type_t lcd_type = watch_get_lcd_type();
+    if (lcd_type == _mapped_lcd_type) return;
+    _mapped_lcd_type = lcd_type;
+    if (lcd_type == WATCH_LCD_TYPE_CUSTOM) {
+        _display_mapping = Custom_LCD_Display_Mapping;
+        _character_set = Custom_LCD_Character_Set;
+    } else {
+        _display_mapping = Classic_LCD_Display_Mapping;
+        _character_set = Classic_LCD_Character_Set;
+    }
+}
+
 uint8_t IndicatorSegments[8] = {
     SLCD_SEGID(0, 17), // WATCH_INDICATOR_SIGNAL
     SLCD_SEGID(0, 16), // WATCH_INDICATOR_BELL
@@ -42,7 +62,28 @@ uint8_t IndicatorSegments[8] = {
     SLCD_SEGID(4, 0)   // WATCH_INDICATOR_COLON (does not exist, will set in SDATAL4 which is harmless)
 };
 
+// Last character committed to each display position; 0 means unknown. Characters are
+// compared before any of the per-position substitutions below, which are deterministic,
+// so an equal input character always produces identical segments.
+static uint8_t _displayed_characters[11];
+// Extra segments drawn on top of the character at each position (bit i = segment A+i),
+// set through watch_display_character_with_segments. Nonzero means the position holds
+// more than its character, so a plain character write must redraw to clear them.
+static uint8_t _displayed_extra_segments[11];
+bool _watch_display_character_in_progress;
+
+void watch_display_cache_invalidate(void) {
+    memset(_displayed_characters, 0, sizeof(_displayed_characters));
+}
+
 void watch_display_character(uint8_t character, uint8_t position) {
+    if (position < sizeof(_displayed_characters)) {
+        if (_displayed_characters[position] == character && _displayed_extra_segments[position] == 0) return;
+        _displayed_characters[position] = character;
+        _displayed_extra_segments[position] = 0;
+    }
+    _watch_display_character_in_progress = true;
+
     if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) {
         if (character == 'R' && position > 1 && position < 8) character = 'r'; // We can't display uppercase R in these positions
         else if (character == 'T' && position > 1 && position < 8) character = 't'; // lowercase t is the only option for these positions
@@ -86,27 +127,18 @@ void watch_display_character(uint8_t character, uint8_t position) {
         }
     }
 
-    digit_mapping_t segmap;
-    uint8_t segdata;
-
-    /// TODO: This could be optimized by doing this check once and setting a pointer in watch_discover_lcd_type.
-
-    if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) {
-        segmap = Custom_LCD_Display_Mapping[position];
-        segdata = Custom_LCD_Character_Set[character - 0x20];
-    } else {
-        segmap = Classic_LCD_Display_Mapping[position];
-        segdata = Classic_LCD_Character_Set[character - 0x20];
-    }
+    _watch_resolve_lcd_tables();
+    const digit_mapping_t *segmap = &_display_mapping[position];
+    uint8_t segdata = _character_set[character - 0x20];
 
     for (int i = 0; i < 8; i++) {
-        if (segmap.segment[i].value == segment_does_not_exist) {
+        if (segmap->segment[i].value == segment_does_not_exist) {
             // Segment does not exist; skip it.
             segdata = segdata >> 1;
             continue;
         }
-        uint8_t com = segmap.segment[i].address.com;
-        uint8_t seg = segmap.segment[i].address.seg;
+        uint8_t com = segmap->segment[i].address.com;
+        uint8_t seg = segmap->segment[i].address.seg;
 
         if (segdata & 1) {
             watch_set_pixel(com, seg);
@@ -121,32 +153,32 @@ void watch_display_character(uint8_t character, uint8_t position) {
     if (character == 'T' && position == 1) watch_set_pixel(1, 12); // add descender
     else if (position == 0 && (character == 'B' || character == 'D' || character == '@')) watch_set_pixel(0, 15); // add funky ninth segment
     else if (position == 1 && (character == 'B' || character == 'D' || character == '@')) watch_set_pixel(0, 12); // add funky ninth segment
+
+    _watch_display_character_in_progress = false;
 }
 
 void watch_display_character_lp_seconds(uint8_t character, uint8_t position) {
     // Will only work for digits and for positions  8 and 9 - but less code & checks to reduce power consumption
 
-    digit_mapping_t segmap;
-    uint8_t segdata;
-
-    /// TODO: See optimization note above.
-
-    if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) {
-        segmap = Custom_LCD_Display_Mapping[position];
-        segdata = Custom_LCD_Character_Set[character - 0x20];
-    } else {
-        segmap = Classic_LCD_Display_Mapping[position];
-        segdata = Classic_LCD_Character_Set[character - 0x20];
+    if (position < sizeof(_displayed_characters)) {
+        if (_displayed_characters[position] == character && _displayed_extra_segments[position] == 0) return;
+        _displayed_characters[position] = character;
+        _displayed_extra_segments[position] = 0;
     }
+    _watch_display_character_in_progress = true;
+
+    _watch_resolve_lcd_tables();
+    const digit_mapping_t *segmap = &_display_mapping[position];
+    uint8_t segdata = _character_set[character - 0x20];
 
     for (int i = 0; i < 8; i++) {
-        if (segmap.segment[i].value == segment_does_not_exist) {
+        if (segmap->segment[i].value == segment_does_not_exist) {
             // Segment does not exist; skip it.
             segdata = segdata >> 1;
             continue;
         }
-        uint8_t com = segmap.segment[i].address.com;
-        uint8_t seg = segmap.segment[i].address.seg;
+        uint8_t com = segmap->segment[i].address.com;
+        uint8_t seg = segmap->segment[i].address.seg;
 
         if (segdata & 1) {
             watch_set_pixel(com, seg);
@@ -157,6 +189,28 @@ void watch_display_character_lp_seconds(uint8_t character, uint8_t position) {
 
         segdata = segdata >> 1;
     }
+
+    _watch_display_character_in_progress = false;
+}
+
+void watch_display_character_with_segments(uint8_t character, uint8_t position, uint8_t segments) {
+    if (position < sizeof(_displayed_characters)) {
+        if (_displayed_characters[position] == character && _displayed_extra_segments[position] == segments) return;
+        // Force the character redraw; it clears whatever extra segments were set before.
+        _displayed_characters[position] = 0;
+    }
+    watch_display_character(character, position);
+    if (position < sizeof(_displayed_characters)) _displayed_extra_segments[position] = segments;
+
+    _watch_display_character_in_progress = true;
+    _watch_resolve_lcd_tables();
+    const digit_mapping_t *segmap = &_display_mapping[position];
+    for (int i = 0; i < 8; i++) {
+        if ((segments & (1 << i)) == 0) continue;
+        if (segmap->segment[i].value == segment_does_not_exist) continue;
+        watch_set_pixel(segmap->segment[i].address.com, segmap->segment[i].address.seg);
+    }
+    _watch_display_character_in_progress = false;
 }
 
 void watch_display_string(const char *string, uint8_t position) {
@@ -169,6 +223,7 @@ void watch_display_string(const char *string, uint8_t position) {
 }
 
 void watch_display_text(watch_position_t location, const char *string) {
+    watch_display_begin_frame();
     switch (location) {
         case WATCH_POSITION_TOP:
         case WATCH_POSITION_TOP_LEFT:
@@ -224,6 +279,7 @@ void watch_display_text(watch_position_t location, const char *string) {
                 else watch_display_character(' ', 10);
             }
     }
+    watch_display_commit_frame();
 }
 
 void watch_display_text_with_fallback(watch_position_t location, const char *string, const char *fallback) {
@@ -327,6 +383,153 @@ void watch_display_float_with_best_effort(float value, const char *units) {
     }
 }
 
+// Both digits of every value from 0 to 99, packed BCD. One table load replaces the
+// divide-by-ten (or its multiply-shift stand-in) in the hottest formatting path.
+static const uint8_t _two_digit_bcd[100] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+};
+
+void watch_format_two_digits(char *buf, uint8_t value, bool leading_zero) {
+    // out-of-contract values (the header says 0-99) must not index past the
+    // table; wrap to the low two digits instead. at most two subtractions.
+    while (value > 99) value -= 100;
+    uint8_t bcd = _two_digit_bcd[value];
+    buf[0] = (bcd < 0x10 && !leading_zero) ? ' ' : ('0' + (bcd >> 4));
+    buf[1] = '0' + (bcd & 0x0F);
+}
+
+void watch_display_u8(watch_position_t location, uint8_t value, bool leading_zero) {
+    char buf[3];
+    watch_format_two_digits(buf, value, leading_zero);
+    buf[2] = 0;
+    watch_display_text(location, buf);
+}
+
+// Cached value and ASCII digits for the seconds position, so the once-a-second update
+// is a BCD increment of the ones digit rather than a divide-and-format.
+static uint8_t _seconds_value = 0xFF;
+static char _seconds_digits[2];
+
+void watch_display_seconds(uint8_t seconds) {
+    if (seconds == _seconds_value) return;
+
+    if (_seconds_value != 0xFF && seconds == _seconds_value + 1 && _seconds_digits[1] != '9') {
+        // the common case: bump the ones digit, touch only position 9.
+        _seconds_digits[1]++;
+    } else {
+        // rollover, a skipped second, or first render: format both digits.
+        watch_format_two_digits(_seconds_digits, seconds, true);
+    }
+    _seconds_value = seconds;
+
+    watch_display_character_lp_seconds(_seconds_digits[0], 8);
+    watch_display_character_lp_seconds(_seconds_digits[1], 9);
+}
+
+void watch_display_hhmmss(uint8_t hours, uint8_t minutes, uint8_t seconds, bool leading_zero_hours) {
+    watch_display_begin_frame();
+    watch_display_u8(WATCH_POSITION_HOURS, hours, leading_zero_hours);
+    watch_display_u8(WATCH_POSITION_MINUTES, minutes, true);
+    watch_display_u8(WATCH_POSITION_SECONDS, seconds, true);
+    watch_display_commit_frame();
+}
+
+// Marquee state. There is exactly one scroller: only the active face draws, so starting
+// a new scroll replaces the previous one. We keep only a pointer into the caller's string
+// and render windows straight through the character path — no copies, no formatting.
+#define MARQUEE_GAP 2 // blank positions between the end of the string and its restart
+
+static const char *_marquee_string;
+static uint16_t _marquee_length;
+static int16_t _marquee_offset; // negative while holding the first frame on screen
+static uint8_t _marquee_hold_frames;
+static uint8_t _marquee_first_position;
+static uint8_t _marquee_num_positions;
+
+bool watch_display_scroll_start(watch_position_t location, const char *string, uint8_t hold_frames) {
+    uint8_t first;
+    uint8_t width;
+
+    switch (location) {
+        case WATCH_POSITION_TOP:
+        case WATCH_POSITION_TOP_LEFT:
+            first = 0;
+            width = 2;
+            break;
+        case WATCH_POSITION_TOP_RIGHT:
+            first = 2;
+            width = 2;
+            break;
+        case WATCH_POSITION_HOURS:
+            first = 4;
+            width = 2;
+            break;
+        case WATCH_POSITION_MINUTES:
+            first = 6;
+            width = 2;
+            break;
+        case WATCH_POSITION_SECONDS:
+            first = 8;
+            width = 2;
+            break;
+        case WATCH_POSITION_FULL:
+            first = 0;
+            width = 10;
+            break;
+        case WATCH_POSITION_BOTTOM:
+        default:
+            first = 4;
+            width = 6;
+            break;
+    }
+
+    return watch_display_scroll_start_at(first, width, string, hold_frames);
+}
+
+bool watch_display_scroll_start_at(uint8_t first_position, uint8_t num_positions, const char *string, uint8_t hold_frames) {
+    _marquee_string = string;
+    _marquee_length = strlen(string);
+    _marquee_first_position = first_position;
+    _marquee_num_positions = num_positions;
+    _marquee_hold_frames = hold_frames;
+    _marquee_offset = -(int16_t)hold_frames;
+
+    return watch_display_scroll_frame();
+}
+
+bool watch_display_scroll_frame(void) {
+    if (_marquee_string == NULL) return false;
+
+    uint16_t offset = (_marquee_offset > 0) ? _marquee_offset : 0;
+
+    watch_display_begin_frame();
+    for (uint8_t i = 0; i < _marquee_num_positions; i++) {
+        uint16_t index = offset + i;
+        if (_marquee_length > _marquee_num_positions) index %= _marquee_length + MARQUEE_GAP;
+        watch_display_character((index < _marquee_length) ? _marquee_string[index] : ' ', _marquee_first_position + i);
+    }
+    watch_display_commit_frame();
+
+    // a string that fits never animates; the shadow buffer makes repeat frames free.
+    if (_marquee_length <= _marquee_num_positions) return false;
+
+    if (++_marquee_offset >= (int16_t)(_marquee_length + MARQUEE_GAP)) _marquee_offset = -(int16_t)_marquee_hold_frames;
+    return true;
+}
+
+void watch_display_scroll_stop(void) {
+    _marquee_string = NULL;
+}
+
 void watch_set_colon(void) {
     if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) {
         watch_set_pixel(0, 0);
@@ -369,15 +572,30 @@ void watch_clear_indicator(watch_indicator_t indicator) {
     watch_clear_pixel(com, seg);
 }
 
+void watch_set_indicators(uint8_t mask) {
+    watch_display_begin_frame();
+    for (uint8_t i = 0; i <= WATCH_INDICATOR_COLON; i++) {
+        if (mask & (1 << i)) watch_set_indicator((watch_indicator_t)i);
+    }
+    watch_display_commit_frame();
+}
+
+void watch_clear_indicators(uint8_t mask) {
+    watch_display_begin_frame();
+    for (uint8_t i = 0; i <= WATCH_INDICATOR_COLON; i++) {
+        if (mask & (1 << i)) watch_clear_indicator((watch_indicator_t)i);
+    }
+    watch_display_commit_frame();
+}
+
 void watch_clear_all_indicators(void) {
-    /// TODO: Optimize this? Can be 3-4 writes to SDATAL registers
-    watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
-    watch_clear_indicator(WATCH_INDICATOR_BELL);
-    watch_clear_indicator(WATCH_INDICATOR_PM);
-    watch_clear_indicator(WATCH_INDICATOR_24H);
-    watch_clear_indicator(WATCH_INDICATOR_LAP);
-    watch_clear_indicator(WATCH_INDICATOR_ARROWS);
-    watch_clear_indicator(WATCH_INDICATOR_SLEEP);
+    watch_clear_indicators((1 << WATCH_INDICATOR_SIGNAL) |
+                           (1 << WATCH_INDICATOR_BELL) |
+                           (1 << WATCH_INDICATOR_PM) |
+                           (1 << WATCH_INDICATOR_24H) |
+                           (1 << WATCH_INDICATOR_LAP) |
+                           (1 << WATCH_INDICATOR_ARROWS) |
+                           (1 << WATCH_INDICATOR_SLEEP));
 }
 
 void _watch_update_indicator_segments(void) {
@@ -509,4 +509,20 @@ static const digit_mapping_t Classic_LCD_Display_Mapping[] = {
 void watch_display_character(uint8_t character, uint8_t position);
 void watch_display_character_lp_seconds(uint8_t character, uint8_t position);
 
+// Display a character with extra segments lit on top of it (bit i of segments is
+// segment A+i in the position's mapping). Goes through the shadow buffer like
+// watch_display_character, so redrawing the same character/segments combination is
+// free — use this instead of raw watch_set_pixel for custom glyphs like card faces,
+// which would otherwise invalidate the whole cache on every draw.
+void watch_display_character_with_segments(uint8_t character, uint8_t position, uint8_t segments);
+
+// The display path keeps a shadow buffer of the last character drawn at each position
+// and skips the segment writes when asked to redraw what is already on screen. Pixel
+// writes that bypass the display path (watch_set_pixel et al.) invalidate the shadow,
+// as does clearing the display.
+void watch_display_cache_invalidate(void);
+// Set while watch_display_character is writing its own segments, so those pixel writes
+// don't invalidate the shadow buffer.
+extern bool _watch_display_character_in_progress;
+
 void _watch_update_indicator_segments(void);
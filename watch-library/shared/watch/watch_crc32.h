@@ -0,0 +1,51 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** @addtogroup crc32 CRC-32
+  * @brief Standard CRC-32 (polynomial 0xEDB88320, the zlib/IEEE convention) over memory.
+  * @details On hardware the SAM L22's Device Service Unit computes the checksum over
+  *          word-aligned spans in hardware while the CPU waits, which makes integrity
+  *          checks on file transfers and logs close to free; unaligned head and tail
+  *          bytes go through a small bitwise fallback. The simulator computes the whole
+  *          thing in software. Results match zlib's crc32() for the same bytes.
+  */
+/// @{
+/** @brief Computes the CRC-32 of a buffer.
+  * @param data The bytes to checksum. Any alignment is fine.
+  * @param length The number of bytes.
+  */
+uint32_t watch_crc32(const void *data, size_t length);
+
+/** @brief Extends a running CRC-32 with more bytes, for data that arrives in chunks.
+  * @param crc The value returned by the previous call, or 0 to start.
+  * @param data The next chunk of bytes.
+  * @param length The number of bytes in this chunk.
+  */
+uint32_t watch_crc32_update(uint32_t crc, const void *data, size_t length);
+/// @}
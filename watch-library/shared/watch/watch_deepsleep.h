@@ -116,6 +116,29 @@ uint32_t watch_get_backup_data(uint8_t reg);
   */
 void watch_enter_sleep_mode(void);
 
+/** @brief Enters Sleep Mode like watch_enter_sleep_mode, but keeps the seconds display alive.
+  * @details Performs the same teardown as watch_enter_sleep_mode, then leaves a single 1 Hz
+  *          periodic interrupt enabled whose handler should repaint just the seconds digits
+  *          (watch_display_seconds or watch_display_character_lp_seconds). Each tick wakes the
+  *          CPU only long enough to run that handler; the expensive side of waking — peripheral
+  *          bring-up and the call to app_setup — is deferred until wake_needed first returns
+  *          true. The caller supplies that predicate to report whether a real wake source (a
+  *          button press, an alarm, a scheduled task) has left work for its run loop; the
+  *          once-a-second wakeups never call it back into the app.
+  * @param seconds_callback called from the RTC interrupt once a second while asleep.
+  * @param wake_needed checked whenever an interrupt wakes the CPU; return true to finish waking.
+  */
+void watch_enter_sleep_mode_keep_seconds(watch_cb_t seconds_callback, bool (*wake_needed)(void));
+
+/** @brief Enters STANDBY without disabling anything, and wakes on the next interrupt.
+  * @details Unlike watch_enter_sleep_mode, this performs no teardown: pins stay configured,
+  *          peripherals set to run in standby (the RTC, and TC0 plus the buzzer's TCC during
+  *          a note sequence) keep running, and app_setup is NOT re-run on wake. Movement uses
+  *          this to sleep through a chime started from low energy mode; it is not a substitute
+  *          for watch_enter_sleep_mode when the watch will be asleep for a long stretch.
+  */
+void watch_enter_standby_mode(void);
+
 /** @brief Enters the SAM L22's lowest-power mode, BACKUP.
   * @details This function does some housekeeping before entering BACKUP mode. It first disables all pins
   *          and peripherals except for the RTC, and disables the tick interrupt (since that would wake
@@ -67,4 +67,33 @@ void watch_disable_external_interrupts(void);
   */
 void watch_register_interrupt_callback(const uint8_t pin, watch_cb_t callback, eic_interrupt_trigger_t trigger);
 
+/// @brief Input conditioning options for an external interrupt pin.
+typedef enum {
+    /// Majority-vote filtering on the three button pins, no filtering elsewhere.
+    /// This is what watch_register_interrupt_callback has always done.
+    WATCH_INTERRUPT_FILTER_DEFAULT = 0,
+    /// The EIC samples the pin three times and takes a majority vote before
+    /// recognizing an edge, so contact bounce shorter than two filter clocks
+    /// never generates an interrupt at all. The right choice for mechanical
+    /// contacts, especially aging ones that have started to double-fire.
+    WATCH_INTERRUPT_FILTER_MAJORITY,
+    /// Asynchronous edge detection with no filtering: the edge is recognized
+    /// without waiting for a clock, giving the lowest latency and wake from
+    /// sleep modes where the EIC clock is stopped. The right choice for clean
+    /// push-pull signals like the accelerometer's interrupt lines.
+    WATCH_INTERRUPT_FILTER_ASYNC,
+} watch_interrupt_filter_t;
+
+/** @brief Configures an external interrupt callback with explicit input conditioning.
+  * @details Identical to watch_register_interrupt_callback, but lets the caller choose how the
+  *          EIC conditions the pin instead of inheriting the button/non-button default. Debouncing
+  *          in hardware this way is strictly cheaper than timestamp comparisons in the interrupt
+  *          handler: filtered-out bounces never wake the core in the first place.
+  * @param pin One of BTN_LIGHT, BTN_MODE, BTN_ALARM, A0, A1, A2, A3 or A4.
+  * @param callback The function you wish to have called when the interrupt triggers.
+  * @param trigger The condition on which you wish to trigger: rising, falling or both.
+  * @param filter The input conditioning to apply; see watch_interrupt_filter_t.
+  */
+void watch_register_interrupt_callback_with_filter(const uint8_t pin, watch_cb_t callback, eic_interrupt_trigger_t trigger, watch_interrupt_filter_t filter);
+
 /// @}
@@ -0,0 +1,79 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/** @addtogroup fault Crash Telemetry
+  * @brief Captures hard faults into a RAM ring that survives reset, so faults on
+  *        field units become diagnosable instead of just "it rebooted."
+  * @details A HardFault handler snapshots the faulting PC, LR and SP plus the
+  *          active watch face index into a small ring kept in a .noinit section:
+  *          it gets RAM like any other static but startup neither loads nor
+  *          zeroes it, so records ride through the reset the handler triggers.
+  *          After an actual power loss the ring holds garbage, which the
+  *          checksum check in watch_fault_init discards. Dump the ring from the
+  *          shell with `faultstat` and map the addresses against the .elf of
+  *          the installed build. The simulator records nothing; a crash there
+  *          lands in the browser console, which is a better tool anyway.
+  */
+/// @{
+
+#define WATCH_FAULT_RING_DEPTH 4
+
+typedef struct {
+    uint32_t pc;      ///< program counter pushed by the fault entry: the faulting instruction
+    uint32_t lr;      ///< link register at the fault: who called the faulting function
+    uint32_t sp;      ///< stack pointer at the fault, for spotting overflow (compare against _sstack)
+    uint16_t seq;     ///< 1-based fault sequence number since the last power loss
+    uint8_t face_idx; ///< watch face that was active when the fault hit
+    uint8_t reserved;
+} watch_fault_record_t;
+
+/** @brief Validates the fault ring after reset, discarding it if it holds power-on garbage.
+  *        Call once early in app_init.
+  */
+void watch_fault_init(void);
+
+/** @brief Tells the fault handler which watch face is active; Movement calls this on
+  *        every face switch.
+  */
+void watch_fault_set_context(uint8_t face_idx);
+
+/** @brief Returns the number of hard faults recorded since the last power loss.
+  *        Only the most recent WATCH_FAULT_RING_DEPTH of them still have records.
+  */
+uint32_t watch_fault_count(void);
+
+/** @brief Copies up to max records into out, newest first.
+  * @return the number of records copied.
+  */
+uint8_t watch_fault_get_records(watch_fault_record_t *out, uint8_t max);
+
+/** @brief Clears the ring and the fault count.
+  */
+void watch_fault_clear(void);
+
+/// @}
@@ -73,4 +73,37 @@ void watch_disable_digital_output(const uint8_t pin) __attribute__ ((deprecated(
   * @param level The level you wish to set: true for high, false for low.
   */
 void watch_set_pin_level(const uint8_t pin, const bool level) __attribute__ ((deprecated("Use HAL_GPIO_PIN_write() macro.")));
+
+// Port-wide batched operations. The single-pin functions above (and the HAL_GPIO
+// macros) each cost one store per pin; when a bring-up sequence touches several
+// pins on the same port, building a mask and issuing one store for all of them
+// shaves the difference off every wake window. Pins on this chip are numbered
+// with the port in the high bits, so these macros split a pin number into the
+// port and mask arguments the functions below expect.
+#define WATCH_PIN_PORT(pin) ((pin) >> 5)
+#define WATCH_PIN_MASK(pin) (1ul << ((pin) & 0x1F))
+
+/** @brief Drives every pin in the mask high with a single OUTSET store.
+  * @param port The port the pins live on: WATCH_PIN_PORT(pin).
+  * @param mask OR of WATCH_PIN_MASK(pin) for each pin to drive.
+  */
+void watch_set_pins(const uint8_t port, const uint32_t mask);
+
+/** @brief Drives every pin in the mask low with a single OUTCLR store. */
+void watch_clear_pins(const uint8_t port, const uint32_t mask);
+
+/** @brief Toggles every pin in the mask with a single OUTTGL store. */
+void watch_toggle_pins(const uint8_t port, const uint32_t mask);
+
+/** @brief Configures every pin in the mask as a digital output with a single DIRSET store.
+  * @note Unlike watch_enable_digital_output, this does not enable input readback on the
+  *       pins; use the single-pin call if you need to read an output's level back.
+  */
+void watch_enable_output_pins(const uint8_t port, const uint32_t mask);
+
+/** @brief Releases every pin in the mask from digital output with a single DIRCLR store. */
+void watch_disable_output_pins(const uint8_t port, const uint32_t mask);
+
+/** @brief Reads every pin in the mask at once; returns the port's IN value masked. */
+uint32_t watch_get_pins(const uint8_t port, const uint32_t mask);
 /// @}
@@ -41,6 +41,26 @@ void watch_enable_i2c(void);
   */
 void watch_disable_i2c(void);
 
+/// Bus clock rates for watch_i2c_set_speed.
+typedef enum {
+    WATCH_I2C_SPEED_STANDARD = 0, ///< 100 kHz; every I2C device supports this.
+    WATCH_I2C_SPEED_FAST,         ///< 400 kHz fast mode.
+} watch_i2c_speed_t;
+
+/** @brief Selects the bus clock rate for subsequent transfers.
+  * @param speed The rate the device about to be addressed supports; each driver declares its
+  *              device's capability in its header (e.g. LIS2DW_I2C_SPEED) and selects it before
+  *              touching the bus. The selection latches until another driver changes it, and
+  *              survives disabling and re-enabling the peripheral. Bus-on time is CPU-awake time
+  *              on this platform, so fast mode quarters the cost of FIFO drains and sensor reads.
+  * @note Only call between transfers; changing speed briefly cycles the SERCOM's enable bit.
+  */
+void watch_i2c_set_speed(watch_i2c_speed_t speed);
+
+/** @brief Returns the currently selected bus clock rate.
+  */
+watch_i2c_speed_t watch_i2c_get_speed(void);
+
 /** @brief Sends a series of values to a device on the I2C bus.
   * @param addr The address of the device you wish to talk to.
   * @param buf A series of unsigned bytes; the data you wish to transmit.
@@ -105,5 +125,34 @@ uint32_t watch_i2c_read24(int16_t addr, uint8_t reg);
           bit packing, you may need to shuffle some bits around.
   */
 uint32_t watch_i2c_read32(int16_t addr, uint8_t reg);
+
+/** @brief Callback type for asynchronous I2C transfers. Called from interrupt context with
+  *        0 on success, or a negative value if the device NACKed or the bus errored.
+  */
+typedef void (*watch_i2c_cb_t)(int8_t result);
+
+/** @brief Submits an asynchronous write-then-read transfer on the I2C bus.
+  * @details The blocking calls above busy-wait for every byte; this runs the transfer from
+  *          the SERCOM interrupt instead, so the core can sleep between bytes. Writes
+  *          tx_length bytes from tx_buf (if any), then — with a repeated start — reads
+  *          rx_length bytes into rx_buf (if any), then calls the callback. The callback
+  *          runs in interrupt context: typically it should just stash the result and set a
+  *          flag; the interrupt itself wakes the main loop, so the flag can be handled on
+  *          the next pass. Both buffers must remain valid until the callback fires.
+  * @param addr The address of the device you wish to talk to.
+  * @param tx_buf Bytes to write, or NULL if tx_length is 0.
+  * @param tx_length Number of bytes to write; pass 0 for a read-only transfer.
+  * @param rx_buf Buffer for bytes read, or NULL if rx_length is 0.
+  * @param rx_length Number of bytes to read; pass 0 for a write-only transfer.
+  * @param callback_on_complete Called when the transfer finishes or fails; may be NULL.
+  * @return True if the transfer was started, false if one is already in progress (or on
+  *         the simulator, where the transfer completes synchronously before returning).
+  */
+bool watch_i2c_submit(int16_t addr, const uint8_t *tx_buf, uint16_t tx_length, uint8_t *rx_buf, uint16_t rx_length, watch_i2c_cb_t callback_on_complete);
+
+/** @brief Returns true while an asynchronous transfer submitted with watch_i2c_submit is
+  *        still on the bus. Don't issue blocking I2C calls while this is true.
+  */
+bool watch_i2c_async_in_progress(void);
 /// @}
 #endif
@@ -0,0 +1,83 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_power.h"
+#include "watch_rtc.h"
+
+typedef struct {
+    uint32_t enable_count;
+    uint32_t on_ticks;
+    rtc_counter_t on_since; // counter value when the current stretch began
+    bool enabled;
+} watch_power_slot_t;
+
+static watch_power_slot_t _ledger[WATCH_POWER_PERIPHERAL_COUNT];
+
+static const char *_names[WATCH_POWER_PERIPHERAL_COUNT] = {
+    "ADC", "I2C", "SPI", "UART", "buzzer", "LED"
+};
+
+void watch_power_track_enable(watch_power_peripheral_t peripheral) {
+    if (peripheral >= WATCH_POWER_PERIPHERAL_COUNT) return;
+    watch_power_slot_t *slot = &_ledger[peripheral];
+    if (slot->enabled) return;
+    slot->enabled = true;
+    slot->enable_count++;
+    slot->on_since = watch_rtc_get_counter();
+}
+
+void watch_power_track_disable(watch_power_peripheral_t peripheral) {
+    if (peripheral >= WATCH_POWER_PERIPHERAL_COUNT) return;
+    watch_power_slot_t *slot = &_ledger[peripheral];
+    if (!slot->enabled) return;
+    slot->enabled = false;
+    slot->on_ticks += watch_rtc_get_counter() - slot->on_since;
+}
+
+void watch_power_get_entry(watch_power_peripheral_t peripheral, watch_power_entry_t *entry) {
+    entry->enable_count = 0;
+    entry->on_ticks = 0;
+    entry->enabled = false;
+    if (peripheral >= WATCH_POWER_PERIPHERAL_COUNT) return;
+    const watch_power_slot_t *slot = &_ledger[peripheral];
+    entry->enable_count = slot->enable_count;
+    entry->on_ticks = slot->on_ticks;
+    entry->enabled = slot->enabled;
+    if (slot->enabled) entry->on_ticks += watch_rtc_get_counter() - slot->on_since;
+}
+
+void watch_power_reset(void) {
+    rtc_counter_t now = watch_rtc_get_counter();
+    for (int i = 0; i < WATCH_POWER_PERIPHERAL_COUNT; i++) {
+        _ledger[i].enable_count = 0;
+        _ledger[i].on_ticks = 0;
+        // a peripheral that is on keeps accruing from this moment
+        _ledger[i].on_since = now;
+    }
+}
+
+const char *watch_power_peripheral_name(watch_power_peripheral_t peripheral) {
+    if (peripheral >= WATCH_POWER_PERIPHERAL_COUNT) return "?";
+    return _names[peripheral];
+}
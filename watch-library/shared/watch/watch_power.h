@@ -0,0 +1,76 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * POWER LEDGER
+ *
+ * Per-peripheral on-time accounting, timed against the RTC counter. Every
+ * power-relevant peripheral driver reports its enable/disable transitions
+ * here, so a unit in the field can say where its battery went: dump the
+ * ledger from the shell with the `powerstat` command, which also folds in
+ * CPU awake time from Movement's wake stats.
+ *
+ * The ledger lives in RAM, so it covers time since the last reset. That is
+ * the useful window anyway: a battery complaint is diagnosed by letting the
+ * watch run its usual rotation for a day and then reading the ledger, not
+ * by totals that mix in every firmware version since manufacture.
+ */
+
+typedef enum {
+    WATCH_POWER_ADC = 0,
+    WATCH_POWER_I2C,
+    WATCH_POWER_SPI,
+    WATCH_POWER_UART,
+    WATCH_POWER_BUZZER,
+    WATCH_POWER_LEDS,
+    WATCH_POWER_PERIPHERAL_COUNT
+} watch_power_peripheral_t;
+
+typedef struct {
+    uint32_t enable_count; // times the peripheral has been switched on
+    uint32_t on_ticks;     // RTC ticks spent enabled, including the current stretch if on
+    bool enabled;          // true if the peripheral is on right now
+} watch_power_entry_t;
+
+/** @brief Called by peripheral drivers when they power a peripheral up.
+  *        Idempotent: a second enable without an intervening disable is ignored.
+  */
+void watch_power_track_enable(watch_power_peripheral_t peripheral);
+
+/** @brief Called by peripheral drivers when they power a peripheral down. */
+void watch_power_track_disable(watch_power_peripheral_t peripheral);
+
+/** @brief Fetches one peripheral's ledger entry, with on_ticks current as of now. */
+void watch_power_get_entry(watch_power_peripheral_t peripheral, watch_power_entry_t *entry);
+
+/** @brief Zeroes all counters. Peripherals that are on stay on and resume accruing. */
+void watch_power_reset(void);
+
+/** @brief A short printable name for the peripheral, for the shell dump. */
+const char *watch_power_peripheral_name(watch_power_peripheral_t peripheral);
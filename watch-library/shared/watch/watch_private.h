@@ -32,7 +32,33 @@ void _watch_init(void);
 /// Called by main.c if plugged in to USB. You should not call this from your app.
 void _watch_enable_usb(void);
 
+// Precomputes the USB string descriptors (including the chip-ID serial number)
+// so enumeration serves finished buffers. _watch_enable_usb calls this before
+// attaching; hardware only, the simulator has no USB stack.
+void watch_usb_descriptors_build(void);
+
 /// Initializes the real-time clock peripheral. Implemented in watch_rtc.c
 void _watch_rtc_init(void);
 
+/// CPU speed levels for watch_request_cpu_speed, mapping onto the OSC16M's
+/// available frequencies.
+typedef enum {
+    WATCH_CPU_SPEED_4MHZ = 0,
+    WATCH_CPU_SPEED_8MHZ,
+    WATCH_CPU_SPEED_16MHZ,
+    WATCH_CPU_SPEED_COUNT
+} watch_cpu_speed_t;
+
+/** @brief Requests that the CPU run at least this fast. Requests are reference
+  *        counted per level; the core runs at the highest level with an outstanding
+  *        request, or at the 4 MHz baseline when there are none. Pair every request
+  *        with a watch_release_cpu_speed. The intended pattern is race-to-idle:
+  *        raise the clock around a compute-heavy stretch so it finishes in fewer
+  *        (cheaper) microseconds, then drop straight back down.
+  */
+void watch_request_cpu_speed(watch_cpu_speed_t speed);
+
+/** @brief Releases a previous watch_request_cpu_speed. An unbalanced release is ignored. */
+void watch_release_cpu_speed(watch_cpu_speed_t speed);
+
 #endif
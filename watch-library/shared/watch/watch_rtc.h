@@ -100,6 +100,17 @@ uint32_t watch_rtc_get_frequency(void);
  */
 uint32_t watch_rtc_get_ticks_per_minute(void);
 
+/** @brief Converts a span of RTC counter ticks to centiseconds.
+ *  @param ticks A difference between two values returned by watch_rtc_get_counter().
+ *  @return The duration of the span in hundredths of a second.
+ *  @details The counter is the watch's timekeeping reference: recording it at two instants and
+ *           converting the difference on demand is both more accurate and far cheaper than
+ *           accumulating elapsed time from tick events, and it works no matter how slowly (or
+ *           whether) the display refreshes in between. The counter runs at a power-of-two rate,
+ *           so this compiles to shifts — no division.
+ */
+uint32_t watch_rtc_counter_to_centiseconds(rtc_counter_t ticks);
+
 /** @brief Registers a callback that will be called when the RTC counter matches the target counter.
   * @param callback The function you wish to have called when the target counter is reached. If this value is NULL, the comp
   *                 interrupt will still be enabled, but no callback function will be called.
@@ -192,13 +203,45 @@ void watch_rtc_disable_matching_periodic_callbacks(uint8_t mask);
 void watch_rtc_disable_all_periodic_callbacks(void);
 
 /** @brief Enable/disable RTC while in-flight. This is quite dangerous operation, so we repeat writing register twice.
- * Used when temporarily pausing RTC when adjusting subsecond, which are not accessible otherwise.
+ * Prefer watch_rtc_phase_adjust for moving the clock by a fraction of a second: pausing the counter stalls
+ * every scheduled callback and drops ticks outright.
   */
 void watch_rtc_enable(bool en);
 
 /** @brief Adjusts frequency correction in single register write. Not waiting for syncronisation to save power - if you won't write new
  * correction value in the same ~millisecond - will not cause issue.
+ * @note This sets the baseline correction. If a phase slew is in flight, the slew's temporary offset
+ *       rides on top of the value written here and the register is restored to it when the slew ends.
   */
 void watch_rtc_freqcorr_write(int16_t value, int16_t sign);
 
+/** @brief Slews the clock phase by the given amount without stopping the RTC.
+  * @param milliseconds The adjustment to apply: positive values advance the clock, negative values retard it.
+  * @details Rather than pausing the counter, this pins the frequency correction register at the rail
+  *          in the needed direction and holds it there just long enough for the requested phase to
+  *          accumulate, then restores the baseline set by watch_rtc_freqcorr_write. The counter never
+  *          stops, so no tick or scheduled comp callback is missed and there is no observable glitch —
+  *          the displayed time simply drifts to its new phase. One correction step is 2^-20, so the
+  *          slew rate tops out around 121 microseconds per second of clock time; a 250 ms adjustment
+  *          completes in about 35 minutes. Adjustments requested while a slew is in flight are added
+  *          to the phase still owed, and residual error per call is on the order of a microsecond.
+  */
+void watch_rtc_phase_adjust(int32_t milliseconds);
+
+#ifdef __EMSCRIPTEN__
+/** @brief Simulator only: runs the virtual RTC at a multiple of real time for soak testing.
+  * @details At warp factor N, every real 128 Hz interval advances the virtual counter by N
+  *          ticks, delivering each tick's periodic and comp callbacks in counter order, so a
+  *          seven-day low energy timeout or a month of logging plays out in minutes with the
+  *          same scheduling decisions it would make at real speed. Callbacks that re-arm from
+  *          the app loop (like Movement's top-of-minute alarm) fire at most once per real
+  *          interval, since the app loop cannot interleave with the batch.
+  * @param factor Virtual ticks per real tick; 1 (or 0) returns to real time.
+  */
+void watch_rtc_set_time_warp(uint32_t factor);
+
+/** @brief Simulator only: the current time warp factor. */
+uint32_t watch_rtc_get_time_warp(void);
+#endif
+
 /// @}
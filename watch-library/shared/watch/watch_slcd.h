@@ -93,6 +93,16 @@ typedef enum {
   */
  watch_lcd_type_t watch_get_lcd_type(void);
 
+/** @brief Tells the display driver which backup register to use to cache the detected
+  *        LCD type across backup-domain resets.
+  * @details LCD autodetection blocks boot waiting on a button press. With a cache
+  *          register configured, the detection result is persisted and warm boots skip
+  *          the probe entirely; the probe only runs again after the backup domain loses
+  *          power (i.e. a battery swap with no other power source). Movement claims a
+  *          register for this at boot on autodetect builds. Pass 0 to disable caching.
+  */
+void watch_enable_lcd_type_cache(uint8_t backup_register);
+
 /** @brief Enables the Segment LCD display.
   * Call this before attempting to set pixels or display strings.
   */
@@ -116,6 +126,35 @@ void watch_set_pixel(uint8_t com, uint8_t seg);
   */
 void watch_clear_pixel(uint8_t com, uint8_t seg);
 
+/** @brief Begins accumulating display writes in a RAM shadow of the SLCD data registers.
+  * @details Between begin and commit, watch_set_pixel and watch_clear_pixel (and thus all
+  *          of the character display functions) update the shadow instead of performing a
+  *          read-modify-write on the hardware registers. Calls nest; only the outermost
+  *          commit flushes. On the simulator these are no-ops and writes go straight through.
+  */
+void watch_display_begin_frame(void);
+
+/** @brief Commits an accumulated frame, flushing only the changed 32-bit data words to the
+  *        SLCD hardware. A full redraw costs a handful of word stores instead of dozens of
+  *        read-modify-write cycles.
+  */
+void watch_display_commit_frame(void);
+
+/** @brief Captures the currently displayed frame into a snapshot buffer.
+  * @details Movement calls this on the way into low energy mode, before the active face
+  *          paints its sleep frame, so the last normal-mode frame survives the nap.
+  */
+void watch_display_snapshot(void);
+
+/** @brief Restores the frame captured by watch_display_snapshot to the display.
+  * @details Called first thing on the wake path: the wearer sees the familiar face at
+  *          SLCD refresh latency while the active face reactivates and repaints
+  *          underneath, instead of staring at the sleep frame until a slow activate
+  *          (littlefs mounts, sensor bring-up) finishes. On the simulator both calls
+  *          are no-ops; there is no perceptible wake latency to hide there.
+  */
+void watch_display_restore_snapshot(void);
+
 /** @brief Clears all segments of the display, including incicators and the colon.
   */
 void watch_clear_display(void);
@@ -195,6 +234,65 @@ void watch_display_text_with_fallback(watch_position_t location, const char *str
  */
 void watch_display_float_with_best_effort(float value, const char *units);
 
+/** @brief Formats a value from 0-99 as exactly two ASCII digits, without pulling in
+  *        division or printf: both digits come from one load of a packed BCD table.
+  *        Writes two characters and no terminator.
+  * @param buf Destination for the two characters.
+  * @param value The value to format. Values over 99 display as garbage; don't do that.
+  * @param leading_zero True to zero-pad single digit values, false to space-pad them.
+  */
+void watch_format_two_digits(char *buf, uint8_t value, bool leading_zero);
+
+/** @brief Displays a value from 0-99 at one of the two-character positions. This is the
+  *        fast path for numeric updates: no printf, no division, and unchanged digits
+  *        don't touch the hardware.
+  */
+void watch_display_u8(watch_position_t location, uint8_t value, bool leading_zero);
+
+/** @brief Displays the seconds value at positions 8-9. This is the per-second fast path:
+  *        the previous value's ASCII digits are cached, so the common increment case is a
+  *        BCD bump of the ones digit — no division, no formatting — and the digit shadow
+  *        ensures only the changed position's segments are written. Digits are drawn via
+  *        the low-power seconds path, so this is also safe from a low energy update.
+  */
+void watch_display_seconds(uint8_t seconds);
+
+/** @brief Displays a time of day across the hours, minutes and seconds positions.
+  * @param leading_zero_hours True to zero-pad a single digit hour (24h-with-leading-zero mode).
+  */
+void watch_display_hhmmss(uint8_t hours, uint8_t minutes, uint8_t seconds, bool leading_zero_hours);
+
+/** @brief Starts scrolling a string through one of the display positions.
+  * @details This is a shared marquee for text that doesn't fit its position. The display
+  *          keeps only a pointer to your string and an offset — no copies, no formatting —
+  *          so the string must remain valid (and unchanged) while it is scrolling. Call
+  *          watch_display_scroll_frame from your tick handler to advance by one character;
+  *          when the end of the string scrolls past, it wraps around after a short gap.
+  *          There is one marquee: starting a new scroll replaces any previous one.
+  * @param location The position to scroll through (most usefully WATCH_POSITION_BOTTOM).
+  * @param string The string to scroll. Must outlive the scroll; string literals and const
+  *               tables are ideal.
+  * @param hold_frames Number of extra frames to hold the start of the string on screen
+  *                    before scrolling begins (and again after each wraparound).
+  * @return True if the string is actually scrolling, false if it fit and was simply displayed.
+  */
+bool watch_display_scroll_start(watch_position_t location, const char *string, uint8_t hold_frames);
+
+/** @brief Starts scrolling a string through an explicit range of digit positions, for
+  *        layouts the standard positions can't express (e.g. skipping the hard-to-read
+  *        position 4 on the classic LCD). Same contract as watch_display_scroll_start.
+  */
+bool watch_display_scroll_start_at(uint8_t first_position, uint8_t num_positions, const char *string, uint8_t hold_frames);
+
+/** @brief Renders the next frame of a scroll started with watch_display_scroll_start.
+  * @return True if there is more to scroll, false if no scroll is active or the string fits.
+  */
+bool watch_display_scroll_frame(void);
+
+/** @brief Stops any active scroll. The display is left as the last frame drew it.
+  */
+void watch_display_scroll_stop(void);
+
 /** @brief Turns the colon segment on.
   */
 void watch_set_colon(void);
@@ -223,6 +321,21 @@ void watch_set_indicator(watch_indicator_t indicator);
   */
 void watch_clear_indicator(watch_indicator_t indicator);
 
+/** @brief Sets several indicators in a single display commit.
+  * @details Pass the bitwise OR of `1 << indicator` for each indicator you want on. The
+  *          segment changes are unioned inside one display frame, so reconfiguring several
+  *          indicators around a face activation costs one SLCD commit instead of one access
+  *          per indicator. Indicators whose bits are not set are left untouched.
+  * @param mask e.g. `(1 << WATCH_INDICATOR_BELL) | (1 << WATCH_INDICATOR_24H)`
+  */
+void watch_set_indicators(uint8_t mask);
+
+/** @brief Clears several indicators in a single display commit.
+  * @param mask the bitwise OR of `1 << indicator` for each indicator to turn off.
+  * @see watch_set_indicators
+  */
+void watch_clear_indicators(uint8_t mask);
+
 /** @brief Clears all indicator segments.
   * @see watch_indicator_t
   */
@@ -252,6 +365,30 @@ void watch_start_character_blink(char character, uint32_t duration);
   */
 void watch_start_indicator_blink_if_possible(watch_indicator_t indicator, uint32_t duration);
 
+/** @brief Blinks a single pixel autonomously in SLCD hardware, if the pixel supports it.
+  * @details The SAM L22 blink hardware can only blink pixels on segment lines 0 and 1
+  *          (any common), which covers the custom LCD's colon and outer indicators. The
+  *          blink costs zero CPU wakes; a face that only needs a blinking element can
+  *          combine this with movement_request_tick_frequency(0) and stop ticking
+  *          entirely. Replaces any blink that is already configured.
+  * @param com The common line of the pixel.
+  * @param seg The segment line of the pixel; must be 0 or 1.
+  * @param duration The blink cycle length in milliseconds.
+  * @return True if the hardware can blink this pixel, false if the caller must fall
+  *         back to toggling it from tick events.
+  */
+bool watch_start_pixel_blink_if_possible(uint8_t com, uint8_t seg, uint32_t duration);
+
+/** @brief Blinks the entire display autonomously in SLCD hardware.
+  * @details Every energized segment toggles on and off at the given rate with zero CPU
+  *          involvement, and keeps toggling in STANDBY. Meant for display self-test:
+  *          energize a test pattern, start the blink, and every segment line and common
+  *          can be verified at a glance while the core sleeps. Replaces any blink that
+  *          is already configured.
+  * @param duration The blink cycle length in milliseconds, from 50 to ~4250 ms.
+  */
+void watch_start_display_blink(uint32_t duration);
+
 /** @brief Stops and clears all blinking segments.
   * @details This will stop all blinking in position 7, and clear all segments in that digit.
   *          On the Pro LCD, this will also stop the blinking of all indicators.
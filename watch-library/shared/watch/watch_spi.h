@@ -41,6 +41,30 @@ void watch_enable_spi(void);
   */
 void watch_disable_spi(void);
 
+/// Describes a device on the SPI bus for watch_spi_device_select.
+typedef struct {
+    uint32_t baud;  ///< Bus clock in Hz while this device is selected. The SERCOM tops out at
+                    ///< half the CPU clock; a request beyond that is capped, so a fast part can
+                    ///< just ask for its rated maximum.
+    uint8_t mode;   ///< SPI mode 0-3 (CPOL << 1 | CPHA).
+    uint8_t cs_pin; ///< The device's active-low chip select pin.
+} watch_spi_device_t;
+
+/** @brief Asserts a device's chip select, reconfiguring the bus for it first if the previous
+  *        transfer belonged to a different device.
+  * @details Baud and mode register images are computed once per device and cached, so switching
+  *          devices costs a couple of stores around the SERCOM's enable cycle, and each device
+  *          runs at its own rated clock instead of the slowest part on the bus. Selecting the
+  *          same device twice in a row skips the reconfiguration entirely.
+  * @param device The descriptor of the device about to be addressed. Must point to storage that
+  *               outlives the transfer; a static const in the device's driver is the usual home.
+  */
+void watch_spi_device_select(const watch_spi_device_t *device);
+
+/** @brief Deasserts the device's chip select.
+  */
+void watch_spi_device_deselect(const watch_spi_device_t *device);
+
 /** @brief Writes a series of values to a device on the SPI bus.
   * @param buf A series of unsigned bytes; the data you wish to transmit.
   * @param length The number of bytes in buf that you wish to send.
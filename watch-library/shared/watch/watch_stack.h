@@ -0,0 +1,60 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @addtogroup stack Stack Watermark
+  * @brief Measures how much of the main stack has ever been used, so the stack can be
+  *        sized from evidence instead of guesswork.
+  * @details watch_stack_paint fills the unused portion of the stack with a known word at
+  *          boot; any call chain that runs afterward overwrites paint as deep as it goes,
+  *          and watch_stack_high_water reports the deepest overwrite seen so far. The
+  *          check is incremental — it only rescans words newly consumed since the last
+  *          call — so it is cheap enough to run after every watch face loop. Movement
+  *          does exactly that and keeps a per-face maximum; dump it from the shell with
+  *          `stackstat`. The simulator has no fixed stack to paint, so everything here
+  *          reports zero there.
+  */
+/// @{
+/** @brief Paints the unused stack below the current stack pointer. Call once, early in
+  *        boot; watermarks only account for calls made after this point.
+  */
+void watch_stack_paint(void);
+
+/** @brief The total size of the main stack in bytes, from the linker script. */
+uint32_t watch_stack_size(void);
+
+/** @brief The deepest stack usage observed since painting, in bytes from the top of the
+  *        stack. Returns 0 if the stack was never painted.
+  */
+uint32_t watch_stack_high_water(void);
+
+/** @brief True if the word at the very bottom of the stack has been overwritten — the
+  *        stack has likely overflowed into whatever lies below it.
+  */
+bool watch_stack_overflowed(void);
+/// @}
@@ -78,15 +78,19 @@ bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t
   * @param offset The offset from the beginning of the row. Must be a multiple of 64.
   * @param buffer The buffer containing the bytes you wish to set.
   * @param size The number of bytes you wish to write.
+  * @note Writes are coalesced in a one-row RAM buffer and may not reach the flash until
+  *       you call watch_storage_sync (or touch another row). Reads observe buffered data,
+  *       so this is only visible if power is lost before a sync.
   */
 bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size);
 
 /** @brief Erases a row in the storage area, setting all its bytes to 0xFF.
   * @param row The row you want to erase.
+  * @note A row that already reads fully erased is left alone, saving the erase cycle.
   */
 bool watch_storage_erase(uint32_t row);
 
-/** @brief Waits for any pending writes to complete.
+/** @brief Flushes any buffered writes to the flash and waits for them to complete.
   */
 bool watch_storage_sync(void);
 /// @}
@@ -178,6 +178,11 @@ void watch_buzzer_play_note_with_volume(watch_buzzer_note_t note, uint16_t durat
 /// @brief An array of periods for all the notes on a piano, corresponding to the names in watch_buzzer_note_t.
 extern const uint16_t NotePeriods[108];
 
+/// @brief Precomputed TCC compare values for each note at each watch_buzzer_volume_t level,
+///        indexed as NoteDutyCycles[volume][note]. Used by the buzzer sequencer so that note
+///        transitions program the peripheral straight from a table lookup.
+extern const uint16_t NoteDutyCycles[2][108];
+
 /** @brief Plays the given sequence of notes in a non-blocking way.
   * @param note_sequence A pointer to the sequence of buzzer note & duration tuples, ending with a zero. A simple
   *        RLE logic is implemented: a negative number instead of a buzzer note means that the sequence
@@ -191,7 +196,7 @@ extern const uint16_t NotePeriods[108];
   *       zero byte, which is used here as the end-of-sequence marker. But hey, a frequency that low cannot be
   *       played properly by the watch's buzzer, anyway.
   */
-void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void));
+void watch_buzzer_play_sequence(const int8_t *note_sequence, void (*callback_on_end)(void));
 
 /** @brief Plays the given sequence of notes in a non-blocking way.
   * @param note_sequence A pointer to the sequence of buzzer note & duration tuples, ending with a zero. A simple
@@ -203,7 +208,7 @@ void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(v
   * @param callback_on_end A pointer to a callback function to be invoked when the sequence has finished playing.
   * @param volume either WATCH_BUZZER_VOLUME_SOFT or WATCH_BUZZER_VOLUME_LOUD
   */
-void watch_buzzer_play_sequence_with_volume(int8_t *note_sequence, void (*callback_on_end)(void), watch_buzzer_volume_t volume);
+void watch_buzzer_play_sequence_with_volume(const int8_t *note_sequence, void (*callback_on_end)(void), watch_buzzer_volume_t volume);
 
 /** @brief Plays the given raw buzzer source function in a non-blocking way.
   *
@@ -315,6 +320,30 @@ void watch_set_led_yellow(void);
 /** @brief Turns both the red and the green LEDs off. */
 void watch_set_led_off(void);
 
+/** @brief Fades the LED from its current color to a target color over a duration.
+  * @details The fade runs inside the LED driver off the TCC's own overflow timing:
+  *          the PWM period is divided down to a ~125 Hz step rate and each step
+  *          interpolates the duty cycles toward the target. No Movement ticks are
+  *          involved, so a face can start a fade and go back to a 1 Hz tick (or let
+  *          the watch sleep) while the effect plays out. If the target is black, the
+  *          LEDs (and the TCC, if the buzzer is idle) are disabled on completion.
+  *          Starting another fade, or setting a color directly, cancels an in-flight
+  *          fade.
+  * @param red The target red value from 0-255.
+  * @param green The target green value from 0-255.
+  * @param blue The target blue value from 0-255 (ignored without a blue channel).
+  * @param duration_ms How long the fade should take, in milliseconds.
+  * @param callback_on_complete Called when the fade lands on the target, or NULL.
+  *                             Runs in interrupt context; keep it short.
+  */
+void watch_led_fade_to(uint8_t red, uint8_t green, uint8_t blue, uint16_t duration_ms, watch_cb_t callback_on_complete);
+
+/** @brief Returns true while an LED fade is in flight. */
+bool watch_led_fade_in_progress(void);
+
+/** @brief Cancels an in-flight fade, leaving the LED at whatever color it reached. */
+void watch_led_fade_abort(void);
+
 /// @brief An array of periods for all the notes on a piano, corresponding to the names in watch_buzzer_note_t.
 extern const uint16_t NotePeriods[108];
 
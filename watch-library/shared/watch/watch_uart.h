@@ -54,5 +54,57 @@ void watch_uart_puts(char *s);
   */
 size_t watch_uart_gets(char *data, size_t max_length);
 
+/** @brief Switches a SERCOM USART's receiver over to a DMA-fed circular buffer.
+  * @details The DMAC drains the receiver into the caller's ring buffer with no CPU
+  *          involvement, raising an interrupt (and waking the core) each time half the
+  *          ring fills. This keeps sustained reception reliable at higher baud rates
+  *          without polling; read the accumulated bytes with watch_uart_rx_dma_read().
+  *          While DMA owns the receiver, the driver's per-byte reads see no data.
+  *          On the simulator this is a no-op and reads return 0.
+  * @param sercom_instance The SERCOM instance number the UART was initialized on.
+  * @param buffer Caller-owned ring buffer; must outlive the DMA session.
+  * @param size Size of the ring buffer in bytes; must be even.
+  */
+void watch_uart_rx_dma_enable(uint8_t sercom_instance, uint8_t *buffer, size_t size);
+
+/** @brief Reads bytes accumulated by the DMA receive ring.
+  * @param data A pointer to a buffer where the received bytes will be stored.
+  * @param max_length The maximum number of bytes to read.
+  * @return The number of bytes actually read. If the ring overflowed between reads,
+  *         the oldest bytes are silently dropped.
+  */
+size_t watch_uart_rx_dma_read(uint8_t *data, size_t max_length);
+
+/** @brief Stops DMA reception and returns the receiver to normal operation.
+  */
+void watch_uart_rx_dma_disable(void);
+
+/** @brief Transmits a buffer over a SERCOM USART through the DMAC; the transmit twin of
+  *        watch_uart_rx_dma_enable().
+  * @details The DMAC feeds the transmitter one byte per data-register-empty trigger, so
+  *          the frame streams out at line rate with the core asleep and a single
+  *          interrupt at the end, rather than a poll per byte. The buffer must stay
+  *          untouched until the callback runs; note the callback fires when the last
+  *          byte is handed to the transmitter, which still holds roughly two byte times
+  *          of shifting before the line goes idle. If a previous frame is still in
+  *          flight this call waits for it first. On the simulator the data is dropped
+  *          and the callback runs before the call returns.
+  * @param sercom_instance The SERCOM instance number the UART was initialized on.
+  * @param data The bytes to transmit; caller-owned until the callback runs.
+  * @param length Number of bytes to transmit.
+  * @param callback Invoked from interrupt context on completion, or NULL.
+  * @return true if the frame is in flight, false if the call completed synchronously
+  *         (an empty buffer, or the simulator).
+  */
+bool watch_uart_tx_dma_write(uint8_t sercom_instance, const uint8_t *data, size_t length, void (*callback)(void));
+
+/** @brief True while a DMA transmit is still in flight.
+  */
+bool watch_uart_tx_dma_busy(void);
+
+/** @brief Spins until any in-flight DMA transmit completes.
+  */
+void watch_uart_tx_dma_wait(void);
+
 /// @}
 #endif
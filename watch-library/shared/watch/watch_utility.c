@@ -109,80 +109,50 @@ uint16_t watch_utility_days_since_new_year(uint16_t year, uint8_t month, uint8_t
     return (is_leap(year) && (month > 2) ? 1 : 0) + DAYS_SO_FAR[month - 1] + day;
 }
 
-// Function taken from `src/time/__year_to_secs.c` of musl libc
-// https://musl.libc.org
-static uint32_t __year_to_secs(uint32_t year, int *is_leap)
-{
-	if (year-2ULL <= 136) {
-		int y = year;
-		int leaps = (y-68)>>2;
-		if (!((y-68)&3)) {
-			leaps--;
-			if (is_leap) *is_leap = 1;
-		} else if (is_leap) *is_leap = 0;
-		return 31536000*(y-70) + 86400*leaps;
-	}
-
-	int cycles, centuries, leaps, rem, dummy;
+// Thumb-1 has no divide instruction, so every division below would otherwise
+// become a call into the runtime's bit-at-a-time division loop — hundreds of
+// cycles, and some faces convert a timestamp every second. For the constant
+// divisors in the date/time conversions we multiply by a precomputed
+// reciprocal instead: floor((n * ceil(2^s / d)) / 2^s) == n / d for every n
+// below the bound noted on each helper, verified by exhaustive search.
+
+// Exact for all 32-bit n: 86400 = 128 * 675, and (n / 128) / 675 == n / 86400.
+static inline uint32_t _div_86400(uint32_t n) {
+    return (uint32_t)((((uint64_t)(n >> 7)) * 3257812231ull) >> 41);
+}
 
-	if (!is_leap) is_leap = &dummy;
-	cycles = (year-100) / 400;
-	rem = (year-100) % 400;
-	if (rem < 0) {
-		cycles--;
-		rem += 400;
-	}
-	if (!rem) {
-		*is_leap = 1;
-		centuries = 0;
-		leaps = 0;
-	} else {
-		if (rem >= 200) {
-			if (rem >= 300) centuries = 3, rem -= 300;
-			else centuries = 2, rem -= 200;
-		} else {
-			if (rem >= 100) centuries = 1, rem -= 100;
-			else centuries = 0;
-		}
-		if (!rem) {
-			*is_leap = 0;
-			leaps = 0;
-		} else {
-			leaps = rem / 4U;
-			rem %= 4U;
-			*is_leap = !rem;
-		}
-	}
+// Exact for n < 86400 (seconds within a day).
+static inline uint32_t _div_3600(uint32_t n) {
+    return (uint32_t)(((uint64_t)n * 1193047ull) >> 32);
+}
 
-	leaps += 97*cycles + 24*centuries - *is_leap;
+// Exact for n < 3600 (seconds within an hour).
+static inline uint32_t _div_60(uint32_t n) {
+    return (uint32_t)(((uint64_t)n * 71582789ull) >> 32);
+}
 
-	return (year-100) * 31536000LL + leaps * 86400LL + 946684800 + 86400;
+// Exact for n < 49711 (days representable in a 32-bit unix time).
+static inline uint32_t _div_1461(uint32_t n) {
+    return (uint32_t)(((uint64_t)n * 2939745ull) >> 32);
 }
 
-// Function taken from `src/time/__month_to_secs.c` of musl libc
-// https://musl.libc.org
-static int __month_to_secs(int month, int is_leap)
-{
-	static const int secs_through_month[] = {
-		0, 31*86400, 59*86400, 90*86400,
-		120*86400, 151*86400, 181*86400, 212*86400,
-		243*86400, 273*86400, 304*86400, 334*86400 };
-	int t = secs_through_month[month];
-	if (is_leap && month >= 2) t+=86400;
-	return t;
+// Exact for n < 1461 (days within a four-year cycle).
+static inline uint32_t _div_365(uint32_t n) {
+    return (uint32_t)(((uint64_t)n * 11767034ull) >> 32);
 }
 
-// Function adapted from `src/time/__tm_to_secs.c` of musl libc
-// https://musl.libc.org
 uint32_t watch_utility_convert_to_unix_time(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second, int32_t utc_offset) {
-    int is_leap;
-
-    // POSIX tm struct starts year at 1900 and month at 0
-    // https://pubs.opengroup.org/onlinepubs/9699919799/basedefs/time.h.html 
-    uint32_t timestamp = __year_to_secs(year - 1900, &is_leap);
-    timestamp += __month_to_secs(month - 1, is_leap);
-
-    // Regular conversion from musl libc
+    static const uint32_t secs_through_month[] = {
+        0, 31*86400, 59*86400, 90*86400,
+        120*86400, 151*86400, 181*86400, 212*86400,
+        243*86400, 273*86400, 304*86400, 334*86400 };
+
+    // Leap years are every fourth year from 1972 through 2096: the century
+    // exception doesn't kick in until 2100, well past the RTC's 2083 cap, so
+    // counting leap days needs no division by 100 or 400.
+    uint32_t timestamp = (year - 1970) * 31536000u + ((year - 1969) >> 2) * 86400u;
+    timestamp += secs_through_month[month - 1];
+    if ((year & 3) == 0 && month > 2) timestamp += 86400;
     timestamp += (day - 1) * 86400;
     timestamp += hour * 3600;
     timestamp += minute * 60;
@@ -196,6 +166,18 @@ uint32_t watch_utility_date_time_to_unix_time(watch_date_time_t date_time, int32
     return watch_utility_convert_to_unix_time(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second, utc_offset);
 }
 
+uint32_t watch_utility_convert_to_epoch_day(uint16_t year, uint8_t month, uint8_t day) {
+    static const uint16_t days_through_month[] = {
+        0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+
+    // Same closed form as watch_utility_convert_to_unix_time, counting days
+    // instead of seconds; valid through 2099 for the same century-rule reason.
+    uint32_t days = (year - 1970) * 365u + ((year - 1969) >> 2);
+    days += days_through_month[month - 1];
+    if ((year & 3) == 0 && month > 2) days += 1;
+    return days + day - 1;
+}
+
 #define LEAPOCH (946684800LL + 86400*(31+29))
 
 #define DAYS_PER_400Y (365*400 + 97)
@@ -205,50 +187,32 @@ uint32_t watch_utility_date_time_to_unix_time(watch_date_time_t date_time, int32
 watch_date_time_t watch_utility_date_time_from_unix_time(uint32_t timestamp, int32_t utc_offset) {
     watch_date_time_t retval;
     retval.reg = 0;
-    uint32_t secs;
-    int32_t days;
-    int32_t remdays, remsecs, remyears;
-    int32_t qc_cycles, c_cycles, q_cycles;
-    int32_t years, months;
-    int32_t wday, yday, leap;
-    static const int8_t days_in_month[] = {31,30,31,30,31,31,30,31,30,31,31,29};
+    uint32_t secs, days, remdays, remsecs, remyears;
+    uint32_t c_cycles, q_cycles;
+    uint32_t years, months, hour, minute;
+    static const uint8_t days_in_month[] = {31,30,31,30,31,31,30,31,30,31,31,29};
     timestamp += utc_offset;
 
     secs = timestamp - LEAPOCH;
-    days = secs / 86400;
-    remsecs = secs % 86400;
-    if (remsecs < 0) {
-        remsecs += 86400;
-        days--;
-    }
-
-    wday = (3+days)%7;
-    if (wday < 0) wday += 7;
-
-    qc_cycles = (int)(days / DAYS_PER_400Y);
-    remdays = days % DAYS_PER_400Y;
-    if (remdays < 0) {
-        remdays += DAYS_PER_400Y;
-        qc_cycles--;
-    }
-
-    c_cycles = remdays / DAYS_PER_100Y;
-    if (c_cycles == 4) c_cycles--;
-    remdays -= c_cycles * DAYS_PER_100Y;
-
-    q_cycles = remdays / DAYS_PER_4Y;
-    if (q_cycles == 25) q_cycles--;
+    days = _div_86400(secs);
+    remsecs = secs - days * 86400;
+
+    // A 32-bit unix time tops out at 49710 days past the leapoch: less than
+    // one 400-year cycle and less than two centuries, so musl's generic cycle
+    // breakdown collapses to a single comparison for the century. Timestamps
+    // before the leapoch wrap around to huge day counts and fall out through
+    // the year range check below, same as before.
+    c_cycles = (days >= DAYS_PER_100Y) ? 1 : 0;
+    remdays = days - c_cycles * DAYS_PER_100Y;
+
+    q_cycles = _div_1461(remdays);
     remdays -= q_cycles * DAYS_PER_4Y;
 
-    remyears = remdays / 365;
+    remyears = _div_365(remdays);
     if (remyears == 4) remyears--;
     remdays -= remyears * 365;
 
-    leap = !remyears && (q_cycles || !c_cycles);
-    yday = remdays + 31 + 28 + leap;
-    if (yday >= 365+leap) yday -= 365+leap;
-
-    years = remyears + 4*q_cycles + 100*c_cycles + 400*qc_cycles;
+    years = remyears + 4*q_cycles + 100*c_cycles;
 
     for (months=0; days_in_month[months] <= remdays; months++)
         remdays -= days_in_month[months];
@@ -266,9 +230,12 @@ watch_date_time_t watch_utility_date_time_from_unix_time(uint32_t timestamp, int
     retval.unit.month = months + 1;
     retval.unit.day = remdays + 1;
 
-    retval.unit.hour = remsecs / 3600;
-    retval.unit.minute = remsecs / 60 % 60;
-    retval.unit.second = remsecs % 60;
+    hour = _div_3600(remsecs);
+    remsecs -= hour * 3600;
+    minute = _div_60(remsecs);
+    retval.unit.hour = hour;
+    retval.unit.minute = minute;
+    retval.unit.second = remsecs - minute * 60;
 
     return retval;
 }
@@ -285,10 +252,12 @@ uint32_t watch_utility_unix_time_convert_zone(uint32_t timestamp, uint32_t origi
 watch_duration_t watch_utility_seconds_to_duration(uint32_t seconds) {
     watch_duration_t retval;
 
-    retval.seconds = (seconds % 60);
-    retval.minutes = (seconds % 3600) / 60;
-    retval.hours = (seconds % 86400) / 3600;
-    retval.days = seconds / 86400;
+    retval.days = _div_86400(seconds);
+    seconds -= retval.days * 86400;
+    retval.hours = _div_3600(seconds);
+    seconds -= retval.hours * 3600;
+    retval.minutes = _div_60(seconds);
+    retval.seconds = seconds - retval.minutes * 60;
 
     return retval;
 }
@@ -336,6 +305,40 @@ uint8_t watch_utility_days_in_month(uint8_t month, uint16_t year) {
     return days;
 }
 
+watch_date_time_t watch_utility_date_time_advance_day(watch_date_time_t date_time) {
+    if (date_time.unit.day < watch_utility_days_in_month(date_time.unit.month, date_time.unit.year + WATCH_RTC_REFERENCE_YEAR)) {
+        date_time.unit.day++;
+    } else {
+        date_time.unit.day = 1;
+        if (date_time.unit.month < 12) {
+            date_time.unit.month++;
+        } else {
+            date_time.unit.month = 1;
+            date_time.unit.year++;
+        }
+    }
+    return date_time;
+}
+
+watch_date_time_t watch_utility_date_time_advance_second(watch_date_time_t date_time) {
+    if (date_time.unit.second < 59) {
+        date_time.unit.second++;
+        return date_time;
+    }
+    date_time.unit.second = 0;
+    if (date_time.unit.minute < 59) {
+        date_time.unit.minute++;
+        return date_time;
+    }
+    date_time.unit.minute = 0;
+    if (date_time.unit.hour < 23) {
+        date_time.unit.hour++;
+        return date_time;
+    }
+    date_time.unit.hour = 0;
+    return watch_utility_date_time_advance_day(date_time);
+}
+
 char _scratch_timezone[7] = {0};
 
 char *watch_utility_time_zone_name_at_index(int32_t tzindex) {
@@ -403,3 +406,80 @@ char *watch_utility_time_zone_name_at_index(int32_t tzindex) {
     }
     return _scratch_timezone;
 }
+
+// implemented in watch_private.c on both hardware (TRNG) and simulator (crypto.getRandomValues)
+int getentropy(void *buf, size_t buflen);
+
+static uint32_t _watch_utility_prng_state;
+
+uint32_t watch_utility_random(void) {
+    uint32_t x = _watch_utility_prng_state;
+    if (x == 0) {
+        // first draw since boot: take one word of true entropy and mix in the RTC counter.
+        getentropy(&x, sizeof(x));
+        x ^= watch_rtc_get_counter();
+        if (x == 0) x = 0x6C078965;  // xorshift32 state must never be zero
+    }
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    _watch_utility_prng_state = x;
+    return x;
+}
+
+uint32_t watch_utility_random_uniform(uint32_t max) {
+    // Lemire's nearly-divisionless bounded reduction: the multiply-shift maps a
+    // 32-bit draw onto [0, max), and draws landing in the short final stripe are
+    // redrawn so every outcome is exactly equally likely. The debiasing test is a
+    // single compare that passes with probability under max / 2^32, so the modulo
+    // behind it is effectively never executed for dice-sized ranges.
+    uint64_t m = (uint64_t)watch_utility_random() * (uint64_t)max;
+    if ((uint32_t)m < max) {
+        uint32_t threshold = (uint32_t)(0 - max) % max;
+        while ((uint32_t)m < threshold) {
+            m = (uint64_t)watch_utility_random() * (uint64_t)max;
+        }
+    }
+    return (uint32_t)(m >> 32);
+}
+
+// One step of double dabble: add 3 to every BCD nibble that is 5 or more, so the
+// following left shift carries it into the next decade. Branchless: nibble + 3
+// sets bit 3 exactly when the nibble was >= 5, and (8 >> 3) | (8 >> 2) turns each
+// of those flags back into a 3 in place.
+static uint32_t _dabble(uint32_t bcd) {
+    uint32_t adjust = (bcd + 0x33333333) & 0x88888888;
+    return bcd + ((adjust >> 3) | (adjust >> 2));
+}
+
+uint8_t watch_utility_format_decimal(char *buf, uint32_t value, uint8_t min_digits) {
+    // 10 BCD digits split across two words, most significant nibble first.
+    uint32_t hi = 0;
+    uint32_t lo = 0;
+
+    for (uint8_t bit = 0; bit < 32; bit++) {
+        hi = _dabble(hi);
+        lo = _dabble(lo);
+        hi = (hi << 1) | (lo >> 31);
+        lo = (lo << 1) | (value >> 31);
+        value <<= 1;
+    }
+
+    if (min_digits < 1) min_digits = 1;
+    if (min_digits > 10) min_digits = 10;
+
+    uint8_t len = 10;
+    while (len > min_digits) {
+        uint8_t digit = len <= 8 ? (lo >> ((len - 1) * 4)) & 0xF : (hi >> ((len - 9) * 4)) & 0xF;
+        if (digit) break;
+        len--;
+    }
+
+    for (uint8_t i = 0; i < len; i++) {
+        uint8_t place = len - 1 - i;
+        buf[i] = '0' + (place < 8 ? (lo >> (place * 4)) & 0xF : (hi >> ((place - 8) * 4)) & 0xF);
+    }
+    buf[len] = 0;
+
+    return len;
+}
@@ -104,6 +104,17 @@ uint32_t watch_utility_convert_to_unix_time(uint16_t year, uint8_t month, uint8_
   */
 uint32_t watch_utility_date_time_to_unix_time(watch_date_time_t date_time, int32_t utc_offset);
 
+/** @brief Returns the number of whole days between a calendar date and the UNIX epoch.
+  * @param year The year of the date, e.g. 2022
+  * @param month The month of the date (1-12)
+  * @param day The day of the date (1-31)
+  * @return The count of days since January 1, 1970. Dividing a unix timestamp by 86400
+  *         yields the same value for the same date, but this never touches seconds, so
+  *         day-count complications can compare dates with a single subtraction.
+  * @note Valid for dates from 1970 through 2099.
+  */
+uint32_t watch_utility_convert_to_epoch_day(uint16_t year, uint8_t month, uint8_t day);
+
 /** @brief Converts a duration in seconds to a watch_duration_t struct.
   * @param seconds A positive number of seconds that you wish to convert to a formatted duration.
   * @return A populated struct with the number of days, hours, minutes and seconds elapsed.
@@ -189,4 +200,47 @@ uint8_t watch_utility_days_in_month(uint8_t month, uint16_t year);
  */
 char * watch_utility_time_zone_name_at_index(int32_t tzindex);
 
+/** @brief Advances a date/time by one calendar day, rolling over months and years as needed.
+  * @param date_time A valid watch_date_time_t.
+  * @return The same time of day on the following date.
+  * @note Much cheaper than a round trip through unix time. Faces that step through consecutive
+  *       dates (deadlines, day counts, tomorrow's sunrise) should prefer this over recomputing.
+  */
+watch_date_time_t watch_utility_date_time_advance_day(watch_date_time_t date_time);
+
+/** @brief Advances a date/time by one second, rolling over minutes, hours and dates as needed.
+  * @param date_time A valid watch_date_time_t.
+  * @return The date/time one second later.
+  * @note For faces that display a ticking time: keep the previous tick's date/time around and
+  *       advance it, rather than converting a fresh unix timestamp every second.
+  */
+watch_date_time_t watch_utility_date_time_advance_second(watch_date_time_t date_time);
+
+/** @brief Returns a pseudo-random 32-bit value from a shared xorshift32 generator.
+  * @details Seeded once per boot from the TRNG (mixed with the RTC counter); after that each
+  *          draw is three shifts and three XORs. Much cheaper in flash and cycles than the
+  *          arc4random machinery, and one implementation shared by every face that rolls dice,
+  *          deals cards or draws obstacles.
+  */
+uint32_t watch_utility_random(void);
+
+/** @brief Returns a pseudo-random value in the range [0, max).
+  * @param max One past the largest value to return. Must be nonzero.
+  * @note Reduces by multiply-and-shift rather than modulo, with Lemire's debiasing
+  *       rejection, so rolls are exactly uniform and the common path never divides.
+  */
+uint32_t watch_utility_random_uniform(uint32_t max);
+
+/** @brief Formats an unsigned value as decimal ASCII without division.
+  * @param buf Receives the digits plus a NUL terminator; must hold at least 11 bytes.
+  * @param value The value to format.
+  * @param min_digits Pad with leading zeros up to this many digits (1-10).
+  * @return The number of characters written, excluding the terminator.
+  * @note Converts by double dabble — shifts and adds only — where the printf family
+  *       leans on the divide-and-remainder helpers the Cortex M0+ lacks in hardware.
+  *       High-rate numeric displays (the RTC counter face at 128 Hz) should prefer
+  *       this over snprintf.
+  */
+uint8_t watch_utility_format_decimal(char *buf, uint32_t value, uint8_t min_digits);
+
 #endif
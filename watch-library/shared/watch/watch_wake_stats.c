@@ -0,0 +1,76 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "watch_wake_stats.h"
+#include "watch_rtc.h"
+
+typedef struct {
+    uint32_t count;
+    rtc_counter_t last_counter;
+    uint16_t buckets[WATCH_WAKE_STATS_BUCKETS];
+} watch_wake_slot_t;
+
+static watch_wake_slot_t _slots[WATCH_WAKE_SOURCE_COUNT];
+
+static const char *_names[WATCH_WAKE_SOURCE_COUNT] = {
+    "RTC per", "RTC cmp", "extwake", "MODE", "LIGHT", "ALARM", "accel", "EIC", "USB"
+};
+
+void watch_wake_stats_record(watch_wake_source_t source) {
+    if (source >= WATCH_WAKE_SOURCE_COUNT) return;
+    watch_wake_slot_t *slot = &_slots[source];
+
+    rtc_counter_t counter = watch_rtc_get_counter();
+    if (slot->count) {
+        uint32_t delta = counter - slot->last_counter;
+        // bucket = floor(log2(delta)), clamped; delta 0 lands in bucket 0.
+        uint8_t bucket = delta ? (uint8_t)(31 - __builtin_clz(delta)) : 0;
+        if (bucket >= WATCH_WAKE_STATS_BUCKETS) bucket = WATCH_WAKE_STATS_BUCKETS - 1;
+        if (slot->buckets[bucket] < UINT16_MAX) slot->buckets[bucket]++;
+    }
+    slot->last_counter = counter;
+    slot->count++;
+}
+
+void watch_wake_stats_get(watch_wake_source_t source, watch_wake_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+    if (source >= WATCH_WAKE_SOURCE_COUNT) return;
+    stats->count = _slots[source].count;
+    memcpy(stats->buckets, (const void *)_slots[source].buckets, sizeof(stats->buckets));
+}
+
+void watch_wake_stats_reset(void) {
+    memset(_slots, 0, sizeof(_slots));
+}
+
+const char *watch_wake_source_name(watch_wake_source_t source) {
+    if (source >= WATCH_WAKE_SOURCE_COUNT) return "?";
+    return _names[source];
+}
+
+const uint32_t *watch_wake_stats_count_ptr(watch_wake_source_t source) {
+    if (source >= WATCH_WAKE_SOURCE_COUNT) source = 0;
+    return &_slots[source].count;
+}
@@ -0,0 +1,82 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * WAKE SOURCE ACCOUNTING
+ *
+ * Every interrupt path that can wake the core tags itself here with one cheap
+ * call, so a unit in the field can self-report what is actually waking it.
+ * Besides a plain count per source, each record keeps a log2-bucketed histogram
+ * of the RTC-tick deltas between consecutive wakes from the same source. The
+ * histogram is what turns suspicion into proof: a button whose EXTINT bounces
+ * shows a spike in the lowest buckets (wakes microseconds to milliseconds
+ * apart), while legitimate presses land several buckets higher.
+ *
+ * Dump everything from the shell with `wakestat`, or page through the raw
+ * counters on the wrist with the peek memory face. USB wakes are attributed
+ * where they become observable (host data arriving at the CDC), since the USB
+ * interrupt handler itself lives in the vendored stack.
+ */
+
+typedef enum {
+    WATCH_WAKE_RTC_PERIODIC = 0, // PER tick interrupts (1-128 Hz callbacks)
+    WATCH_WAKE_RTC_COMP,         // compare interrupts (timeouts, scheduled tasks)
+    WATCH_WAKE_RTC_EXTWAKE,      // tamper-channel wakes from low energy sleep
+    WATCH_WAKE_BTN_MODE,
+    WATCH_WAKE_BTN_LIGHT,
+    WATCH_WAKE_BTN_ALARM,
+    WATCH_WAKE_ACCELEROMETER,    // A3/A4 interrupts (taps, motion transitions)
+    WATCH_WAKE_EIC_OTHER,        // anything else on the external interrupt controller
+    WATCH_WAKE_USB,
+    WATCH_WAKE_SOURCE_COUNT
+} watch_wake_source_t;
+
+#define WATCH_WAKE_STATS_BUCKETS (16)
+
+typedef struct {
+    uint32_t count;                              // total wakes from this source
+    uint16_t buckets[WATCH_WAKE_STATS_BUCKETS];  // log2(delta ticks) inter-arrival histogram
+} watch_wake_stats_t;
+
+/** @brief Tags a wake. Called from interrupt context; one counter read, one
+  *        count-leading-zeros and two increments, so it is safe on any path.
+  */
+void watch_wake_stats_record(watch_wake_source_t source);
+
+/** @brief Copies one source's count and histogram into the caller's struct. */
+void watch_wake_stats_get(watch_wake_source_t source, watch_wake_stats_t *stats);
+
+/** @brief Zeroes all counts and histograms. */
+void watch_wake_stats_reset(void);
+
+/** @brief A short printable name for the source, for the shell dump. */
+const char *watch_wake_source_name(watch_wake_source_t source);
+
+/** @brief The address of one source's live wake counter, for the peek memory face. */
+const uint32_t *watch_wake_stats_count_ptr(watch_wake_source_t source);
@@ -23,8 +23,9 @@
  */
 
 #include "watch_adc.h"
+#include "watch_power.h"
 
-void watch_enable_adc(void) {}
+void watch_enable_adc(void) { watch_power_track_enable(WATCH_POWER_ADC); }
 
 void watch_enable_analog_input(const uint16_t pin) {}
 
@@ -32,6 +33,31 @@ uint16_t watch_get_analog_pin_level(const uint16_t pin) {
     return 32767; // pretend it's half of VCC
 }
 
+uint16_t watch_get_analog_pin_level_filtered(const uint16_t pin) {
+    return 32767; // pretend it's half of VCC
+}
+
+void watch_enable_vcc_monitor(uint16_t threshold_millivolts, watch_cb_t callback) {
+    // the simulator's VCC never sags; the callback simply never fires.
+    (void) threshold_millivolts;
+    (void) callback;
+}
+
+void watch_enable_background_sampling(const uint16_t pin) {
+    (void) pin;
+}
+
+bool watch_get_background_sample(uint16_t *value) {
+    // no event system here; callers fall back to their synchronous reads.
+    (void) value;
+    return false;
+}
+
+void watch_disable_background_sampling(void) {
+}
+
+void watch_disable_vcc_monitor(void) {}
+
 void watch_set_analog_num_samples(uint16_t samples) {}
 
 void watch_set_analog_sampling_length(uint8_t cycles) {}
@@ -45,4 +71,4 @@ uint16_t watch_get_vcc_voltage(void) {
 
 inline void watch_disable_analog_input(const uint16_t pin) {}
 
-inline void watch_disable_adc(void) {}
+inline void watch_disable_adc(void) { watch_power_track_disable(WATCH_POWER_ADC); }
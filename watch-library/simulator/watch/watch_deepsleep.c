@@ -90,6 +90,29 @@ void watch_enter_sleep_mode(void) {
     app_setup();
 }
 
+void watch_enter_sleep_mode_keep_seconds(watch_cb_t seconds_callback, bool (*wake_needed)(void)) {
+    // same teardown as watch_enter_sleep_mode
+    watch_rtc_disable_all_periodic_callbacks();
+    watch_register_interrupt_callback(HAL_GPIO_BTN_MODE_pin(), NULL, INTERRUPT_TRIGGER_NONE);
+    watch_register_interrupt_callback(HAL_GPIO_BTN_LIGHT_pin(), NULL, INTERRUPT_TRIGGER_NONE);
+
+    // the virtual RTC interval keeps firing while we wait here, so the seconds
+    // callback repaints on its own; sleep only returns when a real wake source
+    // calls _wake_up_simulator, at which point the predicate decides.
+    watch_rtc_register_periodic_callback(seconds_callback, 1);
+    do {
+        sleep(4);
+    } while (!wake_needed());
+    watch_rtc_disable_periodic_callback(1);
+
+    app_setup();
+}
+
+void watch_enter_standby_mode(void) {
+    // no teardown, no app_setup on wake; just block until the next event.
+    sleep(4);
+}
+
 void watch_enter_backup_mode(void) {
     // TODO: (a2) hook to UI
 
@@ -26,6 +26,7 @@
 
 #include "watch_extint.h"
 #include "watch_main_loop.h"
+#include "watch_wake_stats.h"
 
 #include <emscripten.h>
 #include <emscripten/html5.h>
@@ -186,6 +187,11 @@ static EM_BOOL watch_invoke_interrupt_callback(const uint8_t button_id, eic_inte
     }
 
     if (callback && (event & trigger) != 0) {
+        switch (button_id) {
+            case BTN_ID_MODE: watch_wake_stats_record(WATCH_WAKE_BTN_MODE); break;
+            case BTN_ID_LIGHT: watch_wake_stats_record(WATCH_WAKE_BTN_LIGHT); break;
+            case BTN_ID_ALARM: watch_wake_stats_record(WATCH_WAKE_BTN_ALARM); break;
+        }
         callback();
         resume_main_loop();
     }
@@ -193,6 +199,12 @@ static EM_BOOL watch_invoke_interrupt_callback(const uint8_t button_id, eic_inte
     return EM_TRUE;
 }
 
+void watch_register_interrupt_callback_with_filter(const uint8_t pin, watch_cb_t callback, eic_interrupt_trigger_t trigger, watch_interrupt_filter_t filter) {
+    // browser mouse and key events arrive pre-debounced; conditioning is a no-op here.
+    (void) filter;
+    watch_register_interrupt_callback(pin, callback, trigger);
+}
+
 void watch_register_interrupt_callback(const uint8_t pin, watch_cb_t callback, eic_interrupt_trigger_t trigger) {
     if (pin == HAL_GPIO_BTN_MODE_pin()) {
         external_interrupt_mode_callback = callback;
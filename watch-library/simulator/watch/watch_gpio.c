@@ -43,3 +43,34 @@ void watch_disable_digital_output(const uint8_t pin) {}
 
 void watch_set_pin_level(const uint8_t pin, const bool level) {
 }
+
+void watch_set_pins(const uint8_t port, const uint32_t mask) {
+    (void) port;
+    (void) mask;
+}
+
+void watch_clear_pins(const uint8_t port, const uint32_t mask) {
+    (void) port;
+    (void) mask;
+}
+
+void watch_toggle_pins(const uint8_t port, const uint32_t mask) {
+    (void) port;
+    (void) mask;
+}
+
+void watch_enable_output_pins(const uint8_t port, const uint32_t mask) {
+    (void) port;
+    (void) mask;
+}
+
+void watch_disable_output_pins(const uint8_t port, const uint32_t mask) {
+    (void) port;
+    (void) mask;
+}
+
+uint32_t watch_get_pins(const uint8_t port, const uint32_t mask) {
+    (void) port;
+    (void) mask;
+    return 0;
+}
@@ -22,36 +22,279 @@
  * SOFTWARE.
  */
 
+#include <string.h>
 #include "watch_i2c.h"
+#include "watch_power.h"
+#include "watch_bus.h"
+#include "watch_rtc.h"
+#include "lis2dw.h" // register map for the emulated accelerometer below
 
-void watch_enable_i2c(void) {}
+/*
+ * The only device on the watch's I2C bus is the LIS2DW accelerometer, so the
+ * simulator emulates it at the register level: a register file behind the
+ * standard I2C calls, with data registers fed from a synthetic motion trace
+ * (or a recorded one injected via lis2dw_sim_set_trace) at the configured
+ * output data rate, driven off the RTC counter. The FIFO fills at ODR and
+ * drains through the OUT registers with the real part's address wrap-around,
+ * so the batching paths — sample counts, threshold and overrun bits, burst
+ * drains — behave and can be profiled like hardware. Transactions addressed
+ * to anything else NAK, exactly like the real bus.
+ */
+
+#define SIM_LIS2DW_NUM_REGS (0x40)
+#define SIM_LIS2DW_FIFO_DEPTH (32)
+#define SIM_LIS2DW_ONE_G (4096) // raw counts for 1 g, 14 bit data at the default ±2g range
+
+static uint8_t sim_regs[SIM_LIS2DW_NUM_REGS];
+static bool sim_initialized = false;
+static uint8_t sim_reg_pointer = 0;
+
+static uint8_t sim_fifo_count = 0;
+static bool sim_fifo_overrun = false;
+static uint32_t sim_sample_index = 0;  // index of the sample at the FIFO head
+static uint32_t sim_last_counter = 0;  // RTC counter at the last arrival update
+static uint32_t sim_arrival_accum = 0; // fractional arrivals, in RTC ticks × deci-hertz
+
+static const lis2dw_reading_t *sim_trace = NULL;
+static uint8_t sim_trace_length = 0;
+static uint16_t sim_motion_amplitude = 256;
+
+// CTRL1 ODR codes in deci-hertz; 1.6 Hz rounds to 2 Hz, everything past
+// 200 Hz is close enough to its nominal rate for simulation purposes.
+static const uint16_t _sim_odr_dhz[] = {0, 16, 125, 250, 500, 1000, 2000, 4000, 8000, 16000};
+
+static void _sim_reset_registers(void) {
+    memset(sim_regs, 0, SIM_LIS2DW_NUM_REGS);
+    sim_regs[LIS2DW_REG_WHO_AM_I] = LIS2DW_WHO_AM_I_VAL;
+    // OUT_TEMP reads 0 at 25 °C, so zeroed temperature registers are correct.
+    sim_fifo_count = 0;
+    sim_fifo_overrun = false;
+    sim_arrival_accum = 0;
+}
+
+static uint16_t _sim_odr(void) {
+    uint8_t code = sim_regs[LIS2DW_REG_CTRL1] >> 4;
+    if (code >= sizeof(_sim_odr_dhz) / sizeof(_sim_odr_dhz[0])) code = 9;
+    return _sim_odr_dhz[code];
+}
+
+// Samples are a pure function of their index, so the FIFO never has to buffer
+// them: popping just advances the index. Gravity on Z, plus a triangle-wave
+// wrist swing on all three axes scaled by the configured amplitude.
+static lis2dw_reading_t _sim_sample(uint32_t index) {
+    lis2dw_reading_t reading;
+    if (sim_trace && sim_trace_length) return sim_trace[index % sim_trace_length];
+    uint32_t phase = index & 31;
+    int32_t triangle = (phase < 16) ? ((int32_t)phase - 8) : (23 - (int32_t)phase); // -8..7..-8
+    reading.x = (int16_t)(triangle * sim_motion_amplitude / 8);
+    reading.y = (int16_t)(-triangle * sim_motion_amplitude / 16);
+    reading.z = (int16_t)(SIM_LIS2DW_ONE_G + triangle * sim_motion_amplitude / 32);
+    return reading;
+}
+
+static void _sim_latch_output(void) {
+    lis2dw_reading_t reading = _sim_sample(sim_sample_index);
+    sim_regs[LIS2DW_REG_OUT_X_L] = reading.x & 0xFF;
+    sim_regs[LIS2DW_REG_OUT_X_H] = (reading.x >> 8) & 0xFF;
+    sim_regs[LIS2DW_REG_OUT_Y_L] = reading.y & 0xFF;
+    sim_regs[LIS2DW_REG_OUT_Y_H] = (reading.y >> 8) & 0xFF;
+    sim_regs[LIS2DW_REG_OUT_Z_L] = reading.z & 0xFF;
+    sim_regs[LIS2DW_REG_OUT_Z_H] = (reading.z >> 8) & 0xFF;
+}
+
+// Accrue sample arrivals since the last access: one sample per 1280 / ODR
+// (in deci-hertz) RTC ticks, with the remainder carried so long idle gaps
+// and odd rates don't drift.
+static void _sim_advance(void) {
+    if (!sim_initialized) {
+        _sim_reset_registers();
+        sim_last_counter = watch_rtc_get_counter();
+        sim_initialized = true;
+    }
+
+    uint32_t now = watch_rtc_get_counter();
+    uint16_t odr_dhz = _sim_odr();
+    if (odr_dhz == 0) {
+        sim_last_counter = now;
+        sim_arrival_accum = 0;
+        return;
+    }
+
+    sim_arrival_accum += (now - sim_last_counter) * odr_dhz;
+    sim_last_counter = now;
+    uint32_t arrivals = sim_arrival_accum / 1280;
+    sim_arrival_accum -= arrivals * 1280;
+    if (arrivals == 0) return;
+
+    if ((sim_regs[LIS2DW_REG_FIFO_CTRL] >> 5) == LIS2DW_FIFO_MODE_OFF) {
+        // bypass mode: the OUT registers just hold the latest sample.
+        sim_sample_index += arrivals;
+        sim_fifo_count = 0;
+    } else {
+        if (sim_fifo_count + arrivals > SIM_LIS2DW_FIFO_DEPTH) {
+            sim_fifo_overrun = true;
+            arrivals = SIM_LIS2DW_FIFO_DEPTH - sim_fifo_count;
+        }
+        sim_fifo_count += arrivals;
+    }
+    _sim_latch_output();
+}
+
+static void _sim_pop(void) {
+    if (sim_fifo_count == 0) return;
+    sim_fifo_count--;
+    sim_sample_index++;
+    _sim_latch_output();
+}
 
-void watch_disable_i2c(void) {}
+static void _sim_write_register(uint8_t reg, uint8_t value) {
+    if (reg >= SIM_LIS2DW_NUM_REGS) return;
+    if (reg == LIS2DW_REG_CTRL2 && (value & (LIS2DW_CTRL2_VAL_BOOT | LIS2DW_CTRL2_VAL_SOFT_RESET))) {
+        _sim_reset_registers(); // both bits self-clear
+        return;
+    }
+    if (reg == LIS2DW_REG_FIFO_CTRL && (value >> 5) == LIS2DW_FIFO_MODE_OFF) {
+        // switching to bypass clears the FIFO, which is how lis2dw_clear_fifo works.
+        sim_fifo_count = 0;
+        sim_fifo_overrun = false;
+        sim_arrival_accum = 0;
+    }
+    sim_regs[reg] = value;
+}
+
+static uint8_t _sim_read_register(uint8_t reg) {
+    if (reg >= SIM_LIS2DW_NUM_REGS) return 0;
+    switch (reg) {
+        case LIS2DW_REG_STATUS: {
+            uint8_t threshold = sim_regs[LIS2DW_REG_FIFO_CTRL] & LIS2DW_FIFO_CTRL_FTH;
+            uint8_t status = (_sim_odr() != 0) ? LIS2DW_STATUS_VAL_DRDY : 0;
+            if (threshold && sim_fifo_count >= threshold) status |= LIS2DW_STATUS_VAL_FIFO_THS;
+            return status;
+        }
+        case LIS2DW_REG_FIFO_SAMPLE: {
+            uint8_t threshold = sim_regs[LIS2DW_REG_FIFO_CTRL] & LIS2DW_FIFO_CTRL_FTH;
+            uint8_t value = sim_fifo_count & LIS2DW_FIFO_SAMPLE_COUNT;
+            if (sim_fifo_overrun) value |= LIS2DW_FIFO_SAMPLE_OVERRUN;
+            if (threshold && sim_fifo_count >= threshold) value |= LIS2DW_FIFO_SAMPLE_THRESHOLD;
+            sim_fifo_overrun = false; // reading the flag clears it
+            return value;
+        }
+        case LIS2DW_REG_WAKE_UP_SRC:
+            // with no synthetic motion the wearer is stationary.
+            return (sim_motion_amplitude == 0 && sim_trace == NULL) ? LIS2DW_WAKE_UP_SRC_VAL_SLEEP_STATE_IA : 0;
+        case LIS2DW_REG_OUT_Z_H: {
+            uint8_t value = sim_regs[reg];
+            // completing a sample read pops the FIFO entry it came from.
+            if ((sim_regs[LIS2DW_REG_FIFO_CTRL] >> 5) != LIS2DW_FIFO_MODE_OFF) _sim_pop();
+            return value;
+        }
+        default:
+            return sim_regs[reg];
+    }
+}
+
+// Register address auto-increment: past OUT_Z_H the pointer rolls back to
+// OUT_X_L, which is what lets a single burst read drain the whole FIFO.
+static uint8_t _sim_next_pointer(uint8_t reg) {
+    if (reg == LIS2DW_REG_OUT_Z_H) return LIS2DW_REG_OUT_X_L;
+    return (reg + 1) % SIM_LIS2DW_NUM_REGS;
+}
+
+void lis2dw_sim_set_trace(const lis2dw_reading_t *readings, uint8_t count) {
+    sim_trace = readings;
+    sim_trace_length = count;
+}
+
+void lis2dw_sim_set_motion_amplitude(uint16_t amplitude) {
+    sim_motion_amplitude = amplitude;
+}
+
+void watch_enable_i2c(void) { if (_watch_bus_claim(WATCH_BUS_I2C)) watch_power_track_enable(WATCH_POWER_I2C); }
+
+void watch_disable_i2c(void) { if (_watch_bus_release(WATCH_BUS_I2C)) watch_power_track_disable(WATCH_POWER_I2C); }
+
+// the simulated bus has no clock; just remember the selection for get_speed.
+static watch_i2c_speed_t _i2c_speed = WATCH_I2C_SPEED_STANDARD;
+
+void watch_i2c_set_speed(watch_i2c_speed_t speed) { _i2c_speed = speed; }
+
+watch_i2c_speed_t watch_i2c_get_speed(void) { return _i2c_speed; }
 
 int8_t watch_i2c_send(int16_t addr, uint8_t *buf, uint16_t length) {
+    if (addr != LIS2DW_ADDRESS) return -1; // nothing else on the bus: NAK
+    _sim_advance();
+    if (length == 0) return 0;
+    sim_reg_pointer = buf[0] & 0x7F; // high bit is the multi-byte convention; increment is modeled regardless
+    for (uint16_t i = 1; i < length; i++) {
+        _sim_write_register(sim_reg_pointer, buf[i]);
+        sim_reg_pointer = _sim_next_pointer(sim_reg_pointer);
+    }
     return 0;
 }
 
 int8_t watch_i2c_receive(int16_t addr, uint8_t *buf, uint16_t length) {
+    if (addr != LIS2DW_ADDRESS) return -1;
+    _sim_advance();
+    for (uint16_t i = 0; i < length; i++) {
+        buf[i] = _sim_read_register(sim_reg_pointer);
+        sim_reg_pointer = _sim_next_pointer(sim_reg_pointer);
+    }
     return 0;
 }
 
 int8_t watch_i2c_write8(int16_t addr, uint8_t reg, uint8_t data) {
+    if (addr != LIS2DW_ADDRESS) return -1;
+    _sim_advance();
+    _sim_write_register(reg, data);
     return 0;
 }
 
 uint8_t watch_i2c_read8(int16_t addr, uint8_t reg) {
-    return 0;
+    if (addr != LIS2DW_ADDRESS) return 0;
+    _sim_advance();
+    return _sim_read_register(reg);
 }
 
 uint16_t watch_i2c_read16(int16_t addr, uint8_t reg) {
-    return 0;
+    if (addr != LIS2DW_ADDRESS) return 0;
+    _sim_advance();
+    uint16_t value = _sim_read_register(reg);
+    value |= (uint16_t)_sim_read_register(_sim_next_pointer(reg)) << 8;
+    return value;
 }
 
 uint32_t watch_i2c_read24(int16_t addr, uint8_t reg) {
-    return 0;
+    if (addr != LIS2DW_ADDRESS) return 0;
+    _sim_advance();
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < 3; i++) {
+        value |= (uint32_t)_sim_read_register(reg) << (8 * i);
+        reg = _sim_next_pointer(reg);
+    }
+    return value;
 }
 
 uint32_t watch_i2c_read32(int16_t addr, uint8_t reg) {
-    return 0;
+    if (addr != LIS2DW_ADDRESS) return 0;
+    _sim_advance();
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < 4; i++) {
+        value |= (uint32_t)_sim_read_register(reg) << (8 * i);
+        reg = _sim_next_pointer(reg);
+    }
+    return value;
+}
+
+bool watch_i2c_submit(int16_t addr, const uint8_t *tx_buf, uint16_t tx_length, uint8_t *rx_buf, uint16_t rx_length, watch_i2c_cb_t callback_on_complete) {
+    // no bus to be asynchronous about: run the transfer against the emulated
+    // device and complete immediately.
+    int8_t result = 0;
+    if (tx_length) result = watch_i2c_send(addr, (uint8_t *)tx_buf, tx_length);
+    if (result == 0 && rx_length) result = watch_i2c_receive(addr, rx_buf, rx_length);
+    if (callback_on_complete) callback_on_complete(result);
+    return true;
+}
+
+bool watch_i2c_async_in_progress(void) {
+    return false;
 }
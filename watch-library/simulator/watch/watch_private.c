@@ -31,6 +31,10 @@ void _watch_init(void) {
     _watch_rtc_init();
 }
 
+// the simulator has no clock tree; speed requests are accepted and ignored.
+void watch_request_cpu_speed(watch_cpu_speed_t speed) { (void) speed; }
+void watch_release_cpu_speed(watch_cpu_speed_t speed) { (void) speed; }
+
 // this function is called by arc4random to get entropy for random number generation.
 // let's use the SAM L22's true random number generator to seed the PRNG!
 int getentropy(void *buf, size_t buflen);
@@ -26,6 +26,7 @@
 #include "watch_rtc.h"
 #include "watch_main_loop.h"
 #include "watch_utility.h"
+#include "watch_wake_stats.h"
 
 #include <emscripten.h>
 #include <emscripten/html5.h>
@@ -120,6 +121,10 @@ uint32_t watch_rtc_get_ticks_per_minute(void) {
     return RTC_CNT_TICKS_PER_MINUTE;
 }
 
+uint32_t watch_rtc_counter_to_centiseconds(rtc_counter_t ticks) {
+    return (ticks >> RTC_CNT_DIV) * 100 + (((ticks & RTC_CNT_SUBSECOND_MASK) * 100) >> RTC_CNT_DIV);
+}
+
 rtc_date_time_t watch_get_init_date_time(void) {
     rtc_date_time_t date_time = {0};
 
@@ -164,14 +169,30 @@ void watch_rtc_disable_tick_callback(void) {
     watch_rtc_disable_periodic_callback(1);
 }
 
+// Soak-testing time warp: virtual ticks delivered per real 128 Hz interval.
+static uint32_t time_warp_factor = 1;
+
+void watch_rtc_set_time_warp(uint32_t factor) {
+    time_warp_factor = factor ? factor : 1;
+}
+
+uint32_t watch_rtc_get_time_warp(void) {
+    return time_warp_factor;
+}
+
 static void _watch_increase_counter(void *userData) {
     (void) userData;
 
-    counter += 1;
-    // Fire the periodic callbacks that match this counter
-    _watch_process_periodic_callbacks();
-    // Fire the comp callbacks that match this counter
-    _watch_process_comp_callbacks();
+    // Advance the virtual counter one tick at a time so every periodic and comp
+    // callback fires at its exact counter value and in order; at warp factor 1
+    // this is the same single step the simulator has always taken.
+    for (uint32_t i = 0; i < time_warp_factor; i++) {
+        counter += 1;
+        // Fire the periodic callbacks that match this counter
+        _watch_process_periodic_callbacks();
+        // Fire the comp callbacks that match this counter
+        _watch_process_comp_callbacks();
+    }
 
     resume_main_loop();
 }
@@ -207,6 +228,7 @@ static void _watch_process_periodic_callbacks(void) {
     }
 
     if (tick_callbacks[per_n]) {
+        watch_wake_stats_record(WATCH_WAKE_RTC_PERIODIC);
         tick_callbacks[per_n]();
     }
 
@@ -222,6 +244,7 @@ static void _watch_process_comp_callbacks(void) {
         for (uint8_t index = 0; index < WATCH_RTC_N_COMP_CB; ++index) {
             if (comp_callbacks[index].enabled && scheduled_comp_counter == comp_callbacks[index].counter) {
                 comp_callbacks[index].enabled = false;
+                watch_wake_stats_record(WATCH_WAKE_RTC_COMP);
                 comp_callbacks[index].callback();
             }
         }
@@ -356,3 +379,9 @@ void watch_rtc_freqcorr_write(int16_t value, int16_t sign)
 {
     //Not simulated
 }
+
+void watch_rtc_phase_adjust(int32_t milliseconds)
+{
+    (void) milliseconds;
+    //Not simulated: there is no frequency correction register to slew against
+}
@@ -37,6 +37,11 @@ static long blink_interval_id = - 1;
 static bool tick_state;
 static long tick_interval_id = -1;
 
+void watch_enable_lcd_type_cache(uint8_t backup_register) {
+    // the simulator's LCD type is fixed at build time; nothing to cache.
+    (void) backup_register;
+}
+
 watch_lcd_type_t watch_get_lcd_type(void) {
 #if defined(FORCE_CUSTOM_LCD_TYPE)
     return WATCH_LCD_TYPE_CUSTOM;
@@ -67,7 +72,27 @@ void watch_disable_display(void) {
     EM_ASM({document.getElementById("custom").style.display = "none";});
 }
 
+// Display traffic counters for the instrumentation bridge in movement.c. There is no
+// SLCD hardware to account against here, so the stubs tally the traffic themselves.
+uint32_t _sim_display_commit_count;
+uint32_t _sim_display_pixel_writes;
+
+// The simulator renders pixels straight to the DOM, so frames are not buffered; the
+// calls still nest correctly for code shared with the hardware build.
+void watch_display_begin_frame(void) {}
+
+void watch_display_commit_frame(void) {
+    _sim_display_commit_count++;
+}
+
+void watch_display_snapshot(void) {}
+
+void watch_display_restore_snapshot(void) {}
+
 void watch_set_pixel(uint8_t com, uint8_t seg) {
+    // a raw pixel write may overdraw a cached character; drop the shadow buffer
+    if (!_watch_display_character_in_progress) watch_display_cache_invalidate();
+    _sim_display_pixel_writes++;
     EM_ASM({
         document.querySelectorAll("[data-com='" + $0 + "'][data-seg='" + $1 + "']")
             .forEach((e) => e.style.opacity = 1);
@@ -75,6 +100,8 @@ void watch_set_pixel(uint8_t com, uint8_t seg) {
 }
 
 void watch_clear_pixel(uint8_t com, uint8_t seg) {
+    if (!_watch_display_character_in_progress) watch_display_cache_invalidate();
+    _sim_display_pixel_writes++;
     EM_ASM({
         document.querySelectorAll("[data-com='" + $0 + "'][data-seg='" + $1 + "']")
             .forEach((e) => e.style.opacity = 0);
@@ -82,6 +109,7 @@ void watch_clear_pixel(uint8_t com, uint8_t seg) {
 }
 
 void watch_clear_display(void) {
+    watch_display_cache_invalidate();
     EM_ASM({
         document.querySelectorAll("[data-com][data-seg]")
             .forEach((e) => e.style.opacity = 0);
@@ -104,8 +132,23 @@ void watch_start_character_blink(char character, uint32_t duration) {
     blink_interval_id = emscripten_set_interval(watch_invoke_blink_callback, (double)duration, NULL);
 }
 
+bool watch_start_pixel_blink_if_possible(uint8_t com, uint8_t seg, uint32_t duration) {
+    /// TODO: For #SecondMovement, implement autonomous blink on simulator
+    (void) com;
+    (void) seg;
+    (void) duration;
+    return false;
+}
+
+void watch_start_display_blink(uint32_t duration) {
+    /// TODO: For #SecondMovement, implement autonomous blink on simulator
+    (void) duration;
+}
+
 void watch_start_indicator_blink_if_possible(watch_indicator_t indicator, uint32_t duration) {
     /// TODO: For #SecondMovement, implement this on simulator
+    (void) indicator;
+    (void) duration;
 }
 
 void watch_stop_blink(void) {
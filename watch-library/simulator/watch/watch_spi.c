@@ -22,14 +22,149 @@
  * SOFTWARE.
  */
 
+#include <string.h>
 #include "watch_spi.h"
+#include "watch_power.h"
+#include "watch_bus.h"
+#include "spiflash.h" // command opcodes for the emulated flash below
 
-void watch_enable_spi(void) {}
+/*
+ * The only device on the watch's SPI bus is the Sensor Board's 2 MB NOR flash,
+ * so rather than stubbing the bus out, emulate the chip behind it: the ring
+ * log and anything else built on spiflash.c runs unmodified in the simulator.
+ * The emulation covers the command sequences spiflash.c actually issues —
+ * read/fast read, page program (with the real chip's AND-write and page wrap
+ * semantics), sector and chip erase gated on write enable, JEDEC ID and the
+ * status register. Programs and erases complete instantly, so the status
+ * register never reads busy.
+ *
+ * Contents live in a RAM array for the browser session, the same lifetime as
+ * the emulated internal flash in watch_storage.c; persisting either one to
+ * IndexedDB is a hosting-page concern, not a HAL one.
+ */
+
+#define SIM_FLASH_SIZE (2 * 1024 * 1024)
+#define SIM_FLASH_PAGE_SIZE (256)
+#define SIM_FLASH_SECTOR_SIZE (4096)
+
+typedef enum {
+    SIM_FLASH_PHASE_COMMAND = 0, // next write is a command
+    SIM_FLASH_PHASE_READ_DATA,   // next read returns data at the latched address
+    SIM_FLASH_PHASE_WRITE_DATA,  // next write is page program payload
+    SIM_FLASH_PHASE_READ_ID,     // next read returns the JEDEC ID
+    SIM_FLASH_PHASE_READ_STATUS, // next read returns the status register
+} sim_flash_phase_t;
+
+static uint8_t sim_flash[SIM_FLASH_SIZE];
+static bool sim_flash_primed = false;
+static sim_flash_phase_t sim_flash_phase = SIM_FLASH_PHASE_COMMAND;
+static uint32_t sim_flash_address = 0;
+static bool sim_flash_write_enabled = false;
+
+static void _sim_flash_prime(void) {
+    if (sim_flash_primed) return;
+    memset(sim_flash, 0xFF, SIM_FLASH_SIZE); // erased flash reads back 0xFF
+    sim_flash_primed = true;
+}
+
+static uint32_t _sim_flash_command_address(const uint8_t *buf) {
+    return (((uint32_t)buf[1] << 16) | ((uint32_t)buf[2] << 8) | buf[3]) % SIM_FLASH_SIZE;
+}
+
+void watch_enable_spi(void) { if (_watch_bus_claim(WATCH_BUS_SPI)) watch_power_track_enable(WATCH_POWER_SPI); }
+
+void watch_disable_spi(void) { if (_watch_bus_release(WATCH_BUS_SPI)) watch_power_track_disable(WATCH_POWER_SPI); }
+
+// The simulated bus has no clock to scale and the emulated flash ignores chip select,
+// so device selection is a no-op here.
+void watch_spi_device_select(const watch_spi_device_t *device) { (void) device; }
+
+void watch_spi_device_deselect(const watch_spi_device_t *device) { (void) device; }
+
+bool watch_spi_write(const uint8_t *buf, uint16_t length) {
+    _sim_flash_prime();
+    if (length == 0) return true;
 
-void watch_disable_spi(void) {}
+    if (sim_flash_phase == SIM_FLASH_PHASE_WRITE_DATA) {
+        // page program payload. Like the real chip: program can only clear
+        // bits, and the address wraps within a 256 byte page.
+        for (uint16_t i = 0; i < length; i++) {
+            if (sim_flash_write_enabled) {
+                uint32_t address = (sim_flash_address & ~(uint32_t)(SIM_FLASH_PAGE_SIZE - 1))
+                                 | ((sim_flash_address + i) & (SIM_FLASH_PAGE_SIZE - 1));
+                sim_flash[address] &= buf[i];
+            }
+        }
+        sim_flash_write_enabled = false;
+        sim_flash_phase = SIM_FLASH_PHASE_COMMAND;
+        return true;
+    }
 
-bool watch_spi_write(const uint8_t *buf, uint16_t length) { return false; }
+    sim_flash_phase = SIM_FLASH_PHASE_COMMAND;
+    switch (buf[0]) {
+        case CMD_READ_DATA:
+        case CMD_FAST_READ_DATA: // the dummy byte rode along in the command buffer
+            sim_flash_address = _sim_flash_command_address(buf);
+            sim_flash_phase = SIM_FLASH_PHASE_READ_DATA;
+            break;
+        case CMD_PAGE_PROGRAM:
+            sim_flash_address = _sim_flash_command_address(buf);
+            sim_flash_phase = SIM_FLASH_PHASE_WRITE_DATA;
+            break;
+        case CMD_SECTOR_ERASE:
+            if (sim_flash_write_enabled) {
+                uint32_t address = _sim_flash_command_address(buf) & ~(uint32_t)(SIM_FLASH_SECTOR_SIZE - 1);
+                memset(sim_flash + address, 0xFF, SIM_FLASH_SECTOR_SIZE);
+            }
+            sim_flash_write_enabled = false;
+            break;
+        case CMD_CHIP_ERASE:
+            if (sim_flash_write_enabled) memset(sim_flash, 0xFF, SIM_FLASH_SIZE);
+            sim_flash_write_enabled = false;
+            break;
+        case CMD_ENABLE_WRITE:
+            sim_flash_write_enabled = true;
+            break;
+        case CMD_DISABLE_WRITE:
+            sim_flash_write_enabled = false;
+            break;
+        case CMD_READ_JEDEC_ID:
+            sim_flash_phase = SIM_FLASH_PHASE_READ_ID;
+            break;
+        case CMD_READ_STATUS:
+            sim_flash_phase = SIM_FLASH_PHASE_READ_STATUS;
+            break;
+        default:
+            // reset, wake, deep power down et al. have no observable effect here.
+            break;
+    }
+    return true;
+}
 
-bool watch_spi_read(uint8_t *buf, uint16_t length) { return false; }
+bool watch_spi_read(uint8_t *buf, uint16_t length) {
+    _sim_flash_prime();
+    switch (sim_flash_phase) {
+        case SIM_FLASH_PHASE_READ_DATA:
+            for (uint16_t i = 0; i < length; i++) buf[i] = sim_flash[(sim_flash_address + i) % SIM_FLASH_SIZE];
+            break;
+        case SIM_FLASH_PHASE_READ_ID: {
+            const uint8_t jedec_id[3] = {0xC8, 0x40, 0x15}; // GD25Q16, as on the Sensor Board
+            for (uint16_t i = 0; i < length; i++) buf[i] = (i < 3) ? jedec_id[i] : 0x00;
+            break;
+        }
+        case SIM_FLASH_PHASE_READ_STATUS:
+            // bit 0 (busy) is always clear: operations complete instantly here.
+            memset(buf, sim_flash_write_enabled ? 0x02 : 0x00, length);
+            break;
+        default:
+            memset(buf, 0xFF, length); // bus idle
+            break;
+    }
+    sim_flash_phase = SIM_FLASH_PHASE_COMMAND;
+    return true;
+}
 
-bool watch_spi_transfer(const uint8_t *data_out, uint8_t *data_in, uint16_t length) { return false; }
+bool watch_spi_transfer(const uint8_t *data_out, uint8_t *data_in, uint16_t length) {
+    (void) data_out; // the flash ignores MOSI during its data-out phases
+    return watch_spi_read(data_in, length);
+}
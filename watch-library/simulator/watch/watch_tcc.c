@@ -23,6 +23,7 @@
  */
 
 #include "watch_tcc.h"
+#include "watch_power.h"
 #include "watch_main_loop.h"
 
 #include <emscripten.h>
@@ -37,10 +38,10 @@ void cb_watch_buzzer_raw_source(void *userData);
 static uint16_t _seq_position;
 static int8_t _tone_ticks, _repeat_counter;
 static volatile long _em_interval_id = 0;
-static int8_t *_sequence;
+static const int8_t *_sequence;
 static watch_buzzer_raw_source_t _raw_source;
 static void* _userdata;
-static uint8_t _volume;
+static watch_buzzer_volume_t _volume;
 static void (*_cb_finished)(void);
 static watch_cb_t _cb_start_global = NULL;
 static watch_cb_t _cb_stop_global = NULL;
@@ -51,11 +52,11 @@ static inline void _em_interval_stop() {
     _em_interval_id = 0;
 }
 
-void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void)) {
+void watch_buzzer_play_sequence(const int8_t *note_sequence, void (*callback_on_end)(void)) {
     watch_buzzer_play_sequence_with_volume(note_sequence, callback_on_end, WATCH_BUZZER_VOLUME_LOUD);
 }
 
-void watch_buzzer_play_sequence_with_volume(int8_t *note_sequence, void (*callback_on_end)(void), watch_buzzer_volume_t volume) {
+void watch_buzzer_play_sequence_with_volume(const int8_t *note_sequence, void (*callback_on_end)(void), watch_buzzer_volume_t volume) {
     watch_buzzer_abort_sequence();
 
     // prepare buzzer
@@ -70,7 +71,7 @@ void watch_buzzer_play_sequence_with_volume(int8_t *note_sequence, void (*callba
 
     _sequence = note_sequence;
     _cb_finished = callback_on_end;
-    _volume = volume == WATCH_BUZZER_VOLUME_SOFT ? 5 : 25;
+    _volume = volume;
     _seq_position = 0;
     _tone_ticks = 0;
     _repeat_counter = -1;
@@ -139,7 +140,7 @@ void watch_buzzer_play_raw_source_with_volume(watch_buzzer_raw_source_t raw_sour
     _raw_source = raw_source;
     _userdata = userdata;
     _cb_finished = callback_on_end;
-    _volume = volume == WATCH_BUZZER_VOLUME_SOFT ? 5 : 25;
+    _volume = volume;
     _seq_position = 0;
     _tone_ticks = 0;
 
@@ -200,11 +201,12 @@ void watch_buzzer_abort_sequence(void) {
 }
 
 void watch_buzzer_register_global_callbacks(watch_cb_t cb_start, watch_cb_t cb_stop) {
-    _cb_stop_global = cb_start;
+    _cb_start_global = cb_start;
     _cb_stop_global = cb_stop;
 }
 
 void watch_enable_buzzer(void) {
+    watch_power_track_enable(WATCH_POWER_BUZZER);
     watch_buzzer_abort_sequence();
     buzzer_enabled = true;
     buzzer_period = NotePeriods[BUZZER_NOTE_A4];
@@ -225,6 +227,7 @@ void watch_set_buzzer_period_and_duty_cycle(uint32_t period, uint8_t duty_cycle)
 }
 
 void watch_disable_buzzer(void) {
+    watch_power_track_disable(WATCH_POWER_BUZZER);
     buzzer_enabled = false;
     buzzer_period = NotePeriods[BUZZER_NOTE_A4];
 }
@@ -282,9 +285,9 @@ void watch_buzzer_play_note_with_volume(watch_buzzer_note_t note, uint16_t durat
     watch_buzzer_play_sequence_with_volume(single_note_sequence, NULL, volume);
 }
 
-void watch_enable_leds(void) {}
+void watch_enable_leds(void) { watch_power_track_enable(WATCH_POWER_LEDS); }
 
-void watch_disable_leds(void) {}
+void watch_disable_leds(void) { watch_power_track_disable(WATCH_POWER_LEDS); }
 
 void watch_set_led_color_rgb(uint8_t red, uint8_t green, uint8_t blue) {
     EM_ASM({
@@ -297,6 +300,18 @@ void watch_set_led_color_rgb(uint8_t red, uint8_t green, uint8_t blue) {
     }, red, green, blue);
 }
 
+// the simulator has no TCC to time a fade against; jump straight to the target
+// and fire the completion callback so sequenced effects still advance.
+void watch_led_fade_to(uint8_t red, uint8_t green, uint8_t blue, uint16_t duration_ms, watch_cb_t callback_on_complete) {
+    (void) duration_ms;
+    watch_set_led_color_rgb(red, green, blue);
+    if (callback_on_complete) callback_on_complete();
+}
+
+bool watch_led_fade_in_progress(void) { return false; }
+
+void watch_led_fade_abort(void) {}
+
 void watch_set_led_red(void) {
     watch_set_led_color_rgb(255, 0, 0);
 }
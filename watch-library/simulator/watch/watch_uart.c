@@ -23,6 +23,8 @@
  */
 
 #include "watch_uart.h"
+#include "watch_power.h"
+#include "watch_bus.h"
 
 static bool tx_enable = false;
 static bool rx_enable = false;
@@ -30,6 +32,7 @@ static bool rx_enable = false;
 void watch_enable_uart(const uint16_t tx_pin, const uint16_t rx_pin, uint32_t baud) {
     tx_enable = !!tx_pin;
     rx_enable = !!rx_pin;
+    if (_watch_bus_claim(WATCH_BUS_UART)) watch_power_track_enable(WATCH_POWER_UART);
 }
 
 void watch_uart_puts(char *s) {
@@ -44,3 +47,33 @@ size_t watch_uart_gets(char *data, size_t max_length) {
     }
     return 0;
 }
+
+void watch_uart_rx_dma_enable(uint8_t sercom_instance, uint8_t *buffer, size_t size) {
+    (void) sercom_instance;
+    (void) buffer;
+    (void) size;
+}
+
+size_t watch_uart_rx_dma_read(uint8_t *data, size_t max_length) {
+    (void) data;
+    (void) max_length;
+    return 0;
+}
+
+void watch_uart_rx_dma_disable(void) {
+}
+
+bool watch_uart_tx_dma_write(uint8_t sercom_instance, const uint8_t *data, size_t length, void (*callback)(void)) {
+    (void) sercom_instance;
+    (void) data;
+    (void) length;
+    if (callback) callback();
+    return false;
+}
+
+bool watch_uart_tx_dma_busy(void) {
+    return false;
+}
+
+void watch_uart_tx_dma_wait(void) {
+}